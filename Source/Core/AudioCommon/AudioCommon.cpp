@@ -14,15 +14,11 @@
 #include "Common/FileUtil.h"
 #include "Common/Logging/Log.h"
 #include "Core/ConfigManager.h"
-
-// This shouldn't be a global, at least not here.
-std::unique_ptr<SoundStream> g_sound_stream;
+#include "Core/RunAhead.h"
+#include "Core/System.h"
 
 namespace AudioCommon
 {
-static bool s_audio_dump_start = false;
-static bool s_sound_stream_running = false;
-
 constexpr int AUDIO_VOLUME_MIN = 0;
 constexpr int AUDIO_VOLUME_MAX = 100;
 
@@ -48,22 +44,24 @@ static std::unique_ptr<SoundStream> CreateSoundStreamForBackend(std::string_view
 void InitSoundStream()
 {
   std::string backend = SConfig::GetInstance().sBackend;
-  g_sound_stream = CreateSoundStreamForBackend(backend);
+  std::unique_ptr<SoundStream> sound_stream = CreateSoundStreamForBackend(backend);
 
-  if (!g_sound_stream)
+  if (!sound_stream)
   {
     WARN_LOG_FMT(AUDIO, "Unknown backend {}, using {} instead.", backend, GetDefaultSoundBackend());
     backend = GetDefaultSoundBackend();
-    g_sound_stream = CreateSoundStreamForBackend(GetDefaultSoundBackend());
+    sound_stream = CreateSoundStreamForBackend(GetDefaultSoundBackend());
   }
 
-  if (!g_sound_stream || !g_sound_stream->Init())
+  if (!sound_stream || !sound_stream->Init())
   {
     WARN_LOG_FMT(AUDIO, "Could not initialize backend {}, using {} instead.", backend,
                  BACKEND_NULLSOUND);
-    g_sound_stream = std::make_unique<NullSound>();
-    g_sound_stream->Init();
+    sound_stream = std::make_unique<NullSound>();
+    sound_stream->Init();
   }
+
+  Core::System::GetInstance().SetSoundStream(std::move(sound_stream));
 }
 
 void PostInitSoundStream()
@@ -72,7 +70,7 @@ void PostInitSoundStream()
   UpdateSoundStream();
   SetSoundStreamRunning(true);
 
-  if (SConfig::GetInstance().m_DumpAudio && !s_audio_dump_start)
+  if (SConfig::GetInstance().m_DumpAudio && !Core::System::GetInstance().IsAudioDumpStarted())
     StartAudioDump();
 }
 
@@ -80,11 +78,11 @@ void ShutdownSoundStream()
 {
   INFO_LOG_FMT(AUDIO, "Shutting down sound stream");
 
-  if (SConfig::GetInstance().m_DumpAudio && s_audio_dump_start)
+  if (SConfig::GetInstance().m_DumpAudio && Core::System::GetInstance().IsAudioDumpStarted())
     StopAudioDump();
 
   SetSoundStreamRunning(false);
-  g_sound_stream.reset();
+  Core::System::GetInstance().SetSoundStream(nullptr);
 
   INFO_LOG_FMT(AUDIO, "Done shutting down sound stream");
 }
@@ -143,7 +141,7 @@ bool SupportsDPL2Decoder(std::string_view backend)
 
 bool SupportsLatencyControl(std::string_view backend)
 {
-  return backend == BACKEND_OPENAL || backend == BACKEND_WASAPI;
+  return backend == BACKEND_CUBEB || backend == BACKEND_OPENAL || backend == BACKEND_WASAPI;
 }
 
 bool SupportsVolumeChanges(std::string_view backend)
@@ -156,23 +154,28 @@ bool SupportsVolumeChanges(std::string_view backend)
 
 void UpdateSoundStream()
 {
-  if (g_sound_stream)
+  SoundStream* sound_stream = Core::System::GetInstance().GetSoundStream();
+
+  if (sound_stream)
   {
     int volume = SConfig::GetInstance().m_IsMuted ? 0 : SConfig::GetInstance().m_Volume;
-    g_sound_stream->SetVolume(volume);
+    sound_stream->SetVolume(volume);
   }
 }
 
 void SetSoundStreamRunning(bool running)
 {
-  if (!g_sound_stream)
+  auto& system = Core::System::GetInstance();
+  SoundStream* sound_stream = system.GetSoundStream();
+
+  if (!sound_stream)
     return;
 
-  if (s_sound_stream_running == running)
+  if (system.IsSoundStreamRunning() == running)
     return;
-  s_sound_stream_running = running;
+  system.SetSoundStreamRunning(running);
 
-  if (g_sound_stream->SetRunning(running))
+  if (sound_stream->SetRunning(running))
     return;
   if (running)
     ERROR_LOG_FMT(AUDIO, "Error starting stream.");
@@ -182,22 +185,26 @@ void SetSoundStreamRunning(bool running)
 
 void SendAIBuffer(const short* samples, unsigned int num_samples)
 {
-  if (!g_sound_stream)
+  auto& system = Core::System::GetInstance();
+  SoundStream* sound_stream = system.GetSoundStream();
+
+  // The audio of frames emulated ahead of time is heard when they are emulated for real.
+  if (!sound_stream || RunAhead::IsRunningAhead())
     return;
 
-  if (SConfig::GetInstance().m_DumpAudio && !s_audio_dump_start)
+  if (SConfig::GetInstance().m_DumpAudio && !system.IsAudioDumpStarted())
     StartAudioDump();
-  else if (!SConfig::GetInstance().m_DumpAudio && s_audio_dump_start)
+  else if (!SConfig::GetInstance().m_DumpAudio && system.IsAudioDumpStarted())
     StopAudioDump();
 
-  Mixer* pMixer = g_sound_stream->GetMixer();
+  Mixer* pMixer = sound_stream->GetMixer();
 
   if (pMixer && samples)
   {
     pMixer->PushSamples(samples, num_samples);
   }
 
-  g_sound_stream->Update();
+  sound_stream->Update();
 }
 
 void StartAudioDump()
@@ -206,18 +213,24 @@ void StartAudioDump()
   std::string audio_file_name_dsp = File::GetUserPath(D_DUMPAUDIO_IDX) + "dspdump.wav";
   File::CreateFullPath(audio_file_name_dtk);
   File::CreateFullPath(audio_file_name_dsp);
-  g_sound_stream->GetMixer()->StartLogDTKAudio(audio_file_name_dtk);
-  g_sound_stream->GetMixer()->StartLogDSPAudio(audio_file_name_dsp);
-  s_audio_dump_start = true;
+
+  auto& system = Core::System::GetInstance();
+  SoundStream* sound_stream = system.GetSoundStream();
+  sound_stream->GetMixer()->StartLogDTKAudio(audio_file_name_dtk);
+  sound_stream->GetMixer()->StartLogDSPAudio(audio_file_name_dsp);
+  system.SetAudioDumpStarted(true);
 }
 
 void StopAudioDump()
 {
-  if (!g_sound_stream)
+  auto& system = Core::System::GetInstance();
+  SoundStream* sound_stream = system.GetSoundStream();
+
+  if (!sound_stream)
     return;
-  g_sound_stream->GetMixer()->StopLogDTKAudio();
-  g_sound_stream->GetMixer()->StopLogDSPAudio();
-  s_audio_dump_start = false;
+  sound_stream->GetMixer()->StopLogDTKAudio();
+  sound_stream->GetMixer()->StopLogDSPAudio();
+  system.SetAudioDumpStarted(false);
 }
 
 void IncreaseVolume(unsigned short offset)
@@ -1,6 +1,8 @@
 // Copyright 2017 Dolphin Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+
 #include <cubeb/cubeb.h>
 
 #include "AudioCommon/CubebStream.h"
@@ -12,6 +14,7 @@
 
 // ~10 ms - needs to be at least 240 for surround
 constexpr u32 BUFFER_SAMPLES = 512;
+constexpr u32 SURROUND_MIN_BUFFER_SAMPLES = 240;
 
 long CubebStream::DataCallback(cubeb_stream* stream, void* user_data, const void* /*input_buffer*/,
                                void* output_buffer, long num_frames)
@@ -58,17 +61,31 @@ bool CubebStream::Init()
     ERROR_LOG_FMT(AUDIO, "Error getting minimum latency");
   INFO_LOG_FMT(AUDIO, "Minimum latency: {} frames", minimum_latency);
 
+  // The latency setting can lower the buffer size down to what the device supports, with 0
+  // meaning as low as possible. Higher settings keep the default buffer size.
+  const u32 requested_latency = params.rate * std::max(SConfig::GetInstance().iLatency, 0) / 1000;
+  u32 latency = std::max(std::min(BUFFER_SAMPLES, requested_latency), minimum_latency);
+  if (!m_stereo)
+    latency = std::max(latency, SURROUND_MIN_BUFFER_SAMPLES);
+  INFO_LOG_FMT(AUDIO, "Requested latency: {} frames", latency);
+
   return cubeb_stream_init(m_ctx.get(), &m_stream, "Dolphin Audio Output", nullptr, nullptr,
-                           nullptr, &params, std::max(BUFFER_SAMPLES, minimum_latency),
-                           DataCallback, StateCallback, this) == CUBEB_OK;
+                           nullptr, &params, latency, DataCallback, StateCallback,
+                           this) == CUBEB_OK;
 }
 
 bool CubebStream::SetRunning(bool running)
 {
-  if (running)
-    return cubeb_stream_start(m_stream) == CUBEB_OK;
-  else
+  if (!running)
     return cubeb_stream_stop(m_stream) == CUBEB_OK;
+
+  if (cubeb_stream_start(m_stream) != CUBEB_OK)
+    return false;
+
+  u32 latency = 0;
+  if (cubeb_stream_get_latency(m_stream, &latency) == CUBEB_OK)
+    INFO_LOG_FMT(AUDIO, "Output latency: {} frames", latency);
+  return true;
 }
 
 CubebStream::~CubebStream()
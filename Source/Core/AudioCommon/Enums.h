@@ -12,4 +12,13 @@ enum class DPL2Quality
   High = 2,
   Highest = 3
 };
+
+enum class ResamplingQuality
+{
+  // Linear interpolation between two samples
+  Linear = 0,
+  // Windowed sinc interpolation over 8 or 16 samples
+  Medium = 1,
+  High = 2
+};
 }  // namespace AudioCommon
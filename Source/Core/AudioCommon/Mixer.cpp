@@ -11,6 +11,7 @@
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
+#include "Common/MathUtil.h"
 #include "Common/Swap.h"
 #include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
@@ -30,11 +31,26 @@ static u32 DPL2QualityToFrameBlockSize(AudioCommon::DPL2Quality quality)
   }
 }
 
+static u32 ResamplingQualityToSincTaps(AudioCommon::ResamplingQuality quality)
+{
+  switch (quality)
+  {
+  case AudioCommon::ResamplingQuality::Medium:
+    return 8;
+  case AudioCommon::ResamplingQuality::High:
+    return 16;
+  default:
+    return 0;
+  }
+}
+
 Mixer::Mixer(unsigned int BackendSampleRate)
     : m_sampleRate(BackendSampleRate), m_stretcher(BackendSampleRate),
       m_surround_decoder(BackendSampleRate,
                          DPL2QualityToFrameBlockSize(Config::Get(Config::MAIN_DPL2_QUALITY)))
 {
+  BuildSincTable(ResamplingQualityToSincTaps(Config::Get(Config::MAIN_AUDIO_RESAMPLING_QUALITY)));
+
   INFO_LOG_FMT(AUDIO_INTERFACE, "Mixer is initialized");
 }
 
@@ -42,6 +58,44 @@ Mixer::~Mixer()
 {
 }
 
+void Mixer::BuildSincTable(u32 taps)
+{
+  m_sinc_taps = taps;
+  m_sinc_table.resize(taps << SINC_PHASE_BITS);
+  if (taps == 0)
+    return;
+
+  // Leave some room below the Nyquist frequency of the input for the transition band.
+  constexpr double CUTOFF = 0.9;
+
+  std::vector<double> weights(taps);
+  for (u32 phase = 0; phase < (1u << SINC_PHASE_BITS); ++phase)
+  {
+    const double frac = static_cast<double>(phase) / (1 << SINC_PHASE_BITS);
+    double sum = 0.0;
+    for (u32 i = 0; i < taps; ++i)
+    {
+      // The interpolated position lies between the samples taps / 2 - 1 and taps / 2.
+      const double x = static_cast<double>(i) - (taps / 2 - 1) - frac;
+      const double sinc =
+          x == 0.0 ? 1.0 : std::sin(MathUtil::PI * CUTOFF * x) / (MathUtil::PI * CUTOFF * x);
+
+      // Blackman window
+      const double t = (x + taps / 2.0) / taps;
+      const double window =
+          0.42 - 0.5 * std::cos(MathUtil::TAU * t) + 0.08 * std::cos(2 * MathUtil::TAU * t);
+
+      weights[i] = sinc * window;
+      sum += weights[i];
+    }
+
+    // Normalize every filter so that a constant signal keeps its level.
+    s16* coefs = &m_sinc_table[phase * taps];
+    for (u32 i = 0; i < taps; ++i)
+      coefs[i] = static_cast<s16>(std::lround(weights[i] / sum * (1 << SINC_COEF_SHIFT)));
+  }
+}
+
 void Mixer::DoState(PointerWrap& p)
 {
   m_dma_mixer.DoState(p);
@@ -93,21 +147,46 @@ unsigned int Mixer::MixerFifo::Mix(short* samples, unsigned int numSamples,
   s32 lvolume = m_LVolume.load();
   s32 rvolume = m_RVolume.load();
 
-  // TODO: consider a higher-quality resampling algorithm.
-  for (; currentSample < numSamples * 2 && ((indexW - indexR) & INDEX_MASK) > 2; currentSample += 2)
+  // The sinc filters don't look at samples before indexR, as those may already be overwritten.
+  // Instead, they interpolate around the middle of the samples they use.
+  const u32 taps = m_mixer->m_sinc_taps;
+  const u32 min_available = taps == 0 ? 2 : taps * 2 - 1;
+
+  for (; currentSample < numSamples * 2 && ((indexW - indexR) & INDEX_MASK) > min_available;
+       currentSample += 2)
   {
-    u32 indexR2 = indexR + 2;  // next sample
+    int sampleL;
+    int sampleR;
+    if (taps == 0)
+    {
+      u32 indexR2 = indexR + 2;  // next sample
+
+      s16 l1 = Common::swap16(m_buffer[indexR & INDEX_MASK]);   // current
+      s16 l2 = Common::swap16(m_buffer[indexR2 & INDEX_MASK]);  // next
+      sampleL = ((l1 << 16) + (l2 - l1) * (u16)m_frac) >> 16;
+
+      s16 r1 = Common::swap16(m_buffer[(indexR + 1) & INDEX_MASK]);   // current
+      s16 r2 = Common::swap16(m_buffer[(indexR2 + 1) & INDEX_MASK]);  // next
+      sampleR = ((r1 << 16) + (r2 - r1) * (u16)m_frac) >> 16;
+    }
+    else
+    {
+      const s16* coefs = &m_mixer->m_sinc_table[(m_frac >> (16 - SINC_PHASE_BITS)) * taps];
+      sampleL = 0;
+      sampleR = 0;
+      for (u32 i = 0; i < taps; ++i)
+      {
+        sampleL += Common::swap16(m_buffer[(indexR + i * 2) & INDEX_MASK]) * coefs[i];
+        sampleR += Common::swap16(m_buffer[(indexR + i * 2 + 1) & INDEX_MASK]) * coefs[i];
+      }
+      sampleL >>= SINC_COEF_SHIFT;
+      sampleR >>= SINC_COEF_SHIFT;
+    }
 
-    s16 l1 = Common::swap16(m_buffer[indexR & INDEX_MASK]);   // current
-    s16 l2 = Common::swap16(m_buffer[indexR2 & INDEX_MASK]);  // next
-    int sampleL = ((l1 << 16) + (l2 - l1) * (u16)m_frac) >> 16;
     sampleL = (sampleL * lvolume) >> 8;
     sampleL += samples[currentSample + 1];
     samples[currentSample + 1] = std::clamp(sampleL, -32767, 32767);
 
-    s16 r1 = Common::swap16(m_buffer[(indexR + 1) & INDEX_MASK]);   // current
-    s16 r2 = Common::swap16(m_buffer[(indexR2 + 1) & INDEX_MASK]);  // next
-    int sampleR = ((r1 << 16) + (r2 - r1) * (u16)m_frac) >> 16;
     sampleR = (sampleR * rvolume) >> 8;
     sampleR += samples[currentSample];
     samples[currentSample] = std::clamp(sampleR, -32767, 32767);
@@ -386,7 +465,11 @@ void Mixer::MixerFifo::SetVolume(unsigned int lvolume, unsigned int rvolume)
 unsigned int Mixer::MixerFifo::AvailableSamples() const
 {
   unsigned int samples_in_fifo = ((m_indexW.load() - m_indexR.load()) & INDEX_MASK) / 2;
-  if (samples_in_fifo <= 1)
-    return 0;  // Mixer::MixerFifo::Mix always keeps one sample in the buffer.
-  return (samples_in_fifo - 1) * m_mixer->m_sampleRate / m_input_sample_rate;
+  // Mixer::MixerFifo::Mix always keeps one sample in the buffer, or all but one of the samples
+  // the sinc filter uses.
+  const u32 taps = m_mixer->m_sinc_taps;
+  const unsigned int kept_samples = taps == 0 ? 1 : taps - 1;
+  if (samples_in_fifo <= kept_samples)
+    return 0;
+  return (samples_in_fifo - kept_samples) * m_mixer->m_sampleRate / m_input_sample_rate;
 }
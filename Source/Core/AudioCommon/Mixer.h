@@ -5,6 +5,7 @@
 
 #include <array>
 #include <atomic>
+#include <vector>
 
 #include "AudioCommon/AudioStretcher.h"
 #include "AudioCommon/SurroundDecoder.h"
@@ -52,8 +53,14 @@ private:
   static constexpr float CONTROL_FACTOR = 0.2f;
   static constexpr u32 CONTROL_AVG = 32;  // In freq_shift per FIFO size offset
 
+  // The sinc filters are precomputed for this many fractional positions between two samples.
+  static constexpr u32 SINC_PHASE_BITS = 10;
+  static constexpr int SINC_COEF_SHIFT = 14;
+
   const unsigned int SURROUND_CHANNELS = 6;
 
+  void BuildSincTable(u32 taps);
+
   class MixerFifo final
   {
   public:
@@ -86,6 +93,10 @@ private:
   MixerFifo m_wiimote_speaker_mixer{this, 3000};
   unsigned int m_sampleRate;
 
+  // Number of input samples the resampling filter uses, or 0 for linear interpolation.
+  u32 m_sinc_taps = 0;
+  std::vector<s16> m_sinc_table;
+
   bool m_is_stretching = false;
   AudioCommon::AudioStretcher m_stretcher;
   AudioCommon::SurroundDecoder m_surround_decoder;
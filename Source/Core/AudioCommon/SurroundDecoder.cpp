@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <FreeSurround/FreeSurroundDecoder.h>
+#include <algorithm>
 #include <limits>
 
 #include "AudioCommon/SurroundDecoder.h"
@@ -16,6 +17,7 @@ SurroundDecoder::SurroundDecoder(u32 sample_rate, u32 frame_block_size)
 {
   m_fsdecoder = std::make_unique<DPL2FSDecoder>();
   m_fsdecoder->Init(cs_5point1, m_frame_block_size, m_sample_rate);
+  m_float_conversion_buffer.resize(m_frame_block_size * STEREO_CHANNELS);
 }
 
 SurroundDecoder::~SurroundDecoder() = default;
@@ -23,16 +25,16 @@ SurroundDecoder::~SurroundDecoder() = default;
 void SurroundDecoder::Clear()
 {
   m_fsdecoder->flush();
-  m_decoded_fifo.clear();
+  m_decoded_samples.clear();
 }
 
 // Currently only 6 channels are supported.
 size_t SurroundDecoder::QueryFramesNeededForSurroundOutput(const size_t output_frames) const
 {
-  if (m_decoded_fifo.size() < output_frames * SURROUND_CHANNELS)
+  if (m_decoded_samples.size() < output_frames * SURROUND_CHANNELS)
   {
     // Output stereo frames needed to have at least the desired number of surround frames
-    size_t frames_needed = output_frames - m_decoded_fifo.size() / SURROUND_CHANNELS;
+    size_t frames_needed = output_frames - m_decoded_samples.size() / SURROUND_CHANNELS;
     return frames_needed + m_frame_block_size - frames_needed % m_frame_block_size;
   }
 
@@ -49,11 +51,10 @@ void SurroundDecoder::PutFrames(const short* in, const size_t num_frames_in)
   while (remaining_frames > 0)
   {
     // Convert to float
+    constexpr float scale = 1.0f / std::numeric_limits<short>::max();
+    const short* block = in + frame_index * STEREO_CHANNELS;
     for (size_t i = 0, end = m_frame_block_size * STEREO_CHANNELS; i < end; ++i)
-    {
-      m_float_conversion_buffer[i] = in[i + frame_index * STEREO_CHANNELS] /
-                                     static_cast<float>(std::numeric_limits<short>::max());
-    }
+      m_float_conversion_buffer[i] = block[i] * scale;
 
     // Decode
     const float* dpl2_fs = m_fsdecoder->decode(m_float_conversion_buffer.data());
@@ -64,14 +65,18 @@ void SurroundDecoder::PutFrames(const short* in, const size_t num_frames_in)
     // FL | FC | FR | BL | BR | LFE
     // Most backends:
     // FL | FR | FC | LFE | BL | BR
+    const size_t old_size = m_decoded_samples.size();
+    m_decoded_samples.resize(old_size + m_frame_block_size * SURROUND_CHANNELS);
+    float* out = m_decoded_samples.data() + old_size;
     for (size_t i = 0; i < m_frame_block_size; ++i)
     {
-      m_decoded_fifo.push(dpl2_fs[i * SURROUND_CHANNELS + 0]);  // LEFTFRONT
-      m_decoded_fifo.push(dpl2_fs[i * SURROUND_CHANNELS + 2]);  // RIGHTFRONT
-      m_decoded_fifo.push(dpl2_fs[i * SURROUND_CHANNELS + 1]);  // CENTREFRONT
-      m_decoded_fifo.push(dpl2_fs[i * SURROUND_CHANNELS + 5]);  // sub/lfe
-      m_decoded_fifo.push(dpl2_fs[i * SURROUND_CHANNELS + 3]);  // LEFTREAR
-      m_decoded_fifo.push(dpl2_fs[i * SURROUND_CHANNELS + 4]);  // RIGHTREAR
+      const float* frame = dpl2_fs + i * SURROUND_CHANNELS;
+      out[i * SURROUND_CHANNELS + 0] = frame[0];  // LEFTFRONT
+      out[i * SURROUND_CHANNELS + 1] = frame[2];  // RIGHTFRONT
+      out[i * SURROUND_CHANNELS + 2] = frame[1];  // CENTREFRONT
+      out[i * SURROUND_CHANNELS + 3] = frame[5];  // sub/lfe
+      out[i * SURROUND_CHANNELS + 4] = frame[3];  // LEFTREAR
+      out[i * SURROUND_CHANNELS + 5] = frame[4];  // RIGHTREAR
     }
 
     remaining_frames = remaining_frames - static_cast<int>(m_frame_block_size);
@@ -82,11 +87,11 @@ void SurroundDecoder::PutFrames(const short* in, const size_t num_frames_in)
 void SurroundDecoder::ReceiveFrames(float* out, const size_t num_frames_out)
 {
   // Copy to output array with desired num_frames_out
-  for (size_t i = 0, num_samples_output = num_frames_out * SURROUND_CHANNELS;
-       i < num_samples_output; ++i)
-  {
-    out[i] = m_decoded_fifo.pop_front();
-  }
+  const size_t num_samples_output =
+      std::min(num_frames_out * SURROUND_CHANNELS, m_decoded_samples.size());
+  std::copy_n(m_decoded_samples.begin(), num_samples_output, out);
+  m_decoded_samples.erase(m_decoded_samples.begin(),
+                          m_decoded_samples.begin() + num_samples_output);
 }
 
 }  // namespace AudioCommon
@@ -3,11 +3,10 @@
 
 #pragma once
 
-#include <array>
 #include <memory>
+#include <vector>
 
 #include "Common/CommonTypes.h"
-#include "Common/FixedSizeQueue.h"
 
 class DPL2FSDecoder;
 
@@ -28,8 +27,10 @@ private:
   u32 m_frame_block_size;
 
   std::unique_ptr<DPL2FSDecoder> m_fsdecoder;
-  std::array<float, 32768> m_float_conversion_buffer;
-  FixedSizeQueue<float, 32768> m_decoded_fifo;
+  std::vector<float> m_float_conversion_buffer;
+  // Decoded interleaved samples in the output channel order, which are appended and consumed
+  // a whole block at a time. The capacity is kept, so this doesn't allocate once warmed up.
+  std::vector<float> m_decoded_samples;
 };
 
 }  // namespace AudioCommon
@@ -3,7 +3,10 @@
 
 #include "AudioCommon/WaveFile.h"
 
+#include <algorithm>
+#include <chrono>
 #include <string>
+#include <utility>
 
 #include "Common/CommonTypes.h"
 #include "Common/FileUtil.h"
@@ -12,6 +15,7 @@
 #include "Common/MsgHandler.h"
 #include "Common/StringUtil.h"
 #include "Common/Swap.h"
+#include "Common/Thread.h"
 #include "Core/ConfigManager.h"
 
 constexpr size_t WaveFileWriter::BUFFER_SIZE;
@@ -26,6 +30,34 @@ WaveFileWriter::~WaveFileWriter()
 }
 
 bool WaveFileWriter::Start(const std::string& filename, unsigned int HLESampleRate)
+{
+  if (m_writer_thread.joinable())
+  {
+    PanicAlertFmtT("The file {0} was already open, the file header will not be written.", filename);
+    return false;
+  }
+
+  if (!OpenFile(filename, HLESampleRate))
+    return false;
+
+  m_writer_stop.Clear();
+  m_writer_thread = std::thread(&WaveFileWriter::WriterThread, this);
+  return true;
+}
+
+void WaveFileWriter::Stop()
+{
+  if (m_writer_thread.joinable())
+  {
+    m_writer_stop.Set();
+    m_writer_wakeup.Set();
+    m_writer_thread.join();
+  }
+
+  CloseFile();
+}
+
+bool WaveFileWriter::OpenFile(const std::string& filename, unsigned int HLESampleRate)
 {
   // Ask to delete file
   if (File::Exists(filename))
@@ -92,7 +124,7 @@ bool WaveFileWriter::Start(const std::string& filename, unsigned int HLESampleRa
   return true;
 }
 
-void WaveFileWriter::Stop()
+void WaveFileWriter::CloseFile()
 {
   // u32 file_size = (u32)ftello(file);
   file.Seek(4, SEEK_SET);
@@ -114,13 +146,35 @@ void WaveFileWriter::Write4(const char* ptr)
   file.WriteBytes(ptr, 4);
 }
 
+void WaveFileWriter::WriterThread()
+{
+  Common::SetCurrentThreadName("Audio dump");
+  Common::SetCurrentThreadRole(Common::ThreadRole::Background);
+
+  // The producer doesn't signal new chunks so that pushing them stays lock-free. Dumps don't
+  // need low latency, so polling a few times per frame is plenty.
+  while (true)
+  {
+    const bool stopping = m_writer_stop.IsSet();
+
+    SampleChunk chunk;
+    while (m_chunks.Pop(chunk))
+      WriteChunk(chunk);
+
+    if (stopping)
+      break;
+
+    m_writer_wakeup.WaitFor(std::chrono::milliseconds(10));
+  }
+}
+
 void WaveFileWriter::AddStereoSamplesBE(const short* sample_data, u32 count, int sample_rate)
 {
-  if (!file)
+  if (!m_writer_thread.joinable())
+  {
     ERROR_LOG_FMT(AUDIO, "WaveFileWriter - file not open.");
-
-  if (count > BUFFER_SIZE * 2)
-    ERROR_LOG_FMT(AUDIO, "WaveFileWriter - buffer too small (count = {}).", count);
+    return;
+  }
 
   if (skip_silence)
   {
@@ -136,23 +190,37 @@ void WaveFileWriter::AddStereoSamplesBE(const short* sample_data, u32 count, int
       return;
   }
 
-  for (u32 i = 0; i < count; i++)
-  {
-    // Flip the audio channels from RL to LR
-    conv_buffer[2 * i] = Common::swap16((u16)sample_data[2 * i + 1]);
-    conv_buffer[2 * i + 1] = Common::swap16((u16)sample_data[2 * i]);
-  }
+  m_chunks.Push(SampleChunk{std::vector<short>(sample_data, sample_data + count * 2), sample_rate});
+}
 
-  if (sample_rate != current_sample_rate)
+void WaveFileWriter::WriteChunk(const SampleChunk& chunk)
+{
+  if (chunk.sample_rate != current_sample_rate)
   {
-    Stop();
+    CloseFile();
     file_index++;
     std::ostringstream filename;
     filename << File::GetUserPath(D_DUMPAUDIO_IDX) << basename << file_index << ".wav";
-    Start(filename.str(), sample_rate);
-    current_sample_rate = sample_rate;
+    OpenFile(filename.str(), chunk.sample_rate);
+    current_sample_rate = chunk.sample_rate;
   }
 
-  file.WriteBytes(conv_buffer.data(), count * 4);
-  audio_size += count * 4;
+  if (!file)
+    return;
+
+  const short* sample_data = chunk.samples.data();
+  const u32 total_count = static_cast<u32>(chunk.samples.size() / 2);
+  for (u32 offset = 0; offset < total_count; offset += BUFFER_SIZE / 2)
+  {
+    const u32 count = std::min<u32>(total_count - offset, BUFFER_SIZE / 2);
+    for (u32 i = 0; i < count; i++)
+    {
+      // Flip the audio channels from RL to LR
+      conv_buffer[2 * i] = Common::swap16((u16)sample_data[2 * (offset + i) + 1]);
+      conv_buffer[2 * i + 1] = Common::swap16((u16)sample_data[2 * (offset + i)]);
+    }
+
+    file.WriteBytes(conv_buffer.data(), count * 4);
+    audio_size += count * 4;
+  }
 }
@@ -9,15 +9,22 @@
 // The float variant will convert from -1.0-1.0 range and clamp.
 // Alternatively, AddSamplesBE for big endian wave data.
 // If Stop is not called when it destructs, the destructor will call Stop().
+// The samples are converted and written to disk by a separate thread, so that
+// dumping never blocks the thread which produces the audio.
 // ---------------------------------------------------------------------------------
 
 #pragma once
 
 #include <array>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Common/Event.h"
+#include "Common/Flag.h"
 #include "Common/IOFile.h"
+#include "Common/SPSCQueue.h"
 
 class WaveFileWriter
 {
@@ -40,6 +47,18 @@ public:
 private:
   static constexpr size_t BUFFER_SIZE = 32 * 1024;
 
+  struct SampleChunk
+  {
+    std::vector<short> samples;
+    int sample_rate;
+  };
+
+  bool OpenFile(const std::string& filename, unsigned int HLESampleRate);
+  void CloseFile();
+  void WriterThread();
+  void WriteChunk(const SampleChunk& chunk);
+
+  // Only accessed by the writer thread while it is running.
   File::IOFile file;
   bool skip_silence = false;
   u32 audio_size = 0;
@@ -49,4 +68,9 @@ private:
   std::string basename;
   int current_sample_rate;
   int file_index = 0;
+
+  Common::SPSCQueue<SampleChunk, false> m_chunks;
+  std::thread m_writer_thread;
+  Common::Event m_writer_wakeup;
+  Common::Flag m_writer_stop;
 };
@@ -44,10 +44,14 @@ public:
   };
 
   u8** ptr;
+  // If set, writing stops at this address and the mode changes to MODE_MEASURE instead,
+  // so that the required size can still be determined.
+  u8* end = nullptr;
   Mode mode;
 
 public:
   PointerWrap(u8** ptr_, Mode mode_) : ptr(ptr_), mode(mode_) {}
+  PointerWrap(u8** ptr_, Mode mode_, u8* end_) : ptr(ptr_), end(end_), mode(mode_) {}
   void SetMode(Mode mode_) { mode = mode_; }
   Mode GetMode() const { return mode; }
   template <typename K, class V>
@@ -199,6 +203,8 @@ public:
   [[nodiscard]] u8* DoExternal(u32& count)
   {
     Do(count);
+    if (mode == MODE_WRITE && !HasRoomFor(count))
+      mode = MODE_MEASURE;
     u8* current = *ptr;
     *ptr += count;
     return current;
@@ -317,6 +323,11 @@ private:
       break;
 
     case MODE_WRITE:
+      if (!HasRoomFor(size))
+      {
+        mode = MODE_MEASURE;
+        break;
+      }
       memcpy(*ptr, data, size);
       break;
 
@@ -332,4 +343,9 @@ private:
 
     *ptr += size;
   }
+
+  bool HasRoomFor(size_t size) const
+  {
+    return !end || size <= static_cast<size_t>(end - *ptr);
+  }
 };
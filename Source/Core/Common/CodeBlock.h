@@ -81,6 +81,12 @@ public:
     }
   }
 
+  // Asks for the code space to be backed by huge pages, which reduces TLB misses when running
+  // code spread over a large part of it.
+  bool AdviseHugePages() { return Common::AdviseHugePages(region, total_region_size); }
+  size_t GetHugePageBytes() const { return Common::GetHugePageBytes(region, total_region_size); }
+  size_t GetResidentBytes() const { return Common::GetResidentBytes(region, total_region_size); }
+
   bool IsInSpace(const u8* ptr) const { return ptr >= region && ptr < (region + region_size); }
   // Cannot currently be undone. Will write protect the entire code region.
   // Start over if you need to change the code (call FreeCodeSpace(), AllocCodeSpace()).
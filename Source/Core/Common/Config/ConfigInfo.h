@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <mutex>
 #include <shared_mutex>
 #include <string>
@@ -19,6 +20,15 @@ namespace detail
 // std::underlying_type may only be used with enum types, so make sure T is an enum type first.
 template <typename T>
 using UnderlyingType = typename std::enable_if_t<std::is_enum<T>{}, std::underlying_type<T>>::type;
+
+template <typename T>
+constexpr bool IsLockFreeCacheable()
+{
+  if constexpr (std::is_trivially_copyable_v<T> && sizeof(T) <= sizeof(u64))
+    return std::atomic<T>::is_always_lock_free;
+  else
+    return false;
+}
 }  // namespace detail
 
 struct Location
@@ -44,7 +54,8 @@ class Info
 {
 public:
   constexpr Info(const Location& location, const T& default_value)
-      : m_location{location}, m_default_value{default_value}, m_cached_value{default_value, 0}
+      : m_location{location}, m_default_value{default_value},
+        m_cached_value{MakeCachedValue(default_value)}
   {
   }
 
@@ -66,7 +77,7 @@ public:
   {
     m_location = other.GetLocation();
     m_default_value = other.GetDefaultValue();
-    m_cached_value = other.GetCachedValue();
+    StoreCachedValue(other.GetCachedValue());
     return *this;
   }
 
@@ -75,7 +86,7 @@ public:
   {
     m_location = std::move(other.m_location);
     m_default_value = std::move(other.m_default_value);
-    m_cached_value = std::move(other.m_cached_value);
+    StoreCachedValue(other.GetCachedValue());
     return *this;
   }
 
@@ -87,7 +98,7 @@ public:
   {
     m_location = other.GetLocation();
     m_default_value = static_cast<T>(other.GetDefaultValue());
-    m_cached_value = other.template GetCachedValueCasted<T>();
+    StoreCachedValue(other.template GetCachedValueCasted<T>());
     return *this;
   }
 
@@ -96,29 +107,73 @@ public:
 
   CachedValue<T> GetCachedValue() const
   {
-    std::shared_lock lock(m_cached_value_mutex);
-    return m_cached_value;
+    if constexpr (LOCK_FREE_CACHE)
+    {
+      // The version is stored after the value, so the value is at least as new as the version.
+      const u64 config_version = m_cached_version.load(std::memory_order_acquire);
+      return {m_cached_value.load(std::memory_order_relaxed), config_version};
+    }
+    else
+    {
+      std::shared_lock lock(m_cached_value_mutex);
+      return m_cached_value;
+    }
   }
 
   template <typename U>
   CachedValue<U> GetCachedValueCasted() const
   {
-    std::shared_lock lock(m_cached_value_mutex);
-    return CachedValue<U>{static_cast<U>(m_cached_value.value), m_cached_value.config_version};
+    const CachedValue<T> cached_value = GetCachedValue();
+    return CachedValue<U>{static_cast<U>(cached_value.value), cached_value.config_version};
   }
 
   void SetCachedValue(const CachedValue<T>& cached_value) const
   {
     std::unique_lock lock(m_cached_value_mutex);
-    if (m_cached_value.config_version < cached_value.config_version)
-      m_cached_value = cached_value;
+    if constexpr (LOCK_FREE_CACHE)
+    {
+      if (m_cached_version.load(std::memory_order_relaxed) < cached_value.config_version)
+        StoreCachedValue(cached_value);
+    }
+    else
+    {
+      if (m_cached_value.config_version < cached_value.config_version)
+        m_cached_value = cached_value;
+    }
   }
 
 private:
+  // Config::Get reads the cached value on every call, often from several threads at once.
+  // Values that fit in a lock-free atomic are read without taking the mutex.
+  static constexpr bool LOCK_FREE_CACHE = detail::IsLockFreeCacheable<T>();
+
+  static constexpr auto MakeCachedValue(const T& value)
+  {
+    if constexpr (LOCK_FREE_CACHE)
+      return std::atomic<T>{value};
+    else
+      return CachedValue<T>{value, 0};
+  }
+
+  void StoreCachedValue(const CachedValue<T>& cached_value) const
+  {
+    if constexpr (LOCK_FREE_CACHE)
+    {
+      m_cached_value.store(cached_value.value, std::memory_order_relaxed);
+      m_cached_version.store(cached_value.config_version, std::memory_order_release);
+    }
+    else
+    {
+      m_cached_value = cached_value;
+    }
+  }
+
   Location m_location;
   T m_default_value;
 
-  mutable CachedValue<T> m_cached_value;
+  mutable std::conditional_t<LOCK_FREE_CACHE, std::atomic<T>, CachedValue<T>> m_cached_value;
+  // Only used if LOCK_FREE_CACHE is true. Otherwise, the version is part of m_cached_value.
+  mutable std::atomic<u64> m_cached_version{0};
   mutable std::shared_mutex m_cached_value_mutex;
 };
 }  // namespace Config
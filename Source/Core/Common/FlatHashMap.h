@@ -0,0 +1,229 @@
+// Copyright 2021 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <utility>
+
+#include "Common/CommonTypes.h"
+
+namespace Common
+{
+// An open-addressed hash map with linear probing, meant for hot lookup tables where the
+// node-based STL containers cause too many cache misses and allocations.
+//
+// Erasing uses backward-shift deletion, so there are no tombstones and lookups never have to
+// probe past removed entries. The table only allocates when it grows.
+//
+// Keys and values must be default-constructible and movable. Pointers and references to values
+// are invalidated by any insertion.
+template <typename K, typename V, typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>>
+class FlatHashMap
+{
+public:
+  FlatHashMap() = default;
+  explicit FlatHashMap(size_t capacity) { Reserve(capacity); }
+
+  FlatHashMap(FlatHashMap&&) = default;
+  FlatHashMap& operator=(FlatHashMap&&) = default;
+
+  size_t Size() const { return m_size; }
+  bool Empty() const { return m_size == 0; }
+  size_t Capacity() const { return m_capacity; }
+
+  V* Find(const K& key)
+  {
+    const size_t index = FindIndex(key);
+    return index == NOT_FOUND ? nullptr : &m_slots[index].value;
+  }
+
+  const V* Find(const K& key) const
+  {
+    const size_t index = FindIndex(key);
+    return index == NOT_FOUND ? nullptr : &m_slots[index].value;
+  }
+
+  bool Contains(const K& key) const { return FindIndex(key) != NOT_FOUND; }
+
+  // Returns a reference to the value for the key, inserting a default-constructed value if the
+  // key is not present.
+  V& operator[](const K& key) { return *TryEmplace(key).first; }
+
+  // Inserts the value if the key is not present. Returns a pointer to the value in the table and
+  // whether an insertion took place.
+  template <typename... Args>
+  std::pair<V*, bool> TryEmplace(const K& key, Args&&... args)
+  {
+    if ((m_size + 1) * MAX_LOAD_DENOMINATOR > m_capacity * MAX_LOAD_NUMERATOR)
+      Grow();
+
+    size_t index = HashIndex(key);
+    while (m_used[index])
+    {
+      if (m_equal(m_slots[index].key, key))
+        return {&m_slots[index].value, false};
+      index = (index + 1) & m_mask;
+    }
+
+    m_used[index] = true;
+    m_slots[index].key = key;
+    m_slots[index].value = V(std::forward<Args>(args)...);
+    m_size++;
+    return {&m_slots[index].value, true};
+  }
+
+  // Inserts the value, overwriting any existing value for the key.
+  template <typename T>
+  V& InsertOrAssign(const K& key, T&& value)
+  {
+    auto [slot, inserted] = TryEmplace(key);
+    *slot = std::forward<T>(value);
+    return *slot;
+  }
+
+  bool Erase(const K& key)
+  {
+    const size_t index = FindIndex(key);
+    if (index == NOT_FOUND)
+      return false;
+    EraseIndex(index);
+    return true;
+  }
+
+  void Clear()
+  {
+    for (size_t i = 0; i < m_capacity; i++)
+    {
+      if (m_used[i])
+      {
+        m_used[i] = false;
+        m_slots[i] = {};
+      }
+    }
+    m_size = 0;
+  }
+
+  void Reserve(size_t count)
+  {
+    size_t capacity = m_capacity ? m_capacity : MIN_CAPACITY;
+    while (count * MAX_LOAD_DENOMINATOR > capacity * MAX_LOAD_NUMERATOR)
+      capacity *= 2;
+    if (capacity != m_capacity)
+      Rehash(capacity);
+  }
+
+  // Calls f(const K&, V&) for every entry. The map must not be modified from within f.
+  template <typename F>
+  void ForEach(F f)
+  {
+    for (size_t i = 0; i < m_capacity; i++)
+    {
+      if (m_used[i])
+        f(std::as_const(m_slots[i].key), m_slots[i].value);
+    }
+  }
+
+  template <typename F>
+  void ForEach(F f) const
+  {
+    for (size_t i = 0; i < m_capacity; i++)
+    {
+      if (m_used[i])
+        f(m_slots[i].key, m_slots[i].value);
+    }
+  }
+
+private:
+  struct Slot
+  {
+    K key{};
+    V value{};
+  };
+
+  static constexpr size_t NOT_FOUND = ~size_t(0);
+  static constexpr size_t MIN_CAPACITY = 16;
+  static constexpr size_t MAX_LOAD_NUMERATOR = 3;
+  static constexpr size_t MAX_LOAD_DENOMINATOR = 4;
+
+  size_t HashIndex(const K& key) const
+  {
+    // std::hash is the identity for integers on most standard libraries, which clusters badly
+    // under linear probing for aligned addresses. Mix the bits with a Fibonacci multiplier.
+    const u64 hash = static_cast<u64>(m_hash(key)) * 0x9E3779B97F4A7C15ULL;
+    return static_cast<size_t>(hash >> 32) & m_mask;
+  }
+
+  size_t FindIndex(const K& key) const
+  {
+    if (m_size == 0)
+      return NOT_FOUND;
+
+    size_t index = HashIndex(key);
+    while (m_used[index])
+    {
+      if (m_equal(m_slots[index].key, key))
+        return index;
+      index = (index + 1) & m_mask;
+    }
+    return NOT_FOUND;
+  }
+
+  void EraseIndex(size_t hole)
+  {
+    // Shift back later entries of the probe sequence so that no lookup stops early at the hole.
+    size_t index = (hole + 1) & m_mask;
+    while (m_used[index])
+    {
+      const size_t home = HashIndex(m_slots[index].key);
+      // Move the entry if its home position is not in the cyclic range (hole, index].
+      if (((index - home) & m_mask) >= ((index - hole) & m_mask))
+      {
+        m_slots[hole] = std::move(m_slots[index]);
+        hole = index;
+      }
+      index = (index + 1) & m_mask;
+    }
+
+    m_used[hole] = false;
+    m_slots[hole] = {};
+    m_size--;
+  }
+
+  void Grow() { Rehash(m_capacity ? m_capacity * 2 : MIN_CAPACITY); }
+
+  void Rehash(size_t capacity)
+  {
+    std::unique_ptr<Slot[]> old_slots = std::move(m_slots);
+    std::unique_ptr<bool[]> old_used = std::move(m_used);
+    const size_t old_capacity = m_capacity;
+
+    m_slots = std::make_unique<Slot[]>(capacity);
+    m_used = std::make_unique<bool[]>(capacity);
+    m_capacity = capacity;
+    m_mask = capacity - 1;
+
+    for (size_t i = 0; i < old_capacity; i++)
+    {
+      if (!old_used[i])
+        continue;
+
+      size_t index = HashIndex(old_slots[i].key);
+      while (m_used[index])
+        index = (index + 1) & m_mask;
+      m_used[index] = true;
+      m_slots[index] = std::move(old_slots[i]);
+    }
+  }
+
+  std::unique_ptr<Slot[]> m_slots;
+  std::unique_ptr<bool[]> m_used;
+  size_t m_capacity = 0;
+  size_t m_mask = 0;
+  size_t m_size = 0;
+  Hash m_hash;
+  KeyEqual m_equal;
+};
+}  // namespace Common
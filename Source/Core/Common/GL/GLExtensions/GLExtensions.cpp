@@ -891,6 +891,11 @@ PFNDOLGETSYNCIVPROC dolGetSynciv;
 PFNDOLISSYNCPROC dolIsSync;
 PFNDOLWAITSYNCPROC dolWaitSync;
 
+// ARB_timer_query
+PFNDOLQUERYCOUNTERPROC dolQueryCounter;
+PFNDOLGETQUERYOBJECTI64VPROC dolGetQueryObjecti64v;
+PFNDOLGETQUERYOBJECTUI64VPROC dolGetQueryObjectui64v;
+
 // ARB_texture_multisample
 PFNDOLTEXIMAGE2DMULTISAMPLEPROC dolTexImage2DMultisample;
 PFNDOLTEXIMAGE3DMULTISAMPLEPROC dolTexImage3DMultisample;
@@ -1950,6 +1955,16 @@ const GLFunc gl_function_array[] = {
     GLFUNC_REQUIRES(glIsSync, "GL_ARB_sync |VERSION_GLES_3"),
     GLFUNC_REQUIRES(glWaitSync, "GL_ARB_sync |VERSION_GLES_3"),
 
+    // ARB_timer_query
+    GLFUNC_REQUIRES(glQueryCounter, "GL_ARB_timer_query"),
+    GLFUNC_REQUIRES(glGetQueryObjecti64v, "GL_ARB_timer_query"),
+    GLFUNC_REQUIRES(glGetQueryObjectui64v, "GL_ARB_timer_query"),
+
+    // EXT_disjoint_timer_query
+    GLFUNC_SUFFIX(glQueryCounter, EXT, "GL_EXT_disjoint_timer_query !GL_ARB_timer_query"),
+    GLFUNC_SUFFIX(glGetQueryObjecti64v, EXT, "GL_EXT_disjoint_timer_query !GL_ARB_timer_query"),
+    GLFUNC_SUFFIX(glGetQueryObjectui64v, EXT, "GL_EXT_disjoint_timer_query !GL_ARB_timer_query"),
+
     // ARB_texture_multisample
     GLFUNC_REQUIRES(glTexImage2DMultisample, "GL_ARB_texture_multisample"),
     GLFUNC_REQUIRES(glTexImage3DMultisample, "GL_ARB_texture_multisample"),
@@ -18,6 +18,18 @@
 #endif
 #endif
 
+// Pull in the XXH3 internals so that an AVX2 variant can be selected at runtime. Without this,
+// xxHash only uses the instruction sets enabled at compile time, which is SSE2 for generic builds.
+#if defined(_M_X86_64)
+#define XXH_DISPATCH_AVX2 1
+#define XXH_ACC_ALIGN 32
+#if defined(__GNUC__) || defined(__clang__)
+#define XXH_TARGET_AVX2 __attribute__((__target__("avx2")))
+#endif
+#endif
+#define XXH_INLINE_ALL
+#include <xxhash.h>
+
 namespace Common
 {
 static u64 (*ptrHashFunction)(const u8* src, u32 len, u32 samples) = nullptr;
@@ -504,14 +516,45 @@ static u64 GetMurmurHash3(const u8* src, u32 len, u32 samples)
 }
 #endif
 
+static u64 GetXXH3Hash(const u8* src, u32 len, u32 samples)
+{
+  return XXH3_64bits(src, len);
+}
+
+#if defined(_M_X86_64)
+FUNCTION_TARGET_AVX2
+static u64 GetXXH3HashAVX2(const u8* src, u32 len, u32 samples)
+{
+  // Short inputs never reach the vectorized loop, so this matches GetXXH3Hash bit for bit.
+  if (len <= XXH3_MIDSIZE_MAX)
+    return XXH3_64bits(src, len);
+
+  return XXH3_hashLong_64b_internal(src, len, XXH3_kSecret, sizeof(XXH3_kSecret),
+                                    XXH3_accumulate_avx2, XXH3_scrambleAcc_avx2);
+}
+#endif
+
 u64 GetHash64(const u8* src, u32 len, u32 samples)
 {
   return ptrHashFunction(src, len, samples);
 }
 
 // sets the hash function used for the texture cache
-void SetHash64Function()
+void SetHash64Function(Hash64Function function)
 {
+  if (function == Hash64Function::XXH3)
+  {
+#if defined(_M_X86_64)
+    if (cpu_info.bAVX2)
+    {
+      ptrHashFunction = &GetXXH3HashAVX2;
+      return;
+    }
+#endif
+    ptrHashFunction = &GetXXH3Hash;
+    return;
+  }
+
 #if defined(_M_X86_64) || defined(_M_X86)
   if (cpu_info.bSSE4_2)  // sse crc32 version
   {
@@ -12,6 +12,17 @@ namespace Common
 u32 HashFletcher(const u8* data_u8, size_t length);  // FAST. Length & 1 == 0.
 u32 HashAdler32(const u8* data, size_t len);         // Fairly accurate, slightly slower
 u32 HashEctor(const u8* ptr, size_t length);         // JUNK. DO NOT USE FOR NEW THINGS
+
+enum class Hash64Function
+{
+  // CRC32 if the CPU supports it, MurmurHash3 otherwise. Only hashes a subset of the input if a
+  // non-zero sample count is passed to GetHash64.
+  Default,
+  // XXH3, using AVX2 or NEON if available. Always hashes the full input and ignores the sample
+  // count, since it is still cheaper than sampled hashing for all but tiny inputs.
+  XXH3,
+};
+
 u64 GetHash64(const u8* src, u32 len, u32 samples);
-void SetHash64Function();
+void SetHash64Function(Hash64Function function = Hash64Function::Default);
 }  // namespace Common
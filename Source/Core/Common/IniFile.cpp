@@ -239,38 +239,28 @@ bool IniFile::Load(const std::string& filename, bool keep_current_data)
     sections.clear();
   // first section consists of the comments before the first real section
 
-  // Open file
-  std::ifstream in;
-  File::OpenFStream(in, filename, std::ios::in);
-
-  if (in.fail())
+  // Read the whole file at once and parse it in place, rather than copying every line out of a
+  // stream first.
+  std::string contents;
+  if (!File::ReadFileToString(filename, contents))
     return false;
 
-  Section* current_section = nullptr;
-  bool first_line = true;
-  while (!in.eof())
-  {
-    std::string line_str;
-    if (!std::getline(in, line_str))
-    {
-      if (in.eof())
-        return true;
-      else
-        return false;
-    }
+  std::string_view remaining = contents;
 
-    std::string_view line = line_str;
+  // Skips the UTF-8 BOM at the start of files. Notepad likes to add this.
+  if (remaining.substr(0, 3) == "\xEF\xBB\xBF")
+    remaining.remove_prefix(3);
 
-    // Skips the UTF-8 BOM at the start of files. Notepad likes to add this.
-    if (first_line && line.substr(0, 3) == "\xEF\xBB\xBF")
-      line.remove_prefix(3);
-    first_line = false;
+  Section* current_section = nullptr;
+  while (!remaining.empty())
+  {
+    const size_t line_end = remaining.find('\n');
+    std::string_view line = remaining.substr(0, line_end);
+    remaining.remove_prefix(line_end == std::string_view::npos ? remaining.size() : line_end + 1);
 
-#ifndef _WIN32
     // Check for CRLF eol and convert it to LF
     if (!line.empty() && line.back() == '\r')
       line.remove_suffix(1);
-#endif
 
     if (!line.empty())
     {
@@ -302,14 +292,13 @@ bool IniFile::Load(const std::string& filename, bool keep_current_data)
           }
           else
           {
-            current_section->Set(key, value);
+            current_section->Set(key, std::move(value));
           }
         }
       }
     }
   }
 
-  in.close();
   return true;
 }
 
@@ -42,13 +42,19 @@ public:
     SetEnable(true);
   }
 
-  void Log(LOG_LEVELS, const char* msg) override
+  void Log(LOG_LEVELS level, const char* msg) override
   {
     if (!IsEnabled() || !IsValid())
       return;
 
     std::lock_guard<std::mutex> lk(m_log_lock);
-    m_logfile << msg << std::flush;
+    m_logfile << msg;
+
+    // Flushing costs a write syscall per message, which makes verbose channels stall the thread
+    // logging them. Only flush right away for messages that may precede a crash; the rest are
+    // written once the buffer fills up or the file is closed.
+    if (level <= LWARNING)
+      m_logfile.flush();
   }
 
   bool IsValid() const { return m_logfile.good(); }
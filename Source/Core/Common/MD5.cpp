@@ -3,39 +3,153 @@
 
 #include "Common/MD5.h"
 
+#include <algorithm>
+#include <array>
 #include <fstream>
 #include <functional>
+#include <future>
 #include <mbedtls/md5.h>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include <fmt/format.h>
 
 #include "Common/StringUtil.h"
+#include "Common/WorkerPool.h"
 #include "DiscIO/Blob.h"
 
 namespace MD5
 {
+namespace
+{
+constexpr size_t CHUNK_SIZE = 8 * 1024 * 1024;
+constexpr u32 MAX_READERS = 4;
+
+// Reading (and for compressed formats, decompressing) a disc image is much slower than hashing
+// it, so the chunks are read by several workers, each with its own BlobReader, while the calling
+// thread feeds the finished chunks to the MD5 context in order.
+class ChunkPipeline
+{
+public:
+  ChunkPipeline(const std::string& file_path, std::unique_ptr<DiscIO::BlobReader> first_reader,
+                u64 game_size)
+      : m_game_size(game_size)
+  {
+    const u32 num_readers = std::clamp<u32>(std::thread::hardware_concurrency(), 1, MAX_READERS);
+
+    m_free_readers.push_back(std::move(first_reader));
+    while (m_free_readers.size() < num_readers)
+    {
+      std::unique_ptr<DiscIO::BlobReader> reader = DiscIO::CreateBlobReader(file_path);
+      if (!reader)
+        break;
+      m_free_readers.push_back(std::move(reader));
+    }
+
+    // Two buffers per reader keep every reader busy while the hasher works on older chunks.
+    const size_t num_buffers = m_free_readers.size() * 2;
+    m_buffers.resize(num_buffers, std::vector<u8>(CHUNK_SIZE));
+    m_results.resize(num_buffers);
+
+    if (m_free_readers.size() > 1)
+      m_pool.Start(static_cast<u32>(m_free_readers.size()), "MD5 Reader");
+  }
+
+  ~ChunkPipeline()
+  {
+    // Let the outstanding reads finish before their buffers go away.
+    m_pool.Stop();
+  }
+
+  u64 GetChunkCount() const { return (m_game_size + CHUNK_SIZE - 1) / CHUNK_SIZE; }
+
+  size_t GetChunkSize(u64 chunk) const
+  {
+    return static_cast<size_t>(std::min<u64>(CHUNK_SIZE, m_game_size - chunk * CHUNK_SIZE));
+  }
+
+  void QueueRead(u64 chunk)
+  {
+    const size_t slot = chunk % m_buffers.size();
+    auto result = std::make_shared<std::promise<bool>>();
+    m_results[slot] = result->get_future();
+
+    m_pool.Submit([this, chunk, slot, result] {
+      std::unique_ptr<DiscIO::BlobReader> reader = AcquireReader();
+      const bool success =
+          reader->Read(chunk * CHUNK_SIZE, GetChunkSize(chunk), m_buffers[slot].data());
+      ReleaseReader(std::move(reader));
+      result->set_value(success);
+    });
+  }
+
+  // Waits for the given chunk and returns its data, or nullptr if it couldn't be read.
+  const u8* WaitForChunk(u64 chunk)
+  {
+    const size_t slot = chunk % m_buffers.size();
+    return m_results[slot].get() ? m_buffers[slot].data() : nullptr;
+  }
+
+  size_t GetQueueDepth() const { return m_buffers.size(); }
+
+private:
+  std::unique_ptr<DiscIO::BlobReader> AcquireReader()
+  {
+    std::lock_guard lk(m_readers_mutex);
+    std::unique_ptr<DiscIO::BlobReader> reader = std::move(m_free_readers.back());
+    m_free_readers.pop_back();
+    return reader;
+  }
+
+  void ReleaseReader(std::unique_ptr<DiscIO::BlobReader> reader)
+  {
+    std::lock_guard lk(m_readers_mutex);
+    m_free_readers.push_back(std::move(reader));
+  }
+
+  u64 m_game_size;
+  std::vector<std::vector<u8>> m_buffers;
+  std::vector<std::future<bool>> m_results;
+  std::vector<std::unique_ptr<DiscIO::BlobReader>> m_free_readers;
+  std::mutex m_readers_mutex;
+  Common::WorkerPool m_pool;
+};
+}  // namespace
+
 std::string MD5Sum(const std::string& file_path, std::function<bool(int)> report_progress)
 {
   std::string output_string;
-  std::vector<u8> data(8 * 1024 * 1024);
-  u64 read_offset = 0;
   mbedtls_md5_context ctx;
 
   std::unique_ptr<DiscIO::BlobReader> file(DiscIO::CreateBlobReader(file_path));
-  u64 game_size = file->GetDataSize();
+  if (!file)
+    return output_string;
+  const u64 game_size = file->GetDataSize();
+
+  ChunkPipeline pipeline(file_path, std::move(file), game_size);
+  const u64 chunk_count = pipeline.GetChunkCount();
+
+  for (u64 chunk = 0; chunk < std::min<u64>(chunk_count, pipeline.GetQueueDepth()); ++chunk)
+    pipeline.QueueRead(chunk);
 
   mbedtls_md5_starts_ret(&ctx);
 
-  while (read_offset < game_size)
+  for (u64 chunk = 0; chunk < chunk_count; ++chunk)
   {
-    size_t read_size = std::min(static_cast<u64>(data.size()), game_size - read_offset);
-    if (!file->Read(read_offset, read_size, data.data()))
+    const u8* data = pipeline.WaitForChunk(chunk);
+    if (!data)
       return output_string;
 
-    mbedtls_md5_update_ret(&ctx, data.data(), read_size);
-    read_offset += read_size;
+    mbedtls_md5_update_ret(&ctx, data, pipeline.GetChunkSize(chunk));
+
+    // The buffer is free again, so start reading the chunk that will reuse it.
+    if (chunk + pipeline.GetQueueDepth() < chunk_count)
+      pipeline.QueueRead(chunk + pipeline.GetQueueDepth());
 
+    const u64 read_offset = std::min(game_size, (chunk + 1) * CHUNK_SIZE);
     int progress =
         static_cast<int>(static_cast<float>(read_offset) / static_cast<float>(game_size) * 100);
     if (!report_progress(progress))
@@ -0,0 +1,81 @@
+// Copyright 2021 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// a simple lockless thread-safe,
+// multiple producer, single consumer queue
+
+#include <atomic>
+#include <utility>
+
+namespace Common
+{
+// Producers never wait for each other or for the consumer: a push is an allocation, an atomic
+// exchange and a store. Elements pushed by one thread are popped in the order they were pushed.
+// A push which hasn't completed yet can hide the elements pushed after it from the consumer for
+// that short moment, which is fine for users that poll the queue.
+template <typename T>
+class MPSCQueue
+{
+public:
+  MPSCQueue()
+  {
+    Node* stub = new Node();
+    m_head.store(stub, std::memory_order_relaxed);
+    m_tail = stub;
+  }
+  ~MPSCQueue()
+  {
+    Clear();
+    delete m_tail;
+  }
+
+  MPSCQueue(const MPSCQueue&) = delete;
+  MPSCQueue& operator=(const MPSCQueue&) = delete;
+
+  // Can be called from any thread.
+  template <typename Arg>
+  void Push(Arg&& t)
+  {
+    Node* node = new Node();
+    node->value = std::forward<Arg>(t);
+    Node* prev = m_head.exchange(node, std::memory_order_acq_rel);
+    prev->next.store(node, std::memory_order_release);
+  }
+
+  // The following are only to be called from the consumer thread.
+  bool Empty() const { return !m_tail->next.load(std::memory_order_acquire); }
+
+  bool Pop(T& t)
+  {
+    Node* next = m_tail->next.load(std::memory_order_acquire);
+    if (!next)
+      return false;
+
+    t = std::move(next->value);
+    delete m_tail;
+    m_tail = next;
+    return true;
+  }
+
+  void Clear()
+  {
+    for (T t; Pop(t);)
+    {
+    }
+  }
+
+private:
+  struct Node
+  {
+    T value{};
+    std::atomic<Node*> next{nullptr};
+  };
+
+  // The most recently pushed node, shared by the producers.
+  std::atomic<Node*> m_head;
+  // A node whose value was already popped, followed by the nodes still in the queue.
+  Node* m_tail;
+};
+}  // namespace Common
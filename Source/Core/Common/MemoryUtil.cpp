@@ -2,8 +2,10 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <string>
+#include <vector>
 
 #include "Common/CommonFuncs.h"
 #include "Common/CommonTypes.h"
@@ -19,6 +21,7 @@
 #include <stdio.h>
 #include <sys/mman.h>
 #include <sys/types.h>
+#include <unistd.h>
 #if defined __APPLE__ || defined __FreeBSD__ || defined __OpenBSD__ || defined __NetBSD__
 #include <sys/sysctl.h>
 #elif defined __HAIKU__
@@ -177,6 +180,72 @@ void FreeMemoryPages(void* ptr, size_t size)
   }
 }
 
+bool AdviseHugePages(void* ptr, size_t size)
+{
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+  // Only whole huge pages inside the range can be backed by one, so this works best for ranges
+  // which are aligned to the huge page size. Shared memory only gets huge pages if the kernel
+  // allows it in /sys/kernel/mm/transparent_hugepage/shmem_enabled.
+  if (madvise(ptr, size, MADV_HUGEPAGE) == 0)
+    return true;
+
+  WARN_LOG_FMT(MEMMAP, "madvise(MADV_HUGEPAGE) failed: {}", LastStrerrorString());
+#endif
+  return false;
+}
+
+size_t GetHugePageBytes(const void* ptr, size_t size)
+{
+  size_t huge_bytes = 0;
+#ifdef __linux__
+  FILE* smaps = fopen("/proc/self/smaps", "r");
+  if (!smaps)
+    return 0;
+
+  // Sum up the huge pages of all mappings which overlap the range.
+  const uintptr_t range_start = reinterpret_cast<uintptr_t>(ptr);
+  const uintptr_t range_end = range_start + size;
+  bool in_range = false;
+  char line[256];
+  while (fgets(line, sizeof(line), smaps))
+  {
+    unsigned long start, end;
+    unsigned long kib;
+    if (sscanf(line, "%lx-%lx ", &start, &end) == 2)
+      in_range = start < range_end && end > range_start;
+    else if (in_range && (sscanf(line, "AnonHugePages: %lu kB", &kib) == 1 ||
+                          sscanf(line, "ShmemPmdMapped: %lu kB", &kib) == 1))
+      huge_bytes += static_cast<size_t>(kib) * 1024;
+  }
+  fclose(smaps);
+#endif
+  return huge_bytes;
+}
+
+size_t GetResidentBytes(const void* ptr, size_t size)
+{
+  size_t resident_bytes = 0;
+#if !defined(_WIN32) && !defined(__HAIKU__)
+  const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  const uintptr_t start = reinterpret_cast<uintptr_t>(ptr) & ~(page_size - 1);
+  const size_t length = reinterpret_cast<uintptr_t>(ptr) + size - start;
+#ifdef __APPLE__
+  std::vector<char> pages((length + page_size - 1) / page_size);
+#else
+  std::vector<unsigned char> pages((length + page_size - 1) / page_size);
+#endif
+  if (mincore(reinterpret_cast<void*>(start), length, pages.data()) != 0)
+    return 0;
+
+  for (const auto page : pages)
+  {
+    if (page & 1)
+      resident_bytes += page_size;
+  }
+#endif
+  return resident_bytes;
+}
+
 void FreeAlignedMemory(void* ptr)
 {
   if (ptr)
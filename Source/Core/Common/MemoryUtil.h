@@ -28,6 +28,13 @@ struct ScopedJITPageWriteAndNoExecute
 };
 void* AllocateMemoryPages(size_t size);
 void FreeMemoryPages(void* ptr, size_t size);
+// Asks the OS to back the range with huge pages where possible, to reduce TLB misses.
+// Only supported on Linux, through transparent huge pages. Returns false if not supported.
+bool AdviseHugePages(void* ptr, size_t size);
+// Returns how many bytes of the mappings overlapping the range are currently backed by huge pages.
+size_t GetHugePageBytes(const void* ptr, size_t size);
+// Returns how many bytes of the range are currently in physical memory. Returns 0 if unsupported.
+size_t GetResidentBytes(const void* ptr, size_t size);
 void* AllocateAlignedMemory(size_t size, size_t alignment);
 void FreeAlignedMemory(void* ptr);
 void ReadProtectMemory(void* ptr, size_t size);
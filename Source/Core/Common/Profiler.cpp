@@ -32,9 +32,9 @@ Profiler::Profiler(const std::string& name)
       m_calls(0), m_depth(0)
 {
   m_time = Common::Timer::GetTimeUs();
-  s_max_length = std::max<u32>(s_max_length, u32(m_name.length()));
 
   std::lock_guard<std::mutex> lk(s_mutex);
+  s_max_length = std::max<u32>(s_max_length, u32(m_name.length()));
   s_all_profilers.push_back(this);
 }
 
@@ -112,6 +112,8 @@ void Profiler::Stop()
 
     u64 diff = end - m_time;
 
+    // ToString() reads and resets the totals from the thread drawing the overlay.
+    std::lock_guard<std::mutex> lk(s_mutex);
     m_usecs += diff;
     m_usecs_min = std::min(m_usecs_min, diff);
     m_usecs_max = std::max(m_usecs_max, diff);
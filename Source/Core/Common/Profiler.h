@@ -56,7 +56,13 @@ private:
 };
 };  // namespace Common
 
-// Warning: This profiler isn't thread safe. Only profile functions which doesn't run simultaneously
+// Zones are compiled out unless the build enables USE_PROFILER_ZONES (the PROFILER_ZONES CMake
+// option), so they can be left in hot code. Different zones may run on different threads, but a
+// single zone must not be entered by two threads at the same time.
+#ifdef USE_PROFILER_ZONES
 #define PROFILE(name)                                                                              \
   static Common::Profiler prof_gen(name);                                                          \
   Common::ProfilerExecuter prof_e(&prof_gen);
+#else
+#define PROFILE(name)
+#endif
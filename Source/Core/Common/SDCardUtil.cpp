@@ -182,6 +182,13 @@ static bool write_sector(File::IOFile& file, const u8* sector)
   return file.WriteBytes(sector, BYTES_PER_SECTOR);
 }
 
+// Skips over empty sectors instead of writing them. The skipped range reads back as zeros,
+// and on most host file systems it doesn't take up any disk space until it's written to.
+static bool skip_empty(File::IOFile& file, std::size_t count)
+{
+  return file.Seek(static_cast<s64>(count) * BYTES_PER_SECTOR, SEEK_CUR);
+}
+
 static bool write_empty(File::IOFile& file, std::size_t count)
 {
   static constexpr u8 empty[64 * 1024] = {};
@@ -211,8 +218,6 @@ bool SDCardCreate(u64 disk_size /*in MB*/, const std::string& filename)
     return false;
   }
 
-  // Pretty unlikely to overflow.
-  const u32 sectors_per_disk = static_cast<u32>(disk_size / BYTES_PER_SECTOR);
   const u32 sectors_per_fat = get_sectors_per_fat(disk_size, get_sectors_per_cluster(disk_size));
 
   boot_sector_init(s_boot_sector, s_fsinfo_sector, disk_size, nullptr);
@@ -236,6 +241,8 @@ bool SDCardCreate(u64 disk_size /*in MB*/, const std::string& filename)
    *  first fat
    *  second fat
    *  zero sectors
+   *
+   * The empty parts of the FATs and the data area are left sparse.
    */
 
   if (!write_sector(file, s_boot_sector))
@@ -267,16 +274,14 @@ bool SDCardCreate(u64 disk_size /*in MB*/, const std::string& filename)
   if (!write_sector(file, s_fat_head))
     goto FailWrite;
 
-  if (!write_empty(file, sectors_per_fat - 1))
+  if (!skip_empty(file, sectors_per_fat - 1))
     goto FailWrite;
 
   if (!write_sector(file, s_fat_head))
     goto FailWrite;
 
-  if (!write_empty(file, sectors_per_fat - 1))
-    goto FailWrite;
-
-  if (!write_empty(file, sectors_per_disk - RESERVED_SECTORS - 2 * sectors_per_fat))
+  // The data area is entirely empty, so extending the file is enough.
+  if (!file.Flush() || !file.Resize(disk_size))
     goto FailWrite;
 
   return true;
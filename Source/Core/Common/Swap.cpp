@@ -0,0 +1,95 @@
+// Copyright 2021 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Common/Swap.h"
+
+#include <cstddef>
+#include <cstring>
+
+#if defined(_M_X86)
+#include "Common/CPUDetect.h"
+#include "Common/Intrinsics.h"
+#elif defined(_M_ARM_64)
+#include <arm_neon.h>
+#endif
+
+#include "Common/CommonTypes.h"
+
+namespace Common
+{
+namespace
+{
+// Each of these swaps as many whole 16-byte chunks as possible and returns the number of elements
+// they contained, leaving the rest to the scalar loop.
+#if defined(_M_X86)
+template <size_t element_size>
+FUNCTION_TARGET_SSSE3 size_t SwapCopySSSE3(u8* dest, const u8* src, size_t count)
+{
+  __m128i mask;
+  if constexpr (element_size == 2)
+    mask = _mm_set_epi8(14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1);
+  else
+    mask = _mm_set_epi8(12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
+
+  const size_t size = count * element_size & ~size_t(15);
+  for (size_t i = 0; i < size; i += 16)
+  {
+    const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i), _mm_shuffle_epi8(data, mask));
+  }
+  return size / element_size;
+}
+#elif defined(_M_ARM_64)
+template <size_t element_size>
+size_t SwapCopyNEON(u8* dest, const u8* src, size_t count)
+{
+  const size_t size = count * element_size & ~size_t(15);
+  for (size_t i = 0; i < size; i += 16)
+  {
+    const uint8x16_t data = vld1q_u8(src + i);
+    if constexpr (element_size == 2)
+      vst1q_u8(dest + i, vrev16q_u8(data));
+    else
+      vst1q_u8(dest + i, vrev32q_u8(data));
+  }
+  return size / element_size;
+}
+#endif
+
+template <size_t element_size>
+size_t SwapCopyVectorized(u8* dest, const u8* src, size_t count)
+{
+#if defined(_M_X86)
+  if (cpu_info.bSSSE3)
+    return SwapCopySSSE3<element_size>(dest, src, count);
+  return 0;
+#elif defined(_M_ARM_64)
+  return SwapCopyNEON<element_size>(dest, src, count);
+#else
+  return 0;
+#endif
+}
+}  // namespace
+
+void SwapCopy16(void* dest, const void* src, size_t count)
+{
+  u8* const dest_bytes = static_cast<u8*>(dest);
+  const u8* const src_bytes = static_cast<const u8*>(src);
+  for (size_t i = SwapCopyVectorized<2>(dest_bytes, src_bytes, count); i < count; i++)
+  {
+    const u16 value = swap16(src_bytes + i * sizeof(u16));
+    std::memcpy(dest_bytes + i * sizeof(u16), &value, sizeof(u16));
+  }
+}
+
+void SwapCopy32(void* dest, const void* src, size_t count)
+{
+  u8* const dest_bytes = static_cast<u8*>(dest);
+  const u8* const src_bytes = static_cast<const u8*>(src);
+  for (size_t i = SwapCopyVectorized<4>(dest_bytes, src_bytes, count); i < count; i++)
+  {
+    const u32 value = swap32(src_bytes + i * sizeof(u32));
+    std::memcpy(dest_bytes + i * sizeof(u32), &value, sizeof(u32));
+  }
+}
+}  // namespace Common
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstring>
 #include <type_traits>
 
@@ -125,6 +126,11 @@ inline u64 swap64(const u8* data)
   return swap64(value);
 }
 
+// Copies count 16- or 32-bit elements from src to dest while swapping the byte order of each.
+// The buffers don't have to be aligned. They may be the same, but must not partially overlap.
+void SwapCopy16(void* dest, const void* src, size_t count);
+void SwapCopy32(void* dest, const void* src, size_t count);
+
 template <int count>
 void swap(u8*);
 
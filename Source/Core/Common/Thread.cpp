@@ -10,9 +10,21 @@
 #include <Windows.h>
 #include <processthreadsapi.h>
 #else
+#include <pthread.h>
 #include <unistd.h>
 #endif
 
+#ifdef __linux__
+#include <algorithm>
+#include <atomic>
+#include <sched.h>
+#include <string>
+#include <vector>
+
+#include "Common/FileUtil.h"
+#include "Common/Logging/Log.h"
+#endif
+
 #ifdef __APPLE__
 #include <mach/mach.h>
 #elif defined BSD4_4 || defined __FreeBSD__ || defined __OpenBSD__
@@ -186,4 +198,155 @@ void SetCurrentThreadName(const char* name)
 
 #endif
 
+#ifdef __linux__
+static std::atomic<bool> s_core_type_affinity_enabled{false};
+
+namespace
+{
+struct CoreTypes
+{
+  cpu_set_t big;
+  cpu_set_t little;
+  bool heterogeneous = false;
+};
+}  // namespace
+
+// Parses a CPU list such as "0-7,16-23" as found in sysfs.
+static bool ParseCPUList(const std::string& list, cpu_set_t* set)
+{
+  CPU_ZERO(set);
+  bool any = false;
+  for (const std::string& range : SplitString(std::string(StripSpaces(list)), ','))
+  {
+    const std::vector<std::string> bounds = SplitString(range, '-');
+    u32 first, last;
+    if (bounds.empty() || bounds.size() > 2 || !TryParse(bounds[0], &first) ||
+        !TryParse(bounds.back(), &last))
+    {
+      return false;
+    }
+
+    for (u32 cpu = first; cpu <= last && cpu < CPU_SETSIZE; cpu++)
+    {
+      CPU_SET(cpu, set);
+      any = true;
+    }
+  }
+  return any;
+}
+
+static CoreTypes DetectCoreTypes()
+{
+  CoreTypes types;
+  CPU_ZERO(&types.big);
+  CPU_ZERO(&types.little);
+
+  // Hybrid Intel CPUs expose a separate PMU, with its own CPU list, for each core type.
+  std::string core_cpus, atom_cpus;
+  if (File::ReadFileToString("/sys/devices/cpu_core/cpus", core_cpus) &&
+      File::ReadFileToString("/sys/devices/cpu_atom/cpus", atom_cpus) &&
+      ParseCPUList(core_cpus, &types.big) && ParseCPUList(atom_cpus, &types.little))
+  {
+    types.heterogeneous = true;
+    return types;
+  }
+
+  // ARM SoCs report the relative performance of each core instead. There may be more than two
+  // types of cores, so everything in the upper half of the range counts as big.
+  std::vector<u32> capacities;
+  for (u32 cpu = 0; cpu < CPU_SETSIZE; cpu++)
+  {
+    std::string capacity_str;
+    u32 capacity;
+    if (!File::ReadFileToString(
+            "/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/cpu_capacity", capacity_str) ||
+        !TryParse(std::string(StripSpaces(capacity_str)), &capacity))
+    {
+      break;
+    }
+    capacities.push_back(capacity);
+  }
+  if (capacities.empty())
+    return types;
+
+  const auto [min, max] = std::minmax_element(capacities.begin(), capacities.end());
+  if (*min == *max)
+    return types;
+
+  const u32 threshold = (*min + *max) / 2;
+  for (u32 cpu = 0; cpu < capacities.size(); cpu++)
+    CPU_SET(cpu, capacities[cpu] > threshold ? &types.big : &types.little);
+  types.heterogeneous = true;
+  return types;
+}
+
+void SetCoreTypeAffinityEnabled(bool enabled)
+{
+  s_core_type_affinity_enabled = enabled;
+}
+
+void SetCurrentThreadRole(ThreadRole role)
+{
+  if (!s_core_type_affinity_enabled)
+    return;
+
+  static const CoreTypes s_core_types = [] {
+    const CoreTypes types = DetectCoreTypes();
+    if (types.heterogeneous)
+    {
+      INFO_LOG_FMT(COMMON, "Detected {} big and {} little cores", CPU_COUNT(&types.big),
+                   CPU_COUNT(&types.little));
+    }
+    return types;
+  }();
+
+  if (role == ThreadRole::Default || !s_core_types.heterogeneous)
+    return;
+
+  // Applies to the calling thread only.
+  const cpu_set_t& set =
+      role == ThreadRole::LatencyCritical ? s_core_types.big : s_core_types.little;
+  sched_setaffinity(0, sizeof(set), &set);
+}
+#elif defined(__APPLE__)
+void SetCurrentThreadRole(ThreadRole role)
+{
+  // The scheduler picks the core type from the quality of service class.
+  if (role == ThreadRole::LatencyCritical)
+    pthread_set_qos_class_self_np(QOS_CLASS_USER_INTERACTIVE, 0);
+  else if (role == ThreadRole::Background)
+    pthread_set_qos_class_self_np(QOS_CLASS_UTILITY, 0);
+}
+#elif defined(_WIN32) && defined(THREAD_POWER_THROTTLING_CURRENT_VERSION)
+void SetCurrentThreadRole(ThreadRole role)
+{
+  if (role == ThreadRole::Default)
+    return;
+
+  // Windows 11 prefers efficiency cores for threads with execution speed throttling (EcoQoS), and
+  // performance cores for threads which explicitly opt out of it.
+  static auto pSetThreadInformation = (decltype(&SetThreadInformation))GetProcAddress(
+      GetModuleHandleA("kernel32"), "SetThreadInformation");
+  if (!pSetThreadInformation)
+    return;
+
+  THREAD_POWER_THROTTLING_STATE state = {};
+  state.Version = THREAD_POWER_THROTTLING_CURRENT_VERSION;
+  state.ControlMask = THREAD_POWER_THROTTLING_EXECUTION_SPEED;
+  state.StateMask = role == ThreadRole::Background ? THREAD_POWER_THROTTLING_EXECUTION_SPEED : 0;
+  pSetThreadInformation(GetCurrentThread(), ThreadPowerThrottling, &state, sizeof(state));
+}
+#else
+void SetCurrentThreadRole(ThreadRole role)
+{
+}
+#endif
+
+#ifndef __linux__
+void SetCoreTypeAffinityEnabled(bool enabled)
+{
+  // Only Linux restricts the affinity. Elsewhere, the core type is only a hint to the scheduler.
+}
+#endif
+
 }  // namespace Common
@@ -35,4 +35,24 @@ inline void YieldCPU()
 
 void SetCurrentThreadName(const char* name);
 
+// What kind of work a thread does, for placing it on CPUs which have different types of cores.
+enum class ThreadRole
+{
+  // Left to the OS.
+  Default,
+  // Work which the emulation waits on, such as the CPU, GPU and DSP threads. Prefers big cores.
+  LatencyCritical,
+  // Work which the emulation doesn't wait on, such as compiling shaders ahead of time or dumping.
+  // Prefers little cores.
+  Background,
+};
+
+// Places the current thread according to its role. Does nothing if all cores are of the same type
+// or the core types can't be determined.
+void SetCurrentThreadRole(ThreadRole role);
+
+// Whether SetCurrentThreadRole may restrict the thread's CPU affinity to one core type, on systems
+// where it can't just give the scheduler a hint. Off by default.
+void SetCoreTypeAffinityEnabled(bool enabled);
+
 }  // namespace Common
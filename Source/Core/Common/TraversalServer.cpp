@@ -2,6 +2,8 @@
 
 // The central server implementation.
 #include <arpa/inet.h>
+#include <algorithm>
+#include <array>
 #include <cerrno>
 #include <chrono>
 #include <cstdio>
@@ -27,8 +29,14 @@
 #define NUMBER_OF_TRIES 5
 #define PORT 6262
 
+// Maximum number of packets received or sent with a single system call.
+#define PACKET_BATCH_SIZE 64
+
 static u64 currentTime;
 
+static const u64 resendInterval = 300000;    // 300ms, multiplied by the number of tries
+static const u64 expiryTime = 30 * 1000000;  // 30s
+
 struct OutgoingPacketInfo
 {
   TraversalPacket packet;
@@ -52,32 +60,75 @@ struct EvictFindResult
   V* value;
 };
 
+// Buckets scheduled work by time so that only the entries which are due have to be looked at,
+// instead of scanning whole tables after every packet. Entries may fire up to one tick early, or
+// early if they are scheduled further ahead than the wheel covers, so callbacks have to check the
+// actual deadline and reschedule the entry if it isn't due yet.
+template <typename T>
+class TimerWheel
+{
+public:
+  explicit TimerWheel(u64 tickLength) : tickLength(tickLength) {}
+
+  void Schedule(const T& value, u64 time)
+  {
+    u64 tick = std::max(time / tickLength, currentTick);
+    tick = std::min(tick, currentTick + NUM_SLOTS - 1);
+    slots[tick % NUM_SLOTS].push_back(value);
+  }
+
+  // Calls callback for every entry scheduled up to the current time. The callback may schedule
+  // new entries.
+  template <typename F>
+  void Advance(F callback)
+  {
+    const u64 targetTick = currentTime / tickLength;
+    u64 tick = currentTick;
+    if (targetTick - tick >= NUM_SLOTS)
+      tick = targetTick - NUM_SLOTS + 1;
+
+    currentTick = targetTick;
+    for (; tick <= targetTick; tick++)
+    {
+      std::vector<T>& slot = slots[tick % NUM_SLOTS];
+      if (slot.empty())
+        continue;
+
+      std::swap(slot, firing);
+      for (const T& value : firing)
+        callback(value);
+      firing.clear();
+    }
+  }
+
+private:
+  static const u64 NUM_SLOTS = 64;
+
+  u64 tickLength;
+  u64 currentTick = 0;
+  std::array<std::vector<T>, NUM_SLOTS> slots;
+  std::vector<T> firing;
+};
+
 template <typename K, typename V>
 EvictFindResult<V> EvictFind(std::unordered_map<K, EvictEntry<V>>& map, const K& key,
                              bool refresh = false)
 {
-retry:
-  const u64 expiryTime = 30 * 1000000;  // 30s
   EvictFindResult<V> result;
-  if (map.bucket_count())
+  auto it = map.find(key);
+  if (it != map.end())
   {
-    auto bucket = map.bucket(key);
-    auto it = map.begin(bucket);
-    for (; it != map.end(bucket); ++it)
+    if (currentTime - it->second.updateTime > expiryTime)
     {
-      if (currentTime - it->second.updateTime > expiryTime)
-      {
-        map.erase(it->first);
-        goto retry;
-      }
-      if (it->first == key)
-      {
-        if (refresh)
-          it->second.updateTime = currentTime;
-        result.found = true;
-        result.value = &it->second.value;
-        return result;
-      }
+      map.erase(it);
+    }
+    else
+    {
+      if (refresh)
+        it->second.updateTime = currentTime;
+      result.found = true;
+      result.value = &it->second.value;
+      return result;
     }
   }
 #if DEBUG
@@ -93,14 +144,30 @@ retry:
 }
 
 template <typename K, typename V>
-V* EvictSet(std::unordered_map<K, EvictEntry<V>>& map, const K& key)
+V* EvictSet(std::unordered_map<K, EvictEntry<V>>& map, TimerWheel<K>& evictions, const K& key)
 {
-  // can't use a local_iterator to emplace...
   auto& result = map[key];
   result.updateTime = currentTime;
+  evictions.Schedule(key, currentTime + expiryTime);
   return &result.value;
 }
 
+// Removes the entry if it has expired. Entries which were refreshed in the meantime are
+// rescheduled, so each entry only has a single pending eviction.
+template <typename K, typename V>
+void EvictExpired(std::unordered_map<K, EvictEntry<V>>& map, TimerWheel<K>& evictions,
+                  const K& key)
+{
+  auto it = map.find(key);
+  if (it == map.end())
+    return;
+
+  if (currentTime - it->second.updateTime > expiryTime)
+    map.erase(it);
+  else
+    evictions.Schedule(key, it->second.updateTime + expiryTime + 1);
+}
+
 namespace std
 {
 template <>
@@ -114,9 +181,21 @@ struct hash<TraversalHostId>
 };
 }  // namespace std
 
+struct PendingSend
+{
+  TraversalPacket packet;
+  size_t size;
+  sockaddr_in6 dest;
+};
+
 static int sock;
 static std::unordered_map<TraversalRequestId, OutgoingPacketInfo> outgoingPackets;
 static std::unordered_map<TraversalHostId, EvictEntry<TraversalInetAddress>> connectedClients;
+static TimerWheel<TraversalRequestId> resendTimers(100000);  // 100ms ticks
+static TimerWheel<TraversalHostId> evictionTimers(1000000);   // 1s ticks
+
+// Packets are queued while a batch of received packets is handled, and sent together after it.
+static std::vector<PendingSend> pendingSends;
 
 static TraversalInetAddress MakeInetAddress(const sockaddr_in6& addr)
 {
@@ -189,10 +268,55 @@ static void TrySend(const void* buffer, size_t size, sockaddr_in6* addr)
   printf("-> %d %llu %s\n", static_cast<int>(packet->type),
          static_cast<long long>(packet->requestId), SenderName(addr));
 #endif
-  if ((size_t)sendto(sock, buffer, size, 0, (sockaddr*)addr, sizeof(*addr)) != size)
+  PendingSend& send = pendingSends.emplace_back();
+  memcpy(&send.packet, buffer, size);
+  send.size = size;
+  send.dest = *addr;
+}
+
+static void FlushSends()
+{
+#ifdef __linux__
+  std::array<mmsghdr, PACKET_BATCH_SIZE> msgs;
+  std::array<iovec, PACKET_BATCH_SIZE> iovecs;
+  size_t next = 0;
+  while (next < pendingSends.size())
+  {
+    const size_t count = std::min<size_t>(pendingSends.size() - next, PACKET_BATCH_SIZE);
+    for (size_t i = 0; i < count; i++)
+    {
+      PendingSend& send = pendingSends[next + i];
+      iovecs[i] = {&send.packet, send.size};
+      msgs[i] = {};
+      msgs[i].msg_hdr.msg_name = &send.dest;
+      msgs[i].msg_hdr.msg_namelen = sizeof(send.dest);
+      msgs[i].msg_hdr.msg_iov = &iovecs[i];
+      msgs[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    const int sent = sendmmsg(sock, msgs.data(), static_cast<unsigned int>(count), 0);
+    if (sent <= 0)
+    {
+      // Drop the packet which failed, like a single failed sendto would.
+      perror("sendmmsg");
+      next++;
+    }
+    else
+    {
+      next += sent;
+    }
+  }
+#else
+  for (PendingSend& send : pendingSends)
   {
-    perror("sendto");
+    if ((size_t)sendto(sock, &send.packet, send.size, 0, (sockaddr*)&send.dest,
+                       sizeof(send.dest)) != send.size)
+    {
+      perror("sendto");
+    }
   }
+#endif
+  pendingSends.clear();
 }
 
 static TraversalPacket* AllocPacket(const sockaddr_in6& dest, TraversalRequestId misc = 0)
@@ -207,6 +331,8 @@ static TraversalPacket* AllocPacket(const sockaddr_in6& dest, TraversalRequestId
   TraversalPacket* result = &info->packet;
   memset(result, 0, sizeof(*result));
   result->requestId = requestId;
+  // The packet is filled in by the caller and sent once the resend timers run.
+  resendTimers.Schedule(requestId, currentTime);
   return result;
 }
 
@@ -215,43 +341,51 @@ static void SendPacket(OutgoingPacketInfo* info)
   info->tries++;
   info->sendTime = currentTime;
   TrySend(&info->packet, sizeof(info->packet), &info->dest);
+  resendTimers.Schedule(info->packet.requestId, currentTime + resendInterval * info->tries);
 }
 
-static void ResendPackets()
+static void ResendPacket(TraversalRequestId requestId)
 {
-  std::vector<std::pair<TraversalInetAddress, TraversalRequestId>> todoFailures;
-  todoFailures.clear();
-  for (auto it = outgoingPackets.begin(); it != outgoingPackets.end();)
+  auto it = outgoingPackets.find(requestId);
+  if (it == outgoingPackets.end())
+    return;
+
+  OutgoingPacketInfo* info = &it->second;
+  const u64 resendTime = info->sendTime + resendInterval * info->tries;
+  if (currentTime < resendTime)
   {
-    OutgoingPacketInfo* info = &it->second;
-    if (currentTime - info->sendTime >= (u64)(300000 * info->tries))
-    {
-      if (info->tries >= NUMBER_OF_TRIES)
-      {
-        if (info->packet.type == TraversalPacketType::PleaseSendPacket)
-        {
-          todoFailures.push_back(std::make_pair(info->packet.pleaseSendPacket.address, info->misc));
-        }
-        it = outgoingPackets.erase(it);
-        continue;
-      }
-      else
-      {
-        SendPacket(info);
-      }
-    }
-    ++it;
+    resendTimers.Schedule(requestId, resendTime);
+    return;
   }
 
-  for (const auto& p : todoFailures)
+  if (info->tries < NUMBER_OF_TRIES)
   {
-    TraversalPacket* fail = AllocPacket(MakeSinAddr(p.first));
+    SendPacket(info);
+    return;
+  }
+
+  const bool wasPleaseSend = info->packet.type == TraversalPacketType::PleaseSendPacket;
+  const TraversalInetAddress address = info->packet.pleaseSendPacket.address;
+  const TraversalRequestId misc = info->misc;
+  outgoingPackets.erase(it);
+
+  if (wasPleaseSend)
+  {
+    TraversalPacket* fail = AllocPacket(MakeSinAddr(address));
     fail->type = TraversalPacketType::ConnectFailed;
-    fail->connectFailed.requestId = p.second;
+    fail->connectFailed.requestId = misc;
     fail->connectFailed.reason = TraversalConnectFailedReason::ClientDidntRespond;
   }
 }
 
+static void RunTimers()
+{
+  resendTimers.Advance(ResendPacket);
+  evictionTimers.Advance([](const TraversalHostId& hostId) {
+    EvictExpired(connectedClients, evictionTimers, hostId);
+  });
+}
+
 static void HandlePacket(TraversalPacket* packet, sockaddr_in6* addr)
 {
 #if DEBUG
@@ -313,7 +447,7 @@ static void HandlePacket(TraversalPacket* packet, sockaddr_in6* addr)
         auto r = EvictFind(connectedClients, hostId);
         if (!r.found)
         {
-          iaddr = EvictSet(connectedClients, hostId);
+          iaddr = EvictSet(connectedClients, evictionTimers, hostId);
           break;
         }
       }
@@ -407,14 +541,31 @@ int main()
   sd_notifyf(0, "READY=1\nSTATUS=Listening on port %d", PORT);
 #endif
 
+  std::array<TraversalPacket, PACKET_BATCH_SIZE> packets;
+  std::array<sockaddr_in6, PACKET_BATCH_SIZE> raddrs;
+#ifdef __linux__
+  std::array<mmsghdr, PACKET_BATCH_SIZE> msgs;
+  std::array<iovec, PACKET_BATCH_SIZE> iovecs;
+#endif
+
   while (true)
   {
-    sockaddr_in6 raddr;
-    socklen_t addrLen = sizeof(raddr);
-    TraversalPacket packet;
-    // note: switch to recvmmsg (yes, mmsg) if this becomes
-    // expensive
-    rv = recvfrom(sock, &packet, sizeof(packet), 0, (sockaddr*)&raddr, &addrLen);
+#ifdef __linux__
+    // Waits for the first packet, then takes everything else that is already queued.
+    for (size_t i = 0; i < PACKET_BATCH_SIZE; i++)
+    {
+      iovecs[i] = {&packets[i], sizeof(packets[i])};
+      msgs[i] = {};
+      msgs[i].msg_hdr.msg_name = &raddrs[i];
+      msgs[i].msg_hdr.msg_namelen = sizeof(raddrs[i]);
+      msgs[i].msg_hdr.msg_iov = &iovecs[i];
+      msgs[i].msg_hdr.msg_iovlen = 1;
+    }
+    rv = recvmmsg(sock, msgs.data(), PACKET_BATCH_SIZE, MSG_WAITFORONE, nullptr);
+#else
+    socklen_t addrLen = sizeof(raddrs[0]);
+    rv = recvfrom(sock, &packets[0], sizeof(packets[0]), 0, (sockaddr*)&raddrs[0], &addrLen);
+#endif
     currentTime = std::chrono::duration_cast<std::chrono::microseconds>(
                       std::chrono::system_clock::now().time_since_epoch())
                       .count();
@@ -422,19 +573,31 @@ int main()
     {
       if (errno != EINTR && errno != EAGAIN)
       {
-        perror("recvfrom");
+        perror("recv");
         return 1;
       }
     }
-    else if ((size_t)rv < sizeof(packet))
-    {
-      fprintf(stderr, "received short packet from %s\n", SenderName(&raddr));
-    }
     else
     {
-      HandlePacket(&packet, &raddr);
+#ifdef __linux__
+      const int numPackets = rv;
+#else
+      const int numPackets = 1;
+      const size_t packetSize = rv;
+#endif
+      for (int i = 0; i < numPackets; i++)
+      {
+#ifdef __linux__
+        const size_t packetSize = msgs[i].msg_len;
+#endif
+        if (packetSize < sizeof(packets[i]))
+          fprintf(stderr, "received short packet from %s\n", SenderName(&raddrs[i]));
+        else
+          HandlePacket(&packets[i], &raddrs[i]);
+      }
     }
-    ResendPackets();
+    RunTimers();
+    FlushSends();
 #ifdef HAVE_LIBSYSTEMD
     sd_notify(0, "WATCHDOG=1");
 #endif
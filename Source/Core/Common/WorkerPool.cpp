@@ -0,0 +1,143 @@
+// Copyright 2021 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Common/WorkerPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <utility>
+
+#include "Common/Thread.h"
+
+namespace Common
+{
+WorkerPool::~WorkerPool()
+{
+  Stop();
+}
+
+void WorkerPool::Start(u32 num_threads, std::string thread_name, ThreadRole role)
+{
+  Stop();
+
+  m_stopping = false;
+  m_threads.reserve(num_threads);
+  for (u32 i = 0; i < num_threads; ++i)
+    m_threads.emplace_back(&WorkerPool::WorkerThread, this, thread_name, role);
+}
+
+void WorkerPool::Stop()
+{
+  if (m_threads.empty())
+    return;
+
+  {
+    std::lock_guard lk(m_mutex);
+    m_stopping = true;
+  }
+  m_job_available.notify_all();
+
+  for (std::thread& thread : m_threads)
+    thread.join();
+  m_threads.clear();
+}
+
+std::future<void> WorkerPool::Submit(std::function<void()> job)
+{
+  std::packaged_task<void()> task(std::move(job));
+  std::future<void> future = task.get_future();
+
+  if (!IsRunning())
+  {
+    task();
+    return future;
+  }
+
+  {
+    std::lock_guard lk(m_mutex);
+    m_jobs.push_back(std::move(task));
+  }
+  m_job_available.notify_one();
+  return future;
+}
+
+void WorkerPool::ParallelFor(size_t count, const std::function<void(size_t)>& function)
+{
+  if (count == 0)
+    return;
+
+  if (!IsRunning() || count == 1)
+  {
+    for (size_t i = 0; i < count; ++i)
+      function(i);
+    return;
+  }
+
+  // Indices are handed out through a shared counter, so the calling thread can do all of the work
+  // by itself if the workers are busy. Jobs which start after everything is done find no work and
+  // return immediately, which is why the state has to outlive this function.
+  struct State
+  {
+    const std::function<void(size_t)>* function;
+    size_t count;
+    std::atomic<size_t> next_index{0};
+    std::atomic<size_t> finished{0};
+    std::mutex mutex;
+    std::condition_variable done;
+  };
+  auto state = std::make_shared<State>();
+  state->function = &function;
+  state->count = count;
+
+  const auto run = [](State& s) {
+    size_t finished = 0;
+    for (size_t i = s.next_index++; i < s.count; i = s.next_index++)
+    {
+      (*s.function)(i);
+      ++finished;
+    }
+
+    if (finished != 0 && s.finished.fetch_add(finished) + finished == s.count)
+    {
+      std::lock_guard lk(s.mutex);
+      s.done.notify_all();
+    }
+  };
+
+  const size_t helpers = std::min<size_t>(count - 1, m_threads.size());
+  {
+    std::lock_guard lk(m_mutex);
+    for (size_t i = 0; i < helpers; ++i)
+      m_jobs.emplace_back([state, run] { run(*state); });
+  }
+  m_job_available.notify_all();
+
+  run(*state);
+
+  std::unique_lock lk(state->mutex);
+  state->done.wait(lk, [&state] { return state->finished.load() == state->count; });
+}
+
+void WorkerPool::WorkerThread(const std::string& thread_name, ThreadRole role)
+{
+  Common::SetCurrentThreadName(thread_name.c_str());
+  Common::SetCurrentThreadRole(role);
+
+  while (true)
+  {
+    std::packaged_task<void()> job;
+    {
+      std::unique_lock lk(m_mutex);
+      m_job_available.wait(lk, [this] { return m_stopping || !m_jobs.empty(); });
+      if (m_jobs.empty())
+        return;
+
+      job = std::move(m_jobs.front());
+      m_jobs.pop_front();
+    }
+
+    job();
+  }
+}
+}  // namespace Common
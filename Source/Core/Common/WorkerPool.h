@@ -0,0 +1,58 @@
+// Copyright 2021 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/Thread.h"
+
+namespace Common
+{
+// A fixed set of worker threads which run jobs submitted by other threads.
+//
+// Unlike WorkQueueThread, jobs are not guaranteed to run in submission order, and the
+// submitting thread can wait for individual jobs or take part in a ParallelFor.
+class WorkerPool
+{
+public:
+  WorkerPool() = default;
+  ~WorkerPool();
+
+  WorkerPool(const WorkerPool&) = delete;
+  WorkerPool& operator=(const WorkerPool&) = delete;
+
+  // Starts the given number of worker threads. Stops any previously started threads first.
+  void Start(u32 num_threads, std::string thread_name, ThreadRole role = ThreadRole::Default);
+  // Finishes all queued jobs and stops the worker threads.
+  void Stop();
+
+  bool IsRunning() const { return !m_threads.empty(); }
+  u32 GetThreadCount() const { return static_cast<u32>(m_threads.size()); }
+
+  // Queues a job. If the pool isn't running, the job is run immediately on the calling thread.
+  std::future<void> Submit(std::function<void()> job);
+
+  // Calls function(i) for every i in [0, count), spread across the workers and the calling thread,
+  // and returns once all calls have finished. It is safe to call this from within a job.
+  void ParallelFor(size_t count, const std::function<void(size_t)>& function);
+
+private:
+  void WorkerThread(const std::string& thread_name, ThreadRole role);
+
+  std::vector<std::thread> m_threads;
+  std::deque<std::packaged_task<void()>> m_jobs;
+  std::mutex m_mutex;
+  std::condition_variable m_job_available;
+  bool m_stopping = false;
+};
+}  // namespace Common
@@ -34,6 +34,7 @@
 #include "Common/CommonTypes.h"
 #include "Common/IniFile.h"
 #include "Common/Logging/Log.h"
+#include "Common/Logging/LogManager.h"
 #include "Common/MsgHandler.h"
 
 #include "Core/ARDecrypt.h"
@@ -308,8 +309,13 @@ static void VLogInfo(std::string_view format, fmt::format_args args)
     return;
 
   const bool use_internal_log = s_use_internal_log.load(std::memory_order_relaxed);
-  if (MAX_LOGLEVEL < Common::Log::LINFO && !use_internal_log)
+  if (!use_internal_log &&
+      (MAX_LOGLEVEL < Common::Log::LINFO ||
+       !Common::Log::LogManager::GetInstance()->IsEnabled(Common::Log::ACTIONREPLAY,
+                                                          Common::Log::LINFO)))
+  {
     return;
+  }
 
   std::string text = fmt::vformat(format, args);
   INFO_LOG_FMT(ACTIONREPLAY, "{}", text);
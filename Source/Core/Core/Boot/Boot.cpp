@@ -55,6 +55,7 @@ namespace fs = std::filesystem;
 #include "Core/PowerPC/PPCAnalyst.h"
 #include "Core/PowerPC/PPCSymbolDB.h"
 #include "Core/PowerPC/PowerPC.h"
+#include "Core/State.h"
 
 #include "DiscIO/Enums.h"
 #include "DiscIO/VolumeDisc.h"
@@ -422,7 +423,10 @@ bool CBoot::BootUp(std::unique_ptr<BootParameters> boot)
 
   struct BootTitle
   {
-    BootTitle() : config(SConfig::GetInstance()) {}
+    explicit BootTitle(const std::optional<std::string>& savestate_path_)
+        : config(SConfig::GetInstance()), savestate_path(savestate_path_)
+    {
+    }
     bool operator()(BootParameters::Disc& disc) const
     {
       NOTICE_LOG_FMT(BOOT, "Booting from disc: {}", disc.path);
@@ -432,6 +436,17 @@ bool CBoot::BootUp(std::unique_ptr<BootParameters> boot)
       if (!volume)
         return false;
 
+      // The savestate replaces all of memory and the CPU state anyway, so running the apploader
+      // first is only wasted time. Wii titles are excluded since their boot process also sets up
+      // IOS and the NAND, which the savestate doesn't fully cover.
+      if (savestate_path && !config.bWii && Config::Get(Config::MAIN_RESUME_SKIPS_BOOT) &&
+          State::IsLoadable(*savestate_path))
+      {
+        NOTICE_LOG_FMT(BOOT, "Skipping the boot process, resuming from {}", *savestate_path);
+        SConfig::OnNewTitleLoad();
+        return true;
+      }
+
       if (!EmulatedBS2(config.bWii, *volume))
         return false;
 
@@ -542,9 +557,10 @@ bool CBoot::BootUp(std::unique_ptr<BootParameters> boot)
 
   private:
     const SConfig& config;
+    const std::optional<std::string>& savestate_path;
   };
 
-  if (!std::visit(BootTitle(), boot->parameters))
+  if (!std::visit(BootTitle(boot->savestate_path), boot->parameters))
     return false;
 
   return true;
@@ -235,6 +235,8 @@ bool BootCore(std::unique_ptr<BootParameters> boot, const WindowSystemInfo& wsi)
   if (!boot)
     return false;
 
+  Core::StartBootTrace();
+
   SConfig& StartUp = SConfig::GetInstance();
 
   StartUp.bRunCompareClient = false;
@@ -437,6 +439,7 @@ bool BootCore(std::unique_ptr<BootParameters> boot, const WindowSystemInfo& wsi)
     Config::SetCurrent(Config::SYSCONF_PAL60, false);
 
   Core::UpdateWantDeterminism(/*initial*/ true);
+  Core::TraceBootStep("Loading game settings");
 
   if (StartUp.bWii)
   {
@@ -454,6 +457,7 @@ bool BootCore(std::unique_ptr<BootParameters> boot, const WindowSystemInfo& wsi)
         return Config::GetActiveLayerForConfig(location) >= Config::LayerType::Movie;
       });
     }
+    Core::TraceBootStep("Setting up the Wii NAND");
   }
 
   const bool load_ipl = !StartUp.bWii && !StartUp.bHLE_BS2 &&
@@ -20,10 +20,28 @@ namespace Config
 // Main.Core
 
 const Info<bool> MAIN_SKIP_IPL{{System::Main, "Core", "SkipIPL"}, true};
+const Info<bool> MAIN_RESUME_SKIPS_BOOT{{System::Main, "Core", "ResumeSkipsBoot"}, false};
 const Info<PowerPC::CPUCore> MAIN_CPU_CORE{{System::Main, "Core", "CPUCore"},
                                            PowerPC::DefaultCPUCore()};
 const Info<bool> MAIN_JIT_FOLLOW_BRANCH{{System::Main, "Core", "JITFollowBranch"}, true};
+const Info<bool> MAIN_JIT_ANALYSIS_CACHE{{System::Main, "Core", "JITAnalysisCache"}, false};
+const Info<int> MAIN_JIT_COLD_BLOCK_THRESHOLD{{System::Main, "Core", "JITColdBlockThreshold"},
+                                              0};
+const Info<int> MAIN_JIT_CODE_CACHE_SIZE{{System::Main, "Core", "JITCodeCacheSize"}, 32};
+const Info<int> MAIN_JIT_TRACE_THRESHOLD{{System::Main, "Core", "JITTraceThreshold"}, 0};
+const Info<bool> MAIN_JIT_LOOP_REGISTER_PINNING{{System::Main, "Core", "JITLoopRegisterPinning"},
+                                                false};
+const Info<bool> MAIN_PERFORMANCE_HLE{{System::Main, "Core", "PerformanceHLE"}, false};
+const Info<bool> MAIN_JIT_DEFERRED_INVALIDATION{{System::Main, "Core", "JITDeferredInvalidation"},
+                                                false};
 const Info<bool> MAIN_FASTMEM{{System::Main, "Core", "Fastmem"}, true};
+const Info<bool> MAIN_FASTMEM_PAGE_TABLE{{System::Main, "Core", "FastmemPageTable"}, false};
+const Info<bool> MAIN_HUGE_PAGES{{System::Main, "Core", "HugePages"}, false};
+const Info<bool> MAIN_CORE_TYPE_AFFINITY{{System::Main, "Core", "CoreTypeAffinity"}, false};
+const Info<bool> MAIN_SKIP_IDLE_VI_HALF_LINES{{System::Main, "Core", "SkipIdleVIHalfLines"},
+                                              false};
+const Info<int> MAIN_SAMPLING_PROFILER_INTERVAL{
+    {System::Main, "Core", "SamplingProfilerInterval"}, 0};
 const Info<bool> MAIN_DSP_HLE{{System::Main, "Core", "DSPHLE"}, true};
 const Info<int> MAIN_TIMING_VARIANCE{{System::Main, "Core", "TimingVariance"}, 40};
 const Info<bool> MAIN_CPU_THREAD{{System::Main, "Core", "CPUThread"}, true};
@@ -110,6 +128,7 @@ const Info<bool> MAIN_ALLOW_SD_WRITES{{System::Main, "Core", "WiiSDCardAllowWrit
 const Info<bool> MAIN_ENABLE_SAVESTATES{{System::Main, "Core", "EnableSaveStates"}, false};
 const Info<bool> MAIN_REAL_WII_REMOTE_REPEAT_REPORTS{
     {System::Main, "Core", "RealWiiRemoteRepeatReports"}, true};
+const Info<int> MAIN_RUN_AHEAD_FRAMES{{System::Main, "Core", "RunAheadFrames"}, 0};
 
 // Main.Display
 
@@ -130,12 +149,17 @@ const Info<bool> MAIN_DISABLE_SCREENSAVER{{System::Main, "Display", "DisableScre
 
 const Info<bool> MAIN_DSP_CAPTURE_LOG{{System::Main, "DSP", "CaptureLog"}, false};
 const Info<bool> MAIN_DSP_JIT{{System::Main, "DSP", "EnableJIT"}, true};
+const Info<bool> MAIN_DSP_HLE_THREAD{{System::Main, "DSP", "HLEThread"}, false};
+const Info<bool> MAIN_DSP_HLE_FAST_FORWARD_SKIP_MIXING{
+    {System::Main, "DSP", "HLEFastForwardSkipMixing"}, false};
 const Info<bool> MAIN_DUMP_AUDIO{{System::Main, "DSP", "DumpAudio"}, false};
 const Info<bool> MAIN_DUMP_AUDIO_SILENT{{System::Main, "DSP", "DumpAudioSilent"}, false};
 const Info<bool> MAIN_DUMP_UCODE{{System::Main, "DSP", "DumpUCode"}, false};
 const Info<std::string> MAIN_AUDIO_BACKEND{{System::Main, "DSP", "Backend"},
                                            AudioCommon::GetDefaultSoundBackend()};
 const Info<int> MAIN_AUDIO_VOLUME{{System::Main, "DSP", "Volume"}, 100};
+const Info<AudioCommon::ResamplingQuality> MAIN_AUDIO_RESAMPLING_QUALITY{
+    {System::Main, "DSP", "ResamplingQuality"}, AudioCommon::ResamplingQuality::Linear};
 
 // Main.General
 
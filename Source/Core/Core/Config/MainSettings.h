@@ -16,6 +16,7 @@ enum class CPUCore;
 namespace AudioCommon
 {
 enum class DPL2Quality;
+enum class ResamplingQuality;
 }
 
 namespace Config
@@ -23,9 +24,28 @@ namespace Config
 // Main.Core
 
 extern const Info<bool> MAIN_SKIP_IPL;
+// When booting a GameCube disc together with a savestate, skip the emulated boot process and only
+// load the state.
+extern const Info<bool> MAIN_RESUME_SKIPS_BOOT;
 extern const Info<PowerPC::CPUCore> MAIN_CPU_CORE;
 extern const Info<bool> MAIN_JIT_FOLLOW_BRANCH;
+extern const Info<bool> MAIN_JIT_ANALYSIS_CACHE;
+extern const Info<int> MAIN_JIT_COLD_BLOCK_THRESHOLD;
+// In MiB. Smaller code caches save memory, but are flushed more often.
+extern const Info<int> MAIN_JIT_CODE_CACHE_SIZE;
+extern const Info<int> MAIN_JIT_TRACE_THRESHOLD;
+extern const Info<bool> MAIN_JIT_LOOP_REGISTER_PINNING;
+extern const Info<bool> MAIN_JIT_DEFERRED_INVALIDATION;
 extern const Info<bool> MAIN_FASTMEM;
+extern const Info<bool> MAIN_FASTMEM_PAGE_TABLE;
+extern const Info<bool> MAIN_HUGE_PAGES;
+// Restrict threads to big or little cores according to their role on Linux.
+extern const Info<bool> MAIN_CORE_TYPE_AFFINITY;
+// Only run VideoInterface updates on half-lines where something happens, instead of on every one.
+extern const Info<bool> MAIN_SKIP_IDLE_VI_HALF_LINES;
+// Replace hot SDK functions such as memcpy with native implementations.
+extern const Info<bool> MAIN_PERFORMANCE_HLE;
+extern const Info<int> MAIN_SAMPLING_PROFILER_INTERVAL;
 // Should really be in the DSP section, but we're kind of stuck with bad decisions made in the past.
 extern const Info<bool> MAIN_DSP_HLE;
 extern const Info<int> MAIN_TIMING_VARIANCE;
@@ -87,16 +107,21 @@ extern const Info<bool> MAIN_ALLOW_SD_WRITES;
 extern const Info<bool> MAIN_ENABLE_SAVESTATES;
 extern const Info<DiscIO::Region> MAIN_FALLBACK_REGION;
 extern const Info<bool> MAIN_REAL_WII_REMOTE_REPEAT_REPORTS;
+// Number of frames emulated ahead to hide input lag, or 0 to disable run-ahead.
+extern const Info<int> MAIN_RUN_AHEAD_FRAMES;
 
 // Main.DSP
 
 extern const Info<bool> MAIN_DSP_CAPTURE_LOG;
 extern const Info<bool> MAIN_DSP_JIT;
+extern const Info<bool> MAIN_DSP_HLE_THREAD;
+extern const Info<bool> MAIN_DSP_HLE_FAST_FORWARD_SKIP_MIXING;
 extern const Info<bool> MAIN_DUMP_AUDIO;
 extern const Info<bool> MAIN_DUMP_AUDIO_SILENT;
 extern const Info<bool> MAIN_DUMP_UCODE;
 extern const Info<std::string> MAIN_AUDIO_BACKEND;
 extern const Info<int> MAIN_AUDIO_VOLUME;
+extern const Info<AudioCommon::ResamplingQuality> MAIN_AUDIO_RESAMPLING_QUALITY;
 
 // Main.Display
 
@@ -63,6 +63,14 @@ bool IsSettingSaveable(const Config::Location& config_location)
       &Config::MAIN_ENABLE_SAVESTATES.GetLocation(),
       &Config::MAIN_FALLBACK_REGION.GetLocation(),
       &Config::MAIN_REAL_WII_REMOTE_REPEAT_REPORTS.GetLocation(),
+      &Config::MAIN_RUN_AHEAD_FRAMES.GetLocation(),
+      &Config::MAIN_JIT_ANALYSIS_CACHE.GetLocation(),
+      &Config::MAIN_JIT_COLD_BLOCK_THRESHOLD.GetLocation(),
+      &Config::MAIN_JIT_TRACE_THRESHOLD.GetLocation(),
+      &Config::MAIN_JIT_LOOP_REGISTER_PINNING.GetLocation(),
+      &Config::MAIN_JIT_DEFERRED_INVALIDATION.GetLocation(),
+      &Config::MAIN_FASTMEM_PAGE_TABLE.GetLocation(),
+      &Config::MAIN_SAMPLING_PROFILER_INTERVAL.GetLocation(),
 
       // Main.Interface
 
@@ -6,6 +6,7 @@
 #include <algorithm>
 #include <atomic>
 #include <cstring>
+#include <future>
 #include <mutex>
 #include <queue>
 #include <utility>
@@ -23,6 +24,7 @@
 #include "Common/CPUDetect.h"
 #include "Common/CommonPaths.h"
 #include "Common/CommonTypes.h"
+#include "Common/Config/Config.h"
 #include "Common/Event.h"
 #include "Common/FPURoundMode.h"
 #include "Common/FileUtil.h"
@@ -38,6 +40,7 @@
 
 #include "Core/Boot/Boot.h"
 #include "Core/BootManager.h"
+#include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
 #include "Core/CoreTiming.h"
 #include "Core/DSPEmulator.h"
@@ -63,7 +66,9 @@
 #include "Core/PatchEngine.h"
 #include "Core/PowerPC/JitInterface.h"
 #include "Core/PowerPC/PowerPC.h"
+#include "Core/PowerPC/SamplingProfiler.h"
 #include "Core/State.h"
+#include "Core/System.h"
 #include "Core/WiiRoot.h"
 
 #ifdef USE_GDBSTUB
@@ -98,6 +103,10 @@ static Common::Timer s_timer;
 static std::atomic<u32> s_drawn_frame;
 static std::atomic<u32> s_drawn_video;
 
+// Zero when not booting, or once the first frame has been presented.
+static std::atomic<u64> s_boot_start_time_us;
+static u64 s_boot_step_time_us;
+
 static bool s_is_stopping = false;
 static bool s_hardware_initialized = false;
 static bool s_is_started = false;
@@ -218,6 +227,21 @@ bool WantsDeterminism()
   return s_wants_determinism;
 }
 
+void StartBootTrace()
+{
+  s_boot_step_time_us = Common::Timer::GetTimeUs();
+  s_boot_start_time_us.store(s_boot_step_time_us, std::memory_order_relaxed);
+}
+
+// Steps are traced on the host thread and then the emu thread, which is started after the host
+// thread's last step, so they never run concurrently.
+void TraceBootStep(std::string_view step)
+{
+  const u64 time_us = Common::Timer::GetTimeUs();
+  INFO_LOG_FMT(BOOT, "{} took {:.1f} ms", step, (time_us - s_boot_step_time_us) / 1000.0);
+  s_boot_step_time_us = time_us;
+}
+
 // This is called from the GUI thread. See the booting call schedule in
 // BootManager.cpp
 bool Init(std::unique_ptr<BootParameters> boot, const WindowSystemInfo& wsi)
@@ -237,6 +261,8 @@ bool Init(std::unique_ptr<BootParameters> boot, const WindowSystemInfo& wsi)
   // Drain any left over jobs
   HostDispatchJobs();
 
+  Common::SetCoreTypeAffinityEnabled(Config::Get(Config::MAIN_CORE_TYPE_AFFINITY));
+
   INFO_LOG_FMT(BOOT, "Starting core = {} mode", SConfig::GetInstance().bWii ? "Wii" : "GameCube");
   INFO_LOG_FMT(BOOT, "CPU Thread separate = {}", SConfig::GetInstance().bCPUThread ? "Yes" : "No");
 
@@ -337,6 +363,7 @@ static void CpuThread(const std::optional<std::string>& savestate_path, bool del
     Common::SetCurrentThreadName("CPU thread");
   else
     Common::SetCurrentThreadName("CPU-GPU thread");
+  Common::SetCurrentThreadRole(Common::ThreadRole::LatencyCritical);
 
   // This needs to be delayed until after the video backend is ready.
   DolphinAnalytics::Instance().ReportGameStart();
@@ -381,9 +408,22 @@ static void CpuThread(const std::optional<std::string>& savestate_path, bool del
   }
 #endif
 
+  // The interval is in microseconds.
+  const int sampling_interval = Config::Get(Config::MAIN_SAMPLING_PROFILER_INTERVAL);
+  if (sampling_interval > 0)
+    Profiler::StartSampling(static_cast<u32>(sampling_interval));
+
   // Enter CPU run loop. When we leave it - we are done.
   CPU::Run();
 
+  if (Profiler::IsSampling())
+  {
+    Profiler::StopSampling();
+    const std::string filename = File::GetUserPath(D_DUMP_IDX) + "Debug/sampling_profile.txt";
+    File::CreateFullPath(filename);
+    Profiler::WriteSamples(filename);
+  }
+
 #ifdef USE_MEMORYWATCHER
   s_memory_watcher.reset();
 #endif
@@ -404,6 +444,7 @@ static void FifoPlayerThread(const std::optional<std::string>& savestate_path,
     Common::SetCurrentThreadName("FIFO player thread");
   else
     Common::SetCurrentThreadName("FIFO-GPU thread");
+  Common::SetCurrentThreadRole(Common::ThreadRole::LatencyCritical);
 
   // Enter CPU run loop. When we leave it - we are done.
   if (auto cpu_core = FifoPlayer::GetInstance().GetCPUCore())
@@ -439,6 +480,7 @@ static void EmuThread(std::unique_ptr<BootParameters> boot, WindowSystemInfo wsi
     s_is_started = false;
     s_is_stopping = false;
     s_wants_determinism = false;
+    s_boot_start_time_us.store(0, std::memory_order_relaxed);
 
     CallOnStateChangedCallbacks(State::Uninitialized);
 
@@ -500,6 +542,7 @@ static void EmuThread(std::unique_ptr<BootParameters> boot, WindowSystemInfo wsi
   {
     FreeLook::LoadInputConfig();
   }
+  TraceBootStep("Initializing input");
 
   Common::ScopeGuard controller_guard{[init_controllers, init_wiimotes] {
     if (!init_controllers)
@@ -525,6 +568,7 @@ static void EmuThread(std::unique_ptr<BootParameters> boot, WindowSystemInfo wsi
 
   AudioCommon::InitSoundStream();
   Common::ScopeGuard audio_guard{&AudioCommon::ShutdownSoundStream};
+  TraceBootStep("Creating the audio backend");
 
   HW::Init();
 
@@ -547,6 +591,21 @@ static void EmuThread(std::unique_ptr<BootParameters> boot, WindowSystemInfo wsi
     PowerPC::debug_interface.Clear();
   }};
 
+  TraceBootStep("Initializing hardware");
+
+  if (cpu_info.HTT)
+    SConfig::GetInstance().bDSPThread = cpu_info.num_cores > 4;
+  else
+    SConfig::GetInstance().bDSPThread = cpu_info.num_cores > 2;
+
+  // The DSP emulator doesn't depend on the video backend, so initialize it on another thread
+  // while the video backend initializes and loads its shader cache.
+  std::future<bool> dsp_initialized =
+      std::async(std::launch::async, [wii = core_parameter.bWii,
+                                       dsp_thread = core_parameter.bDSPThread] {
+        return DSP::GetDSPEmulator()->Initialize(wii, dsp_thread);
+      });
+
   VideoBackendBase::PopulateBackendInfo();
 
   if (!g_video_backend->Initialize(wsi))
@@ -560,21 +619,19 @@ static void EmuThread(std::unique_ptr<BootParameters> boot, WindowSystemInfo wsi
   // This avoids the game list being displayed while the core is finishing initializing.
   g_renderer->BeginUIFrame();
   g_renderer->EndUIFrame();
+  TraceBootStep("Initializing the video backend");
 
-  if (cpu_info.HTT)
-    SConfig::GetInstance().bDSPThread = cpu_info.num_cores > 4;
-  else
-    SConfig::GetInstance().bDSPThread = cpu_info.num_cores > 2;
-
-  if (!DSP::GetDSPEmulator()->Initialize(core_parameter.bWii, core_parameter.bDSPThread))
+  if (!dsp_initialized.get())
   {
     PanicAlertFmt("Failed to initialize DSP emulation!");
     return;
   }
+  TraceBootStep("Waiting for the DSP emulator");
 
   // Inputs loading may have generated custom dynamic textures
   // it's now ok to initialize any custom textures
   HiresTexture::Update();
+  TraceBootStep("Loading custom textures");
 
   AudioCommon::PostInitSoundStream();
 
@@ -597,15 +654,21 @@ static void EmuThread(std::unique_ptr<BootParameters> boot, WindowSystemInfo wsi
 
   if (!CBoot::BootUp(std::move(boot)))
     return;
+  TraceBootStep("Loading the game");
 
   // Initialise Wii filesystem contents.
   // This is done here after Boot and not in BootManager to ensure that we operate
   // with the correct title context since save copying requires title directories to exist.
   Common::ScopeGuard wiifs_guard{&Core::CleanUpWiiFileSystemContents};
   if (SConfig::GetInstance().bWii)
+  {
     Core::InitializeWiiFileSystemContents();
+    TraceBootStep("Initializing Wii file system contents");
+  }
   else
+  {
     wiifs_guard.Dismiss();
+  }
 
   // This adds the SyncGPU handler to CoreTiming, so now CoreTiming::Advance might block.
   Fifo::Prepare();
@@ -627,6 +690,7 @@ static void EmuThread(std::unique_ptr<BootParameters> boot, WindowSystemInfo wsi
     // This thread, after creating the EmuWindow, spawns a CPU
     // thread, and then takes over and becomes the video thread
     Common::SetCurrentThreadName("Video thread");
+    Common::SetCurrentThreadRole(Common::ThreadRole::LatencyCritical);
     UndeclareAsCPUThread();
     FPURoundMode::LoadDefaultSIMDState();
 
@@ -885,6 +949,16 @@ void Callback_FramePresented(double actual_emulation_speed)
 {
   s_last_actual_emulation_speed = actual_emulation_speed;
 
+  if (s_boot_start_time_us.load(std::memory_order_relaxed) != 0)
+  {
+    const u64 boot_start_time_us = s_boot_start_time_us.exchange(0, std::memory_order_relaxed);
+    if (boot_start_time_us != 0)
+    {
+      NOTICE_LOG_FMT(BOOT, "First frame presented {:.1f} ms after boot started",
+                     (Common::Timer::GetTimeUs() - boot_start_time_us) / 1000.0);
+    }
+  }
+
   s_drawn_frame++;
   s_stop_frame_step.store(true);
 }
@@ -977,9 +1051,10 @@ void UpdateTitle(u32 ElapseTime)
   }
 
   // Update the audio timestretcher with the current speed
-  if (g_sound_stream)
+  SoundStream* sound_stream = System::GetInstance().GetSoundStream();
+  if (sound_stream)
   {
-    Mixer* pMixer = g_sound_stream->GetMixer();
+    Mixer* pMixer = sound_stream->GetMixer();
     pMixer->UpdateSpeed((float)Speed / 100);
   }
 
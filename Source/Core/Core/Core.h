@@ -109,6 +109,11 @@ bool IsGPUThread();
 
 bool WantsDeterminism();
 
+// Startup tracing. StartBootTrace marks the start of booting, TraceBootStep logs the time taken
+// since the previous step, and the time until the first frame is presented is logged once.
+void StartBootTrace();
+void TraceBootStep(std::string_view step);
+
 // [NOT THREADSAFE] For use by Host only
 void SetState(State state);
 State GetState();
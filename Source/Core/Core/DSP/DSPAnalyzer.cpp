@@ -60,6 +60,24 @@ constexpr u16 idle_skip_sigs[NUM_IDLE_SIGS][MAX_IDLE_SIG_SIZE + 1] = {
      0, 0},
 };
 
+// Wait loops longer than this (in words, including the branch) are not detected.
+constexpr u16 MAX_WAIT_LOOP_SIZE = 8;
+
+// Whether the given data address is a hardware register which only changes once the CPU
+// or a DMA does something, and which can be read without side effects.
+static bool IsPolledRegister(u16 address)
+{
+  switch (address)
+  {
+  case 0xff00 | DSP_DSCR:
+  case 0xff00 | DSP_DMBH:
+  case 0xff00 | DSP_CMBH:
+    return true;
+  default:
+    return false;
+  }
+}
+
 Analyzer::Analyzer() = default;
 Analyzer::~Analyzer() = default;
 
@@ -83,6 +101,7 @@ void Analyzer::AnalyzeRange(const SDSP& dsp, u16 start_addr, u16 end_addr)
 
   // Next, we'll scan for potential idle skips.
   FindIdleSkips(dsp, start_addr, end_addr);
+  FindWaitLoops(dsp, start_addr, end_addr);
 
   INFO_LOG_FMT(DSPLLE, "Finished analysis.");
 }
@@ -166,4 +185,59 @@ void Analyzer::FindIdleSkips(const SDSP& dsp, u16 start_addr, u16 end_addr)
     }
   }
 }
+
+void Analyzer::FindWaitLoops(const SDSP& dsp, u16 start_addr, u16 end_addr)
+{
+  for (u32 addr = start_addr; addr + 1 < end_addr; addr++)
+  {
+    // Look for conditional jumps (anything but JMP) backwards.
+    const UDSPInstruction inst = dsp.ReadIMEM(static_cast<u16>(addr));
+    if (!IsStartOfInstruction(static_cast<u16>(addr)) || (inst & 0xfff0) != 0x0290 ||
+        inst == 0x029f)
+    {
+      continue;
+    }
+    const u16 loop_start = dsp.ReadIMEM(static_cast<u16>(addr + 1));
+    if (loop_start < start_addr || loop_start > addr || addr + 2 - loop_start > MAX_WAIT_LOOP_SIZE)
+      continue;
+
+    // The loop may only load values and test them, and has to read a polled register.
+    bool only_polls = true;
+    bool reads_polled_register = false;
+    for (u32 i = loop_start; i < addr && only_polls;)
+    {
+      const UDSPInstruction loop_inst = dsp.ReadIMEM(static_cast<u16>(i));
+      const DSPOPCTemplate* opcode = GetOpTemplate(loop_inst);
+      if (!IsStartOfInstruction(static_cast<u16>(i)) || !opcode)
+      {
+        only_polls = false;
+        break;
+      }
+
+      if ((loop_inst & 0xffe0) == 0x00c0)  // LR
+      {
+        reads_polled_register |= IsPolledRegister(dsp.ReadIMEM(static_cast<u16>(i + 1)));
+      }
+      else if ((loop_inst & 0xf800) == 0x2000)  // LRS
+      {
+        reads_polled_register |= IsPolledRegister(0xff00 | (loop_inst & 0xff));
+      }
+      else
+      {
+        // ANDF, ANDCF, or TST and TSTAXH without an extended op
+        only_polls = (loop_inst & 0xfeff) == 0x02a0 || (loop_inst & 0xfeff) == 0x02c0 ||
+                     (((loop_inst & 0xf700) == 0xb100 || (loop_inst & 0xfe00) == 0x8600) &&
+                      (loop_inst & 0xfc) == 0);
+      }
+
+      i += opcode->size;
+    }
+
+    if (only_polls && reads_polled_register)
+    {
+      INFO_LOG_FMT(DSPLLE, "Wait loop found at {:04x}", loop_start);
+      m_code_flags[loop_start] |= CODE_IDLE_SKIP;
+    }
+  }
+}
 }  // namespace DSP
@@ -99,6 +99,12 @@ private:
   // Finds locations within the range [start_addr, end_addr) that may contain idle skips.
   void FindIdleSkips(const SDSP& dsp, u16 start_addr, u16 end_addr);
 
+  // Finds short loops within the range [start_addr, end_addr) which do nothing but poll
+  // the mailboxes or the DMA control register, and marks them as idle skips. Unlike the
+  // signatures used by FindIdleSkips, this doesn't depend on the exact registers and
+  // branch targets a ucode uses.
+  void FindWaitLoops(const SDSP& dsp, u16 start_addr, u16 end_addr);
+
   // Retrieves the flags set during analysis for code in memory.
   [[nodiscard]] u8 GetCodeFlags(u16 address) const { return m_code_flags[address]; }
 
@@ -47,7 +47,9 @@ void Interpreter::Step()
 {
   auto& state = m_dsp_core.DSPState();
 
-  m_dsp_core.CheckExceptions();
+  // Checked here so that the common case doesn't need any calls.
+  if (state.exceptions != 0)
+    state.CheckExceptions();
   state.AdvanceStepCounter();
 
   const u16 opc = state.FetchInstruction();
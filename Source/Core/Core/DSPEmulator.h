@@ -29,6 +29,9 @@ public:
   virtual void DSP_Update(int cycles) = 0;
   virtual void DSP_StopSoundStream() = 0;
   virtual u32 DSP_UpdateRate() = 0;
+  // Finishes any work the DSP emulator is doing in the background, so that the caller can access
+  // main RAM and ARAM.
+  virtual void DSP_Sync() = 0;
 
 protected:
   bool m_wii = false;
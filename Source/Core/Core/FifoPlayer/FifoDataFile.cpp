@@ -9,6 +9,7 @@
 #include <string>
 #include <vector>
 
+#include "Common/Hash.h"
 #include "Common/IOFile.h"
 #include "Common/MsgHandler.h"
 #include "Core/Config/MainSettings.h"
@@ -171,6 +172,7 @@ bool FifoDataFile::Save(const std::string& filename)
   file.WriteBytes(&header, sizeof(FileHeader));
 
   // Write frames list
+  WrittenDataMap written_data;
   for (unsigned int i = 0; i < m_Frames.size(); ++i)
   {
     const FifoFrameInfo& srcFrame = m_Frames[i];
@@ -180,7 +182,7 @@ bool FifoDataFile::Save(const std::string& filename)
     u64 dataOffset = file.Tell();
     file.WriteBytes(srcFrame.fifoData.data(), srcFrame.fifoData.size());
 
-    u64 memoryUpdatesOffset = WriteMemoryUpdates(srcFrame.memoryUpdates, file);
+    u64 memoryUpdatesOffset = WriteMemoryUpdates(srcFrame.memoryUpdates, file, written_data);
 
     FileFrameInfo dstFrame;
     dstFrame.fifoDataSize = static_cast<u32>(srcFrame.fifoData.size());
@@ -343,7 +345,7 @@ bool FifoDataFile::GetFlag(u32 flag) const
 }
 
 u64 FifoDataFile::WriteMemoryUpdates(const std::vector<MemoryUpdate>& memUpdates,
-                                     File::IOFile& file)
+                                     File::IOFile& file, WrittenDataMap& written_data)
 {
   // Add space for memory update list
   u64 updateListOffset = file.Tell();
@@ -353,10 +355,26 @@ u64 FifoDataFile::WriteMemoryUpdates(const std::vector<MemoryUpdate>& memUpdates
   {
     const MemoryUpdate& srcUpdate = memUpdates[i];
 
-    // Write memory
-    file.Seek(0, SEEK_END);
-    u64 dataOffset = file.Tell();
-    file.WriteBytes(srcUpdate.data.data(), srcUpdate.data.size());
+    // Write memory, unless the same data has been written before. Loaders only follow
+    // dataOffset, so sharing it between updates doesn't need a new file version.
+    const u64 hash =
+        Common::GetHash64(srcUpdate.data.data(), static_cast<u32>(srcUpdate.data.size()), 0);
+    const auto [begin, end] = written_data.equal_range(hash);
+    const auto existing = std::find_if(
+        begin, end, [&](const auto& entry) { return *entry.second.data == srcUpdate.data; });
+
+    u64 dataOffset;
+    if (existing != end)
+    {
+      dataOffset = existing->second.offset;
+    }
+    else
+    {
+      file.Seek(0, SEEK_END);
+      dataOffset = file.Tell();
+      file.WriteBytes(srcUpdate.data.data(), srcUpdate.data.size());
+      written_data.emplace(hash, WrittenData{&srcUpdate.data, dataOffset});
+    }
 
     FileMemoryUpdate dstUpdate;
     dstUpdate.address = srcUpdate.address;
@@ -5,6 +5,7 @@
 
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "Common/CommonTypes.h"
@@ -89,7 +90,17 @@ private:
   void SetFlag(u32 flag, bool set);
   bool GetFlag(u32 flag) const;
 
-  u64 WriteMemoryUpdates(const std::vector<MemoryUpdate>& memUpdates, File::IOFile& file);
+  // Memory update data already written to the file, keyed by a hash of its contents. Identical
+  // data (e.g. a texture that gets reuploaded every frame) is only stored once.
+  struct WrittenData
+  {
+    const std::vector<u8>* data;
+    u64 offset;
+  };
+  using WrittenDataMap = std::unordered_multimap<u64, WrittenData>;
+
+  u64 WriteMemoryUpdates(const std::vector<MemoryUpdate>& memUpdates, File::IOFile& file,
+                         WrittenDataMap& written_data);
   static void ReadMemoryUpdates(u64 fileOffset, u32 numUpdates,
                                 std::vector<MemoryUpdate>& memUpdates, File::IOFile& file);
 
@@ -132,6 +132,9 @@ CPU::State FifoPlayer::AdvanceFrame()
 {
   if (m_CurrentFrame > m_FrameRangeEnd)
   {
+    if (m_LoopCompletedCb)
+      m_LoopCompletedCb();
+
     if (!m_Loop)
       return CPU::State::PowerDown;
 
@@ -96,6 +96,9 @@ public:
   // Callbacks
   void SetFileLoadedCallback(CallbackFunc callback);
   void SetFrameWrittenCallback(CallbackFunc callback) { m_FrameWrittenCb = std::move(callback); }
+  // Called on the CPU thread each time the last frame of the frame range has been written,
+  // before playback either loops back to the start of the range or stops.
+  void SetLoopCompletedCallback(CallbackFunc callback) { m_LoopCompletedCb = std::move(callback); }
   static FifoPlayer& GetInstance();
 
   bool IsRunningWithFakeVideoInterfaceUpdates() const;
@@ -157,6 +160,7 @@ private:
 
   CallbackFunc m_FileLoadedCb = nullptr;
   CallbackFunc m_FrameWrittenCb = nullptr;
+  CallbackFunc m_LoopCompletedCb = nullptr;
 
   std::unique_ptr<FifoDataFile> m_File;
 
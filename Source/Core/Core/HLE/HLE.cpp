@@ -9,8 +9,11 @@
 
 #include "Common/CommonTypes.h"
 
+#include "Common/Config/Config.h"
+#include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
 #include "Core/GeckoCode.h"
+#include "Core/HLE/HLE_Memory.h"
 #include "Core/HLE/HLE_Misc.h"
 #include "Core/HLE/HLE_OS.h"
 #include "Core/HW/Memmap.h"
@@ -24,7 +27,7 @@ namespace HLE
 static std::map<u32, u32> s_hooked_addresses;
 
 // clang-format off
-constexpr std::array<Hook, 23> os_patches{{
+constexpr std::array<Hook, 28> os_patches{{
     // Placeholder, os_patches[0] is the "non-existent function" index
     {"FAKE_TO_SKIP_0",               HLE_Misc::UnimplementedFunction,       HookType::Replace, HookFlag::Generic},
 
@@ -54,6 +57,13 @@ constexpr std::array<Hook, 23> os_patches{{
     {"___blank",                     HLE_OS::HLE_GeneralDebugPrint,         HookType::Start,   HookFlag::Debug}, // used for early init things (normally)
     {"__write_console",              HLE_OS::HLE_write_console,             HookType::Start,   HookFlag::Debug}, // used by sysmenu (+more?)
 
+    // Performance
+    {"memcpy",                       HLE_Memory::Memcpy,                    HookType::Replace, HookFlag::Performance},
+    {"memset",                       HLE_Memory::Memset,                    HookType::Replace, HookFlag::Performance},
+    {"DCFlushRange",                 HLE_Memory::DCFlushRange,              HookType::Replace, HookFlag::Performance},
+    {"DCInvalidateRange",            HLE_Memory::DCInvalidateRange,         HookType::Replace, HookFlag::Performance},
+    {"DCStoreRange",                 HLE_Memory::DCStoreRange,              HookType::Replace, HookFlag::Performance},
+
     {"GeckoCodehandler",             HLE_Misc::GeckoCodeHandlerICacheFlush, HookType::Start,   HookFlag::Fixed},
     {"GeckoHandlerReturnTrampoline", HLE_Misc::GeckoReturnTrampoline,       HookType::Replace, HookFlag::Fixed},
     {"AppLoaderReport",              HLE_OS::HLE_GeneralDebugPrint,         HookType::Replace, HookFlag::Fixed} // apploader needs OSReport-like function
@@ -187,6 +197,10 @@ HookFlag GetHookFlagsByIndex(u32 index)
 
 bool IsEnabled(HookFlag flag)
 {
+  // The performance replacements access memory directly, which wouldn't raise DSI exceptions.
+  if (flag == HLE::HookFlag::Performance)
+    return Config::Get(Config::MAIN_PERFORMANCE_HLE) && !SConfig::GetInstance().bMMU;
+
   return flag != HLE::HookFlag::Debug || SConfig::GetInstance().bEnableDebugging ||
          PowerPC::GetMode() == PowerPC::CoreMode::Interpreter;
 }
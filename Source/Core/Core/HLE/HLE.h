@@ -20,9 +20,10 @@ enum class HookType
 
 enum class HookFlag
 {
-  Generic,  // Miscellaneous function
-  Debug,    // Debug output function
-  Fixed,    // An arbitrary hook mapped to a fixed address instead of a symbol
+  Generic,      // Miscellaneous function
+  Debug,        // Debug output function
+  Fixed,        // An arbitrary hook mapped to a fixed address instead of a symbol
+  Performance,  // Native replacement for a hot function, only used when enabled in the config
 };
 
 struct Hook
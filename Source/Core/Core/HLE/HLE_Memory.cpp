@@ -0,0 +1,145 @@
+// Copyright 2021 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/HLE/HLE_Memory.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#include "Common/CommonTypes.h"
+#include "Core/HW/Memmap.h"
+#include "Core/PowerPC/JitInterface.h"
+#include "Core/PowerPC/MMU.h"
+#include "Core/PowerPC/PowerPC.h"
+
+namespace HLE_Memory
+{
+// Rough number of cycles the replaced guest loops take, which is charged instead so that the rest
+// of the system still sees time pass. The SDK versions differ, so this can't be exact.
+constexpr s32 CYCLES_PER_COPIED_WORD = 3;
+constexpr s32 CYCLES_PER_SET_WORD = 2;
+constexpr s32 CYCLES_PER_CACHE_LINE = 3;
+
+static void ChargeCycles(u32 count, s32 cycles_per_count)
+{
+  const u32 max_count = static_cast<u32>(std::numeric_limits<s32>::max() / cycles_per_count);
+  PowerPC::ppcState.downcount -= static_cast<s32>(std::min(count, max_count)) * cycles_per_count;
+}
+
+// Returns a host pointer to a range of guest memory if all of it is RAM which can be accessed
+// directly, that is without memory checks, page table lookups or MMIO. Otherwise, returns nullptr.
+static u8* GetRAMRangePointer(u32 address, u32 size)
+{
+  if (size == 0 || address > std::numeric_limits<u32>::max() - (size - 1))
+    return nullptr;
+
+  const u32 last_address = address + size - 1;
+  u32 physical_address = address;
+  if (!PowerPC::IsOptimizableRAMAddress(address) ||
+      !PowerPC::TranslateBatAddess(PowerPC::dbat_table, &physical_address))
+  {
+    return nullptr;
+  }
+
+  // The BAT pages in the range have to be mapped to contiguous RAM as well.
+  for (u32 page = (address >> PowerPC::BAT_INDEX_SHIFT) + 1;
+       page <= (last_address >> PowerPC::BAT_INDEX_SHIFT); page++)
+  {
+    const u32 page_address = page << PowerPC::BAT_INDEX_SHIFT;
+    u32 page_physical_address = page_address;
+    if (!PowerPC::IsOptimizableRAMAddress(page_address) ||
+        !PowerPC::TranslateBatAddess(PowerPC::dbat_table, &page_physical_address) ||
+        page_physical_address - physical_address != page_address - address)
+    {
+      return nullptr;
+    }
+  }
+
+  return Memory::GetPointer(physical_address);
+}
+
+void Memcpy()
+{
+  const u32 dest = GPR(3);
+  const u32 src = GPR(4);
+  const u32 size = GPR(5);
+
+  u8* const dest_ptr = GetRAMRangePointer(dest, size);
+  const u8* const src_ptr = GetRAMRangePointer(src, size);
+  if (dest_ptr && src_ptr)
+  {
+    // The SDK's memcpy copies backwards when the destination is after the source, so overlapping
+    // copies behave like memmove.
+    std::memmove(dest_ptr, src_ptr, size);
+  }
+  else if (dest > src && dest - src < size)
+  {
+    for (u32 i = size; i > 0; i--)
+      PowerPC::Write_U8(PowerPC::Read_U8(src + i - 1), dest + i - 1);
+  }
+  else
+  {
+    for (u32 i = 0; i < size; i++)
+      PowerPC::Write_U8(PowerPC::Read_U8(src + i), dest + i);
+  }
+
+  ChargeCycles(size / 4, CYCLES_PER_COPIED_WORD);
+  // memcpy returns the destination, which is still in r3.
+  NPC = LR;
+}
+
+void Memset()
+{
+  const u32 dest = GPR(3);
+  const u8 value = static_cast<u8>(GPR(4));
+  const u32 size = GPR(5);
+
+  if (u8* const dest_ptr = GetRAMRangePointer(dest, size))
+  {
+    std::memset(dest_ptr, value, size);
+  }
+  else
+  {
+    for (u32 i = 0; i < size; i++)
+      PowerPC::Write_U8(value, dest + i);
+  }
+
+  ChargeCycles(size / 4, CYCLES_PER_SET_WORD);
+  // memset returns the destination, which is still in r3.
+  NPC = LR;
+}
+
+// The data cache isn't emulated, so these only do what dcbf, dcbi and dcbst do for every line in
+// the range, which is invalidating the JIT cache to make up for the lack of icache emulation.
+static void InvalidateCacheLines()
+{
+  const u32 address = GPR(3);
+  const u32 size = GPR(4);
+
+  if (size != 0)
+  {
+    const u32 start = address & ~31;
+    const u32 num_lines = static_cast<u32>((u64{address & 31} + size + 31) / 32);
+    JitInterface::InvalidateICache(start, num_lines * 32, false);
+    ChargeCycles(num_lines, CYCLES_PER_CACHE_LINE);
+  }
+
+  NPC = LR;
+}
+
+void DCFlushRange()
+{
+  InvalidateCacheLines();
+}
+
+void DCInvalidateRange()
+{
+  InvalidateCacheLines();
+}
+
+void DCStoreRange()
+{
+  InvalidateCacheLines();
+}
+}  // namespace HLE_Memory
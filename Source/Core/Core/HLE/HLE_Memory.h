@@ -0,0 +1,15 @@
+// Copyright 2021 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// Native replacements for SDK memory and cache routines which games spend a lot of time in.
+// Their results are identical to the guest code they replace.
+namespace HLE_Memory
+{
+void Memcpy();
+void Memset();
+void DCFlushRange();
+void DCInvalidateRange();
+void DCStoreRange();
+}  // namespace HLE_Memory
@@ -48,6 +48,7 @@ This file mainly deals with the [Drive I/F], however [AIDFR] controls
 #include "Core/HW/ProcessorInterface.h"
 #include "Core/HW/SystemTimers.h"
 #include "Core/PowerPC/PowerPC.h"
+#include "Core/System.h"
 
 namespace AudioInterface
 {
@@ -126,7 +127,8 @@ void DoState(PointerWrap& p)
   p.Do(s_aid_sample_rate);
   p.Do(s_cpu_cycles_per_sample);
 
-  g_sound_stream->GetMixer()->DoState(p);
+  SoundStream* sound_stream = Core::System::GetInstance().GetSoundStream();
+  sound_stream->GetMixer()->DoState(p);
 }
 
 static void GenerateAudioInterrupt();
@@ -154,8 +156,9 @@ void Init()
 
   event_type_ai = CoreTiming::RegisterEvent("AICallback", Update);
 
-  g_sound_stream->GetMixer()->SetDMAInputSampleRate(GetAIDSampleRate());
-  g_sound_stream->GetMixer()->SetStreamInputSampleRate(GetAISSampleRate());
+  SoundStream* sound_stream = Core::System::GetInstance().GetSoundStream();
+  sound_stream->GetMixer()->SetDMAInputSampleRate(GetAIDSampleRate());
+  sound_stream->GetMixer()->SetStreamInputSampleRate(GetAISSampleRate());
 }
 
 void Shutdown()
@@ -189,7 +192,8 @@ void RegisterMMIO(MMIO::Mapping* mmio, u32 base)
                         tmp_ai_ctrl.AISFR ? "48khz" : "32khz");
           s_control.AISFR = tmp_ai_ctrl.AISFR;
           s_ais_sample_rate = tmp_ai_ctrl.AISFR ? Get48KHzSampleRate() : Get32KHzSampleRate();
-          g_sound_stream->GetMixer()->SetStreamInputSampleRate(s_ais_sample_rate);
+          SoundStream* sound_stream = Core::System::GetInstance().GetSoundStream();
+          sound_stream->GetMixer()->SetStreamInputSampleRate(s_ais_sample_rate);
           s_cpu_cycles_per_sample = SystemTimers::GetTicksPerSecond() / s_ais_sample_rate;
         }
         // Set frequency of DMA
@@ -199,7 +203,8 @@ void RegisterMMIO(MMIO::Mapping* mmio, u32 base)
                         tmp_ai_ctrl.AIDFR ? "32khz" : "48khz");
           s_control.AIDFR = tmp_ai_ctrl.AIDFR;
           s_aid_sample_rate = tmp_ai_ctrl.AIDFR ? Get32KHzSampleRate() : Get48KHzSampleRate();
-          g_sound_stream->GetMixer()->SetDMAInputSampleRate(s_aid_sample_rate);
+          SoundStream* sound_stream = Core::System::GetInstance().GetSoundStream();
+          sound_stream->GetMixer()->SetDMAInputSampleRate(s_aid_sample_rate);
         }
 
         // Streaming counter
@@ -236,7 +241,8 @@ void RegisterMMIO(MMIO::Mapping* mmio, u32 base)
   mmio->Register(base | AI_VOLUME_REGISTER, MMIO::DirectRead<u32>(&s_volume.hex),
                  MMIO::ComplexWrite<u32>([](u32, u32 val) {
                    s_volume.hex = val;
-                   g_sound_stream->GetMixer()->SetStreamingVolume(s_volume.left, s_volume.right);
+                   SoundStream* sound_stream = Core::System::GetInstance().GetSoundStream();
+                   sound_stream->GetMixer()->SetStreamingVolume(s_volume.left, s_volume.right);
                  }));
 
   mmio->Register(base | AI_SAMPLE_COUNTER, MMIO::ComplexRead<u32>([](u32) {
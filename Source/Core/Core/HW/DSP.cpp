@@ -29,6 +29,7 @@
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/MemoryUtil.h"
+#include "Common/Profiler.h"
 #include "Core/ConfigManager.h"
 #include "Core/CoreTiming.h"
 #include "Core/DSPEmulator.h"
@@ -165,6 +166,7 @@ static void GenerateDSPInterrupt(u64 DSPIntType, s64 cyclesLate = 0);
 
 static CoreTiming::EventType* s_et_GenerateDSPInterrupt;
 static CoreTiming::EventType* s_et_CompleteARAM;
+static CoreTiming::EventType* s_et_UpdateDSP;
 
 static void CompleteARAM(u64 userdata, s64 cyclesLate)
 {
@@ -172,6 +174,11 @@ static void CompleteARAM(u64 userdata, s64 cyclesLate)
   GenerateDSPInterrupt(INT_ARAM);
 }
 
+static void UpdateDSP(u64 userdata, s64 cyclesLate)
+{
+  s_dsp_emulator->DSP_Update(0);
+}
+
 DSPEmulator* GetDSPEmulator()
 {
   return s_dsp_emulator.get();
@@ -182,6 +189,7 @@ void Init(bool hle)
   Reinit(hle);
   s_et_GenerateDSPInterrupt = CoreTiming::RegisterEvent("DSPint", GenerateDSPInterrupt);
   s_et_CompleteARAM = CoreTiming::RegisterEvent("ARAMint", CompleteARAM);
+  s_et_UpdateDSP = CoreTiming::RegisterEvent("DSPUpdate", UpdateDSP);
 }
 
 void Reinit(bool hle)
@@ -447,9 +455,16 @@ void GenerateDSPInterruptFromDSPEmu(DSPInterruptType type, int cycles_into_futur
                             CoreTiming::FromThread::ANY);
 }
 
+void ScheduleDSPUpdate(int cycles_into_future)
+{
+  CoreTiming::ScheduleEvent(cycles_into_future, s_et_UpdateDSP);
+}
+
 // called whenever SystemTimers thinks the DSP deserves a few more cycles
 void UpdateDSPSlice(int cycles)
 {
+  PROFILE("DSP::UpdateDSPSlice");
+
   if (s_dsp_is_lle)
   {
     // use up the rest of the slice(if any)
@@ -500,8 +515,18 @@ void UpdateAudioDMA()
   }
 }
 
+// Returns whether [address, address + size) lies entirely within main RAM (MEM1), where
+// emulated addresses map linearly to host memory.
+static bool IsContiguousMainRAMRange(u32 address, u32 size)
+{
+  const u32 ram_size = Memory::GetRamSizeReal();
+  return address < ram_size && size <= ram_size - address;
+}
+
 static void Do_ARAM_DMA()
 {
+  s_dsp_emulator->DSP_Sync();
+
   s_dspState.DMAState = 1;
 
   // ARAM DMA transfer rate has been measured on real hw
@@ -521,6 +546,17 @@ static void Do_ARAM_DMA()
 
     if (s_arDMA.ARAddr < s_ARAM.size)
     {
+      // The loop below only moves bytes around, so a transfer that doesn't wrap around the end
+      // of ARAM and stays inside main RAM can be done in one go.
+      const u32 count = s_arDMA.Cnt.count;
+      if (count <= s_ARAM.size - s_arDMA.ARAddr && IsContiguousMainRAMRange(s_arDMA.MMAddr, count))
+      {
+        Memory::CopyToEmu(s_arDMA.MMAddr, &s_ARAM.ptr[s_arDMA.ARAddr], count);
+        s_arDMA.MMAddr += count;
+        s_arDMA.ARAddr += count;
+        s_arDMA.Cnt.count = 0;
+      }
+
       while (s_arDMA.Cnt.count)
       {
         // These are logically separated in code to show that a memory map has been set up
@@ -547,6 +583,15 @@ static void Do_ARAM_DMA()
     {
       // Assuming no external ARAM installed; returns zeros on out of bounds reads (verified on real
       // HW)
+      const u32 count = s_arDMA.Cnt.count;
+      if (IsContiguousMainRAMRange(s_arDMA.MMAddr, count))
+      {
+        Memory::Memset(s_arDMA.MMAddr, 0, count);
+        s_arDMA.MMAddr += count;
+        s_arDMA.ARAddr += count;
+        s_arDMA.Cnt.count = 0;
+      }
+
       while (s_arDMA.Cnt.count)
       {
         Memory::Write_U64(0, s_arDMA.MMAddr);
@@ -568,6 +613,17 @@ static void Do_ARAM_DMA()
 
     if (s_arDMA.ARAddr < s_ARAM.size)
     {
+      // Mode 4 mirrors the low 4MB, which the loop below takes care of.
+      const u32 count = s_arDMA.Cnt.count;
+      if ((s_ARAM_Info.Hex & 0xf) != 4 && count <= s_ARAM.size - s_arDMA.ARAddr &&
+          IsContiguousMainRAMRange(s_arDMA.MMAddr, count))
+      {
+        Memory::CopyFromEmu(&s_ARAM.ptr[s_arDMA.ARAddr], s_arDMA.MMAddr, count);
+        s_arDMA.MMAddr += count;
+        s_arDMA.ARAddr += count;
+        s_arDMA.Cnt.count = 0;
+      }
+
       while (s_arDMA.Cnt.count)
       {
         if ((s_ARAM_Info.Hex & 0xf) == 3)
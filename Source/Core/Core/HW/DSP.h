@@ -71,6 +71,10 @@ void DoState(PointerWrap& p);
 // TODO: Maybe rethink this? The timing is unpredictable.
 void GenerateDSPInterruptFromDSPEmu(DSPInterruptType type, int cycles_into_future = 0);
 
+// Calls DSP_Update on the DSP emulator from the CPU thread cycles_into_future cycles from now,
+// giving a threaded DSP emulator a deterministic point in time to sync at.
+void ScheduleDSPUpdate(int cycles_into_future);
+
 // Audio/DSP Helper
 u8 ReadARAM(u32 address);
 void WriteARAM(u8 value, u32 address);
@@ -6,7 +6,9 @@
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/MsgHandler.h"
+#include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
+#include "Core/CoreTiming.h"
 #include "Core/HW/DSPHLE/UCodes/UCodes.h"
 #include "Core/HW/SystemTimers.h"
 
@@ -30,6 +32,9 @@ bool DSPHLE::Initialize(bool wii, bool dsp_thread)
 
   m_dsp_state.Reset();
 
+  if (Config::Get(Config::MAIN_DSP_HLE_THREAD))
+    m_thread.Start(1, "DSP HLE thread");
+
   return true;
 }
 
@@ -39,11 +44,15 @@ void DSPHLE::DSP_StopSoundStream()
 
 void DSPHLE::Shutdown()
 {
+  WaitForAsyncWork();
+  m_thread.Stop();
   m_ucode = nullptr;
 }
 
 void DSPHLE::DSP_Update(int cycles)
 {
+  WaitForAsyncWork();
+
   if (m_ucode != nullptr)
     m_ucode->Update();
 }
@@ -55,8 +64,50 @@ u32 DSPHLE::DSP_UpdateRate()
   return SystemTimers::GetTicksPerSecond() / 1000;
 }
 
+void DSPHLE::DSP_Sync()
+{
+  WaitForAsyncWork();
+}
+
+bool DSPHLE::CanRunAsync() const
+{
+  return m_thread.IsRunning() && !Core::WantsDeterminism();
+}
+
+void DSPHLE::RunAsync(std::function<void()> work, std::function<void()> on_done, int sync_cycles)
+{
+  WaitForAsyncWork();
+
+  if (!CanRunAsync())
+  {
+    work();
+    on_done();
+    return;
+  }
+
+  m_mail_handler.HoldBackMails();
+  m_async_work_start = CoreTiming::GetTicks();
+  m_async_work_done = std::move(on_done);
+  m_async_work = m_thread.Submit(std::move(work));
+  DSP::ScheduleDSPUpdate(sync_cycles);
+}
+
+void DSPHLE::WaitForAsyncWork()
+{
+  if (!m_async_work.valid())
+    return;
+
+  m_async_work.get();
+  const std::function<void()> on_done = std::move(m_async_work_done);
+  m_async_work_done = nullptr;
+  on_done();
+  m_mail_handler.ReleaseMails(static_cast<int>(CoreTiming::GetTicks() - m_async_work_start));
+}
+
 void DSPHLE::SendMailToDSP(u32 mail)
 {
+  WaitForAsyncWork();
+
   if (m_ucode != nullptr)
   {
     DEBUG_LOG_FMT(DSP_MAIL, "CPU writes {:#010x}", mail);
@@ -93,6 +144,8 @@ void DSPHLE::SwapUCode(u32 crc)
 
 void DSPHLE::DoState(PointerWrap& p)
 {
+  WaitForAsyncWork();
+
   bool is_hle = true;
   p.Do(is_hle);
   if (!is_hle && p.GetMode() == PointerWrap::MODE_READ)
@@ -136,6 +189,8 @@ void DSPHLE::DoState(PointerWrap& p)
 // Mailbox functions
 u16 DSPHLE::DSP_ReadMailBoxHigh(bool cpu_mailbox)
 {
+  WaitForAsyncWork();
+
   if (cpu_mailbox)
   {
     return (m_dsp_state.cpu_mailbox >> 16) & 0xFFFF;
@@ -148,6 +203,8 @@ u16 DSPHLE::DSP_ReadMailBoxHigh(bool cpu_mailbox)
 
 u16 DSPHLE::DSP_ReadMailBoxLow(bool cpu_mailbox)
 {
+  WaitForAsyncWork();
+
   if (cpu_mailbox)
   {
     return m_dsp_state.cpu_mailbox & 0xFFFF;
@@ -188,6 +245,8 @@ void DSPHLE::DSP_WriteMailBoxLow(bool cpu_mailbox, u16 value)
 // Other DSP functions
 u16 DSPHLE::DSP_WriteControlRegister(u16 value)
 {
+  WaitForAsyncWork();
+
   DSP::UDSPControl temp(value);
 
   if (temp.DSPReset)
@@ -3,9 +3,12 @@
 
 #pragma once
 
+#include <functional>
+#include <future>
 #include <memory>
 
 #include "Common/CommonTypes.h"
+#include "Common/WorkerPool.h"
 #include "Core/DSPEmulator.h"
 #include "Core/HW/DSP.h"
 #include "Core/HW/DSPHLE/MailHandler.h"
@@ -37,13 +40,25 @@ public:
   void DSP_Update(int cycles) override;
   void DSP_StopSoundStream() override;
   u32 DSP_UpdateRate() override;
+  void DSP_Sync() override;
 
   CMailHandler& AccessMailHandler() { return m_mail_handler; }
   void SetUCode(u32 crc);
   void SwapUCode(u32 crc);
 
+  // Whether RunAsync actually runs work on the DSP HLE thread.
+  bool CanRunAsync() const;
+
+  // Runs work on the DSP HLE thread if it is enabled, or right away otherwise. The CPU thread
+  // waits for the work whenever it accesses the DSP or ARAM, or sync_cycles cycles from now at the
+  // latest, and then calls on_done. The work must not touch main RAM or anything else the CPU
+  // thread can access in the meantime; that belongs in on_done, which must not call RunAsync.
+  // Mails pushed by on_done are delivered as if they were pushed when RunAsync was called.
+  void RunAsync(std::function<void()> work, std::function<void()> on_done, int sync_cycles);
+
 private:
   void SendMailToDSP(u32 mail);
+  void WaitForAsyncWork();
 
   // Fake mailbox utility
   struct DSPState
@@ -69,5 +84,10 @@ private:
 
   bool m_halt;
   bool m_assert_interrupt;
+
+  Common::WorkerPool m_thread;
+  std::future<void> m_async_work;
+  std::function<void()> m_async_work_done;
+  u64 m_async_work_start = 0;
 };
 }  // namespace DSP::HLE
@@ -3,6 +3,7 @@
 
 #include "Core/HW/DSPHLE/MailHandler.h"
 
+#include <algorithm>
 #include <queue>
 
 #include "Common/ChunkFile.h"
@@ -24,6 +25,12 @@ CMailHandler::~CMailHandler()
 
 void CMailHandler::PushMail(u32 mail, bool interrupt, int cycles_into_future)
 {
+  if (m_holding_back_mails)
+  {
+    m_held_back_mails.push_back({mail, interrupt, cycles_into_future});
+    return;
+  }
+
   if (interrupt)
   {
     if (m_Mails.empty())
@@ -80,6 +87,19 @@ bool CMailHandler::IsEmpty() const
   return m_Mails.empty();
 }
 
+void CMailHandler::HoldBackMails()
+{
+  m_holding_back_mails = true;
+}
+
+void CMailHandler::ReleaseMails(int cycles_ago)
+{
+  m_holding_back_mails = false;
+  for (const HeldBackMail& held : m_held_back_mails)
+    PushMail(held.mail, held.interrupt, std::max(held.cycles_into_future - cycles_ago, 0));
+  m_held_back_mails.clear();
+}
+
 void CMailHandler::Halt(bool _Halt)
 {
   if (_Halt)
@@ -5,6 +5,7 @@
 
 #include <queue>
 #include <utility>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 
@@ -25,11 +26,28 @@ public:
   void DoState(PointerWrap& p);
   bool IsEmpty() const;
 
+  // While mails are held back, PushMail only records them without touching the mailbox or
+  // generating interrupts, so that it can be called from the DSP HLE thread.
+  void HoldBackMails();
+  // Pushes the mails held back since HoldBackMails, as if they had been pushed cycles_ago cycles
+  // ago, and stops holding back mails.
+  void ReleaseMails(int cycles_ago);
+
   u16 ReadDSPMailboxHigh();
   u16 ReadDSPMailboxLow();
 
 private:
+  struct HeldBackMail
+  {
+    u32 mail;
+    bool interrupt;
+    int cycles_into_future;
+  };
+
   // mail handler
   std::queue<std::pair<u32, bool>> m_Mails;
+
+  bool m_holding_back_mails = false;
+  std::vector<HeldBackMail> m_held_back_mails;
 };
 }  // namespace DSP::HLE
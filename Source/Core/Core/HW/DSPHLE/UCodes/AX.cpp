@@ -13,6 +13,9 @@
 #include "Common/IOFile.h"
 #include "Common/Logging/Log.h"
 #include "Common/Swap.h"
+#include "Core/Config/MainSettings.h"
+#include "Core/ConfigManager.h"
+#include "Core/Core.h"
 #include "Core/HW/DSP.h"
 #include "Core/HW/DSPHLE/DSPHLE.h"
 #include "Core/HW/DSPHLE/MailHandler.h"
@@ -74,36 +77,45 @@ void AXUCode::LoadResamplingCoefficients()
   m_coeffs_available = true;
 }
 
-void AXUCode::SignalWorkEnd()
-{
-  // Signal end of processing
-  // TODO: figure out how many cycles this is actually supposed to take
+// TODO: figure out how many cycles this is actually supposed to take
 
-  // The Clone Wars hangs upon initial boot if this interrupt happens too quickly after submitting a
-  // command list. When played in DSP-LLE, the interrupt lags by about 160,000 cycles, though any
-  // value greater than or equal to 814 will work here. In other games, the lag can be as small as
-  // 50,000 cycles (in Metroid Prime) and as large as 718,092 cycles (in Tales of Symphonia!).
+// The Clone Wars hangs upon initial boot if this interrupt happens too quickly after submitting a
+// command list. When played in DSP-LLE, the interrupt lags by about 160,000 cycles, though any
+// value greater than or equal to 814 will work here. In other games, the lag can be as small as
+// 50,000 cycles (in Metroid Prime) and as large as 718,092 cycles (in Tales of Symphonia!).
 
-  // On the PowerPC side, hthh_ discovered that The Clone Wars tracks a "AXCommandListCycles"
-  // variable which matches the aforementioned 160,000 cycles. It's initialized to ~2500 cycles for
-  // a minimal, empty command list, so that should be a safe number for pretty much anything a game
-  // does.
+// On the PowerPC side, hthh_ discovered that The Clone Wars tracks a "AXCommandListCycles"
+// variable which matches the aforementioned 160,000 cycles. It's initialized to ~2500 cycles for
+// a minimal, empty command list, so that should be a safe number for pretty much anything a game
+// does.
 
-  // For more information, see https://bugs.dolphin-emu.org/issues/10265.
-  constexpr int AX_EMPTY_COMMAND_LIST_CYCLES = 2500;
+// For more information, see https://bugs.dolphin-emu.org/issues/10265.
+constexpr int AX_EMPTY_COMMAND_LIST_CYCLES = 2500;
 
+void AXUCode::SignalWorkEnd()
+{
+  // Signal end of processing
   m_mail_handler.PushMail(DSP_YIELD, true, AX_EMPTY_COMMAND_LIST_CYCLES);
 }
 
+void AXUCode::EndCommandList()
+{
+  m_cmdlist_size = 0;
+  SignalWorkEnd();
+}
+
 void AXUCode::HandleCommandList()
+{
+  RunCommandList(0, 0, true);
+}
+
+void AXUCode::RunCommandList(u32 curr_idx, u32 pb_addr, bool allow_async)
 {
   // Temp variables for addresses computation
   u16 addr_hi, addr_lo;
   u16 addr2_hi, addr2_lo;
   u16 size;
 
-  u32 pb_addr = 0;
-
 #if 0
 	INFO_LOG_FMT(DSPHLE, "Command list:");
 	for (u32 i = 0; m_cmdlist[i] != CMD_END; ++i)
@@ -111,7 +123,6 @@ void AXUCode::HandleCommandList()
 	INFO_LOG_FMT(DSPHLE, "-------------");
 #endif
 
-  u32 curr_idx = 0;
   bool end = false;
   while (!end)
   {
@@ -146,6 +157,11 @@ void AXUCode::HandleCommandList()
       break;
 
     case CMD_PROCESS:
+      if (allow_async && m_dsphle->CanRunAsync())
+      {
+        ProcessPBListAsync(pb_addr, curr_idx);
+        return;
+      }
       ProcessPBList(pb_addr);
       break;
 
@@ -276,6 +292,8 @@ void AXUCode::HandleCommandList()
       break;
     }
   }
+
+  EndCommandList();
 }
 
 AXMixControl AXUCode::ConvertMixerControl(u32 mixer_control)
@@ -408,39 +426,102 @@ void AXUCode::DownloadAndMixWithVolume(u32 addr, u16 vol_main, u16 vol_auxa, u16
   }
 }
 
+bool AXUCode::ShouldSkipMixing() const
+{
+  // The mixed samples end up in memory the game can read, so this isn't deterministic.
+  if (!Config::Get(Config::MAIN_DSP_HLE_FAST_FORWARD_SKIP_MIXING) || Core::WantsDeterminism())
+    return false;
+
+  return Core::GetIsThrottlerTempDisabled() || SConfig::GetInstance().m_EmulationSpeed <= 0.0f;
+}
+
 void AXUCode::ProcessPBList(u32 pb_addr)
 {
-  // Samples per millisecond. In theory DSP sampling rate can be changed from
-  // 32KHz to 48KHz, but AX always process at 32KHz.
-  constexpr u32 spms = 32;
+  // Without buffers, the voices only advance their state and the output stays silent.
+  const bool skip_mixing = ShouldSkipMixing();
 
   AXPB pb;
 
   while (pb_addr)
   {
-    AXBuffers buffers = {{m_samples_left, m_samples_right, m_samples_surround, m_samples_auxA_left,
-                          m_samples_auxA_right, m_samples_auxA_surround, m_samples_auxB_left,
-                          m_samples_auxB_right, m_samples_auxB_surround}};
-
     ReadPB(pb_addr, pb, m_crc);
 
     u32 updates_addr = HILO_TO_32(pb.updates.data);
     u16* updates = (u16*)HLEMemory_Get_Pointer(updates_addr);
 
-    for (int curr_ms = 0; curr_ms < 5; ++curr_ms)
+    ProcessPB(pb, updates, skip_mixing);
+
+    WritePB(pb_addr, pb, m_crc);
+    pb_addr = HILO_TO_32(pb.next_pb);
+  }
+}
+
+void AXUCode::ProcessPBListAsync(u32 pb_addr, u32 next_idx)
+{
+  // The mixing only reads ARAM, which the CPU can't access without syncing with the DSP HLE
+  // thread first. Everything in main RAM is read here and written back once the mixing is done.
+  const u32 first_pb_addr = pb_addr;
+  m_queued_pbs.clear();
+  while (pb_addr)
+  {
+    QueuedPB& queued = m_queued_pbs.emplace_back();
+    queued.addr = pb_addr;
+    ReadPB(pb_addr, queued.pb, m_crc);
+
+    u32 num_updates = 0;
+    for (u16 updates_for_ms : queued.pb.updates.num_updates)
+      num_updates += updates_for_ms;
+    if (num_updates != 0)
     {
-      ApplyUpdatesForMs(curr_ms, pb, pb.updates.num_updates, updates);
+      const u16* updates = (u16*)HLEMemory_Get_Pointer(HILO_TO_32(queued.pb.updates.data));
+      queued.updates.assign(updates, updates + 2 * num_updates);
+    }
+
+    pb_addr = HILO_TO_32(queued.pb.next_pb);
+  }
+
+  m_dsphle->RunAsync(
+      [this, skip_mixing = ShouldSkipMixing()] {
+        for (QueuedPB& queued : m_queued_pbs)
+          ProcessPB(queued.pb, queued.updates.data(), skip_mixing);
+      },
+      [this, first_pb_addr, next_idx] {
+        for (const QueuedPB& queued : m_queued_pbs)
+          WritePB(queued.addr, queued.pb, m_crc);
+        m_queued_pbs.clear();
+
+        RunCommandList(next_idx, first_pb_addr, false);
+      },
+      AX_EMPTY_COMMAND_LIST_CYCLES);
+}
+
+void AXUCode::ProcessPB(AXPB& pb, u16* updates, bool skip_mixing)
+{
+  // Samples per millisecond. In theory DSP sampling rate can be changed from
+  // 32KHz to 48KHz, but AX always process at 32KHz.
+  constexpr u32 spms = 32;
 
-      ProcessVoice(pb, buffers, spms, ConvertMixerControl(pb.mixer_control),
-                   m_coeffs_available ? m_coeffs : nullptr);
+  AXBuffers buffers{};
+  if (!skip_mixing)
+  {
+    buffers = {{m_samples_left, m_samples_right, m_samples_surround, m_samples_auxA_left,
+                m_samples_auxA_right, m_samples_auxA_surround, m_samples_auxB_left,
+                m_samples_auxB_right, m_samples_auxB_surround}};
+  }
 
-      // Forward the buffers
+  for (int curr_ms = 0; curr_ms < 5; ++curr_ms)
+  {
+    ApplyUpdatesForMs(curr_ms, pb, pb.updates.num_updates, updates);
+
+    ProcessVoice(pb, buffers, spms, ConvertMixerControl(pb.mixer_control),
+                 m_coeffs_available ? m_coeffs : nullptr);
+
+    // Forward the buffers
+    if (!skip_mixing)
+    {
       for (auto& ptr : buffers.ptrs)
         ptr += spms;
     }
-
-    WritePB(pb_addr, pb, m_crc);
-    pb_addr = HILO_TO_32(pb.next_pb);
   }
 }
 
@@ -627,8 +708,6 @@ void AXUCode::HandleMail(u32 mail)
   {
     CopyCmdList(mail, cmdlist_size);
     HandleCommandList();
-    m_cmdlist_size = 0;
-    SignalWorkEnd();
   }
   else if (m_upload_setup_in_progress)
   {
@@ -11,9 +11,12 @@
 
 #pragma once
 
+#include <vector>
+
 #include "Common/BitUtils.h"
 #include "Common/CommonTypes.h"
 #include "Common/Swap.h"
+#include "Core/HW/DSPHLE/UCodes/AXStructs.h"
 #include "Core/HW/DSPHLE/UCodes/UCodes.h"
 
 namespace DSP::HLE
@@ -130,11 +133,17 @@ protected:
   }
 
   virtual void HandleCommandList();
+  void EndCommandList();
   void SignalWorkEnd();
 
+  // Whether voices should only be advanced without mixing their samples, because emulation is
+  // running unthrottled and the user chose to trade the audio for speed.
+  bool ShouldSkipMixing() const;
+
   void SetupProcessing(u32 init_addr);
   void DownloadAndMixWithVolume(u32 addr, u16 vol_main, u16 vol_auxa, u16 vol_auxb);
   void ProcessPBList(u32 pb_addr);
+  void ProcessPB(AXPB& pb, u16* updates, bool skip_mixing);
   void MixAUXSamples(int aux_id, u32 write_addr, u32 read_addr);
   void UploadLRS(u32 dst_addr);
   void SetMainLR(u32 src_addr);
@@ -148,6 +157,21 @@ protected:
   void DoAXState(PointerWrap& p);
 
 private:
+  // A PB read from RAM by the CPU thread, to be mixed on the DSP HLE thread.
+  struct QueuedPB
+  {
+    u32 addr;
+    AXPB pb;
+    std::vector<u16> updates;
+  };
+
+  // Runs the command list from curr_idx. If allowed, the first CMD_PROCESS mixes its PBs on the
+  // DSP HLE thread, and the rest of the list runs when the CPU thread syncs with it.
+  void RunCommandList(u32 curr_idx, u32 pb_addr, bool allow_async);
+  void ProcessPBListAsync(u32 pb_addr, u32 next_idx);
+
+  std::vector<QueuedPB> m_queued_pbs;
+
   enum CmdType
   {
     CMD_SETUP = 0x00,
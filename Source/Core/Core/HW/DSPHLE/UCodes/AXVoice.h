@@ -15,6 +15,10 @@
 #include <functional>
 #include <memory>
 
+#if defined(_M_X86)
+#include <emmintrin.h>
+#endif
+
 #include "Common/CommonTypes.h"
 #include "Core/DSP/DSPAccelerator.h"
 #include "Core/HW/DSP.h"
@@ -377,7 +381,34 @@ void GetInputSamples(PB_TYPE& pb, s16* samples, u16 count, const s16* coeffs)
   pb.adpcm.pred_scale = s_accelerator->GetPredScale();
 }
 
-// Add samples to an output buffer, with optional volume ramping.
+#if defined(_M_X86)
+// Returns the volumes of eight consecutive samples, starting at volume and
+// increased by volume_delta after every sample.
+__m128i GetVolumeRamp(u16 volume, u16 volume_delta)
+{
+  const __m128i steps = _mm_setr_epi16(0, 1, 2, 3, 4, 5, 6, 7);
+  return _mm_add_epi16(_mm_set1_epi16(static_cast<s16>(volume)),
+                       _mm_mullo_epi16(steps, _mm_set1_epi16(static_cast<s16>(volume_delta))));
+}
+
+// Computes clamp((sample * volume) >> 15, -32767, 32767) for eight signed
+// samples and unsigned volumes, exactly like the scalar code does.
+__m128i ApplyVolume(__m128i samples, __m128i volumes)
+{
+  // The high half of the signed multiplication is off by the sample for the
+  // volumes which have their top bit set.
+  const __m128i products_lo = _mm_mullo_epi16(samples, volumes);
+  const __m128i products_hi = _mm_add_epi16(_mm_mulhi_epi16(samples, volumes),
+                                            _mm_and_si128(samples, _mm_srai_epi16(volumes, 15)));
+
+  const __m128i scaled_lo = _mm_srai_epi32(_mm_unpacklo_epi16(products_lo, products_hi), 15);
+  const __m128i scaled_hi = _mm_srai_epi32(_mm_unpackhi_epi16(products_lo, products_hi), 15);
+  return _mm_max_epi16(_mm_packs_epi32(scaled_lo, scaled_hi), _mm_set1_epi16(-32767));
+}
+#endif
+
+// Add samples to an output buffer, with optional volume ramping. Without an
+// output buffer, only the volume and the last mixed sample are updated.
 void MixAdd(int* out, const s16* input, u32 count, u16* pvol, s16* dpop, bool ramp)
 {
   u16& volume = pvol[0];
@@ -389,7 +420,45 @@ void MixAdd(int* out, const s16* input, u32 count, u16* pvol, s16* dpop, bool ra
   if (!ramp)
     volume_delta = 0;
 
-  for (u32 i = 0; i < count; ++i)
+  if (!out)
+  {
+    if (count == 0)
+      return;
+
+    s64 sample = input[count - 1];
+    sample *= static_cast<u16>(volume + volume_delta * (count - 1));
+    sample >>= 15;
+    *dpop = (s16)std::clamp((s32)sample, -32767, 32767);
+    volume = static_cast<u16>(volume + volume_delta * count);
+    return;
+  }
+
+  u32 i = 0;
+#if defined(_M_X86)
+  if (count >= 8)
+  {
+    const __m128i volume_step = _mm_set1_epi16(static_cast<s16>(volume_delta * 8));
+    __m128i volumes = GetVolumeRamp(volume, volume_delta);
+    __m128i samples;
+    for (; i + 8 <= count; i += 8)
+    {
+      samples = ApplyVolume(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i)), volumes);
+      volumes = _mm_add_epi16(volumes, volume_step);
+
+      // Sign extend the samples to 32 bits before adding them to the output.
+      const __m128i samples_lo = _mm_srai_epi32(_mm_unpacklo_epi16(samples, samples), 16);
+      const __m128i samples_hi = _mm_srai_epi32(_mm_unpackhi_epi16(samples, samples), 16);
+      __m128i* const out_lo = reinterpret_cast<__m128i*>(out + i);
+      __m128i* const out_hi = reinterpret_cast<__m128i*>(out + i + 4);
+      _mm_storeu_si128(out_lo, _mm_add_epi32(_mm_loadu_si128(out_lo), samples_lo));
+      _mm_storeu_si128(out_hi, _mm_add_epi32(_mm_loadu_si128(out_hi), samples_hi));
+    }
+    volume = static_cast<u16>(volume + volume_delta * i);
+    *dpop = static_cast<s16>(_mm_extract_epi16(samples, 7));
+  }
+#endif
+
+  for (; i < count; ++i)
   {
     s64 sample = input[i];
     sample *= volume;
@@ -412,6 +481,30 @@ s16 LowPassFilter(s16* samples, u32 count, s16 yn1, u16 a0, u16 b0)
   return yn1;
 }
 
+// Apply a volume ramp to the samples, as described by a volume envelope.
+void ApplyVolumeEnvelope(s16* samples, u32 count, PBVolumeEnvelope& vol_env)
+{
+  u32 i = 0;
+#if defined(_M_X86)
+  const u16 volume_delta = static_cast<u16>(vol_env.cur_volume_delta);
+  const __m128i volume_step = _mm_set1_epi16(static_cast<s16>(volume_delta * 8));
+  __m128i volumes = GetVolumeRamp(vol_env.cur_volume, volume_delta);
+  for (; i + 8 <= count; i += 8)
+  {
+    __m128i* const ptr = reinterpret_cast<__m128i*>(samples + i);
+    _mm_storeu_si128(ptr, ApplyVolume(_mm_loadu_si128(ptr), volumes));
+    volumes = _mm_add_epi16(volumes, volume_step);
+  }
+  vol_env.cur_volume = static_cast<u16>(vol_env.cur_volume + volume_delta * i);
+#endif
+  for (; i < count; ++i)
+  {
+    samples[i] = std::clamp(((s32)samples[i] * vol_env.cur_volume) >> 15, -32767,
+                            32767);  // -32768 ?
+    vol_env.cur_volume += vol_env.cur_volume_delta;
+  }
+}
+
 // Process 1ms of audio (for AX GC) or 3ms of audio (for AX Wii) from a PB and
 // mix it to the output buffers.
 void ProcessVoice(PB_TYPE& pb, const AXBuffers& buffers, u16 count, AXMixControl mctrl,
@@ -426,12 +519,7 @@ void ProcessVoice(PB_TYPE& pb, const AXBuffers& buffers, u16 count, AXMixControl
   GetInputSamples(pb, samples, count, coeffs);
 
   // Apply a global volume ramp using the volume envelope parameters.
-  for (u32 i = 0; i < count; ++i)
-  {
-    samples[i] = std::clamp(((s32)samples[i] * pb.vol_env.cur_volume) >> 15, -32767,
-                            32767);  // -32768 ?
-    pb.vol_env.cur_volume += pb.vol_env.cur_volume_delta;
-  }
+  ApplyVolumeEnvelope(samples, count, pb.vol_env);
 
   // Optionally, execute a low pass filter
   // TODO: LPF code is currently broken, causing Super Monkey Ball sound
@@ -241,6 +241,8 @@ void AXWiiUCode::HandleCommandList()
       }
     }
   }
+
+  EndCommandList();
 }
 
 void AXWiiUCode::SetupProcessing(u32 init_addr)
@@ -441,17 +443,24 @@ void AXWiiUCode::ProcessPBList(u32 pb_addr)
   // 32KHz to 48KHz, but AX always process at 32KHz.
   constexpr u32 spms = 32;
 
+  // Without buffers, the voices only advance their state and the output stays silent.
+  const bool skip_mixing = ShouldSkipMixing();
+
   AXPBWii pb;
 
   while (pb_addr)
   {
-    AXBuffers buffers = {{m_samples_left,      m_samples_right,      m_samples_surround,
-                          m_samples_auxA_left, m_samples_auxA_right, m_samples_auxA_surround,
-                          m_samples_auxB_left, m_samples_auxB_right, m_samples_auxB_surround,
-                          m_samples_auxC_left, m_samples_auxC_right, m_samples_auxC_surround,
-                          m_samples_wm0,       m_samples_aux0,       m_samples_wm1,
-                          m_samples_aux1,      m_samples_wm2,        m_samples_aux2,
-                          m_samples_wm3,       m_samples_aux3}};
+    AXBuffers buffers{};
+    if (!skip_mixing)
+    {
+      buffers = {{m_samples_left,      m_samples_right,      m_samples_surround,
+                  m_samples_auxA_left, m_samples_auxA_right, m_samples_auxA_surround,
+                  m_samples_auxB_left, m_samples_auxB_right, m_samples_auxB_surround,
+                  m_samples_auxC_left, m_samples_auxC_right, m_samples_auxC_surround,
+                  m_samples_wm0,       m_samples_aux0,       m_samples_wm1,
+                  m_samples_aux1,      m_samples_wm2,        m_samples_aux2,
+                  m_samples_wm3,       m_samples_aux3}};
+    }
 
     ReadPB(pb_addr, pb, m_crc);
 
@@ -467,8 +476,11 @@ void AXWiiUCode::ProcessPBList(u32 pb_addr)
                      m_coeffs_available ? m_coeffs : nullptr);
 
         // Forward the buffers
-        for (auto& ptr : buffers.ptrs)
-          ptr += spms;
+        if (!skip_mixing)
+        {
+          for (auto& ptr : buffers.ptrs)
+            ptr += spms;
+        }
       }
       ReinjectUpdatesFields(pb, num_updates, updates_addr);
     }
@@ -7,6 +7,10 @@
 #include <array>
 #include <map>
 
+#if defined(_M_X86)
+#include <emmintrin.h>
+#endif
+
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
@@ -963,6 +967,117 @@ struct ReverbPB
 };
 #pragma pack(pop)
 
+s32 ZeldaAudioRenderer::AddBuffersWithVolumeRamp(s16* dst, const s16* src, size_t count, s32 vol,
+                                                  s32 step)
+{
+  if (!vol && !step)
+    return vol;
+
+  size_t i = 0;
+#if defined(_M_X86)
+  // ((vol >> 16) * sample) >> 16 is exactly what _mm_mulhi_epi16 computes, and the additions
+  // wrap around like the scalar version does.
+  const u32 step_u = static_cast<u32>(step);
+  __m128i volumes_lo = _mm_setr_epi32(vol, static_cast<s32>(vol + step_u),
+                                      static_cast<s32>(vol + 2 * step_u),
+                                      static_cast<s32>(vol + 3 * step_u));
+  __m128i volumes_hi = _mm_add_epi32(volumes_lo, _mm_set1_epi32(static_cast<s32>(4 * step_u)));
+  const __m128i volumes_step = _mm_set1_epi32(static_cast<s32>(8 * step_u));
+  for (const size_t simd_count = count & ~size_t{7}; i < simd_count; i += 8)
+  {
+    const __m128i volumes =
+        _mm_packs_epi32(_mm_srai_epi32(volumes_lo, 16), _mm_srai_epi32(volumes_hi, 16));
+    const __m128i samples = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    __m128i* out = reinterpret_cast<__m128i*>(dst + i);
+    _mm_storeu_si128(out, _mm_add_epi16(_mm_loadu_si128(out), _mm_mulhi_epi16(volumes, samples)));
+
+    volumes_lo = _mm_add_epi32(volumes_lo, volumes_step);
+    volumes_hi = _mm_add_epi32(volumes_hi, volumes_step);
+  }
+  vol = static_cast<s32>(vol + step_u * static_cast<u32>(i));
+#endif
+
+  for (; i < count; ++i)
+  {
+    dst[i] += ((vol >> 16) * src[i]) >> 16;
+    vol += step;
+  }
+
+  return vol;
+}
+
+void ZeldaAudioRenderer::AddBuffersWithVolume(s16* dst, const s16* src, size_t count, u16 vol)
+{
+  size_t i = 0;
+#if defined(_M_X86)
+  // The volume is unsigned, so the signed high half of the product has to be corrected by
+  // adding the sample when the top bit of the volume is set. Packing clamps the result.
+  const __m128i volume = _mm_set1_epi16(static_cast<s16>(vol));
+  const __m128i sign_fixup = _mm_set1_epi16((vol & 0x8000) ? -1 : 0);
+  for (const size_t simd_count = count & ~size_t{7}; i < simd_count; i += 8)
+  {
+    const __m128i samples = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    const __m128i product_lo = _mm_mullo_epi16(samples, volume);
+    const __m128i product_hi = _mm_add_epi16(_mm_mulhi_epi16(samples, volume),
+                                             _mm_and_si128(samples, sign_fixup));
+    const __m128i scaled =
+        _mm_packs_epi32(_mm_srai_epi32(_mm_unpacklo_epi16(product_lo, product_hi), 15),
+                        _mm_srai_epi32(_mm_unpackhi_epi16(product_lo, product_hi), 15));
+    __m128i* out = reinterpret_cast<__m128i*>(dst + i);
+    _mm_storeu_si128(out, _mm_add_epi16(_mm_loadu_si128(out), scaled));
+  }
+#endif
+
+  for (; i < count; ++i)
+  {
+    s32 vol_src = ((s32)src[i] * (s32)vol) >> 15;
+    dst[i] += std::clamp(vol_src, -0x8000, 0x7FFF);
+  }
+}
+
+// Filters the 0x50 samples of a reverb buffer in place. Each output sample is computed from the
+// 8 input samples starting at its own position, hence the 8 extra samples at the end.
+static void ApplyReverbFilter(std::array<s16, 0x58>* buffer, const s16* coeffs)
+{
+  size_t i = 0;
+#if defined(_M_X86)
+  // Each 32 bit lane of these holds a pair of consecutive coefficients for _mm_madd_epi16.
+  __m128i coeff_pairs[4];
+  for (size_t j = 0; j < 4; ++j)
+  {
+    const u32 pair =
+        static_cast<u16>(coeffs[2 * j]) | (u32{static_cast<u16>(coeffs[2 * j + 1])} << 16);
+    coeff_pairs[j] = _mm_set1_epi32(static_cast<s32>(pair));
+  }
+
+  // The outputs only overwrite samples which no later output reads.
+  for (; i + 8 <= 0x50; i += 8)
+  {
+    __m128i sum_lo = _mm_setzero_si128();
+    __m128i sum_hi = _mm_setzero_si128();
+    for (size_t j = 0; j < 4; ++j)
+    {
+      const s16* input = buffer->data() + i + 2 * j;
+      const __m128i even = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input));
+      const __m128i odd = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + 1));
+      sum_lo = _mm_add_epi32(sum_lo, _mm_madd_epi16(_mm_unpacklo_epi16(even, odd), coeff_pairs[j]));
+      sum_hi = _mm_add_epi32(sum_hi, _mm_madd_epi16(_mm_unpackhi_epi16(even, odd), coeff_pairs[j]));
+    }
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(buffer->data() + i),
+                     _mm_packs_epi32(_mm_srai_epi32(sum_lo, 15), _mm_srai_epi32(sum_hi, 15)));
+  }
+#endif
+
+  for (; i < 0x50; ++i)
+  {
+    s32 sample = 0;
+    for (size_t j = 0; j < 8; ++j)
+      sample += (s32)(*buffer)[i + j] * coeffs[j];
+    sample >>= 15;
+    (*buffer)[i] = std::clamp(sample, -0x8000, 0x7FFF);
+  }
+}
+
 void ZeldaAudioRenderer::PrepareFrame()
 {
   if (m_prepared)
@@ -1049,9 +1164,7 @@ void ZeldaAudioRenderer::ApplyReverb(bool post_rendering)
   for (u16 rpb_idx = 0; rpb_idx < 4; ++rpb_idx)
   {
     ReverbPB rpb;
-    u16* rpb_raw_ptr = reinterpret_cast<u16*>(&rpb);
-    for (size_t i = 0; i < sizeof(ReverbPB) / 2; ++i)
-      rpb_raw_ptr[i] = Common::swap16(rpb_base_ptr[rpb_idx * sizeof(ReverbPB) / 2 + i]);
+    Common::SwapCopy16(&rpb, rpb_base_ptr + rpb_idx * sizeof(ReverbPB) / 2, sizeof(ReverbPB) / 2);
 
     if (!rpb.enabled)
       continue;
@@ -1076,21 +1189,9 @@ void ZeldaAudioRenderer::ApplyReverb(bool post_rendering)
       for (u16 i = 0; i < 8; ++i)
         (*last8_samples_buffers[rpb_idx])[i] = buffer[0x50 + i];
 
-      auto ApplyFilter = [&]() {
-        // Filter the buffer using provided coefficients.
-        for (u16 i = 0; i < 0x50; ++i)
-        {
-          s32 sample = 0;
-          for (u16 j = 0; j < 8; ++j)
-            sample += (s32)buffer[i + j] * rpb.filter_coeffs[j];
-          sample >>= 15;
-          buffer[i] = std::clamp(sample, -0x8000, 0x7FFF);
-        }
-      };
-
       // LSB set -> pre-filtering.
       if (rpb.enabled & 1)
-        ApplyFilter();
+        ApplyReverbFilter(&buffer, rpb.filter_coeffs);
 
       for (const auto& dest : rpb.dest)
       {
@@ -1110,7 +1211,7 @@ void ZeldaAudioRenderer::ApplyReverb(bool post_rendering)
 
       // LSB not set, bit 1 set -> post-filtering.
       if (rpb.enabled & 2)
-        ApplyFilter();
+        ApplyReverbFilter(&buffer, rpb.filter_coeffs);
 
       for (u16 i = 0; i < 0x50; ++i)
         (*reverb_buffers[rpb_idx])[i] = buffer[i];
@@ -1242,7 +1343,8 @@ void ZeldaAudioRenderer::AddVoice(u16 voice_id)
     };
     for (const auto& buffer : buffers)
     {
-      AddBuffersWithVolumeRamp(buffer.buffer, input_samples, buffer.volume << 16,
+      AddBuffersWithVolumeRamp(buffer.buffer->data(), input_samples.data(), input_samples.size(),
+                               buffer.volume << 16,
                                (buffer.volume_delta << 16) / (s32)buffer.buffer->size());
     }
 
@@ -1296,8 +1398,9 @@ void ZeldaAudioRenderer::AddVoice(u16 voice_id)
         continue;
       }
 
-      s32 new_volume = AddBuffersWithVolumeRamp(dst_buffer, input_samples,
-                                                vpb.channels[i].current_volume << 16, volume_step);
+      s32 new_volume =
+          AddBuffersWithVolumeRamp(dst_buffer->data(), input_samples.data(), input_samples.size(),
+                                   vpb.channels[i].current_volume << 16, volume_step);
       vpb.channels[i].current_volume = new_volume >> 16;
     }
   }
@@ -1345,8 +1448,7 @@ void ZeldaAudioRenderer::FetchVPB(u16 voice_id, VPB* vpb)
   size_t vpb_size = (m_flags & TINY_VPB) ? 0x80 : 0xC0;
 
   size_t base_idx = voice_id * vpb_size;
-  for (size_t i = 0; i < vpb_size; ++i)
-    vpb_words[i] = Common::swap16(ram_vpbs[base_idx + i]);
+  Common::SwapCopy16(vpb_words, ram_vpbs + base_idx, vpb_size);
 
   if (m_flags & TINY_VPB)
     vpb->Uncompress();
@@ -1364,8 +1466,7 @@ void ZeldaAudioRenderer::StoreVPB(u16 voice_id, VPB* vpb)
     vpb->Compress();
 
   // Only the first 0x80 words are transferred back - the rest is read-only.
-  for (size_t i = 0; i < vpb_size - 0x40; ++i)
-    ram_vpbs[base_idx + i] = Common::swap16(vpb_words[i]);
+  Common::SwapCopy16(ram_vpbs + base_idx, vpb_words, vpb_size - 0x40);
 }
 
 void ZeldaAudioRenderer::LoadInputSamples(MixingBuffer* buffer, VPB* vpb)
@@ -1428,18 +1529,26 @@ void ZeldaAudioRenderer::LoadInputSamples(MixingBuffer* buffer, VPB* vpb)
   {
     const u16 PATTERN_SIZE = 0x40;
 
-    struct PatternInfo
+    // Looked up with a switch rather than a map, as this runs for every voice of every frame.
+    u16 pattern_idx;
+    switch (vpb->samples_source_type)
     {
-      u16 idx;
-      bool variable_step;
-    };
-    std::map<u16, PatternInfo> samples_source_to_pattern = {
-        {VPB::SRC_CONST_PATTERN_0, {0, false}}, {VPB::SRC_CONST_PATTERN_0_VARIABLE_STEP, {0, true}},
-        {VPB::SRC_CONST_PATTERN_1, {1, false}}, {VPB::SRC_CONST_PATTERN_2, {2, false}},
-        {VPB::SRC_CONST_PATTERN_3, {3, false}},
-    };
-    auto& pattern_info = samples_source_to_pattern[vpb->samples_source_type];
-    u16 pattern_offset = pattern_info.idx * PATTERN_SIZE;
+    case VPB::SRC_CONST_PATTERN_1:
+      pattern_idx = 1;
+      break;
+    case VPB::SRC_CONST_PATTERN_2:
+      pattern_idx = 2;
+      break;
+    case VPB::SRC_CONST_PATTERN_3:
+      pattern_idx = 3;
+      break;
+    default:
+      pattern_idx = 0;
+      break;
+    }
+    const bool variable_step =
+        vpb->samples_source_type == VPB::SRC_CONST_PATTERN_0_VARIABLE_STEP;
+    u16 pattern_offset = pattern_idx * PATTERN_SIZE;
     s16* pattern = m_const_patterns.data() + pattern_offset;
 
     u32 pos = vpb->current_pos_frac << 6;   // log2(PATTERN_SIZE)
@@ -1449,7 +1558,7 @@ void ZeldaAudioRenderer::LoadInputSamples(MixingBuffer* buffer, VPB* vpb)
     {
       (*buffer)[i] = pattern[pos >> 16];
       pos = (pos + step) % (PATTERN_SIZE << 16);
-      if (pattern_info.variable_step)
+      if (variable_step)
         pos = ((pos << 10) + m_buf_back_right[i] * vpb->resampling_ratio) >> 10;
     }
 
@@ -1581,8 +1690,17 @@ void ZeldaAudioRenderer::DownloadPCMSamplesFromARAM(s16* dst, VPB* vpb, u16 requ
     T* src_ptr = (T*)((u8*)GetARAMPtr() + vpb->GetCurrentARAMAddr());
     u16 samples_to_download = std::min(vpb->GetRemainingLength(), (u32)requested_samples_count);
 
-    for (u16 i = 0; i < samples_to_download; ++i)
-      *dst++ = Common::FromBigEndian<T>(*src_ptr++) << (16 - 8 * sizeof(T));
+    if constexpr (sizeof(T) == sizeof(u16))
+    {
+      Common::SwapCopy16(dst, src_ptr, samples_to_download);
+      dst += samples_to_download;
+      src_ptr += samples_to_download;
+    }
+    else
+    {
+      for (u16 i = 0; i < samples_to_download; ++i)
+        *dst++ = Common::FromBigEndian<T>(*src_ptr++) << (16 - 8 * sizeof(T));
+    }
 
     vpb->SetRemainingLength(vpb->GetRemainingLength() - samples_to_download);
     vpb->SetCurrentARAMAddr(vpb->GetCurrentARAMAddr() + samples_to_download * sizeof(T));
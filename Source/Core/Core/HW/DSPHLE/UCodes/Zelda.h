@@ -70,32 +70,14 @@ private:
   //
   // Note: On a real GC, the stepping happens in 32 steps instead. But hey,
   // we can do better here with very low risk. Why not? :)
-  template <size_t N>
-  s32 AddBuffersWithVolumeRamp(std::array<s16, N>* dst, const std::array<s16, N>& src, s32 vol,
-                               s32 step)
-  {
-    if (!vol && !step)
-      return vol;
-
-    for (size_t i = 0; i < N; ++i)
-    {
-      (*dst)[i] += ((vol >> 16) * src[i]) >> 16;
-      vol += step;
-    }
-
-    return vol;
-  }
+  //
+  // Both of these are called for every voice and every destination buffer,
+  // so they process 8 samples at a time where SIMD is available.
+  static s32 AddBuffersWithVolumeRamp(s16* dst, const s16* src, size_t count, s32 vol, s32 step);
 
   // Does not use std::array because it needs to be able to process partial
   // buffers. Volume is in 1.15 format.
-  void AddBuffersWithVolume(s16* dst, const s16* src, size_t count, u16 vol)
-  {
-    while (count--)
-    {
-      s32 vol_src = ((s32)*src++ * (s32)vol) >> 15;
-      *dst++ += std::clamp(vol_src, -0x8000, 0x7FFF);
-    }
-  }
+  static void AddBuffersWithVolume(s16* dst, const s16* src, size_t count, u16 vol);
 
   // Whether the frame needs to be prepared or not.
   bool m_prepared = false;
@@ -37,6 +37,7 @@ public:
   void DSP_Update(int cycles) override;
   void DSP_StopSoundStream() override;
   u32 DSP_UpdateRate() override;
+  void DSP_Sync() override {}
 
 private:
   static void DSPThread(DSPLLE* dsp_lle);
@@ -33,6 +33,8 @@
 #include "Core/IOS/DI/DI.h"
 #include "Core/IOS/IOS.h"
 #include "Core/Movie.h"
+#include "Core/RunAhead.h"
+#include "Core/System.h"
 
 #include "DiscIO/Blob.h"
 #include "DiscIO/DiscUtils.h"
@@ -311,7 +313,9 @@ static void DTKStreamingCallback(DIInterruptType interrupt_type, const std::vect
     // Send audio to the mixer.
     std::vector<s16> temp_pcm(s_pending_samples * 2, 0);
     ProcessDTKSamples(&temp_pcm, audio_data);
-    g_sound_stream->GetMixer()->PushStreamingSamples(temp_pcm.data(), s_pending_samples);
+    SoundStream* sound_stream = Core::System::GetInstance().GetSoundStream();
+    if (!RunAhead::IsRunningAhead())
+      sound_stream->GetMixer()->PushStreamingSamples(temp_pcm.data(), s_pending_samples);
 
     if (s_stream && AudioInterface::IsPlaying())
     {
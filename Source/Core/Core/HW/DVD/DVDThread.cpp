@@ -3,6 +3,10 @@
 
 #include "Core/HW/DVD/DVDThread.h"
 
+#include <algorithm>
+#include <cstring>
+#include <deque>
+#include <limits>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -31,6 +35,7 @@
 #include "Core/IOS/ES/Formats.h"
 
 #include "DiscIO/Enums.h"
+#include "DiscIO/Filesystem.h"
 #include "DiscIO/Volume.h"
 
 namespace DVDThread
@@ -61,6 +66,32 @@ struct ReadRequest
 
 using ReadResult = std::pair<ReadRequest, std::vector<u8>>;
 
+// Data read from the disc ahead of a sequential stream of requests.
+struct ReadAheadChunk
+{
+  u64 offset;
+  std::vector<u8> data;
+};
+
+struct ReadAheadStream
+{
+  u32 chunk_size;
+  size_t max_chunks;
+
+  std::deque<ReadAheadChunk> chunks;
+  DiscIO::Partition partition;
+  u64 last_read_end = 0;
+  // Where reading ahead stops, if the stream is expected to end somewhere
+  u64 end = std::numeric_limits<u64>::max();
+  bool active = false;
+
+  void Reset()
+  {
+    chunks.clear();
+    active = false;
+  }
+};
+
 static void StartDVDThread();
 static void StopDVDThread();
 
@@ -74,6 +105,9 @@ static void StartReadInternal(bool copy_to_ram, u32 output_address, u64 dvd_offs
 static void FinishRead(u64 id, s64 cycles_late);
 static CoreTiming::EventType* s_finish_read;
 
+static bool ReadFromDisc(const ReadRequest& request, u8* out_ptr);
+static bool ReadAhead(ReadAheadStream& stream);
+
 static u64 s_next_id = 0;
 
 static std::thread s_dvd_thread;
@@ -87,6 +121,15 @@ static std::map<u64, ReadResult> s_result_map;
 
 static std::unique_ptr<DiscIO::Volume> s_disc;
 
+// When requests are sequential, the DVD thread uses the time it would otherwise be idle to read
+// the data that follows, so that streaming games don't wait for the host when the emulated drive
+// timing expects the data to be there. These are only accessed by the DVD thread.
+static ReadAheadStream s_read_ahead{0x40000, 16};
+// Streamed audio (DTK) is tracked separately, since its small reads are interleaved with the
+// game's own reads and would otherwise keep breaking both streams. 4 chunks of 64 KiB are about
+// 4.8 seconds of audio.
+static ReadAheadStream s_dtk_read_ahead{0x10000, 4};
+
 void Start()
 {
   s_finish_read = CoreTiming::RegisterEvent("FinishReadDVDThread", FinishRead);
@@ -114,6 +157,9 @@ void Stop()
 {
   StopDVDThread();
   s_disc.reset();
+
+  s_read_ahead.Reset();
+  s_dtk_read_ahead.Reset();
 }
 
 static void StopDVDThread()
@@ -177,6 +223,9 @@ void SetDisc(std::unique_ptr<DiscIO::Volume> disc)
 {
   WaitUntilIdle();
   s_disc = std::move(disc);
+
+  s_read_ahead.Reset();
+  s_dtk_read_ahead.Reset();
 }
 
 bool HasDisc()
@@ -361,6 +410,94 @@ static void FinishRead(u64 id, s64 cycles_late)
   DVDInterface::FinishExecutingCommand(request.reply_type, interrupt, cycles_late, buffer);
 }
 
+static bool ReadFromDisc(const ReadRequest& request, u8* out_ptr)
+{
+  ReadAheadStream& stream =
+      request.reply_type == DVDInterface::ReplyType::DTK ? s_dtk_read_ahead : s_read_ahead;
+
+  const u64 offset = request.dvd_offset;
+  const u64 end = offset + request.length;
+
+  const bool sequential = stream.partition == request.partition && offset == stream.last_read_end;
+  stream.partition = request.partition;
+  stream.last_read_end = end;
+  stream.end = std::numeric_limits<u64>::max();
+  stream.active = sequential;
+  if (!sequential)
+  {
+    stream.chunks.clear();
+
+    // Games mostly load whole files, often in several requests, so the first request for a file
+    // predicts the rest of it without having to wait for a second request to confirm the stream.
+    if (&stream == &s_read_ahead)
+    {
+      const DiscIO::FileSystem* file_system = s_disc->GetFileSystem(request.partition);
+      const std::unique_ptr<DiscIO::FileInfo> file_info =
+          file_system ? file_system->FindFileInfo(offset) : nullptr;
+      if (file_info && file_info->GetOffset() + file_info->GetSize() > end)
+      {
+        stream.end = file_info->GetOffset() + file_info->GetSize();
+        stream.active = true;
+      }
+    }
+  }
+
+  // Drop the chunks that the stream has already moved past.
+  while (!stream.chunks.empty() &&
+         stream.chunks.front().offset + stream.chunks.front().data.size() <= offset)
+  {
+    stream.chunks.pop_front();
+  }
+
+  // Serve the request from the chunks read ahead if they cover all of it.
+  if (!stream.chunks.empty() && stream.chunks.front().offset <= offset &&
+      stream.chunks.back().offset + stream.chunks.back().data.size() >= end)
+  {
+    for (const ReadAheadChunk& chunk : stream.chunks)
+    {
+      const u64 chunk_end = chunk.offset + chunk.data.size();
+      const u64 copy_start = std::max(offset, chunk.offset);
+      const u64 copy_end = std::min(end, chunk_end);
+      if (copy_start < copy_end)
+      {
+        std::memcpy(out_ptr + (copy_start - offset),
+                    chunk.data.data() + (copy_start - chunk.offset), copy_end - copy_start);
+      }
+    }
+    return true;
+  }
+
+  stream.chunks.clear();
+  return s_disc->Read(offset, request.length, out_ptr, request.partition);
+}
+
+// Reads one chunk following the last sequential request of the stream. Returns false if there is
+// nothing more to read ahead for now.
+static bool ReadAhead(ReadAheadStream& stream)
+{
+  if (!stream.active || stream.chunks.size() >= stream.max_chunks)
+    return false;
+
+  ReadAheadChunk chunk;
+  chunk.offset = stream.chunks.empty() ?
+                     stream.last_read_end :
+                     stream.chunks.back().offset + stream.chunks.back().data.size();
+  if (chunk.offset >= stream.end)
+    return false;
+
+  const u32 size = static_cast<u32>(std::min<u64>(stream.chunk_size, stream.end - chunk.offset));
+  chunk.data.resize(size);
+  if (!s_disc->Read(chunk.offset, size, chunk.data.data(), stream.partition))
+  {
+    // Most likely the end of the disc or partition was reached.
+    stream.active = false;
+    return false;
+  }
+
+  stream.chunks.push_back(std::move(chunk));
+  return true;
+}
+
 static void DVDThread()
 {
   Common::SetCurrentThreadName("DVD thread");
@@ -373,12 +510,25 @@ static void DVDThread()
       return;
 
     ReadRequest request;
-    while (s_request_queue.Pop(request))
+    while (true)
     {
+      if (!s_request_queue.Pop(request))
+      {
+        // Use the idle time to read ahead, checking for new requests between chunks. Audio
+        // comes first, since running out of it is audible.
+        if (!ReadAhead(s_dtk_read_ahead) && !ReadAhead(s_read_ahead))
+          break;
+
+        if (s_dvd_thread_exiting.IsSet())
+          return;
+
+        continue;
+      }
+
       FileMonitor::Log(*s_disc, request.partition, request.dvd_offset);
 
       std::vector<u8> buffer(request.length);
-      if (!s_disc->Read(request.dvd_offset, request.length, buffer.data(), request.partition))
+      if (!ReadFromDisc(request, buffer.data()))
         buffer.resize(0);
 
       request.realtime_done_us = Common::Timer::GetTimeUs();
@@ -142,11 +142,18 @@ void CEXIETHERNET::XLinkNetworkInterface::ReadThreadHandler(
   sf::IpAddress sender;
   u16 port;
 
+  // The socket doesn't block, so wait for data here instead of spinning on receive().
+  sf::SocketSelector selector;
+  selector.add(self->m_sf_socket);
+
   while (!self->m_read_thread_shutdown.IsSet())
   {
     if (!self->IsActivated())
       break;
 
+    if (!selector.wait(sf::milliseconds(50)))
+      continue;
+
     // XLink supports jumboframes but Gamecube BBA does not. We need to support jumbo frames
     // *here* because XLink *could* send one
     std::size_t bytes_read = 0;
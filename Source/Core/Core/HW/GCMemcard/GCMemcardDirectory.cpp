@@ -632,20 +632,25 @@ void GCMemcardDirectory::FlushToFile()
           }
           save.m_filename = default_save_name;
         }
-        File::IOFile gci(save.m_filename, "wb");
+        // Write to a temporary file first so that the existing save isn't lost if writing the
+        // new one is interrupted.
+        const std::string temp_filename = save.m_filename + ".tmp";
+        File::IOFile gci(temp_filename, "wb");
         if (gci)
         {
           gci.WriteBytes(&save.m_gci_header, Memcard::DENTRY_SIZE);
           for (const Memcard::GCMBlock& block : save.m_save_data)
             gci.WriteBytes(block.m_block.data(), Memcard::BLOCK_SIZE);
 
-          if (gci.IsGood())
+          const bool written = gci.IsGood() && gci.Close();
+          if (written && File::Rename(temp_filename, save.m_filename))
           {
             Core::DisplayMessage(fmt::format("Wrote save contents to {}", save.m_filename), 4000);
           }
           else
           {
             ++errors;
+            File::Delete(temp_filename);
             Core::DisplayMessage(
                 fmt::format("Failed to write save contents to {}", save.m_filename), 4000);
             ERROR_LOG_FMT(EXPANSIONINTERFACE, "Failed to save data to {}", save.m_filename);
@@ -3,12 +3,16 @@
 
 #include "Core/HW/GCMemcard/GCMemcardRaw.h"
 
+#include <algorithm>
 #include <chrono>
+#include <cstdio>
 #include <cstring>
 #include <memory>
 #include <mutex>
 #include <string>
 #include <thread>
+#include <utility>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -74,6 +78,8 @@ MemoryCard::MemoryCard(const std::string& filename, int card_index, u16 size_mbi
   // Class members (including inherited ones) have now been initialized, so
   // it's safe to startup the flush thread (which reads them).
   m_flush_buffer = std::make_unique<u8[]>(m_memory_card_size);
+  m_dirty_blocks.assign((m_memory_card_size + Memcard::BLOCK_SIZE - 1) / Memcard::BLOCK_SIZE,
+                        false);
   m_flush_thread = std::thread(&MemoryCard::FlushThread, this);
 }
 
@@ -163,6 +169,10 @@ void MemoryCard::FlushThread()
     // file doesn't disappear out from under us after the first check.
     File::IOFile file(m_filename, "r+b");
 
+    // Only the blocks that changed need to be written, unless the file has to be created from
+    // scratch or doesn't match what we have in memory at all.
+    bool write_all = !file || file.GetSize() != m_memory_card_size;
+
     if (!file)
     {
       std::string dir;
@@ -189,15 +199,43 @@ void MemoryCard::FlushThread()
       return;
     }
 
+    // Runs of consecutive dirty blocks, as offset and length in bytes.
+    std::vector<std::pair<u32, u32>> runs;
     {
       std::unique_lock l(m_flush_mutex);
-      memcpy(&m_flush_buffer[0], &m_memcard_data[0], m_memory_card_size);
+      if (write_all)
+        std::fill(m_dirty_blocks.begin(), m_dirty_blocks.end(), true);
+
+      for (size_t block = 0; block < m_dirty_blocks.size(); ++block)
+      {
+        if (!m_dirty_blocks[block])
+          continue;
+        m_dirty_blocks[block] = false;
+
+        const u32 offset = static_cast<u32>(block * Memcard::BLOCK_SIZE);
+        const u32 length = std::min<u32>(Memcard::BLOCK_SIZE, m_memory_card_size - offset);
+        if (!runs.empty() && runs.back().first + runs.back().second == offset)
+          runs.back().second += length;
+        else
+          runs.emplace_back(offset, length);
+      }
+
+      for (const auto& [offset, length] : runs)
+        memcpy(&m_flush_buffer[offset], &m_memcard_data[offset], length);
+    }
+
+    for (const auto& [offset, length] : runs)
+    {
+      file.Seek(offset, SEEK_SET);
+      file.WriteBytes(&m_flush_buffer[offset], length);
     }
-    file.WriteBytes(&m_flush_buffer[0], m_memory_card_size);
 
     if (do_exit)
       return;
 
+    if (runs.empty())
+      continue;
+
     Core::DisplayMessage(
         fmt::format("Wrote memory card {} contents to {}", m_card_index ? 'B' : 'A', m_filename),
         4000);
@@ -209,6 +247,13 @@ void MemoryCard::MakeDirty()
   m_dirty.Set();
 }
 
+void MemoryCard::MarkBlocksDirty(u32 address, u32 length)
+{
+  const u32 end = std::min(address + length, m_memory_card_size);
+  for (u32 block = address / Memcard::BLOCK_SIZE; block * Memcard::BLOCK_SIZE < end; ++block)
+    m_dirty_blocks[block] = true;
+}
+
 s32 MemoryCard::Read(u32 src_address, s32 length, u8* dest_address)
 {
   if (!IsAddressInBounds(src_address))
@@ -233,6 +278,7 @@ s32 MemoryCard::Write(u32 dest_address, s32 length, const u8* src_address)
   {
     std::unique_lock l(m_flush_mutex);
     memcpy(&m_memcard_data[dest_address], src_address, length);
+    MarkBlocksDirty(dest_address, length);
   }
   MakeDirty();
   return length;
@@ -249,6 +295,7 @@ void MemoryCard::ClearBlock(u32 address)
   {
     std::unique_lock l(m_flush_mutex);
     memset(&m_memcard_data[address], 0xFF, Memcard::BLOCK_SIZE);
+    MarkBlocksDirty(address, Memcard::BLOCK_SIZE);
   }
   MakeDirty();
 }
@@ -258,6 +305,7 @@ void MemoryCard::ClearAll()
   {
     std::unique_lock l(m_flush_mutex);
     memset(&m_memcard_data[0], 0xFF, m_memory_card_size);
+    MarkBlocksDirty(0, m_memory_card_size);
   }
   MakeDirty();
 }
@@ -267,4 +315,11 @@ void MemoryCard::DoState(PointerWrap& p)
   p.Do(m_card_index);
   p.Do(m_memory_card_size);
   p.DoArray(&m_memcard_data[0], m_memory_card_size);
+
+  if (p.GetMode() == PointerWrap::MODE_READ)
+  {
+    // Any block may differ from the file after loading a state.
+    std::unique_lock l(m_flush_mutex);
+    MarkBlocksDirty(0, m_memory_card_size);
+  }
 }
@@ -7,6 +7,7 @@
 #include <mutex>
 #include <string>
 #include <thread>
+#include <vector>
 #include "Common/Event.h"
 #include "Common/Flag.h"
 #include "Core/HW/GCMemcard/GCMemcard.h"
@@ -31,6 +32,9 @@ public:
   void DoState(PointerWrap& p) override;
 
 private:
+  // Must be called with m_flush_mutex held.
+  void MarkBlocksDirty(u32 address, u32 length);
+
   std::string m_filename;
   std::unique_ptr<u8[]> m_memcard_data;
   std::unique_ptr<u8[]> m_flush_buffer;
@@ -38,4 +42,6 @@ private:
   std::mutex m_flush_mutex;
   Common::Event m_flush_trigger;
   Common::Flag m_dirty;
+  // Which blocks have changed since they were last written to the file. Guarded by m_flush_mutex.
+  std::vector<bool> m_dirty_blocks;
 };
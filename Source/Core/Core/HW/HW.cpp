@@ -8,6 +8,7 @@
 
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
+#include "Core/DSPEmulator.h"
 #include "Core/CoreTiming.h"
 #include "Core/HW/AddressSpace.h"
 #include "Core/HW/AudioInterface.h"
@@ -23,6 +24,7 @@
 #include "Core/HW/VideoInterface.h"
 #include "Core/HW/WII_IPC.h"
 #include "Core/IOS/IOS.h"
+#include "Core/RunAhead.h"
 #include "Core/State.h"
 
 namespace HW
@@ -71,12 +73,16 @@ void Shutdown()
   SerialInterface::Shutdown();
   AudioInterface::Shutdown();
 
+  RunAhead::Shutdown();
   State::Shutdown();
   CoreTiming::Shutdown();
 }
 
 void DoState(PointerWrap& p)
 {
+  // The DSP emulator may still have to write its results to RAM.
+  DSP::GetDSPEmulator()->DSP_Sync();
+
   Memory::DoState(p);
   p.DoMarker("Memory");
   VideoInterface::DoState(p);
@@ -12,11 +12,18 @@
 #include <array>
 #include <cstring>
 #include <memory>
+#include <vector>
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
 
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
+#include "Common/FlatHashMap.h"
 #include "Common/Logging/Log.h"
 #include "Common/MemArena.h"
+#include "Common/MemoryUtil.h"
 #include "Common/MsgHandler.h"
 #include "Common/Swap.h"
 #include "Core/Config/MainSettings.h"
@@ -32,6 +39,7 @@
 #include "Core/HW/VideoInterface.h"
 #include "Core/HW/WII_IPC.h"
 #include "Core/PowerPC/JitCommon/JitBase.h"
+#include "Core/PowerPC/MMU.h"
 #include "Core/PowerPC/PowerPC.h"
 #include "VideoCommon/CommandProcessor.h"
 #include "VideoCommon/PixelEngine.h"
@@ -78,6 +86,10 @@ static u32 s_exram_size_real;
 static u32 s_exram_size;
 static u32 s_exram_mask;
 
+static bool s_do_state_skips_ram = false;
+// Whether the views of physical memory are backed by huge pages where possible.
+static bool s_huge_pages = false;
+
 u32 GetRamSizeReal()
 {
   return s_ram_size_real;
@@ -227,6 +239,13 @@ static std::array<PhysicalMemoryRegion, 4> s_physical_regions;
 
 static std::vector<LogicalMemoryView> logical_mapped_entries;
 
+// Pages of the logical fastmem region which are mapped based on the page table, and whether they
+// are writable. Every page is a separate host mapping, so their number is limited.
+constexpr u32 PAGE_TABLE_PAGE_SIZE = 0x1000;
+constexpr u32 MAX_PAGE_TABLE_MAPPINGS = 8192;
+static bool s_page_table_fastmem = false;
+static Common::FlatHashMap<u32, bool> s_page_table_mappings;
+
 void Init()
 {
   const auto get_mem1_size = [] {
@@ -283,6 +302,7 @@ void Init()
     mem_size += region.size;
   }
   g_arena.GrabSHMSegment(mem_size);
+  s_huge_pages = Config::Get(Config::MAIN_HUGE_PAGES);
 
   // Create an anonymous view of the physical memory
   for (const PhysicalMemoryRegion& region : s_physical_regions)
@@ -299,6 +319,9 @@ void Init()
           region.physical_address, region.size);
       exit(0);
     }
+
+    if (s_huge_pages)
+      Common::AdviseHugePages(*region.out_pointer, region.size);
   }
 
   if (wii)
@@ -306,7 +329,15 @@ void Init()
   else
     mmio_mapping = InitMMIO();
 
-  Clear();
+  // Mapping single pages needs the host to use the same page size, and views on Windows have to
+  // be aligned to 64KB.
+#if !defined(_WIN32) && !defined(_ARCH_32)
+  s_page_table_fastmem = mmu && Config::Get(Config::MAIN_FASTMEM_PAGE_TABLE) &&
+                         sysconf(_SC_PAGESIZE) == PAGE_TABLE_PAGE_SIZE;
+#endif
+
+  // The segment was just created, so it is already zeroed. Not clearing it again means that the
+  // pages are only committed once the game writes to them.
 
   INFO_LOG_FMT(MEMMAP, "Memory system initialized. RAM at {}", fmt::ptr(m_pRAM));
   m_IsInitialized = true;
@@ -337,6 +368,9 @@ bool InitFastmemArena()
                     region.physical_address, region.size);
       return false;
     }
+
+    if (s_huge_pages)
+      Common::AdviseHugePages(view, region.size);
   }
 
 #ifndef _ARCH_32
@@ -352,6 +386,8 @@ void UpdateLogicalMemory(const PowerPC::BatTable& dbat_table)
   if (!is_fastmem_arena_initialized)
     return;
 
+  InvalidatePageTableMappings(0, 0);
+
   for (auto& entry : logical_mapped_entries)
   {
     g_arena.ReleaseView(entry.mapped_pointer, entry.mapped_size);
@@ -396,8 +432,101 @@ void UpdateLogicalMemory(const PowerPC::BatTable& dbat_table)
   }
 }
 
+bool HandlePageTableFault(uintptr_t fault_address)
+{
+  if (!s_page_table_fastmem || !is_fastmem_arena_initialized)
+    return false;
+
+  const auto logical_base_ptr = reinterpret_cast<uintptr_t>(logical_base);
+  if (fault_address < logical_base_ptr || fault_address >= logical_base_ptr + 0x100000000)
+    return false;
+
+  const u32 page = static_cast<u32>(fault_address - logical_base_ptr) & ~(PAGE_TABLE_PAGE_SIZE - 1);
+  u8* const base = logical_base + page;
+
+  // Reads succeed on read-only pages, so a fault on one of them has to be a write.
+  if (bool* writable = s_page_table_mappings.Find(page))
+  {
+    if (*writable || !PowerPC::TranslatePageTableMapping(page, true))
+      return false;
+
+    Common::UnWriteProtectMemory(base, PAGE_TABLE_PAGE_SIZE);
+    *writable = true;
+    return true;
+  }
+
+  const std::optional<PowerPC::PageTableMapping> mapping =
+      PowerPC::TranslatePageTableMapping(page, false);
+  if (!mapping)
+    return false;
+
+  const auto region = std::find_if(
+      s_physical_regions.begin(), s_physical_regions.end(), [&](const PhysicalMemoryRegion& r) {
+        return r.active && mapping->physical_address >= r.physical_address &&
+               mapping->physical_address - r.physical_address < r.size;
+      });
+  if (region == s_physical_regions.end())
+    return false;
+
+  if (s_page_table_mappings.Size() >= MAX_PAGE_TABLE_MAPPINGS)
+    InvalidatePageTableMappings(0, 0);
+
+  const u32 position = region->shm_position + mapping->physical_address - region->physical_address;
+  if (g_arena.CreateView(position, PAGE_TABLE_PAGE_SIZE, base) != base)
+  {
+    ERROR_LOG_FMT(MEMMAP, "Failed to map page 0x{:08X} into logical fastmem region", page);
+    return false;
+  }
+  if (!mapping->writable)
+    Common::WriteProtectMemory(base, PAGE_TABLE_PAGE_SIZE);
+
+  s_page_table_mappings.InsertOrAssign(page, mapping->writable);
+  return true;
+}
+
+void InvalidatePageTableMappings(u32 address, u32 mask)
+{
+  if (s_page_table_mappings.Empty())
+    return;
+
+  std::vector<u32> pages;
+  s_page_table_mappings.ForEach([&](u32 page, bool) {
+    if ((page & mask) == (address & mask))
+      pages.push_back(page);
+  });
+
+  for (u32 page : pages)
+  {
+    g_arena.ReleaseView(logical_base + page, PAGE_TABLE_PAGE_SIZE);
+    s_page_table_mappings.Erase(page);
+  }
+}
+
+std::vector<StateRegion> GetStateRegions()
+{
+  std::vector<StateRegion> regions;
+  regions.push_back({m_pRAM, GetRamSize()});
+  regions.push_back({m_pL1Cache, GetL1CacheSize()});
+  if (m_pFakeVMEM)
+    regions.push_back({m_pFakeVMEM, GetFakeVMemSize()});
+  if (SConfig::GetInstance().bWii)
+    regions.push_back({m_pEXRAM, GetExRamSize()});
+  return regions;
+}
+
+void SetDoStateSkipsRAM(bool skip)
+{
+  s_do_state_skips_ram = skip;
+}
+
 void DoState(PointerWrap& p)
 {
+  if (s_do_state_skips_ram)
+  {
+    p.DoMarker("Memory skipped");
+    return;
+  }
+
   bool wii = SConfig::GetInstance().bWii;
   p.DoArray(m_pRAM, GetRamSize());
   p.DoArray(m_pL1Cache, GetL1CacheSize());
@@ -420,6 +549,17 @@ void Shutdown()
     if (!region.active)
       continue;
 
+    INFO_LOG_FMT(MEMMAP, "Physical region at 0x{:08X}: {} of {} KiB resident",
+                 region.physical_address,
+                 Common::GetResidentBytes(*region.out_pointer, region.size) / 1024,
+                 region.size / 1024);
+    if (s_huge_pages)
+    {
+      INFO_LOG_FMT(MEMMAP, "Physical region at 0x{:08X}: {} KiB backed by huge pages",
+                   region.physical_address,
+                   Common::GetHugePageBytes(*region.out_pointer, region.size) / 1024);
+    }
+
     g_arena.ReleaseView(*region.out_pointer, region.size);
     *region.out_pointer = nullptr;
   }
@@ -447,6 +587,7 @@ void ShutdownFastmemArena()
     g_arena.ReleaseView(entry.mapped_pointer, entry.mapped_size);
   }
   logical_mapped_entries.clear();
+  InvalidatePageTableMappings(0, 0);
 
   physical_base = nullptr;
   logical_base = nullptr;
@@ -508,6 +649,65 @@ void CopyToEmu(u32 address, const void* data, size_t size)
   memcpy(pointer, data, size);
 }
 
+void CopyFromEmuSwapped16(void* data, u32 address, size_t count)
+{
+  if (count == 0)
+    return;
+
+  const void* pointer = GetPointerForRange(address, count * sizeof(u16));
+  if (!pointer)
+  {
+    PanicAlertFmt("Invalid range in CopyFromEmuSwapped16. {:x} halfwords from {:#010x}", count,
+                  address);
+    return;
+  }
+  Common::SwapCopy16(data, pointer, count);
+}
+
+void CopyFromEmuSwapped32(void* data, u32 address, size_t count)
+{
+  if (count == 0)
+    return;
+
+  const void* pointer = GetPointerForRange(address, count * sizeof(u32));
+  if (!pointer)
+  {
+    PanicAlertFmt("Invalid range in CopyFromEmuSwapped32. {:x} words from {:#010x}", count,
+                  address);
+    return;
+  }
+  Common::SwapCopy32(data, pointer, count);
+}
+
+void CopyToEmuSwapped16(u32 address, const void* data, size_t count)
+{
+  if (count == 0)
+    return;
+
+  void* pointer = GetPointerForRange(address, count * sizeof(u16));
+  if (!pointer)
+  {
+    PanicAlertFmt("Invalid range in CopyToEmuSwapped16. {:x} halfwords to {:#010x}", count,
+                  address);
+    return;
+  }
+  Common::SwapCopy16(pointer, data, count);
+}
+
+void CopyToEmuSwapped32(u32 address, const void* data, size_t count)
+{
+  if (count == 0)
+    return;
+
+  void* pointer = GetPointerForRange(address, count * sizeof(u32));
+  if (!pointer)
+  {
+    PanicAlertFmt("Invalid range in CopyToEmuSwapped32. {:x} words to {:#010x}", count, address);
+    return;
+  }
+  Common::SwapCopy32(pointer, data, count);
+}
+
 void Memset(u32 address, u8 value, size_t size)
 {
   if (size == 0)
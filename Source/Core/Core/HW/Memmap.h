@@ -5,6 +5,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/MathUtil.h"
@@ -66,8 +67,30 @@ bool InitFastmemArena();
 void ShutdownFastmemArena();
 void DoState(PointerWrap& p);
 
+// A block of emulated memory whose contents are saved by DoState.
+struct StateRegion
+{
+  u8* data;
+  u32 size;
+};
+
+// Returns the blocks of memory saved by DoState, in the order they are saved.
+std::vector<StateRegion> GetStateRegions();
+
+// Delta savestates store the contents of the StateRegions themselves, one page at a time.
+// While this is set, DoState leaves them out.
+void SetDoStateSkipsRAM(bool skip);
+
 void UpdateLogicalMemory(const PowerPC::BatTable& dbat_table);
 
+// With FastmemPageTable enabled, pages which are translated by the page table are mapped into the
+// logical fastmem region when a fastmem access to them faults. Pages whose changed bit isn't set
+// yet are mapped read-only, so that the first write faults again and sets it.
+// Returns true if the faulting access can be retried.
+bool HandlePageTableFault(uintptr_t fault_address);
+// Unmaps the page table mappings of every page with (logical address & mask) == (address & mask).
+void InvalidatePageTableMappings(u32 address, u32 mask);
+
 void Clear();
 
 // Routines to access physically addressed memory, designed for use by
@@ -88,28 +111,31 @@ void Write_U64(u64 var, u32 address);
 void Write_U32_Swap(u32 var, u32 address);
 void Write_U64_Swap(u64 var, u32 address);
 
+// Byteswapped copies of 16-, 32- or 64-bit elements. The range must not cross the end of MEM1 or
+// MEM2.
+void CopyFromEmuSwapped16(void* data, u32 address, size_t count);
+void CopyFromEmuSwapped32(void* data, u32 address, size_t count);
+void CopyToEmuSwapped16(u32 address, const void* data, size_t count);
+void CopyToEmuSwapped32(u32 address, const void* data, size_t count);
+
 // Templated functions for byteswapped copies.
 template <typename T>
 void CopyFromEmuSwapped(T* data, u32 address, size_t size)
 {
-  const T* src = reinterpret_cast<T*>(GetPointer(address));
-
-  if (src == nullptr)
-    return;
-
-  for (size_t i = 0; i < size / sizeof(T); i++)
-    data[i] = Common::FromBigEndian(src[i]);
+  static_assert(sizeof(T) == 2 || sizeof(T) == 4);
+  if constexpr (sizeof(T) == 2)
+    CopyFromEmuSwapped16(data, address, size / sizeof(T));
+  else
+    CopyFromEmuSwapped32(data, address, size / sizeof(T));
 }
 
 template <typename T>
 void CopyToEmuSwapped(u32 address, const T* data, size_t size)
 {
-  T* dest = reinterpret_cast<T*>(GetPointer(address));
-
-  if (dest == nullptr)
-    return;
-
-  for (size_t i = 0; i < size / sizeof(T); i++)
-    dest[i] = Common::FromBigEndian(data[i]);
+  static_assert(sizeof(T) == 2 || sizeof(T) == 4);
+  if constexpr (sizeof(T) == 2)
+    CopyToEmuSwapped16(address, data, size / sizeof(T));
+  else
+    CopyToEmuSwapped32(address, data, size / sizeof(T));
 }
 }  // namespace Memory
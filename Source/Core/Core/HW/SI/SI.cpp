@@ -652,8 +652,14 @@ void UpdateDevices()
 
   // Update inputs at the rate of SI
   // Typically 120hz but is variable
+  // Updating goes through every host device, so skip it when no channel has a device that could
+  // read them, which is usually the case in Wii games.
+  const bool has_devices = std::any_of(s_channel.begin(), s_channel.end(), [](const auto& channel) {
+    return channel.device->GetDeviceType() != SIDEVICE_NONE;
+  });
   g_controller_interface.SetCurrentInputChannel(ciface::InputChannel::SerialInterface);
-  g_controller_interface.UpdateInput();
+  if (has_devices)
+    g_controller_interface.UpdateInput();
 
   // Update channels and set the status bit if there's new data
   s_status_reg.RDST0 =
@@ -47,6 +47,9 @@ constexpr auto GBA_BITS_PER_SECOND = 250000;
 constexpr auto GC_STOP_BIT_NS = 6500;
 constexpr auto GBA_STOP_BIT_NS = 14000;
 constexpr auto SEND_MAX_SIZE = 5, RECV_MAX_SIZE = 5;
+// Clock syncs shorter than this are carried over into the next one instead of being sent on their
+// own, so that back-to-back transfers don't each cost a round of socket writes.
+constexpr auto CLOCK_SYNC_MIN_US = 250;
 
 // --- GameBoy Advance "Link Cable" ---
 
@@ -177,6 +180,7 @@ void GBASockServer::Disconnect()
   if (m_client)
   {
     s_num_connected--;
+    m_selector.clear();
     m_client->disconnect();
     m_client = nullptr;
   }
@@ -187,6 +191,7 @@ void GBASockServer::Disconnect()
   }
   m_last_time_slice = 0;
   m_booted = false;
+  m_needs_flush = false;
 }
 
 void GBASockServer::ClockSync()
@@ -205,7 +210,10 @@ void GBASockServer::ClockSync()
   }
   else
   {
-    time_slice = (u32)(CoreTiming::GetTicks() - m_last_time_slice);
+    const u64 elapsed = CoreTiming::GetTicks() - m_last_time_slice;
+    if (elapsed < SystemTimers::GetTicksPerSecond() / 1000000 * CLOCK_SYNC_MIN_US)
+      return;
+    time_slice = (u32)elapsed;
   }
 
   time_slice = (u32)((u64)time_slice * 16777216 / SystemTimers::GetTicksPerSecond());
@@ -230,7 +238,11 @@ bool GBASockServer::Connect()
   {
     m_client = GetNextSock();
     if (m_client)
+    {
       m_client->setBlocking(false);
+      m_selector.clear();
+      m_selector.add(*m_client);
+    }
   }
   return IsConnected();
 }
@@ -267,11 +279,7 @@ int GBASockServer::Receive(u8* si_buffer, u8 bytes)
     return 0;
 
   if (m_booted)
-  {
-    sf::SocketSelector selector;
-    selector.add(*m_client);
-    selector.wait(sf::milliseconds(1000));
-  }
+    m_selector.wait(sf::milliseconds(1000));
 
   size_t num_received = 0;
   std::array<u8, RECV_MAX_SIZE> recv_data;
@@ -285,9 +293,12 @@ int GBASockServer::Receive(u8* si_buffer, u8 bytes)
   if (recv_stat == sf::Socket::NotReady || num_received == 0)
   {
     m_booted = false;
+    m_needs_flush = true;
     return 0;
   }
   m_booted = true;
+  // A short reply means the rest of it may still arrive and has to be discarded later.
+  m_needs_flush = num_received < bytes;
 
   for (size_t i = 0; i < recv_data.size(); i++)
     si_buffer[i] = recv_data[i];
@@ -296,8 +307,10 @@ int GBASockServer::Receive(u8* si_buffer, u8 bytes)
 
 void GBASockServer::Flush()
 {
-  if (!m_client)
+  // Only replies we gave up waiting for can be left over, so skip the extra receive otherwise.
+  if (!m_client || !m_needs_flush)
     return;
+  m_needs_flush = false;
 
   size_t num_received = 1;
   u8 byte;
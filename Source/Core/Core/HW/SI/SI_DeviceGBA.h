@@ -35,9 +35,11 @@ private:
 
   std::unique_ptr<sf::TcpSocket> m_client;
   std::unique_ptr<sf::TcpSocket> m_clock_sync;
+  sf::SocketSelector m_selector;
 
   u64 m_last_time_slice = 0;
   bool m_booted = false;
+  bool m_needs_flush = false;
 };
 
 class CSIDevice_GBA : public ISIDevice
@@ -4,6 +4,7 @@
 // Adapted from in_cube by hcs & destop
 
 #include <algorithm>
+#include <array>
 
 #include "Core/HW/StreamADPCM.h"
 
@@ -12,36 +13,45 @@
 
 namespace StreamADPCM
 {
-static s16 ADPDecodeSample(s32 bits, s32 q, s32& hist1, s32& hist2)
+namespace
 {
-  s32 hist = 0;
-  switch (q >> 4)
-  {
-  case 0:
-    hist = 0;
-    break;
-  case 1:
-    hist = (hist1 * 0x3c);
-    break;
-  case 2:
-    hist = (hist1 * 0x73) - (hist2 * 0x34);
-    break;
-  case 3:
-    hist = (hist1 * 0x62) - (hist2 * 0x37);
-    break;
-  }
-  hist = std::clamp((hist + 0x20) >> 6, -0x200000, 0x1fffff);
+struct Coefficients
+{
+  s32 hist1;
+  s32 hist2;
+};
+
+// Indexed by the upper nibble of a block's header byte. Predictors above 3 don't exist and use
+// no history at all.
+constexpr std::array<Coefficients, 16> COEFFICIENTS = {{
+    {0, 0},
+    {0x3c, 0},
+    {0x73, -0x34},
+    {0x62, -0x37},
+}};
+
+// Decodes the 28 samples of one channel of a block. The predictor and scale are the same for the
+// whole block, so they're looked up once here instead of for every sample.
+void DecodeChannel(s16* pcm, const u8* nibbles, u32 shift, u8 header, s32& hist1, s32& hist2)
+{
+  const Coefficients coefs = COEFFICIENTS[header >> 4];
+  const u32 scale = header & 0xf;
 
-  s32 cur = (((s16)(bits << 12) >> (q & 0xf)) << 6) + hist;
+  for (int i = 0; i < SAMPLES_PER_BLOCK; i++)
+  {
+    const s32 bits = (nibbles[i] >> shift) & 0xf;
+    const s32 hist = std::clamp((hist1 * coefs.hist1 + hist2 * coefs.hist2 + 0x20) >> 6,
+                                -0x200000, 0x1fffff);
 
-  hist2 = hist1;
-  hist1 = cur;
+    const s32 cur = (((s16)(bits << 12) >> scale) << 6) + hist;
 
-  cur >>= 6;
-  cur = std::clamp(cur, -0x8000, 0x7fff);
+    hist2 = hist1;
+    hist1 = cur;
 
-  return (s16)cur;
+    pcm[i * 2] = (s16)std::clamp(cur >> 6, -0x8000, 0x7fff);
+  }
 }
+}  // namespace
 
 void ADPCMDecoder::ResetFilter()
 {
@@ -61,12 +71,8 @@ void ADPCMDecoder::DoState(PointerWrap& p)
 
 void ADPCMDecoder::DecodeBlock(s16* pcm, const u8* adpcm)
 {
-  for (int i = 0; i < SAMPLES_PER_BLOCK; i++)
-  {
-    pcm[i * 2] = ADPDecodeSample(adpcm[i + (ONE_BLOCK_SIZE - SAMPLES_PER_BLOCK)] & 0xf, adpcm[0],
-                                 m_histl1, m_histl2);
-    pcm[i * 2 + 1] = ADPDecodeSample(adpcm[i + (ONE_BLOCK_SIZE - SAMPLES_PER_BLOCK)] >> 4, adpcm[1],
-                                     m_histr1, m_histr2);
-  }
+  const u8* nibbles = adpcm + (ONE_BLOCK_SIZE - SAMPLES_PER_BLOCK);
+  DecodeChannel(pcm, nibbles, 0, adpcm[0], m_histl1, m_histl2);
+  DecodeChannel(pcm + 1, nibbles, 4, adpcm[1], m_histr1, m_histr2);
 }
 }  // namespace StreamADPCM
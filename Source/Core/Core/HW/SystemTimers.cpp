@@ -63,6 +63,7 @@ IPC_HLE_PERIOD: For the Wii Remote this is the call schedule:
 #include "Core/IOS/IOS.h"
 #include "Core/PatchEngine.h"
 #include "Core/PowerPC/PowerPC.h"
+#include "Core/RunAhead.h"
 #include "VideoCommon/Fifo.h"
 
 namespace SystemTimers
@@ -130,7 +131,7 @@ void IPC_HLE_UpdateCallback(u64 userdata, s64 cyclesLate)
 void VICallback(u64 userdata, s64 cyclesLate)
 {
   VideoInterface::Update(CoreTiming::GetTicks() - cyclesLate);
-  CoreTiming::ScheduleEvent(VideoInterface::GetTicksPerHalfLine() - cyclesLate, et_VI);
+  CoreTiming::ScheduleEvent(VideoInterface::GetTicksUntilNextUpdate() - cyclesLate, et_VI);
 }
 
 void DecrementerCallback(u64 userdata, s64 cyclesLate)
@@ -173,7 +174,8 @@ void ThrottleCallback(u64 last_time, s64 cyclesLate)
 
   s64 diff = last_time - time;
   const SConfig& config = SConfig::GetInstance();
-  bool frame_limiter = config.m_EmulationSpeed > 0.0f && !Core::GetIsThrottlerTempDisabled();
+  bool frame_limiter = config.m_EmulationSpeed > 0.0f && !Core::GetIsThrottlerTempDisabled() &&
+                       !RunAhead::IsRunningAhead();
   u32 next_event = GetTicksPerSecond() / 1000;
 
   {
@@ -288,6 +290,12 @@ void ChangePPCClock(Mode mode)
   CoreTiming::AdjustEventQueueTimes(s_cpu_core_clock, previous_clock);
 }
 
+void RescheduleVIUpdate(s64 ticks_into_future)
+{
+  CoreTiming::RemoveEvent(et_VI);
+  CoreTiming::ScheduleEvent(ticks_into_future, et_VI);
+}
+
 void Init()
 {
   if (SConfig::GetInstance().bWii)
@@ -53,6 +53,9 @@ void Init();
 void Shutdown();
 void ChangePPCClock(Mode mode);
 
+// Moves the next VideoInterface update to the specified number of ticks from now.
+void RescheduleVIUpdate(s64 ticks_into_future);
+
 // Notify timing system that somebody wrote to the decrementer
 void DecrementerSet();
 u32 GetFakeDecrementer();
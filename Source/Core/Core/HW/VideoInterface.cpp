@@ -24,6 +24,7 @@
 #include "Core/HW/SI/SI.h"
 #include "Core/HW/SystemTimers.h"
 #include "Core/Movie.h"
+#include "Core/RunAhead.h"
 
 #include "DiscIO/Enums.h"
 
@@ -73,6 +74,12 @@ static u32 s_half_line_count;        // number of halflines that have occurred f
 static u32 s_half_line_of_next_si_poll;  // halfline when next SI poll results should be available
 static constexpr u32 num_half_lines_for_si_poll = (7 * 2) + 1;  // this is how long an SI poll takes
 
+// When skipping idle half-lines, updates only run on half-lines where something happens. The
+// half-lines in between only advance the beam position, which is caught up with when needed.
+static bool s_skip_idle_half_lines;
+static u64 s_ticks_last_update;            // number of ticks when the last update was scheduled
+static u32 s_half_lines_until_update = 1;  // halflines from the last update to the next one
+
 // below indexes are 0-based
 static u32 s_even_field_first_hl;  // index first halfline of the even field
 static u32 s_odd_field_first_hl;   // index first halfline of the odd field
@@ -106,6 +113,8 @@ void DoState(PointerWrap& p)
   p.Do(s_ticks_last_line_start);
   p.Do(s_half_line_count);
   p.Do(s_half_line_of_next_si_poll);
+  p.Do(s_ticks_last_update);
+  p.Do(s_half_lines_until_update);
 
   UpdateParameters();
 }
@@ -190,6 +199,10 @@ void Preset(bool _bNTSC)
   s_half_line_count = 0;
   s_half_line_of_next_si_poll = num_half_lines_for_si_poll;  // first sampling starts at vsync
 
+  s_skip_idle_half_lines = Config::Get(Config::MAIN_SKIP_IDLE_VI_HALF_LINES);
+  s_ticks_last_update = 0;
+  s_half_lines_until_update = 1;
+
   UpdateParameters();
 }
 
@@ -198,6 +211,66 @@ void Init()
   Preset(true);
 }
 
+static u32 GetHalfLinesPerEvenField();
+static u32 GetHalfLinesPerOddField();
+
+// Advances the beam position over half-lines whose updates were skipped, since they wouldn't have
+// done anything else.
+static void AdvanceSkippedHalfLines(u32 count)
+{
+  if (count == 0)
+    return;
+
+  // Updates are never skipped past the end of the frame, so this wraps around at most once.
+  const u32 total_half_lines = GetHalfLinesPerEvenField() + GetHalfLinesPerOddField();
+  s_half_line_count += count;
+  if (s_half_line_count >= total_half_lines)
+    s_half_line_count -= total_half_lines;
+
+  // The current full line started either on the last skipped half-line or the one before.
+  const u32 ticks_per_half_line = GetTicksPerHalfLine();
+  if (!(s_half_line_count & 1))
+    s_ticks_last_line_start = s_ticks_last_update + u64{count} * ticks_per_half_line;
+  else if (count > 1)
+    s_ticks_last_line_start = s_ticks_last_update + u64{count - 1} * ticks_per_half_line;
+
+  s_ticks_last_update += u64{count} * ticks_per_half_line;
+  s_half_lines_until_update -= count;
+}
+
+// Brings the beam position up to date with the half-lines which have passed by now.
+static void CatchUpSkippedHalfLines()
+{
+  const u64 ticks = CoreTiming::GetTicks();
+  if (s_half_lines_until_update <= 1 || ticks < s_ticks_last_update)
+    return;
+
+  const u64 passed_half_lines = (ticks - s_ticks_last_update) / GetTicksPerHalfLine();
+  AdvanceSkippedHalfLines(
+      static_cast<u32>(std::min<u64>(passed_half_lines, s_half_lines_until_update - 1)));
+}
+
+// Must be called before changing anything that decides which half-lines need an update.
+static void BeginTimingChange()
+{
+  if (s_half_lines_until_update <= 1)
+    return;
+
+  // Update on the next half-line again, which finds the next one that needs an update under the
+  // new timings.
+  CatchUpSkippedHalfLines();
+  s_half_lines_until_update = 1;
+  SystemTimers::RescheduleVIUpdate(
+      static_cast<s64>(s_ticks_last_update + GetTicksPerHalfLine() - CoreTiming::GetTicks()));
+}
+
+static void SetInterruptRegister(UVIInterruptRegister& reg, UVIInterruptRegister new_reg)
+{
+  if (new_reg.HCT != reg.HCT || new_reg.VCT != reg.VCT)
+    BeginTimingChange();
+  reg = new_reg;
+}
+
 void RegisterMMIO(MMIO::Mapping* mmio, u32 base)
 {
   struct MappedVar
@@ -206,7 +279,7 @@ void RegisterMMIO(MMIO::Mapping* mmio, u32 base)
     u16* ptr;
   };
 
-  std::array<MappedVar, 46> directly_mapped_vars{{
+  std::array<MappedVar, 42> directly_mapped_vars{{
       {VI_VERTICAL_TIMING, &m_VerticalTimingRegister.Hex},
       {VI_HORIZONTAL_TIMING_0_HI, &m_HTiming0.Hi},
       {VI_HORIZONTAL_TIMING_0_LO, &m_HTiming0.Lo},
@@ -224,10 +297,6 @@ void RegisterMMIO(MMIO::Mapping* mmio, u32 base)
       {VI_FB_RIGHT_TOP_LO, &m_3DFBInfoTop.Lo},
       {VI_FB_LEFT_BOTTOM_LO, &m_XFBInfoBottom.Lo},
       {VI_FB_RIGHT_BOTTOM_LO, &m_3DFBInfoBottom.Lo},
-      {VI_PRERETRACE_LO, &m_InterruptRegister[0].Lo},
-      {VI_POSTRETRACE_LO, &m_InterruptRegister[1].Lo},
-      {VI_DISPLAY_INTERRUPT_2_LO, &m_InterruptRegister[2].Lo},
-      {VI_DISPLAY_INTERRUPT_3_LO, &m_InterruptRegister[3].Lo},
       {VI_DISPLAY_LATCH_0_HI, &m_LatchRegister[0].Hi},
       {VI_DISPLAY_LATCH_0_LO, &m_LatchRegister[0].Lo},
       {VI_DISPLAY_LATCH_1_HI, &m_LatchRegister[1].Hi},
@@ -278,6 +347,7 @@ void RegisterMMIO(MMIO::Mapping* mmio, u32 base)
   {
     mmio->Register(base | mapped_var.addr, MMIO::DirectRead<u16>(mapped_var.ptr),
                    MMIO::ComplexWrite<u16>([mapped_var](u32, u16 val) {
+                     BeginTimingChange();
                      *mapped_var.ptr = val;
                      UpdateParameters();
                    }));
@@ -312,7 +382,10 @@ void RegisterMMIO(MMIO::Mapping* mmio, u32 base)
   // MMIOs with unimplemented writes that trigger warnings.
   mmio->Register(
       base | VI_VERTICAL_BEAM_POSITION,
-      MMIO::ComplexRead<u16>([](u32) { return 1 + (s_half_line_count) / 2; }),
+      MMIO::ComplexRead<u16>([](u32) {
+        CatchUpSkippedHalfLines();
+        return 1 + (s_half_line_count) / 2;
+      }),
       MMIO::ComplexWrite<u16>([](u32, u16 val) {
         WARN_LOG_FMT(
             VIDEOINTERFACE,
@@ -320,6 +393,7 @@ void RegisterMMIO(MMIO::Mapping* mmio, u32 base)
       }));
   mmio->Register(
       base | VI_HORIZONTAL_BEAM_POSITION, MMIO::ComplexRead<u16>([](u32) {
+        CatchUpSkippedHalfLines();
         u16 value = static_cast<u16>(1 + m_HTiming0.HLW *
                                              (CoreTiming::GetTicks() - s_ticks_last_line_start) /
                                              (GetTicksPerHalfLine()));
@@ -336,27 +410,53 @@ void RegisterMMIO(MMIO::Mapping* mmio, u32 base)
   // on writes.
   mmio->Register(base | VI_PRERETRACE_HI, MMIO::DirectRead<u16>(&m_InterruptRegister[0].Hi),
                  MMIO::ComplexWrite<u16>([](u32, u16 val) {
-                   m_InterruptRegister[0].Hi = val;
+                   UVIInterruptRegister new_reg = m_InterruptRegister[0];
+                   new_reg.Hi = val;
+                   SetInterruptRegister(m_InterruptRegister[0], new_reg);
                    UpdateInterrupts();
                  }));
   mmio->Register(base | VI_POSTRETRACE_HI, MMIO::DirectRead<u16>(&m_InterruptRegister[1].Hi),
                  MMIO::ComplexWrite<u16>([](u32, u16 val) {
-                   m_InterruptRegister[1].Hi = val;
+                   UVIInterruptRegister new_reg = m_InterruptRegister[1];
+                   new_reg.Hi = val;
+                   SetInterruptRegister(m_InterruptRegister[1], new_reg);
                    UpdateInterrupts();
                  }));
   mmio->Register(base | VI_DISPLAY_INTERRUPT_2_HI,
                  MMIO::DirectRead<u16>(&m_InterruptRegister[2].Hi),
                  MMIO::ComplexWrite<u16>([](u32, u16 val) {
-                   m_InterruptRegister[2].Hi = val;
+                   UVIInterruptRegister new_reg = m_InterruptRegister[2];
+                   new_reg.Hi = val;
+                   SetInterruptRegister(m_InterruptRegister[2], new_reg);
                    UpdateInterrupts();
                  }));
   mmio->Register(base | VI_DISPLAY_INTERRUPT_3_HI,
                  MMIO::DirectRead<u16>(&m_InterruptRegister[3].Hi),
                  MMIO::ComplexWrite<u16>([](u32, u16 val) {
-                   m_InterruptRegister[3].Hi = val;
+                   UVIInterruptRegister new_reg = m_InterruptRegister[3];
+                   new_reg.Hi = val;
+                   SetInterruptRegister(m_InterruptRegister[3], new_reg);
                    UpdateInterrupts();
                  }));
 
+  // The horizontal positions of interrupts decide which half-line they are raised on.
+  std::array<u32, 4> interrupt_register_lo_addrs{{
+      VI_PRERETRACE_LO,
+      VI_POSTRETRACE_LO,
+      VI_DISPLAY_INTERRUPT_2_LO,
+      VI_DISPLAY_INTERRUPT_3_LO,
+  }};
+  for (size_t i = 0; i < interrupt_register_lo_addrs.size(); i++)
+  {
+    mmio->Register(base | interrupt_register_lo_addrs[i],
+                   MMIO::DirectRead<u16>(&m_InterruptRegister[i].Lo),
+                   MMIO::ComplexWrite<u16>([i](u32, u16 val) {
+                     UVIInterruptRegister new_reg = m_InterruptRegister[i];
+                     new_reg.Lo = val;
+                     SetInterruptRegister(m_InterruptRegister[i], new_reg);
+                   }));
+  }
+
   // Unknown anti-aliasing related MMIO register: puts a warning on log and
   // needs to shift/mask when reading/writing.
   mmio->Register(base | VI_UNK_AA_REG_HI,
@@ -376,6 +476,8 @@ void RegisterMMIO(MMIO::Mapping* mmio, u32 base)
   // processing needs to be done if a reset is requested.
   mmio->Register(base | VI_CONTROL_REGISTER, MMIO::DirectRead<u16>(&m_DisplayControlRegister.Hex),
                  MMIO::ComplexWrite<u16>([](u32, u16 val) {
+                   BeginTimingChange();
+
                    UVIDisplayControlRegister tmpConfig(val);
                    m_DisplayControlRegister.ENB = tmpConfig.ENB;
                    m_DisplayControlRegister.NIN = tmpConfig.NIN;
@@ -733,6 +835,53 @@ u32 GetTicksPerField()
   return GetTicksPerEvenField();
 }
 
+u32 GetTicksUntilNextUpdate()
+{
+  return GetTicksPerHalfLine() * s_half_lines_until_update;
+}
+
+// Returns the number of half-lines until the next one whose update does more than advancing the
+// beam position.
+static u32 GetHalfLinesUntilNextUpdate()
+{
+  const u32 total_half_lines = GetHalfLinesPerEvenField() + GetHalfLinesPerOddField();
+  if (!s_skip_idle_half_lines || s_half_line_count >= total_half_lines)
+    return 1;
+
+  // Half-lines which wrap around are never reached, so they don't need an update.
+  u32 half_lines_until_update = total_half_lines;
+  const auto update_on = [&](u32 half_line) {
+    if (half_line < total_half_lines)
+    {
+      const u32 distance =
+          (half_line + total_half_lines - s_half_line_count) % total_half_lines + 1;
+      half_lines_until_update = std::min(half_lines_until_update, distance);
+    }
+  };
+
+  // Field boundaries, which also reset the SI poll timing.
+  update_on(0);
+  update_on(GetHalfLinesPerEvenField());
+  update_on(s_even_field_first_hl);
+  update_on(s_odd_field_first_hl);
+  update_on(s_even_field_last_hl);
+  update_on(s_odd_field_last_hl);
+  update_on(s_half_line_of_next_si_poll);
+
+  // Interrupts are checked against the half-line after the one being updated.
+  for (const UVIInterruptRegister& reg : m_InterruptRegister)
+  {
+    if (reg.VCT == 0)
+      continue;
+    const u32 target_halfline = (reg.HCT > m_HTiming0.HLW) ? 1 : 0;
+    const u32 half_line = 2 * (reg.VCT - 1) + target_halfline;
+    if (half_line < total_half_lines)
+      update_on((half_line + total_half_lines - 1) % total_half_lines);
+  }
+
+  return half_lines_until_update;
+}
+
 static void LogField(FieldType field, u32 xfb_address)
 {
   static constexpr std::array<const char*, 2> field_type_names{{"Odd", "Even"}};
@@ -815,12 +964,20 @@ static void BeginField(FieldType field, u64 ticks)
   // frame is scanning out.
   // To correctly handle that case we would need to collate all changes
   // to VI during scanout and delay outputting the frame till then.
-  if (xfbAddr)
+  if (xfbAddr && !RunAhead::IsFrameHidden())
     g_video_backend->Video_BeginField(xfbAddr, fbWidth, fbStride, fbHeight, ticks);
+
+  // Run-ahead switches between the emulated frames right after a field has been output, so that
+  // the field which is shown is the one emulated furthest ahead.
+  RunAhead::OnBeginField();
 }
 
 static void EndField()
 {
+  // Frames emulated ahead of time don't take any time as far as the user is concerned.
+  if (RunAhead::IsRunningAhead())
+    return;
+
   Core::VideoThrottle();
   Core::OnFrameEnd();
 }
@@ -829,6 +986,9 @@ static void EndField()
 // Run when: When a frame is scanned (progressive/interlace)
 void Update(u64 ticks)
 {
+  // Catch up with the half-lines since the last update, which leaves only the current one.
+  AdvanceSkippedHalfLines(s_half_lines_until_update - 1);
+
   // Movie's frame counter should be updated before actually rendering the frame,
   // in case frame counter display is enabled
 
@@ -911,11 +1071,16 @@ void Update(u64 ticks)
   }
 
   UpdateInterrupts();
+
+  s_ticks_last_update = ticks;
+  s_half_lines_until_update = GetHalfLinesUntilNextUpdate();
 }
 
 // Create a fake VI mode for a fifolog
 void FakeVIUpdate(u32 xfb_address, u32 fb_width, u32 fb_stride, u32 fb_height)
 {
+  BeginTimingChange();
+
   bool interlaced = fb_height > 480 / 2;
   if (interlaced)
   {
@@ -369,6 +369,8 @@ u32 GetTargetRefreshRateDenominator();
 u32 GetTicksPerSample();
 u32 GetTicksPerHalfLine();
 u32 GetTicksPerField();
+// Number of ticks from the last update to the next one.
+u32 GetTicksUntilNextUpdate();
 
 // Get the aspect ratio of VI's active area.
 // This function only deals with standard aspect ratios. For widescreen aspect ratios, multiply the
@@ -21,12 +21,16 @@ void CameraLogic::Reset()
   m_reg_data = {};
 
   m_is_enabled = false;
+  m_has_last_update = false;
 }
 
 void CameraLogic::DoState(PointerWrap& p)
 {
   p.Do(m_reg_data);
 
+  if (p.GetMode() == PointerWrap::MODE_READ)
+    m_has_last_update = false;
+
   // FYI: m_is_enabled is handled elsewhere.
 }
 
@@ -49,11 +53,29 @@ int CameraLogic::BusWrite(u8 slave_addr, u8 addr, int count, const u8* data_in)
   if (!m_is_enabled)
     return 0;
 
+  // The write may change the mode or the camera data itself.
+  m_has_last_update = false;
   return RawWrite(&m_reg_data, addr, count, data_in);
 }
 
 void CameraLogic::Update(const Common::Matrix44& transform, Common::Vec2 field_of_view)
 {
+  const bool sensor_bar_enabled = static_cast<bool>(IOS::g_gpio_out[IOS::GPIO::SENSOR_BAR]);
+  if (m_has_last_update && m_last_transform.data == transform.data &&
+      m_last_field_of_view.x == field_of_view.x && m_last_field_of_view.y == field_of_view.y &&
+      m_last_enable_object_tracking == m_reg_data.enable_object_tracking &&
+      m_last_mode == m_reg_data.mode && m_last_sensor_bar_enabled == sensor_bar_enabled)
+  {
+    return;
+  }
+
+  m_has_last_update = true;
+  m_last_transform = transform;
+  m_last_field_of_view = field_of_view;
+  m_last_enable_object_tracking = m_reg_data.enable_object_tracking;
+  m_last_mode = m_reg_data.mode;
+  m_last_sensor_bar_enabled = sensor_bar_enabled;
+
   // IR data is read from offset 0x37 on real hardware.
   auto& data = m_reg_data.camera_data;
   data.fill(0xff);
@@ -66,7 +88,7 @@ void CameraLogic::Update(const Common::Matrix44& transform, Common::Vec2 field_o
     return;
 
   // If the sensor bar is off the camera will see no LEDs and return 0xFFs.
-  if (!IOS::g_gpio_out[IOS::GPIO::SENSOR_BAR])
+  if (!sensor_bar_enabled)
     return;
 
   using Common::Matrix33;
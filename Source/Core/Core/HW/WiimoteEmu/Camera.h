@@ -160,5 +160,14 @@ private:
   // When disabled the camera does not respond on the bus.
   // Change is triggered by wiimote report 0x13.
   bool m_is_enabled;
+
+  // Inputs of the last update. While they stay the same (e.g. the pointer isn't moving), so does
+  // the camera data, and projecting the sensor bar LEDs can be skipped.
+  bool m_has_last_update = false;
+  Common::Matrix44 m_last_transform;
+  Common::Vec2 m_last_field_of_view;
+  u8 m_last_enable_object_tracking = 0;
+  u8 m_last_mode = 0;
+  bool m_last_sensor_bar_enabled = false;
 };
 }  // namespace WiimoteEmu
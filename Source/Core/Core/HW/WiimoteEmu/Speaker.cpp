@@ -3,7 +3,8 @@
 
 #include "Core/HW/WiimoteEmu/Speaker.h"
 
-#include <memory>
+#include <algorithm>
+#include <array>
 
 #include "AudioCommon/AudioCommon.h"
 #include "Common/CommonTypes.h"
@@ -11,6 +12,8 @@
 #include "Common/MathUtil.h"
 #include "Core/ConfigManager.h"
 #include "Core/HW/WiimoteEmu/WiimoteEmu.h"
+#include "Core/RunAhead.h"
+#include "Core/System.h"
 #include "InputCommon/ControllerEmu/ControlGroup/ControlGroup.h"
 #include "InputCommon/ControllerEmu/Setting/NumericSetting.h"
 
@@ -79,10 +82,15 @@ void SpeakerLogic::SpeakerData(const u8* data, int length, float speaker_pan)
   if (reg_data.sample_rate == 0 || length == 0)
     return;
 
+  // Writes can't go past the end of the register space, so this is enough for any of them.
+  // Each ADPCM byte holds two samples.
+  if (length > static_cast<int>(sizeof(Register)))
+    return;
+
   // Even if volume is zero we process samples to maintain proper decoder state.
 
-  // TODO consider using static max size instead of new
-  std::unique_ptr<s16[]> samples(new s16[length * 2]);
+  // This runs for every speaker report, so decode into a fixed size buffer instead of allocating.
+  std::array<s16, sizeof(Register) * 2> samples;
 
   unsigned int sample_rate_dividend, sample_length;
   u8 volume_divisor;
@@ -141,12 +149,17 @@ void SpeakerLogic::SpeakerData(const u8* data, int length, float speaker_pan)
   const u32 l_volume = std::min(u32(std::min(1.f - speaker_pan, 1.f) * volume), 255u);
   const u32 r_volume = std::min(u32(std::min(1.f + speaker_pan, 1.f) * volume), 255u);
 
-  g_sound_stream->GetMixer()->SetWiimoteSpeakerVolume(l_volume, r_volume);
+  SoundStream* sound_stream = Core::System::GetInstance().GetSoundStream();
+
+  sound_stream->GetMixer()->SetWiimoteSpeakerVolume(l_volume, r_volume);
 
   // ADPCM sample rate is thought to be x2.(3000 x2 = 6000).
   const unsigned int sample_rate = sample_rate_dividend / reg_data.sample_rate;
-  g_sound_stream->GetMixer()->PushWiimoteSpeakerSamples(samples.get(), sample_length,
+  if (!RunAhead::IsRunningAhead())
+  {
+    sound_stream->GetMixer()->PushWiimoteSpeakerSamples(samples.data(), sample_length,
                                                         sample_rate * 2);
+  }
 
 #ifdef WIIMOTE_SPEAKER_DUMP
   static int num = 0;
@@ -159,7 +172,7 @@ void SpeakerLogic::SpeakerData(const u8* data, int length, float speaker_pan)
     File::OpenFStream(ofile, "rmtdump.bin", ofile.binary | ofile.out);
     wav.Start("rmtdump.wav", 6000);
   }
-  wav.AddMonoSamples(samples.get(), length * 2);
+  wav.AddMonoSamples(samples.data(), length * 2);
   if (ofile.good())
   {
     for (int i = 0; i < length; i++)
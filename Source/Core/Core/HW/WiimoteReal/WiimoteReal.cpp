@@ -278,7 +278,9 @@ void Wiimote::InterruptDataOutput(const u8* data, const u32 size)
 
 void Wiimote::Read()
 {
-  Report rpt(MAX_PAYLOAD);
+  Report rpt;
+  m_free_read_reports.Pop(rpt);
+  rpt.resize(MAX_PAYLOAD);
   auto const result = IORead(rpt.data());
 
   // Drop the report if not connected.
@@ -423,8 +425,13 @@ Report& Wiimote::ProcessReadQueue(bool repeat_last_data_report)
     m_last_input_report.clear();
 
   // Step through the read queue.
-  while (GetNextReport(&m_last_input_report))
+  Report next_report;
+  while (GetNextReport(&next_report))
   {
+    std::swap(m_last_input_report, next_report);
+    if (next_report.capacity() != 0)
+      m_free_read_reports.Push(std::move(next_report));
+
     // Stop on a non-data report.
     if (!IsDataReport(m_last_input_report))
       break;
@@ -144,6 +144,9 @@ private:
 
   Common::SPSCQueue<Report> m_read_reports;
   Common::SPSCQueue<Report> m_write_reports;
+  // Input reports which were consumed are handed back to the Wii remote thread, which reuses
+  // their buffers for the next reads instead of allocating a new one for every report.
+  Common::SPSCQueue<Report, false> m_free_read_reports;
 };
 
 class WiimoteScannerBackend
@@ -61,6 +61,8 @@ IOCtlVRequest::IOCtlVRequest(const u32 address_) : Request(address_)
   const u32 out_number = Memory::Read_U32(address + 0x14);
   const u32 vectors_base = Memory::Read_U32(address + 0x18);  // address to vectors
 
+  in_vectors.reserve(in_number);
+  io_vectors.reserve(out_number);
   u32 offset = 0;
   for (size_t i = 0; i < (in_number + out_number); ++i)
   {
@@ -386,6 +386,20 @@ private:
   using ContentTable = std::array<OpenedContent, 16>;
   ContentTable m_content_table;
 
+  // Title lists are requested often (e.g. by the System Menu), but scanning the NAND for them
+  // is slow with many titles installed. They are kept until the directory tree changes.
+  struct TitleListCache
+  {
+    bool valid = false;
+    u64 tree_generation = 0;
+    std::vector<u64> title_ids;
+  };
+  std::vector<u64> GetCachedTitleList(TitleListCache* cache,
+                                      std::vector<u64> (*scan)(FS::FileSystem* fs)) const;
+  mutable TitleListCache m_installed_titles_cache;
+  mutable TitleListCache m_title_imports_cache;
+  mutable TitleListCache m_titles_with_tickets_cache;
+
   ContextArray m_contexts;
   TitleContext m_title_context{};
   std::string m_pending_ppc_boot_content_path;
@@ -112,19 +112,36 @@ static std::vector<u64> GetTitlesInTitleOrImport(FS::FileSystem* fs, const std::
   return title_ids;
 }
 
+std::vector<u64> ESDevice::GetCachedTitleList(TitleListCache* cache,
+                                              std::vector<u64> (*scan)(FS::FileSystem* fs)) const
+{
+  const auto fs = m_ios.GetFS();
+  const u64 tree_generation = fs->GetTreeGeneration();
+  if (!cache->valid || cache->tree_generation != tree_generation)
+  {
+    cache->title_ids = scan(fs.get());
+    cache->tree_generation = tree_generation;
+    cache->valid = true;
+  }
+  return cache->title_ids;
+}
+
 std::vector<u64> ESDevice::GetInstalledTitles() const
 {
-  return GetTitlesInTitleOrImport(m_ios.GetFS().get(), "/title");
+  return GetCachedTitleList(&m_installed_titles_cache, [](FS::FileSystem* fs) {
+    return GetTitlesInTitleOrImport(fs, "/title");
+  });
 }
 
 std::vector<u64> ESDevice::GetTitleImports() const
 {
-  return GetTitlesInTitleOrImport(m_ios.GetFS().get(), "/import");
+  return GetCachedTitleList(&m_title_imports_cache, [](FS::FileSystem* fs) {
+    return GetTitlesInTitleOrImport(fs, "/import");
+  });
 }
 
-std::vector<u64> ESDevice::GetTitlesWithTickets() const
+static std::vector<u64> GetTitlesInTicketDirectory(FS::FileSystem* fs)
 {
-  const auto fs = m_ios.GetFS();
   const auto entries = fs->ReadDirectory(PID_KERNEL, PID_KERNEL, "/ticket");
   if (!entries)
   {
@@ -164,6 +181,11 @@ std::vector<u64> ESDevice::GetTitlesWithTickets() const
   return title_ids;
 }
 
+std::vector<u64> ESDevice::GetTitlesWithTickets() const
+{
+  return GetCachedTitleList(&m_titles_with_tickets_cache, GetTitlesInTicketDirectory);
+}
+
 std::vector<ES::Content>
 ESDevice::GetStoredContentsFromTMD(const ES::TMDReader& tmd,
                                    CheckContentHashes check_content_hashes) const
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <optional>
 #include <string>
@@ -239,6 +240,16 @@ public:
   virtual Result<NandStats> GetNandStats() = 0;
   /// Get usage information about a directory (used cluster and inode counts).
   virtual Result<DirectoryStats> GetDirectoryStats(const std::string& path) = 0;
+
+  /// Incremented whenever a file or directory is created, deleted or renamed and when the
+  /// file system is formatted. A directory listing is still valid as long as this is unchanged.
+  u64 GetTreeGeneration() const { return m_tree_generation.load(std::memory_order_relaxed); }
+
+protected:
+  void OnTreeChanged() { m_tree_generation.fetch_add(1, std::memory_order_relaxed); }
+
+private:
+  std::atomic<u64> m_tree_generation{0};
 };
 
 template <typename T>
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <algorithm>
+#include <cstring>
 #include <optional>
 #include <string_view>
 #include <type_traits>
@@ -16,6 +17,7 @@
 #include "Common/NandPaths.h"
 #include "Common/StringUtil.h"
 #include "Common/Swap.h"
+#include "Common/Thread.h"
 #include "Core/IOS/ES/ES.h"
 #include "Core/IOS/FS/HostBackend/FS.h"
 #include "Core/IOS/IOS.h"
@@ -108,7 +110,19 @@ HostFileSystem::HostFileSystem(const std::string& root_path) : m_root_path{root_
   LoadFst();
 }
 
-HostFileSystem::~HostFileSystem() = default;
+HostFileSystem::~HostFileSystem()
+{
+  if (!m_fst_writer.joinable())
+    return;
+
+  // The writer thread writes any pending FST before it exits.
+  {
+    std::lock_guard lk(m_fst_mutex);
+    m_fst_writer_stop = true;
+  }
+  m_fst_cv.notify_all();
+  m_fst_writer.join();
+}
 
 std::string HostFileSystem::GetFstFilePath() const
 {
@@ -174,12 +188,56 @@ void HostFileSystem::SaveFst()
   };
   collect_entries(collect_entries, m_root_entry);
 
+  {
+    std::lock_guard lk(m_fst_mutex);
+    m_pending_fst.resize(to_write.size() * sizeof(SerializedFstEntry));
+    std::memcpy(m_pending_fst.data(), to_write.data(), m_pending_fst.size());
+    m_fst_write_pending = true;
+  }
+  if (!m_fst_writer.joinable())
+    m_fst_writer = std::thread(&HostFileSystem::FstWriterThread, this);
+  m_fst_cv.notify_all();
+}
+
+void HostFileSystem::FlushFst()
+{
+  std::unique_lock lk(m_fst_mutex);
+  m_fst_cv.wait(lk, [this] { return !m_fst_write_pending && !m_fst_writing; });
+}
+
+void HostFileSystem::FstWriterThread()
+{
+  Common::SetCurrentThreadName("IOS FST writer");
+
+  std::unique_lock lk(m_fst_mutex);
+  while (true)
+  {
+    m_fst_cv.wait(lk, [this] { return m_fst_write_pending || m_fst_writer_stop; });
+    if (!m_fst_write_pending)
+      break;
+
+    const std::vector<u8> data = std::move(m_pending_fst);
+    m_pending_fst.clear();
+    m_fst_write_pending = false;
+    m_fst_writing = true;
+    lk.unlock();
+
+    WriteFst(data);
+
+    lk.lock();
+    m_fst_writing = false;
+    m_fst_cv.notify_all();
+  }
+}
+
+void HostFileSystem::WriteFst(const std::vector<u8>& data)
+{
   const std::string dest_path = GetFstFilePath();
   const std::string temp_path = File::GetTempFilenameForAtomicWrite(dest_path);
   {
     // This temporary file must be closed before it can be renamed.
     File::IOFile file{temp_path, "wb"};
-    if (!file.WriteArray(to_write.data(), to_write.size()))
+    if (!file.WriteBytes(data.data(), data.size()))
     {
       PanicAlertFmt("IOS_FS: Failed to write new FST");
       return;
@@ -346,10 +404,13 @@ ResultCode HostFileSystem::Format(Uid uid)
     return ResultCode::AccessDenied;
   if (m_root_path.empty())
     return ResultCode::AccessDenied;
+  // Don't let a write which is still in progress race with the deletion.
+  FlushFst();
   const std::string root = BuildFilename("/");
   if (!File::DeleteDirRecursively(root) || !File::CreateDir(root))
     return ResultCode::UnknownError;
   ResetFst();
+  OnTreeChanged();
   SaveFst();
   // Reset and close all handles.
   m_handles = {};
@@ -393,6 +454,7 @@ ResultCode HostFileSystem::CreateFileOrDirectory(Uid uid, Gid gid, const std::st
   child->data.uid = uid;
   child->data.gid = gid;
   child->data.attribute = attr;
+  OnTreeChanged();
   SaveFst();
   return ResultCode::Success;
 }
@@ -452,6 +514,7 @@ ResultCode HostFileSystem::Delete(Uid uid, Gid gid, const std::string& path)
                                GetNamePredicate(split_path.file_name));
   if (it != parent->children.end())
     parent->children.erase(it);
+  OnTreeChanged();
   SaveFst();
 
   return ResultCode::Success;
@@ -523,6 +586,7 @@ ResultCode HostFileSystem::Rename(Uid uid, Gid gid, const std::string& old_path,
     old_parent->children.erase(it);
   }
   new_entry->name = split_new_path.file_name;
+  OnTreeChanged();
   SaveFst();
 
   return ResultCode::Success;
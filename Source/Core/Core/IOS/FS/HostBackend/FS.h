@@ -4,9 +4,12 @@
 #pragma once
 
 #include <array>
+#include <condition_variable>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "Common/CommonTypes.h"
@@ -95,6 +98,10 @@ private:
   void ResetFst();
   void LoadFst();
   void SaveFst();
+  /// Blocks until the last FST passed to SaveFst has been written to disk.
+  void FlushFst();
+  void FstWriterThread();
+  void WriteFst(const std::vector<u8>& data);
   /// Get the FST entry for a file (or directory).
   /// Automatically creates fallback entries for parents if they do not exist.
   /// Returns nullptr if the path is invalid or the file does not exist.
@@ -112,6 +119,17 @@ private:
   std::string m_root_path;
   std::map<std::string, std::weak_ptr<File::IOFile>> m_open_files;
   std::array<Handle, 16> m_handles{};
+
+  // The FST is serialized on the calling thread, but written to disk by a separate thread,
+  // which is started on the first save. Saves which happen while a write is in progress are
+  // coalesced, so that only the most recent FST gets written afterwards.
+  std::thread m_fst_writer;
+  std::mutex m_fst_mutex;
+  std::condition_variable m_fst_cv;
+  std::vector<u8> m_pending_fst;
+  bool m_fst_write_pending = false;
+  bool m_fst_writing = false;
+  bool m_fst_writer_stop = false;
 };
 
 }  // namespace IOS::HLE::FS
@@ -267,6 +267,7 @@ Kernel::~Kernel()
 {
   {
     std::lock_guard lock(m_device_map_mutex);
+    m_device_list.clear();
     m_device_map.clear();
   }
 
@@ -479,6 +480,11 @@ void Kernel::AddDevice(std::unique_ptr<Device> device)
 {
   ASSERT(device->GetDeviceType() == Device::DeviceType::Static);
   m_device_map.insert_or_assign(device->GetDeviceName(), std::move(device));
+
+  m_device_list.clear();
+  m_device_list.reserve(m_device_map.size());
+  for (const auto& entry : m_device_map)
+    m_device_list.push_back(entry.second.get());
 }
 
 void Kernel::AddCoreDevices()
@@ -759,11 +765,11 @@ void Kernel::UpdateIPC()
 void Kernel::UpdateDevices()
 {
   // Check if a hardware device must be updated
-  for (const auto& entry : m_device_map)
+  for (Device* device : m_device_list)
   {
-    if (entry.second->IsOpened())
+    if (device->IsOpened())
     {
-      entry.second->Update();
+      device->Update();
     }
   }
 }
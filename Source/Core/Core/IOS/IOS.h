@@ -161,6 +161,8 @@ protected:
   u64 m_title_id = 0;
   static constexpr u8 IPC_MAX_FDS = 0x18;
   std::map<std::string, std::shared_ptr<Device>, std::less<>> m_device_map;
+  // The devices of m_device_map in a flat list, as they are walked on every device update.
+  std::vector<Device*> m_device_list;
   std::mutex m_device_map_mutex;
   // TODO: make this fdmap per process.
   std::array<std::shared_ptr<Device>, IPC_MAX_FDS> m_fdmap;
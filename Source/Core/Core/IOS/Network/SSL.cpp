@@ -81,6 +81,37 @@ int SSLRecv(void* ctx, unsigned char* buf, size_t len)
 }
 }  // namespace
 
+std::map<std::string, NetSSLDevice::SessionPtr> NetSSLDevice::s_sessions;
+
+void NetSSLDevice::SessionDeleter::operator()(mbedtls_ssl_session* session) const
+{
+  mbedtls_ssl_session_free(session);
+  delete session;
+}
+
+void NetSSLDevice::SaveSession(const WII_SSL& ssl)
+{
+  if (ssl.hostname.empty())
+    return;
+
+  SessionPtr session{new mbedtls_ssl_session};
+  mbedtls_ssl_session_init(session.get());
+  if (mbedtls_ssl_get_session(&ssl.ctx, session.get()) == 0)
+    s_sessions.insert_or_assign(ssl.hostname, std::move(session));
+  else
+    s_sessions.erase(ssl.hostname);
+}
+
+void NetSSLDevice::ResumeSession(WII_SSL& ssl)
+{
+  const auto it = s_sessions.find(ssl.hostname);
+  if (it == s_sessions.end())
+    return;
+
+  INFO_LOG_FMT(IOS_SSL, "Resuming the previous session with {}", ssl.hostname);
+  mbedtls_ssl_set_session(&ssl.ctx, it->second.get());
+}
+
 NetSSLDevice::NetSSLDevice(Kernel& ios, const std::string& device_name) : Device(ios, device_name)
 {
   for (WII_SSL& ssl : _SSL)
@@ -112,6 +143,7 @@ NetSSLDevice::~NetSSLDevice()
       ssl.active = false;
     }
   }
+  s_sessions.clear();
 }
 
 int NetSSLDevice::GetSSLFreeID() const
@@ -485,6 +517,7 @@ std::optional<IPCReply> NetSSLDevice::IOCtlV(const IOCtlVRequest& request)
     {
       WII_SSL* ssl = &_SSL[sslID];
       mbedtls_ssl_setup(&ssl->ctx, &ssl->config);
+      ResumeSession(*ssl);
       ssl->sockfd = Memory::Read_U32(BufferOut2);
       WiiSockMan& sm = WiiSockMan::GetInstance();
       ssl->hostfd = sm.GetHostSocket(ssl->sockfd);
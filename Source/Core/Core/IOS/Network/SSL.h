@@ -13,6 +13,8 @@
 #include <mbedtls/platform.h>
 #include <mbedtls/ssl.h>
 #include <mbedtls/x509_crt.h>
+#include <map>
+#include <memory>
 #include <string>
 
 // clang-format on
@@ -91,9 +93,23 @@ public:
 
   int GetSSLFreeID() const;
 
+  // Remembers the session of a completed handshake, so that later connections to the same host
+  // can resume it instead of going through a full handshake.
+  static void SaveSession(const WII_SSL& ssl);
+
   static WII_SSL _SSL[NET_SSL_MAXINSTANCES];
 
 private:
+  struct SessionDeleter
+  {
+    void operator()(mbedtls_ssl_session* session) const;
+  };
+  using SessionPtr = std::unique_ptr<mbedtls_ssl_session, SessionDeleter>;
+
+  static void ResumeSession(WII_SSL& ssl);
+
+  static std::map<std::string, SessionPtr> s_sessions;
+
   bool m_cert_error_shown = false;
 };
 
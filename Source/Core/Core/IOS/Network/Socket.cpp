@@ -403,6 +403,7 @@ void WiiSocket::Update(bool read, bool write, bool except)
             switch (ret)
             {
             case 0:
+              NetSSLDevice::SaveSession(NetSSLDevice::_SSL[sslID]);
               WriteReturnValue(SSL_OK, BufferIn);
               break;
             case MBEDTLS_ERR_SSL_WANT_READ:
@@ -820,37 +821,44 @@ void WiiSockMan::Update()
   while (socket_iter != end_socks)
   {
     const WiiSocket& sock = socket_iter->second;
-    if (sock.IsValid())
+    if (!sock.IsValid())
+    {
+      // Good time to clean up invalid sockets.
+      socket_iter = WiiSockets.erase(socket_iter);
+      continue;
+    }
+
+    // Updating a socket only retries its pending operations, so idle sockets, which are most
+    // of them when many connections are open, don't need to be passed to select at all.
+    if (sock.HasPendingOperations())
     {
       FD_SET(sock.fd, &read_fds);
       FD_SET(sock.fd, &write_fds);
       FD_SET(sock.fd, &except_fds);
       nfds = std::max(nfds, sock.fd + 1);
-      ++socket_iter;
-    }
-    else
-    {
-      // Good time to clean up invalid sockets.
-      socket_iter = WiiSockets.erase(socket_iter);
     }
+    ++socket_iter;
   }
 
-  const s32 ret = select(nfds, &read_fds, &write_fds, &except_fds, &t);
-
-  if (ret >= 0)
+  if (nfds != 0)
   {
+    const s32 ret = select(nfds, &read_fds, &write_fds, &except_fds, &t);
+
     for (auto& pair : WiiSockets)
     {
       WiiSocket& sock = pair.second;
-      sock.Update(FD_ISSET(sock.fd, &read_fds) != 0, FD_ISSET(sock.fd, &write_fds) != 0,
-                  FD_ISSET(sock.fd, &except_fds) != 0);
-    }
-  }
-  else
-  {
-    for (auto& elem : WiiSockets)
-    {
-      elem.second.Update(false, false, false);
+      if (!sock.HasPendingOperations())
+        continue;
+
+      if (ret >= 0)
+      {
+        sock.Update(FD_ISSET(sock.fd, &read_fds) != 0, FD_ISSET(sock.fd, &write_fds) != 0,
+                    FD_ISSET(sock.fd, &except_fds) != 0);
+      }
+      else
+      {
+        sock.Update(false, false, false);
+      }
     }
   }
   UpdatePollCommands();
@@ -213,6 +213,7 @@ private:
   void DoSock(Request request, SSL_IOCTL type);
   void Update(bool read, bool write, bool except);
   bool IsValid() const { return fd >= 0; }
+  bool HasPendingOperations() const { return !pending_sockops.empty(); }
 
   s32 fd = -1;
   s32 wii_fd = -1;
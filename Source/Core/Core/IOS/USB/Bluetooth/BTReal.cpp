@@ -236,7 +236,11 @@ std::optional<IPCReply> BluetoothRealDevice::IOCtlV(const IOCtlVRequest& request
         return std::nullopt;
       }
     }
-    auto buffer = cmd->MakeBuffer(cmd->length);
+    // Incoming transfers overwrite their buffer, so the emulated one doesn't need to be copied.
+    // This is the case for all HCI events and incoming ACL data, i.e. most transfers.
+    auto buffer = (cmd->endpoint & LIBUSB_ENDPOINT_IN) != 0 ?
+                      std::unique_ptr<u8[]>(new u8[cmd->length]) :
+                      cmd->MakeBuffer(cmd->length);
     libusb_transfer* transfer = libusb_alloc_transfer(0);
     transfer->buffer = buffer.get();
     transfer->callback = [](libusb_transfer* tr) {
@@ -595,7 +599,8 @@ bool BluetoothRealDevice::OpenDevice(libusb_device* device)
 void BluetoothRealDevice::HandleCtrlTransfer(libusb_transfer* tr)
 {
   std::lock_guard lk(m_transfers_mutex);
-  if (!m_current_transfers.count(tr))
+  const auto pending_transfer = m_current_transfers.find(tr);
+  if (pending_transfer == m_current_transfers.end())
     return;
 
   if (tr->status != LIBUSB_TRANSFER_COMPLETED && tr->status != LIBUSB_TRANSFER_NO_DEVICE)
@@ -612,16 +617,17 @@ void BluetoothRealDevice::HandleCtrlTransfer(libusb_transfer* tr)
   {
     m_showed_failed_transfer.Clear();
   }
-  const auto& command = m_current_transfers.at(tr).command;
+  const auto& command = pending_transfer->second.command;
   command->FillBuffer(libusb_control_transfer_get_data(tr), tr->actual_length);
   m_ios.EnqueueIPCReply(command->ios_request, tr->actual_length, 0, CoreTiming::FromThread::ANY);
-  m_current_transfers.erase(tr);
+  m_current_transfers.erase(pending_transfer);
 }
 
 void BluetoothRealDevice::HandleBulkOrIntrTransfer(libusb_transfer* tr)
 {
   std::lock_guard lk(m_transfers_mutex);
-  if (!m_current_transfers.count(tr))
+  const auto pending_transfer = m_current_transfers.find(tr);
+  if (pending_transfer == m_current_transfers.end())
     return;
 
   if (tr->status != LIBUSB_TRANSFER_COMPLETED && tr->status != LIBUSB_TRANSFER_TIMED_OUT &&
@@ -660,9 +666,9 @@ void BluetoothRealDevice::HandleBulkOrIntrTransfer(libusb_transfer* tr)
     }
   }
 
-  const auto& command = m_current_transfers.at(tr).command;
+  const auto& command = pending_transfer->second.command;
   command->FillBuffer(tr->buffer, tr->actual_length);
   m_ios.EnqueueIPCReply(command->ios_request, tr->actual_length, 0, CoreTiming::FromThread::ANY);
-  m_current_transfers.erase(tr);
+  m_current_transfers.erase(pending_transfer);
 }
 }  // namespace IOS::HLE
@@ -235,18 +235,31 @@ int LibusbDevice::SubmitTransfer(std::unique_ptr<CtrlMessage> cmd)
   }
   }
 
-  const size_t size = cmd->length + LIBUSB_CONTROL_SETUP_SIZE;
-  auto buffer = std::make_unique<u8[]>(size);
-  libusb_fill_control_setup(buffer.get(), cmd->request_type, cmd->request, cmd->value, cmd->index,
-                            cmd->length);
-  Memory::CopyFromEmu(buffer.get() + LIBUSB_CONTROL_SETUP_SIZE, cmd->data_address, cmd->length);
-  libusb_transfer* transfer = libusb_alloc_transfer(0);
-  transfer->flags |= LIBUSB_TRANSFER_FREE_TRANSFER;
-  libusb_fill_control_transfer(transfer, m_handle, buffer.release(), CtrlTransferCallback, this, 0);
-  m_transfer_endpoints[0].AddTransfer(std::move(cmd), transfer);
+  TransferEndpoint& endpoint = m_transfer_endpoints[0];
+  const TransferEndpoint::TransferSlot slot =
+      endpoint.AcquireTransfer(0, cmd->length + LIBUSB_CONTROL_SETUP_SIZE);
+  libusb_transfer* transfer = slot.transfer;
+  libusb_fill_control_setup(transfer->buffer, cmd->request_type, cmd->request, cmd->value,
+                            cmd->index, cmd->length);
+  // The data stage of device-to-host requests is overwritten by the device.
+  if ((cmd->request_type & LIBUSB_ENDPOINT_IN) == 0)
+  {
+    Memory::CopyFromEmu(transfer->buffer + LIBUSB_CONTROL_SETUP_SIZE, cmd->data_address,
+                        cmd->length);
+  }
+  libusb_fill_control_transfer(transfer, m_handle, transfer->buffer, CtrlTransferCallback, this,
+                               0);
+  endpoint.AddTransfer(std::move(cmd), slot);
   return libusb_submit_transfer(transfer);
 }
 
+// Incoming transfers overwrite their buffer, so only outgoing ones need the emulated data.
+static void CopyOutgoingData(const TransferCommand& cmd, u8 endpoint, u8* buffer, u32 length)
+{
+  if ((endpoint & LIBUSB_ENDPOINT_IN) == 0)
+    Memory::CopyFromEmu(buffer, cmd.data_address, length);
+}
+
 int LibusbDevice::SubmitTransfer(std::unique_ptr<BulkMessage> cmd)
 {
   if (!m_device_attached)
@@ -255,12 +268,13 @@ int LibusbDevice::SubmitTransfer(std::unique_ptr<BulkMessage> cmd)
   DEBUG_LOG_FMT(IOS_USB, "[{:04x}:{:04x} {}] Bulk: length={:04x} endpoint={:02x}", m_vid, m_pid,
                 m_active_interface, cmd->length, cmd->endpoint);
 
-  libusb_transfer* transfer = libusb_alloc_transfer(0);
-  libusb_fill_bulk_transfer(transfer, m_handle, cmd->endpoint,
-                            cmd->MakeBuffer(cmd->length).release(), cmd->length, TransferCallback,
-                            this, 0);
-  transfer->flags |= LIBUSB_TRANSFER_FREE_TRANSFER;
-  m_transfer_endpoints[transfer->endpoint].AddTransfer(std::move(cmd), transfer);
+  TransferEndpoint& endpoint = m_transfer_endpoints[cmd->endpoint];
+  const TransferEndpoint::TransferSlot slot = endpoint.AcquireTransfer(0, cmd->length);
+  libusb_transfer* transfer = slot.transfer;
+  CopyOutgoingData(*cmd, cmd->endpoint, transfer->buffer, cmd->length);
+  libusb_fill_bulk_transfer(transfer, m_handle, cmd->endpoint, transfer->buffer, cmd->length,
+                            TransferCallback, this, 0);
+  endpoint.AddTransfer(std::move(cmd), slot);
   return libusb_submit_transfer(transfer);
 }
 
@@ -272,12 +286,13 @@ int LibusbDevice::SubmitTransfer(std::unique_ptr<IntrMessage> cmd)
   DEBUG_LOG_FMT(IOS_USB, "[{:04x}:{:04x} {}] Interrupt: length={:04x} endpoint={:02x}", m_vid,
                 m_pid, m_active_interface, cmd->length, cmd->endpoint);
 
-  libusb_transfer* transfer = libusb_alloc_transfer(0);
-  libusb_fill_interrupt_transfer(transfer, m_handle, cmd->endpoint,
-                                 cmd->MakeBuffer(cmd->length).release(), cmd->length,
+  TransferEndpoint& endpoint = m_transfer_endpoints[cmd->endpoint];
+  const TransferEndpoint::TransferSlot slot = endpoint.AcquireTransfer(0, cmd->length);
+  libusb_transfer* transfer = slot.transfer;
+  CopyOutgoingData(*cmd, cmd->endpoint, transfer->buffer, cmd->length);
+  libusb_fill_interrupt_transfer(transfer, m_handle, cmd->endpoint, transfer->buffer, cmd->length,
                                  TransferCallback, this, 0);
-  transfer->flags |= LIBUSB_TRANSFER_FREE_TRANSFER;
-  m_transfer_endpoints[transfer->endpoint].AddTransfer(std::move(cmd), transfer);
+  endpoint.AddTransfer(std::move(cmd), slot);
   return libusb_submit_transfer(transfer);
 }
 
@@ -290,12 +305,16 @@ int LibusbDevice::SubmitTransfer(std::unique_ptr<IsoMessage> cmd)
                 "[{:04x}:{:04x} {}] Isochronous: length={:04x} endpoint={:02x} num_packets={:02x}",
                 m_vid, m_pid, m_active_interface, cmd->length, cmd->endpoint, cmd->num_packets);
 
-  libusb_transfer* transfer = libusb_alloc_transfer(cmd->num_packets);
-  transfer->buffer = cmd->MakeBuffer(cmd->length).release();
+  TransferEndpoint& endpoint = m_transfer_endpoints[cmd->endpoint];
+  const TransferEndpoint::TransferSlot slot =
+      endpoint.AcquireTransfer(cmd->num_packets, cmd->length);
+  libusb_transfer* transfer = slot.transfer;
+  // Incoming packets can be shorter than requested and the whole buffer is copied back, so
+  // the emulated buffer is copied for both directions to leave the remainder unchanged.
+  Memory::CopyFromEmu(transfer->buffer, cmd->data_address, cmd->length);
   transfer->callback = TransferCallback;
   transfer->dev_handle = m_handle;
   transfer->endpoint = cmd->endpoint;
-  transfer->flags |= LIBUSB_TRANSFER_FREE_TRANSFER;
   for (size_t i = 0; i < cmd->num_packets; ++i)
     transfer->iso_packet_desc[i].length = cmd->packet_sizes[i];
   transfer->length = cmd->length;
@@ -303,7 +322,7 @@ int LibusbDevice::SubmitTransfer(std::unique_ptr<IsoMessage> cmd)
   transfer->timeout = 0;
   transfer->type = LIBUSB_TRANSFER_TYPE_ISOCHRONOUS;
   transfer->user_data = this;
-  m_transfer_endpoints[transfer->endpoint].AddTransfer(std::move(cmd), transfer);
+  endpoint.AddTransfer(std::move(cmd), slot);
   return libusb_submit_transfer(transfer);
 }
 
@@ -347,11 +366,50 @@ static const std::map<u8, const char*> s_transfer_types = {
     {LIBUSB_TRANSFER_TYPE_INTERRUPT, "Interrupt"},
 };
 
+LibusbDevice::TransferEndpoint::~TransferEndpoint()
+{
+  for (const TransferSlot& slot : m_free_transfers)
+  {
+    delete[] slot.transfer->buffer;
+    libusb_free_transfer(slot.transfer);
+  }
+}
+
+LibusbDevice::TransferEndpoint::TransferSlot
+LibusbDevice::TransferEndpoint::AcquireTransfer(int num_iso_packets, size_t buffer_size)
+{
+  TransferSlot slot;
+  {
+    std::lock_guard lk{m_transfers_mutex};
+    const auto it = std::find_if(
+        m_free_transfers.begin(), m_free_transfers.end(),
+        [&](const TransferSlot& free) { return free.num_iso_packets >= num_iso_packets; });
+    if (it != m_free_transfers.end())
+    {
+      slot = *it;
+      m_free_transfers.erase(it);
+    }
+  }
+
+  if (!slot.transfer)
+  {
+    slot.transfer = libusb_alloc_transfer(num_iso_packets);
+    slot.num_iso_packets = num_iso_packets;
+  }
+  if (!slot.transfer->buffer || slot.buffer_size < buffer_size)
+  {
+    delete[] slot.transfer->buffer;
+    slot.transfer->buffer = new u8[buffer_size];
+    slot.buffer_size = buffer_size;
+  }
+  return slot;
+}
+
 void LibusbDevice::TransferEndpoint::AddTransfer(std::unique_ptr<TransferCommand> command,
-                                                 libusb_transfer* transfer)
+                                                 const TransferSlot& slot)
 {
   std::lock_guard lk{m_transfers_mutex};
-  m_transfers.emplace(transfer, std::move(command));
+  m_transfers.emplace(slot.transfer, PendingTransfer{std::move(command), slot});
 }
 
 void LibusbDevice::TransferEndpoint::HandleTransfer(libusb_transfer* transfer,
@@ -365,8 +423,7 @@ void LibusbDevice::TransferEndpoint::HandleTransfer(libusb_transfer* transfer,
     return;
   }
 
-  const std::unique_ptr<u8[]> buffer(transfer->buffer);
-  const auto& cmd = *iterator->second.get();
+  const auto& cmd = *iterator->second.command;
   const auto* device = static_cast<LibusbDevice*>(transfer->user_data);
   s32 return_value = 0;
   switch (transfer->status)
@@ -390,7 +447,8 @@ void LibusbDevice::TransferEndpoint::HandleTransfer(libusb_transfer* transfer,
     break;
   }
   cmd.OnTransferComplete(return_value);
-  m_transfers.erase(transfer);
+  m_free_transfers.push_back(iterator->second.slot);
+  m_transfers.erase(iterator);
 }
 
 void LibusbDevice::TransferEndpoint::CancelTransfers()
@@ -60,13 +60,36 @@ private:
   class TransferEndpoint final
   {
   public:
-    void AddTransfer(std::unique_ptr<TransferCommand> command, libusb_transfer* transfer);
+    // A libusb transfer along with the capacity of its packet descriptors and buffer.
+    struct TransferSlot
+    {
+      libusb_transfer* transfer = nullptr;
+      int num_iso_packets = 0;
+      size_t buffer_size = 0;
+    };
+
+    TransferEndpoint() = default;
+    TransferEndpoint(const TransferEndpoint&) = delete;
+    TransferEndpoint& operator=(const TransferEndpoint&) = delete;
+    ~TransferEndpoint();
+
+    // Returns a transfer with room for at least num_iso_packets packets and a buffer of at least
+    // buffer_size bytes. Completed transfers are reused instead of allocating new ones.
+    TransferSlot AcquireTransfer(int num_iso_packets, size_t buffer_size);
+    void AddTransfer(std::unique_ptr<TransferCommand> command, const TransferSlot& slot);
     void HandleTransfer(libusb_transfer* tr, std::function<s32(const TransferCommand&)> function);
     void CancelTransfers();
 
   private:
+    struct PendingTransfer
+    {
+      std::unique_ptr<TransferCommand> command;
+      TransferSlot slot;
+    };
+
     std::mutex m_transfers_mutex;
-    std::map<libusb_transfer*, std::unique_ptr<TransferCommand>> m_transfers;
+    std::map<libusb_transfer*, PendingTransfer> m_transfers;
+    std::vector<TransferSlot> m_free_transfers;
   };
   std::map<u8, TransferEndpoint> m_transfer_endpoints;
   static void CtrlTransferCallback(libusb_transfer* transfer);
@@ -42,19 +42,20 @@ bool MemoryWatcher::LoadAddresses(const std::string& path)
   while (std::getline(locations, line))
     ParseLine(line);
 
-  return !m_values.empty();
+  return !m_watches.empty();
 }
 
 void MemoryWatcher::ParseLine(const std::string& line)
 {
-  m_values[line] = 0;
-  m_addresses[line] = std::vector<u32>();
+  Watch& watch = m_watches[line];
+  watch.offsets.clear();
+  watch.value = 0;
 
   std::istringstream offsets(line);
   offsets >> std::hex;
   u32 offset;
   while (offsets >> offset)
-    m_addresses[line].push_back(offset);
+    watch.offsets.push_back(offset);
 }
 
 bool MemoryWatcher::OpenSocket(const std::string& path)
@@ -66,10 +67,10 @@ bool MemoryWatcher::OpenSocket(const std::string& path)
   return m_fd >= 0;
 }
 
-u32 MemoryWatcher::ChasePointer(const std::string& line)
+u32 MemoryWatcher::ChasePointer(const std::vector<u32>& offsets)
 {
   u32 value = 0;
-  for (u32 offset : m_addresses[line])
+  for (u32 offset : offsets)
   {
     value = PowerPC::HostRead_U32(value + offset);
     if (!PowerPC::HostIsRAMAddress(value))
@@ -83,16 +84,13 @@ std::string MemoryWatcher::ComposeMessages()
   std::ostringstream message_stream;
   message_stream << std::hex;
 
-  for (auto& entry : m_values)
+  for (auto& [address, watch] : m_watches)
   {
-    std::string address = entry.first;
-    u32& current_value = entry.second;
-
-    u32 new_value = ChasePointer(address);
-    if (new_value != current_value)
+    const u32 new_value = ChasePointer(watch.offsets);
+    if (new_value != watch.value)
     {
       // Update the value
-      current_value = new_value;
+      watch.value = new_value;
       message_stream << address << '\n' << new_value << '\n';
     }
   }
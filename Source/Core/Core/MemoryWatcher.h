@@ -28,16 +28,22 @@ private:
   bool OpenSocket(const std::string& path);
 
   void ParseLine(const std::string& line);
-  u32 ChasePointer(const std::string& line);
+  u32 ChasePointer(const std::vector<u32>& offsets);
   std::string ComposeMessages();
 
+  struct Watch
+  {
+    // Offsets to follow
+    std::vector<u32> offsets;
+    // Current value
+    u32 value = 0;
+  };
+
   bool m_running = false;
 
   int m_fd;
   sockaddr_un m_addr{};
 
-  // Address as stored in the file -> list of offsets to follow
-  std::map<std::string, std::vector<u32>> m_addresses;
-  // Address as stored in the file -> current value
-  std::map<std::string, u32> m_values;
+  // Address as stored in the file -> what is watched at it
+  std::map<std::string, Watch> m_watches;
 };
@@ -114,6 +114,7 @@ static std::string s_InputDisplay[8];
 
 static GCManipFunction s_gc_manip_func;
 static WiiManipFunction s_wii_manip_func;
+static PlaybackEndedCallbackFunc s_on_playback_ended_callback;
 
 static std::string s_current_file_name;
 
@@ -1277,14 +1278,21 @@ void EndPlayInput(bool cont)
       Core::UpdateWantDeterminism();
       if (was_running && !SConfig::GetInstance().m_PauseMovie)
         CPU::EnableStepping(false);
+      if (s_on_playback_ended_callback)
+        s_on_playback_ended_callback();
     });
   }
 }
 
-// NOTE: Save State + Host Thread
+// NOTE: Host Thread
 void SaveRecording(const std::string& filename)
 {
-  File::IOFile save_record(filename, "wb");
+  WriteRecording(filename, SaveRecordingToBuffer());
+}
+
+// NOTE: CPU Thread
+std::vector<u8> SaveRecordingToBuffer()
+{
   // Create the real header now and write it
   DTMHeader header;
   memset(&header, 0, sizeof(DTMHeader));
@@ -1323,9 +1331,17 @@ void SaveRecording(const std::string& filename)
   header.uniqueID = 0;
   // header.audioEmulator;
 
-  save_record.WriteArray(&header, 1);
+  std::vector<u8> recording(sizeof(DTMHeader) + s_temp_input.size());
+  std::memcpy(recording.data(), &header, sizeof(DTMHeader));
+  std::copy(s_temp_input.begin(), s_temp_input.end(), recording.begin() + sizeof(DTMHeader));
+  return recording;
+}
 
-  bool success = save_record.WriteBytes(s_temp_input.data(), s_temp_input.size());
+// NOTE: Save State + Host Thread
+void WriteRecording(const std::string& filename, const std::vector<u8>& recording)
+{
+  File::IOFile save_record(filename, "wb");
+  bool success = save_record.WriteBytes(recording.data(), recording.size());
 
   if (success && s_bRecordingFromSaveState)
   {
@@ -1348,6 +1364,11 @@ void SetWiiInputManip(WiiManipFunction func)
   s_wii_manip_func = std::move(func);
 }
 
+void SetOnPlaybackEndedCallback(PlaybackEndedCallbackFunc callback)
+{
+  s_on_playback_ended_callback = std::move(callback);
+}
+
 // NOTE: CPU Thread
 void CallGCInputManip(GCPadStatus* PadStatus, int controllerID)
 {
@@ -9,6 +9,7 @@
 #include <optional>
 #include <string>
 #include <string_view>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 
@@ -180,6 +181,10 @@ bool PlayWiimote(int wiimote, WiimoteCommon::DataReportBuilder& rpt, int ext,
                  const WiimoteEmu::EncryptionKey& key);
 void EndPlayInput(bool cont);
 void SaveRecording(const std::string& filename);
+// Takes a copy of the recording as it is now, which WriteRecording can write to a file from
+// another thread while the recording goes on.
+std::vector<u8> SaveRecordingToBuffer();
+void WriteRecording(const std::string& filename, const std::vector<u8>& recording);
 void DoState(PointerWrap& p);
 void Shutdown();
 void CheckPadStatus(const GCPadStatus* PadStatus, int controllerID);
@@ -199,4 +204,9 @@ void SetWiiInputManip(WiiManipFunction);
 void CallGCInputManip(GCPadStatus* PadStatus, int controllerID);
 void CallWiiInputManip(WiimoteCommon::DataReportBuilder& rpt, int controllerID, int ext,
                        const WiimoteEmu::EncryptionKey& key);
+
+// Called on the host thread after the playback of a movie has ended without switching to
+// recording.
+using PlaybackEndedCallbackFunc = std::function<void()>;
+void SetOnPlaybackEndedCallback(PlaybackEndedCallbackFunc callback);
 }  // namespace Movie
@@ -2238,17 +2238,15 @@ void NetPlayClient::SendTimeBase()
 {
   std::lock_guard lk(crit_netplay_client);
 
-  if (netplay_client->m_timebase_frame % 60 == 0)
-  {
-    const sf::Uint64 timebase = SystemTimers::GetFakeTimeBase();
+  // Sent every frame, so that desyncs are reported at the frame they become visible.
+  const sf::Uint64 timebase = SystemTimers::GetFakeTimeBase();
 
-    sf::Packet packet;
-    packet << static_cast<MessageId>(NP_MSG_TIMEBASE);
-    packet << timebase;
-    packet << netplay_client->m_timebase_frame;
+  sf::Packet packet;
+  packet << static_cast<MessageId>(NP_MSG_TIMEBASE);
+  packet << timebase;
+  packet << netplay_client->m_timebase_frame;
 
-    netplay_client->SendAsync(std::move(packet));
-  }
+  netplay_client->SendAsync(std::move(packet));
 
   netplay_client->m_timebase_frame++;
 }
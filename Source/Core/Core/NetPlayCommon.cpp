@@ -67,10 +67,7 @@ bool CompressFileIntoPacket(const std::string& file_path, sf::Packet& packet)
 
     // The size of the data to write is 'out_len'
     packet << static_cast<u32>(out_len);
-    for (size_t j = 0; j < out_len; j++)
-    {
-      packet << out_buffer[j];
-    }
+    packet.append(out_buffer.data(), out_len);
 
     if (cur_len != LZO_IN_LEN)
       break;
@@ -122,10 +119,7 @@ bool CompressBufferIntoPacket(const std::vector<u8>& in_buffer, sf::Packet& pack
 
     // The size of the data to write is 'out_len'
     packet << static_cast<u32>(out_len);
-    for (size_t j = 0; j < out_len; j++)
-    {
-      packet << out_buffer[j];
-    }
+    packet.append(out_buffer.data(), out_len);
 
     if (cur_len != LZO_IN_LEN)
       break;
@@ -139,6 +133,21 @@ bool CompressBufferIntoPacket(const std::vector<u8>& in_buffer, sf::Packet& pack
   return true;
 }
 
+// Blocks are never larger than what compressing LZO_IN_LEN bytes can produce, and the data
+// comes from another player, so anything else is rejected rather than trusted.
+static bool ReadCompressedBlock(sf::Packet& packet, u32 size, std::vector<u8>* buffer)
+{
+  if (size > buffer->size())
+  {
+    PanicAlertFmtT("Internal LZO Error - decompression failed");
+    return false;
+  }
+
+  for (u32 i = 0; i < size; ++i)
+    packet >> (*buffer)[i];
+  return true;
+}
+
 bool DecompressPacketIntoFile(sf::Packet& packet, const std::string& file_path)
 {
   u64 file_size = Common::PacketReadU64(packet);
@@ -165,12 +174,11 @@ bool DecompressPacketIntoFile(sf::Packet& packet, const std::string& file_path)
     if (!cur_len)
       break;  // We reached the end of the data stream
 
-    for (size_t j = 0; j < cur_len; j++)
-    {
-      packet >> in_buffer[j];
-    }
+    if (!ReadCompressedBlock(packet, cur_len, &in_buffer))
+      return false;
 
-    if (lzo1x_decompress(in_buffer.data(), cur_len, out_buffer.data(), &new_len, nullptr) !=
+    new_len = out_buffer.size();
+    if (lzo1x_decompress_safe(in_buffer.data(), cur_len, out_buffer.data(), &new_len, nullptr) !=
         LZO_E_OK)
     {
       PanicAlertFmtT("Internal LZO Error - decompression failed");
@@ -208,12 +216,13 @@ std::optional<std::vector<u8>> DecompressPacketIntoBuffer(sf::Packet& packet)
     if (!cur_len)
       break;  // We reached the end of the data stream
 
-    for (size_t j = 0; j < cur_len; j++)
-    {
-      packet >> in_buffer[j];
-    }
+    if (!ReadCompressedBlock(packet, cur_len, &in_buffer))
+      return {};
 
-    if (lzo1x_decompress(in_buffer.data(), cur_len, &out_buffer[i], &new_len, nullptr) != LZO_E_OK)
+    new_len = size - i;
+    if (new_len == 0 ||
+        lzo1x_decompress_safe(in_buffer.data(), cur_len, &out_buffer[i], &new_len, nullptr) !=
+            LZO_E_OK)
     {
       PanicAlertFmtT("Internal LZO Error - decompression failed");
       return {};
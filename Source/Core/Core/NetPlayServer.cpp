@@ -244,6 +244,8 @@ void NetPlayServer::ThreadFunc()
       m_ping_timer.Start();
       SendToClients(spac);
 
+      UpdateAdaptivePadBuffer();
+
       m_index.SetPlayerCount(static_cast<int>(m_players.size()));
       m_index.SetGame(m_selected_game_name);
       m_index.SetInGame(m_is_running);
@@ -619,6 +621,62 @@ void NetPlayServer::AdjustPadBufferSize(unsigned int size)
   }
 }
 
+// called from ---NETPLAY--- thread
+void NetPlayServer::UpdateAdaptivePadBuffer()
+{
+  if (!m_is_running || m_host_input_authority || !Config::Get(Config::NETPLAY_ADAPTIVE_BUFFER_SIZE))
+  {
+    m_adaptive_buffer_decrease_votes = 0;
+    return;
+  }
+
+  // Inputs travel from one client to the others through the host, which takes about one round
+  // trip time for the worst connected player. ENet keeps a smoothed round trip time and its mean
+  // deviation per peer. Four deviations on top cover all but the largest latency spikes.
+  u32 worst_latency_ms = 0;
+  {
+    std::lock_guard lkp(m_crit.players);
+    for (const auto& player : m_players)
+    {
+      const ENetPeer* peer = player.second.socket;
+      worst_latency_ms =
+          std::max<u32>(worst_latency_ms, peer->roundTripTime + 4 * peer->roundTripTimeVariance);
+    }
+  }
+
+  // Pads are usually polled at 120 Hz, so each buffered input covers about 8 ms.
+  constexpr u32 MS_PER_BUFFERED_INPUT = 8;
+  constexpr u32 MAX_ADAPTIVE_BUFFER_SIZE = 40;
+  const u32 needed = std::clamp<u32>(
+      (worst_latency_ms + MS_PER_BUFFERED_INPUT - 1) / MS_PER_BUFFERED_INPUT, 1,
+      MAX_ADAPTIVE_BUFFER_SIZE);
+
+  // Grow right away to stop stalls, but only shrink one step at a time once the connections
+  // have been better for a while, as each change is noticeable while playing.
+  constexpr u32 DECREASE_DELAY_SECONDS = 5;
+  if (needed > m_target_buffer_size)
+  {
+    m_adaptive_buffer_decrease_votes = 0;
+    INFO_LOG_FMT(NETPLAY, "Adaptive pad buffer: {} -> {} (latency {} ms)", m_target_buffer_size,
+                 needed, worst_latency_ms);
+    AdjustPadBufferSize(needed);
+  }
+  else if (needed < m_target_buffer_size)
+  {
+    if (++m_adaptive_buffer_decrease_votes >= DECREASE_DELAY_SECONDS)
+    {
+      m_adaptive_buffer_decrease_votes = 0;
+      INFO_LOG_FMT(NETPLAY, "Adaptive pad buffer: {} -> {} (latency {} ms)", m_target_buffer_size,
+                   m_target_buffer_size - 1, worst_latency_ms);
+      AdjustPadBufferSize(m_target_buffer_size - 1);
+    }
+  }
+  else
+  {
+    m_adaptive_buffer_decrease_votes = 0;
+  }
+}
+
 void NetPlayServer::SetHostInputAuthority(const bool enable)
 {
   std::lock_guard lkg(m_crit.game);
@@ -1002,7 +1060,10 @@ unsigned int NetPlayServer::OnData(sf::Packet& packet, Client& player)
 
         m_desync_detected = true;
       }
-      m_timebase_by_frame.erase(frame);
+      // Frames before this one can't be completed anymore, as each player sends its timebases
+      // in order. This happens when a player leaves before reporting them.
+      m_timebase_by_frame.erase(m_timebase_by_frame.begin(),
+                                m_timebase_by_frame.upper_bound(frame));
     }
   }
   break;
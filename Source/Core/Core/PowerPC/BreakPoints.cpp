@@ -233,7 +233,11 @@ bool MemChecks::ToggleBreakPoint(u32 address)
   if (iter == m_mem_checks.end())
     return false;
 
-  iter->is_enabled = !iter->is_enabled;
+  Core::RunAsCPUThread([&] {
+    iter->is_enabled = !iter->is_enabled;
+    // Disabled memchecks don't keep their pages out of the fastmem arena.
+    PowerPC::DBATUpdated();
+  });
   return true;
 }
 
@@ -286,6 +290,9 @@ bool MemChecks::OverlapsMemcheck(u32 address, u32 length) const
   const u32 page_end_address = address | page_end_suffix;
 
   return std::any_of(m_mem_checks.cbegin(), m_mem_checks.cend(), [&](const auto& mc) {
+    if (!mc.is_enabled)
+      return false;
+
     return ((mc.start_address | page_end_suffix) == page_end_address ||
             (mc.end_address | page_end_suffix) == page_end_address) ||
            ((mc.start_address | page_end_suffix) < page_end_address &&
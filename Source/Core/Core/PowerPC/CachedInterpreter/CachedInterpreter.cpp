@@ -34,6 +34,9 @@ struct CachedInterpreter::Instruction
   {
     Abort,
     Common,
+    // A superinstruction which runs this and the next instruction, which has to be a common one,
+    // without dispatching in between.
+    CommonPair,
     Conditional,
   };
 
@@ -86,24 +89,64 @@ void CachedInterpreter::ExecuteOneBlock()
 
   const Instruction* code = reinterpret_cast<const Instruction*>(normal_entry);
 
-  for (; code->type != Instruction::Type::Abort; ++code)
+#ifdef __GNUC__
+  // Threaded dispatch: every handler jumps straight to the handler of the next instruction, so
+  // that each of these indirect branches gets predicted separately. The order of the labels has to
+  // match Instruction::Type.
+  static const void* const handlers[] = {&&abort, &&common, &&common_pair, &&conditional};
+#define DISPATCH() goto* handlers[static_cast<size_t>(code->type)]
+
+  DISPATCH();
+
+common:
+  code->common_callback(UGeckoInstruction(code->data));
+  ++code;
+  DISPATCH();
+
+common_pair:
+  code[0].common_callback(UGeckoInstruction(code[0].data));
+  code[1].common_callback(UGeckoInstruction(code[1].data));
+  code += 2;
+  DISPATCH();
+
+conditional:
+  if (code->conditional_callback(code->data))
+    return;
+  ++code;
+  DISPATCH();
+
+abort:
+  return;
+#undef DISPATCH
+#else
+  while (code->type != Instruction::Type::Abort)
   {
     switch (code->type)
     {
     case Instruction::Type::Common:
       code->common_callback(UGeckoInstruction(code->data));
+      ++code;
+      break;
+
+    case Instruction::Type::CommonPair:
+      code[0].common_callback(UGeckoInstruction(code[0].data));
+      code[1].common_callback(UGeckoInstruction(code[1].data));
+      code += 2;
       break;
 
     case Instruction::Type::Conditional:
       if (code->conditional_callback(code->data))
         return;
+      ++code;
       break;
 
     default:
       ERROR_LOG_FMT(POWERPC, "Unknown CachedInterpreter Instruction: {}", code->type);
+      ++code;
       break;
     }
   }
+#endif
 }
 
 void CachedInterpreter::Run()
@@ -235,6 +278,7 @@ void CachedInterpreter::Jit(u32 address)
   }
 
   JitBlock* b = m_block_cache.AllocateBlock(PC);
+  const size_t block_start = m_code.size();
 
   js.blockStart = PC;
   js.firstFPInstructionFound = false;
@@ -306,12 +350,30 @@ void CachedInterpreter::Jit(u32 address)
   }
   m_code.emplace_back();
 
+  FuseInstructions(block_start);
+
   b->codeSize = (u32)(GetCodePtr() - b->checkedEntry);
   b->originalSize = code_block.m_num_instructions;
 
   m_block_cache.FinalizeBlock(*b, jo.enableBlocklink, code_block.m_physical_addresses);
 }
 
+void CachedInterpreter::FuseInstructions(size_t start)
+{
+  // Turn pairs of common instructions into superinstructions, which halves the number of
+  // dispatches for runs of plain instructions like an lwz followed by an addi, a psq_l followed by
+  // a ps_madd, or a compare followed by the PC update of the branch that uses its result.
+  for (size_t i = start; i + 1 < m_code.size(); i++)
+  {
+    if (m_code[i].type == Instruction::Type::Common &&
+        m_code[i + 1].type == Instruction::Type::Common)
+    {
+      m_code[i].type = Instruction::Type::CommonPair;
+      i++;
+    }
+  }
+}
+
 void CachedInterpreter::ClearCache()
 {
   m_code.clear();
@@ -36,6 +36,7 @@ private:
 
   u8* GetCodePtr();
   void ExecuteOneBlock();
+  void FuseInstructions(size_t start);
 
   bool HandleFunctionHooking(u32 address);
 
@@ -3,6 +3,7 @@
 
 // Originally written by Sven Peter <sven@fail0verflow.com> for anergistic.
 
+#include <array>
 #include <optional>
 #include <signal.h>
 #include <stdint.h>
@@ -114,18 +115,31 @@ static void hex2mem(u8* dst, u8* src, u32 len)
   }
 }
 
+// Bytes that have been received from the socket but not consumed yet. Reading the socket in
+// chunks rather than one byte per recv() call keeps memory polling by a debugger from being
+// dominated by syscall overhead.
+static std::array<u8, GDB_BFR_MAX> s_recv_bfr;
+static size_t s_recv_pos = 0;
+static size_t s_recv_len = 0;
+
 static u8 gdb_read_byte()
 {
-  u8 c = '+';
-
-  const ssize_t res = recv(sock, (char*)&c, 1, MSG_WAITALL);
-  if (res != 1)
+  if (s_recv_pos == s_recv_len)
   {
-    ERROR_LOG_FMT(GDB_STUB, "recv failed : {}", res);
-    gdb_deinit();
+    s_recv_pos = 0;
+    s_recv_len = 0;
+
+    const ssize_t res = recv(sock, (char*)s_recv_bfr.data(), s_recv_bfr.size(), 0);
+    if (res <= 0)
+    {
+      ERROR_LOG_FMT(GDB_STUB, "recv failed : {}", res);
+      gdb_deinit();
+      return '+';
+    }
+    s_recv_len = static_cast<size_t>(res);
   }
 
-  return c;
+  return s_recv_bfr[s_recv_pos++];
 }
 
 static u8 gdb_calc_chksum()
@@ -302,6 +316,9 @@ static void gdb_read_command()
 
 static int gdb_data_available()
 {
+  if (s_recv_pos != s_recv_len)
+    return 1;
+
   struct timeval t;
   fd_set _fds, *fds = &_fds;
 
@@ -590,7 +607,7 @@ static void gdb_read_mem()
   DEBUG_LOG_FMT(GDB_STUB, "gdb: read memory: {:08x} bytes from {:08x}", len, addr);
 
   if (len * 2 > sizeof reply)
-    gdb_reply("E01");
+    return gdb_reply("E01");
   u8* data = Memory::GetPointer(addr);
   if (!data)
     return gdb_reply("E0");
@@ -883,6 +900,8 @@ void gdb_deinit()
     sock = -1;
   }
 
+  s_recv_pos = 0;
+  s_recv_len = 0;
   s_socket_context.reset();
 }
 
@@ -78,6 +78,32 @@ void UpdatePC()
   last_pc = PC;
   PC = NPC;
 }
+
+// Resolving an instruction to its handler and info takes several dependent table lookups, so the
+// results are cached by instruction word. They only depend on the word itself, so unlike a cache
+// indexed by address, this never has to be invalidated when guest code is modified.
+struct DecodedInstruction
+{
+  u32 hex = 0;
+  Interpreter::Instruction handler = nullptr;
+  const GekkoOPInfo* opinfo = nullptr;
+};
+
+constexpr u32 DECODE_CACHE_BITS = 12;
+std::array<DecodedInstruction, 1 << DECODE_CACHE_BITS> s_decode_cache;
+
+// Must not be called with an instruction word of 0, which marks empty entries.
+const DecodedInstruction& Decode(UGeckoInstruction inst)
+{
+  DecodedInstruction& entry = s_decode_cache[(inst.hex * 0x9E3779B1U) >> (32 - DECODE_CACHE_BITS)];
+  if (entry.hex != inst.hex)
+  {
+    entry.hex = inst.hex;
+    entry.handler = PPCTables::GetInterpreterOp(inst);
+    entry.opinfo = PPCTables::GetOpInfo(inst);
+  }
+  return entry;
+}
 }  // Anonymous namespace
 
 void Interpreter::RunTable4(UGeckoInstruction inst)
@@ -177,8 +203,12 @@ int Interpreter::SingleStepInner()
     Trace(m_prev_inst);
   }
 
+  const GekkoOPInfo* opinfo;
   if (m_prev_inst.hex != 0)
   {
+    const DecodedInstruction& decoded = Decode(m_prev_inst);
+    opinfo = decoded.opinfo;
+
     if (IsInvalidPairedSingleExecution(m_prev_inst))
     {
       GenerateProgramException();
@@ -186,7 +216,7 @@ int Interpreter::SingleStepInner()
     }
     else if (MSR.FP)
     {
-      m_op_table[m_prev_inst.OPCD](m_prev_inst);
+      decoded.handler(m_prev_inst);
       if (PowerPC::ppcState.Exceptions & EXCEPTION_DSI)
       {
         CheckExceptions();
@@ -195,14 +225,14 @@ int Interpreter::SingleStepInner()
     else
     {
       // check if we have to generate a FPU unavailable exception or a program exception.
-      if (PPCTables::UsesFPU(m_prev_inst))
+      if ((opinfo->flags & FL_USE_FPU) != 0)
       {
         PowerPC::ppcState.Exceptions |= EXCEPTION_FPU_UNAVAILABLE;
         CheckExceptions();
       }
       else
       {
-        m_op_table[m_prev_inst.OPCD](m_prev_inst);
+        decoded.handler(m_prev_inst);
         if (PowerPC::ppcState.Exceptions & EXCEPTION_DSI)
         {
           CheckExceptions();
@@ -214,16 +244,28 @@ int Interpreter::SingleStepInner()
   {
     // Memory exception on instruction fetch
     CheckExceptions();
+    opinfo = PPCTables::GetOpInfo(m_prev_inst);
   }
 
   UpdatePC();
 
-  const GekkoOPInfo* opinfo = PPCTables::GetOpInfo(m_prev_inst);
   PowerPC::UpdatePerformanceMonitor(opinfo->numCycles, (opinfo->flags & FL_LOADSTORE) != 0,
                                     (opinfo->flags & FL_USE_FPU) != 0);
   return opinfo->numCycles;
 }
 
+int Interpreter::RunBlock()
+{
+  m_end_block = false;
+
+  int cycles = 0;
+  while (!m_end_block)
+  {
+    cycles += SingleStepInner();
+  }
+  return cycles;
+}
+
 void Interpreter::SingleStep()
 {
   // Declare start of new slice
@@ -322,16 +364,7 @@ void Interpreter::Run()
     {
       // "fast" version of inner loop. well, it's not so fast.
       while (PowerPC::ppcState.downcount > 0)
-      {
-        m_end_block = false;
-
-        int cycles = 0;
-        while (!m_end_block)
-        {
-          cycles += SingleStepInner();
-        }
-        PowerPC::ppcState.downcount -= cycles;
-      }
+        PowerPC::ppcState.downcount -= RunBlock();
     }
   }
 }
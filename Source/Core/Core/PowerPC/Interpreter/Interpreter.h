@@ -16,6 +16,8 @@ public:
   void Shutdown() override;
   void SingleStep() override;
   int SingleStepInner();
+  // Runs instructions until the end of the current block, and returns the cycles they took.
+  int RunBlock();
 
   void Run() override;
   void ClearCache() override;
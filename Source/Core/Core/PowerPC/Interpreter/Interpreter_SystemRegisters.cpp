@@ -10,6 +10,7 @@
 #include "Core/HW/SystemTimers.h"
 #include "Core/PowerPC/Interpreter/ExceptionUtils.h"
 #include "Core/PowerPC/Interpreter/Interpreter_FPUtils.h"
+#include "Core/PowerPC/JitInterface.h"
 #include "Core/PowerPC/MMU.h"
 #include "Core/PowerPC/PowerPC.h"
 
@@ -541,7 +542,8 @@ void Interpreter::mcrf(UGeckoInstruction inst)
 
 void Interpreter::isync(UGeckoInstruction inst)
 {
-  // shouldn't do anything
+  // Code modified before the isync has to be recompiled before it runs.
+  JitInterface::FlushPendingInvalidations();
 }
 
 // the following commands read from FPSCR
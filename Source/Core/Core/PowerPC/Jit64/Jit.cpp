@@ -3,6 +3,8 @@
 
 #include "Core/PowerPC/Jit64/Jit.h"
 
+#include <algorithm>
+#include <array>
 #include <map>
 #include <sstream>
 #include <string>
@@ -16,6 +18,7 @@
 #endif
 
 #include "Common/CommonTypes.h"
+#include "Common/Config/Config.h"
 #include "Common/GekkoDisassembler.h"
 #include "Common/IOFile.h"
 #include "Common/Logging/Log.h"
@@ -24,6 +27,7 @@
 #include "Common/StringUtil.h"
 #include "Common/Swap.h"
 #include "Common/x64ABI.h"
+#include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
 #include "Core/HLE/HLE.h"
@@ -233,7 +237,11 @@ bool Jit64::HandleFault(uintptr_t access_address, SContext* ctx)
 
   const auto logical_base_ptr = reinterpret_cast<uintptr_t>(Memory::logical_base);
   if (access_address >= logical_base_ptr && access_address < logical_base_ptr + 0x100010000)
+  {
+    if (Memory::HandlePageTableFault(access_address))
+      return true;
     return BackPatch(static_cast<u32>(access_address - logical_base_ptr), ctx);
+  }
 
   return false;
 }
@@ -346,7 +354,10 @@ void Jit64::Init()
   const size_t trampolines_size = jo.memcheck ? TRAMPOLINE_CODE_SIZE_MMU : TRAMPOLINE_CODE_SIZE;
   const size_t farcode_size = jo.memcheck ? FARCODE_SIZE_MMU : FARCODE_SIZE;
   const size_t constpool_size = m_const_pool.CONST_POOL_SIZE;
-  AllocCodeSpace(CODE_SIZE + routines_size + trampolines_size + farcode_size + constpool_size);
+  AllocCodeSpace(GetCodeCacheSize() + routines_size + trampolines_size + farcode_size +
+                 constpool_size);
+  if (Config::Get(Config::MAIN_HUGE_PAGES))
+    AdviseHugePages();
   AddChildCodeSpace(&asm_routines, routines_size);
   AddChildCodeSpace(&trampolines, trampolines_size);
   AddChildCodeSpace(&m_far_code, farcode_size);
@@ -404,6 +415,14 @@ void Jit64::ResetFreeMemoryRanges()
 
 void Jit64::Shutdown()
 {
+  INFO_LOG_FMT(DYNA_REC, "JIT code space: {} of {} KiB resident", GetResidentBytes() / 1024,
+               total_region_size / 1024);
+  if (Config::Get(Config::MAIN_HUGE_PAGES))
+  {
+    INFO_LOG_FMT(DYNA_REC, "JIT code space: {} KiB backed by huge pages",
+                 GetHugePageBytes() / 1024);
+  }
+
   FreeStack();
   FreeCodeSpace();
 
@@ -416,9 +435,15 @@ void Jit64::Shutdown()
 
 void Jit64::FallBackToInterpreter(UGeckoInstruction inst)
 {
+  js.curBlock->interpreter_fallbacks++;
+
   gpr.Flush();
   fpr.Flush();
 
+  // The interpreter computes FPRF right away, which a deferred result mustn't overwrite later.
+  if ((js.op->opinfo->flags & FL_SET_FPRF) && SConfig::GetInstance().bFPRF)
+    MaterializeFPRF();
+
   if (js.op->opinfo->flags & FL_ENDBLOCK)
   {
     MOV(32, PPCSTATE(pc), Imm32(js.compilerPC));
@@ -493,7 +518,7 @@ static void ImHere()
   been_here[PC] = 1;
 }
 
-bool Jit64::Cleanup()
+bool Jit64::Cleanup(BitSet32 registers_in_use)
 {
   bool did_something = false;
 
@@ -503,9 +528,9 @@ bool Jit64::Cleanup()
     SUB(64, R(RSCRATCH), PPCSTATE(gather_pipe_base_ptr));
     CMP(64, R(RSCRATCH), Imm32(GPFifo::GATHER_PIPE_SIZE));
     FixupBranch exit = J_CC(CC_L);
-    ABI_PushRegistersAndAdjustStack({}, 0);
+    ABI_PushRegistersAndAdjustStack(registers_in_use, 0);
     ABI_CallFunction(GPFifo::UpdateGatherPipe);
-    ABI_PopRegistersAndAdjustStack({}, 0);
+    ABI_PopRegistersAndAdjustStack(registers_in_use, 0);
     SetJumpTarget(exit);
     did_something = true;
   }
@@ -513,10 +538,10 @@ bool Jit64::Cleanup()
   // SPEED HACK: MMCR0/MMCR1 should be checked at run-time, not at compile time.
   if (MMCR0.Hex || MMCR1.Hex)
   {
-    ABI_PushRegistersAndAdjustStack({}, 0);
+    ABI_PushRegistersAndAdjustStack(registers_in_use, 0);
     ABI_CallFunctionCCC(PowerPC::UpdatePerformanceMonitor, js.downcountAmount, js.numLoadStoreInst,
                         js.numFloatingPointInst);
-    ABI_PopRegistersAndAdjustStack({}, 0);
+    ABI_PopRegistersAndAdjustStack(registers_in_use, 0);
     did_something = true;
   }
 
@@ -573,6 +598,26 @@ void Jit64::WriteExit(u32 destination, bool bl, u32 after)
   JustWriteExit(destination, bl, after);
 }
 
+bool Jit64::CanJumpToLoopStart(u32 destination, bool bl) const
+{
+  return m_loop_start && destination == js.blockStart && !bl &&
+         js.carryFlag == CarryFlag::InPPCState && gpr.ArePinnedRegistersInPlace() &&
+         fpr.ArePinnedRegistersInPlace();
+}
+
+void Jit64::WriteLoopExit()
+{
+  // The register caches have been flushed, but the host registers still hold the values of the
+  // pinned registers, which is all the start of the loop expects.
+  const BitSet32 pinned = gpr.PinnedRegistersInUse() | (fpr.PinnedRegistersInUse() << 16);
+  Cleanup(pinned & ABI_ALL_CALLER_SAVED);
+
+  SUB(32, PPCSTATE(downcount), Imm32(js.downcountAmount));
+  J_CC(CC_G, m_loop_start);
+
+  JustWriteExit(js.blockStart, false, 0);
+}
+
 void Jit64::JustWriteExit(u32 destination, bool bl, u32 after)
 {
   // If nobody has taken care of this yet (this can be removed when all branches are done)
@@ -744,10 +789,10 @@ void Jit64::Trace()
 
 void Jit64::Jit(u32 em_address)
 {
-  Jit(em_address, true);
+  Jit(em_address, OnCodeSpaceFull::EvictOldBlocks);
 }
 
-void Jit64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
+void Jit64::Jit(u32 em_address, OnCodeSpaceFull on_full)
 {
   if (m_cleanup_after_stackfault)
   {
@@ -759,6 +804,9 @@ void Jit64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
 #endif
   }
 
+  if (InterpretColdBlock(em_address))
+    return;
+
   if (trampolines.IsAlmostFull() || SConfig::GetInstance().bJITNoBlockCache)
   {
     if (!SConfig::GetInstance().bJITNoBlockCache)
@@ -803,10 +851,16 @@ void Jit64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
     }
   }
 
+  // Blocks which have been run often enough are recompiled as traces, see DoJit.
+  if (js.hotTraceAddresses.find(em_address) != js.hotTraceAddresses.end())
+    analyzer.SetOption(PPCAnalyst::PPCAnalyzer::OPTION_TRACE);
+  else
+    analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_TRACE);
+
   // Analyze the block, collect all instructions it is made of (including inlining,
   // if that is enabled), reorder instructions for optimal performance, and join joinable
   // instructions.
-  const u32 nextPC = analyzer.Analyze(em_address, &code_block, &m_code_buffer, block_size);
+  const u32 nextPC = AnalyzeBlock(em_address, block_size);
 
   if (code_block.m_memory_exception)
   {
@@ -846,16 +900,29 @@ void Jit64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
       blocks.FinalizeBlock(*b, jo.enableBlocklink, code_block.m_physical_addresses);
       return;
     }
+
+    blocks.DiscardBlock(*b);
   }
 
-  if (clear_cache_and_retry_on_failure)
+  // Code generation failed due to not enough free space in either the near or far code regions.
+  switch (on_full)
   {
-    // Code generation failed due to not enough free space in either the near or far code regions.
-    // Clear the entire JIT cache and retry.
+  case OnCodeSpaceFull::EvictOldBlocks:
+    // Evict the older half of the blocks and retry. Recently compiled blocks are kept, which avoids
+    // recompiling all of the hot code at once.
+    WARN_LOG_FMT(POWERPC, "evicting old blocks from the code caches");
+    blocks.EvictOldBlocks();
+    Jit(em_address, OnCodeSpaceFull::ClearCache);
+    return;
+  case OnCodeSpaceFull::ClearCache:
+    // The free space can still be too fragmented after evicting blocks. Clear the entire JIT cache
+    // and retry.
     WARN_LOG_FMT(POWERPC, "flushing code caches, please report if this happens a lot");
     ClearCache();
-    Jit(em_address, false);
+    Jit(em_address, OnCodeSpaceFull::Fail);
     return;
+  case OnCodeSpaceFull::Fail:
+    break;
   }
 
   PanicAlertFmtT(
@@ -890,6 +957,7 @@ bool Jit64::SetEmitterStateToFreeCodeRegion()
 bool Jit64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
 {
   js.firstFPInstructionFound = false;
+  js.fprfMaterialized = false;
   js.isLastInstruction = false;
   js.blockStart = em_address;
   js.fifoBytesSinceCheck = 0;
@@ -921,6 +989,30 @@ bool Jit64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
     ADD(64, MDisp(ABI_PARAM1, offset), Imm8(1));
     ABI_CallFunction(QueryPerformanceCounter);
   }
+
+  // Count the runs of the block, and once it becomes hot, invalidate it so that it gets recompiled
+  // as a trace which follows more branches, calls and returns. This leaves fewer block exits
+  // where the register caches have to be flushed.
+  const int trace_threshold = Config::Get(Config::MAIN_JIT_TRACE_THRESHOLD);
+  if (trace_threshold > 0 && !analyzer.HasOption(PPCAnalyst::PPCAnalyzer::OPTION_TRACE) &&
+      analyzer.HasOption(PPCAnalyst::PPCAnalyzer::OPTION_BRANCH_FOLLOW))
+  {
+    b->trace_countdown = static_cast<u32>(trace_threshold);
+    MOV(64, R(RSCRATCH), ImmPtr(&b->trace_countdown));
+    SUB(32, MatR(RSCRATCH), Imm8(1));
+    FixupBranch hot = J_CC(CC_Z, true);
+
+    SwitchToFarCode();
+    SetJumpTarget(hot);
+    MOV(32, PPCSTATE(pc), Imm32(js.blockStart));
+    ABI_PushRegistersAndAdjustStack({}, 0);
+    ABI_CallFunctionC(JitInterface::CompileExceptionCheck,
+                      static_cast<u32>(JitInterface::ExceptionType::HotTrace));
+    ABI_PopRegistersAndAdjustStack({}, 0);
+    JMP(asm_routines.dispatcher_no_check, true);
+    SwitchToNearCode();
+  }
+
 #if defined(_DEBUG) || defined(DEBUGFAST) || defined(NAN_CHECK)
   // should help logged stack-traces become more accurate
   MOV(32, PPCSTATE(pc), Imm32(js.blockStart));
@@ -974,6 +1066,13 @@ bool Jit64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
     IntializeSpeculativeConstants();
   }
 
+  m_loop_start = nullptr;
+  if (Config::Get(Config::MAIN_JIT_LOOP_REGISTER_PINNING) && !jo.profile_blocks &&
+      !SConfig::GetInstance().bEnableDebugging)
+  {
+    PinLoopRegisters();
+  }
+
   // Translate instructions
   for (u32 i = 0; i < code_block.m_num_instructions; i++)
   {
@@ -1005,10 +1104,16 @@ bool Jit64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
     {
       js.fifoBytesSinceCheck = 0;
       js.mustCheckFifo = false;
+      // Only leave JIT code when there is at least one full burst to flush.
+      MOV(64, R(RSCRATCH), PPCSTATE(gather_pipe_ptr));
+      SUB(64, R(RSCRATCH), PPCSTATE(gather_pipe_base_ptr));
+      CMP(64, R(RSCRATCH), Imm32(GPFifo::GATHER_PIPE_SIZE));
+      FixupBranch no_burst = J_CC(CC_L);
       BitSet32 registersInUse = CallerSavedRegistersInUse();
       ABI_PushRegistersAndAdjustStack(registersInUse, 0);
-      ABI_CallFunction(GPFifo::FastCheckGatherPipe);
+      ABI_CallFunction(GPFifo::UpdateGatherPipe);
       ABI_PopRegistersAndAdjustStack(registersInUse, 0);
+      SetJumpTarget(no_burst);
       gatherPipeIntCheck = true;
     }
 
@@ -1116,6 +1221,9 @@ bool Jit64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
         fpr.PreloadRegisters(op.fregsIn & op.fprInXmm & ~op.fprDiscardable);
       }
 
+      if ((opinfo->flags & FL_READ_FPRF) && SConfig::GetInstance().bFPRF)
+        MaterializeFPRF();
+
       CompileInstruction(op);
 
       js.fpr_is_store_safe = op.fprIsStoreSafeAfterInst;
@@ -1161,14 +1269,15 @@ bool Jit64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
       gpr.Commit();
       fpr.Commit();
 
-      // If we have a register that will never be used again, discard or flush it.
+      // If we have a register that will never be used again, discard or flush it. Pinned
+      // registers are used again by the next iteration of the loop.
       if (!SConfig::GetInstance().bJITRegisterCacheOff)
       {
-        gpr.Discard(op.gprDiscardable);
-        fpr.Discard(op.fprDiscardable);
+        gpr.Discard(op.gprDiscardable & ~gpr.PinnedRegisters());
+        fpr.Discard(op.fprDiscardable & ~fpr.PinnedRegisters());
       }
-      gpr.Flush(~op.gprInUse);
-      fpr.Flush(~op.fprInUse);
+      gpr.Flush(~op.gprInUse & ~gpr.PinnedRegisters());
+      fpr.Flush(~op.fprInUse & ~fpr.PinnedRegisters());
 
       if (opinfo->flags & FL_LOADSTORE)
         ++js.numLoadStoreInst;
@@ -1242,6 +1351,58 @@ void Jit64::EnableOptimization()
   analyzer.SetOption(PPCAnalyst::PPCAnalyzer::OPTION_BRANCH_FOLLOW);
 }
 
+void Jit64::PinLoopRegisters()
+{
+  // Only handle blocks which branch back to their own start. Conditional branches inside the
+  // block may still leave the loop through a normal exit.
+  const auto begin = m_code_buffer.begin();
+  const auto end = begin + code_block.m_num_instructions;
+  const bool is_loop = std::any_of(begin, end, [this](const PPCAnalyst::CodeOp& op) {
+    return op.branchTo == js.blockStart && !op.branchIsIdleLoop && !op.inst.LK &&
+           (op.inst.OPCD == 16 || op.inst.OPCD == 18);
+  });
+  if (!is_loop)
+    return;
+
+  // The speculative constants are only checked once on entry, and registers holding immediates
+  // can't be kept in host registers across iterations.
+  for (auto i : code_block.m_gpr_inputs)
+  {
+    if (gpr.IsImm(i))
+      return;
+  }
+
+  std::array<u32, 32> gpr_uses{};
+  std::array<u32, 32> fpr_uses{};
+  for (auto it = begin; it != end; ++it)
+  {
+    for (auto i : it->regsIn | it->regsOut)
+      gpr_uses[i]++;
+    for (auto i : it->fregsIn | it->GetFregsOut())
+      fpr_uses[i]++;
+  }
+
+  // Pin the most used registers of the loop body. Registers which are only used once per
+  // iteration aren't worth keeping out of the reach of the allocator.
+  constexpr size_t MAX_PINNED_REGISTERS = 4;
+  const auto most_used = [](const std::array<u32, 32>& uses) {
+    std::array<u32, 32> order;
+    for (u32 i = 0; i < 32; i++)
+      order[i] = i;
+    std::stable_sort(order.begin(), order.end(),
+                     [&uses](u32 a, u32 b) { return uses[a] > uses[b]; });
+
+    BitSet32 result;
+    for (size_t i = 0; i < MAX_PINNED_REGISTERS && uses[order[i]] >= 2; i++)
+      result[order[i]] = true;
+    return result;
+  };
+
+  gpr.Pin(most_used(gpr_uses));
+  fpr.Pin(most_used(fpr_uses));
+  m_loop_start = GetCodePtr();
+}
+
 void Jit64::IntializeSpeculativeConstants()
 {
   // If the block depends on an input register which looks like a gather pipe or MMIO related
@@ -1250,13 +1411,17 @@ void Jit64::IntializeSpeculativeConstants()
   // the first block loads the constant.
   // Insert a check at the start of the block to verify that the value is actually constant.
   // This can save a lot of backpatching and optimize gather pipe writes in more places.
+  // Base registers of loads and stores which currently point to MMIO are treated the same way, so
+  // that hardware register accesses in loops get resolved handlers rather than fastmem faults.
   const u8* target = nullptr;
   for (auto i : code_block.m_gpr_inputs)
   {
     u32 compileTimeValue = PowerPC::ppcState.gpr[i];
     if (PowerPC::IsOptimizableGatherPipeWrite(compileTimeValue) ||
         PowerPC::IsOptimizableGatherPipeWrite(compileTimeValue - 0x8000) ||
-        compileTimeValue == 0xCC000000)
+        compileTimeValue == 0xCC000000 ||
+        (code_block.m_gpr_address_inputs[i] &&
+         PowerPC::IsOptimizableMMIOAccess(compileTimeValue, 8) != 0))
     {
       if (!target)
       {
@@ -48,6 +48,11 @@ public:
   void Shutdown() override;
 
   bool HandleFault(uintptr_t access_address, SContext* ctx) override;
+  bool IsInBlockCode(const u8* ptr) const override
+  {
+    return IsInSpace(ptr) || m_far_code.IsInSpace(ptr) || trampolines.IsInSpace(ptr);
+  }
+  bool IsInRoutines(const u8* ptr) const override { return asm_routines.IsInSpace(ptr); }
   bool HandleStackFault() override;
   bool BackPatch(u32 emAddress, SContext* ctx);
 
@@ -56,8 +61,17 @@ public:
 
   // Jit!
 
+  // What to do if there isn't enough free code space for a block. Each step is tried before the
+  // next one.
+  enum class OnCodeSpaceFull
+  {
+    EvictOldBlocks,
+    ClearCache,
+    Fail,
+  };
+
   void Jit(u32 em_address) override;
-  void Jit(u32 em_address, bool clear_cache_and_retry_on_failure);
+  void Jit(u32 em_address, OnCodeSpaceFull on_full);
   bool DoJit(u32 em_address, JitBlock* b, u32 nextPC);
 
   // Finds a free memory region and sets the near and far code emitters to point at that region.
@@ -68,6 +82,7 @@ public:
   BitSet8 ComputeStaticGQRs(const PPCAnalyst::CodeBlock&) const;
 
   void IntializeSpeculativeConstants();
+  void PinLoopRegisters();
 
   JitBlockCache* GetBlockCache() override { return &blocks; }
   void Trace();
@@ -91,7 +106,11 @@ public:
   void WriteExternalExceptionExit();
   void WriteRfiExitDestInRSCRATCH();
   void WriteIdleExit(u32 destination);
-  bool Cleanup();
+  // Whether a branch to the destination can jump straight back to the start of a loop block,
+  // keeping the pinned registers in their host registers.
+  bool CanJumpToLoopStart(u32 destination, bool bl) const;
+  void WriteLoopExit();
+  bool Cleanup(BitSet32 registers_in_use = BitSet32{});
 
   void GenerateConstantOverflow(bool overflow);
   void GenerateConstantOverflow(s64 val);
@@ -122,6 +141,10 @@ public:
   Gen::FixupBranch JumpIfCRFieldBit(int field, int bit, bool jump_if_set = true);
 
   void SetFPRFIfNeeded(const Gen::OpArg& xmm, bool single);
+  // Whether FPRF is read by an instruction in the rest of the block before it's overwritten.
+  bool IsFPRFReadInBlock() const;
+  // Computes FPRF of a result whose computation was deferred, if there might be one.
+  void MaterializeFPRF();
   void FinalizeSingleResult(Gen::X64Reg output, const Gen::OpArg& input, bool packed = true,
                             bool duplicate = false);
   void FinalizeDoubleResult(Gen::X64Reg output, const Gen::OpArg& input);
@@ -246,6 +269,7 @@ public:
   void dcbx(UGeckoInstruction inst);
 
   void eieio(UGeckoInstruction inst);
+  void isync(UGeckoInstruction inst);
 
 private:
   void CompileInstruction(PPCAnalyst::CodeOp& op);
@@ -267,6 +291,8 @@ private:
 
   bool m_enable_blr_optimization;
   bool m_cleanup_after_stackfault;
+  // Where a block which loops back to its own start jumps to, or nullptr.
+  const u8* m_loop_start = nullptr;
   u8* m_stack;
 
   HyoutaUtilities::RangeSizeSet<u8*> m_free_ranges_near;
@@ -83,6 +83,7 @@ void Jit64::bx(UGeckoInstruction inst)
     return;
   }
 
+  const bool loop = !js.op->branchIsIdleLoop && CanJumpToLoopStart(js.op->branchTo, inst.LK);
   gpr.Flush();
   fpr.Flush();
 
@@ -94,6 +95,10 @@ void Jit64::bx(UGeckoInstruction inst)
   {
     WriteIdleExit(js.op->branchTo);
   }
+  else if (loop)
+  {
+    WriteLoopExit();
+  }
   else
   {
     WriteExit(js.op->branchTo, inst.LK, js.compilerPC + 4);
@@ -149,6 +154,7 @@ void Jit64::bcx(UGeckoInstruction inst)
   {
     RCForkGuard gpr_guard = gpr.Fork();
     RCForkGuard fpr_guard = fpr.Fork();
+    const bool loop = !js.op->branchIsIdleLoop && CanJumpToLoopStart(js.op->branchTo, inst.LK);
     gpr.Flush();
     fpr.Flush();
 
@@ -156,6 +162,10 @@ void Jit64::bcx(UGeckoInstruction inst)
     {
       WriteIdleExit(js.op->branchTo);
     }
+    else if (loop)
+    {
+      WriteLoopExit();
+    }
     else
     {
       WriteExit(js.op->branchTo, inst.LK, js.compilerPC + 4);
@@ -46,7 +46,59 @@ void Jit64::SetFPRFIfNeeded(const OpArg& input, bool single)
   else
     MOVSD(xmm, input);
 
+  if (!IsFPRFReadInBlock())
+  {
+    // Most results are overwritten by another one before anything reads FPRF, so only store the
+    // result and leave computing its class to PowerPC::MaterializeFPRF.
+    MOVSD(PPCSTATE(pending_fprf_value), xmm);
+    MOV(32, PPCSTATE(pending_fprf),
+        Imm32(static_cast<u32>(single ? PowerPC::PendingFPRF::Single :
+                                        PowerPC::PendingFPRF::Double)));
+    js.fprfMaterialized = false;
+    return;
+  }
+
   SetFPRF(xmm, single);
+
+  // Don't let a result from an earlier block overwrite this one.
+  if (!js.fprfMaterialized)
+  {
+    MOV(32, PPCSTATE(pending_fprf), Imm32(static_cast<u32>(PowerPC::PendingFPRF::None)));
+    js.fprfMaterialized = true;
+  }
+}
+
+bool Jit64::IsFPRFReadInBlock() const
+{
+  for (int i = 1; i <= js.instructionsLeft; i++)
+  {
+    const u64 flags = js.op[i].opinfo->flags;
+    if (flags & FL_READ_FPRF)
+      return true;
+    if (flags & FL_SET_FPRF)
+      return false;
+  }
+  return false;
+}
+
+void Jit64::MaterializeFPRF()
+{
+  if (js.fprfMaterialized)
+    return;
+
+  CMP(32, PPCSTATE(pending_fprf), Imm32(static_cast<u32>(PowerPC::PendingFPRF::None)));
+  FixupBranch pending = J_CC(CC_NZ, true);
+  SwitchToFarCode();
+  SetJumpTarget(pending);
+  BitSet32 registers_in_use = CallerSavedRegistersInUse();
+  ABI_PushRegistersAndAdjustStack(registers_in_use, 0);
+  ABI_CallFunction(PowerPC::MaterializeFPRF);
+  ABI_PopRegistersAndAdjustStack(registers_in_use, 0);
+  FixupBranch done = J(true);
+  SwitchToNearCode();
+  SetJumpTarget(done);
+
+  js.fprfMaterialized = true;
 }
 
 void Jit64::FinalizeSingleResult(X64Reg output, const OpArg& input, bool packed, bool duplicate)
@@ -153,14 +205,25 @@ void Jit64::HandleNaNs(UGeckoInstruction inst, X64Reg xmm_out, X64Reg xmm, X64Re
       FixupBranch handle_nan = J_CC(CC_NZ, true);
       SwitchToFarCode();
       SetJumpTarget(handle_nan);
-      ASSERT_MSG(DYNA_REC, clobber == XMM0, "BLENDVPD implicitly uses XMM0");
-      BLENDVPD(xmm, MConst(psGeneratedQNaN));
+      // The VEX encoding takes the mask as an explicit operand, so any register can be clobbered.
+      const auto blend = [&](const OpArg& src) {
+        if (cpu_info.bAVX)
+        {
+          VBLENDVPD(xmm, xmm, src, clobber);
+        }
+        else
+        {
+          ASSERT_MSG(DYNA_REC, clobber == XMM0, "BLENDVPD implicitly uses XMM0");
+          BLENDVPD(xmm, src);
+        }
+      };
+      blend(MConst(psGeneratedQNaN));
       for (u32 x : inputs)
       {
         RCOpArg Rx = fpr.Use(x, RCMode::Read);
         RegCache::Realize(Rx);
         avx_op(&XEmitter::VCMPPD, &XEmitter::CMPPD, clobber, Rx, Rx, CMP_UNORD);
-        BLENDVPD(xmm, Rx);
+        blend(Rx);
       }
       FixupBranch done = J(true);
       SwitchToNearCode();
@@ -462,16 +525,15 @@ void Jit64::fmaddXX(UGeckoInstruction inst)
       {
         // We implement nmsub a little differently ((b - a*c) instead of -(a*c - b)),
         // so handle it separately.
-        MOVAPD(XMM1, Rb);
         if (packed)
         {
           MULPD(XMM0, Ra);
-          SUBPD(XMM1, R(XMM0));
+          avx_op(&XEmitter::VSUBPD, &XEmitter::SUBPD, XMM1, Rb, R(XMM0));
         }
         else
         {
           MULSD(XMM0, Ra);
-          SUBSD(XMM1, R(XMM0));
+          avx_op(&XEmitter::VSUBSD, &XEmitter::SUBSD, XMM1, Rb, R(XMM0));
         }
         result_reg = XMM1;
       }
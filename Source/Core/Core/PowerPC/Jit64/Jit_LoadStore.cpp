@@ -529,3 +529,17 @@ void Jit64::eieio(UGeckoInstruction inst)
   if (jo.optimizeGatherPipe && js.fifoBytesSinceCheck > 0)
     js.mustCheckFifo = true;
 }
+
+void Jit64::isync(UGeckoInstruction inst)
+{
+  INSTRUCTION_START
+
+  // Code modified before the isync has to be recompiled before it runs.
+  if (!blocks.IsDeferringInvalidations())
+    return;
+
+  BitSet32 registersInUse = CallerSavedRegistersInUse();
+  ABI_PushRegistersAndAdjustStack(registersInUse, 0);
+  ABI_CallFunction(JitInterface::FlushPendingInvalidations);
+  ABI_PopRegistersAndAdjustStack(registersInUse, 0);
+}
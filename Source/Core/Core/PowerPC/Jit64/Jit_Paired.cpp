@@ -5,6 +5,7 @@
 #include "Common/CommonTypes.h"
 #include "Common/MsgHandler.h"
 #include "Common/x64Emitter.h"
+#include "Core/ConfigManager.h"
 #include "Core/PowerPC/Jit64/Jit.h"
 #include "Core/PowerPC/Jit64/RegCache/JitRegCache.h"
 #include "Core/PowerPC/Jit64Common/Jit64Constants.h"
@@ -48,6 +49,18 @@ void Jit64::ps_sum(UGeckoInstruction inst)
   X64Reg tmp = XMM1;
   MOVDDUP(tmp, Ra);  // {a.ps0, a.ps0}
   ADDPD(tmp, Rb);    // {a.ps0 + b.ps0, a.ps0 + b.ps1}
+
+  // Without the NaN fixups, the three-operand forms can write the result straight to Rd.
+  if (cpu_info.bAVX && !SConfig::GetInstance().bAccurateNaNs)
+  {
+    if (inst.SUBOP5 == 10)
+      VUNPCKHPD(Rd, tmp, Rc);
+    else
+      VBLENDPD(Rd, tmp, Rc, 1);
+    FinalizeSingleResult(Rd, Rd);
+    return;
+  }
+
   switch (inst.SUBOP5)
   {
   case 10:  // ps_sum0: {a.ps0 + b.ps1, c.ps1}
@@ -108,8 +121,15 @@ void Jit64::ps_muls(UGeckoInstruction inst)
   }
   if (round_input)
     Force25BitPrecision(XMM1, R(XMM1), XMM0);
-  MULPD(XMM1, Ra);
-  HandleNaNs(inst, Rd, XMM1);
+  if (cpu_info.bAVX && !SConfig::GetInstance().bAccurateNaNs)
+  {
+    VMULPD(Rd, XMM1, Ra);
+  }
+  else
+  {
+    MULPD(XMM1, Ra);
+    HandleNaNs(inst, Rd, XMM1);
+  }
   FinalizeSingleResult(Rd, Rd);
 }
 
@@ -299,6 +299,7 @@ void RegCache::Start()
   {
     m_regs[i] = PPCCachedReg{GetDefaultLocation(i)};
   }
+  m_pinned = BitSet32{};
 }
 
 void RegCache::SetEmitter(XEmitter* emitter)
@@ -483,6 +484,39 @@ void RegCache::PreloadRegisters(BitSet32 to_preload)
   }
 }
 
+void RegCache::Pin(BitSet32 pregs)
+{
+  for (preg_t preg : pregs)
+  {
+    if (NumFreeRegisters() < 2)
+      return;
+    if (R(preg).IsImm())
+      continue;
+
+    BindToRegister(preg, true, false);
+    m_pinned[preg] = true;
+    m_pinned_xregs[preg] = RX(preg);
+  }
+}
+
+bool RegCache::ArePinnedRegistersInPlace() const
+{
+  for (preg_t preg : m_pinned)
+  {
+    if (!m_regs[preg].IsBound() || RX(preg) != m_pinned_xregs[preg])
+      return false;
+  }
+  return true;
+}
+
+BitSet32 RegCache::PinnedRegistersInUse() const
+{
+  BitSet32 result;
+  for (preg_t preg : m_pinned)
+    result[m_pinned_xregs[preg]] = true;
+  return result;
+}
+
 BitSet32 RegCache::RegistersInUse() const
 {
   BitSet32 result;
@@ -646,6 +680,11 @@ float RegCache::ScoreRegister(X64Reg xreg) const
   preg_t preg = m_xregs[xreg].Contents();
   float score = 0;
 
+  // Evicting a pinned register means a loop can't jump back to the start of the block any more,
+  // so only do that if there is no other choice.
+  if (m_pinned[preg] && m_pinned_xregs[preg] == xreg)
+    score += 1000;
+
   // If it's not dirty, we don't need a store to write it back to the register file, so
   // bias a bit against dirty registers. Testing shows that a bias of 2 seems roughly
   // right: 3 causes too many extra clobbers, while 1 saves very few clobbers relative
@@ -179,6 +179,15 @@ public:
   void PreloadRegisters(BitSet32 pregs);
   BitSet32 RegistersInUse() const;
 
+  // Binds the given registers and tries to keep each of them in the same host register for the
+  // rest of the block, so that a loop can jump back to the start without reloading them.
+  void Pin(BitSet32 pregs);
+  // Whether all pinned registers are still bound to the host registers they were pinned to.
+  bool ArePinnedRegistersInPlace() const;
+  BitSet32 PinnedRegisters() const { return m_pinned; }
+  // The host registers holding pinned registers.
+  BitSet32 PinnedRegistersInUse() const;
+
 protected:
   friend class RCOpArg;
   friend class RCX64Reg;
@@ -219,5 +228,7 @@ protected:
   std::array<PPCCachedReg, 32> m_regs;
   std::array<X64CachedReg, NUM_XREGS> m_xregs;
   std::array<RCConstraint, 32> m_constraints;
+  BitSet32 m_pinned;
+  std::array<Gen::X64Reg, 32> m_pinned_xregs{};
   Gen::XEmitter* m_emitter = nullptr;
 };
@@ -290,6 +290,68 @@ private:
   bool m_sign_extend;
 };
 
+// Visitor that generates code to write a MMIO value.
+template <typename T>
+class MMIOWriteCodeGenerator : public MMIO::WriteHandlingMethodVisitor<T>
+{
+public:
+  MMIOWriteCodeGenerator(Gen::X64CodeBlock* code, BitSet32 registers_in_use,
+                         const Gen::OpArg& src, u32 address)
+      : m_code(code), m_registers_in_use(registers_in_use), m_src(src), m_address(address)
+  {
+  }
+
+  void VisitNop() override {}
+  void VisitDirect(T* addr, u32 mask) override { WriteRegToAddrMask(8 * sizeof(T), addr, mask); }
+  void VisitComplex(const std::function<void(u32, T)>* lambda) override
+  {
+    CallLambda(8 * sizeof(T), lambda);
+  }
+
+private:
+  // Moves the value to write into a register, zero extended to 32 bits.
+  void MoveSrcToReg(int sbits, Gen::X64Reg dst_reg)
+  {
+    if (m_src.IsImm())
+    {
+      const u32 value = sbits == 8 ? m_src.Imm8() : sbits == 16 ? m_src.Imm16() : m_src.Imm32();
+      m_code->MOV(32, R(dst_reg), Gen::Imm32(value));
+    }
+    else if (sbits != 32)
+    {
+      m_code->MOVZX(32, sbits, dst_reg, m_src);
+    }
+    else if (!m_src.IsSimpleReg(dst_reg))
+    {
+      m_code->MOV(32, R(dst_reg), m_src);
+    }
+  }
+
+  void WriteRegToAddrMask(int sbits, void* ptr, u32 mask)
+  {
+    MoveSrcToReg(sbits, RSCRATCH);
+    u32 all_ones = (1ULL << sbits) - 1;
+    if ((all_ones & mask) != all_ones)
+      m_code->AND(32, R(RSCRATCH), Imm32(mask));
+    m_code->MOV(64, R(RSCRATCH2), ImmPtr(ptr));
+    m_code->MOV(sbits, MatR(RSCRATCH2), R(RSCRATCH));
+  }
+
+  void CallLambda(int sbits, const std::function<void(u32, T)>* lambda)
+  {
+    m_code->ABI_PushRegistersAndAdjustStack(m_registers_in_use, 0);
+    // The value has to be moved first, since it may be in one of the other parameter registers.
+    MoveSrcToReg(sbits, ABI_PARAM3);
+    m_code->ABI_CallFunctionPC(&XEmitter::CallLambdaTrampoline<void, u32, T>, lambda, m_address);
+    m_code->ABI_PopRegistersAndAdjustStack(m_registers_in_use, 0);
+  }
+
+  Gen::X64CodeBlock* m_code;
+  BitSet32 m_registers_in_use;
+  Gen::OpArg m_src;
+  u32 m_address;
+};
+
 void EmuCodeBlock::MMIOLoadToReg(MMIO::Mapping* mmio, Gen::X64Reg reg_value,
                                  BitSet32 registers_in_use, u32 address, int access_size,
                                  bool sign_extend)
@@ -317,6 +379,32 @@ void EmuCodeBlock::MMIOLoadToReg(MMIO::Mapping* mmio, Gen::X64Reg reg_value,
   }
 }
 
+void EmuCodeBlock::MMIOWriteRegToAddr(MMIO::Mapping* mmio, const Gen::OpArg& value,
+                                      BitSet32 registers_in_use, u32 address, int access_size)
+{
+  switch (access_size)
+  {
+  case 8:
+  {
+    MMIOWriteCodeGenerator<u8> gen(this, registers_in_use, value, address);
+    mmio->GetHandlerForWrite<u8>(address).Visit(gen);
+    break;
+  }
+  case 16:
+  {
+    MMIOWriteCodeGenerator<u16> gen(this, registers_in_use, value, address);
+    mmio->GetHandlerForWrite<u16>(address).Visit(gen);
+    break;
+  }
+  case 32:
+  {
+    MMIOWriteCodeGenerator<u32> gen(this, registers_in_use, value, address);
+    mmio->GetHandlerForWrite<u32>(address).Visit(gen);
+    break;
+  }
+  }
+}
+
 void EmuCodeBlock::SafeLoadToReg(X64Reg reg_value, const Gen::OpArg& opAddress, int accessSize,
                                  s32 offset, BitSet32 registersInUse, bool signExtend, int flags)
 {
@@ -648,6 +736,13 @@ bool EmuCodeBlock::WriteToConstAddress(int accessSize, OpArg arg, u32 address,
     WriteToConstRamAddress(accessSize, arg, address);
     return false;
   }
+  else if (const u32 mmio_address = PowerPC::IsOptimizableMMIOAccess(address, accessSize);
+           accessSize != 64 && mmio_address)
+  {
+    // If the address maps to an MMIO register, inline MMIO write code.
+    MMIOWriteRegToAddr(Memory::mmio_mapping.get(), arg, registersInUse, mmio_address, accessSize);
+    return false;
+  }
   else
   {
     // Helps external systems know which instruction triggered the write
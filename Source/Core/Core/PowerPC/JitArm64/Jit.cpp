@@ -4,14 +4,17 @@
 #include "Core/PowerPC/JitArm64/Jit.h"
 
 #include <cstdio>
+#include <vector>
 
 #include "Common/Arm64Emitter.h"
 #include "Common/CommonTypes.h"
+#include "Common/Config/Config.h"
 #include "Common/Logging/Log.h"
 #include "Common/MathUtil.h"
 #include "Common/PerformanceCounter.h"
 #include "Common/StringUtil.h"
 
+#include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
@@ -26,7 +29,6 @@
 
 using namespace Arm64Gen;
 
-constexpr size_t CODE_SIZE = 1024 * 1024 * 32;
 constexpr size_t FARCODE_SIZE = 1024 * 1024 * 16;
 constexpr size_t FARCODE_SIZE_MMU = 1024 * 1024 * 48;
 
@@ -44,7 +46,9 @@ JitArm64::~JitArm64() = default;
 void JitArm64::Init()
 {
   const size_t child_code_size = SConfig::GetInstance().bMMU ? FARCODE_SIZE_MMU : FARCODE_SIZE;
-  AllocCodeSpace(CODE_SIZE + child_code_size);
+  AllocCodeSpace(GetCodeCacheSize() + child_code_size);
+  if (Config::Get(Config::MAIN_HUGE_PAGES))
+    AdviseHugePages();
   AddChildCodeSpace(&farcode, child_code_size);
 
   jo.fastmem_arena = SConfig::GetInstance().bFastmem && Memory::InitFastmemArena();
@@ -136,6 +140,14 @@ void JitArm64::ClearCache()
 
 void JitArm64::Shutdown()
 {
+  INFO_LOG_FMT(DYNA_REC, "JIT code space: {} of {} KiB resident", GetResidentBytes() / 1024,
+               total_region_size / 1024);
+  if (Config::Get(Config::MAIN_HUGE_PAGES))
+  {
+    INFO_LOG_FMT(DYNA_REC, "JIT code space: {} KiB backed by huge pages",
+                 GetHugePageBytes() / 1024);
+  }
+
   Memory::ShutdownFastmemArena();
   FreeCodeSpace();
   blocks.Shutdown();
@@ -144,6 +156,8 @@ void JitArm64::Shutdown()
 
 void JitArm64::FallBackToInterpreter(UGeckoInstruction inst)
 {
+  js.curBlock->interpreter_fallbacks++;
+
   FlushCarry();
   gpr.Flush(FlushMode::All, js.op);
   fpr.Flush(FlushMode::All, js.op);
@@ -580,6 +594,9 @@ void JitArm64::Jit(u32)
 #endif
   }
 
+  if (InterpretColdBlock(PowerPC::ppcState.pc))
+    return;
+
   if (IsAlmostFull() || farcode.IsAlmostFull() || SConfig::GetInstance().bJITNoBlockCache)
   {
     ClearCache();
@@ -598,7 +615,7 @@ void JitArm64::Jit(u32)
   // Analyze the block, collect all instructions it is made of (including inlining,
   // if that is enabled), reorder instructions for optimal performance, and join joinable
   // instructions.
-  const u32 nextPC = analyzer.Analyze(em_address, &code_block, &m_code_buffer, block_size);
+  const u32 nextPC = AnalyzeBlock(em_address, block_size);
 
   if (code_block.m_memory_exception)
   {
@@ -619,7 +636,7 @@ void JitArm64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
 {
   js.isLastInstruction = false;
   js.firstFPInstructionFound = false;
-  js.assumeNoPairedQuantize = false;
+  js.constantGqr.clear();
   js.blockStart = em_address;
   js.fifoBytesSinceCheck = 0;
   js.mustCheckFifo = false;
@@ -651,27 +668,45 @@ void JitArm64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
     BeginTimeProfile(b);
   }
 
-  if (code_block.m_gqr_used.Count() == 1 &&
+  // Assume that GQRs which are used but not set by the block keep their current values, so that
+  // psq_l and psq_st can be specialized for them. The block is recompiled without this assumption
+  // if a check at its start fails.
+  const BitSet8 gqr_static = code_block.m_gqr_used & ~code_block.m_gqr_modified;
+  if (gqr_static &&
       js.pairedQuantizeAddresses.find(js.blockStart) == js.pairedQuantizeAddresses.end())
   {
-    int gqr = *code_block.m_gqr_used.begin();
-    if (!code_block.m_gqr_modified[gqr] && !GQR(gqr))
+    std::vector<FixupBranch> fails;
+    for (int gqr : gqr_static)
     {
+      const u32 value = GQR(gqr);
+      js.constantGqr[gqr] = value;
+
       LDR(IndexType::Unsigned, ARM64Reg::W0, PPC_REG, PPCSTATE_OFF_SPR(SPR_GQR0 + gqr));
-      FixupBranch no_fail = CBZ(ARM64Reg::W0);
-      FixupBranch fail = B();
-      SwitchToFarCode();
-      SetJumpTarget(fail);
-      MOVI2R(DISPATCHER_PC, js.blockStart);
-      STR(IndexType::Unsigned, DISPATCHER_PC, PPC_REG, PPCSTATE_OFF(pc));
-      MOVI2R(ARM64Reg::W0, static_cast<u32>(JitInterface::ExceptionType::PairedQuantize));
-      MOVP2R(ARM64Reg::X1, &JitInterface::CompileExceptionCheck);
-      BLR(ARM64Reg::X1);
-      B(dispatcher_no_check);
-      SwitchToNearCode();
+      FixupBranch no_fail;
+      if (value == 0)
+      {
+        no_fail = CBZ(ARM64Reg::W0);
+      }
+      else
+      {
+        MOVI2R(ARM64Reg::W1, value);
+        CMP(ARM64Reg::W0, ARM64Reg::W1);
+        no_fail = B(CC_EQ);
+      }
+      fails.push_back(B());
       SetJumpTarget(no_fail);
-      js.assumeNoPairedQuantize = true;
     }
+
+    SwitchToFarCode();
+    for (const FixupBranch& fail : fails)
+      SetJumpTarget(fail);
+    MOVI2R(DISPATCHER_PC, js.blockStart);
+    STR(IndexType::Unsigned, DISPATCHER_PC, PPC_REG, PPCSTATE_OFF(pc));
+    MOVI2R(ARM64Reg::W0, static_cast<u32>(JitInterface::ExceptionType::PairedQuantize));
+    MOVP2R(ARM64Reg::X1, &JitInterface::CompileExceptionCheck);
+    BLR(ARM64Reg::X1);
+    B(dispatcher_no_check);
+    SwitchToNearCode();
   }
 
   gpr.Start(js.gpa);
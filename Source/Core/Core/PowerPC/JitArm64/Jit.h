@@ -29,6 +29,14 @@ public:
   JitBaseBlockCache* GetBlockCache() override { return &blocks; }
   bool IsInCodeSpace(const u8* ptr) const { return IsInSpace(ptr); }
   bool HandleFault(uintptr_t access_address, SContext* ctx) override;
+  bool IsInBlockCode(const u8* ptr) const override
+  {
+    return (IsInSpace(ptr) && !IsInRoutines(ptr)) || farcode.IsInSpace(ptr);
+  }
+  bool IsInRoutines(const u8* ptr) const override
+  {
+    return ptr >= enter_code && ptr < m_routines_end;
+  }
   void DoBacktrace(uintptr_t access_address, SContext* ctx);
   bool HandleStackFault() override;
   bool HandleFastmemFault(uintptr_t access_address, SContext* ctx);
@@ -129,6 +137,7 @@ public:
   void dcbt(UGeckoInstruction inst);
   void dcbz(UGeckoInstruction inst);
   void eieio(UGeckoInstruction inst);
+  void isync(UGeckoInstruction inst);
 
   // LoadStore floating point
   void lfXX(UGeckoInstruction inst);
@@ -294,6 +303,8 @@ protected:
   Arm64Gen::ARM64CodeBlock farcode;
   u8* nearcode;  // Backed up when we switch to far code.
   bool m_in_farcode = false;
+  // The routines generated by GenerateAsm start at enter_code and end here.
+  const u8* m_routines_end = nullptr;
 
   bool m_enable_blr_optimization;
   bool m_cleanup_after_stackfault = false;
@@ -83,6 +83,11 @@ void JitArm64::EmitBackpatchRoutine(u32 flags, bool fastmem, bool do_farcode, AR
         m_float_emit.LDR(32, EncodeRegToDouble(RS), MEM_REG, addr);
         m_float_emit.REV32(8, EncodeRegToDouble(RS), EncodeRegToDouble(RS));
       }
+      else if (flags & BackPatchInfo::FLAG_SIZE_F32X2)
+      {
+        m_float_emit.LDR(64, EncodeRegToDouble(RS), MEM_REG, addr);
+        m_float_emit.REV32(8, EncodeRegToDouble(RS), EncodeRegToDouble(RS));
+      }
       else
       {
         m_float_emit.LDR(64, EncodeRegToDouble(RS), MEM_REG, addr);
@@ -187,6 +192,13 @@ void JitArm64::EmitBackpatchRoutine(u32 flags, bool fastmem, bool do_farcode, AR
         BLR(ARM64Reg::X8);
         m_float_emit.INS(32, RS, 0, ARM64Reg::X0);
       }
+      else if (flags & BackPatchInfo::FLAG_SIZE_F32X2)
+      {
+        MOVP2R(ARM64Reg::X8, &PowerPC::Read_U64);
+        BLR(ARM64Reg::X8);
+        ROR(ARM64Reg::X0, ARM64Reg::X0, 32);
+        m_float_emit.INS(64, RS, 0, ARM64Reg::X0);
+      }
       else
       {
         MOVP2R(ARM64Reg::X8, &PowerPC::Read_F64);
@@ -253,6 +265,9 @@ bool JitArm64::HandleFastmemFault(uintptr_t access_address, SContext* ctx)
     return false;
   }
 
+  if (Memory::HandlePageTableFault(access_address))
+    return true;
+
   auto slow_handler_iter = m_fault_to_handler.upper_bound((const u8*)ctx->CTX_PC);
   slow_handler_iter--;
 
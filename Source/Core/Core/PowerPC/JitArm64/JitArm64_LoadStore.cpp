@@ -665,3 +665,24 @@ void JitArm64::eieio(UGeckoInstruction inst)
   if (jo.optimizeGatherPipe && js.fifoBytesSinceCheck > 0)
     js.mustCheckFifo = true;
 }
+
+void JitArm64::isync(UGeckoInstruction inst)
+{
+  INSTRUCTION_START
+
+  // Code modified before the isync has to be recompiled before it runs.
+  if (!blocks.IsDeferringInvalidations())
+    return;
+
+  BitSet32 gprs_to_push = gpr.GetCallerSavedUsed();
+  BitSet32 fprs_to_push = fpr.GetCallerSavedUsed();
+
+  ABI_PushRegisters(gprs_to_push);
+  m_float_emit.ABI_PushRegisters(fprs_to_push, ARM64Reg::X30);
+
+  MOVP2R(ARM64Reg::X0, &JitInterface::FlushPendingInvalidations);
+  BLR(ARM64Reg::X0);
+
+  m_float_emit.ABI_PopRegisters(fprs_to_push, ARM64Reg::X30);
+  ABI_PopRegisters(gprs_to_push);
+}
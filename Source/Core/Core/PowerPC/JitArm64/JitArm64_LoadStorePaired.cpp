@@ -33,6 +33,12 @@ void JitArm64::psq_l(UGeckoInstruction inst)
   const bool update = inst.OPCD == 57;
   const s32 offset = inst.SIMM_12;
 
+  const auto gqr_it = js.constantGqr.find(inst.I);
+  const bool gqr_is_constant = gqr_it != js.constantGqr.end();
+  const u32 gqr_value = gqr_is_constant ? gqr_it->second : 0;
+  const u32 type = (gqr_value >> 16) & 0x7;
+  const u32 scale = (gqr_value >> 24) & 0x3F;
+
   gpr.Lock(ARM64Reg::W0, ARM64Reg::W1, ARM64Reg::W2, ARM64Reg::W30);
   fpr.Lock(ARM64Reg::Q0, ARM64Reg::Q1);
 
@@ -60,29 +66,42 @@ void JitArm64::psq_l(UGeckoInstruction inst)
     MOV(arm_addr, addr_reg);
   }
 
-  if (js.assumeNoPairedQuantize)
+  if (gqr_is_constant && type == 0)
   {
+    // Unquantized floats are loaded inline, with a slowmem fallback for faulting accesses.
     VS = fpr.RW(inst.RS, RegType::Single);
-    if (!inst.W)
+
+    BitSet32 gprs_in_use = gpr.GetCallerSavedUsed();
+    BitSet32 fprs_in_use = fpr.GetCallerSavedUsed();
+    gprs_in_use &= BitSet32(~7);
+    fprs_in_use &= BitSet32(~3);
+    fprs_in_use[DecodeReg(VS)] = 0;
+
+    const u32 flags = BackPatchInfo::FLAG_LOAD |
+                      (inst.W ? BackPatchInfo::FLAG_SIZE_F32 : BackPatchInfo::FLAG_SIZE_F32X2);
+    EmitBackpatchRoutine(flags, jo.fastmem, jo.fastmem, VS, EncodeRegTo64(addr_reg), gprs_in_use,
+                         fprs_in_use);
+  }
+  else
+  {
+    const u8** routines = inst.W ? single_load_quantized : paired_load_quantized;
+    if (gqr_is_constant)
     {
-      ADD(EncodeRegTo64(addr_reg), EncodeRegTo64(addr_reg), MEM_REG);
-      m_float_emit.LD1(32, 1, EncodeRegToDouble(VS), EncodeRegTo64(addr_reg));
+      // The routine for the type can be called directly, with only the scale to set up.
+      MOVI2R(scale_reg, scale);
+      MOVP2R(ARM64Reg::X30, routines[type]);
+      BLR(ARM64Reg::X30);
     }
     else
     {
-      m_float_emit.LDR(32, VS, EncodeRegTo64(addr_reg), MEM_REG);
-    }
-    m_float_emit.REV32(8, EncodeRegToDouble(VS), EncodeRegToDouble(VS));
-  }
-  else
-  {
-    LDR(IndexType::Unsigned, scale_reg, PPC_REG, PPCSTATE_OFF_SPR(SPR_GQR0 + inst.I));
-    UBFM(type_reg, scale_reg, 16, 18);   // Type
-    UBFM(scale_reg, scale_reg, 24, 29);  // Scale
+      LDR(IndexType::Unsigned, scale_reg, PPC_REG, PPCSTATE_OFF_SPR(SPR_GQR0 + inst.I));
+      UBFM(type_reg, scale_reg, 16, 18);   // Type
+      UBFM(scale_reg, scale_reg, 24, 29);  // Scale
 
-    MOVP2R(ARM64Reg::X30, inst.W ? single_load_quantized : paired_load_quantized);
-    LDR(EncodeRegTo64(type_reg), ARM64Reg::X30, ArithOption(EncodeRegTo64(type_reg), true));
-    BLR(EncodeRegTo64(type_reg));
+      MOVP2R(ARM64Reg::X30, routines);
+      LDR(EncodeRegTo64(type_reg), ARM64Reg::X30, ArithOption(EncodeRegTo64(type_reg), true));
+      BLR(EncodeRegTo64(type_reg));
+    }
 
     VS = fpr.RW(inst.RS, RegType::Single);
     m_float_emit.ORR(EncodeRegToDouble(VS), ARM64Reg::D0, ARM64Reg::D0);
@@ -115,13 +134,20 @@ void JitArm64::psq_st(UGeckoInstruction inst)
   const bool update = inst.OPCD == 61;
   const s32 offset = inst.SIMM_12;
 
+  const auto gqr_it = js.constantGqr.find(inst.I);
+  const bool gqr_is_constant = gqr_it != js.constantGqr.end();
+  const u32 gqr_value = gqr_is_constant ? gqr_it->second : 0;
+  const u32 type = gqr_value & 0x7;
+  const u32 scale = (gqr_value >> 8) & 0x3F;
+  const bool store_float = gqr_is_constant && type == 0;
+
   fpr.Lock(ARM64Reg::Q0, ARM64Reg::Q1);
 
   const bool have_single = fpr.IsSingle(inst.RS);
 
   ARM64Reg VS = fpr.R(inst.RS, have_single ? RegType::Single : RegType::Register);
 
-  if (js.assumeNoPairedQuantize)
+  if (store_float)
   {
     if (!have_single)
     {
@@ -183,7 +209,7 @@ void JitArm64::psq_st(UGeckoInstruction inst)
     MOV(arm_addr, addr_reg);
   }
 
-  if (js.assumeNoPairedQuantize)
+  if (store_float)
   {
     u32 flags = BackPatchInfo::FLAG_STORE;
 
@@ -194,9 +220,31 @@ void JitArm64::psq_st(UGeckoInstruction inst)
   }
   else
   {
-    LDR(IndexType::Unsigned, scale_reg, PPC_REG, PPCSTATE_OFF_SPR(SPR_GQR0 + inst.I));
-    UBFM(type_reg, scale_reg, 0, 2);    // Type
-    UBFM(scale_reg, scale_reg, 8, 13);  // Scale
+    // With a constant GQR, the routines for its type are called directly.
+    const auto call_routine = [&](const u8** routines) {
+      if (gqr_is_constant)
+      {
+        MOVP2R(ARM64Reg::X30, routines[type]);
+        BLR(ARM64Reg::X30);
+      }
+      else
+      {
+        MOVP2R(ARM64Reg::X30, routines);
+        LDR(EncodeRegTo64(type_reg), ARM64Reg::X30, ArithOption(EncodeRegTo64(type_reg), true));
+        BLR(EncodeRegTo64(type_reg));
+      }
+    };
+
+    if (gqr_is_constant)
+    {
+      MOVI2R(scale_reg, scale);
+    }
+    else
+    {
+      LDR(IndexType::Unsigned, scale_reg, PPC_REG, PPCSTATE_OFF_SPR(SPR_GQR0 + inst.I));
+      UBFM(type_reg, scale_reg, 0, 2);    // Type
+      UBFM(scale_reg, scale_reg, 8, 13);  // Scale
+    }
 
     // Inline address check
     // FIXME: This doesn't correctly account for the BAT configuration.
@@ -207,12 +255,9 @@ void JitArm64::psq_st(UGeckoInstruction inst)
     SwitchToFarCode();
     SetJumpTarget(fail);
     // Slow
-    MOVP2R(ARM64Reg::X30, &paired_store_quantized[16 + inst.W * 8]);
-    LDR(EncodeRegTo64(type_reg), ARM64Reg::X30, ArithOption(EncodeRegTo64(type_reg), true));
-
     ABI_PushRegisters(gprs_in_use);
     m_float_emit.ABI_PushRegisters(fprs_in_use, ARM64Reg::X30);
-    BLR(EncodeRegTo64(type_reg));
+    call_routine(&paired_store_quantized[16 + inst.W * 8]);
     m_float_emit.ABI_PopRegisters(fprs_in_use, ARM64Reg::X30);
     ABI_PopRegisters(gprs_in_use);
     FixupBranch continue1 = B();
@@ -220,14 +265,12 @@ void JitArm64::psq_st(UGeckoInstruction inst)
     SetJumpTarget(pass);
 
     // Fast
-    MOVP2R(ARM64Reg::X30, &paired_store_quantized[inst.W * 8]);
-    LDR(EncodeRegTo64(type_reg), ARM64Reg::X30, ArithOption(EncodeRegTo64(type_reg), true));
-    BLR(EncodeRegTo64(type_reg));
+    call_routine(&paired_store_quantized[inst.W * 8]);
 
     SetJumpTarget(continue1);
   }
 
-  if (js.assumeNoPairedQuantize && !have_single)
+  if (store_float && !have_single)
     fpr.Unlock(VS);
 
   gpr.Unlock(ARM64Reg::W0, ARM64Reg::W1, ARM64Reg::W2, ARM64Reg::W30);
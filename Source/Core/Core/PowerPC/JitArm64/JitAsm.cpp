@@ -195,6 +195,7 @@ void JitArm64::GenerateAsm()
   JitRegister::Register(enter_code, GetCodePtr(), "JIT_Dispatcher");
 
   GenerateCommonAsm();
+  m_routines_end = GetCodePtr();
 
   FlushIcache();
 }
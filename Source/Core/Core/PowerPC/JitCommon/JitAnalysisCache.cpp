@@ -0,0 +1,178 @@
+// Copyright 2021 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/PowerPC/JitCommon/JitAnalysisCache.h"
+
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+#include "Common/FileUtil.h"
+#include "Common/Logging/Log.h"
+#include "Core/ConfigManager.h"
+#include "Core/PowerPC/MMU.h"
+#include "Core/PowerPC/PPCTables.h"
+
+static_assert(std::is_trivially_copyable_v<PPCAnalyst::CodeOp>,
+              "CodeOp must be trivially copyable to be stored in the analysis cache");
+
+class JitAnalysisCache::Reader final : public LinearDiskCacheReader<u64, u8>
+{
+public:
+  explicit Reader(JitAnalysisCache& cache) : m_cache(cache) {}
+
+  void Read(const u64& key, const u8* value, u32 value_size) override
+  {
+    Entry entry;
+    if (value_size < sizeof(EntryHeader))
+      return;
+    std::memcpy(&entry.header, value, sizeof(EntryHeader));
+
+    const u32 num_instructions = entry.header.num_instructions;
+    if (num_instructions == 0 ||
+        value_size != sizeof(EntryHeader) + num_instructions * sizeof(PPCAnalyst::CodeOp))
+    {
+      return;
+    }
+
+    entry.ops.resize(num_instructions);
+    std::memcpy(entry.ops.data(), value + sizeof(EntryHeader),
+                num_instructions * sizeof(PPCAnalyst::CodeOp));
+    for (PPCAnalyst::CodeOp& op : entry.ops)
+      op.opinfo = nullptr;
+
+    // Later entries for the same key replace earlier ones.
+    m_cache.Insert(key, std::move(entry));
+  }
+
+private:
+  JitAnalysisCache& m_cache;
+};
+
+JitAnalysisCache::JitAnalysisCache() = default;
+
+JitAnalysisCache::~JitAnalysisCache()
+{
+  Close();
+}
+
+void JitAnalysisCache::Open(const std::string& game_id)
+{
+  Close();
+  m_entries.Clear();
+  m_game_id = game_id;
+  if (game_id.empty())
+    return;
+
+  const std::string filename = File::GetUserPath(D_CACHE_IDX) + game_id + ".jitcache";
+  Reader reader(*this);
+  const u32 count = m_file.OpenAndRead(filename, reader);
+  m_file_open = true;
+  INFO_LOG_FMT(DYNA_REC, "Loaded {} cached block analyses from {}", count, filename);
+}
+
+void JitAnalysisCache::Close()
+{
+  if (!m_file_open)
+    return;
+
+  m_file.Sync();
+  m_file.Close();
+  m_file_open = false;
+}
+
+u64 JitAnalysisCache::MakeKey(u32 address, u32 options, std::size_t block_size)
+{
+  // Branch following can be disabled separately from the analyzer option.
+  const u64 follow = SConfig::GetInstance().bJITFollowBranch ? 1 : 0;
+  return u64(address) | (u64(block_size & 0xffff) << 32) | (u64(options & 0xff) << 48) |
+         (follow << 56);
+}
+
+void JitAnalysisCache::Insert(u64 key, Entry entry)
+{
+  m_entries.InsertOrAssign(key, std::move(entry));
+}
+
+bool JitAnalysisCache::Lookup(u32 address, u32 options, std::size_t block_size,
+                              PPCAnalyst::CodeBlock* block, PPCAnalyst::CodeBuffer* buffer,
+                              u32* next_pc)
+{
+  Entry* entry = m_entries.Find(MakeKey(address, options, block_size));
+  if (!entry)
+    return false;
+
+  const EntryHeader& header = entry->header;
+  PPCAnalyst::CodeOp* const code = buffer->data();
+
+  // Validate the whole block before touching the outputs, as the analysis of a block has to be
+  // redone if any of its instructions changed.
+  block->m_physical_addresses.clear();
+  for (u32 i = 0; i < header.num_instructions; i++)
+  {
+    const PPCAnalyst::CodeOp& op = entry->ops[i];
+    const auto result = PowerPC::TryReadInstruction(op.address);
+    if (!result.valid || result.hex != op.inst.hex)
+    {
+      m_entries.Erase(MakeKey(address, options, block_size));
+      return false;
+    }
+    block->m_physical_addresses.insert(result.physical_address);
+  }
+
+  for (u32 i = 0; i < header.num_instructions; i++)
+  {
+    code[i] = entry->ops[i];
+    code[i].opinfo = PPCTables::GetOpInfo(code[i].inst);
+  }
+
+  block->m_address = address;
+  block->m_num_instructions = header.num_instructions;
+  *block->m_stats = header.stats;
+  *block->m_gpa = header.gpa;
+  *block->m_fpa = header.fpa;
+  block->m_broken = false;
+  block->m_memory_exception = false;
+  block->m_gqr_used = header.gqr_used;
+  block->m_gqr_modified = header.gqr_modified;
+  block->m_gpr_inputs = header.gpr_inputs;
+  block->m_gpr_address_inputs = header.gpr_address_inputs;
+  *next_pc = header.next_pc;
+  return true;
+}
+
+void JitAnalysisCache::Store(u32 address, u32 options, std::size_t block_size,
+                             const PPCAnalyst::CodeBlock& block,
+                             const PPCAnalyst::CodeBuffer& buffer, u32 next_pc)
+{
+  // Broken blocks may have stopped at an instruction which couldn't be read, so they can't be
+  // validated by reading their instructions again.
+  if (block.m_broken || block.m_memory_exception || block.m_num_instructions == 0)
+    return;
+
+  Entry entry;
+  entry.header.next_pc = next_pc;
+  entry.header.num_instructions = block.m_num_instructions;
+  entry.header.stats = *block.m_stats;
+  entry.header.gpa = *block.m_gpa;
+  entry.header.fpa = *block.m_fpa;
+  entry.header.gqr_used = block.m_gqr_used;
+  entry.header.gqr_modified = block.m_gqr_modified;
+  entry.header.gpr_inputs = block.m_gpr_inputs;
+  entry.header.gpr_address_inputs = block.m_gpr_address_inputs;
+  entry.ops.assign(buffer.begin(), buffer.begin() + block.m_num_instructions);
+  for (PPCAnalyst::CodeOp& op : entry.ops)
+    op.opinfo = nullptr;
+
+  const u64 key = MakeKey(address, options, block_size);
+  if (m_file_open)
+  {
+    std::vector<u8> data(sizeof(EntryHeader) + entry.ops.size() * sizeof(PPCAnalyst::CodeOp));
+    std::memcpy(data.data(), &entry.header, sizeof(EntryHeader));
+    std::memcpy(data.data() + sizeof(EntryHeader), entry.ops.data(),
+                entry.ops.size() * sizeof(PPCAnalyst::CodeOp));
+    m_file.Append(key, data.data(), static_cast<u32>(data.size()));
+  }
+
+  Insert(key, std::move(entry));
+}
@@ -0,0 +1,74 @@
+// Copyright 2021 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/FlatHashMap.h"
+#include "Common/LinearDiskCache.h"
+#include "Core/PowerPC/PPCAnalyst.h"
+
+// Keeps the results of PPCAnalyst for every analyzed block, and optionally persists them in a
+// per-game file in the cache directory, so that blocks don't have to be analyzed again after the
+// JIT cache is cleared or the game is booted again.
+//
+// A cached analysis only depends on the analyzed guest code and the analyzer options, so entries
+// are validated by reading the guest instructions again, which is much cheaper than analyzing
+// them. The file is discarded whenever the Dolphin version changes.
+class JitAnalysisCache
+{
+public:
+  JitAnalysisCache();
+  ~JitAnalysisCache();
+
+  JitAnalysisCache(const JitAnalysisCache&) = delete;
+  JitAnalysisCache& operator=(const JitAnalysisCache&) = delete;
+
+  // Opens the file for the given game ID and loads its entries. An empty ID closes the file and
+  // only keeps entries in memory.
+  void Open(const std::string& game_id);
+  void Close();
+  const std::string& GetGameID() const { return m_game_id; }
+
+  // Fills the block and buffer from a cached analysis and returns true if the guest code at the
+  // address still matches it.
+  bool Lookup(u32 address, u32 options, std::size_t block_size, PPCAnalyst::CodeBlock* block,
+              PPCAnalyst::CodeBuffer* buffer, u32* next_pc);
+  void Store(u32 address, u32 options, std::size_t block_size, const PPCAnalyst::CodeBlock& block,
+             const PPCAnalyst::CodeBuffer& buffer, u32 next_pc);
+
+private:
+  struct EntryHeader
+  {
+    u32 next_pc;
+    u32 num_instructions;
+    PPCAnalyst::BlockStats stats;
+    PPCAnalyst::BlockRegStats gpa;
+    PPCAnalyst::BlockRegStats fpa;
+    BitSet8 gqr_used;
+    BitSet8 gqr_modified;
+    BitSet32 gpr_inputs;
+    BitSet32 gpr_address_inputs;
+  };
+
+  struct Entry
+  {
+    EntryHeader header;
+    // opinfo is not valid in these, it is looked up again when an entry is used.
+    std::vector<PPCAnalyst::CodeOp> ops;
+  };
+
+  class Reader;
+
+  static u64 MakeKey(u32 address, u32 options, std::size_t block_size);
+  void Insert(u64 key, Entry entry);
+
+  Common::FlatHashMap<u64, Entry> m_entries;
+  LinearDiskCache<u64, u8> m_file;
+  std::string m_game_id;
+  bool m_file_open = false;
+};
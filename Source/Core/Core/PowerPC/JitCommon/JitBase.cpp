@@ -3,9 +3,14 @@
 
 #include "Core/PowerPC/JitCommon/JitBase.h"
 
+#include <algorithm>
+
 #include "Common/CommonTypes.h"
+#include "Common/Config/Config.h"
+#include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
 #include "Core/HW/CPU.h"
+#include "Core/PowerPC/Interpreter/Interpreter.h"
 #include "Core/PowerPC/PPCAnalyst.h"
 #include "Core/PowerPC/PowerPC.h"
 
@@ -47,3 +52,57 @@ void JitBase::UpdateMemoryOptions()
   jo.fastmem = SConfig::GetInstance().bFastmem && jo.fastmem_arena && (MSR.DR || !any_watchpoints);
   jo.memcheck = SConfig::GetInstance().bMMU || any_watchpoints;
 }
+
+std::size_t JitBase::GetCodeCacheSize()
+{
+  // Branches between near and far code have a limited range on ARM64.
+  constexpr int MIN_SIZE_MIB = 4;
+  constexpr int MAX_SIZE_MIB = 64;
+  const int size_mib =
+      std::clamp(Config::Get(Config::MAIN_JIT_CODE_CACHE_SIZE), MIN_SIZE_MIB, MAX_SIZE_MIB);
+  return static_cast<std::size_t>(size_mib) * 1024 * 1024;
+}
+
+u32 JitBase::AnalyzeBlock(u32 em_address, std::size_t block_size)
+{
+  // Breakpoints and stepping change how blocks are analyzed, so don't mix those blocks in.
+  if (!Config::Get(Config::MAIN_JIT_ANALYSIS_CACHE) || SConfig::GetInstance().bEnableDebugging)
+    return analyzer.Analyze(em_address, &code_block, &m_code_buffer, block_size);
+
+  const std::string& game_id = SConfig::GetInstance().GetGameID();
+  if (m_analysis_cache.GetGameID() != game_id)
+    m_analysis_cache.Open(game_id);
+
+  const u32 options = analyzer.GetOptions();
+  u32 next_pc;
+  if (m_analysis_cache.Lookup(em_address, options, block_size, &code_block, &m_code_buffer,
+                              &next_pc))
+  {
+    return next_pc;
+  }
+
+  next_pc = analyzer.Analyze(em_address, &code_block, &m_code_buffer, block_size);
+  m_analysis_cache.Store(em_address, options, block_size, code_block, m_code_buffer, next_pc);
+  return next_pc;
+}
+
+bool JitBase::InterpretColdBlock(u32 em_address)
+{
+  // Blocks are checked for timing events only when they exit through compiled code, so only keep
+  // interpreting while there is time left in the slice.
+  const int threshold = Config::Get(Config::MAIN_JIT_COLD_BLOCK_THRESHOLD);
+  if (threshold <= 0 || PowerPC::ppcState.downcount <= 0 ||
+      SConfig::GetInstance().bEnableDebugging)
+  {
+    return false;
+  }
+
+  u32& runs = m_cold_block_runs[em_address];
+  if (runs >= static_cast<u32>(threshold))
+    return false;
+  runs++;
+
+  PowerPC::MaterializeFPRF();
+  PowerPC::ppcState.downcount -= Interpreter::getInstance()->RunBlock();
+  return true;
+}
@@ -13,6 +13,7 @@
 #include "Core/ConfigManager.h"
 #include "Core/MachineContext.h"
 #include "Core/PowerPC/CPUCoreBase.h"
+#include "Core/PowerPC/JitCommon/JitAnalysisCache.h"
 #include "Core/PowerPC/JitCommon/JitAsmCommon.h"
 #include "Core/PowerPC/JitCommon/JitCache.h"
 #include "Core/PowerPC/PPCAnalyst.h"
@@ -81,9 +82,10 @@ protected:
     bool fixupExceptionHandler;
     Gen::FixupBranch exceptionHandler;
 
-    bool assumeNoPairedQuantize;
     std::map<u8, u32> constantGqr;
     bool firstFPInstructionFound;
+    // Whether it's known that no FPRF computation is pending, see PowerPC::MaterializeFPRF.
+    bool fprfMaterialized;
     bool isLastInstruction;
     int skipInstructions;
     CarryFlag carryFlag;
@@ -105,16 +107,31 @@ protected:
     std::unordered_set<u32> fifoWriteAddresses;
     std::unordered_set<u32> pairedQuantizeAddresses;
     std::unordered_set<u32> noSpeculativeConstantsAddresses;
+    std::unordered_set<u32> hotTraceAddresses;
   };
 
   PPCAnalyst::CodeBlock code_block;
   PPCAnalyst::CodeBuffer m_code_buffer;
   PPCAnalyst::PPCAnalyzer analyzer;
+  JitAnalysisCache m_analysis_cache;
+  // How often each block has been run in the interpreter, see InterpretColdBlock.
+  Common::FlatHashMap<u32, u32> m_cold_block_runs;
 
   bool CanMergeNextInstructions(int count) const;
 
+  // Analyzes the block at the given address into code_block and m_code_buffer, reusing a cached
+  // analysis if the analysis cache is enabled. Returns the address following the block.
+  u32 AnalyzeBlock(u32 em_address, std::size_t block_size);
+
+  // Runs the block at the given address in the interpreter instead of compiling it, unless it has
+  // already been run there as often as the cold block threshold allows. Returns whether it ran.
+  bool InterpretColdBlock(u32 em_address);
+
   void UpdateMemoryOptions();
 
+  // Size of the code cache for compiled blocks, excluding the far code and other child spaces.
+  static std::size_t GetCodeCacheSize();
+
 public:
   JitBase();
   ~JitBase() override;
@@ -129,6 +146,11 @@ public:
   virtual bool HandleFault(uintptr_t access_address, SContext* ctx) = 0;
   virtual bool HandleStackFault() { return false; }
 
+  // Whether a host address is in the code of compiled blocks, or in the dispatcher and the other
+  // shared routines.
+  virtual bool IsInBlockCode(const u8* ptr) const { return false; }
+  virtual bool IsInRoutines(const u8* ptr) const { return false; }
+
   static constexpr std::size_t code_buffer_size = 32000;
 
   // This should probably be removed from public:
@@ -12,12 +12,15 @@
 #include <array>
 #include <cstring>
 #include <functional>
-#include <map>
+#include <memory>
 #include <set>
 #include <utility>
+#include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Common/Config/Config.h"
 #include "Common/JitRegister.h"
+#include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
 #include "Core/PowerPC/JitCommon/JitBase.h"
@@ -47,6 +50,7 @@ void JitBaseBlockCache::Init()
 {
   JitRegister::Init(SConfig::GetInstance().m_perfDir);
 
+  m_defer_invalidations = Config::Get(Config::MAIN_JIT_DEFERRED_INVALIDATION);
   Clear();
 }
 
@@ -64,13 +68,19 @@ void JitBaseBlockCache::Clear()
 #endif
   m_jit.js.fifoWriteAddresses.clear();
   m_jit.js.pairedQuantizeAddresses.clear();
-  for (auto& e : block_map)
-  {
-    DestroyBlock(e.second);
-  }
-  block_map.clear();
-  links_to.clear();
-  block_range_map.clear();
+  block_map.ForEach([this](u32, JitBlock* block) {
+    for (; block; block = block->next_at_address)
+      DestroyBlock(*block);
+  });
+  block_map.Clear();
+  links_to.Clear();
+  block_range_map.Clear();
+
+  m_free_blocks.clear();
+  for (auto& block : m_block_storage)
+    m_free_blocks.push_back(block.get());
+
+  m_pending_invalidations.clear();
 
   valid_block.ClearAll();
 
@@ -90,20 +100,113 @@ JitBlock** JitBaseBlockCache::GetFastBlockMap()
 
 void JitBaseBlockCache::RunOnBlocks(std::function<void(const JitBlock&)> f)
 {
-  for (const auto& e : block_map)
-    f(e.second);
+  block_map.ForEach([&f](u32, JitBlock* block) {
+    for (; block; block = block->next_at_address)
+      f(*block);
+  });
+}
+
+JitBlock* JitBaseBlockCache::NewBlock()
+{
+  if (m_free_blocks.empty())
+    return m_block_storage.emplace_back(std::make_unique<JitBlock>()).get();
+
+  JitBlock* block = m_free_blocks.back();
+  m_free_blocks.pop_back();
+
+  // Reset the block, but keep the capacity of its vectors around.
+  static_cast<JitBlockData&>(*block) = {};
+  block->linkData.clear();
+  block->physical_addresses.clear();
+  block->range_nodes.clear();
+  block->link_nodes.clear();
+  block->next_at_address = nullptr;
+  block->profile_data = {};
+  return block;
+}
+
+void JitBaseBlockCache::FreeBlock(JitBlock& block)
+{
+  for (JitBlock::ListNode& node : block.range_nodes)
+    RemoveNode(block_range_map, node);
+  block.range_nodes.clear();
+
+  JitBlock** head = block_map.Find(block.physicalAddress);
+  JitBlock** next = head;
+  while (*next != &block)
+    next = &(*next)->next_at_address;
+  *next = block.next_at_address;
+  if (!*head)
+    block_map.Erase(block.physicalAddress);
+
+  m_free_blocks.push_back(&block);
+}
+
+void JitBaseBlockCache::InsertNode(NodeListMap& map, JitBlock::ListNode& node)
+{
+  JitBlock::ListNode*& head = map[node.key];
+  node.prev = nullptr;
+  node.next = head;
+  if (head)
+    head->prev = &node;
+  head = &node;
+}
+
+void JitBaseBlockCache::RemoveNode(NodeListMap& map, JitBlock::ListNode& node)
+{
+  if (node.next)
+    node.next->prev = node.prev;
+
+  if (node.prev)
+    node.prev->next = node.next;
+  else if (node.next)
+    *map.Find(node.key) = node.next;
+  else
+    map.Erase(node.key);
+
+  node.prev = nullptr;
+  node.next = nullptr;
 }
 
 JitBlock* JitBaseBlockCache::AllocateBlock(u32 em_address)
 {
   u32 physicalAddress = PowerPC::JitCache_TranslateAddress(em_address).address;
-  JitBlock& b = block_map.emplace(physicalAddress, JitBlock())->second;
-  b.effectiveAddress = em_address;
-  b.physicalAddress = physicalAddress;
-  b.msrBits = MSR.Hex & JIT_CACHE_MSR_MASK;
-  b.linkData.clear();
-  b.fast_block_map_index = 0;
-  return &b;
+  JitBlock* b = NewBlock();
+  b->effectiveAddress = em_address;
+  b->physicalAddress = physicalAddress;
+  b->msrBits = MSR.Hex & JIT_CACHE_MSR_MASK;
+  b->fast_block_map_index = 0;
+  b->compile_index = m_next_compile_index++;
+
+  JitBlock*& head = block_map[physicalAddress];
+  b->next_at_address = head;
+  head = b;
+  return b;
+}
+
+void JitBaseBlockCache::DiscardBlock(JitBlock& block)
+{
+  FreeBlock(block);
+}
+
+void JitBaseBlockCache::EvictOldBlocks()
+{
+  std::vector<JitBlock*> blocks;
+  block_map.ForEach([&blocks](u32, JitBlock* block) {
+    for (; block; block = block->next_at_address)
+      blocks.push_back(block);
+  });
+
+  const auto middle = blocks.begin() + blocks.size() / 2;
+  std::nth_element(blocks.begin(), middle, blocks.end(), [](const JitBlock* a, const JitBlock* b) {
+    return a->compile_index < b->compile_index;
+  });
+
+  for (auto it = blocks.begin(); it != middle; ++it)
+  {
+    DestroyBlock(**it);
+    FreeBlock(**it);
+  }
 }
 
 void JitBaseBlockCache::FinalizeBlock(JitBlock& block, bool block_link,
@@ -115,19 +218,32 @@ void JitBaseBlockCache::FinalizeBlock(JitBlock& block, bool block_link,
 
   block.physical_addresses = physical_addresses;
 
+  // The nodes are linked into lists by address, so the vectors must not be resized afterwards.
   u32 range_mask = ~(BLOCK_RANGE_MAP_ELEMENTS - 1);
+  block.range_nodes.clear();
   for (u32 addr : physical_addresses)
   {
     valid_block.Set(addr / 32);
-    block_range_map[addr & range_mask].insert(&block);
+    // physical_addresses is sorted, so all addresses of a range are adjacent.
+    if (block.range_nodes.empty() || block.range_nodes.back().key != (addr & range_mask))
+      block.range_nodes.push_back({&block, nullptr, nullptr, addr & range_mask});
   }
+  for (JitBlock::ListNode& node : block.range_nodes)
+    InsertNode(block_range_map, node);
 
   if (block_link)
   {
+    block.link_nodes.clear();
     for (const auto& e : block.linkData)
     {
-      links_to[e.exitAddress].insert(&block);
+      const auto same_exit = [&e](const JitBlock::ListNode& node) {
+        return node.key == e.exitAddress;
+      };
+      if (std::none_of(block.link_nodes.begin(), block.link_nodes.end(), same_exit))
+        block.link_nodes.push_back({&block, nullptr, nullptr, e.exitAddress});
     }
+    for (JitBlock::ListNode& node : block.link_nodes)
+      InsertNode(links_to, node);
 
     LinkBlock(block);
   }
@@ -159,12 +275,14 @@ JitBlock* JitBaseBlockCache::GetBlockFromStartAddress(u32 addr, u32 msr)
     translated_addr = translated.address;
   }
 
-  auto iter = block_map.equal_range(translated_addr);
-  for (; iter.first != iter.second; iter.first++)
+  JitBlock* const* head = block_map.Find(translated_addr);
+  if (!head)
+    return nullptr;
+
+  for (JitBlock* b = *head; b; b = b->next_at_address)
   {
-    JitBlock& b = iter.first->second;
-    if (b.effectiveAddress == addr && b.msrBits == (msr & JIT_CACHE_MSR_MASK))
-      return &b;
+    if (b->effectiveAddress == addr && b->msrBits == (msr & JIT_CACHE_MSR_MASK))
+      return b;
   }
 
   return nullptr;
@@ -172,6 +290,8 @@ JitBlock* JitBaseBlockCache::GetBlockFromStartAddress(u32 addr, u32 msr)
 
 const u8* JitBaseBlockCache::Dispatch()
 {
+  FlushPendingInvalidations();
+
   JitBlock* block = fast_block_map[FastLookupIndexForAddress(PC)];
 
   if (!block || block->effectiveAddress != PC || block->msrBits != (MSR.Hex & JIT_CACHE_MSR_MASK))
@@ -202,8 +322,16 @@ void JitBaseBlockCache::InvalidateICache(u32 address, u32 length, bool forced)
 
   if (destroy_block)
   {
-    // destroy JIT blocks
-    ErasePhysicalRange(pAddr, length);
+    // Games often invalidate large ranges one cache line at a time, which would walk the range
+    // map for every line. When deferring, modified lines are only recorded here, and
+    // FlushPendingInvalidations erases them in one go when Dispatch looks up a block, on isync
+    // or at the end of the CoreTiming slice. Until then, the old blocks can still run through
+    // the JIT's own fast lookup and block links. Forced invalidations are used for breakpoints
+    // and recompilation requests and always take effect immediately.
+    if (m_defer_invalidations && !forced && length == 32)
+      m_pending_invalidations.push_back(pAddr);
+    else
+      ErasePhysicalRange(pAddr, length);
 
     // If the code was actually modified, we need to clear the relevant entries from the
     // FIFO write address cache, so we don't end up with FIFO checks in places they shouldn't
@@ -215,57 +343,87 @@ void JitBaseBlockCache::InvalidateICache(u32 address, u32 length, bool forced)
       {
         m_jit.js.fifoWriteAddresses.erase(i);
         m_jit.js.pairedQuantizeAddresses.erase(i);
+        m_jit.js.hotTraceAddresses.erase(i);
       }
     }
   }
 }
 
+void JitBaseBlockCache::FlushPendingInvalidations()
+{
+  if (m_pending_invalidations.empty())
+    return;
+
+  // A line is only added once until it contains code again, as its valid_block bit is cleared,
+  // so adjacent lines just have to be coalesced into ranges.
+  std::sort(m_pending_invalidations.begin(), m_pending_invalidations.end());
+  u32 start = m_pending_invalidations[0];
+  u32 end = start + 32;
+  for (size_t i = 1; i < m_pending_invalidations.size(); i++)
+  {
+    const u32 address = m_pending_invalidations[i];
+    if (address > end)
+    {
+      ErasePhysicalRange(start, end - start);
+      start = address;
+    }
+    end = std::max(end, address + 32);
+  }
+  ErasePhysicalRange(start, end - start);
+
+  m_pending_invalidations.clear();
+}
+
 void JitBaseBlockCache::ErasePhysicalRange(u32 address, u32 length)
 {
-  // Iterate over all macro blocks which overlap the given range.
+  if (length == 0 || block_range_map.Empty())
+    return;
+
+  // Collect all macro blocks which overlap the given range. For large ranges it is cheaper to
+  // scan the occupied macro blocks than to probe for every possible one.
   u32 range_mask = ~(BLOCK_RANGE_MAP_ELEMENTS - 1);
-  auto start = block_range_map.lower_bound(address & range_mask);
-  auto end = block_range_map.lower_bound(address + length);
-  while (start != end)
+  const u32 first_range = address & range_mask;
+  const u64 end = u64{address} + length;
+  const u64 range_count = (end - first_range + BLOCK_RANGE_MAP_ELEMENTS - 1) /
+                          BLOCK_RANGE_MAP_ELEMENTS;
+
+  m_ranges_to_erase.clear();
+  if (range_count > block_range_map.Size())
+  {
+    block_range_map.ForEach([&](u32 range, JitBlock::ListNode*) {
+      if (range + u64{BLOCK_RANGE_MAP_ELEMENTS} > address && range < end)
+        m_ranges_to_erase.push_back(range);
+    });
+  }
+  else
+  {
+    for (u64 range = first_range; range < end; range += BLOCK_RANGE_MAP_ELEMENTS)
+      m_ranges_to_erase.push_back(static_cast<u32>(range));
+  }
+
+  for (u32 range : m_ranges_to_erase)
+    EraseBlocksInRange(range, address, length);
+}
+
+void JitBaseBlockCache::EraseBlocksInRange(u32 range, u32 address, u32 length)
+{
+  JitBlock::ListNode* const* head = block_range_map.Find(range);
+  if (!head)
+    return;
+
+  // Iterate over all blocks in the macro block. Freeing a block removes all of its range nodes,
+  // but never the node following it in this list, since that belongs to a different block.
+  JitBlock::ListNode* node = *head;
+  while (node)
   {
-    // Iterate over all blocks in the macro block.
-    auto iter = start->second.begin();
-    while (iter != start->second.end())
+    JitBlock::ListNode* next = node->next;
+    JitBlock* block = node->block;
+    if (block->OverlapsPhysicalRange(address, length))
     {
-      JitBlock* block = *iter;
-      if (block->OverlapsPhysicalRange(address, length))
-      {
-        // If the block overlaps, also remove all other occupied slots in the other macro blocks.
-        // This will leak empty macro blocks, but they may be reused or cleared later on.
-        for (u32 addr : block->physical_addresses)
-          if ((addr & range_mask) != start->first)
-            block_range_map[addr & range_mask].erase(block);
-
-        // And remove the block.
-        DestroyBlock(*block);
-        auto block_map_iter = block_map.equal_range(block->physicalAddress);
-        while (block_map_iter.first != block_map_iter.second)
-        {
-          if (&block_map_iter.first->second == block)
-          {
-            block_map.erase(block_map_iter.first);
-            break;
-          }
-          block_map_iter.first++;
-        }
-        iter = start->second.erase(iter);
-      }
-      else
-      {
-        iter++;
-      }
+      DestroyBlock(*block);
+      FreeBlock(*block);
     }
-
-    // If the macro block is empty, drop it.
-    if (start->second.empty())
-      start = block_range_map.erase(start);
-    else
-      start++;
+    node = next;
   }
 }
 
@@ -298,14 +456,14 @@ void JitBaseBlockCache::LinkBlockExits(JitBlock& block)
 void JitBaseBlockCache::LinkBlock(JitBlock& block)
 {
   LinkBlockExits(block);
-  const auto it = links_to.find(block.effectiveAddress);
-  if (it == links_to.end())
+  JitBlock::ListNode* const* head = links_to.Find(block.effectiveAddress);
+  if (!head)
     return;
 
-  for (JitBlock* b2 : it->second)
+  for (const JitBlock::ListNode* node = *head; node; node = node->next)
   {
-    if (block.msrBits == b2->msrBits)
-      LinkBlockExits(*b2);
+    if (block.msrBits == node->block->msrBits)
+      LinkBlockExits(*node->block);
   }
 }
 
@@ -318,11 +476,12 @@ void JitBaseBlockCache::UnlinkBlock(const JitBlock& block)
   }
 
   // Unlink all exits of other blocks which points to this block
-  const auto it = links_to.find(block.effectiveAddress);
-  if (it == links_to.end())
+  JitBlock::ListNode* const* head = links_to.Find(block.effectiveAddress);
+  if (!head)
     return;
-  for (JitBlock* sourceBlock : it->second)
+  for (const JitBlock::ListNode* node = *head; node; node = node->next)
   {
+    JitBlock* sourceBlock = node->block;
     if (sourceBlock->msrBits != block.msrBits)
       continue;
 
@@ -345,15 +504,9 @@ void JitBaseBlockCache::DestroyBlock(JitBlock& block)
   UnlinkBlock(block);
 
   // Delete linking addresses
-  for (const auto& e : block.linkData)
-  {
-    auto it = links_to.find(e.exitAddress);
-    if (it == links_to.end())
-      continue;
-    it->second.erase(&block);
-    if (it->second.empty())
-      links_to.erase(it);
-  }
+  for (JitBlock::ListNode& node : block.link_nodes)
+    RemoveNode(links_to, node);
+  block.link_nodes.clear();
 
   // Raise an signal if we are going to call this block again
   WriteDestroyBlock(block);
@@ -7,15 +7,13 @@
 #include <bitset>
 #include <cstring>
 #include <functional>
-#include <map>
 #include <memory>
 #include <set>
 #include <type_traits>
-#include <unordered_map>
-#include <unordered_set>
 #include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Common/FlatHashMap.h"
 
 class JitBase;
 
@@ -50,6 +48,9 @@ struct JitBlockData
   // The number of PPC instructions represented by this block. Mostly
   // useful for logging.
   u32 originalSize;
+  // The number of PPC instructions in this block which were compiled as calls to the
+  // interpreter. Only used for logging.
+  u32 interpreter_fallbacks;
   // This tracks the position if this block within the fast block cache.
   // We allow each block to have only one map entry.
   size_t fast_block_map_index;
@@ -81,6 +82,24 @@ struct JitBlock : public JitBlockData
   // This set stores all physical addresses of all occupied instructions.
   std::set<u32> physical_addresses;
 
+  // Node of an intrusive doubly-linked list. The block cache keeps one list per key (a range of
+  // physical memory or a link destination), so that insertion and removal never allocate.
+  struct ListNode
+  {
+    JitBlock* block;
+    ListNode* prev;
+    ListNode* next;
+    u32 key;
+  };
+
+  // One node per range of physical memory this block occupies.
+  std::vector<ListNode> range_nodes;
+  // One node per distinct exit address of this block, for the block cache's links_to index.
+  std::vector<ListNode> link_nodes;
+
+  // Next block with the same physical start address.
+  JitBlock* next_at_address = nullptr;
+
   // Block profiling data, structure is inlined in Jit.cpp
   struct ProfileData
   {
@@ -90,6 +109,13 @@ struct JitBlock : public JitBlockData
     u64 ticStart;
     u64 ticStop;
   } profile_data = {};
+
+  // Counts down the runs left until the block is recompiled as a trace, see
+  // JitInterface::ExceptionType::HotTrace.
+  u32 trace_countdown = 0;
+
+  // Increases with every allocated block, so that the oldest blocks can be evicted first.
+  u64 compile_index = 0;
 };
 
 typedef void (*CompiledCode)();
@@ -148,6 +174,12 @@ public:
 
   JitBlock* AllocateBlock(u32 em_address);
   void FinalizeBlock(JitBlock& block, bool block_link, const std::set<u32>& physical_addresses);
+  // Frees a block which was allocated but couldn't be compiled.
+  void DiscardBlock(JitBlock& block);
+
+  // Destroys the older half of all blocks, which makes room for new code while keeping the most
+  // recently compiled blocks, so that running out of code space doesn't require a full clear.
+  void EvictOldBlocks();
 
   // Look for the block in the slow but accurate way.
   // This function shall be used if FastLookupIndexForAddress() failed.
@@ -161,6 +193,8 @@ public:
   const u8* Dispatch();
 
   void InvalidateICache(u32 address, u32 length, bool forced);
+  void FlushPendingInvalidations();
+  bool IsDeferringInvalidations() const { return m_defer_invalidations; }
   void ErasePhysicalRange(u32 address, u32 length);
 
 protected:
@@ -181,19 +215,42 @@ private:
   // Fast but risky block lookup based on fast_block_map.
   size_t FastLookupIndexForAddress(u32 address);
 
+  using NodeListMap = Common::FlatHashMap<u32, JitBlock::ListNode*>;
+  static void InsertNode(NodeListMap& map, JitBlock::ListNode& node);
+  static void RemoveNode(NodeListMap& map, JitBlock::ListNode& node);
+
+  JitBlock* NewBlock();
+  void FreeBlock(JitBlock& block);
+  void EraseBlocksInRange(u32 range, u32 address, u32 length);
+
   // links_to hold all exit points of all valid blocks in a reverse way.
   // It is used to query all blocks which links to an address.
-  std::unordered_map<u32, std::unordered_set<JitBlock*>> links_to;  // destination_PC -> number
+  NodeListMap links_to;  // destination_PC -> list of JitBlock::link_nodes
 
   // Map indexed by the physical address of the entry point.
   // This is used to query the block based on the current PC in a slow way.
-  std::multimap<u32, JitBlock> block_map;  // start_addr -> block
+  // Blocks sharing a physical address are chained through JitBlock::next_at_address.
+  Common::FlatHashMap<u32, JitBlock*> block_map;  // start_addr -> block
 
   // Range of overlapping code indexed by a masked physical address.
   // This is used for invalidation of memory regions. The range is grouped
   // in macro blocks of each 0x100 bytes.
   static constexpr u32 BLOCK_RANGE_MAP_ELEMENTS = 0x100;
-  std::map<u32, std::unordered_set<JitBlock*>> block_range_map;
+  NodeListMap block_range_map;  // range -> list of JitBlock::range_nodes
+
+  // Storage for all blocks. Blocks are recycled through m_free_blocks so that their addresses stay
+  // stable and their vectors keep their capacity.
+  std::vector<std::unique_ptr<JitBlock>> m_block_storage;
+  std::vector<JitBlock*> m_free_blocks;
+  u64 m_next_compile_index = 0;
+
+  // Physical addresses of the cache lines whose blocks still have to be erased, if invalidations
+  // by code modifications are deferred.
+  bool m_defer_invalidations = false;
+  std::vector<u32> m_pending_invalidations;
+
+  // Scratch space for ErasePhysicalRange, kept around to avoid allocating on every invalidation.
+  std::vector<u32> m_ranges_to_erase;
 
   // This bitsets shows which cachelines overlap with any blocks.
   // It is used to provide a fast way to query if no icache invalidation is needed.
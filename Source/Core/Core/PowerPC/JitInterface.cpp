@@ -8,6 +8,7 @@
 #include <cstdio>
 #include <string>
 #include <unordered_set>
+#include <vector>
 
 #ifdef _WIN32
 #include <windows.h>
@@ -42,13 +43,21 @@
 namespace JitInterface
 {
 static JitBase* g_jit = nullptr;
+
+struct InvalidatedRange
+{
+  u32 address;
+  u32 size;
+};
+static bool s_log_invalidations = false;
+static std::vector<InvalidatedRange> s_invalidation_log;
 void SetJit(JitBase* jit)
 {
   g_jit = jit;
 }
 void DoState(PointerWrap& p)
 {
-  if (g_jit && p.GetMode() == PointerWrap::MODE_READ)
+  if (g_jit && p.GetMode() == PointerWrap::MODE_READ && !s_log_invalidations)
     g_jit->ClearCache();
 }
 CPUCoreBase* InitJitCore(PowerPC::CPUCore core)
@@ -147,6 +156,50 @@ void GetProfileResults(Profiler::ProfileStats* prof_stats)
   });
 }
 
+void WriteBlockStats(const std::string& filename)
+{
+  if (!g_jit)
+    return;
+
+  struct BlockStats
+  {
+    u32 address;
+    u32 guest_instructions;
+    u32 code_size;
+    u32 far_code_size;
+    u32 exits;
+    u32 interpreter_fallbacks;
+  };
+  std::vector<BlockStats> stats;
+  Core::RunAsCPUThread([&stats] {
+    g_jit->GetBlockCache()->RunOnBlocks([&stats](const JitBlock& block) {
+      stats.push_back({block.effectiveAddress, block.originalSize, block.codeSize,
+                       static_cast<u32>(block.far_end - block.far_begin),
+                       static_cast<u32>(block.linkData.size()), block.interpreter_fallbacks});
+    });
+  });
+  std::sort(stats.begin(), stats.end(),
+            [](const BlockStats& a, const BlockStats& b) { return a.address < b.address; });
+
+  File::IOFile f(filename, "w");
+  if (!f)
+  {
+    PanicAlertFmt("Failed to open {}", filename);
+    return;
+  }
+  f.WriteString("origAddr\tblkName\tinstCount\tblkCodeSize\tfarCodeSize\tbytesPerInst\texits\t"
+                "fallbacks\n");
+  for (const BlockStats& stat : stats)
+  {
+    f.WriteString(fmt::format("{0:08x}\t{1}\t{2}\t{3}\t{4}\t{5:.2f}\t{6}\t{7}\n", stat.address,
+                              g_symbolDB.GetDescription(stat.address), stat.guest_instructions,
+                              stat.code_size, stat.far_code_size,
+                              static_cast<double>(stat.code_size + stat.far_code_size) /
+                                  std::max(stat.guest_instructions, 1u),
+                              stat.exits, stat.interpreter_fallbacks));
+  }
+}
+
 int GetHostCode(u32* address, const u8** code, u32* code_size)
 {
   if (!g_jit)
@@ -186,6 +239,19 @@ int GetHostCode(u32* address, const u8** code, u32* code_size)
   return 0;
 }
 
+HostCodeRegion GetHostCodeRegion(uintptr_t address)
+{
+  if (!g_jit)
+    return HostCodeRegion::Other;
+
+  const u8* ptr = reinterpret_cast<const u8*>(address);
+  if (g_jit->IsInBlockCode(ptr))
+    return HostCodeRegion::Blocks;
+  if (g_jit->IsInRoutines(ptr))
+    return HostCodeRegion::Routines;
+  return HostCodeRegion::Other;
+}
+
 bool HandleFault(uintptr_t access_address, SContext* ctx)
 {
   // Prevent nullptr dereference on a crash with no JIT present
@@ -220,10 +286,38 @@ void ClearSafe()
 
 void InvalidateICache(u32 address, u32 size, bool forced)
 {
+  if (s_log_invalidations)
+    s_invalidation_log.push_back({address, size});
+
   if (g_jit)
     g_jit->GetBlockCache()->InvalidateICache(address, size, forced);
 }
 
+void FlushPendingInvalidations()
+{
+  if (g_jit)
+    g_jit->GetBlockCache()->FlushPendingInvalidations();
+}
+
+void BeginInvalidationLog()
+{
+  s_invalidation_log.clear();
+  s_log_invalidations = true;
+}
+
+void EndInvalidationLog(bool invalidate_logged_code)
+{
+  s_log_invalidations = false;
+
+  if (g_jit && invalidate_logged_code)
+  {
+    for (const InvalidatedRange& range : s_invalidation_log)
+      g_jit->GetBlockCache()->InvalidateICache(range.address, range.size, true);
+  }
+
+  s_invalidation_log.clear();
+}
+
 void CompileExceptionCheck(ExceptionType type)
 {
   if (!g_jit)
@@ -242,6 +336,9 @@ void CompileExceptionCheck(ExceptionType type)
   case ExceptionType::SpeculativeConstants:
     exception_addresses = &g_jit->js.noSpeculativeConstantsAddresses;
     break;
+  case ExceptionType::HotTrace:
+    exception_addresses = &g_jit->js.hotTraceAddresses;
+    break;
   }
 
   if (PC != 0 && (exception_addresses->find(PC)) == (exception_addresses->end()))
@@ -28,7 +28,10 @@ enum class ExceptionType
 {
   FIFOWrite,
   PairedQuantize,
-  SpeculativeConstants
+  SpeculativeConstants,
+  // Not an exception, but uses the same mechanism to recompile a block that is run often as a
+  // longer trace.
+  HotTrace
 };
 
 void DoState(PointerWrap& p);
@@ -46,8 +49,21 @@ enum class ProfilingState
 void SetProfilingState(ProfilingState state);
 void WriteProfileResults(const std::string& filename);
 void GetProfileResults(Profiler::ProfileStats* prof_stats);
+// Writes the size of the host code, the number of exits and the number of interpreter fallbacks
+// of every block in the cache as tab-separated values, for comparing code generation changes.
+void WriteBlockStats(const std::string& filename);
 int GetHostCode(u32* address, const u8** code, u32* code_size);
 
+enum class HostCodeRegion
+{
+  Blocks,
+  Routines,
+  Other
+};
+// Which part of the JIT's code a host address is in. Used by the sampling profiler, which calls
+// this while the CPU thread is stopped.
+HostCodeRegion GetHostCodeRegion(uintptr_t address);
+
 // Memory Utilities
 bool HandleFault(uintptr_t access_address, SContext* ctx);
 bool HandleStackFault();
@@ -62,6 +78,15 @@ void ClearSafe();
 
 // If "forced" is true, a recompile is being requested on code that hasn't been modified.
 void InvalidateICache(u32 address, u32 size, bool forced);
+// Applies the invalidations which were deferred by InvalidateICache, see
+// JitBaseBlockCache::InvalidateICache.
+void FlushPendingInvalidations();
+
+// Run-ahead loads the same savestate every few frames. Instead of clearing the whole cache on
+// every load, the code invalidated after the state was saved is logged, and only that code is
+// invalidated again once the state has been loaded. Loading a state while logging keeps the cache.
+void BeginInvalidationLog();
+void EndInvalidationLog(bool invalidate_logged_code);
 
 void CompileExceptionCheck(ExceptionType type);
 
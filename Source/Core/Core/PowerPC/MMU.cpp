@@ -3,6 +3,7 @@
 
 #include "Core/PowerPC/MMU.h"
 
+#include <array>
 #include <cassert>
 #include <cstddef>
 #include <cstring>
@@ -18,6 +19,7 @@
 #include "Core/HW/Memmap.h"
 #include "Core/PowerPC/JitInterface.h"
 #include "Core/PowerPC/PowerPC.h"
+#include "Core/PowerPC/SamplingProfiler.h"
 
 #include "VideoCommon/VideoBackendBase.h"
 
@@ -245,6 +247,7 @@ static T ReadFromHardware(u32 em_address)
 
   if (flag == XCheckTLBFlag::Read && (em_address & 0xF8000000) == 0x08000000)
   {
+    Profiler::ScopedMMIOAccess mmio_access;
     if (em_address < 0x0c000000)
       return EFB_Read(em_address);
     else
@@ -359,6 +362,7 @@ static void WriteToHardware(u32 em_address, const T data)
 
   if (flag == XCheckTLBFlag::Write && (em_address & 0xF8000000) == 0x08000000)
   {
+    Profiler::ScopedMMIOAccess mmio_access;
     if (em_address < 0x0c000000)
     {
       EFB_Write((u32)data, em_address);
@@ -1197,6 +1201,9 @@ void SDRUpdated()
 
   PowerPC::ppcState.pagetable_base = htaborg << 16;
   PowerPC::ppcState.pagetable_hashmask = ((htabmask << 10) | 0x3ff);
+
+  Memory::InvalidatePageTableMappings(0, 0);
+  ClearTLBVictimCache();
 }
 
 enum class TLBLookupResult
@@ -1206,6 +1213,47 @@ enum class TLBLookupResult
   UpdateC
 };
 
+// Translations evicted from the emulated TLB, which would otherwise have to be looked up in the
+// page table again. Software has to invalidate a translation with tlbie after changing its page
+// table entry, which invalidates it here as well, so the emulated software can't observe this.
+// This isn't part of savestates.
+constexpr size_t TLB_VICTIM_CACHE_SIZE = 16;
+
+struct TLBVictimEntry
+{
+  u32 tag = TLBEntry::INVALID_TAG;
+  u32 pte = 0;
+};
+
+static std::array<std::array<TLBVictimEntry, TLB_VICTIM_CACHE_SIZE>, NUM_TLBS> s_tlb_victims;
+static std::array<size_t, NUM_TLBS> s_tlb_victim_next;
+
+void ClearTLBVictimCache()
+{
+  s_tlb_victims = {};
+  s_tlb_victim_next = {};
+}
+
+static void UpdateTLBEntry(const XCheckTLBFlag flag, UPTE2 PTE2, const u32 address);
+
+// Moves a translation from the victim cache back into the TLB if it's there.
+static bool RestoreTLBVictim(const XCheckTLBFlag flag, const u32 vpa)
+{
+  const u32 tag = vpa >> HW_PAGE_INDEX_SHIFT;
+  for (TLBVictimEntry& victim : s_tlb_victims[IsOpcodeFlag(flag)])
+  {
+    if (victim.tag == tag)
+    {
+      UPTE2 PTE2;
+      PTE2.Hex = victim.pte;
+      victim.tag = TLBEntry::INVALID_TAG;
+      UpdateTLBEntry(flag, PTE2, vpa);
+      return true;
+    }
+  }
+  return false;
+}
+
 static TLBLookupResult LookupTLBPageAddress(const XCheckTLBFlag flag, const u32 vpa, u32* paddr)
 {
   const u32 tag = vpa >> HW_PAGE_INDEX_SHIFT;
@@ -1255,6 +1303,12 @@ static TLBLookupResult LookupTLBPageAddress(const XCheckTLBFlag flag, const u32
 
     return TLBLookupResult::Found;
   }
+
+  // Lookups which don't update the TLB have to be left to the page table walk, which leaves both
+  // the TLB and the victim cache unchanged.
+  if (!IsNoExceptionFlag(flag) && RestoreTLBVictim(flag, vpa))
+    return LookupTLBPageAddress(flag, vpa, paddr);
+
   return TLBLookupResult::NotFound;
 }
 
@@ -1266,6 +1320,14 @@ static void UpdateTLBEntry(const XCheckTLBFlag flag, UPTE2 PTE2, const u32 addre
   const int tag = address >> HW_PAGE_INDEX_SHIFT;
   TLBEntry& tlbe = ppcState.tlb[IsOpcodeFlag(flag)][tag & HW_PAGE_INDEX_MASK];
   const int index = tlbe.recent == 0 && tlbe.tag[0] != TLBEntry::INVALID_TAG;
+
+  if (tlbe.tag[index] != TLBEntry::INVALID_TAG)
+  {
+    size_t& next = s_tlb_victim_next[IsOpcodeFlag(flag)];
+    s_tlb_victims[IsOpcodeFlag(flag)][next] = {tlbe.tag[index], tlbe.pte[index]};
+    next = (next + 1) % TLB_VICTIM_CACHE_SIZE;
+  }
+
   tlbe.recent = index;
   tlbe.paddr[index] = PTE2.RPN << HW_PAGE_INDEX_SHIFT;
   tlbe.pte[index] = PTE2.Hex;
@@ -1276,6 +1338,8 @@ void InvalidateTLBEntry(u32 address)
 {
   const u32 entry_index = (address >> HW_PAGE_INDEX_SHIFT) & HW_PAGE_INDEX_MASK;
 
+  Memory::InvalidatePageTableMappings(address, HW_PAGE_INDEX_MASK << HW_PAGE_INDEX_SHIFT);
+
   TLBEntry& tlbe = ppcState.tlb[0][entry_index];
   tlbe.tag[0] = TLBEntry::INVALID_TAG;
   tlbe.tag[1] = TLBEntry::INVALID_TAG;
@@ -1283,6 +1347,16 @@ void InvalidateTLBEntry(u32 address)
   TLBEntry& tlbe_i = ppcState.tlb[1][entry_index];
   tlbe_i.tag[0] = TLBEntry::INVALID_TAG;
   tlbe_i.tag[1] = TLBEntry::INVALID_TAG;
+
+  // tlbie invalidates the whole congruence class, so do the same for evicted translations.
+  for (auto& victims : s_tlb_victims)
+  {
+    for (TLBVictimEntry& victim : victims)
+    {
+      if (victim.tag != TLBEntry::INVALID_TAG && (victim.tag & HW_PAGE_INDEX_MASK) == entry_index)
+        victim.tag = TLBEntry::INVALID_TAG;
+    }
+  }
 }
 
 // Page Address Translation
@@ -1466,42 +1540,47 @@ static void UpdateFakeMMUBat(BatTable& bat_table, u32 start_addr)
   }
 }
 
-void DBATUpdated()
+// Rebuilds a BAT table from the BAT registers, and returns whether it has changed. Loading a
+// savestate always rebuilds the tables, which shouldn't throw away the JIT cache needlessly.
+static bool RebuildBATTable(BatTable& bat_table, u32 base_spr, u32 extended_base_spr)
 {
-  dbat_table = {};
-  UpdateBATs(dbat_table, SPR_DBAT0U);
+  static BatTable s_new_table;
+  s_new_table = {};
+  UpdateBATs(s_new_table, base_spr);
   bool extended_bats = SConfig::GetInstance().bWii && HID4.SBE;
   if (extended_bats)
-    UpdateBATs(dbat_table, SPR_DBAT4U);
+    UpdateBATs(s_new_table, extended_base_spr);
   if (Memory::m_pFakeVMEM)
   {
     // In Fake-MMU mode, insert some extra entries into the BAT tables.
-    UpdateFakeMMUBat(dbat_table, 0x40000000);
-    UpdateFakeMMUBat(dbat_table, 0x70000000);
+    UpdateFakeMMUBat(s_new_table, 0x40000000);
+    UpdateFakeMMUBat(s_new_table, 0x70000000);
   }
 
+  if (s_new_table == bat_table)
+    return false;
+
+  bat_table = s_new_table;
+  return true;
+}
+
+void DBATUpdated()
+{
+  const bool changed = RebuildBATTable(dbat_table, SPR_DBAT0U, SPR_DBAT4U);
+
 #ifndef _ARCH_32
   Memory::UpdateLogicalMemory(dbat_table);
 #endif
 
   // IsOptimizable*Address and dcbz depends on the BAT mapping, so we need a flush here.
-  JitInterface::ClearSafe();
+  if (changed)
+    JitInterface::ClearSafe();
 }
 
 void IBATUpdated()
 {
-  ibat_table = {};
-  UpdateBATs(ibat_table, SPR_IBAT0U);
-  bool extended_bats = SConfig::GetInstance().bWii && HID4.SBE;
-  if (extended_bats)
-    UpdateBATs(ibat_table, SPR_IBAT4U);
-  if (Memory::m_pFakeVMEM)
-  {
-    // In Fake-MMU mode, insert some extra entries into the BAT tables.
-    UpdateFakeMMUBat(ibat_table, 0x40000000);
-    UpdateFakeMMUBat(ibat_table, 0x70000000);
-  }
-  JitInterface::ClearSafe();
+  if (RebuildBATTable(ibat_table, SPR_IBAT0U, SPR_IBAT4U))
+    JitInterface::ClearSafe();
 }
 
 // Translate effective address using BAT or PAT.  Returns 0 if the address cannot be translated.
@@ -1527,4 +1606,39 @@ std::optional<u32> GetTranslatedAddress(u32 address)
   return std::optional<u32>(result.address);
 }
 
+std::optional<PageTableMapping> TranslatePageTableMapping(u32 address, bool write)
+{
+  if (!MSR.DR)
+    return std::nullopt;
+
+  u32 bat_address = address;
+  if (TranslateBatAddess(dbat_table, &bat_address))
+    return std::nullopt;
+
+  const u32 page = address & ~static_cast<u32>(HW_PAGE_SIZE - 1);
+  if (PowerPC::memchecks.OverlapsMemcheck(page, HW_PAGE_SIZE))
+    return std::nullopt;
+
+  const TranslateAddressResult result =
+      TranslatePageAddress(page, write ? XCheckTLBFlag::Write : XCheckTLBFlag::Read);
+  if (result.result != TranslateAddressResult::PAGE_TABLE_TRANSLATED)
+    return std::nullopt;
+
+  // The translation has just been put into the TLB, which also has the current state of the C bit.
+  bool writable = write;
+  const u32 tag = page >> HW_PAGE_INDEX_SHIFT;
+  const TLBEntry& tlbe = ppcState.tlb[0][tag & HW_PAGE_INDEX_MASK];
+  for (size_t i = 0; i < TLB_WAYS; i++)
+  {
+    if (tlbe.tag[i] == tag)
+    {
+      UPTE2 PTE2;
+      PTE2.Hex = tlbe.pte[i];
+      writable |= PTE2.C != 0;
+    }
+  }
+
+  return PageTableMapping{result.address, writable};
+}
+
 }  // namespace PowerPC
@@ -177,6 +177,7 @@ void ClearCacheLine(u32 address);  // Zeroes 32 bytes; address should be 32-byte
 // TLB functions
 void SDRUpdated();
 void InvalidateTLBEntry(u32 address);
+void ClearTLBVictimCache();
 void DBATUpdated();
 void IBATUpdated();
 
@@ -213,4 +214,16 @@ inline bool TranslateBatAddess(const BatTable& bat_table, u32* address)
 }
 
 std::optional<u32> GetTranslatedAddress(u32 address);
+
+struct PageTableMapping
+{
+  u32 physical_address;
+  // Whether the changed bit of the page table entry is already set, so that writes don't have to
+  // go through the page table.
+  bool writable;
+};
+// Translates the page containing a data address through the page table, setting the referenced
+// and changed bits like an access would. Returns nothing if the address is translated by a BAT,
+// or if the access has to go through the regular path which can raise a DSI exception.
+std::optional<PageTableMapping> TranslatePageTableMapping(u32 address, bool write);
 }  // namespace PowerPC
@@ -39,6 +39,11 @@ namespace PPCAnalyst
 {
 // 0 does not perform block merging
 constexpr u32 BRANCH_FOLLOWING_THRESHOLD = 2;
+// Used instead of BRANCH_FOLLOWING_THRESHOLD for hot code, see OPTION_TRACE.
+constexpr u32 TRACE_BRANCH_FOLLOWING_THRESHOLD = 8;
+// Calls to straight-line leaf functions up to this size (in bytes) are inlined into traces without
+// counting against TRACE_BRANCH_FOLLOWING_THRESHOLD.
+constexpr u32 TRACE_MAX_INLINED_LEAF_SIZE = 32 * 4;
 
 constexpr u32 INVALID_BRANCH_TARGET = 0xFFFFFFFF;
 
@@ -431,6 +436,15 @@ void FindFunctions(u32 startAddr, u32 endAddr, PPCSymbolDB* func_db)
                unniceSize);
 }
 
+// Whether the symbol database knows a small function without calls or internal branches at the
+// address, which can always be followed to its return.
+static bool IsInlinableLeafFunction(u32 address)
+{
+  const Common::Symbol* symbol = g_symbolDB.GetSymbolFromAddr(address);
+  return symbol && symbol->address == address && (symbol->flags & Common::FFLAG_LEAF) &&
+         (symbol->flags & Common::FFLAG_STRAIGHT) && symbol->size <= TRACE_MAX_INLINED_LEAF_SIZE;
+}
+
 static bool isCmp(const CodeOp& a)
 {
   return (a.inst.OPCD == 10 || a.inst.OPCD == 11) ||
@@ -448,6 +462,24 @@ static bool isCror(const CodeOp& a)
   return a.inst.OPCD == 19 && a.inst.SUBOP10 == 449;
 }
 
+// Whether the instruction accesses memory at rA plus an immediate offset.
+static bool IsImmediateOffsetLoadStore(const CodeOp& a)
+{
+  switch (a.opinfo->type)
+  {
+  case OpType::Load:
+  case OpType::Store:
+  case OpType::LoadFP:
+  case OpType::StoreFP:
+  case OpType::LoadPS:
+  case OpType::StorePS:
+    // Opcodes 4 and 31 are the indexed forms.
+    return a.inst.OPCD != 4 && a.inst.OPCD != 31;
+  default:
+    return false;
+  }
+}
+
 void PPCAnalyzer::ReorderInstructionsCore(u32 instructions, CodeOp* code, bool reverse,
                                           ReorderType type)
 {
@@ -677,20 +709,45 @@ void PPCAnalyzer::SetInstructionStats(CodeBlock* block, CodeOp* code, const Gekk
   }
 }
 
+// Instructions which only order or prefetch memory accesses, and which are commonly found in
+// loops polling hardware registers or memory shared with another processor.
+static bool IsMemoryBarrierOrHint(UGeckoInstruction inst)
+{
+  if (inst.OPCD == 19)
+    return inst.SUBOP10 == 150;  // isync
+  if (inst.OPCD != 31)
+    return false;
+
+  switch (inst.SUBOP10)
+  {
+  case 246:  // dcbtst
+  case 278:  // dcbt
+  case 598:  // sync
+  case 854:  // eieio
+    return true;
+  default:
+    return false;
+  }
+}
+
 bool PPCAnalyzer::IsBusyWaitLoop(CodeBlock* block, CodeOp* code, size_t instructions)
 {
   // Very basic algorithm to detect busy wait loops:
-  //   * It loops to itself and does not contain any other branches.
-  //   * It does not write to memory.
-  //   * It only reads from registers it wrote to earlier in the loop, or it
-  //     does not write to these registers.
+  //   * The last instruction branches back to the start of the block.
+  //   * No branch uses CTR, and no other branch jumps to an instruction inside the loop other than
+  //     the next one. Branches which leave the loop are fine.
+  //   * Apart from memory barriers and cache hints, all other instructions are integer
+  //     instructions or loads, so the loop does not write to memory.
+  //   * A register (or the carry flag) which is read before it is written in the loop is never
+  //     written in the loop.
   //
-  // Would benefit a lot from basic inlining support - a lot of the most
-  // used busy loops are DSP register interactions, which are bl/cmp/bne
-  // (with the bl target a pure function that follows the above rules). We
-  // don't detect these at the moment.
+  // Together, these guarantee that every iteration behaves the same until
+  // memory or a hardware register changes, which can only happen when
+  // CoreTiming runs an event, so the loop can skip ahead to the next event.
   std::bitset<32> write_disallowed_regs;
   std::bitset<32> written_regs;
+  bool write_disallowed_ca = false;
+  bool written_ca = false;
   for (size_t i = 0; i <= instructions; ++i)
   {
     if (code[i].opinfo->type == OpType::Branch)
@@ -699,6 +756,21 @@ bool PPCAnalyzer::IsBusyWaitLoop(CodeBlock* block, CodeOp* code, size_t instruct
         return false;
       if (code[i].branchTo == block->m_address && i == instructions)
         return true;
+
+      // A branch which skips over part of the loop would make the register
+      // analysis below wrong, as it assumes every instruction is executed.
+      if (i < instructions && code[i].branchTo != code[i + 1].address)
+      {
+        for (size_t j = 0; j <= instructions; ++j)
+        {
+          if (code[j].address == code[i].branchTo)
+            return false;
+        }
+      }
+    }
+    else if (IsMemoryBarrierOrHint(code[i].inst))
+    {
+      continue;
     }
     else if (code[i].opinfo->type != OpType::Integer && code[i].opinfo->type != OpType::Load)
     {
@@ -725,6 +797,15 @@ bool PPCAnalyzer::IsBusyWaitLoop(CodeBlock* block, CodeOp* code, size_t instruct
           return false;
         written_regs[reg] = true;
       }
+
+      if ((code[i].opinfo->flags & FL_READ_CA) && !written_ca)
+        write_disallowed_ca = true;
+      if (code[i].opinfo->flags & FL_SET_CA)
+      {
+        if (write_disallowed_ca)
+          return false;
+        written_ca = true;
+      }
     }
   }
   return false;
@@ -756,11 +837,14 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer, std:
 
   bool found_exit = false;
   bool found_call = false;
+  bool inlining_leaf = false;
   size_t caller = 0;
   u32 numFollows = 0;
   u32 num_inst = 0;
 
   const bool enable_follow = SConfig::GetInstance().bJITFollowBranch;
+  const u32 follow_threshold =
+      HasOption(OPTION_TRACE) ? TRACE_BRANCH_FOLLOWING_THRESHOLD : BRANCH_FOLLOWING_THRESHOLD;
 
   for (std::size_t i = 0; i < block_size; ++i)
   {
@@ -787,6 +871,7 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer, std:
     SetInstructionStats(block, &code[i], opinfo, static_cast<u32>(i));
 
     bool follow = false;
+    bool free_follow = false;
 
     bool conditional_continue = false;
 
@@ -804,6 +889,8 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer, std:
         {
           found_call = true;
           caller = i;
+          inlining_leaf = HasOption(OPTION_TRACE) && IsInlinableLeafFunction(code[i].branchTo);
+          free_follow = inlining_leaf;
         }
       }
       else if (inst.OPCD == 16 && (inst.BO & BO_DONT_DECREMENT_FLAG) &&
@@ -821,7 +908,7 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer, std:
       {
         code[i].branchTo = code[caller].address + 4;
         if ((inst.BO & BO_DONT_DECREMENT_FLAG) && (inst.BO & BO_DONT_CHECK_CONDITION) &&
-            numFollows < BRANCH_FOLLOWING_THRESHOLD)
+            (inlining_leaf || numFollows < follow_threshold))
         {
           // bclrx with unconditional branch = return
           // Follow it if we can propagate the LR value of the last CALL instruction.
@@ -830,7 +917,9 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer, std:
           // the LR value on the stack as there are no spare registers. So we'd need
           // to check all store instruction to not alias with the stack.
           follow = true;
+          free_follow = inlining_leaf;
           found_call = false;
+          inlining_leaf = false;
           code[i].skip = true;
 
           // Skip the RET, so also don't generate the stack entry for the BLR optimization.
@@ -846,6 +935,7 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer, std:
           // We give up to follow the return address
           // because we have to check the register usage.
           found_call = false;
+          inlining_leaf = false;
         }
       }
     }
@@ -881,10 +971,11 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer, std:
     code[i].branchIsIdleLoop =
         code[i].branchTo == block->m_address && IsBusyWaitLoop(block, code, i);
 
-    if (follow && numFollows < BRANCH_FOLLOWING_THRESHOLD)
+    if (follow && (free_follow || numFollows < follow_threshold))
     {
       // Follow the unconditional branch.
-      numFollows++;
+      if (!free_follow)
+        numFollows++;
       address = code[i].branchTo;
     }
     else
@@ -901,6 +992,7 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer, std:
         // If we skip any conditional branch, we can't garantee to get the matching CALL/RET pair.
         // So we stop inling the RET here and let the BLR optitmization handle this case.
         found_call = false;
+        inlining_leaf = false;
       }
     }
   }
@@ -965,12 +1057,15 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer, std:
 
   // Forward scan, for flags that need the other direction for calculation.
   BitSet32 fprIsSingle, fprIsDuplicated, fprIsStoreSafe, gprDefined, gprBlockInputs;
+  BitSet32 gprAddressInputs;
   BitSet8 gqrUsed, gqrModified;
   for (u32 i = 0; i < block->m_num_instructions; i++)
   {
     CodeOp& op = code[i];
 
     gprBlockInputs |= op.regsIn & ~gprDefined;
+    if (IsImmediateOffsetLoadStore(op) && op.inst.RA != 0 && !gprDefined[op.inst.RA])
+      gprAddressInputs[op.inst.RA] = true;
     gprDefined |= op.regsOut;
 
     op.fprIsSingle = fprIsSingle;
@@ -1061,6 +1156,7 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer, std:
   block->m_gqr_used = gqrUsed;
   block->m_gqr_modified = gqrModified;
   block->m_gpr_inputs = gprBlockInputs;
+  block->m_gpr_address_inputs = gprAddressInputs;
   return address;
 }
 
@@ -165,6 +165,10 @@ struct CodeBlock
   // Which GPRs this block reads from before defining, if any.
   BitSet32 m_gpr_inputs;
 
+  // Which of m_gpr_inputs are used as the base address of a load or store with an immediate
+  // offset. If their values are constant, the addresses of those accesses are known in advance.
+  BitSet32 m_gpr_address_inputs;
+
   // Which memory locations are occupied by this block.
   std::set<u32> m_physical_addresses;
 };
@@ -208,12 +212,17 @@ public:
 
     // Reorder cror instructions next to their associated fcmp.
     OPTION_CROR_MERGE = (1 << 6),
+
+    // Follow more unconditional branches, calls and returns than usual, to build one long trace
+    // out of hot code. Requires OPTION_BRANCH_FOLLOW.
+    OPTION_TRACE = (1 << 7),
   };
 
   // Option setting/getting
   void SetOption(AnalystOption option) { m_options |= option; }
   void ClearOption(AnalystOption option) { m_options &= ~(option); }
   bool HasOption(AnalystOption option) const { return !!(m_options & option); }
+  u32 GetOptions() const { return m_options; }
   u32 Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer, std::size_t block_size);
 
 private:
@@ -152,7 +152,8 @@ u32 InstructionCache::ReadInstruction(u32 addr)
     t = lookup_table[(addr >> 5) & 0xfffff];
   }
 
-  if (t == 0xff)  // load to the cache
+  const bool miss = t == 0xff;
+  if (miss)  // load to the cache
   {
     if (HID0.ILOCK)  // instruction cache is locked
       return Memory::Read_U32(addr);
@@ -185,6 +186,10 @@ u32 InstructionCache::ReadInstruction(u32 addr)
   // update plru
   plru[set] = (plru[set] & ~s_plru_mask[t]) | s_plru_value[t];
   const u32 res = Common::swap32(data[set][t][(addr >> 2) & 7]);
+  // A block that was just loaded can't be stale, so only compare cache hits against RAM.
+  if (miss)
+    return res;
+
   const u32 inmem = Memory::Read_U32(addr);
   if (res != inmem)
   {
@@ -107,6 +107,10 @@ void DoState(PointerWrap& p)
   // *((u64 *)&TL) = SystemTimers::GetFakeTimeBase(); //works since we are little endian and TL
   // comes first :)
 
+  // Pending FPRF results aren't part of the state, so store their class first. This doesn't change
+  // anything the emulated software can observe.
+  MaterializeFPRF();
+
   p.DoArray(ppcState.gpr);
   p.Do(ppcState.pc);
   p.Do(ppcState.npc);
@@ -122,6 +126,8 @@ void DoState(PointerWrap& p)
   p.DoArray(ppcState.sr);
   p.DoArray(ppcState.spr);
   p.DoArray(ppcState.tlb);
+  if (p.GetMode() == PointerWrap::MODE_READ)
+    ClearTLBVictimCache();
   p.Do(ppcState.pagetable_base);
   p.Do(ppcState.pagetable_hashmask);
 
@@ -172,6 +178,7 @@ static void ResetRegisters()
   ppcState.spr[SPR_ECID_L] = 0x82bb08e8;
 
   ppcState.fpscr.Hex = 0;
+  ppcState.pending_fprf = PendingFPRF::None;
   ppcState.pc = 0;
   ppcState.npc = 0;
   ppcState.Exceptions = 0;
@@ -265,6 +272,7 @@ void Reset()
   ppcState.pagetable_base = 0;
   ppcState.pagetable_hashmask = 0;
   ppcState.tlb = {};
+  ClearTLBVictimCache();
 
   ResetRegisters();
   ppcState.iCache.Reset();
@@ -298,6 +306,9 @@ CoreMode GetMode()
 
 static void ApplyMode()
 {
+  // The other core wouldn't know about a result whose FPRF the JIT hasn't computed yet.
+  MaterializeFPRF();
+
   switch (s_mode)
   {
   case CoreMode::Interpreter:  // Switching from JIT to interpreter
@@ -334,6 +345,8 @@ const char* GetCPUName()
 
 void InjectExternalCPUCore(CPUCoreBase* new_cpu)
 {
+  MaterializeFPRF();
+
   // Previously injected.
   if (s_cpu_core_base_is_injected)
     s_cpu_core_base->Shutdown();
@@ -635,6 +648,23 @@ void UpdateFPRFSingle(float fvalue)
   FPSCR.FPRF = Common::ClassifyFloat(fvalue);
 }
 
+void MaterializeFPRF()
+{
+  switch (ppcState.pending_fprf)
+  {
+  case PendingFPRF::None:
+    return;
+  case PendingFPRF::Single:
+    // Like the JIT, this classifies the lower 32 bits of the result.
+    UpdateFPRFSingle(Common::BitCast<float>(static_cast<u32>(ppcState.pending_fprf_value)));
+    break;
+  case PendingFPRF::Double:
+    UpdateFPRFDouble(Common::BitCast<double>(ppcState.pending_fprf_value));
+    break;
+  }
+  ppcState.pending_fprf = PendingFPRF::None;
+}
+
 void RoundingModeUpdated()
 {
   // The rounding mode is separate for each thread, so this must run on the CPU thread
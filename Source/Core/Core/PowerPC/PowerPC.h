@@ -42,6 +42,14 @@ enum class CoreMode
   JIT,
 };
 
+// The kind of result whose class still has to be stored in FPSCR.FPRF, see MaterializeFPRF.
+enum class PendingFPRF : u32
+{
+  None,
+  Single,
+  Double,
+};
+
 // TLB cache
 constexpr size_t TLB_SIZE = 128;
 constexpr size_t NUM_TLBS = 2;
@@ -160,6 +168,10 @@ struct PowerPCState
   // Storage for the stack pointer of the BLR optimization.
   u8* stored_stack_pointer;
 
+  // The JIT can defer computing FPRF to when it's read, storing the result it's computed from here.
+  u64 pending_fprf_value;
+  PendingFPRF pending_fprf;
+
   std::array<std::array<TLBEntry, TLB_SIZE / TLB_WAYS>, NUM_TLBS> tlb;
 
   u32 pagetable_base;
@@ -305,6 +317,9 @@ inline void SetXER_OV(bool value)
 
 void UpdateFPRFDouble(double dvalue);
 void UpdateFPRFSingle(float fvalue);
+// Stores the class of a result the JIT deferred computing FPRF for. Must be called before anything
+// other than JIT code reads or partially writes FPRF.
+void MaterializeFPRF();
 
 void RoundingModeUpdated();
 
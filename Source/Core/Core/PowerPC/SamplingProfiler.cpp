@@ -0,0 +1,282 @@
+// Copyright 2021 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/PowerPC/SamplingProfiler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <utility>
+
+#if defined(_WIN32)
+#include <windows.h>
+#elif defined(__linux__)
+#include <pthread.h>
+#include <signal.h>
+#endif
+
+#include <fmt/format.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/Event.h"
+#include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
+#include "Common/Thread.h"
+#include "Core/ConfigManager.h"
+#include "Core/MachineContext.h"
+#include "Core/PowerPC/JitInterface.h"
+#include "Core/PowerPC/PPCSymbolDB.h"
+#include "Core/PowerPC/PowerPC.h"
+#include "VideoCommon/Fifo.h"
+
+#if !defined(_M_GENERIC) && (defined(_WIN32) || defined(__linux__))
+#define SAMPLING_SUPPORTED
+#endif
+
+namespace Profiler
+{
+std::atomic<bool> g_in_mmio_access{false};
+
+namespace
+{
+struct CPUState
+{
+  uintptr_t host_pc;
+  u32 guest_pc;
+  bool in_mmio_access;
+};
+}  // namespace
+
+static std::thread s_sampler_thread;
+static Common::Event s_stop_event;
+static bool s_sampling = false;
+static bool s_sample_gpu_thread = false;
+
+static std::mutex s_samples_mutex;
+static std::map<std::pair<SampleCategory, u32>, u64> s_samples;
+
+#if defined(SAMPLING_SUPPORTED) && defined(_WIN32)
+static HANDLE s_cpu_thread = nullptr;
+
+static bool StartCapturing()
+{
+  s_cpu_thread = OpenThread(THREAD_SUSPEND_RESUME | THREAD_GET_CONTEXT, FALSE,
+                            GetCurrentThreadId());
+  return s_cpu_thread != nullptr;
+}
+
+static void StopCapturing()
+{
+  CloseHandle(s_cpu_thread);
+  s_cpu_thread = nullptr;
+}
+
+static std::optional<CPUState> CaptureCPUThread()
+{
+  if (SuspendThread(s_cpu_thread) == static_cast<DWORD>(-1))
+    return std::nullopt;
+
+  CONTEXT context{};
+  context.ContextFlags = CONTEXT_CONTROL;
+  std::optional<CPUState> state;
+  if (GetThreadContext(s_cpu_thread, &context))
+  {
+    state = CPUState{static_cast<uintptr_t>(context.CTX_PC), PowerPC::ppcState.pc,
+                     g_in_mmio_access.load(std::memory_order_relaxed)};
+  }
+
+  ResumeThread(s_cpu_thread);
+  return state;
+}
+#elif defined(SAMPLING_SUPPORTED)
+// The state is captured by a signal handler running on the CPU thread itself.
+static pthread_t s_cpu_thread;
+static struct sigaction s_old_action;
+static CPUState s_captured_state;
+static std::atomic<bool> s_capture_done{false};
+
+static void CaptureSignalHandler(int, siginfo_t*, void* raw_context)
+{
+  const ucontext_t* context = static_cast<const ucontext_t*>(raw_context);
+  s_captured_state.host_pc = static_cast<uintptr_t>(context->uc_mcontext.CTX_PC);
+  s_captured_state.guest_pc = PowerPC::ppcState.pc;
+  s_captured_state.in_mmio_access = g_in_mmio_access.load(std::memory_order_relaxed);
+  s_capture_done.store(true, std::memory_order_release);
+}
+
+static bool StartCapturing()
+{
+  s_cpu_thread = pthread_self();
+
+  struct sigaction action = {};
+  action.sa_sigaction = CaptureSignalHandler;
+  action.sa_flags = SA_SIGINFO | SA_RESTART;
+  sigemptyset(&action.sa_mask);
+  return sigaction(SIGPROF, &action, &s_old_action) == 0;
+}
+
+static void StopCapturing()
+{
+  sigaction(SIGPROF, &s_old_action, nullptr);
+}
+
+static std::optional<CPUState> CaptureCPUThread()
+{
+  s_capture_done.store(false, std::memory_order_relaxed);
+  if (pthread_kill(s_cpu_thread, SIGPROF) != 0)
+    return std::nullopt;
+
+  // Give up on the sample if the CPU thread doesn't get to handle the signal in time.
+  const auto timeout = std::chrono::steady_clock::now() + std::chrono::milliseconds(10);
+  while (!s_capture_done.load(std::memory_order_acquire))
+  {
+    if (std::chrono::steady_clock::now() > timeout)
+      return std::nullopt;
+    std::this_thread::yield();
+  }
+  return s_captured_state;
+}
+#endif
+
+#ifdef SAMPLING_SUPPORTED
+static SampleCategory Categorize(const CPUState& state)
+{
+  if (state.in_mmio_access)
+    return SampleCategory::MMIO;
+
+  switch (JitInterface::GetHostCodeRegion(state.host_pc))
+  {
+  case JitInterface::HostCodeRegion::Blocks:
+    return SampleCategory::GuestCode;
+  case JitInterface::HostCodeRegion::Routines:
+    return SampleCategory::Dispatcher;
+  default:
+    return SampleCategory::HostCode;
+  }
+}
+
+static void SamplerThread(std::chrono::microseconds interval)
+{
+  Common::SetCurrentThreadName("Sampling profiler");
+
+  while (!s_stop_event.WaitFor(interval))
+  {
+    const std::optional<CPUState> state = CaptureCPUThread();
+    const bool gpu_busy = s_sample_gpu_thread && Fifo::IsGPUThreadBusy();
+
+    std::lock_guard lk(s_samples_mutex);
+    if (state)
+    {
+      const SampleCategory category = Categorize(*state);
+      const u32 address = category == SampleCategory::Dispatcher ? 0 : state->guest_pc;
+      s_samples[{category, address}]++;
+    }
+    if (gpu_busy)
+      s_samples[{SampleCategory::GPUThread, 0}]++;
+  }
+}
+#endif
+
+bool StartSampling(u32 interval_us)
+{
+  StopSampling();
+  ClearSamples();
+
+#ifdef SAMPLING_SUPPORTED
+  if (!StartCapturing())
+  {
+    ERROR_LOG_FMT(POWERPC, "Failed to start the sampling profiler");
+    return false;
+  }
+
+  s_sample_gpu_thread = SConfig::GetInstance().bCPUThread;
+  s_stop_event.Reset();
+  s_sampler_thread = std::thread(SamplerThread, std::chrono::microseconds(interval_us));
+  s_sampling = true;
+  return true;
+#else
+  ERROR_LOG_FMT(POWERPC, "The sampling profiler isn't supported on this platform");
+  return false;
+#endif
+}
+
+void StopSampling()
+{
+  if (!s_sampling)
+    return;
+
+#ifdef SAMPLING_SUPPORTED
+  s_stop_event.Set();
+  s_sampler_thread.join();
+  StopCapturing();
+#endif
+  s_sampling = false;
+}
+
+bool IsSampling()
+{
+  return s_sampling;
+}
+
+void ClearSamples()
+{
+  std::lock_guard lk(s_samples_mutex);
+  s_samples.clear();
+}
+
+static std::string GetCategoryName(SampleCategory category)
+{
+  switch (category)
+  {
+  case SampleCategory::GuestCode:
+    return "Guest code";
+  case SampleCategory::Dispatcher:
+    return "JIT dispatcher";
+  case SampleCategory::MMIO:
+    return "MMIO";
+  case SampleCategory::HostCode:
+    return "Host code";
+  case SampleCategory::GPUThread:
+    return "GPU thread";
+  }
+  return "Unknown";
+}
+
+void WriteSamples(const std::string& filename)
+{
+  std::map<std::pair<SampleCategory, u32>, u64> samples;
+  {
+    std::lock_guard lk(s_samples_mutex);
+    samples = s_samples;
+  }
+
+  // Samples of the same function are merged, as they are taken at block granularity.
+  std::map<std::string, u64> stacks;
+  for (const auto& [key, count] : samples)
+  {
+    const auto [category, address] = key;
+    std::string stack = GetCategoryName(category);
+    if (category != SampleCategory::Dispatcher && category != SampleCategory::GPUThread)
+    {
+      const Common::Symbol* symbol = g_symbolDB.GetSymbolFromAddr(address);
+      std::string function = symbol ? symbol->name : fmt::format("{:08x}", address);
+      std::replace(function.begin(), function.end(), ';', ':');
+      stack += ';' + function;
+    }
+    stacks[stack] += count;
+  }
+
+  File::IOFile f(filename, "w");
+  if (!f)
+  {
+    ERROR_LOG_FMT(POWERPC, "Failed to open {}", filename);
+    return;
+  }
+  for (const auto& [stack, count] : stacks)
+    f.WriteString(fmt::format("{} {}\n", stack, count));
+}
+}  // namespace Profiler
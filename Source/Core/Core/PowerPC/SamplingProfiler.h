@@ -0,0 +1,51 @@
+// Copyright 2021 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <string>
+
+#include "Common/CommonTypes.h"
+
+// A low overhead alternative to the block profiler. Instead of instrumenting the generated code,
+// a timer thread periodically interrupts the CPU thread, looks at where it is executing and
+// attributes the sample to the guest function it is in. Samples are split into compiled guest
+// code, the JIT dispatcher, MMIO and EFB accesses, other host code on the CPU thread, and work
+// on the GPU thread, and are written in the folded format used by flame graph tools.
+namespace Profiler
+{
+enum class SampleCategory
+{
+  GuestCode,
+  Dispatcher,
+  MMIO,
+  HostCode,
+  GPUThread,
+};
+
+// Starts sampling the calling thread, which has to be the CPU thread, every interval_us
+// microseconds. Returns false if sampling isn't supported on this platform.
+bool StartSampling(u32 interval_us);
+// Stops sampling. This has to be called on the CPU thread before it exits.
+void StopSampling();
+bool IsSampling();
+
+// Discards all samples taken so far.
+void ClearSamples();
+// Writes one line per category and guest function with its number of samples.
+void WriteSamples(const std::string& filename);
+
+extern std::atomic<bool> g_in_mmio_access;
+
+// Marks the CPU thread as handling an MMIO access for the samples taken in the meantime.
+class ScopedMMIOAccess final
+{
+public:
+  ScopedMMIOAccess() { g_in_mmio_access.store(true, std::memory_order_relaxed); }
+  ~ScopedMMIOAccess() { g_in_mmio_access.store(false, std::memory_order_relaxed); }
+
+  ScopedMMIOAccess(const ScopedMMIOAccess&) = delete;
+  ScopedMMIOAccess& operator=(const ScopedMMIOAccess&) = delete;
+};
+}  // namespace Profiler
@@ -9,7 +9,9 @@
 #include <limits>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "Common/FileUtil.h"
 #include "Common/Logging/Log.h"
@@ -158,15 +160,25 @@ bool MEGASignatureDB::Save(const std::string& file_path) const
 
 void MEGASignatureDB::Apply(PPCSymbolDB* symbol_db) const
 {
+  // Only signatures with the same size as a symbol can match it, so group them by size rather than
+  // comparing every symbol with every signature. Each group keeps the order of the file.
+  std::unordered_map<u32, std::vector<const MEGASignature*>> signatures_by_size;
+  for (const auto& sig : m_signatures)
+    signatures_by_size[static_cast<u32>(sig.code.size() * sizeof(u32))].push_back(&sig);
+
   for (auto& it : symbol_db->AccessSymbols())
   {
     auto& symbol = it.second;
-    for (const auto& sig : m_signatures)
+    const auto signatures = signatures_by_size.find(symbol.size);
+    if (signatures == signatures_by_size.end())
+      continue;
+
+    for (const MEGASignature* sig : signatures->second)
     {
-      if (Compare(symbol.address, symbol.size, sig))
+      if (Compare(symbol.address, symbol.size, *sig))
       {
-        symbol.name = sig.name;
-        INFO_LOG_FMT(SYMBOLS, "Found {} at {:08x} (size: {:08x})!", sig.name, symbol.address,
+        symbol.name = sig->name;
+        INFO_LOG_FMT(SYMBOLS, "Found {} at {:08x} (size: {:08x})!", sig->name, symbol.address,
                      symbol.size);
         break;
       }
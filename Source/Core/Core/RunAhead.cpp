@@ -0,0 +1,94 @@
+// Copyright 2021 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/RunAhead.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Core/Config/MainSettings.h"
+#include "Core/Core.h"
+#include "Core/Movie.h"
+#include "Core/PowerPC/JitInterface.h"
+#include "Core/State.h"
+
+namespace RunAhead
+{
+// Every frame emulated ahead adds the cost of a whole frame to each frame which is shown.
+constexpr int MAX_FRAMES = 4;
+
+// 0 while a frame is emulated for real, otherwise the number of the frame being emulated ahead.
+static int s_frame = 0;
+static int s_frames_ahead = 0;
+static std::vector<u8> s_state;
+static bool s_loading_state = false;
+
+static int GetFramesAhead()
+{
+  // The frames emulated ahead read the input as it is at the time, so they aren't reproducible.
+  if (Core::WantsDeterminism() || Movie::IsMovieActive())
+    return 0;
+
+  return std::clamp(Config::Get(Config::MAIN_RUN_AHEAD_FRAMES), 0, MAX_FRAMES);
+}
+
+void OnBeginField()
+{
+  if (s_frame == 0)
+  {
+    // A frame has been emulated for real. Keep it, then start emulating ahead.
+    s_frames_ahead = GetFramesAhead();
+    if (s_frames_ahead == 0)
+      return;
+
+    State::SaveToBuffer(s_state);
+    JitInterface::BeginInvalidationLog();
+    s_frame = 1;
+  }
+  else if (s_frame < s_frames_ahead && GetFramesAhead() != 0)
+  {
+    s_frame++;
+  }
+  else
+  {
+    // The last frame emulated ahead has just been output, N frames after the one which was output
+    // for real. Go back to the frame emulated for real, which only leaves the code modified since
+    // then to be invalidated in the JIT cache.
+    s_loading_state = true;
+    State::LoadFromBuffer(s_state);
+    s_loading_state = false;
+
+    JitInterface::EndInvalidationLog(true);
+    s_frame = 0;
+  }
+}
+
+void OnLoadState()
+{
+  if (s_loading_state)
+    return;
+
+  // Another state replaces the frames emulated ahead, and the JIT cache has to be cleared for it.
+  if (s_frame != 0)
+    JitInterface::EndInvalidationLog(false);
+  s_frame = 0;
+}
+
+void Shutdown()
+{
+  OnLoadState();
+  s_frames_ahead = 0;
+  std::vector<u8>().swap(s_state);
+}
+
+bool IsRunningAhead()
+{
+  return s_frame != 0;
+}
+
+bool IsFrameHidden()
+{
+  return s_frames_ahead != 0 && s_frame != s_frames_ahead;
+}
+}  // namespace RunAhead
@@ -0,0 +1,28 @@
+// Copyright 2021 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Run-ahead hides the input lag of games which only react to input a few frames after reading it.
+//
+// Right after every frame has been output, a savestate is kept in memory and the following frames
+// are emulated ahead of time with the current input, without throttling and without audio. Only
+// the output of the last of those is shown, and then the savestate is loaded again so that the next
+// frame is emulated for real.
+
+#pragma once
+
+namespace RunAhead
+{
+// Called on the CPU thread right after VI has sent a field to the video backend, or would have if
+// the field wasn't hidden.
+void OnBeginField();
+
+// Called on the CPU thread before a savestate is loaded.
+void OnLoadState();
+void Shutdown();
+
+// Whether the frame being emulated is one of the frames emulated ahead of time.
+bool IsRunningAhead();
+// Whether the frame being emulated shouldn't be output, because it is superseded by a frame
+// emulated ahead of time.
+bool IsFrameHidden();
+}  // namespace RunAhead
@@ -3,8 +3,14 @@
 
 #include "Core/State.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <deque>
+#include <future>
 #include <lzo/lzo1x.h>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <thread>
@@ -12,12 +18,14 @@
 #include <vector>
 
 #include <fmt/format.h>
+#include <zstd.h>
 
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/Event.h"
 #include "Common/FileUtil.h"
 #include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 #include "Common/ScopeGuard.h"
 #include "Common/Thread.h"
@@ -35,6 +43,7 @@
 #include "Core/Movie.h"
 #include "Core/NetPlayClient.h"
 #include "Core/PowerPC/PowerPC.h"
+#include "Core/RunAhead.h"
 
 #include "VideoCommon/FrameDump.h"
 #include "VideoCommon/OnScreenDisplay.h"
@@ -52,12 +61,48 @@ static const u32 IN_LEN = 128 * 1024u;
 
 static const u32 OUT_LEN = IN_LEN + (IN_LEN / 16) + 64 + 3;
 
-static unsigned char __LZO_MMODEL out[OUT_LEN];
+// Old savestates are made of LZO blocks which are each preceded by their compressed size.
+// Current savestates instead start with this magic, which is larger than any LZO block can be,
+// followed by a CompressedStateIndex and the compressed size of every chunk.
+// The chunks are compressed independently with zstd, so they can be handled in parallel.
+constexpr u32 ZSTD_STATE_MAGIC = 0x5453445A;  // "ZDST"
+static_assert(ZSTD_STATE_MAGIC > OUT_LEN);
 
-#define HEAP_ALLOC(var, size)                                                                      \
-  lzo_align_t __LZO_MMODEL var[((size) + (sizeof(lzo_align_t) - 1)) / sizeof(lzo_align_t)]
+constexpr u32 ZSTD_STATE_CHUNK_SIZE = 1024 * 1024;
+constexpr int ZSTD_STATE_COMPRESSION_LEVEL = 1;
 
-static HEAP_ALLOC(wrkmem, LZO1X_1_MEM_COMPRESS);
+struct CompressedStateIndex
+{
+  u32 magic;
+  u32 chunk_size;
+  u32 chunk_count;
+};
+
+// Delta savestates compare emulated memory in pages of this size.
+constexpr u32 DELTA_PAGE_SIZE = 0x1000;
+// Once more than 1/DELTA_KEYFRAME_RATIO of all pages differ from the keyframe,
+// a new keyframe is taken.
+constexpr size_t DELTA_KEYFRAME_RATIO = 8;
+constexpr size_t REWIND_BUFFER_CAPACITY = 30;
+
+// A full copy of all Memory::StateRegions, concatenated.
+struct DeltaKeyframe
+{
+  std::vector<u8> memory;
+};
+
+struct DeltaSnapshot
+{
+  std::shared_ptr<const DeltaKeyframe> keyframe;
+  // The savestate of everything except emulated memory.
+  std::vector<u8> device_state;
+  // Indices of the pages of keyframe->memory which differ, and their contents.
+  std::vector<u32> dirty_pages;
+  std::vector<u8> page_data;
+};
+
+static std::deque<DeltaSnapshot> s_rewind_buffer;
+static std::mutex s_rewind_buffer_mutex;
 
 static AfterLoadCallbackFunc s_on_after_load_callback;
 
@@ -66,6 +111,10 @@ static std::vector<u8> g_undo_load_buffer;
 static std::vector<u8> g_current_buffer;
 static bool s_load_or_save_in_progress;
 
+// Size of the last full state which was saved. New buffers for full states reserve this much, so
+// that they can usually be written without measuring the state first.
+static size_t s_full_state_size;
+
 static std::mutex g_cs_undo_load_buffer;
 static std::mutex g_cs_current_buffer;
 static Common::Event g_compressAndDumpStateSyncEvent;
@@ -73,7 +122,7 @@ static Common::Event g_compressAndDumpStateSyncEvent;
 static std::thread g_save_thread;
 
 // Don't forget to increase this after doing changes on the savestate system
-constexpr u32 STATE_VERSION = 132;  // Last changed in PR 9532
+constexpr u32 STATE_VERSION = 133;  // Last changed in PR XXXX
 
 // Maps savestate versions to Dolphin versions.
 // Versions after 42 don't need to be added to this list,
@@ -105,6 +154,36 @@ void EnableCompression(bool compression)
   s_use_compression = compression;
 }
 
+// Calls function(thread_index, chunk_index) for every chunk, spread over all host threads.
+// Returns false if any of the calls returned false.
+template <typename F>
+static bool RunOnChunks(size_t chunk_count, F function)
+{
+  const size_t threads =
+      std::min<size_t>(chunk_count, std::max<unsigned int>(1, std::thread::hardware_concurrency()));
+
+  std::atomic<bool> success = true;
+  std::vector<std::future<void>> futures(threads);
+  for (size_t i = 0; i < threads; ++i)
+  {
+    futures[i] = std::async(
+        std::launch::async,
+        [&function, &success](size_t thread_index, size_t start, size_t end) {
+          for (size_t j = start; j < end && success.load(std::memory_order_relaxed); ++j)
+          {
+            if (!function(thread_index, j))
+              success.store(false);
+          }
+        },
+        i, i * chunk_count / threads, (i + 1) * chunk_count / threads);
+  }
+
+  for (std::future<void>& future : futures)
+    future.get();
+
+  return success.load();
+}
+
 // Returns true if state version matches current Dolphin state version, false otherwise.
 static bool DoStateVersion(PointerWrap& p, std::string* version_created_by)
 {
@@ -159,6 +238,9 @@ static void DoState(PointerWrap& p)
     return;
   }
 
+  if (p.GetMode() == PointerWrap::MODE_READ)
+    RunAhead::OnLoadState();
+
   bool is_wii = SConfig::GetInstance().bWii || SConfig::GetInstance().m_is_mios;
   const bool is_wii_currently = is_wii;
   p.Do(is_wii);
@@ -231,22 +313,269 @@ void LoadFromBuffer(std::vector<u8>& buffer)
       true);
 }
 
+// Most of a full state is memory, and everything else fits in this margin.
+constexpr size_t STATE_SIZE_MARGIN = 16 * 1024 * 1024;
+
+static size_t GetFullStateSizeHint()
+{
+  if (s_full_state_size != 0)
+    return s_full_state_size;
+
+  const bool wii = SConfig::GetInstance().bWii;
+  size_t size = size_t{Memory::GetRamSize()} + Memory::GetL1CacheSize() + STATE_SIZE_MARGIN;
+  if (wii)
+    size += Memory::GetExRamSize();
+  else if (!SConfig::GetInstance().bMMU)
+    size += Memory::GetFakeVMemSize();
+  return size;
+}
+
+// Consecutive states are usually the same size, so when the buffer already has room for the
+// state (e.g. it holds the previous one, or size_hint was big enough), it is written in a single
+// pass. Otherwise, the state is measured first. Each pass has to synchronize with the GPU thread.
+// Returns false if the state couldn't be written.
+static bool DoStateToBuffer(std::vector<u8>& buffer, size_t size_hint = 0)
+{
+  if (buffer.empty() && size_hint != 0)
+    buffer.reserve(size_hint);
+
+  if (buffer.capacity() != 0)
+  {
+    buffer.resize(buffer.capacity());
+    u8* ptr = buffer.data();
+    PointerWrap p(&ptr, PointerWrap::MODE_WRITE, buffer.data() + buffer.size());
+    DoState(p);
+    const size_t state_size = static_cast<size_t>(ptr - buffer.data());
+    if (p.GetMode() == PointerWrap::MODE_WRITE)
+    {
+      buffer.resize(state_size);
+      return true;
+    }
+    // The state didn't fit, but the write pass has measured it.
+    buffer.resize(state_size);
+  }
+  else
+  {
+    u8* ptr = nullptr;
+    PointerWrap p(&ptr, PointerWrap::MODE_MEASURE);
+    DoState(p);
+    buffer.resize(reinterpret_cast<size_t>(ptr));
+  }
+
+  u8* ptr = buffer.data();
+  PointerWrap p(&ptr, PointerWrap::MODE_WRITE);
+  DoState(p);
+  return p.GetMode() == PointerWrap::MODE_WRITE;
+}
+
+static bool DoFullStateToBuffer(std::vector<u8>& buffer)
+{
+  if (!DoStateToBuffer(buffer, GetFullStateSizeHint()))
+    return false;
+
+  s_full_state_size = buffer.size();
+  return true;
+}
+
 void SaveToBuffer(std::vector<u8>& buffer)
+{
+  Core::RunOnCPUThread([&] { DoFullStateToBuffer(buffer); }, true);
+}
+
+static void SaveDeviceStateToBuffer(std::vector<u8>& buffer)
+{
+  Memory::SetDoStateSkipsRAM(true);
+  Common::ScopeGuard guard([] { Memory::SetDoStateSkipsRAM(false); });
+
+  DoStateToBuffer(buffer);
+}
+
+static bool LoadDeviceStateFromBuffer(std::vector<u8>& buffer)
+{
+  Memory::SetDoStateSkipsRAM(true);
+  Common::ScopeGuard guard([] { Memory::SetDoStateSkipsRAM(false); });
+
+  u8* ptr = buffer.data();
+  PointerWrap p(&ptr, PointerWrap::MODE_READ);
+  DoState(p);
+  return p.GetMode() == PointerWrap::MODE_READ;
+}
+
+// Finds the pages of the current memory contents which differ from the keyframe.
+static void FindDirtyPages(const std::vector<Memory::StateRegion>& regions,
+                           const DeltaKeyframe& keyframe, DeltaSnapshot* snapshot)
+{
+  // Split the comparison into chunks of pages which never straddle two regions.
+  constexpr u32 PAGES_PER_CHUNK = ZSTD_STATE_CHUNK_SIZE / DELTA_PAGE_SIZE;
+  struct Chunk
+  {
+    const u8* data;
+    u32 first_page;
+    u32 page_count;
+    std::vector<u32> dirty_pages;
+  };
+
+  std::vector<Chunk> chunks;
+  u32 region_first_page = 0;
+  for (const Memory::StateRegion& region : regions)
+  {
+    const u32 region_pages = region.size / DELTA_PAGE_SIZE;
+    for (u32 page = 0; page < region_pages; page += PAGES_PER_CHUNK)
+    {
+      chunks.push_back({region.data + page * DELTA_PAGE_SIZE, region_first_page + page,
+                        std::min(PAGES_PER_CHUNK, region_pages - page), {}});
+    }
+    region_first_page += region_pages;
+  }
+
+  RunOnChunks(chunks.size(), [&chunks, &keyframe](size_t, size_t chunk_index) {
+    Chunk& chunk = chunks[chunk_index];
+    for (u32 i = 0; i < chunk.page_count; ++i)
+    {
+      const u32 page = chunk.first_page + i;
+      if (std::memcmp(chunk.data + i * DELTA_PAGE_SIZE,
+                      keyframe.memory.data() + size_t{page} * DELTA_PAGE_SIZE, DELTA_PAGE_SIZE))
+      {
+        chunk.dirty_pages.push_back(page);
+      }
+    }
+    return true;
+  });
+
+  for (const Chunk& chunk : chunks)
+  {
+    for (u32 page : chunk.dirty_pages)
+    {
+      snapshot->dirty_pages.push_back(page);
+      const u8* data = chunk.data + (page - chunk.first_page) * DELTA_PAGE_SIZE;
+      snapshot->page_data.insert(snapshot->page_data.end(), data, data + DELTA_PAGE_SIZE);
+    }
+  }
+}
+
+void ClearRewindBuffer()
+{
+  std::lock_guard lk(s_rewind_buffer_mutex);
+  s_rewind_buffer.clear();
+}
+
+void SaveToRewindBuffer()
 {
   Core::RunOnCPUThread(
       [&] {
-        u8* ptr = nullptr;
-        PointerWrap p(&ptr, PointerWrap::MODE_MEASURE);
+        const std::vector<Memory::StateRegion> regions = Memory::GetStateRegions();
+        size_t memory_size = 0;
+        for (const Memory::StateRegion& region : regions)
+          memory_size += region.size;
+
+        // Sized like the previous snapshot so that the state can be written in a single pass.
+        static size_t s_last_device_state_size = 0;
+        DeltaSnapshot snapshot;
+        snapshot.device_state.resize(s_last_device_state_size);
+        SaveDeviceStateToBuffer(snapshot.device_state);
+        s_last_device_state_size = snapshot.device_state.size();
+
+        std::lock_guard lk(s_rewind_buffer_mutex);
+
+        if (!s_rewind_buffer.empty() &&
+            s_rewind_buffer.back().keyframe->memory.size() == memory_size)
+        {
+          snapshot.keyframe = s_rewind_buffer.back().keyframe;
+          FindDirtyPages(regions, *snapshot.keyframe, &snapshot);
 
-        DoState(p);
-        const size_t buffer_size = reinterpret_cast<size_t>(ptr);
-        buffer.resize(buffer_size);
+          const size_t total_pages = memory_size / DELTA_PAGE_SIZE;
+          if (snapshot.dirty_pages.size() > total_pages / DELTA_KEYFRAME_RATIO)
+          {
+            snapshot.keyframe.reset();
+            snapshot.dirty_pages.clear();
+            snapshot.page_data.clear();
+          }
+        }
 
-        ptr = &buffer[0];
-        p.SetMode(PointerWrap::MODE_WRITE);
-        DoState(p);
+        if (!snapshot.keyframe)
+        {
+          auto keyframe = std::make_shared<DeltaKeyframe>();
+          keyframe->memory.reserve(memory_size);
+          for (const Memory::StateRegion& region : regions)
+            keyframe->memory.insert(keyframe->memory.end(), region.data, region.data + region.size);
+          snapshot.keyframe = std::move(keyframe);
+        }
+
+        s_rewind_buffer.push_back(std::move(snapshot));
+        while (s_rewind_buffer.size() > REWIND_BUFFER_CAPACITY)
+          s_rewind_buffer.pop_front();
+      },
+      true);
+}
+
+bool LoadFromRewindBuffer(size_t steps_back)
+{
+  if (NetPlay::IsNetPlayRunning())
+  {
+    OSD::AddMessage("Loading savestates is disabled in Netplay to prevent desyncs");
+    return false;
+  }
+
+  bool success = false;
+  Core::RunOnCPUThread(
+      [&] {
+        std::lock_guard lk(s_rewind_buffer_mutex);
+        if (steps_back >= s_rewind_buffer.size())
+          return;
+
+        DeltaSnapshot& snapshot = s_rewind_buffer[s_rewind_buffer.size() - 1 - steps_back];
+
+        // Check all of the memory contents before anything is overwritten.
+        const std::vector<Memory::StateRegion> regions = Memory::GetStateRegions();
+        size_t memory_size = 0;
+        for (const Memory::StateRegion& region : regions)
+          memory_size += region.size;
+        const size_t total_pages = memory_size / DELTA_PAGE_SIZE;
+        if (snapshot.keyframe->memory.size() != memory_size ||
+            snapshot.page_data.size() != snapshot.dirty_pages.size() * DELTA_PAGE_SIZE ||
+            std::any_of(snapshot.dirty_pages.begin(), snapshot.dirty_pages.end(),
+                        [total_pages](u32 page) { return page >= total_pages; }))
+        {
+          return;
+        }
+
+        // The device state can only be checked by loading it, which may fail partway through.
+        // Go back to the current device state in that case. Memory hasn't been touched yet.
+        std::vector<u8> current_device_state;
+        SaveDeviceStateToBuffer(current_device_state);
+        if (!LoadDeviceStateFromBuffer(snapshot.device_state))
+        {
+          LoadDeviceStateFromBuffer(current_device_state);
+          return;
+        }
+
+        // Restore memory last, so that nothing which is written back to RAM while loading the
+        // device state (like the video backend flushing its caches) can clobber it.
+        size_t offset = 0;
+        for (const Memory::StateRegion& region : regions)
+        {
+          std::memcpy(region.data, snapshot.keyframe->memory.data() + offset, region.size);
+          offset += region.size;
+        }
+
+        size_t page_offset = 0;
+        for (u32 page : snapshot.dirty_pages)
+        {
+          size_t address = size_t{page} * DELTA_PAGE_SIZE;
+          auto region = regions.begin();
+          while (address >= region->size)
+            address -= (region++)->size;
+          std::memcpy(region->data + address, snapshot.page_data.data() + page_offset,
+                      DELTA_PAGE_SIZE);
+          page_offset += DELTA_PAGE_SIZE;
+        }
+
+        s_rewind_buffer.erase(s_rewind_buffer.end() - steps_back, s_rewind_buffer.end());
+        success = true;
       },
       true);
+
+  return success;
 }
 
 // return state number not in map
@@ -301,9 +630,62 @@ struct CompressAndDumpState_args
   std::vector<u8>* buffer_vector;
   std::mutex* buffer_mutex;
   std::string filename;
+  // The movie recording as of the state, if a recording is active and has to be saved with it.
+  std::optional<std::vector<u8>> movie_recording;
+  bool delete_movie;
   bool wait;
 };
 
+static bool CompressAndWriteChunks(File::IOFile& f, const u8* data, size_t size)
+{
+  const size_t chunk_count = (size + ZSTD_STATE_CHUNK_SIZE - 1) / ZSTD_STATE_CHUNK_SIZE;
+  std::vector<std::vector<u8>> chunks(chunk_count);
+  std::vector<u32> compressed_sizes(chunk_count);
+  std::vector<ZSTD_CCtx*> contexts(std::max<unsigned int>(1, std::thread::hardware_concurrency()));
+
+  const bool success = RunOnChunks(chunk_count, [&](size_t thread_index, size_t chunk_index) {
+    ZSTD_CCtx*& context = contexts[thread_index];
+    if (!context)
+      context = ZSTD_createCCtx();
+
+    const size_t offset = chunk_index * ZSTD_STATE_CHUNK_SIZE;
+    const size_t chunk_size = std::min<size_t>(ZSTD_STATE_CHUNK_SIZE, size - offset);
+
+    std::vector<u8>& chunk = chunks[chunk_index];
+    chunk.resize(ZSTD_compressBound(chunk_size));
+    const size_t result = ZSTD_compressCCtx(context, chunk.data(), chunk.size(), data + offset,
+                                            chunk_size, ZSTD_STATE_COMPRESSION_LEVEL);
+    if (ZSTD_isError(result))
+    {
+      ERROR_LOG_FMT(CORE, "Savestate compression failed: {}", ZSTD_getErrorName(result));
+      return false;
+    }
+
+    chunk.resize(result);
+    compressed_sizes[chunk_index] = static_cast<u32>(result);
+    return true;
+  });
+
+  for (ZSTD_CCtx* context : contexts)
+    ZSTD_freeCCtx(context);
+
+  if (!success)
+    return false;
+
+  const CompressedStateIndex index{ZSTD_STATE_MAGIC, ZSTD_STATE_CHUNK_SIZE,
+                                   static_cast<u32>(chunk_count)};
+  if (!f.WriteArray(&index, 1) || !f.WriteArray(compressed_sizes.data(), chunk_count))
+    return false;
+
+  for (const std::vector<u8>& chunk : chunks)
+  {
+    if (!f.WriteBytes(chunk.data(), chunk.size()))
+      return false;
+  }
+
+  return true;
+}
+
 static void CompressAndDumpState(CompressAndDumpState_args save_args)
 {
   std::lock_guard lk(*save_args.buffer_mutex);
@@ -342,9 +724,9 @@ static void CompressAndDumpState(CompressAndDumpState_args save_args)
       File::Rename(filename + ".dtm", File::GetUserPath(D_STATESAVES_IDX) + "lastState.sav.dtm");
   }
 
-  if ((Movie::IsMovieActive()) && !Movie::IsJustStartingRecordingInputFromSaveState())
-    Movie::SaveRecording(filename + ".dtm");
-  else if (!Movie::IsMovieActive())
+  if (save_args.movie_recording)
+    Movie::WriteRecording(filename + ".dtm", *save_args.movie_recording);
+  else if (save_args.delete_movie)
     File::Delete(filename + ".dtm");
 
   File::IOFile f(filename, "wb");
@@ -364,32 +746,10 @@ static void CompressAndDumpState(CompressAndDumpState_args save_args)
 
   if (header.size != 0)  // non-zero header size means the state is compressed
   {
-    lzo_uint i = 0;
-    while (true)
+    if (!CompressAndWriteChunks(f, buffer_data, buffer_size))
     {
-      lzo_uint32 cur_len = 0;
-      lzo_uint out_len = 0;
-
-      if ((i + IN_LEN) >= buffer_size)
-      {
-        cur_len = (lzo_uint32)(buffer_size - i);
-      }
-      else
-      {
-        cur_len = IN_LEN;
-      }
-
-      if (lzo1x_1_compress(buffer_data + i, cur_len, out, &out_len, wrkmem) != LZO_E_OK)
-        PanicAlertFmtT("Internal LZO Error - compression failed");
-
-      // The size of the data to write is 'out_len'
-      f.WriteArray((lzo_uint32*)&out_len, 1);
-      f.WriteBytes(out, out_len);
-
-      if (cur_len != IN_LEN)
-        break;
-
-      i += cur_len;
+      Core::DisplayMessage("Could not save state", 2000);
+      return;
     }
   }
   else  // uncompressed
@@ -410,22 +770,14 @@ void SaveAs(const std::string& filename, bool wait)
 
   Core::RunOnCPUThread(
       [&] {
-        // Measure the size of the buffer.
-        u8* ptr = nullptr;
-        PointerWrap p(&ptr, PointerWrap::MODE_MEASURE);
-        DoState(p);
-        const size_t buffer_size = reinterpret_cast<size_t>(ptr);
-
-        // Then actually do the write.
+        // g_current_buffer keeps its capacity between saves, so this is usually a single pass.
+        bool success;
         {
           std::lock_guard lk(g_cs_current_buffer);
-          g_current_buffer.resize(buffer_size);
-          ptr = &g_current_buffer[0];
-          p.SetMode(PointerWrap::MODE_WRITE);
-          DoState(p);
+          success = DoFullStateToBuffer(g_current_buffer);
         }
 
-        if (p.GetMode() == PointerWrap::MODE_WRITE)
+        if (success)
         {
           Core::DisplayMessage("Saving State...", 1000);
 
@@ -433,10 +785,14 @@ void SaveAs(const std::string& filename, bool wait)
           save_args.buffer_vector = &g_current_buffer;
           save_args.buffer_mutex = &g_cs_current_buffer;
           save_args.filename = filename;
+          // The recording goes on while the state is written, so it is copied here.
+          if (Movie::IsMovieActive() && !Movie::IsJustStartingRecordingInputFromSaveState())
+            save_args.movie_recording = Movie::SaveRecordingToBuffer();
+          save_args.delete_movie = !Movie::IsMovieActive();
           save_args.wait = wait;
 
           Flush();
-          g_save_thread = std::thread(CompressAndDumpState, save_args);
+          g_save_thread = std::thread(CompressAndDumpState, std::move(save_args));
           g_compressAndDumpStateSyncEvent.Wait();
         }
         else
@@ -481,6 +837,97 @@ u64 GetUnixTimeOfSlot(int slot)
          (Common::Timer::DOUBLE_TIME_OFFSET * MS_PER_SEC);
 }
 
+static bool ReadAndDecompressChunks(File::IOFile& f, std::vector<u8>& buffer)
+{
+  CompressedStateIndex index;
+  index.magic = ZSTD_STATE_MAGIC;
+  if (!f.ReadArray(&index.chunk_size, 1) || !f.ReadArray(&index.chunk_count, 1) ||
+      index.chunk_size == 0 ||
+      index.chunk_count != (buffer.size() + index.chunk_size - 1) / index.chunk_size)
+  {
+    return false;
+  }
+
+  std::vector<u32> compressed_sizes(index.chunk_count);
+  if (!f.ReadArray(compressed_sizes.data(), index.chunk_count))
+    return false;
+
+  std::vector<size_t> compressed_offsets(index.chunk_count);
+  size_t compressed_total = 0;
+  for (size_t i = 0; i < index.chunk_count; ++i)
+  {
+    compressed_offsets[i] = compressed_total;
+    compressed_total += compressed_sizes[i];
+  }
+
+  std::vector<u8> compressed(compressed_total);
+  if (!f.ReadBytes(compressed.data(), compressed.size()))
+    return false;
+
+  std::vector<ZSTD_DCtx*> contexts(std::max<unsigned int>(1, std::thread::hardware_concurrency()));
+
+  const bool success = RunOnChunks(index.chunk_count, [&](size_t thread_index, size_t chunk_index) {
+    ZSTD_DCtx*& context = contexts[thread_index];
+    if (!context)
+      context = ZSTD_createDCtx();
+
+    const size_t offset = chunk_index * index.chunk_size;
+    const size_t chunk_size = std::min<size_t>(index.chunk_size, buffer.size() - offset);
+    const size_t result =
+        ZSTD_decompressDCtx(context, buffer.data() + offset, chunk_size,
+                            compressed.data() + compressed_offsets[chunk_index],
+                            compressed_sizes[chunk_index]);
+    if (ZSTD_isError(result) || result != chunk_size)
+    {
+      ERROR_LOG_FMT(CORE, "Savestate decompression failed for chunk {}: {}", chunk_index,
+                    ZSTD_isError(result) ? ZSTD_getErrorName(result) : "wrong size");
+      return false;
+    }
+
+    return true;
+  });
+
+  for (ZSTD_DCtx* context : contexts)
+    ZSTD_freeDCtx(context);
+
+  return success;
+}
+
+// Reads a savestate made before the switch to zstd. first_block_size is the size of the first
+// block, which the caller has already read.
+static bool ReadAndDecompressLZOBlocks(File::IOFile& f, u32 first_block_size,
+                                       std::vector<u8>& buffer)
+{
+  std::vector<u8> out(OUT_LEN);
+
+  lzo_uint i = 0;
+  lzo_uint32 cur_len = first_block_size;  // number of bytes to read
+  while (true)
+  {
+    lzo_uint new_len = 0;  // number of bytes to write
+
+    if (cur_len > OUT_LEN || !f.ReadBytes(out.data(), cur_len))
+      break;
+
+    const int res = lzo1x_decompress(out.data(), cur_len, &buffer[i], &new_len, nullptr);
+    if (res != LZO_E_OK)
+    {
+      // This doesn't seem to happen anymore.
+      PanicAlertFmtT("Internal LZO Error - decompression failed ({0}) ({1}, {2}) \n"
+                     "Try loading the state again",
+                     res, i, new_len);
+      return false;
+    }
+
+    i += new_len;
+
+    if (!f.ReadArray(&cur_len, 1))
+      break;
+  }
+
+  return true;
+}
+
 static void LoadFileStateData(const std::string& filename, std::vector<u8>& ret_data)
 {
   Flush();
@@ -509,27 +956,24 @@ static void LoadFileStateData(const std::string& filename, std::vector<u8>& ret_
 
     buffer.resize(header.size);
 
-    lzo_uint i = 0;
-    while (true)
+    u32 magic;
+    if (!f.ReadArray(&magic, 1))
     {
-      lzo_uint32 cur_len = 0;  // number of bytes to read
-      lzo_uint new_len = 0;    // number of bytes to write
-
-      if (!f.ReadArray(&cur_len, 1))
-        break;
+      Core::DisplayMessage("The savestate is truncated", 2000);
+      return;
+    }
 
-      f.ReadBytes(out, cur_len);
-      const int res = lzo1x_decompress(out, cur_len, &buffer[i], &new_len, nullptr);
-      if (res != LZO_E_OK)
+    if (magic == ZSTD_STATE_MAGIC)
+    {
+      if (!ReadAndDecompressChunks(f, buffer))
       {
-        // This doesn't seem to happen anymore.
-        PanicAlertFmtT("Internal LZO Error - decompression failed ({0}) ({1}, {2}) \n"
-                       "Try loading the state again",
-                       res, i, new_len);
+        PanicAlertFmtT("Savestate decompression failed\nTry loading the state again");
         return;
       }
-
-      i += new_len;
+    }
+    else if (!ReadAndDecompressLZOBlocks(f, magic, buffer))
+    {
+      return;
     }
   }
   else  // uncompressed
@@ -621,6 +1065,19 @@ void LoadAs(const std::string& filename)
   s_load_or_save_in_progress = false;
 }
 
+bool IsLoadable(const std::string& filename)
+{
+  std::vector<u8> buffer;
+  LoadFileStateData(filename, buffer);
+  if (buffer.empty())
+    return false;
+
+  u8* ptr = buffer.data();
+  PointerWrap p(&ptr, PointerWrap::MODE_READ);
+  std::string version_created_by;
+  return DoStateVersion(p, &version_created_by);
+}
+
 void SetOnAfterLoadCallback(AfterLoadCallbackFunc callback)
 {
   s_on_after_load_callback = std::move(callback);
@@ -648,6 +1105,8 @@ void Shutdown()
     std::lock_guard lk(g_cs_undo_load_buffer);
     std::vector<u8>().swap(g_undo_load_buffer);
   }
+
+  ClearRewindBuffer();
 }
 
 static std::string MakeStateFilename(int number)
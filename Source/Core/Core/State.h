@@ -48,10 +48,23 @@ void Load(int slot);
 
 void SaveAs(const std::string& filename, bool wait = false);
 void LoadAs(const std::string& filename);
+// Returns whether the state file belongs to the current game and was made by a compatible version,
+// i.e. whether LoadAs would succeed. Decompresses the whole state to check this.
+bool IsLoadable(const std::string& filename);
 
 void SaveToBuffer(std::vector<u8>& buffer);
 void LoadFromBuffer(std::vector<u8>& buffer);
 
+// The rewind buffer is a ring buffer of in-memory delta savestates. Each entry stores the state of
+// all devices, but only those 4 KiB pages of emulated memory which differ from a shared keyframe.
+// It is cheap enough to be used for taking snapshots every few seconds.
+void ClearRewindBuffer();
+void SaveToRewindBuffer();
+// Loads the entry that was saved steps_back entries before the most recent one, and drops all
+// entries newer than it. Returns false if there is no such entry or it couldn't be loaded, in which
+// case the current state and the entries are kept.
+bool LoadFromRewindBuffer(size_t steps_back = 0);
+
 void LoadLastSaved(int i = 1);
 void SaveFirstSaved();
 void UndoSaveState();
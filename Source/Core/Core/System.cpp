@@ -3,10 +3,17 @@
 
 #include "Core/System.h"
 
+#include <memory>
+
+#include "AudioCommon/SoundStream.h"
+
 namespace Core
 {
 struct System::Impl
 {
+  std::unique_ptr<SoundStream> m_sound_stream;
+  bool m_sound_stream_running = false;
+  bool m_audio_dump_started = false;
 };
 
 System::System() : m_impl{std::make_unique<Impl>()}
@@ -14,4 +21,34 @@ System::System() : m_impl{std::make_unique<Impl>()}
 }
 
 System::~System() = default;
+
+SoundStream* System::GetSoundStream() const
+{
+  return m_impl->m_sound_stream.get();
+}
+
+void System::SetSoundStream(std::unique_ptr<SoundStream> sound_stream)
+{
+  m_impl->m_sound_stream = std::move(sound_stream);
+}
+
+bool System::IsSoundStreamRunning() const
+{
+  return m_impl->m_sound_stream_running;
+}
+
+void System::SetSoundStreamRunning(bool running)
+{
+  m_impl->m_sound_stream_running = running;
+}
+
+bool System::IsAudioDumpStarted() const
+{
+  return m_impl->m_audio_dump_started;
+}
+
+void System::SetAudioDumpStarted(bool started)
+{
+  m_impl->m_audio_dump_started = started;
+}
 }  // namespace Core
@@ -5,6 +5,8 @@
 
 #include <memory>
 
+class SoundStream;
+
 namespace Core
 {
 // Central class that encapsulates the running system.
@@ -26,6 +28,13 @@ public:
     return instance;
   }
 
+  SoundStream* GetSoundStream() const;
+  void SetSoundStream(std::unique_ptr<SoundStream> sound_stream);
+  bool IsSoundStreamRunning() const;
+  void SetSoundStreamRunning(bool running);
+  bool IsAudioDumpStarted() const;
+  void SetAudioDumpStarted(bool started);
+
 private:
   System();
 
@@ -61,6 +61,31 @@ constexpr u8 ENTRY_SIZE = 0x0c;
 constexpr u8 FILE_ENTRY = 0;
 constexpr u8 DIRECTORY_ENTRY = 1;
 
+File::IOFile* OpenFileCache::Open(const std::string& path)
+{
+  const auto it = std::find_if(m_files.begin(), m_files.end(),
+                               [&path](const auto& file) { return file.first == path; });
+  if (it != m_files.end())
+  {
+    m_files.splice(m_files.begin(), m_files, it);
+    return &m_files.front().second;
+  }
+
+  File::IOFile file(path, "rb");
+  if (!file)
+    return nullptr;
+
+  if (m_files.size() >= MAX_OPEN_FILES)
+    m_files.pop_back();
+  m_files.emplace_front(path, std::move(file));
+  return &m_files.front().second;
+}
+
+void OpenFileCache::Close(const std::string& path)
+{
+  m_files.remove_if([&path](const auto& file) { return file.first == path; });
+}
+
 DiscContent::DiscContent(u64 offset, u64 size, const std::string& path)
     : m_offset(offset), m_size(size), m_content_source(path)
 {
@@ -95,7 +120,7 @@ u64 DiscContent::GetSize() const
   return m_size;
 }
 
-bool DiscContent::Read(u64* offset, u64* length, u8** buffer) const
+bool DiscContent::Read(u64* offset, u64* length, u8** buffer, OpenFileCache* open_files) const
 {
   if (m_size == 0)
     return true;
@@ -109,9 +134,15 @@ bool DiscContent::Read(u64* offset, u64* length, u8** buffer) const
 
     if (std::holds_alternative<std::string>(m_content_source))
     {
-      File::IOFile file(std::get<std::string>(m_content_source), "rb");
-      if (!file.Seek(offset_in_content, SEEK_SET) || !file.ReadBytes(*buffer, bytes_to_read))
+      const std::string& path = std::get<std::string>(m_content_source);
+      File::IOFile* file = open_files->Open(path);
+      if (!file || !file->Seek(offset_in_content, SEEK_SET) ||
+          !file->ReadBytes(*buffer, bytes_to_read))
+      {
+        // Reopen the file next time in case it has been replaced in the meantime
+        open_files->Close(path);
         return false;
+      }
     }
     else if (std::holds_alternative<const u8*>(m_content_source))
     {
@@ -179,7 +210,7 @@ bool DiscContentContainer::Read(u64 offset, u64 length, u8* buffer) const
     // Zero fill to start of DiscContent data
     PadToAddress(it->GetOffset(), &offset, &length, &buffer);
 
-    if (!it->Read(&offset, &length, &buffer))
+    if (!it->Read(&offset, &length, &buffer, &m_open_files))
       return false;
 
     ++it;
@@ -792,19 +823,21 @@ void DirectoryBlobPartition::WriteDirectory(const File::FSTEntry& parent_entry,
                                             u32* name_offset, u64* data_offset,
                                             u32 parent_entry_index, u64 name_table_offset)
 {
-  std::vector<File::FSTEntry> sorted_entries = parent_entry.children;
+  // Sort for determinism. Only pointers are sorted, because copying the entries would copy
+  // everything below them too, and the uppercase names are only computed once per entry.
+  std::vector<std::pair<std::string, const File::FSTEntry*>> sorted_entries;
+  sorted_entries.reserve(parent_entry.children.size());
+  for (const File::FSTEntry& entry : parent_entry.children)
+    sorted_entries.emplace_back(ASCIIToUppercase(entry.virtualName), &entry);
 
-  // Sort for determinism
-  std::sort(sorted_entries.begin(), sorted_entries.end(),
-            [](const File::FSTEntry& one, const File::FSTEntry& two) {
-              const std::string one_upper = ASCIIToUppercase(one.virtualName);
-              const std::string two_upper = ASCIIToUppercase(two.virtualName);
-              return one_upper == two_upper ? one.virtualName < two.virtualName :
-                                              one_upper < two_upper;
-            });
+  std::sort(sorted_entries.begin(), sorted_entries.end(), [](const auto& one, const auto& two) {
+    return one.first == two.first ? one.second->virtualName < two.second->virtualName :
+                                    one.first < two.first;
+  });
 
-  for (const File::FSTEntry& entry : sorted_entries)
+  for (const auto& sorted_entry : sorted_entries)
   {
+    const File::FSTEntry& entry = *sorted_entry.second;
     if (entry.isDirectory)
     {
       u32 entry_index = *fst_offset / ENTRY_SIZE;
@@ -5,6 +5,7 @@
 
 #include <array>
 #include <cstddef>
+#include <list>
 #include <map>
 #include <memory>
 #include <optional>
@@ -15,13 +16,13 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/FileUtil.h"
+#include "Common/IOFile.h"
 #include "DiscIO/Blob.h"
 #include "DiscIO/WiiEncryptionCache.h"
 
 namespace File
 {
 struct FSTEntry;
-class IOFile;
 }  // namespace File
 
 namespace DiscIO
@@ -33,6 +34,22 @@ class DirectoryBlobReader;
 // Returns true if the path is inside a DirectoryBlob and doesn't represent the DirectoryBlob itself
 bool ShouldHideFromGameList(const std::string& volume_path);
 
+// Keeps the most recently read files open, as opening a file for every read is slow on some
+// file systems. The number of files is bounded so that huge games don't run out of handles.
+class OpenFileCache
+{
+public:
+  // Returns nullptr if the file can't be opened.
+  File::IOFile* Open(const std::string& path);
+  void Close(const std::string& path);
+
+private:
+  static constexpr size_t MAX_OPEN_FILES = 16;
+
+  // The most recently used file is first.
+  std::list<std::pair<std::string, File::IOFile>> m_files;
+};
+
 class DiscContent
 {
 public:
@@ -52,7 +69,7 @@ public:
   u64 GetOffset() const;
   u64 GetEndOffset() const;
   u64 GetSize() const;
-  bool Read(u64* offset, u64* length, u8** buffer) const;
+  bool Read(u64* offset, u64* length, u8** buffer, OpenFileCache* open_files) const;
 
   bool operator==(const DiscContent& other) const { return GetEndOffset() == other.GetEndOffset(); }
   bool operator!=(const DiscContent& other) const { return !(*this == other); }
@@ -85,6 +102,7 @@ public:
 
 private:
   std::set<DiscContent> m_contents;
+  mutable OpenFileCache m_open_files;
 };
 
 class DirectoryBlobPartition
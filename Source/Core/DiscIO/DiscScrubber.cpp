@@ -50,18 +50,34 @@ bool DiscScrubber::CanBlockBeScrubbed(u64 offset) const
   return m_is_scrubbing && m_free_table[offset / CLUSTER_SIZE];
 }
 
+u64 DiscScrubber::GetRunEnd(u64 offset, u64 end_offset) const
+{
+  if (!m_is_scrubbing || offset / CLUSTER_SIZE >= m_free_table.size())
+    return end_offset;
+
+  const size_t first_cluster = static_cast<size_t>(offset / CLUSTER_SIZE);
+  const size_t end_cluster = static_cast<size_t>(
+      std::min<u64>((end_offset + CLUSTER_SIZE - 1) / CLUSTER_SIZE, m_free_table.size()));
+
+  const auto begin = m_free_table.begin();
+  const auto run_end =
+      std::find(begin + first_cluster, begin + end_cluster, m_free_table[first_cluster] ^ 1);
+  return std::min<u64>(static_cast<u64>(run_end - begin) * CLUSTER_SIZE, end_offset);
+}
+
 void DiscScrubber::MarkAsUsed(u64 offset, u64 size)
 {
-  u64 current_offset = Common::AlignDown(offset, CLUSTER_SIZE);
-  const u64 end_offset = offset + size;
+  const u64 start_offset = Common::AlignDown(offset, CLUSTER_SIZE);
+  const u64 end_offset = std::min(offset + size, m_file_size);
 
-  DEBUG_LOG_FMT(DISCIO, "Marking {:#018x} - {:#018x} as used", offset, end_offset);
+  DEBUG_LOG_FMT(DISCIO, "Marking {:#018x} - {:#018x} as used", offset, offset + size);
 
-  while (current_offset < end_offset && current_offset < m_file_size)
-  {
-    m_free_table[current_offset / CLUSTER_SIZE] = 0;
-    current_offset += CLUSTER_SIZE;
-  }
+  if (start_offset >= end_offset)
+    return;
+
+  const auto begin = m_free_table.begin() + start_offset / CLUSTER_SIZE;
+  const auto end = m_free_table.begin() + (end_offset + CLUSTER_SIZE - 1) / CLUSTER_SIZE;
+  std::fill(begin, end, 0);
 }
 
 void DiscScrubber::MarkAsUsedE(u64 partition_data_offset, u64 offset, u64 size)
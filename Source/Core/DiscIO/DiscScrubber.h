@@ -33,6 +33,9 @@ public:
 
   // Returns true if the specified 32 KiB block only contains unused data
   bool CanBlockBeScrubbed(u64 offset) const;
+  // Returns where the run of 32 KiB blocks starting with the block at offset stops being all
+  // scrubbable or all used, capped to end_offset
+  u64 GetRunEnd(u64 offset, u64 end_offset) const;
 
   static constexpr size_t CLUSTER_SIZE = 0x8000;
 
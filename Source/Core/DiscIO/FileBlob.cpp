@@ -2,6 +2,9 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <limits>
 #include <memory>
 #include <string>
 #include <utility>
@@ -12,11 +15,118 @@
 #include "Common/MsgHandler.h"
 #include "DiscIO/FileBlob.h"
 
+#ifdef _WIN32
+#include <io.h>
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#ifdef __linux__
+#include <sys/vfs.h>
+#else
+#include <sys/mount.h>
+#include <sys/param.h>
+#endif
+#endif
+
 namespace DiscIO
 {
+// Reading a mapped file turns I/O errors into SIGBUS (or an in-page error on Windows) instead of
+// a failed read. Those are much more likely on network file systems, so only local files are
+// mapped.
+static bool IsOnLocalFileSystem(std::FILE* file)
+{
+#ifdef _WIN32
+  const HANDLE handle = reinterpret_cast<HANDLE>(_get_osfhandle(_fileno(file)));
+  if (handle == INVALID_HANDLE_VALUE)
+    return false;
+
+  // This only succeeds for files accessed through a network redirector.
+  FILE_REMOTE_PROTOCOL_INFO info;
+  return !GetFileInformationByHandleEx(handle, FileRemoteProtocolInfo, &info, sizeof(info));
+#elif defined(__linux__)
+  struct statfs fs;
+  if (fstatfs(fileno(file), &fs) != 0)
+    return false;
+
+  switch (static_cast<u32>(fs.f_type))
+  {
+  case 0x00006969:  // NFS
+  case 0x0000517B:  // SMB
+  case 0xFF534D42:  // CIFS
+  case 0xFE534D42:  // SMB2
+  case 0x01021997:  // 9P
+  case 0x00C36400:  // Ceph
+  case 0x5346414F:  // AFS
+  case 0x73757245:  // Coda
+  case 0x65735546:  // FUSE, which may be backed by anything
+    return false;
+  default:
+    return true;
+  }
+#else
+  struct statfs fs;
+  if (fstatfs(fileno(file), &fs) != 0)
+    return false;
+
+  return (fs.f_flags & MNT_LOCAL) != 0;
+#endif
+}
+
 PlainFileReader::PlainFileReader(File::IOFile file) : m_file(std::move(file))
 {
   m_size = m_file.GetSize();
+  MapFile();
+}
+
+PlainFileReader::~PlainFileReader()
+{
+  UnmapFile();
+}
+
+void PlainFileReader::MapFile()
+{
+  if (m_size <= 0 || static_cast<u64>(m_size) > std::numeric_limits<size_t>::max())
+    return;
+
+  if (!IsOnLocalFileSystem(m_file.GetHandle()))
+    return;
+
+#ifdef _WIN32
+  const HANDLE file = reinterpret_cast<HANDLE>(_get_osfhandle(_fileno(m_file.GetHandle())));
+  if (file == INVALID_HANDLE_VALUE)
+    return;
+
+  m_mapping_handle = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (!m_mapping_handle)
+    return;
+
+  m_mapped_data = static_cast<const u8*>(MapViewOfFile(m_mapping_handle, FILE_MAP_READ, 0, 0, 0));
+  if (!m_mapped_data)
+  {
+    CloseHandle(m_mapping_handle);
+    m_mapping_handle = nullptr;
+  }
+#else
+  void* data = mmap(nullptr, static_cast<size_t>(m_size), PROT_READ, MAP_SHARED,
+                    fileno(m_file.GetHandle()), 0);
+  if (data != MAP_FAILED)
+    m_mapped_data = static_cast<const u8*>(data);
+#endif
+}
+
+void PlainFileReader::UnmapFile()
+{
+  if (!m_mapped_data)
+    return;
+
+#ifdef _WIN32
+  UnmapViewOfFile(m_mapped_data);
+  CloseHandle(m_mapping_handle);
+  m_mapping_handle = nullptr;
+#else
+  munmap(const_cast<u8*>(m_mapped_data), static_cast<size_t>(m_size));
+#endif
+  m_mapped_data = nullptr;
 }
 
 std::unique_ptr<PlainFileReader> PlainFileReader::Create(File::IOFile file)
@@ -29,6 +139,16 @@ std::unique_ptr<PlainFileReader> PlainFileReader::Create(File::IOFile file)
 
 bool PlainFileReader::Read(u64 offset, u64 nbytes, u8* out_ptr)
 {
+  if (m_mapped_data)
+  {
+    const u64 size = static_cast<u64>(m_size);
+    if (offset > size || nbytes > size - offset)
+      return false;
+
+    std::memcpy(out_ptr, m_mapped_data + offset, nbytes);
+    return true;
+  }
+
   if (m_file.Seek(offset, SEEK_SET) && m_file.ReadBytes(out_ptr, nbytes))
   {
     return true;
@@ -93,7 +213,14 @@ bool ConvertToPlain(BlobReader* infile, const std::string& infile_path,
       success = false;
       break;
     }
-    if (!outfile.WriteBytes(buffer.data(), sz))
+
+    // Leave a hole instead of writing blocks that are all zero (such as scrubbed data), so that
+    // the output is a sparse file on file systems that support it
+    const bool write_succeeded =
+        std::all_of(buffer.begin(), buffer.begin() + sz, [](u8 b) { return b == 0; }) ?
+            outfile.Seek(sz, SEEK_CUR) :
+            outfile.WriteBytes(buffer.data(), sz);
+    if (!write_succeeded)
     {
       PanicAlertFmtT("Failed to write the output file \"{0}\".\n"
                      "Check that you have enough space available on the target drive.",
@@ -103,6 +230,15 @@ bool ConvertToPlain(BlobReader* infile, const std::string& infile_path,
     }
   }
 
+  // If the data ended with a hole, nothing has been written to extend the file to its full size
+  if (success && (!outfile.Flush() || !outfile.Resize(infile->GetDataSize())))
+  {
+    PanicAlertFmtT("Failed to write the output file \"{0}\".\n"
+                   "Check that you have enough space available on the target drive.",
+                   outfile_path);
+    success = false;
+  }
+
   if (!success)
   {
     // Remove the incomplete output file.
@@ -17,6 +17,7 @@ class PlainFileReader : public BlobReader
 {
 public:
   static std::unique_ptr<PlainFileReader> Create(File::IOFile file);
+  ~PlainFileReader() override;
 
   BlobType GetBlobType() const override { return BlobType::PLAIN; }
 
@@ -33,8 +34,18 @@ public:
 private:
   PlainFileReader(File::IOFile file);
 
+  // Maps the whole file into memory if it is on a local file system, so that reads are a memcpy
+  // instead of a seek and a read. Reads go through m_file otherwise, or if mapping fails.
+  void MapFile();
+  void UnmapFile();
+
   File::IOFile m_file;
   s64 m_size;
+
+  const u8* m_mapped_data = nullptr;
+#ifdef _WIN32
+  void* m_mapping_handle = nullptr;
+#endif
 };
 
 }  // namespace DiscIO
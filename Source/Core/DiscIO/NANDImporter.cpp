@@ -8,8 +8,8 @@
 #include <cstring>
 
 #include <fmt/format.h>
+#include <mbedtls/aes.h>
 
-#include "Common/Crypto/AES.h"
 #include "Common/FileUtil.h"
 #include "Common/IOFile.h"
 #include "Common/Logging/Log.h"
@@ -179,17 +179,21 @@ void NANDImporter::ProcessFile(const NANDFSTEntry& entry, const std::string& par
 
   const std::string path = GetPath(entry, parent_path);
   File::IOFile file(path, "wb");
-  std::array<u8, 16> key{};
-  std::copy(&m_nand_keys[NAND_AES_KEY_OFFSET], &m_nand_keys[NAND_AES_KEY_OFFSET + key.size()],
-            key.begin());
+
+  // The key schedule is shared by all blocks of the file, and so is the output buffer.
+  mbedtls_aes_context aes_context;
+  mbedtls_aes_setkey_dec(&aes_context, &m_nand_keys[NAND_AES_KEY_OFFSET], 128);
+  std::vector<u8> block(NAND_FAT_BLOCK_SIZE);
+
   u16 sub = Common::swap16(entry.sub);
   u32 remaining_bytes = Common::swap32(entry.size);
 
   while (remaining_bytes > 0)
   {
+    // Every block is encrypted separately, with an IV of zero.
     std::array<u8, 16> iv{};
-    std::vector<u8> block = Common::AES::Decrypt(
-        key.data(), iv.data(), &m_nand[NAND_FAT_BLOCK_SIZE * sub], NAND_FAT_BLOCK_SIZE);
+    mbedtls_aes_crypt_cbc(&aes_context, MBEDTLS_AES_DECRYPT, NAND_FAT_BLOCK_SIZE, iv.data(),
+                          &m_nand[NAND_FAT_BLOCK_SIZE * sub], block.data());
     u32 size = remaining_bytes < NAND_FAT_BLOCK_SIZE ? remaining_bytes : NAND_FAT_BLOCK_SIZE;
     file.WriteBytes(block.data(), size);
     remaining_bytes -= size;
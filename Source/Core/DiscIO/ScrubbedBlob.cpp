@@ -8,7 +8,6 @@
 #include <string>
 #include <utility>
 
-#include "Common/Align.h"
 #include "DiscIO/Blob.h"
 #include "DiscIO/DiscScrubber.h"
 #include "DiscIO/VolumeDisc.h"
@@ -41,9 +40,9 @@ bool ScrubbedBlob::Read(u64 offset, u64 size, u8* out_ptr)
 {
   while (size > 0)
   {
-    constexpr size_t CLUSTER_SIZE = DiscScrubber::CLUSTER_SIZE;
-    const u64 bytes_to_read =
-        std::min(Common::AlignDown(offset + CLUSTER_SIZE, CLUSTER_SIZE) - offset, size);
+    // Handle all the consecutive blocks that are scrubbed or not at once, so that a large read
+    // isn't split into a read of the underlying blob for every block.
+    const u64 bytes_to_read = m_scrubber.GetRunEnd(offset, offset + size) - offset;
 
     if (m_scrubber.CanBlockBeScrubbed(offset))
     {
@@ -10,6 +10,7 @@
 #include <optional>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <unordered_set>
 
 #include <mbedtls/md5.h>
@@ -1206,14 +1207,48 @@ void VolumeVerifier::Process()
     m_group_future = std::async(std::launch::async, [this, read_succeeded,
                                                      group_index = m_group_index] {
       const GroupToVerify& group = m_groups[group_index];
+      const size_t num_blocks = group.block_index_end - group.block_index_start;
+
+      // Decrypting and hashing the blocks is independent per block, so it's spread over threads.
+      std::vector<u8> blocks_valid(num_blocks);
+      const auto check_blocks = [this, &group, &blocks_valid, read_succeeded](size_t start,
+                                                                              size_t end) {
+        for (size_t i = start; i < end; ++i)
+        {
+          blocks_valid[i] =
+              read_succeeded &&
+              m_volume.CheckBlockIntegrity(group.block_index_start + i,
+                                           m_data.data() + i * VolumeWii::BLOCK_TOTAL_SIZE,
+                                           group.partition);
+        }
+      };
+
+      // The first block is checked on its own, since checking it loads the partition key and
+      // H3 table, which are lazily initialized without locking.
+      const size_t first_blocks = std::min<size_t>(1, num_blocks);
+      check_blocks(0, first_blocks);
+
+      const size_t remaining_blocks = num_blocks - first_blocks;
+      const size_t threads = std::min<size_t>(
+          remaining_blocks, std::max<unsigned int>(1, std::thread::hardware_concurrency()));
+      std::vector<std::future<void>> check_futures;
+      for (size_t i = 1; i < threads; ++i)
+      {
+        check_futures.push_back(std::async(std::launch::async, check_blocks,
+                                           first_blocks + i * remaining_blocks / threads,
+                                           first_blocks + (i + 1) * remaining_blocks / threads));
+      }
+      if (threads > 0)
+        check_blocks(first_blocks, first_blocks + remaining_blocks / threads);
+      for (std::future<void>& future : check_futures)
+        future.get();
+
       u64 offset_in_group = 0;
-      for (u64 block_index = group.block_index_start; block_index < group.block_index_end;
-           ++block_index, offset_in_group += VolumeWii::BLOCK_TOTAL_SIZE)
+      for (size_t i = 0; i < num_blocks; ++i, offset_in_group += VolumeWii::BLOCK_TOTAL_SIZE)
       {
         const u64 block_offset = group.offset + offset_in_group;
 
-        if (read_succeeded && m_volume.CheckBlockIntegrity(
-                                  block_index, m_data.data() + offset_in_group, group.partition))
+        if (blocks_valid[i])
         {
           m_biggest_verified_offset =
               std::max(m_biggest_verified_offset, block_offset + VolumeWii::BLOCK_TOTAL_SIZE);
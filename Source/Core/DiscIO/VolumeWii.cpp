@@ -191,6 +191,20 @@ bool VolumeWii::Read(u64 offset, u64 length, u8* buffer, const Partition& partit
                                offset / BLOCK_DATA_SIZE * BLOCK_TOTAL_SIZE;
     u64 data_offset_in_block = offset % BLOCK_DATA_SIZE;
 
+    // Whole blocks don't need to go through m_last_decrypted_block_data.
+    if (data_offset_in_block == 0 && length >= BLOCK_DATA_SIZE)
+    {
+      const u64 num_blocks = std::min<u64>(length / BLOCK_DATA_SIZE, BLOCKS_PER_GROUP);
+      if (!ReadAndDecryptBlocks(block_offset_on_disc, num_blocks, buffer, aes_context))
+        return false;
+
+      const u64 read_size = num_blocks * BLOCK_DATA_SIZE;
+      length -= read_size;
+      buffer += read_size;
+      offset += read_size;
+      continue;
+    }
+
     if (m_last_decrypted_block != block_offset_on_disc)
     {
       // Read the current block
@@ -216,6 +230,48 @@ bool VolumeWii::Read(u64 offset, u64 length, u8* buffer, const Partition& partit
   return true;
 }
 
+bool VolumeWii::ReadAndDecryptBlocks(u64 block_offset_on_disc, u64 num_blocks, u8* out_ptr,
+                                     mbedtls_aes_context* aes_context) const
+{
+  m_encrypted_blocks_buffer.resize(num_blocks * BLOCK_TOTAL_SIZE);
+  if (!m_reader->Read(block_offset_on_disc, m_encrypted_blocks_buffer.size(),
+                      m_encrypted_blocks_buffer.data()))
+  {
+    return false;
+  }
+
+  const auto decrypt = [this, out_ptr, aes_context](u64 start, u64 end) {
+    for (u64 i = start; i < end; ++i)
+    {
+      DecryptBlockData(m_encrypted_blocks_buffer.data() + i * BLOCK_TOTAL_SIZE,
+                       out_ptr + i * BLOCK_DATA_SIZE, aes_context);
+    }
+  };
+
+  // Starting threads only pays off when there are enough blocks for each of them.
+  constexpr u64 MIN_BLOCKS_PER_THREAD = 8;
+  const u64 threads = std::min<u64>(num_blocks / MIN_BLOCKS_PER_THREAD,
+                                    std::max<unsigned int>(1, std::thread::hardware_concurrency()));
+  if (threads <= 1)
+  {
+    decrypt(0, num_blocks);
+    return true;
+  }
+
+  std::vector<std::future<void>> decryption_futures(threads - 1);
+  for (u64 i = 1; i < threads; ++i)
+  {
+    decryption_futures[i - 1] = std::async(std::launch::async, decrypt, i * num_blocks / threads,
+                                           (i + 1) * num_blocks / threads);
+  }
+  decrypt(0, num_blocks / threads);
+
+  for (std::future<void>& future : decryption_futures)
+    future.get();
+
+  return true;
+}
+
 bool VolumeWii::IsEncryptedAndHashed() const
 {
   return m_encrypted;
@@ -126,6 +126,11 @@ private:
     u32 type;
   };
 
+  // Reads whole blocks in one call to the blob reader and decrypts them straight into out_ptr,
+  // spreading the decryption of large reads over several threads.
+  bool ReadAndDecryptBlocks(u64 block_offset_on_disc, u64 num_blocks, u8* out_ptr,
+                            mbedtls_aes_context* aes_context) const;
+
   std::unique_ptr<BlobReader> m_reader;
   std::map<Partition, PartitionDetails> m_partitions;
   Partition m_game_partition;
@@ -133,6 +138,7 @@ private:
 
   mutable u64 m_last_decrypted_block;
   mutable u8 m_last_decrypted_block_data[BLOCK_DATA_SIZE];
+  mutable std::vector<u8> m_encrypted_blocks_buffer;
 };
 
 }  // namespace DiscIO
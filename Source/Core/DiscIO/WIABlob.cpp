@@ -93,7 +93,8 @@ bool WIARVZFileReader<RVZ>::Initialize(const std::string& path)
   if ((!RVZ && m_header_1.magic != WIA_MAGIC) || (RVZ && m_header_1.magic != RVZ_MAGIC))
     return false;
 
-  const u32 version = RVZ ? RVZ_VERSION : WIA_VERSION;
+  // RVZ files with a Zstandard dictionary have the newest version which can be read.
+  const u32 version = RVZ ? RVZ_DICTIONARY_VERSION : WIA_VERSION;
   const u32 version_read_compatible =
       RVZ ? RVZ_VERSION_READ_COMPATIBLE : WIA_VERSION_READ_COMPATIBLE;
 
@@ -140,6 +141,9 @@ bool WIARVZFileReader<RVZ>::Initialize(const std::string& path)
     return false;
   }
 
+  if (RVZ && header_2.size() > sizeof(WIAHeader2))
+    m_zstd_dictionary.assign(header_2.begin() + sizeof(WIAHeader2), header_2.end());
+
   const u32 chunk_size = Common::swap32(m_header_2.chunk_size);
   const auto is_power_of_two = [](u32 x) { return (x & (x - 1)) == 0; };
   if ((!RVZ || chunk_size < VolumeWii::BLOCK_TOTAL_SIZE || !is_power_of_two(chunk_size)) &&
@@ -533,11 +537,11 @@ bool WIARVZFileReader<RVZ>::ReadFromGroups(u64* offset, u64* size, u8** out_ptr,
 
       Chunk& chunk =
           ReadCompressedData(group_offset_in_file, group_data_size, chunk_size, compression_type,
-                             exception_lists, rvz_packed_size, group_offset_in_data);
+                             exception_lists, rvz_packed_size, group_offset_in_data, true);
 
       if (!chunk.Read(offset_in_group, bytes_to_read, *out_ptr))
       {
-        m_cached_chunk_offset = std::numeric_limits<u64>::max();  // Invalidate the cache
+        InvalidateCachedChunk(group_offset_in_file);
         return false;
       }
 
@@ -565,10 +569,15 @@ typename WIARVZFileReader<RVZ>::Chunk&
 WIARVZFileReader<RVZ>::ReadCompressedData(u64 offset_in_file, u64 compressed_size,
                                           u64 decompressed_size,
                                           WIARVZCompressionType compression_type,
-                                          u32 exception_lists, u32 rvz_packed_size, u64 data_offset)
+                                          u32 exception_lists, u32 rvz_packed_size, u64 data_offset,
+                                          bool use_dictionary)
 {
-  if (offset_in_file == m_cached_chunk_offset)
-    return m_cached_chunk;
+  const auto cached = m_cached_chunk_map.find(offset_in_file);
+  if (cached != m_cached_chunk_map.end())
+  {
+    m_cached_chunks.splice(m_cached_chunks.begin(), m_cached_chunks, cached->second);
+    return cached->second->chunk;
+  }
 
   std::unique_ptr<Decompressor> decompressor;
   switch (compression_type)
@@ -592,17 +601,44 @@ WIARVZFileReader<RVZ>::ReadCompressedData(u64 offset_in_file, u64 compressed_siz
                                                       m_header_2.compressor_data_size);
     break;
   case WIARVZCompressionType::Zstd:
-    decompressor = std::make_unique<ZstdDecompressor>();
+    if (use_dictionary)
+    {
+      decompressor =
+          std::make_unique<ZstdDecompressor>(m_zstd_dictionary.data(), m_zstd_dictionary.size());
+    }
+    else
+    {
+      decompressor = std::make_unique<ZstdDecompressor>();
+    }
     break;
   }
 
   const bool compressed_exception_lists = compression_type > WIARVZCompressionType::Purge;
 
-  m_cached_chunk =
-      Chunk(&m_file, offset_in_file, compressed_size, decompressed_size, exception_lists,
-            compressed_exception_lists, rvz_packed_size, data_offset, std::move(decompressor));
-  m_cached_chunk_offset = offset_in_file;
-  return m_cached_chunk;
+  Chunk chunk(&m_file, offset_in_file, compressed_size, decompressed_size, exception_lists,
+              compressed_exception_lists, rvz_packed_size, data_offset, std::move(decompressor));
+  const size_t memory_size = chunk.GetMemorySize();
+  m_cached_chunks.push_front(CachedChunk{offset_in_file, memory_size, std::move(chunk)});
+  m_cached_chunk_map.emplace(offset_in_file, m_cached_chunks.begin());
+  m_cached_chunks_size += memory_size;
+
+  // Evict the least recently used chunks, but always keep the one that is about to be used.
+  while (m_cached_chunks_size > MAX_CACHED_CHUNKS_SIZE && m_cached_chunks.size() > 1)
+    InvalidateCachedChunk(m_cached_chunks.back().offset_in_file);
+
+  return m_cached_chunks.front().chunk;
+}
+
+template <bool RVZ>
+void WIARVZFileReader<RVZ>::InvalidateCachedChunk(u64 offset_in_file)
+{
+  const auto it = m_cached_chunk_map.find(offset_in_file);
+  if (it == m_cached_chunk_map.end())
+    return;
+
+  m_cached_chunks_size -= it->second->memory_size;
+  m_cached_chunks.erase(it->second);
+  m_cached_chunk_map.erase(it);
 }
 
 template <bool RVZ>
@@ -1056,7 +1092,8 @@ std::optional<std::vector<u8>> WIARVZFileReader<RVZ>::Compress(Compressor* compr
 template <bool RVZ>
 void WIARVZFileReader<RVZ>::SetUpCompressor(std::unique_ptr<Compressor>* compressor,
                                             WIARVZCompressionType compression_type,
-                                            int compression_level, WIAHeader2* header_2)
+                                            int compression_level, WIAHeader2* header_2,
+                                            const std::vector<u8>& zstd_dictionary)
 {
   switch (compression_type)
   {
@@ -1087,7 +1124,8 @@ void WIARVZFileReader<RVZ>::SetUpCompressor(std::unique_ptr<Compressor>* compres
     break;
   }
   case WIARVZCompressionType::Zstd:
-    *compressor = std::make_unique<ZstdCompressor>(compression_level);
+    *compressor = std::make_unique<ZstdCompressor>(compression_level, zstd_dictionary.data(),
+                                                   zstd_dictionary.size());
     break;
   }
 }
@@ -1630,6 +1668,27 @@ WIARVZFileReader<RVZ>::ProcessAndCompress(CompressThreadState* state, CompressPa
       if (compressed_exception_lists)
         entry.exception_lists.clear();
     }
+
+    // Groups whose stored data is identical can share it no matter where they are on the disc,
+    // except for RVZ packed data, whose junk depends on the offset it is read from. Partition
+    // data is kept apart from raw data, since only the former starts with hash exceptions.
+    bool can_share_content = true;
+    if constexpr (RVZ)
+      can_share_content = entry.rvz_packed_size == 0;
+    if (can_share_content)
+    {
+      const u8 is_partition = parameters.data_entry->is_partition;
+      mbedtls_sha1_context sha1_context;
+      mbedtls_sha1_init(&sha1_context);
+      mbedtls_sha1_starts_ret(&sha1_context);
+      mbedtls_sha1_update_ret(&sha1_context, &is_partition, sizeof(is_partition));
+      mbedtls_sha1_update_ret(&sha1_context, entry.exception_lists.data(),
+                              entry.exception_lists.size());
+      mbedtls_sha1_update_ret(&sha1_context, entry.main_data.data(), entry.main_data.size());
+      entry.content_hash.emplace();
+      mbedtls_sha1_finish_ret(&sha1_context, entry.content_hash->data());
+      mbedtls_sha1_free(&sha1_context);
+    }
   }
 
   return OutputParameters{std::move(output_entries), parameters.bytes_read, parameters.group_index};
@@ -1640,6 +1699,7 @@ ConversionResultCode WIARVZFileReader<RVZ>::Output(std::vector<OutputParametersE
                                                    File::IOFile* outfile,
                                                    std::map<ReuseID, GroupEntry>* reusable_groups,
                                                    std::mutex* reusable_groups_mutex,
+                                                   std::map<SHA1, GroupEntry>* content_groups,
                                                    GroupEntry* group_entry, u64* bytes_written)
 {
   for (OutputParametersEntry& entry : *entries)
@@ -1652,12 +1712,6 @@ ConversionResultCode WIARVZFileReader<RVZ>::Output(std::vector<OutputParametersE
       continue;
     }
 
-    if (*bytes_written >> 2 > std::numeric_limits<u32>::max())
-      return ConversionResultCode::InternalError;
-
-    ASSERT((*bytes_written & 3) == 0);
-    group_entry->data_offset = Common::swap32(static_cast<u32>(*bytes_written >> 2));
-
     u32 data_size = static_cast<u32>(entry.exception_lists.size() + entry.main_data.size());
     if constexpr (RVZ)
     {
@@ -1666,6 +1720,23 @@ ConversionResultCode WIARVZFileReader<RVZ>::Output(std::vector<OutputParametersE
     }
     group_entry->data_size = Common::swap32(data_size);
 
+    if (entry.content_hash)
+    {
+      const auto it = content_groups->find(*entry.content_hash);
+      if (it != content_groups->end() && it->second.data_size == group_entry->data_size)
+      {
+        *group_entry = it->second;
+        ++group_entry;
+        continue;
+      }
+    }
+
+    if (*bytes_written >> 2 > std::numeric_limits<u32>::max())
+      return ConversionResultCode::InternalError;
+
+    ASSERT((*bytes_written & 3) == 0);
+    group_entry->data_offset = Common::swap32(static_cast<u32>(*bytes_written >> 2));
+
     if (!outfile->WriteArray(entry.exception_lists.data(), entry.exception_lists.size()))
       return ConversionResultCode::WriteFailed;
     if (!outfile->WriteArray(entry.main_data.data(), entry.main_data.size()))
@@ -1679,6 +1750,9 @@ ConversionResultCode WIARVZFileReader<RVZ>::Output(std::vector<OutputParametersE
       reusable_groups->emplace(*entry.reuse_id, *group_entry);
     }
 
+    if (entry.content_hash)
+      content_groups->emplace(*entry.content_hash, *group_entry);
+
     if (!PadTo4(outfile, bytes_written))
       return ConversionResultCode::WriteFailed;
 
@@ -1728,11 +1802,67 @@ bool WIARVZFileReader<RVZ>::WriteHeader(File::IOFile* file, const u8* data, size
   return PadTo4(file, bytes_written);
 }
 
+static void GetFiles(const FileInfo& directory, std::vector<std::pair<u64, u32>>* files)
+{
+  for (const FileInfo& file_info : directory)
+  {
+    if (file_info.IsDirectory())
+      GetFiles(file_info, files);
+    else if (file_info.GetSize() != 0)
+      files->emplace_back(file_info.GetOffset(), file_info.GetSize());
+  }
+}
+
+template <bool RVZ>
+std::vector<u8> WIARVZFileReader<RVZ>::CreateZstdDictionary(const VolumeDisc& volume)
+{
+  const Partition partition = volume.GetGamePartition();
+  const FileSystem* file_system = volume.GetFileSystem(partition);
+  if (!file_system || !file_system->IsValid())
+    return {};
+
+  std::vector<std::pair<u64, u32>> files;
+  GetFiles(file_system->GetRoot(), &files);
+
+  u64 total_size = 0;
+  for (const auto& file : files)
+    total_size += file.second;
+  if (total_size < ZSTD_DICTIONARY_SAMPLES * ZSTD_DICTIONARY_SAMPLE_SIZE)
+    return {};
+
+  // The dictionary is used as raw content, so it's made of samples spread evenly over the files.
+  std::vector<u8> dictionary;
+  dictionary.reserve(ZSTD_DICTIONARY_SAMPLES * ZSTD_DICTIONARY_SAMPLE_SIZE);
+  auto file = files.cbegin();
+  u64 file_start = 0;
+  for (size_t i = 0; i < ZSTD_DICTIONARY_SAMPLES; ++i)
+  {
+    const u64 position = i * total_size / ZSTD_DICTIONARY_SAMPLES;
+    while (position >= file_start + file->second)
+    {
+      file_start += file->second;
+      ++file;
+    }
+
+    const u64 offset_in_file = position - file_start;
+    const u64 size = std::min<u64>(ZSTD_DICTIONARY_SAMPLE_SIZE, file->second - offset_in_file);
+    const size_t old_size = dictionary.size();
+    dictionary.resize(old_size + size);
+    if (!volume.Read(file->first + offset_in_file, size, dictionary.data() + old_size, partition))
+      dictionary.resize(old_size);
+  }
+
+  // Keeps the headers that are written after the dictionary aligned.
+  dictionary.resize(Common::AlignDown(dictionary.size(), 4));
+  return dictionary;
+}
+
 template <bool RVZ>
 ConversionResultCode
 WIARVZFileReader<RVZ>::Convert(BlobReader* infile, const VolumeDisc* infile_volume,
                                File::IOFile* outfile, WIARVZCompressionType compression_type,
-                               int compression_level, int chunk_size, CompressCB callback)
+                               int compression_level, int chunk_size, bool use_zstd_dictionary,
+                               CompressCB callback)
 {
   ASSERT(infile->IsDataSizeAccurate());
   ASSERT(chunk_size > 0);
@@ -1768,6 +1898,16 @@ WIARVZFileReader<RVZ>::Convert(BlobReader* infile, const VolumeDisc* infile_volu
 
   group_entries.resize(total_groups);
 
+  // Small chunks compress poorly on their own, so they can get a dictionary built from the disc.
+  // Older versions of Dolphin can't read files with a dictionary, so this is opt-in.
+  std::vector<u8> zstd_dictionary;
+  if (RVZ && use_zstd_dictionary && compression_type == WIARVZCompressionType::Zstd &&
+      static_cast<u64>(chunk_size) < VolumeWii::GROUP_TOTAL_SIZE && infile_volume)
+  {
+    zstd_dictionary = CreateZstdDictionary(*infile_volume);
+  }
+  const u64 header_2_size = sizeof(WIAHeader2) + zstd_dictionary.size();
+
   const size_t partition_entries_size = partition_entries.size() * sizeof(PartitionEntry);
   const size_t raw_data_entries_size = raw_data_entries.size() * sizeof(RawDataEntry);
   const size_t group_entries_size = group_entries.size() * sizeof(GroupEntry);
@@ -1777,7 +1917,7 @@ WIARVZFileReader<RVZ>::Convert(BlobReader* infile, const VolumeDisc* infile_volu
   // fit on that space, we will need to write them at the end of the file instead.
   const u64 headers_size_upper_bound = [&] {
     // 0x100 is added to account for compression overhead (in particular for Purge).
-    u64 upper_bound = sizeof(WIAHeader1) + sizeof(WIAHeader2) + partition_entries_size +
+    u64 upper_bound = sizeof(WIAHeader1) + header_2_size + partition_entries_size +
                       raw_data_entries_size + 0x100;
 
     // RVZ's added data in GroupEntry usually compresses well, so we'll assume the compression ratio
@@ -1805,9 +1945,12 @@ WIARVZFileReader<RVZ>::Convert(BlobReader* infile, const VolumeDisc* infile_volu
 
   std::map<ReuseID, GroupEntry> reusable_groups;
   std::mutex reusable_groups_mutex;
+  // Only accessed from the output thread, so it needs no mutex.
+  std::map<SHA1, GroupEntry> content_groups;
 
   const auto set_up_compress_thread_state = [&](CompressThreadState* state) {
-    SetUpCompressor(&state->compressor, compression_type, compression_level, nullptr);
+    SetUpCompressor(&state->compressor, compression_type, compression_level, nullptr,
+                    zstd_dictionary);
     return ConversionResultCode::Success;
   };
 
@@ -1828,7 +1971,7 @@ WIARVZFileReader<RVZ>::Convert(BlobReader* infile, const VolumeDisc* infile_volu
   const auto output = [&](OutputParameters parameters) {
     const ConversionResultCode result =
         Output(&parameters.entries, outfile, &reusable_groups, &reusable_groups_mutex,
-               &group_entries[parameters.group_index], &bytes_written);
+               &content_groups, &group_entries[parameters.group_index], &bytes_written);
 
     if (result != ConversionResultCode::Success)
       return result;
@@ -1936,7 +2079,7 @@ WIARVZFileReader<RVZ>::Convert(BlobReader* infile, const VolumeDisc* infile_volu
     return status;
 
   std::unique_ptr<Compressor> compressor;
-  SetUpCompressor(&compressor, compression_type, compression_level, &header_2);
+  SetUpCompressor(&compressor, compression_type, compression_level, &header_2, {});
 
   const std::optional<std::vector<u8>> compressed_raw_data_entries = Compress(
       compressor.get(), reinterpret_cast<u8*>(raw_data_entries.data()), raw_data_entries_size);
@@ -1948,8 +2091,8 @@ WIARVZFileReader<RVZ>::Convert(BlobReader* infile, const VolumeDisc* infile_volu
   if (!compressed_group_entries)
     return ConversionResultCode::InternalError;
 
-  bytes_written = sizeof(WIAHeader1) + sizeof(WIAHeader2);
-  if (!outfile->Seek(sizeof(WIAHeader1) + sizeof(WIAHeader2), SEEK_SET))
+  bytes_written = sizeof(WIAHeader1) + header_2_size;
+  if (!outfile->Seek(sizeof(WIAHeader1) + header_2_size, SEEK_SET))
     return ConversionResultCode::WriteFailed;
 
   u64 partition_entries_offset;
@@ -2007,12 +2150,28 @@ WIARVZFileReader<RVZ>::Convert(BlobReader* infile, const VolumeDisc* infile_volu
   header_2.group_entries_size = Common::swap32(static_cast<u32>(compressed_group_entries->size()));
 
   header_1.magic = RVZ ? RVZ_MAGIC : WIA_MAGIC;
-  header_1.version = Common::swap32(RVZ ? RVZ_VERSION : WIA_VERSION);
-  header_1.version_compatible =
-      Common::swap32(RVZ ? RVZ_VERSION_WRITE_COMPATIBLE : WIA_VERSION_WRITE_COMPATIBLE);
-  header_1.header_2_size = Common::swap32(sizeof(WIAHeader2));
-  mbedtls_sha1_ret(reinterpret_cast<const u8*>(&header_2), sizeof(header_2),
-                   header_1.header_2_hash.data());
+  if (!zstd_dictionary.empty())
+  {
+    header_1.version = Common::swap32(RVZ_DICTIONARY_VERSION);
+    header_1.version_compatible = Common::swap32(RVZ_DICTIONARY_VERSION);
+  }
+  else
+  {
+    header_1.version = Common::swap32(RVZ ? RVZ_VERSION : WIA_VERSION);
+    header_1.version_compatible =
+        Common::swap32(RVZ ? RVZ_VERSION_WRITE_COMPATIBLE : WIA_VERSION_WRITE_COMPATIBLE);
+  }
+  header_1.header_2_size = Common::swap32(static_cast<u32>(header_2_size));
+
+  mbedtls_sha1_context sha1_context;
+  mbedtls_sha1_init(&sha1_context);
+  mbedtls_sha1_starts_ret(&sha1_context);
+  mbedtls_sha1_update_ret(&sha1_context, reinterpret_cast<const u8*>(&header_2),
+                          sizeof(header_2));
+  mbedtls_sha1_update_ret(&sha1_context, zstd_dictionary.data(), zstd_dictionary.size());
+  mbedtls_sha1_finish_ret(&sha1_context, header_1.header_2_hash.data());
+  mbedtls_sha1_free(&sha1_context);
+
   header_1.iso_file_size = Common::swap64(infile->GetDataSize());
   header_1.wia_file_size = Common::swap64(outfile->GetSize());
   mbedtls_sha1_ret(reinterpret_cast<const u8*>(&header_1), offsetof(WIAHeader1, header_1_hash),
@@ -2025,6 +2184,8 @@ WIARVZFileReader<RVZ>::Convert(BlobReader* infile, const VolumeDisc* infile_volu
     return ConversionResultCode::WriteFailed;
   if (!outfile->WriteArray(&header_2, 1))
     return ConversionResultCode::WriteFailed;
+  if (!outfile->WriteArray(zstd_dictionary.data(), zstd_dictionary.size()))
+    return ConversionResultCode::WriteFailed;
 
   return ConversionResultCode::Success;
 }
@@ -2032,7 +2193,7 @@ WIARVZFileReader<RVZ>::Convert(BlobReader* infile, const VolumeDisc* infile_volu
 bool ConvertToWIAOrRVZ(BlobReader* infile, const std::string& infile_path,
                        const std::string& outfile_path, bool rvz,
                        WIARVZCompressionType compression_type, int compression_level,
-                       int chunk_size, CompressCB callback)
+                       int chunk_size, bool use_zstd_dictionary, CompressCB callback)
 {
   File::IOFile outfile(outfile_path, "wb");
   if (!outfile)
@@ -2050,7 +2211,7 @@ bool ConvertToWIAOrRVZ(BlobReader* infile, const std::string& infile_path,
   const auto convert = rvz ? RVZFileReader::Convert : WIAFileReader::Convert;
   const ConversionResultCode result =
       convert(infile, infile_volume.get(), &outfile, compression_type, compression_level,
-              chunk_size, callback);
+              chunk_size, use_zstd_dictionary, callback);
 
   if (result == ConversionResultCode::ReadFailed)
     PanicAlertFmtT("Failed to read from the input file \"{0}\".", infile_path);
@@ -5,6 +5,7 @@
 
 #include <array>
 #include <limits>
+#include <list>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -63,7 +64,8 @@ public:
 
   static ConversionResultCode Convert(BlobReader* infile, const VolumeDisc* infile_volume,
                                       File::IOFile* outfile, WIARVZCompressionType compression_type,
-                                      int compression_level, int chunk_size, CompressCB callback);
+                                      int compression_level, int chunk_size,
+                                      bool use_zstd_dictionary, CompressCB callback);
 
 private:
   using SHA1 = std::array<u8, 20>;
@@ -186,6 +188,9 @@ private:
 
     bool Read(u64 offset, u64 size, u8* out_ptr);
 
+    // The amount of memory used by the compressed and decompressed data buffers.
+    size_t GetMemorySize() const { return m_in.data.size() + m_out.data.size(); }
+
     // This can only be called once at least one byte of data has been read
     void GetHashExceptions(std::vector<HashExceptionEntry>* exception_list,
                            u64 exception_list_index, u16 additional_offset) const;
@@ -231,7 +236,9 @@ private:
                       u32 exception_lists);
   Chunk& ReadCompressedData(u64 offset_in_file, u64 compressed_size, u64 decompressed_size,
                             WIARVZCompressionType compression_type, u32 exception_lists = 0,
-                            u32 rvz_packed_size = 0, u64 data_offset = 0);
+                            u32 rvz_packed_size = 0, u64 data_offset = 0,
+                            bool use_dictionary = false);
+  void InvalidateCachedChunk(u64 offset_in_file);
 
   static bool ApplyHashExceptions(const std::vector<HashExceptionEntry>& exception_list,
                                   VolumeWii::HashBlock hash_blocks[VolumeWii::BLOCKS_PER_GROUP]);
@@ -291,6 +298,8 @@ private:
     std::vector<u8> main_data;
     std::optional<ReuseID> reuse_id;
     std::optional<GroupEntry> reused_group;
+    // The hash of the data as it will be stored, for groups that can share it with other groups.
+    std::optional<SHA1> content_hash;
   };
 
   struct RVZOutputParametersEntry
@@ -299,6 +308,8 @@ private:
     std::vector<u8> main_data;
     std::optional<ReuseID> reuse_id;
     std::optional<GroupEntry> reused_group;
+    // The hash of the data as it will be stored, for groups that can share it with other groups.
+    std::optional<SHA1> content_hash;
     size_t rvz_packed_size = 0;
     bool compressed = false;
   };
@@ -330,9 +341,10 @@ private:
   static bool WriteHeader(File::IOFile* file, const u8* data, size_t size, u64 upper_bound,
                           u64* bytes_written, u64* offset_out);
 
+  static std::vector<u8> CreateZstdDictionary(const VolumeDisc& volume);
   static void SetUpCompressor(std::unique_ptr<Compressor>* compressor,
                               WIARVZCompressionType compression_type, int compression_level,
-                              WIAHeader2* header_2);
+                              WIAHeader2* header_2, const std::vector<u8>& zstd_dictionary);
   static bool TryReuse(std::map<ReuseID, GroupEntry>* reusable_groups,
                        std::mutex* reusable_groups_mutex, OutputParametersEntry* entry);
   static ConversionResult<OutputParameters>
@@ -346,7 +358,9 @@ private:
   static ConversionResultCode Output(std::vector<OutputParametersEntry>* entries,
                                      File::IOFile* outfile,
                                      std::map<ReuseID, GroupEntry>* reusable_groups,
-                                     std::mutex* reusable_groups_mutex, GroupEntry* group_entry,
+                                     std::mutex* reusable_groups_mutex,
+                                     std::map<SHA1, GroupEntry>* content_groups,
+                                     GroupEntry* group_entry,
                                      u64* bytes_written);
   static ConversionResultCode RunCallback(size_t groups_written, u64 bytes_read, u64 bytes_written,
                                           u32 total_groups, u64 iso_size, CompressCB callback);
@@ -355,8 +369,19 @@ private:
   WIARVZCompressionType m_compression_type;
 
   File::IOFile m_file;
-  Chunk m_cached_chunk;
-  u64 m_cached_chunk_offset = std::numeric_limits<u64>::max();
+  // Recently used chunks, so that reads alternating between a few places on the disc don't keep
+  // decompressing the same data. The most recently used chunk is at the front.
+  static constexpr size_t MAX_CACHED_CHUNKS_SIZE = 32 * 1024 * 1024;
+  struct CachedChunk
+  {
+    u64 offset_in_file;
+    size_t memory_size;
+    Chunk chunk;
+  };
+  using CachedChunkList = std::list<CachedChunk>;
+  CachedChunkList m_cached_chunks;
+  std::map<u64, typename CachedChunkList::iterator> m_cached_chunk_map;
+  size_t m_cached_chunks_size = 0;
   WiiEncryptionCache m_encryption_cache;
 
   std::vector<HashExceptionEntry> m_exception_list;
@@ -365,6 +390,8 @@ private:
 
   WIAHeader1 m_header_1;
   WIAHeader2 m_header_2;
+  // Stored after header 2 by RVZ 1.1 and used by all Zstandard compressed groups.
+  std::vector<u8> m_zstd_dictionary;
   std::vector<PartitionEntry> m_partition_entries;
   std::vector<RawDataEntry> m_raw_data_entries;
   std::vector<GroupEntry> m_group_entries;
@@ -382,6 +409,13 @@ private:
   static constexpr u32 RVZ_VERSION = 0x01000000;
   static constexpr u32 RVZ_VERSION_WRITE_COMPATIBLE = 0x00030000;
   static constexpr u32 RVZ_VERSION_READ_COMPATIBLE = 0x00030000;
+  // Files with a Zstandard dictionary can't be read by versions which don't know about it, so they
+  // use this as both their version and their compatible version.
+  static constexpr u32 RVZ_DICTIONARY_VERSION = 0x01010000;
+
+  // Used for Zstandard compression with chunks smaller than a Wii group.
+  static constexpr size_t ZSTD_DICTIONARY_SAMPLES = 64;
+  static constexpr size_t ZSTD_DICTIONARY_SAMPLE_SIZE = 0x400;
 };
 
 using WIAFileReader = WIARVZFileReader<false>;
@@ -259,9 +259,17 @@ bool LZMADecompressor::Decompress(const DecompressionBuffer& in, DecompressionBu
   return result == LZMA_OK || result == LZMA_STREAM_END;
 }
 
-ZstdDecompressor::ZstdDecompressor()
+ZstdDecompressor::ZstdDecompressor(const u8* dictionary, size_t dictionary_size)
 {
   m_stream = ZSTD_createDStream();
+
+  // Every decompressor only decompresses a single frame, so a prefix is enough.
+  if (m_stream && dictionary_size != 0 &&
+      ZSTD_isError(ZSTD_DCtx_refPrefix(m_stream, dictionary, dictionary_size)))
+  {
+    ZSTD_freeDStream(m_stream);
+    m_stream = nullptr;
+  }
 }
 
 ZstdDecompressor::~ZstdDecompressor()
@@ -737,7 +745,9 @@ size_t LZMACompressor::GetSize() const
   return static_cast<size_t>(m_stream.next_out - m_buffer.data());
 }
 
-ZstdCompressor::ZstdCompressor(int compression_level)
+ZstdCompressor::ZstdCompressor(int compression_level, const u8* dictionary,
+                               size_t dictionary_size)
+    : m_dictionary(dictionary), m_dictionary_size(dictionary_size)
 {
   m_stream = ZSTD_createCStream();
 
@@ -764,6 +774,13 @@ bool ZstdCompressor::Start(std::optional<u64> size)
   if (ZSTD_isError(ZSTD_CCtx_reset(m_stream, ZSTD_reset_session_only)))
     return false;
 
+  // A prefix only applies to the next frame, so it has to be referenced again for every frame.
+  if (m_dictionary_size != 0)
+  {
+    if (ZSTD_isError(ZSTD_CCtx_refPrefix(m_stream, m_dictionary, m_dictionary_size)))
+      return false;
+  }
+
   if (size)
   {
     if (ZSTD_isError(ZSTD_CCtx_setPledgedSrcSize(m_stream, *size)))
@@ -107,7 +107,8 @@ private:
 class ZstdDecompressor final : public Decompressor
 {
 public:
-  ZstdDecompressor();
+  // The dictionary, if any, is referenced rather than copied.
+  ZstdDecompressor(const u8* dictionary = nullptr, size_t dictionary_size = 0);
   ~ZstdDecompressor();
 
   bool Decompress(const DecompressionBuffer& in, DecompressionBuffer* out,
@@ -230,7 +231,9 @@ private:
 class ZstdCompressor final : public Compressor
 {
 public:
-  ZstdCompressor(int compression_level);
+  // The dictionary, if any, is referenced rather than copied.
+  ZstdCompressor(int compression_level, const u8* dictionary = nullptr,
+                 size_t dictionary_size = 0);
   ~ZstdCompressor();
 
   bool Start(std::optional<u64> size) override;
@@ -246,6 +249,9 @@ private:
   ZSTD_CStream* m_stream;
   ZSTD_outBuffer m_out_buffer;
   std::vector<u8> m_buffer;
+
+  const u8* m_dictionary;
+  size_t m_dictionary_size;
 };
 
 }  // namespace DiscIO
@@ -4,6 +4,7 @@
 #include "DolphinNoGUI/Platform.h"
 
 #include <OptionParser.h>
+#include <chrono>
 #include <cstddef>
 #include <cstdio>
 #include <cstring>
@@ -17,12 +18,17 @@
 #include <Windows.h>
 #endif
 
+#include "Common/Config/Config.h"
 #include "Common/StringUtil.h"
 #include "Core/Boot/Boot.h"
 #include "Core/BootManager.h"
+#include "Core/Config/GraphicsSettings.h"
+#include "Core/ConfigManager.h"
 #include "Core/Core.h"
 #include "Core/DolphinAnalytics.h"
+#include "Core/FifoPlayer/FifoPlayer.h"
 #include "Core/Host.h"
+#include "Core/Movie.h"
 
 #include "UICommon/CommandLineParse.h"
 #ifdef USE_DISCORD_PRESENCE
@@ -30,6 +36,7 @@
 #endif
 #include "UICommon/UICommon.h"
 
+#include "VideoCommon/GPUTimingBase.h"
 #include "VideoCommon/RenderBase.h"
 #include "VideoCommon/VideoBackendBase.h"
 
@@ -165,6 +172,15 @@ int main(int argc, char* argv[])
             "win32"
 #endif
       });
+  parser->add_option("--replay")
+      .action("store_true")
+      .help("Play the movie given with --movie as fast as possible without audio, then exit");
+  parser->add_option("--fifo-loops")
+      .action("store")
+      .type("int")
+      .metavar("<count>")
+      .help("Play the given FIFO log this many times as fast as possible without audio, print "
+            "how long each pass took, then exit");
 
   optparse::Values& options = CommandLineParse::ParseArguments(parser.get(), argc, argv);
   std::vector<std::string> args = parser->args();
@@ -249,6 +265,88 @@ int main(int argc, char* argv[])
 
   DolphinAnalytics::Instance().ReportDolphinStart("nogui");
 
+  const bool replay = options.is_set("replay");
+  if (options.is_set("movie"))
+  {
+    const std::string movie_path = static_cast<const char*>(options.get("movie"));
+    if (boot && !Movie::PlayInput(movie_path, &boot->savestate_path))
+    {
+      fprintf(stderr, "Could not play the specified movie\n");
+      return 1;
+    }
+  }
+  else if (replay)
+  {
+    fprintf(stderr, "--replay requires a movie to be specified with --movie.\n");
+    return 1;
+  }
+
+  int fifo_loops = 0;
+  if (options.is_set("fifo_loops"))
+  {
+    fifo_loops = static_cast<int>(options.get("fifo_loops"));
+    if (fifo_loops <= 0)
+    {
+      fprintf(stderr, "--fifo-loops requires a positive count.\n");
+      return 1;
+    }
+  }
+
+  // The replay settings only apply to this run, so the previous values are put back before the
+  // settings are saved on exit.
+  SConfig& config = SConfig::GetInstance();
+  const std::string previous_audio_backend = config.sBackend;
+  const float previous_emulation_speed = config.m_EmulationSpeed;
+  if (replay || fifo_loops > 0)
+  {
+    config.sBackend = BACKEND_NULLSOUND;
+    config.m_EmulationSpeed = 0.0f;
+  }
+  if (fifo_loops > 0)
+  {
+    // The first pass also includes booting and compiling the shaders used by the log, so it
+    // works as a warmup for the ones after it.
+    static int s_loops_left;
+    static int s_loops_done;
+    static std::chrono::steady_clock::time_point s_loop_start;
+    s_loops_left = fifo_loops;
+    s_loops_done = 0;
+    s_loop_start = std::chrono::steady_clock::now();
+    // Only set for this run, the current run layer isn't saved.
+    Config::SetCurrent(Config::GFX_MEASURE_GPU_TIME, true);
+    FifoPlayer::GetInstance().SetLoopCompletedCallback([] {
+      const auto now = std::chrono::steady_clock::now();
+      const double elapsed_ms =
+          std::chrono::duration<double, std::milli>(now - s_loop_start).count();
+      const FifoPlayer& player = FifoPlayer::GetInstance();
+      const u32 frames = player.GetFrameRangeEnd() - player.GetFrameRangeStart() + 1;
+      fprintf(stdout, "Pass %d: %u frames in %.3f ms (%.2f FPS)\n", ++s_loops_done, frames,
+              elapsed_ms, frames * 1000.0 / elapsed_ms);
+      // GPU results lag behind by a few frames, as they are only read back once available.
+      if (g_gpu_timing)
+      {
+        const auto gpu_times = g_gpu_timing->TakeTotalTimes();
+        for (u32 i = 1; i < NUM_GPU_TIMING_CATEGORIES; i++)
+        {
+          fprintf(stdout, "  GPU %s: %.3f ms\n",
+                  GetGPUTimingCategoryName(static_cast<GPUTimingCategory>(i)),
+                  gpu_times[i] / 1000000.0);
+        }
+      }
+      s_loop_start = now;
+      if (--s_loops_left == 0)
+        s_platform->Stop();
+    });
+  }
+  if (replay)
+  {
+    Movie::SetOnPlaybackEndedCallback([] {
+      fprintf(stdout, "Movie ended after %llu frames\n",
+              static_cast<unsigned long long>(Movie::GetCurrentFrame()));
+      s_platform->Stop();
+    });
+  }
+
   if (!BootManager::BootCore(std::move(boot), s_platform->GetWindowSystemInfo()))
   {
     fprintf(stderr, "Could not boot the specified file\n");
@@ -263,6 +361,13 @@ int main(int argc, char* argv[])
   Core::Stop();
 
   Core::Shutdown();
+  if (replay || fifo_loops > 0)
+  {
+    Movie::SetOnPlaybackEndedCallback(nullptr);
+    FifoPlayer::GetInstance().SetLoopCompletedCallback(nullptr);
+    config.sBackend = previous_audio_backend;
+    config.m_EmulationSpeed = previous_emulation_speed;
+  }
   s_platform.reset();
   UICommon::Shutdown();
 
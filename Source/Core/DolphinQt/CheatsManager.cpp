@@ -569,12 +569,20 @@ void CheatsManager::NewSearch()
   if (matches_func == nullptr)
     return;
 
+  const DataType type = static_cast<DataType>(m_match_length->currentIndex());
+  const size_t end = Memory::GetRamSizeReal() - GetTypeSize();
+
   Core::RunAsCPUThread([&] {
-    for (u32 i = 0; i < Memory::GetRamSizeReal() - GetTypeSize(); i++)
+    // Address translation works on whole pages, so only check once per page whether it is RAM.
+    constexpr u32 page_size = 0x1000;
+    bool page_is_ram = false;
+    for (u32 i = 0; i < end; i++)
     {
-      if (PowerPC::HostIsRAMAddress(base_address + i) && matches_func(base_address + i))
-        m_results.push_back(
-            {base_address + i, static_cast<DataType>(m_match_length->currentIndex())});
+      if (i % page_size == 0)
+        page_is_ram = PowerPC::HostIsRAMAddress(base_address + i);
+
+      if (page_is_ram && matches_func(base_address + i))
+        m_results.push_back({base_address + i, type});
     }
   });
 
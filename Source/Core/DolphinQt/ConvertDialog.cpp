@@ -72,6 +72,10 @@ ConvertDialog::ConvertDialog(QList<std::shared_ptr<const UICommon::GameFile>> fi
   grid_layout->addWidget(new QLabel(tr("Remove Junk Data (Irreversible):")), 4, 0);
   grid_layout->addWidget(m_scrub, 4, 1);
 
+  m_zstd_dictionary = new QCheckBox;
+  grid_layout->addWidget(new QLabel(tr("Zstandard Dictionary (Newer Versions Only):")), 5, 0);
+  grid_layout->addWidget(m_zstd_dictionary, 5, 1);
+
   QPushButton* convert_button = new QPushButton(tr("Convert..."));
 
   QVBoxLayout* options_layout = new QVBoxLayout;
@@ -283,6 +287,12 @@ void ConvertDialog::OnCompressionChanged()
   }
 
   m_compression_level->setEnabled(m_compression_level->count() > 1);
+
+  // The dictionary is only written for block sizes smaller than a Wii group (2 MiB).
+  const bool zstd_dictionary_allowed = compression_type == DiscIO::WIARVZCompressionType::Zstd;
+  m_zstd_dictionary->setEnabled(zstd_dictionary_allowed);
+  if (!zstd_dictionary_allowed)
+    m_zstd_dictionary->setChecked(false);
 }
 
 bool ConvertDialog::ShowAreYouSureDialog(const QString& text)
@@ -305,6 +315,7 @@ void ConvertDialog::Convert()
       static_cast<DiscIO::WIARVZCompressionType>(m_compression->currentData().toInt());
   const int compression_level = m_compression_level->currentData().toInt();
   const bool scrub = m_scrub->isChecked();
+  const bool zstd_dictionary = m_zstd_dictionary->isChecked();
 
   if (scrub && format == DiscIO::BlobType::PLAIN)
   {
@@ -381,9 +392,27 @@ void ConvertDialog::Convert()
       return;
   }
 
-  for (const auto& file : m_files)
+  // Opening an image (and analyzing it for scrubbing) only reads from the disc, so the next image
+  // is opened while the current one is being converted.
+  const auto open_blob_reader =
+      [scrub](const std::string& path) -> std::unique_ptr<DiscIO::BlobReader> {
+    return scrub ? DiscIO::ScrubbedBlob::Create(path) : DiscIO::CreateBlobReader(path);
+  };
+  std::future<std::unique_ptr<DiscIO::BlobReader>> next_blob_reader =
+      std::async(std::launch::async, open_blob_reader, m_files[0]->GetFilePath());
+
+  for (int i = 0; i < m_files.size(); ++i)
   {
+    const auto& file = m_files[i];
     const auto original_path = file->GetFilePath();
+
+    std::unique_ptr<DiscIO::BlobReader> blob_reader = next_blob_reader.get();
+    if (i + 1 < m_files.size())
+    {
+      next_blob_reader =
+          std::async(std::launch::async, open_blob_reader, m_files[i + 1]->GetFilePath());
+    }
+
     if (m_files.size() > 1)
     {
       dst_path =
@@ -417,12 +446,10 @@ void ConvertDialog::Convert()
           QFileInfo(QString::fromStdString(original_path)).fileName());
     }
 
-    std::unique_ptr<DiscIO::BlobReader> blob_reader;
     bool scrub_current_file = scrub;
 
     if (scrub_current_file)
     {
-      blob_reader = DiscIO::ScrubbedBlob::Create(original_path);
       if (!blob_reader)
       {
         const int result =
@@ -439,7 +466,7 @@ void ConvertDialog::Convert()
       }
     }
 
-    if (!scrub_current_file)
+    if (scrub && !scrub_current_file)
       blob_reader = DiscIO::CreateBlobReader(original_path);
 
     if (!blob_reader)
@@ -485,7 +512,8 @@ void ConvertDialog::Convert()
           const bool good =
               DiscIO::ConvertToWIAOrRVZ(blob_reader.get(), original_path, dst_path.toStdString(),
                                         format == DiscIO::BlobType::RVZ, compression,
-                                        compression_level, block_size, callback);
+                                        compression_level, block_size, zstd_dictionary,
+                                        callback);
           progress_dialog.Reset();
           return good;
         });
@@ -48,5 +48,6 @@ private:
   QComboBox* m_compression;
   QComboBox* m_compression_level;
   QCheckBox* m_scrub;
+  QCheckBox* m_zstd_dictionary;
   QList<std::shared_ptr<const UICommon::GameFile>> m_files;
 };
@@ -7,6 +7,7 @@
 #include <QFileInfo>
 #include <QPixmap>
 #include <QRegularExpression>
+#include <QTimer>
 
 #include "Core/ConfigManager.h"
 
@@ -21,7 +22,11 @@
 
 const QSize GAMECUBE_BANNER_SIZE(96, 32);
 
-GameListModel::GameListModel(QObject* parent) : QAbstractTableModel(parent)
+// Only the banners of games that have been scrolled past recently are kept around.
+constexpr int BANNER_CACHE_SIZE = 1024;
+
+GameListModel::GameListModel(QObject* parent)
+    : QAbstractTableModel(parent), m_banner_cache(BANNER_CACHE_SIZE)
 {
   connect(&m_tracker, &GameTracker::GameLoaded, this, &GameListModel::AddGame);
   connect(&m_tracker, &GameTracker::GameUpdated, this, &GameListModel::UpdateGame);
@@ -56,7 +61,8 @@ QVariant GameListModel::data(const QModelIndex& index, int role) const
   if (!index.isValid())
     return QVariant();
 
-  const UICommon::GameFile& game = *m_games[index.row()];
+  const std::shared_ptr<const UICommon::GameFile>& game_ptr = m_games[index.row()];
+  const UICommon::GameFile& game = *game_ptr;
 
   switch (static_cast<Column>(index.column()))
   {
@@ -74,18 +80,7 @@ QVariant GameListModel::data(const QModelIndex& index, int role) const
     break;
   case Column::Banner:
     if (role == Qt::DecorationRole)
-    {
-      // GameCube banners are 96x32, but Wii banners are 192x64.
-      QPixmap banner = ToQPixmap(game.GetBannerImage());
-      if (banner.isNull())
-        banner = Resources::GetMisc(Resources::MiscID::BannerMissing);
-
-      banner.setDevicePixelRatio(
-          std::max(static_cast<qreal>(banner.width()) / GAMECUBE_BANNER_SIZE.width(),
-                   static_cast<qreal>(banner.height()) / GAMECUBE_BANNER_SIZE.height()));
-
-      return banner;
-    }
+      return GetBanner(game_ptr);
     break;
   case Column::Title:
     if (role == Qt::DisplayRole || role == SORT_ROLE)
@@ -312,6 +307,29 @@ bool GameListModel::ShouldDisplayGameListItem(int index) const
   }
 }
 
+QPixmap GameListModel::GetBanner(const std::shared_ptr<const UICommon::GameFile>& game) const
+{
+  // Banners are requested whenever a row is painted, so only convert them once.
+  const QString key = QString::fromStdString(game->GetFilePath());
+  if (const CachedPixmap* cached = m_banner_cache.object(key))
+  {
+    if (cached->game.lock() == game)
+      return cached->pixmap;
+  }
+
+  // GameCube banners are 96x32, but Wii banners are 192x64.
+  QPixmap banner = ToQPixmap(game->GetBannerImage());
+  if (banner.isNull())
+    banner = Resources::GetMisc(Resources::MiscID::BannerMissing);
+
+  banner.setDevicePixelRatio(
+      std::max(static_cast<qreal>(banner.width()) / GAMECUBE_BANNER_SIZE.width(),
+               static_cast<qreal>(banner.height()) / GAMECUBE_BANNER_SIZE.height()));
+
+  m_banner_cache.insert(key, new CachedPixmap{banner, game});
+  return banner;
+}
+
 std::shared_ptr<const UICommon::GameFile> GameListModel::GetGameFile(int index) const
 {
   return m_games[index];
@@ -324,13 +342,33 @@ std::string GameListModel::GetNetPlayName(const UICommon::GameFile& game) const
 
 void GameListModel::AddGame(const std::shared_ptr<const UICommon::GameFile>& game)
 {
-  beginInsertRows(QModelIndex(), m_games.size(), m_games.size());
-  m_games.push_back(game);
+  // The tracker reports games one by one, so they are gathered until control returns to the event
+  // loop. This makes the views handle one insertion for a whole directory scan instead of
+  // re-sorting and re-filtering once per game.
+  if (m_pending_games.empty())
+    QTimer::singleShot(0, this, &GameListModel::InsertPendingGames);
+  m_pending_games.push_back(game);
+}
+
+void GameListModel::InsertPendingGames()
+{
+  if (m_pending_games.empty())
+    return;
+
+  beginInsertRows(QModelIndex(), m_games.size(), m_games.size() + m_pending_games.size() - 1);
+  for (auto& game : m_pending_games)
+  {
+    m_game_indices[game->GetFilePath()] = m_games.size();
+    m_games.push_back(std::move(game));
+  }
+  m_pending_games.clear();
   endInsertRows();
 }
 
 void GameListModel::UpdateGame(const std::shared_ptr<const UICommon::GameFile>& game)
 {
+  InsertPendingGames();
+
   int index = FindGameIndex(game->GetFilePath());
   if (index < 0)
   {
@@ -345,29 +383,38 @@ void GameListModel::UpdateGame(const std::shared_ptr<const UICommon::GameFile>&
 
 void GameListModel::RemoveGame(const std::string& path)
 {
+  InsertPendingGames();
+
   int entry = FindGameIndex(path);
   if (entry < 0)
     return;
 
   beginRemoveRows(QModelIndex(), entry, entry);
   m_games.removeAt(entry);
+  m_game_indices.erase(path);
+  for (int i = entry; i < m_games.size(); i++)
+    m_game_indices[m_games[i]->GetFilePath()] = i;
   endRemoveRows();
 }
 
 std::shared_ptr<const UICommon::GameFile> GameListModel::FindGame(const std::string& path) const
 {
   const int index = FindGameIndex(path);
-  return index < 0 ? nullptr : m_games[index];
+  if (index >= 0)
+    return m_games[index];
+
+  for (const auto& game : m_pending_games)
+  {
+    if (game->GetFilePath() == path)
+      return game;
+  }
+  return nullptr;
 }
 
 int GameListModel::FindGameIndex(const std::string& path) const
 {
-  for (int i = 0; i < m_games.size(); i++)
-  {
-    if (m_games[i]->GetFilePath() == path)
-      return i;
-  }
-  return -1;
+  const auto it = m_game_indices.find(path);
+  return it == m_game_indices.end() ? -1 : it->second;
 }
 
 std::shared_ptr<const UICommon::GameFile>
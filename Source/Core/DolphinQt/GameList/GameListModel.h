@@ -5,9 +5,13 @@
 
 #include <memory>
 #include <string>
+#include <unordered_map>
 
 #include <QAbstractTableModel>
+#include <QCache>
+#include <QList>
 #include <QMap>
+#include <QPixmap>
 #include <QString>
 #include <QStringList>
 #include <QVariant>
@@ -67,6 +71,8 @@ public:
   void RemoveGame(const std::string& path);
 
   std::shared_ptr<const UICommon::GameFile> FindGame(const std::string& path) const;
+  // Index in m_games, or -1 if it isn't found
+  int FindGameIndex(const std::string& path) const;
   std::shared_ptr<const UICommon::GameFile> FindSecondDisc(const UICommon::GameFile& game) const;
 
   void SetScale(float scale);
@@ -84,14 +90,26 @@ public:
   void PurgeCache();
 
 private:
-  // Index in m_games, or -1 if it isn't found
-  int FindGameIndex(const std::string& path) const;
+  // A pixmap made from a game's data. It is only valid for as long as the game file it was made
+  // from is still current, which makes updated games miss the cache without any invalidation.
+  struct CachedPixmap
+  {
+    QPixmap pixmap;
+    std::weak_ptr<const UICommon::GameFile> game;
+  };
+
+  // Inserts the games added since the last call as a single batch of rows.
+  void InsertPendingGames();
+  QPixmap GetBanner(const std::shared_ptr<const UICommon::GameFile>& game) const;
 
   QStringList m_tag_list;
   QMap<QString, QVariant> m_game_tags;
 
   GameTracker m_tracker;
   QList<std::shared_ptr<const UICommon::GameFile>> m_games;
+  QList<std::shared_ptr<const UICommon::GameFile>> m_pending_games;
+  std::unordered_map<std::string, int> m_game_indices;
+  mutable QCache<QString, CachedPixmap> m_banner_cache;
   Core::TitleDatabase m_title_database;
   QString m_term;
   float m_scale = 1.0;
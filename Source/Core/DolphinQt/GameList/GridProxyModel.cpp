@@ -3,9 +3,14 @@
 
 #include "DolphinQt/GameList/GridProxyModel.h"
 
+#include <algorithm>
+#include <functional>
+#include <utility>
+
 #include <QImage>
 #include <QPainter>
 #include <QPixmap>
+#include <QRunnable>
 #include <QSize>
 
 #include "DolphinQt/GameList/GameListModel.h"
@@ -15,13 +20,56 @@
 #include "UICommon/GameFile.h"
 
 const QSize LARGE_BANNER_SIZE(144, 48);
+const QSize COVER_SIZE(160, 224);
+
+// Cost is in kilobytes, so this keeps up to 128 MiB of scaled pixmaps around.
+constexpr int PIXMAP_CACHE_SIZE = 128 * 1024;
+
+namespace
+{
+class CoverDecodeTask final : public QRunnable
+{
+public:
+  using Callback = std::function<void(QImage)>;
+
+  CoverDecodeTask(std::shared_ptr<const UICommon::GameFile> game, QSize size, Callback callback)
+      : m_game(std::move(game)), m_size(size), m_callback(std::move(callback))
+  {
+  }
+
+  void run() override
+  {
+    const auto& buffer = m_game->GetCoverImage().buffer;
+    const QImage image = QImage::fromData(reinterpret_cast<const unsigned char*>(&buffer[0]),
+                                          static_cast<int>(buffer.size()));
+    m_callback(image.scaled(m_size, Qt::KeepAspectRatio, Qt::SmoothTransformation));
+  }
+
+private:
+  std::shared_ptr<const UICommon::GameFile> m_game;
+  QSize m_size;
+  Callback m_callback;
+};
+
+int GetPixmapCost(const QPixmap& pixmap)
+{
+  return std::max(pixmap.width() * pixmap.height() * pixmap.depth() / 8 / 1024, 1);
+}
+}  // namespace
 
-GridProxyModel::GridProxyModel(QObject* parent) : QSortFilterProxyModel(parent)
+GridProxyModel::GridProxyModel(QObject* parent)
+    : QSortFilterProxyModel(parent), m_pixmap_cache(PIXMAP_CACHE_SIZE)
 {
   setSortCaseSensitivity(Qt::CaseInsensitive);
   sort(static_cast<int>(GameListModel::Column::Title));
 }
 
+GridProxyModel::~GridProxyModel()
+{
+  m_cover_decoder.clear();
+  m_cover_decoder.waitForDone();
+}
+
 QVariant GridProxyModel::data(const QModelIndex& i, int role) const
 {
   QModelIndex source_index = mapToSource(i);
@@ -35,40 +83,130 @@ QVariant GridProxyModel::data(const QModelIndex& i, int role) const
   {
     auto* model = static_cast<GameListModel*>(sourceModel());
 
-    const auto& buffer = model->GetGameFile(source_index.row())->GetCoverImage().buffer;
+    const auto game = model->GetGameFile(source_index.row());
+    const bool use_covers = Config::Get(Config::MAIN_USE_GAME_COVERS);
+
+    QSize size = use_covers ? COVER_SIZE : LARGE_BANNER_SIZE;
+    size = size * model->GetScale() * QPixmap().devicePixelRatio();
 
-    QSize size = Config::Get(Config::MAIN_USE_GAME_COVERS) ? QSize(160, 224) : LARGE_BANNER_SIZE;
-    QPixmap pixmap(size * model->GetScale() * QPixmap().devicePixelRatio());
+    const QString path = QString::fromStdString(game->GetFilePath());
+    const QString cover_key = QStringLiteral("cover:%1x%2:").arg(size.width()).arg(size.height());
+    const QString banner_key = QStringLiteral("banner:%1x%2:").arg(size.width()).arg(size.height());
 
-    if (buffer.empty() || !Config::Get(Config::MAIN_USE_GAME_COVERS))
+    if (use_covers && !game->GetCoverImage().buffer.empty())
     {
-      QPixmap banner = model
-                           ->data(model->index(source_index.row(),
-                                               static_cast<int>(GameListModel::Column::Banner)),
-                                  Qt::DecorationRole)
-                           .value<QPixmap>();
+      QPixmap cover = GetCachedPixmap(cover_key + path, game);
+      if (!cover.isNull())
+        return cover;
 
-      banner = banner.scaled(pixmap.size(), Qt::KeepAspectRatio, Qt::SmoothTransformation);
+      // Show the banner until the cover has been decoded.
+      RequestCover(cover_key + path, game, size);
+    }
 
-      pixmap.fill();
+    QPixmap banner = GetCachedPixmap(banner_key + path, game);
+    if (banner.isNull())
+    {
+      banner = GetBannerPixmap(source_index.row(), size);
+      m_pixmap_cache.insert(banner_key + path, new CachedPixmap{banner, game},
+                            GetPixmapCost(banner));
+    }
+    return banner;
+  }
+  return QVariant();
+}
 
-      QPainter painter(&pixmap);
+QPixmap GridProxyModel::GetCachedPixmap(const QString& key,
+                                        const std::shared_ptr<const UICommon::GameFile>& game) const
+{
+  const CachedPixmap* cached = m_pixmap_cache.object(key);
+  if (!cached || cached->game.lock() != game)
+    return QPixmap();
+  return cached->pixmap;
+}
 
-      painter.drawPixmap(0, pixmap.height() / 2 - banner.height() / 2, banner.width(),
-                         banner.height(), banner);
+QPixmap GridProxyModel::GetBannerPixmap(int source_row, const QSize& size) const
+{
+  auto* model = static_cast<GameListModel*>(sourceModel());
 
-      return pixmap;
-    }
-    else
-    {
-      pixmap = QPixmap::fromImage(QImage::fromData(
-          reinterpret_cast<const unsigned char*>(&buffer[0]), static_cast<int>(buffer.size())));
+  QPixmap pixmap(size);
+  QPixmap banner =
+      model->data(model->index(source_row, static_cast<int>(GameListModel::Column::Banner)),
+                  Qt::DecorationRole)
+          .value<QPixmap>();
+
+  banner = banner.scaled(pixmap.size(), Qt::KeepAspectRatio, Qt::SmoothTransformation);
+
+  pixmap.fill();
+
+  QPainter painter(&pixmap);
+
+  painter.drawPixmap(0, pixmap.height() / 2 - banner.height() / 2, banner.width(),
+                     banner.height(), banner);
+
+  return pixmap;
+}
+
+void GridProxyModel::RequestCover(const QString& key,
+                                  std::shared_ptr<const UICommon::GameFile> game,
+                                  const QSize& size) const
+{
+  if (m_pending_covers.contains(key))
+    return;
+  m_pending_covers.insert(key);
+
+  // QPixmaps can only be created on the GUI thread, so the task hands back a QImage.
+  auto* self = const_cast<GridProxyModel*>(this);
+  std::weak_ptr<const UICommon::GameFile> weak_game = game;
+  m_cover_decoder.start(
+      new CoverDecodeTask(std::move(game), size, [self, key, size, weak_game](QImage image) {
+        {
+          std::lock_guard<std::mutex> guard(self->m_decoded_covers_lock);
+          self->m_decoded_covers.push_back({key, size, std::move(image), weak_game});
+        }
+        QMetaObject::invokeMethod(self, "InsertDecodedCovers", Qt::QueuedConnection);
+      }));
+}
 
-      return pixmap.scaled(QSize(160, 224) * model->GetScale() * pixmap.devicePixelRatio(),
-                           Qt::KeepAspectRatio, Qt::SmoothTransformation);
+void GridProxyModel::InsertDecodedCovers()
+{
+  std::vector<DecodedCover> decoded_covers;
+  {
+    std::lock_guard<std::mutex> guard(m_decoded_covers_lock);
+    std::swap(decoded_covers, m_decoded_covers);
+  }
+
+  auto* model = static_cast<GameListModel*>(sourceModel());
+  for (DecodedCover& cover : decoded_covers)
+  {
+    m_pending_covers.remove(cover.key);
+
+    const auto game = cover.game.lock();
+    if (!game)
+      continue;
+
+    const int source_row = model->FindGameIndex(game->GetFilePath());
+    if (cover.image.isNull())
+    {
+      // Cache the banner which is already shown under the cover's key, so that the cover isn't
+      // decoded again every time the row is painted.
+      if (source_row >= 0)
+      {
+        const QPixmap banner = GetBannerPixmap(source_row, cover.size);
+        m_pixmap_cache.insert(cover.key, new CachedPixmap{banner, game}, GetPixmapCost(banner));
+      }
+      continue;
     }
+
+    const QPixmap pixmap = QPixmap::fromImage(std::move(cover.image));
+    m_pixmap_cache.insert(cover.key, new CachedPixmap{pixmap, game}, GetPixmapCost(pixmap));
+
+    if (source_row < 0)
+      continue;
+
+    const QModelIndex index = mapFromSource(model->index(source_row, 0));
+    if (index.isValid())
+      emit dataChanged(index, index, {Qt::DecorationRole});
   }
-  return QVariant();
 }
 
 bool GridProxyModel::filterAcceptsRow(int source_row, const QModelIndex& source_parent) const
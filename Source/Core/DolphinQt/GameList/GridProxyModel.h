@@ -3,16 +3,69 @@
 
 #pragma once
 
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <QCache>
+#include <QImage>
+#include <QPixmap>
+#include <QSet>
 #include <QSortFilterProxyModel>
+#include <QString>
+#include <QThreadPool>
+
+namespace UICommon
+{
+class GameFile;
+}
 
 // This subclass of QSortFilterProxyModel transforms the raw data into a
 // single-column large icon + name to be displayed in a QListView.
+//
+// Cover images are only decoded once their row is painted, on a thread pool, and the scaled
+// results are kept in a cache of recently shown games.
 class GridProxyModel final : public QSortFilterProxyModel
 {
   Q_OBJECT
 
 public:
   explicit GridProxyModel(QObject* parent = nullptr);
+  ~GridProxyModel() override;
+
   QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
   bool filterAcceptsRow(int source_row, const QModelIndex& source_parent) const override;
+
+private slots:
+  void InsertDecodedCovers();
+
+private:
+  // A pixmap is only valid for as long as the game file it was made from is still current.
+  struct CachedPixmap
+  {
+    QPixmap pixmap;
+    std::weak_ptr<const UICommon::GameFile> game;
+  };
+
+  struct DecodedCover
+  {
+    QString key;
+    QSize size;
+    // Null if the cover couldn't be decoded.
+    QImage image;
+    std::weak_ptr<const UICommon::GameFile> game;
+  };
+
+  QPixmap GetCachedPixmap(const QString& key,
+                          const std::shared_ptr<const UICommon::GameFile>& game) const;
+  QPixmap GetBannerPixmap(int source_row, const QSize& size) const;
+  void RequestCover(const QString& key, std::shared_ptr<const UICommon::GameFile> game,
+                    const QSize& size) const;
+
+  mutable QCache<QString, CachedPixmap> m_pixmap_cache;
+  mutable QSet<QString> m_pending_covers;
+  mutable QThreadPool m_cover_decoder;
+
+  std::mutex m_decoded_covers_lock;
+  std::vector<DecodedCover> m_decoded_covers;
 };
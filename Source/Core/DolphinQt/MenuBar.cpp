@@ -141,6 +141,7 @@ void MenuBar::OnEmulationStateChanged(Core::State state)
   m_jit_disable_fastmem->setEnabled(!running);
   m_jit_clear_cache->setEnabled(running);
   m_jit_log_coverage->setEnabled(!running);
+  m_jit_log_block_stats->setEnabled(running);
   m_jit_search_instruction->setEnabled(running);
 
   for (QAction* action :
@@ -846,6 +847,8 @@ void MenuBar::AddJITMenu()
 
   m_jit_log_coverage =
       m_jit->addAction(tr("Log JIT Instruction Coverage"), this, &MenuBar::LogInstructions);
+  m_jit_log_block_stats =
+      m_jit->addAction(tr("Log JIT Block Statistics"), this, &MenuBar::LogBlockStats);
   m_jit_search_instruction =
       m_jit->addAction(tr("Search for an Instruction"), this, &MenuBar::SearchInstruction);
 
@@ -1682,6 +1685,11 @@ void MenuBar::LogInstructions()
   PPCTables::LogCompiledInstructions();
 }
 
+void MenuBar::LogBlockStats()
+{
+  JitInterface::WriteBlockStats(File::GetUserPath(D_LOGS_IDX) + "jit_block_stats.txt");
+}
+
 void MenuBar::SearchInstruction()
 {
   bool good;
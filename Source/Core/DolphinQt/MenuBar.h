@@ -177,6 +177,7 @@ private:
   void PatchHLEFunctions();
   void ClearCache();
   void LogInstructions();
+  void LogBlockStats();
   void SearchInstruction();
 
   void OnSelectionChanged(std::shared_ptr<const UICommon::GameFile> game_file);
@@ -260,6 +261,7 @@ private:
   QAction* m_jit_disable_fastmem;
   QAction* m_jit_clear_cache;
   QAction* m_jit_log_coverage;
+  QAction* m_jit_log_block_stats;
   QAction* m_jit_search_instruction;
   QAction* m_jit_off;
   QAction* m_jit_loadstore_off;
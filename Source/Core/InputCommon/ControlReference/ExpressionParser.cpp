@@ -44,6 +44,10 @@ public:
 
   bool IsSuppressed(Device::Input* input) const
   {
+    // Every bound control checks this on every poll, and nothing is suppressed most of the time.
+    if (m_suppressions.empty())
+      return false;
+
     // Input is suppressed if it exists in the map at all.
     return m_suppressions.lower_bound({input, nullptr}) !=
            m_suppressions.lower_bound({input + 1, nullptr});
@@ -250,7 +254,7 @@ public:
 
   ControlState GetValue() const override
   {
-    if (s_hotkey_suppressions.IsSuppressed(m_input))
+    if (!m_input || s_hotkey_suppressions.IsSuppressed(m_input))
       return 0;
     return GetValueIgnoringSuppression();
   }
@@ -576,6 +580,7 @@ public:
   CoalesceExpression(std::unique_ptr<Expression>&& lhs, std::unique_ptr<Expression>&& rhs)
       : m_lhs(std::move(lhs)), m_rhs(std::move(rhs))
   {
+    UpdateActiveChild();
   }
 
   ControlState GetValue() const override { return GetActiveChild()->GetValue(); }
@@ -586,16 +591,22 @@ public:
   {
     m_lhs->UpdateReferences(env);
     m_rhs->UpdateReferences(env);
+    UpdateActiveChild();
   }
 
 private:
-  const std::unique_ptr<Expression>& GetActiveChild() const
+  Expression* GetActiveChild() const { return m_active_child; }
+
+  // Which child is active only changes when references are updated. Every parsed expression is
+  // wrapped in one of these, so don't count the controls of the left-hand child on every poll.
+  void UpdateActiveChild()
   {
-    return m_lhs->CountNumControls() > 0 ? m_lhs : m_rhs;
+    m_active_child = m_lhs->CountNumControls() > 0 ? m_lhs.get() : m_rhs.get();
   }
 
   std::unique_ptr<Expression> m_lhs;
   std::unique_ptr<Expression> m_rhs;
+  Expression* m_active_child = nullptr;
 };
 
 std::shared_ptr<Device> ControlEnvironment::FindDevice(ControlQualifier qualifier) const
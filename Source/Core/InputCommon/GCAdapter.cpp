@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <algorithm>
+#include <chrono>
 #include <libusb.h>
 #include <mutex>
 
@@ -49,6 +50,13 @@ static u8 s_controller_payload[37];
 static u8 s_controller_payload_swap[37];
 
 static std::atomic<int> s_controller_payload_size = {0};
+// Host time at which the current payload arrived, guarded by s_mutex.
+static std::chrono::steady_clock::time_point s_controller_payload_time;
+
+// How old the adapter report was whenever the emulated game polled it.
+static std::atomic<u64> s_report_age_samples = {0};
+static std::atomic<u64> s_report_age_total_us = {0};
+static std::atomic<u64> s_report_age_max_us = {0};
 
 static std::thread s_adapter_input_thread;
 static std::thread s_adapter_output_thread;
@@ -81,11 +89,14 @@ static u64 s_last_init = 0;
 
 static void Read()
 {
+  Common::SetCurrentThreadName("GC Adapter Read Thread");
+
   int payload_size = 0;
   while (s_adapter_thread_running.IsSet())
   {
     int err = libusb_interrupt_transfer(s_handle, s_endpoint_in, s_controller_payload_swap,
                                         sizeof(s_controller_payload_swap), &payload_size, 16);
+    const auto now = std::chrono::steady_clock::now();
     if (err)
       ERROR_LOG_FMT(CONTROLLERINTERFACE, "adapter libusb read failed: err={}",
                     libusb_error_name(err));
@@ -94,12 +105,48 @@ static void Read()
       std::lock_guard<std::mutex> lk(s_mutex);
       std::swap(s_controller_payload_swap, s_controller_payload);
       s_controller_payload_size.store(payload_size);
+      s_controller_payload_time = now;
     }
 
-    Common::YieldCPU();
+    // The transfer blocks until the adapter sends its next report, so only back off when it
+    // failed straight away.
+    if (err)
+      Common::YieldCPU();
   }
 }
 
+static void RecordReportAge(std::chrono::steady_clock::time_point report_time)
+{
+  const u64 age_us = static_cast<u64>(std::chrono::duration_cast<std::chrono::microseconds>(
+                                          std::chrono::steady_clock::now() - report_time)
+                                          .count());
+
+  s_report_age_samples.fetch_add(1, std::memory_order_relaxed);
+  s_report_age_total_us.fetch_add(age_us, std::memory_order_relaxed);
+  u64 max_us = s_report_age_max_us.load(std::memory_order_relaxed);
+  while (age_us > max_us &&
+         !s_report_age_max_us.compare_exchange_weak(max_us, age_us, std::memory_order_relaxed))
+  {
+  }
+}
+
+ReportAgeStats GetReportAgeStats()
+{
+  ReportAgeStats stats;
+  stats.samples = s_report_age_samples.load(std::memory_order_relaxed);
+  if (stats.samples != 0)
+    stats.average_us = s_report_age_total_us.load(std::memory_order_relaxed) / stats.samples;
+  stats.max_us = s_report_age_max_us.load(std::memory_order_relaxed);
+  return stats;
+}
+
+void ResetReportAgeStats()
+{
+  s_report_age_samples.store(0, std::memory_order_relaxed);
+  s_report_age_total_us.store(0, std::memory_order_relaxed);
+  s_report_age_max_us.store(0, std::memory_order_relaxed);
+}
+
 static void Write()
 {
   int size = 0;
@@ -397,6 +444,15 @@ static void Reset()
     s_rumble_data_available.Set();
     s_adapter_input_thread.join();
     s_adapter_output_thread.join();
+
+    const ReportAgeStats stats = GetReportAgeStats();
+    if (stats.samples != 0)
+    {
+      INFO_LOG_FMT(CONTROLLERINTERFACE,
+                   "adapter report age at poll time: average {} us, max {} us over {} polls",
+                   stats.average_us, stats.max_us, stats.samples);
+    }
+    ResetReportAgeStats();
   }
 
   s_controller_type.fill(ControllerTypes::CONTROLLER_NONE);
@@ -424,14 +480,18 @@ GCPadStatus Input(int chan)
 
   int payload_size = 0;
   u8 controller_payload_copy[37];
+  std::chrono::steady_clock::time_point payload_time;
 
   {
     std::lock_guard<std::mutex> lk(s_mutex);
     std::copy(std::begin(s_controller_payload), std::end(s_controller_payload),
               std::begin(controller_payload_copy));
     payload_size = s_controller_payload_size.load();
+    payload_time = s_controller_payload_time;
   }
 
+  RecordReportAge(payload_time);
+
   GCPadStatus pad = {};
   if (payload_size != sizeof(controller_payload_copy) ||
       controller_payload_copy[0] != LIBUSB_DT_HID)
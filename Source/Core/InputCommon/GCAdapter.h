@@ -30,4 +30,15 @@ bool DeviceConnected(int chan);
 void ResetDeviceType(int chan);
 bool UseAdapter();
 
+// How long adapter reports had been waiting when the emulated game polled them, which is the
+// latency the adapter pipeline adds on top of the adapter's own polling interval.
+struct ReportAgeStats
+{
+  u64 samples = 0;
+  u64 average_us = 0;
+  u64 max_us = 0;
+};
+ReportAgeStats GetReportAgeStats();
+void ResetReportAgeStats();
+
 }  // namespace GCAdapter
@@ -397,4 +397,14 @@ void SetAdapterCallback(std::function<void(void)> func)
 {
 }
 
+// Reports are delivered through Java here, so there is no timestamp to measure against.
+ReportAgeStats GetReportAgeStats()
+{
+  return {};
+}
+
+void ResetReportAgeStats()
+{
+}
+
 }  // end of namespace GCAdapter
@@ -4,12 +4,15 @@
 #include "UICommon/GameFileCache.h"
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <cstddef>
 #include <functional>
 #include <list>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -19,6 +22,7 @@
 #include "Common/FileSearch.h"
 #include "Common/FileUtil.h"
 #include "Common/IOFile.h"
+#include "Common/Thread.h"
 
 #include "DiscIO/DirectoryBlob.h"
 
@@ -131,13 +135,59 @@ bool GameFileCache::Update(
 
   // Now that the previous loop has run, game_paths only contains paths that
   // aren't in m_cached_files, so we simply add all of them to m_cached_files.
-  for (const std::string& path : game_paths)
+  // Opening the volumes is slow, especially on network drives, so it's spread over several
+  // threads. The new files are still added and reported on this thread as they come in.
+  const std::vector<std::string> new_paths(game_paths.begin(), game_paths.end());
+  std::atomic<size_t> next_path_index{0};
+
+  std::mutex new_files_mutex;
+  std::condition_variable new_files_cv;
+  std::vector<std::shared_ptr<GameFile>> new_files;
+  size_t threads_done = 0;
+
+  const size_t thread_count = std::min<size_t>(
+      new_paths.size(), std::max<unsigned int>(1, std::thread::hardware_concurrency()));
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < thread_count; ++i)
   {
-    if (processing_halted)
-      break;
+    threads.emplace_back([&] {
+      Common::SetCurrentThreadName("Game list scan");
+
+      while (!processing_halted)
+      {
+        const size_t index = next_path_index++;
+        if (index >= new_paths.size())
+          break;
+
+        auto file = std::make_shared<GameFile>(new_paths[index]);
+        if (file->IsValid())
+        {
+          std::lock_guard lk(new_files_mutex);
+          new_files.push_back(std::move(file));
+        }
+        new_files_cv.notify_one();
+      }
 
-    auto file = std::make_shared<GameFile>(path);
-    if (file->IsValid())
+      {
+        std::lock_guard lk(new_files_mutex);
+        ++threads_done;
+      }
+      new_files_cv.notify_one();
+    });
+  }
+
+  std::vector<std::shared_ptr<GameFile>> files;
+  while (true)
+  {
+    {
+      std::unique_lock lk(new_files_mutex);
+      new_files_cv.wait(lk, [&] { return !new_files.empty() || threads_done == thread_count; });
+      if (new_files.empty())
+        break;
+      files.swap(new_files);
+    }
+
+    for (std::shared_ptr<GameFile>& file : files)
     {
       if (game_added_to_cache)
         game_added_to_cache(file);
@@ -145,8 +195,12 @@ bool GameFileCache::Update(
       cache_changed = true;
       m_cached_files.push_back(std::move(file));
     }
+    files.clear();
   }
 
+  for (std::thread& thread : threads)
+    thread.join();
+
   return cache_changed;
 }
 
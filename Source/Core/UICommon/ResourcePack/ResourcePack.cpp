@@ -4,15 +4,24 @@
 #include "UICommon/ResourcePack/ResourcePack.h"
 
 #include <algorithm>
+#include <cstring>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
 
 #include <unzip.h>
+#include <zlib.h>
 
 #include "Common/CommonPaths.h"
 #include "Common/FileSearch.h"
 #include "Common/FileUtil.h"
+#include "Common/IOFile.h"
 #include "Common/MinizipUtil.h"
 #include "Common/ScopeGuard.h"
 #include "Common/StringUtil.h"
+#include "Common/WorkerPool.h"
 
 #include "UICommon/ResourcePack/Manager.h"
 #include "UICommon/ResourcePack/Manifest.h"
@@ -21,6 +30,31 @@ namespace ResourcePack
 {
 constexpr char TEXTURE_PATH[] = HIRES_TEXTURES_DIR DIR_SEP;
 
+// Each extraction thread needs its own handle to the zip, so there is little to gain beyond this.
+constexpr u32 MAX_EXTRACTION_THREADS = 8;
+
+static std::unordered_set<std::string> GetTexturesOfHigherPriorityPacks(ResourcePack& pack)
+{
+  std::unordered_set<std::string> textures;
+  for (const auto& higher_pack : GetHigherPriorityPacks(pack))
+    textures.insert(higher_pack->GetTextures().begin(), higher_pack->GetTextures().end());
+  return textures;
+}
+
+// Returns whether the file at the given path has exactly the given contents already.
+static bool IsFileUpToDate(const std::string& path, u32 size, u32 crc)
+{
+  File::IOFile file(path, "rb");
+  if (!file || file.GetSize() != size)
+    return false;
+
+  std::vector<u8> data(size);
+  if (!file.ReadBytes(data.data(), data.size()))
+    return false;
+
+  return crc32(0L, data.data(), size) == crc;
+}
+
 ResourcePack::ResourcePack(const std::string& path) : m_path(path)
 {
   auto file = unzOpen(path.c_str());
@@ -85,6 +119,7 @@ ResourcePack::ResourcePack(const std::string& path) : m_path(path)
     unz_file_info texture_info;
     unzGetCurrentFileInfo(file, &texture_info, filename.data(), static_cast<u16>(filename.size()),
                           nullptr, 0, nullptr, 0);
+    filename.resize(std::strlen(filename.c_str()));
 
     if (filename.compare(0, 9, "textures/") != 0 || texture_info.uncompressed_size == 0)
       continue;
@@ -97,7 +132,13 @@ ResourcePack::ResourcePack(const std::string& path) : m_path(path)
       return;
     }
 
+    unz64_file_pos position;
+    unzGetFilePos64(file, &position);
+
     m_textures.push_back(filename.substr(9));
+    m_texture_entries.push_back({position.pos_in_zip_directory, position.num_of_file,
+                                 static_cast<u32>(texture_info.crc),
+                                 static_cast<u32>(texture_info.uncompressed_size)});
   } while (unzGoToNextFile(file) != UNZ_END_OF_LIST_OF_FILE);
 }
 
@@ -139,63 +180,114 @@ bool ResourcePack::Install(const std::string& path)
     return false;
   }
 
-  auto file = unzOpen(m_path.c_str());
-  Common::ScopeGuard file_guard{[&] { unzClose(file); }};
+  // Don't overwrite the textures a higher priority pack already provides
+  const std::unordered_set<std::string> higher_priority_textures =
+      GetTexturesOfHigherPriorityPacks(*this);
 
-  for (const auto& texture : m_textures)
+  std::vector<size_t> textures_to_install;
+  std::set<std::string> directories;
+  for (size_t i = 0; i < m_textures.size(); i++)
   {
-    bool provided_by_other_pack = false;
+    if (higher_priority_textures.count(m_textures[i]) != 0)
+      continue;
 
-    // Check if a higher priority pack already provides a given texture, don't overwrite it
-    for (const auto& pack : GetHigherPriorityPacks(*this))
-    {
-      if (std::find(pack->GetTextures().begin(), pack->GetTextures().end(), texture) !=
-          pack->GetTextures().end())
-      {
-        provided_by_other_pack = true;
-        break;
-      }
-    }
+    textures_to_install.push_back(i);
 
-    if (provided_by_other_pack)
-      continue;
+    std::string directory;
+    SplitPath(path + TEXTURE_PATH + m_textures[i], &directory, nullptr, nullptr);
+    directories.insert(std::move(directory));
+  }
 
-    if (unzLocateFile(file, ("textures/" + texture).c_str(), 0) != UNZ_OK)
+  for (const std::string& directory : directories)
+  {
+    if (!File::CreateFullPath(directory))
     {
-      m_error = "Failed to locate texture " + texture;
+      m_error = "Failed to create full path " + directory;
       return false;
     }
+  }
 
-    const std::string texture_path = path + TEXTURE_PATH + texture;
-    std::string m_full_dir;
-    SplitPath(texture_path, &m_full_dir, nullptr, nullptr);
-
-    if (!File::CreateFullPath(m_full_dir))
+  // minizip handles can't be shared between threads, so every thread opens the pack by itself and
+  // extracts a contiguous range of the textures. Textures which were already extracted with the
+  // same contents, e.g. when reinstalling the pack after a lower priority pack was uninstalled,
+  // are left alone.
+  const u32 num_threads = std::clamp<u32>(std::thread::hardware_concurrency(), 1,
+                                          MAX_EXTRACTION_THREADS);
+  const size_t num_ranges = std::min<size_t>(num_threads, textures_to_install.size());
+
+  std::mutex error_lock;
+  std::string error;
+  const auto set_error = [&](std::string message) {
+    std::lock_guard<std::mutex> guard(error_lock);
+    if (error.empty())
+      error = std::move(message);
+  };
+
+  const auto extract_range = [&](size_t range) {
+    auto file = unzOpen(m_path.c_str());
+    Common::ScopeGuard file_guard{[&] { unzClose(file); }};
+
+    if (file == nullptr)
     {
-      m_error = "Failed to create full path " + m_full_dir;
-      return false;
+      set_error("Failed to open resource pack");
+      return;
     }
 
-    unz_file_info texture_info;
-    unzGetCurrentFileInfo(file, &texture_info, nullptr, 0, nullptr, 0, nullptr, 0);
+    const size_t begin = textures_to_install.size() * range / num_ranges;
+    const size_t end = textures_to_install.size() * (range + 1) / num_ranges;
 
-    std::vector<char> data(texture_info.uncompressed_size);
-    if (!Common::ReadFileFromZip(file, &data))
+    std::vector<char> data;
+    for (size_t i = begin; i < end; i++)
     {
-      m_error = "Failed to read texture " + texture;
-      return false;
-    }
+      const std::string& texture = m_textures[textures_to_install[i]];
+      const TextureEntry& entry = m_texture_entries[textures_to_install[i]];
+      const std::string texture_path = path + TEXTURE_PATH + texture;
 
-    std::ofstream out(texture_path, std::ios::trunc | std::ios::binary);
+      if (IsFileUpToDate(texture_path, entry.size, entry.crc))
+        continue;
 
-    if (!out.good())
-    {
-      m_error = "Failed to write " + texture;
-      return false;
+      const unz64_file_pos position = {entry.pos_in_zip_directory, entry.num_of_file};
+      if (unzGoToFilePos64(file, &position) != UNZ_OK)
+      {
+        set_error("Failed to locate texture " + texture);
+        return;
+      }
+
+      data.resize(entry.size);
+      if (!Common::ReadFileFromZip(file, &data))
+      {
+        set_error("Failed to read texture " + texture);
+        return;
+      }
+
+      std::ofstream out(texture_path, std::ios::trunc | std::ios::binary);
+
+      if (!out.good())
+      {
+        set_error("Failed to write " + texture);
+        return;
+      }
+
+      out.write(data.data(), data.size());
+      out.flush();
     }
+  };
 
-    out.write(data.data(), data.size());
-    out.flush();
+  if (num_ranges > 1)
+  {
+    Common::WorkerPool pool;
+    pool.Start(static_cast<u32>(num_ranges - 1), "Resource Pack Extraction");
+    pool.ParallelFor(num_ranges, extract_range);
+  }
+  else if (num_ranges == 1)
+  {
+    extract_range(0);
+  }
+
+  if (!error.empty())
+  {
+    m_error = std::move(error);
+    return false;
   }
 
   SetInstalled(*this, true);
@@ -214,41 +306,39 @@ bool ResourcePack::Uninstall(const std::string& path)
 
   SetInstalled(*this, false);
 
-  for (const auto& texture : m_textures)
+  // Textures a higher priority pack provides are left in place
+  const std::unordered_set<std::string> higher_priority_textures =
+      GetTexturesOfHigherPriorityPacks(*this);
+
+  // Textures a lower priority pack provides are restored by reinstalling that pack
+  std::unordered_map<std::string, ResourcePack*> lower_priority_textures;
+  for (auto& pack : lower)
   {
-    bool provided_by_other_pack = false;
+    if (!::ResourcePack::IsInstalled(*pack))
+      continue;
 
-    // Check if a higher priority pack already provides a given texture, don't delete it
-    for (const auto& pack : GetHigherPriorityPacks(*this))
-    {
-      if (::ResourcePack::IsInstalled(*pack) &&
-          std::find(pack->GetTextures().begin(), pack->GetTextures().end(), texture) !=
-              pack->GetTextures().end())
-      {
-        provided_by_other_pack = true;
-        break;
-      }
-    }
+    for (const auto& texture : pack->GetTextures())
+      lower_priority_textures.emplace(texture, pack);
+  }
 
-    if (provided_by_other_pack)
+  std::vector<ResourcePack*> packs_to_reinstall;
+  std::set<std::string> directories;
+
+  for (const auto& texture : m_textures)
+  {
+    if (higher_priority_textures.count(texture) != 0)
       continue;
 
-    // Check if a lower priority pack provides a given texture - if so, install it.
-    for (auto& pack : lower)
+    const auto lower_pack = lower_priority_textures.find(texture);
+    if (lower_pack != lower_priority_textures.end())
     {
-      if (::ResourcePack::IsInstalled(*pack) &&
-          std::find(pack->GetTextures().rbegin(), pack->GetTextures().rend(), texture) !=
-              pack->GetTextures().rend())
+      if (std::find(packs_to_reinstall.begin(), packs_to_reinstall.end(), lower_pack->second) ==
+          packs_to_reinstall.end())
       {
-        pack->Install(path);
-
-        provided_by_other_pack = true;
-        break;
+        packs_to_reinstall.push_back(lower_pack->second);
       }
-    }
-
-    if (provided_by_other_pack)
       continue;
+    }
 
     const std::string texture_path = path + TEXTURE_PATH + texture;
     if (File::Exists(texture_path) && !File::Delete(texture_path))
@@ -257,12 +347,24 @@ bool ResourcePack::Uninstall(const std::string& path)
       return false;
     }
 
-    // Recursively delete empty directories
-
     std::string dir;
     SplitPath(texture_path, &dir, nullptr, nullptr);
+    directories.insert(std::move(dir));
+  }
+
+  for (auto& pack : packs_to_reinstall)
+    pack->Install(path);
+
+  // Recursively delete empty directories. Going through them in reverse order visits
+  // subdirectories before their parents, and a walk can stop at any directory which was already
+  // looked at.
+  std::unordered_set<std::string> checked_directories;
+  for (auto it = directories.rbegin(); it != directories.rend(); ++it)
+  {
+    std::string dir = *it;
 
-    while (dir.length() > (path + TEXTURE_PATH).length())
+    while (dir.length() > (path + TEXTURE_PATH).length() &&
+           checked_directories.insert(dir).second)
     {
       auto is_empty = Common::DoFileSearch({dir}).empty();
 
@@ -33,6 +33,16 @@ public:
   bool operator!=(const ResourcePack& pack) const;
 
 private:
+  // Where a texture is stored in the pack, so that it can be extracted without searching the zip's
+  // central directory, and its checksum to tell whether an extracted copy is still up to date.
+  struct TextureEntry
+  {
+    u64 pos_in_zip_directory;
+    u64 num_of_file;
+    u32 crc;
+    u32 size;
+  };
+
   bool m_valid = true;
 
   std::string m_path;
@@ -40,6 +50,7 @@ private:
 
   std::shared_ptr<Manifest> m_manifest;
   std::vector<std::string> m_textures;
+  std::vector<TextureEntry> m_texture_entries;
   std::vector<char> m_logo_data;
 };
 }  // namespace ResourcePack
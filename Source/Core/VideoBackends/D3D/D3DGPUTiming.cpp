@@ -0,0 +1,69 @@
+// Copyright 2021 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoBackends/D3D/D3DGPUTiming.h"
+
+namespace DX11
+{
+GPUTiming::GPUTiming()
+{
+  const D3D11_QUERY_DESC disjoint_desc = CD3D11_QUERY_DESC(D3D11_QUERY_TIMESTAMP_DISJOINT, 0);
+  const D3D11_QUERY_DESC timestamp_desc = CD3D11_QUERY_DESC(D3D11_QUERY_TIMESTAMP, 0);
+  for (FrameQueries& queries : m_frame_queries)
+  {
+    D3D::device->CreateQuery(&disjoint_desc, &queries.disjoint_query);
+    for (ComPtr<ID3D11Query>& query : queries.timestamp_queries)
+      D3D::device->CreateQuery(&timestamp_desc, &query);
+  }
+}
+
+GPUTiming::~GPUTiming() = default;
+
+bool GPUTiming::BeginFrameQueries(u32 frame)
+{
+  D3D::context->Begin(m_frame_queries[frame].disjoint_query.Get());
+  return true;
+}
+
+void GPUTiming::WriteTimestamp(u32 frame, u32 index)
+{
+  D3D::context->End(m_frame_queries[frame].timestamp_queries[index].Get());
+}
+
+void GPUTiming::EndFrameQueries(u32 frame, u32 count)
+{
+  D3D::context->End(m_frame_queries[frame].disjoint_query.Get());
+}
+
+bool GPUTiming::ReadTimestamps(u32 frame, u32 count, u64* timestamps_ns, bool* valid)
+{
+  const FrameQueries& queries = m_frame_queries[frame];
+  D3D11_QUERY_DATA_TIMESTAMP_DISJOINT disjoint_data;
+  if (D3D::context->GetData(queries.disjoint_query.Get(), &disjoint_data, sizeof(disjoint_data),
+                            D3D11_ASYNC_GETDATA_DONOTFLUSH) != S_OK)
+  {
+    return false;
+  }
+
+  if (disjoint_data.Disjoint || disjoint_data.Frequency == 0)
+  {
+    *valid = false;
+    return true;
+  }
+
+  for (u32 i = 0; i < count; i++)
+  {
+    UINT64 timestamp;
+    if (D3D::context->GetData(queries.timestamp_queries[i].Get(), &timestamp, sizeof(timestamp),
+                              D3D11_ASYNC_GETDATA_DONOTFLUSH) != S_OK)
+    {
+      return false;
+    }
+
+    timestamps_ns[i] = static_cast<u64>(static_cast<double>(timestamp) * 1000000000.0 /
+                                        static_cast<double>(disjoint_data.Frequency));
+  }
+
+  return true;
+}
+}  // namespace DX11
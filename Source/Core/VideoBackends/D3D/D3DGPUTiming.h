@@ -0,0 +1,35 @@
+// Copyright 2021 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+
+#include "VideoBackends/D3D/D3DBase.h"
+#include "VideoCommon/GPUTimingBase.h"
+
+namespace DX11
+{
+class GPUTiming final : public GPUTimingBase
+{
+public:
+  GPUTiming();
+  ~GPUTiming() override;
+
+protected:
+  bool BeginFrameQueries(u32 frame) override;
+  void WriteTimestamp(u32 frame, u32 index) override;
+  void EndFrameQueries(u32 frame, u32 count) override;
+  bool ReadTimestamps(u32 frame, u32 count, u64* timestamps_ns, bool* valid) override;
+
+private:
+  struct FrameQueries
+  {
+    // Timestamps are only meaningful if the GPU clock didn't change while this query was active.
+    ComPtr<ID3D11Query> disjoint_query;
+    std::array<ComPtr<ID3D11Query>, MAX_TIMESTAMPS_PER_FRAME> timestamp_queries;
+  };
+
+  std::array<FrameQueries, NUM_FRAMES> m_frame_queries;
+};
+}  // namespace DX11
@@ -11,6 +11,7 @@
 
 #include "VideoBackends/D3D/D3DBase.h"
 #include "VideoBackends/D3D/D3DBoundingBox.h"
+#include "VideoBackends/D3D/D3DGPUTiming.h"
 #include "VideoBackends/D3D/D3DPerfQuery.h"
 #include "VideoBackends/D3D/D3DRender.h"
 #include "VideoBackends/D3D/D3DSwapChain.h"
@@ -154,6 +155,7 @@ bool VideoBackend::Initialize(const WindowSystemInfo& wsi)
   g_framebuffer_manager = std::make_unique<FramebufferManager>();
   g_texture_cache = std::make_unique<TextureCacheBase>();
   g_perf_query = std::make_unique<PerfQuery>();
+  g_gpu_timing = std::make_unique<GPUTiming>();
   if (!g_vertex_manager->Initialize() || !g_shader_cache->Initialize() ||
       !g_renderer->Initialize() || !g_framebuffer_manager->Initialize() ||
       !g_texture_cache->Initialize())
@@ -174,6 +176,7 @@ void VideoBackend::Shutdown()
 
   BBox::Shutdown();
 
+  g_gpu_timing.reset();
   g_perf_query.reset();
   g_texture_cache.reset();
   g_framebuffer_manager.reset();
@@ -99,26 +99,7 @@ void Renderer::SetPipeline(const AbstractPipeline* pipeline)
   if (m_current_pipeline == dx_pipeline)
     return;
 
-  if (dx_pipeline)
-  {
-    D3D::stateman->SetRasterizerState(dx_pipeline->GetRasterizerState());
-    D3D::stateman->SetDepthState(dx_pipeline->GetDepthState());
-    D3D::stateman->SetBlendState(dx_pipeline->GetBlendState());
-    D3D::stateman->SetPrimitiveTopology(dx_pipeline->GetPrimitiveTopology());
-    D3D::stateman->SetInputLayout(dx_pipeline->GetInputLayout());
-    D3D::stateman->SetVertexShader(dx_pipeline->GetVertexShader());
-    D3D::stateman->SetGeometryShader(dx_pipeline->GetGeometryShader());
-    D3D::stateman->SetPixelShader(dx_pipeline->GetPixelShader());
-    D3D::stateman->SetIntegerRTV(dx_pipeline->UseLogicOp());
-  }
-  else
-  {
-    // These will be destroyed at pipeline destruction.
-    D3D::stateman->SetInputLayout(nullptr);
-    D3D::stateman->SetVertexShader(nullptr);
-    D3D::stateman->SetGeometryShader(nullptr);
-    D3D::stateman->SetPixelShader(nullptr);
-  }
+  D3D::stateman->SetPipeline(dx_pipeline);
 }
 
 void Renderer::SetScissorRect(const MathUtil::Rectangle<int>& rc)
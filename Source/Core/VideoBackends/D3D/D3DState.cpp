@@ -11,6 +11,7 @@
 
 #include "VideoBackends/D3D/D3DBase.h"
 #include "VideoBackends/D3D/D3DState.h"
+#include "VideoBackends/D3D/DXPipeline.h"
 #include "VideoBackends/D3D/DXTexture.h"
 #include "VideoBackends/D3DCommon/D3DCommon.h"
 #include "VideoCommon/VideoConfig.h"
@@ -137,17 +138,18 @@ void StateManager::Apply()
     }
   }
 
-  if (m_dirtyFlags & DirtyFlag_BlendState)
+  if ((m_dirtyFlags & DirtyFlag_BlendState) && m_current.blendState != m_pending.blendState)
   {
     D3D::context->OMSetBlendState(m_pending.blendState, nullptr, 0xFFFFFFFF);
     m_current.blendState = m_pending.blendState;
   }
-  if (m_dirtyFlags & DirtyFlag_DepthState)
+  if ((m_dirtyFlags & DirtyFlag_DepthState) && m_current.depthState != m_pending.depthState)
   {
     D3D::context->OMSetDepthStencilState(m_pending.depthState, 0);
     m_current.depthState = m_pending.depthState;
   }
-  if (m_dirtyFlags & DirtyFlag_RasterizerState)
+  if ((m_dirtyFlags & DirtyFlag_RasterizerState) &&
+      m_current.rasterizerState != m_pending.rasterizerState)
   {
     D3D::context->RSSetState(m_pending.rasterizerState);
     m_current.rasterizerState = m_pending.rasterizerState;
@@ -173,31 +175,68 @@ void StateManager::ApplyTextures()
        (DirtyFlag_Sampler0 | DirtyFlag_Sampler1 | DirtyFlag_Sampler2 | DirtyFlag_Sampler3 |
         DirtyFlag_Sampler4 | DirtyFlag_Sampler5 | DirtyFlag_Sampler6 | DirtyFlag_Sampler7)) >>
       samplerMaskShift;
+  // Runs of consecutive changed slots are bound with a single call.
   while (dirtyTextures)
   {
-    const int index = Common::LeastSignificantSetBit(dirtyTextures);
-    if (m_current.textures[index] != m_pending.textures[index])
+    const int start = Common::LeastSignificantSetBit(dirtyTextures);
+    int end = start;
+    for (; end < static_cast<int>(m_pending.textures.size()); end++)
     {
-      D3D::context->PSSetShaderResources(index, 1, &m_pending.textures[index]);
-      m_current.textures[index] = m_pending.textures[index];
+      if (!(dirtyTextures & (1 << end)) || m_current.textures[end] == m_pending.textures[end])
+        break;
+
+      m_current.textures[end] = m_pending.textures[end];
     }
 
-    dirtyTextures &= ~(1 << index);
+    if (end > start)
+      D3D::context->PSSetShaderResources(start, end - start, &m_pending.textures[start]);
+    dirtyTextures &= ~((2u << std::max(start, end - 1)) - 1);
   }
 
   while (dirtySamplers)
   {
-    const int index = Common::LeastSignificantSetBit(dirtySamplers);
-    if (m_current.samplers[index] != m_pending.samplers[index])
+    const int start = Common::LeastSignificantSetBit(dirtySamplers);
+    int end = start;
+    for (; end < static_cast<int>(m_pending.samplers.size()); end++)
     {
-      D3D::context->PSSetSamplers(index, 1, &m_pending.samplers[index]);
-      m_current.samplers[index] = m_pending.samplers[index];
+      if (!(dirtySamplers & (1 << end)) || m_current.samplers[end] == m_pending.samplers[end])
+        break;
+
+      m_current.samplers[end] = m_pending.samplers[end];
     }
 
-    dirtySamplers &= ~(1 << index);
+    if (end > start)
+      D3D::context->PSSetSamplers(start, end - start, &m_pending.samplers[start]);
+    dirtySamplers &= ~((2u << std::max(start, end - 1)) - 1);
   }
 }
 
+void StateManager::SetPipeline(const DXPipeline* pipeline)
+{
+  if (pipeline)
+  {
+    m_pending.rasterizerState = pipeline->GetRasterizerState();
+    m_pending.depthState = pipeline->GetDepthState();
+    m_pending.blendState = pipeline->GetBlendState();
+    m_pending.topology = pipeline->GetPrimitiveTopology();
+    m_pending.inputLayout = pipeline->GetInputLayout();
+    m_pending.vertexShader = pipeline->GetVertexShader();
+    m_pending.geometryShader = pipeline->GetGeometryShader();
+    m_pending.pixelShader = pipeline->GetPixelShader();
+    SetIntegerRTV(pipeline->UseLogicOp());
+  }
+  else
+  {
+    // These will be destroyed at pipeline destruction.
+    m_pending.inputLayout = nullptr;
+    m_pending.vertexShader = nullptr;
+    m_pending.geometryShader = nullptr;
+    m_pending.pixelShader = nullptr;
+  }
+
+  m_dirtyFlags |= DirtyFlag_Pipeline;
+}
+
 u32 StateManager::UnsetTexture(ID3D11ShaderResourceView* srv)
 {
   u32 mask = 0;
@@ -303,9 +342,8 @@ StateCache::~StateCache() = default;
 ID3D11SamplerState* StateCache::Get(SamplerState state)
 {
   std::lock_guard<std::mutex> guard(m_lock);
-  auto it = m_sampler.find(state.hex);
-  if (it != m_sampler.end())
-    return it->second.Get();
+  if (const auto* state_object = m_sampler.Find(state.hex))
+    return state_object->Get();
 
   D3D11_SAMPLER_DESC sampdc = CD3D11_SAMPLER_DESC(CD3D11_DEFAULT());
   if (state.mipmap_filter == SamplerState::Filter::Linear)
@@ -348,15 +386,14 @@ ID3D11SamplerState* StateCache::Get(SamplerState state)
   ComPtr<ID3D11SamplerState> res;
   HRESULT hr = D3D::device->CreateSamplerState(&sampdc, res.GetAddressOf());
   CHECK(SUCCEEDED(hr), "Creating D3D sampler state failed");
-  return m_sampler.emplace(state.hex, std::move(res)).first->second.Get();
+  return m_sampler.TryEmplace(state.hex, std::move(res)).first->Get();
 }
 
 ID3D11BlendState* StateCache::Get(BlendingState state)
 {
   std::lock_guard<std::mutex> guard(m_lock);
-  auto it = m_blend.find(state.hex);
-  if (it != m_blend.end())
-    return it->second.Get();
+  if (const auto* state_object = m_blend.Find(state.hex))
+    return state_object->Get();
 
   if (state.logicopenable && g_ActiveConfig.backend_info.bSupportsLogicOp)
   {
@@ -383,7 +420,7 @@ ID3D11BlendState* StateCache::Get(BlendingState state)
     HRESULT hr = D3D::device1->CreateBlendState1(&desc, res.GetAddressOf());
     if (SUCCEEDED(hr))
     {
-      return m_blend.emplace(state.hex, std::move(res)).first->second.Get();
+      return m_blend.TryEmplace(state.hex, std::move(res)).first->Get();
     }
     WARN_LOG_FMT(VIDEO, "Creating D3D blend state failed with an error: {:08X}", hr);
   }
@@ -425,15 +462,14 @@ ID3D11BlendState* StateCache::Get(BlendingState state)
   ComPtr<ID3D11BlendState> res;
   HRESULT hr = D3D::device->CreateBlendState(&desc, res.GetAddressOf());
   CHECK(SUCCEEDED(hr), "Creating D3D blend state failed");
-  return m_blend.emplace(state.hex, std::move(res)).first->second.Get();
+  return m_blend.TryEmplace(state.hex, std::move(res)).first->Get();
 }
 
 ID3D11RasterizerState* StateCache::Get(RasterizationState state)
 {
   std::lock_guard<std::mutex> guard(m_lock);
-  auto it = m_raster.find(state.hex);
-  if (it != m_raster.end())
-    return it->second.Get();
+  if (const auto* state_object = m_raster.Find(state.hex))
+    return state_object->Get();
 
   static constexpr std::array<D3D11_CULL_MODE, 4> cull_modes = {
       {D3D11_CULL_NONE, D3D11_CULL_BACK, D3D11_CULL_FRONT, D3D11_CULL_BACK}};
@@ -446,15 +482,14 @@ ID3D11RasterizerState* StateCache::Get(RasterizationState state)
   ComPtr<ID3D11RasterizerState> res;
   HRESULT hr = D3D::device->CreateRasterizerState(&desc, res.GetAddressOf());
   CHECK(SUCCEEDED(hr), "Creating D3D rasterizer state failed");
-  return m_raster.emplace(state.hex, std::move(res)).first->second.Get();
+  return m_raster.TryEmplace(state.hex, std::move(res)).first->Get();
 }
 
 ID3D11DepthStencilState* StateCache::Get(DepthState state)
 {
   std::lock_guard<std::mutex> guard(m_lock);
-  auto it = m_depth.find(state.hex);
-  if (it != m_depth.end())
-    return it->second.Get();
+  if (const auto* state_object = m_depth.Find(state.hex))
+    return state_object->Get();
 
   D3D11_DEPTH_STENCIL_DESC depthdc = CD3D11_DEPTH_STENCIL_DESC(CD3D11_DEFAULT());
 
@@ -488,7 +523,7 @@ ID3D11DepthStencilState* StateCache::Get(DepthState state)
   ComPtr<ID3D11DepthStencilState> res;
   HRESULT hr = D3D::device->CreateDepthStencilState(&depthdc, res.GetAddressOf());
   CHECK(SUCCEEDED(hr), "Creating D3D depth stencil state failed");
-  return m_depth.emplace(state.hex, std::move(res)).first->second.Get();
+  return m_depth.TryEmplace(state.hex, std::move(res)).first->Get();
 }
 
 D3D11_PRIMITIVE_TOPOLOGY StateCache::GetPrimitiveTopology(PrimitiveType primitive)
@@ -7,16 +7,17 @@
 #include <cstddef>
 #include <memory>
 #include <mutex>
-#include <unordered_map>
 
 #include "Common/BitField.h"
 #include "Common/CommonTypes.h"
+#include "Common/FlatHashMap.h"
 #include "VideoBackends/D3D/D3DBase.h"
 #include "VideoCommon/RenderState.h"
 
 namespace DX11
 {
 class DXFramebuffer;
+class DXPipeline;
 
 class StateCache
 {
@@ -34,10 +35,11 @@ public:
   static D3D11_PRIMITIVE_TOPOLOGY GetPrimitiveTopology(PrimitiveType primitive);
 
 private:
-  std::unordered_map<u32, ComPtr<ID3D11DepthStencilState>> m_depth;
-  std::unordered_map<u32, ComPtr<ID3D11RasterizerState>> m_raster;
-  std::unordered_map<u32, ComPtr<ID3D11BlendState>> m_blend;
-  std::unordered_map<SamplerState::StorageType, ComPtr<ID3D11SamplerState>> m_sampler;
+  // Looked up for every sampler and pipeline change, keyed by the packed state.
+  Common::FlatHashMap<u32, ComPtr<ID3D11DepthStencilState>> m_depth;
+  Common::FlatHashMap<u32, ComPtr<ID3D11RasterizerState>> m_raster;
+  Common::FlatHashMap<u32, ComPtr<ID3D11BlendState>> m_blend;
+  Common::FlatHashMap<SamplerState::StorageType, ComPtr<ID3D11SamplerState>> m_sampler;
   std::mutex m_lock;
 };
 
@@ -205,6 +207,10 @@ public:
     m_pending.use_integer_rtv = enable;
   }
 
+  // Sets all of the pipeline's shaders and state objects at once. Apply() compares each of them
+  // with what is bound, so only the ones which differ from the previous pipeline are rebound.
+  void SetPipeline(const DXPipeline* pipeline);
+
   // removes currently set texture from all slots, returns mask of previously bound slots
   u32 UnsetTexture(ID3D11ShaderResourceView* srv);
   void SetTextureByMask(u32 textureSlotMask, ID3D11ShaderResourceView* srv);
@@ -256,7 +262,11 @@ private:
     DirtyFlag_BlendState = 1 << 25,
     DirtyFlag_DepthState = 1 << 26,
     DirtyFlag_RasterizerState = 1 << 27,
-    DirtyFlag_Framebuffer = 1 << 28
+    DirtyFlag_Framebuffer = 1 << 28,
+
+    DirtyFlag_Pipeline = DirtyFlag_PixelShader | DirtyFlag_VertexShader |
+                         DirtyFlag_GeometryShader | DirtyFlag_InputAssembler |
+                         DirtyFlag_BlendState | DirtyFlag_DepthState | DirtyFlag_RasterizerState
   };
 
   u32 m_dirtyFlags = ~0u;
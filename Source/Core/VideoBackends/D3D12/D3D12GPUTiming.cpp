@@ -0,0 +1,109 @@
+// Copyright 2021 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoBackends/D3D12/D3D12GPUTiming.h"
+
+#include <cstring>
+
+#include "VideoBackends/D3D12/Common.h"
+
+namespace DX12
+{
+GPUTiming::GPUTiming(ComPtr<ID3D12QueryHeap> query_heap, ComPtr<ID3D12Resource> readback_buffer,
+                     u64 timestamp_frequency)
+    : m_query_heap(std::move(query_heap)), m_readback_buffer(std::move(readback_buffer)),
+      m_timestamp_frequency(timestamp_frequency)
+{
+}
+
+GPUTiming::~GPUTiming() = default;
+
+std::unique_ptr<GPUTiming> GPUTiming::Create()
+{
+  u64 timestamp_frequency;
+  HRESULT hr = g_dx_context->GetCommandQueue()->GetTimestampFrequency(&timestamp_frequency);
+  if (FAILED(hr) || timestamp_frequency == 0)
+    return nullptr;
+
+  constexpr u32 query_count = NUM_FRAMES * MAX_TIMESTAMPS_PER_FRAME;
+  constexpr D3D12_QUERY_HEAP_DESC desc = {D3D12_QUERY_HEAP_TYPE_TIMESTAMP, query_count};
+  ComPtr<ID3D12QueryHeap> query_heap;
+  hr = g_dx_context->GetDevice()->CreateQueryHeap(&desc, IID_PPV_ARGS(&query_heap));
+  CHECK(SUCCEEDED(hr), "Failed to create timestamp query heap");
+  if (FAILED(hr))
+    return nullptr;
+
+  constexpr D3D12_HEAP_PROPERTIES heap_properties = {D3D12_HEAP_TYPE_READBACK};
+  constexpr D3D12_RESOURCE_DESC resource_desc = {D3D12_RESOURCE_DIMENSION_BUFFER,
+                                                 0,
+                                                 query_count * sizeof(u64),
+                                                 1,
+                                                 1,
+                                                 1,
+                                                 DXGI_FORMAT_UNKNOWN,
+                                                 {1, 0},
+                                                 D3D12_TEXTURE_LAYOUT_ROW_MAJOR,
+                                                 D3D12_RESOURCE_FLAG_NONE};
+  ComPtr<ID3D12Resource> readback_buffer;
+  hr = g_dx_context->GetDevice()->CreateCommittedResource(
+      &heap_properties, D3D12_HEAP_FLAG_NONE, &resource_desc, D3D12_RESOURCE_STATE_COPY_DEST,
+      nullptr, IID_PPV_ARGS(&readback_buffer));
+  CHECK(SUCCEEDED(hr), "Failed to create timestamp readback buffer");
+  if (FAILED(hr))
+    return nullptr;
+
+  return std::make_unique<GPUTiming>(std::move(query_heap), std::move(readback_buffer),
+                                     timestamp_frequency);
+}
+
+bool GPUTiming::BeginFrameQueries(u32 frame)
+{
+  // Timestamp queries don't need to be reset before they are reused.
+  return true;
+}
+
+void GPUTiming::WriteTimestamp(u32 frame, u32 index)
+{
+  g_dx_context->GetCommandList()->EndQuery(m_query_heap.Get(), D3D12_QUERY_TYPE_TIMESTAMP,
+                                           frame * MAX_TIMESTAMPS_PER_FRAME + index);
+}
+
+void GPUTiming::EndFrameQueries(u32 frame, u32 count)
+{
+  const u32 first_query = frame * MAX_TIMESTAMPS_PER_FRAME;
+  g_dx_context->GetCommandList()->ResolveQueryData(m_query_heap.Get(), D3D12_QUERY_TYPE_TIMESTAMP,
+                                                   first_query, count, m_readback_buffer.Get(),
+                                                   first_query * sizeof(u64));
+  m_fence_values[frame] = g_dx_context->GetCurrentFenceValue();
+}
+
+bool GPUTiming::ReadTimestamps(u32 frame, u32 count, u64* timestamps_ns, bool* valid)
+{
+  if (m_fence_values[frame] > g_dx_context->GetCompletedFenceValue())
+    return false;
+
+  const u32 first_query = frame * MAX_TIMESTAMPS_PER_FRAME;
+  const D3D12_RANGE read_range = {first_query * sizeof(u64), (first_query + count) * sizeof(u64)};
+  u8* mapped_ptr;
+  HRESULT hr = m_readback_buffer->Map(0, &read_range, reinterpret_cast<void**>(&mapped_ptr));
+  CHECK(SUCCEEDED(hr), "Failed to map timestamp readback buffer");
+  if (FAILED(hr))
+  {
+    *valid = false;
+    return true;
+  }
+
+  std::memcpy(timestamps_ns, mapped_ptr + read_range.Begin, count * sizeof(u64));
+
+  constexpr D3D12_RANGE write_range = {0, 0};
+  m_readback_buffer->Unmap(0, &write_range);
+
+  for (u32 i = 0; i < count; i++)
+  {
+    timestamps_ns[i] = static_cast<u64>(static_cast<double>(timestamps_ns[i]) * 1000000000.0 /
+                                        static_cast<double>(m_timestamp_frequency));
+  }
+
+  return true;
+}
+}  // namespace DX12
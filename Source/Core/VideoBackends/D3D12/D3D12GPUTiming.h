@@ -0,0 +1,38 @@
+// Copyright 2021 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <memory>
+
+#include "VideoBackends/D3D12/DX12Context.h"
+#include "VideoCommon/GPUTimingBase.h"
+
+namespace DX12
+{
+class GPUTiming final : public GPUTimingBase
+{
+public:
+  GPUTiming(ComPtr<ID3D12QueryHeap> query_heap, ComPtr<ID3D12Resource> readback_buffer,
+            u64 timestamp_frequency);
+  ~GPUTiming() override;
+
+  // Returns null if the command queue doesn't support timestamps.
+  static std::unique_ptr<GPUTiming> Create();
+
+protected:
+  bool BeginFrameQueries(u32 frame) override;
+  void WriteTimestamp(u32 frame, u32 index) override;
+  void EndFrameQueries(u32 frame, u32 count) override;
+  bool ReadTimestamps(u32 frame, u32 count, u64* timestamps_ns, bool* valid) override;
+
+private:
+  ComPtr<ID3D12QueryHeap> m_query_heap;
+  ComPtr<ID3D12Resource> m_readback_buffer;
+  u64 m_timestamp_frequency;
+
+  // Fence value of the command list which resolves the timestamps of each frame.
+  std::array<u64, NUM_FRAMES> m_fence_values = {};
+};
+}  // namespace DX12
@@ -442,11 +442,24 @@ void Renderer::PresentBackbuffer()
   m_current_framebuffer = nullptr;
 
   m_swap_chain->GetCurrentTexture()->TransitionToState(D3D12_RESOURCE_STATE_PRESENT);
+  if (g_ActiveConfig.iMaxFramesInFlight > 0)
+    m_presented_fence_values.push_back(g_dx_context->GetCurrentFenceValue());
   ExecuteCommandList(false);
 
   m_swap_chain->Present();
 }
 
+void Renderer::WaitForFramesInFlight(u32 max_frames)
+{
+  while (!m_presented_fence_values.empty() &&
+         (m_presented_fence_values.size() > max_frames ||
+          m_presented_fence_values.front() <= g_dx_context->GetCompletedFenceValue()))
+  {
+    g_dx_context->WaitForFence(m_presented_fence_values.front());
+    m_presented_fence_values.pop_front();
+  }
+}
+
 void Renderer::OnConfigChanged(u32 bits)
 {
   ::Renderer::OnConfigChanged(bits);
@@ -665,16 +678,13 @@ void Renderer::UpdateDescriptorTables()
 
 bool Renderer::UpdateSRVDescriptorTable()
 {
-  static constexpr std::array<UINT, MAX_TEXTURES> src_sizes = {1, 1, 1, 1, 1, 1, 1, 1};
-  DescriptorHandle dst_base_handle;
-  const UINT dst_handle_sizes = 8;
-  if (!g_dx_context->GetDescriptorAllocator()->Allocate(MAX_TEXTURES, &dst_base_handle))
+  static_assert(MAX_TEXTURES == DescriptorAllocator::NUM_TEXTURE_TABLE_DESCRIPTORS);
+  if (!g_dx_context->GetDescriptorAllocator()->GetTextureTableHandle(m_state.textures,
+                                                                      &m_state.srv_descriptor_base))
+  {
     return false;
+  }
 
-  g_dx_context->GetDevice()->CopyDescriptors(
-      1, &dst_base_handle.cpu_handle, &dst_handle_sizes, MAX_TEXTURES, m_state.textures.data(),
-      src_sizes.data(), D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-  m_state.srv_descriptor_base = dst_base_handle.gpu_handle;
   m_dirty_bits = (m_dirty_bits & ~DirtyState_Textures) | DirtyState_SRV_Descriptor;
   return true;
 }
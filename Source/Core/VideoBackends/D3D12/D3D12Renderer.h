@@ -4,6 +4,8 @@
 #pragma once
 
 #include <d3d12.h>
+#include <deque>
+
 #include "VideoBackends/D3D12/DescriptorAllocator.h"
 #include "VideoBackends/D3D12/DescriptorHeapManager.h"
 #include "VideoCommon/RenderBase.h"
@@ -74,6 +76,7 @@ public:
                              u32 groups_z) override;
   void BindBackbuffer(const ClearColor& clear_color = {}) override;
   void PresentBackbuffer() override;
+  void WaitForFramesInFlight(u32 max_frames) override;
 
   // Completes the current render pass, executes the command buffer, and restores state ready for
   // next render. Use when you want to kick the current buffer to make room for new data.
@@ -172,5 +175,8 @@ private:
     bool using_integer_rtv = false;
   } m_state;
   u32 m_dirty_bits = DirtyState_All;
+
+  // Fence values of the command lists which presented the frames still in flight.
+  std::deque<u64> m_presented_fence_values;
 };
 }  // namespace DX12
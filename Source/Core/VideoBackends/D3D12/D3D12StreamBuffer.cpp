@@ -8,6 +8,7 @@
 
 #include "Common/Align.h"
 #include "Common/Assert.h"
+#include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 
 #include "VideoBackends/D3D12/DX12Context.h"
@@ -43,19 +44,35 @@ bool StreamBuffer::AllocateBuffer(u32 size)
                                              D3D12_TEXTURE_LAYOUT_ROW_MAJOR,
                                              D3D12_RESOURCE_FLAG_NONE};
 
+  ID3D12Resource* buffer;
   HRESULT hr = g_dx_context->GetDevice()->CreateCommittedResource(
       &heap_properties, D3D12_HEAP_FLAG_NONE, &resource_desc, D3D12_RESOURCE_STATE_GENERIC_READ,
-      nullptr, IID_PPV_ARGS(&m_buffer));
+      nullptr, IID_PPV_ARGS(&buffer));
   CHECK(SUCCEEDED(hr), "Allocate buffer");
   if (FAILED(hr))
     return false;
 
   static const D3D12_RANGE read_range = {};
-  hr = m_buffer->Map(0, &read_range, reinterpret_cast<void**>(&m_host_pointer));
+  u8* host_pointer;
+  hr = buffer->Map(0, &read_range, reinterpret_cast<void**>(&host_pointer));
   CHECK(SUCCEEDED(hr), "Map buffer");
   if (FAILED(hr))
+  {
+    buffer->Release();
     return false;
+  }
+
+  // Replacing a buffer, release it after the command lists using it have executed.
+  if (m_buffer)
+  {
+    const D3D12_RANGE written_range = {0, m_size};
+    m_buffer->Unmap(0, &written_range);
+    g_dx_context->DeferResourceDestruction(m_buffer);
+    m_buffer->Release();
+  }
 
+  m_buffer = buffer;
+  m_host_pointer = host_pointer;
   m_size = size;
   m_gpu_pointer = m_buffer->GetGPUVirtualAddress();
   m_current_offset = 0;
@@ -77,6 +94,49 @@ bool StreamBuffer::ReserveMemory(u32 num_bytes, u32 alignment)
     return false;
   }
 
+  if (ReserveFreeMemory(num_bytes, alignment))
+    return true;
+
+  // Can we find a fence to wait on that will give us enough memory?
+  if (WaitForClearSpace(required_bytes))
+  {
+    m_current_offset = Common::AlignUp(m_current_offset, alignment);
+    m_last_allocation_size = num_bytes;
+    return true;
+  }
+
+  // We tried everything we could, and still couldn't get anything. This means that too much space
+  // in the buffer is being used by the command buffer currently being recorded. Therefore, the
+  // only option is to execute it, and wait until it's done.
+  return false;
+}
+
+bool StreamBuffer::ReserveMemoryOrGrow(u32 num_bytes, u32 alignment, u32 max_size)
+{
+  const u32 required_bytes = num_bytes + alignment;
+  if (required_bytes <= m_size && ReserveFreeMemory(num_bytes, alignment))
+    return true;
+
+  const u32 new_size = std::min(max_size, std::max(m_size * 2, required_bytes));
+  if (new_size > m_size && new_size >= required_bytes)
+  {
+    if (AllocateBuffer(new_size))
+    {
+      // The new buffer is empty, so this goes at the start.
+      m_last_allocation_size = num_bytes;
+      return true;
+    }
+
+    WARN_LOG_FMT(VIDEO, "Failed to grow stream buffer to {} bytes", new_size);
+  }
+
+  return ReserveMemory(num_bytes, alignment);
+}
+
+bool StreamBuffer::ReserveFreeMemory(u32 num_bytes, u32 alignment)
+{
+  const u32 required_bytes = num_bytes + alignment;
+
   // Is the GPU behind or up to date with our current offset?
   UpdateCurrentFencePosition();
   if (m_current_offset >= m_current_gpu_position)
@@ -115,17 +175,6 @@ bool StreamBuffer::ReserveMemory(u32 num_bytes, u32 alignment)
     }
   }
 
-  // Can we find a fence to wait on that will give us enough memory?
-  if (WaitForClearSpace(required_bytes))
-  {
-    m_current_offset = Common::AlignUp(m_current_offset, alignment);
-    m_last_allocation_size = num_bytes;
-    return true;
-  }
-
-  // We tried everything we could, and still couldn't get anything. This means that too much space
-  // in the buffer is being used by the command buffer currently being recorded. Therefore, the
-  // only option is to execute it, and wait until it's done.
   return false;
 }
 
@@ -32,10 +32,18 @@ public:
   bool ReserveMemory(u32 num_bytes, u32 alignment);
   void CommitMemory(u32 final_num_bytes);
 
+  // Like ReserveMemory(), but if the free space is still in use by the GPU, the buffer is replaced
+  // with a larger one of at most max_size bytes instead of waiting or failing. Previous
+  // allocations stay valid until the command lists using them have executed.
+  bool ReserveMemoryOrGrow(u32 num_bytes, u32 alignment, u32 max_size);
+
 private:
   void UpdateCurrentFencePosition();
   void UpdateGPUPosition();
 
+  // Allocates from the space the GPU is already done with, without waiting.
+  bool ReserveFreeMemory(u32 num_bytes, u32 alignment);
+
   // Waits for as many fences as needed to allocate num_bytes bytes from the buffer.
   bool WaitForClearSpace(u32 num_bytes);
 
@@ -15,6 +15,7 @@
 #include "VideoBackends/D3D12/Common.h"
 #include "VideoBackends/D3D12/D3D12StreamBuffer.h"
 #include "VideoBackends/D3D12/DescriptorHeapManager.h"
+#include "VideoCommon/GPUTimingBase.h"
 #include "VideoCommon/VideoConfig.h"
 
 namespace DX12
@@ -468,6 +469,9 @@ void DXContext::MoveToNextCommandList()
 
 void DXContext::ExecuteCommandList(bool wait_for_completion)
 {
+  if (g_gpu_timing)
+    g_gpu_timing->EndSubmission();
+
   CommandListResources& res = m_command_lists[m_current_command_list];
 
   // Close and queue command list.
@@ -484,6 +488,9 @@ void DXContext::ExecuteCommandList(bool wait_for_completion)
   MoveToNextCommandList();
   if (wait_for_completion)
     WaitForFence(res.ready_fence_value);
+
+  if (g_gpu_timing)
+    g_gpu_timing->BeginSubmission();
 }
 
 void DXContext::DeferResourceDestruction(ID3D12Resource* resource)
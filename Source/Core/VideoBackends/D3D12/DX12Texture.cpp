@@ -197,12 +197,14 @@ bool DXTexture::CreateUAVDescriptor()
 void DXTexture::Load(u32 level, u32 width, u32 height, u32 row_length, const u8* buffer,
                      size_t buffer_size)
 {
-  // Textures greater than 1024*1024 will be put in staging textures that are released after
-  // execution instead. A 2048x2048 texture is 16MB, and we'd only fit four of these in our
-  // streaming buffer and be blocking frequently. Games are unlikely to have textures this
-  // large anyway, so it's only really an issue for HD texture packs, and memory is not
-  // a limiting factor in these scenarios anyway.
-  constexpr u32 STAGING_BUFFER_UPLOAD_THRESHOLD = 1024 * 1024 * 4;
+  // Rather than executing the command list when the free space in the texture upload buffer is
+  // still in use by the GPU, the buffer grows up to this size.
+  constexpr u32 UPLOAD_BUFFER_MAX_SIZE = 256 * 1024 * 1024;
+
+  // Textures larger than this are put in staging buffers that are released after execution
+  // instead, so that a single huge texture from an HD texture pack doesn't keep the upload buffer
+  // at its maximum size.
+  constexpr u32 STAGING_BUFFER_UPLOAD_THRESHOLD = 64 * 1024 * 1024;
 
   // Determine the stride in the stream buffer. It must be aligned to 256 bytes.
   const u32 block_size = GetBlockSizeForFormat(GetFormat());
@@ -235,8 +237,8 @@ void DXTexture::Load(u32 level, u32 width, u32 height, u32 row_length, const u8*
   }
   else
   {
-    if (!g_dx_context->GetTextureUploadBuffer().ReserveMemory(
-            upload_size, D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT))
+    if (!g_dx_context->GetTextureUploadBuffer().ReserveMemoryOrGrow(
+            upload_size, D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT, UPLOAD_BUFFER_MAX_SIZE))
     {
       WARN_LOG_FMT(VIDEO,
                    "Executing command list while waiting for space in texture upload buffer");
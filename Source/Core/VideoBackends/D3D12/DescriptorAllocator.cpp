@@ -43,6 +43,35 @@ bool DescriptorAllocator::Allocate(u32 num_handles, DescriptorHandle* out_base_h
 void DescriptorAllocator::Reset()
 {
   m_current_offset = 0;
+  m_texture_table_map.clear();
+}
+
+bool DescriptorAllocator::GetTextureTableHandle(const TextureTable& table,
+                                                D3D12_GPU_DESCRIPTOR_HANDLE* handle)
+{
+  std::array<SIZE_T, NUM_TEXTURE_TABLE_DESCRIPTORS> key;
+  for (u32 i = 0; i < NUM_TEXTURE_TABLE_DESCRIPTORS; i++)
+    key[i] = table[i].ptr;
+
+  auto it = m_texture_table_map.find(key);
+  if (it != m_texture_table_map.end())
+  {
+    *handle = it->second;
+    return true;
+  }
+
+  DescriptorHandle allocation;
+  if (!Allocate(NUM_TEXTURE_TABLE_DESCRIPTORS, &allocation))
+    return false;
+
+  static constexpr std::array<UINT, NUM_TEXTURE_TABLE_DESCRIPTORS> source_sizes = {
+      {1, 1, 1, 1, 1, 1, 1, 1}};
+  g_dx_context->GetDevice()->CopyDescriptors(
+      1, &allocation.cpu_handle, &NUM_TEXTURE_TABLE_DESCRIPTORS, NUM_TEXTURE_TABLE_DESCRIPTORS,
+      table.data(), source_sizes.data(), D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+  *handle = allocation.gpu_handle;
+  m_texture_table_map.emplace(key, allocation.gpu_handle);
+  return true;
 }
 
 bool operator==(const SamplerStateSet& lhs, const SamplerStateSet& rhs)
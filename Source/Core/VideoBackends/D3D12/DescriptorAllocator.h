@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <array>
 #include <map>
 #include "VideoBackends/D3D12/DescriptorHeapManager.h"
 
@@ -22,6 +23,12 @@ public:
   bool Allocate(u32 num_handles, DescriptorHandle* out_base_handle);
   void Reset();
 
+  // Returns a table with copies of the given texture descriptors. Tables are reused until the
+  // allocator is reset, as the source descriptors aren't freed before the command list completes.
+  static constexpr u32 NUM_TEXTURE_TABLE_DESCRIPTORS = 8;
+  using TextureTable = std::array<D3D12_CPU_DESCRIPTOR_HANDLE, NUM_TEXTURE_TABLE_DESCRIPTORS>;
+  bool GetTextureTableHandle(const TextureTable& table, D3D12_GPU_DESCRIPTOR_HANDLE* handle);
+
 protected:
   ComPtr<ID3D12DescriptorHeap> m_descriptor_heap;
   u32 m_descriptor_increment_size = 0;
@@ -30,6 +37,9 @@ protected:
 
   D3D12_CPU_DESCRIPTOR_HANDLE m_heap_base_cpu = {};
   D3D12_GPU_DESCRIPTOR_HANDLE m_heap_base_gpu = {};
+
+  std::map<std::array<SIZE_T, NUM_TEXTURE_TABLE_DESCRIPTORS>, D3D12_GPU_DESCRIPTOR_HANDLE>
+      m_texture_table_map;
 };
 
 struct SamplerStateSet final
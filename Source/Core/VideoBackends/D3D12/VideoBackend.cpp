@@ -9,6 +9,7 @@
 #include "Core/ConfigManager.h"
 
 #include "VideoBackends/D3D12/Common.h"
+#include "VideoBackends/D3D12/D3D12GPUTiming.h"
 #include "VideoBackends/D3D12/D3D12PerfQuery.h"
 #include "VideoBackends/D3D12/D3D12Renderer.h"
 #include "VideoBackends/D3D12/D3D12SwapChain.h"
@@ -130,6 +131,7 @@ bool VideoBackend::Initialize(const WindowSystemInfo& wsi)
   g_framebuffer_manager = std::make_unique<FramebufferManager>();
   g_texture_cache = std::make_unique<TextureCacheBase>();
   g_perf_query = std::make_unique<PerfQuery>();
+  g_gpu_timing = GPUTiming::Create();
 
   if (!g_vertex_manager->Initialize() || !g_shader_cache->Initialize() ||
       !g_renderer->Initialize() || !g_framebuffer_manager->Initialize() ||
@@ -156,6 +158,7 @@ void VideoBackend::Shutdown()
   if (g_renderer)
     g_renderer->Shutdown();
 
+  g_gpu_timing.reset();
   g_perf_query.reset();
   g_texture_cache.reset();
   g_framebuffer_manager.reset();
@@ -5,6 +5,9 @@
 
 // This backend tries not to do anything in the backend,
 // but everything in VideoCommon.
+//
+// With NullBenchmarkMode, it also does the host-side copies of the other backends, so that the
+// GPU thread front end can be profiled as if it were submitting to a real device.
 
 #include "VideoBackends/Null/NullRender.h"
 #include "VideoBackends/Null/NullVertexManager.h"
@@ -3,8 +3,17 @@
 
 #include "VideoBackends/Null/NullTexture.h"
 
+#include <cstring>
+#include <vector>
+
+#include "VideoCommon/VideoConfig.h"
+
 namespace Null
 {
+// In benchmark mode, texture data is copied here instead of into an upload buffer. Textures are
+// only loaded on the GPU thread.
+static std::vector<u8> s_upload_buffer;
+
 NullTexture::NullTexture(const TextureConfig& tex_config) : AbstractTexture(tex_config)
 {
 }
@@ -23,6 +32,12 @@ void NullTexture::ResolveFromTexture(const AbstractTexture* src,
 void NullTexture::Load(u32 level, u32 width, u32 height, u32 row_length, const u8* buffer,
                        size_t buffer_size)
 {
+  if (!g_ActiveConfig.bNullBenchmarkMode)
+    return;
+
+  if (s_upload_buffer.size() < buffer_size)
+    s_upload_buffer.resize(buffer_size);
+  std::memcpy(s_upload_buffer.data(), buffer, buffer_size);
 }
 
 NullStagingTexture::NullStagingTexture(StagingTextureType type, const TextureConfig& config)
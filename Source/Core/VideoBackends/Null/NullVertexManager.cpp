@@ -3,12 +3,66 @@
 
 #include "VideoBackends/Null/NullVertexManager.h"
 
+#include <cstring>
+
+#include "VideoCommon/GeometryShaderManager.h"
+#include "VideoCommon/PixelShaderManager.h"
+#include "VideoCommon/Statistics.h"
+#include "VideoCommon/VertexShaderManager.h"
+#include "VideoCommon/VideoConfig.h"
+
 namespace Null
 {
+// Same size as the uniform stream buffers of the other backends.
+constexpr u32 UNIFORM_BUFFER_SIZE = 2 * 1024 * 1024;
+
 VertexManager::VertexManager() = default;
 
 VertexManager::~VertexManager() = default;
 
+void VertexManager::UploadUniforms()
+{
+  if (!g_ActiveConfig.bNullBenchmarkMode)
+    return;
+
+  if (VertexShaderManager::dirty)
+  {
+    StreamUniforms(&VertexShaderManager::constants, sizeof(VertexShaderConstants));
+    VertexShaderManager::dirty = false;
+  }
+  if (GeometryShaderManager::dirty)
+  {
+    StreamUniforms(&GeometryShaderManager::constants, sizeof(GeometryShaderConstants));
+    GeometryShaderManager::dirty = false;
+  }
+  if (PixelShaderManager::dirty)
+  {
+    StreamUniforms(&PixelShaderManager::constants, sizeof(PixelShaderConstants));
+    PixelShaderManager::dirty = false;
+  }
+}
+
+void VertexManager::UploadUtilityUniforms(const void* uniforms, u32 uniforms_size)
+{
+  if (!g_ActiveConfig.bNullBenchmarkMode)
+    return;
+
+  InvalidateConstants();
+  StreamUniforms(uniforms, uniforms_size);
+}
+
+void VertexManager::StreamUniforms(const void* data, u32 size)
+{
+  if (m_uniform_buffer.empty())
+    m_uniform_buffer.resize(UNIFORM_BUFFER_SIZE);
+  if (m_uniform_buffer_offset + size > m_uniform_buffer.size())
+    m_uniform_buffer_offset = 0;
+
+  std::memcpy(&m_uniform_buffer[m_uniform_buffer_offset], data, size);
+  m_uniform_buffer_offset += size;
+  ADDSTAT(g_stats.this_frame.bytes_uniform_streamed, size);
+}
+
 void VertexManager::DrawCurrentBatch(u32 base_index, u32 num_indices, u32 base_vertex)
 {
 }
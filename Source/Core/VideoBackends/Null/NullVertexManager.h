@@ -3,6 +3,9 @@
 
 #pragma once
 
+#include <vector>
+
+#include "Common/CommonTypes.h"
 #include "VideoCommon/VertexManagerBase.h"
 
 namespace Null
@@ -13,7 +16,17 @@ public:
   VertexManager();
   ~VertexManager() override;
 
+  void UploadUtilityUniforms(const void* uniforms, u32 uniforms_size) override;
+
 protected:
+  void UploadUniforms() override;
   void DrawCurrentBatch(u32 base_index, u32 num_indices, u32 base_vertex) override;
+
+private:
+  // In benchmark mode, uniforms are streamed into this buffer instead of a GPU buffer.
+  void StreamUniforms(const void* data, u32 size);
+
+  std::vector<u8> m_uniform_buffer;
+  u32 m_uniform_buffer_offset = 0;
 };
 }  // namespace Null
@@ -0,0 +1,72 @@
+// Copyright 2021 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoBackends/OGL/OGLGPUTiming.h"
+
+namespace OGL
+{
+std::unique_ptr<GPUTimingBase> GetGPUTiming()
+{
+  if (!GLExtensions::Supports("GL_ARB_timer_query") &&
+      !GLExtensions::Supports("GL_EXT_disjoint_timer_query"))
+  {
+    return nullptr;
+  }
+
+  return std::make_unique<GPUTiming>();
+}
+
+GPUTiming::GPUTiming()
+{
+  for (auto& queries : m_queries)
+    glGenQueries(static_cast<GLsizei>(queries.size()), queries.data());
+}
+
+GPUTiming::~GPUTiming()
+{
+  for (auto& queries : m_queries)
+    glDeleteQueries(static_cast<GLsizei>(queries.size()), queries.data());
+}
+
+bool GPUTiming::BeginFrameQueries(u32 frame)
+{
+  // Query objects don't need to be reset before they are reused.
+  return true;
+}
+
+void GPUTiming::WriteTimestamp(u32 frame, u32 index)
+{
+  glQueryCounter(m_queries[frame][index], GL_TIMESTAMP);
+}
+
+bool GPUTiming::ReadTimestamps(u32 frame, u32 count, u64* timestamps_ns, bool* valid)
+{
+  // Queries complete in order, so if the last one is available, all of them are.
+  GLuint available = GL_FALSE;
+  glGetQueryObjectuiv(m_queries[frame][count - 1], GL_QUERY_RESULT_AVAILABLE, &available);
+  if (!available)
+    return false;
+
+  // With EXT_disjoint_timer_query, the results are meaningless if the GPU changed its clock or
+  // was otherwise interrupted while they were taken. Reading the flag also clears it.
+  if (!GLExtensions::Supports("GL_ARB_timer_query"))
+  {
+    GLint disjoint = GL_FALSE;
+    glGetIntegerv(GL_GPU_DISJOINT_EXT, &disjoint);
+    if (disjoint)
+    {
+      *valid = false;
+      return true;
+    }
+  }
+
+  for (u32 i = 0; i < count; i++)
+  {
+    GLuint64 timestamp;
+    glGetQueryObjectui64v(m_queries[frame][i], GL_QUERY_RESULT, &timestamp);
+    timestamps_ns[i] = timestamp;
+  }
+
+  return true;
+}
+}  // namespace OGL
@@ -0,0 +1,32 @@
+// Copyright 2021 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <memory>
+
+#include "Common/GL/GLExtensions/GLExtensions.h"
+
+#include "VideoCommon/GPUTimingBase.h"
+
+namespace OGL
+{
+// Returns null if the driver doesn't support timestamp queries.
+std::unique_ptr<GPUTimingBase> GetGPUTiming();
+
+class GPUTiming final : public GPUTimingBase
+{
+public:
+  GPUTiming();
+  ~GPUTiming() override;
+
+protected:
+  bool BeginFrameQueries(u32 frame) override;
+  void WriteTimestamp(u32 frame, u32 index) override;
+  bool ReadTimestamps(u32 frame, u32 count, u64* timestamps_ns, bool* valid) override;
+
+private:
+  std::array<std::array<GLuint, MAX_TIMESTAMPS_PER_FRAME>, NUM_FRAMES> m_queries = {};
+};
+}  // namespace OGL
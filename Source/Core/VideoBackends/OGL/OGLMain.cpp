@@ -45,6 +45,7 @@ Make AA apply instantly during gameplay if possible
 #include "Core/Config/GraphicsSettings.h"
 
 #include "VideoBackends/OGL/OGLBoundingBox.h"
+#include "VideoBackends/OGL/OGLGPUTiming.h"
 #include "VideoBackends/OGL/OGLPerfQuery.h"
 #include "VideoBackends/OGL/OGLRender.h"
 #include "VideoBackends/OGL/OGLVertexManager.h"
@@ -184,6 +185,7 @@ bool VideoBackend::Initialize(const WindowSystemInfo& wsi)
   g_shader_cache = std::make_unique<VideoCommon::ShaderCache>();
   g_framebuffer_manager = std::make_unique<FramebufferManager>();
   g_perf_query = GetPerfQuery();
+  g_gpu_timing = GetGPUTiming();
   g_texture_cache = std::make_unique<TextureCacheBase>();
   g_sampler_cache = std::make_unique<SamplerCache>();
   BoundingBox::Init();
@@ -208,6 +210,7 @@ void VideoBackend::Shutdown()
   BoundingBox::Shutdown();
   g_sampler_cache.reset();
   g_texture_cache.reset();
+  g_gpu_timing.reset();
   g_perf_query.reset();
   g_vertex_manager.reset();
   g_framebuffer_manager.reset();
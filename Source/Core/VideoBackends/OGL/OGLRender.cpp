@@ -31,6 +31,7 @@
 #include "VideoCommon/BPFunctions.h"
 #include "VideoCommon/DriverDetails.h"
 #include "VideoCommon/FramebufferManager.h"
+#include "VideoCommon/GPUTimingBase.h"
 #include "VideoCommon/OnScreenDisplay.h"
 #include "VideoCommon/PostProcessing.h"
 #include "VideoCommon/RenderState.h"
@@ -465,6 +466,7 @@ Renderer::Renderer(std::unique_ptr<GLContext> main_gl_context, float backbuffer_
                                        GLExtensions::Supports("GL_OES_draw_elements_base_vertex");
   g_ogl_config.bSupportsGLBufferStorage = GLExtensions::Supports("GL_ARB_buffer_storage") ||
                                           GLExtensions::Supports("GL_EXT_buffer_storage");
+  g_ogl_config.bSupportsMultiBind = GLExtensions::Supports("GL_ARB_multi_bind");
   g_ogl_config.bSupportsMSAA = GLExtensions::Supports("GL_ARB_texture_multisample");
   g_ogl_config.bSupportViewportFloat = GLExtensions::Supports("GL_ARB_viewport_array");
   g_ogl_config.bSupportsDebug =
@@ -808,6 +810,10 @@ void Renderer::Shutdown()
 
   glDeleteFramebuffers(1, &m_shared_draw_framebuffer);
   glDeleteFramebuffers(1, &m_shared_read_framebuffer);
+
+  for (GLsync fence : m_presented_fences)
+    glDeleteSync(fence);
+  m_presented_fences.clear();
 }
 
 std::unique_ptr<AbstractTexture> Renderer::CreateTexture(const TextureConfig& config)
@@ -970,6 +976,7 @@ void Renderer::RenderXFBToScreen(const MathUtil::Rectangle<int>& target_rc,
   if (g_ActiveConfig.stereo_mode != StereoMode::QuadBuffer)
     return ::Renderer::RenderXFBToScreen(target_rc, source_texture, source_rc);
 
+  GPUTimingScope gpu_timing_scope(GPUTimingCategory::PostProcessing);
   glDrawBuffer(GL_BACK_LEFT);
   m_post_processor->BlitFromTexture(target_rc, source_rc, source_texture, 0);
 
@@ -1052,6 +1059,20 @@ void Renderer::PresentBackbuffer()
   m_main_gl_context->Swap();
 }
 
+void Renderer::WaitForFramesInFlight(u32 max_frames)
+{
+  if (!g_ogl_config.bSupportsGLSync)
+    return;
+
+  m_presented_fences.push_back(glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+  while (m_presented_fences.size() > max_frames)
+  {
+    glClientWaitSync(m_presented_fences.front(), GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+    glDeleteSync(m_presented_fences.front());
+    m_presented_fences.pop_front();
+  }
+}
+
 void Renderer::OnConfigChanged(u32 bits)
 {
   if (bits & CONFIG_CHANGE_BIT_VSYNC && !DriverDetails::HasBug(DriverDetails::BUG_BROKEN_VSYNC))
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <array>
+#include <deque>
 #include <string>
 
 #include "Common/GL/GLContext.h"
@@ -51,6 +52,7 @@ struct VideoConfig
   bool bSupportsGLSync;
   bool bSupportsGLBaseVertex;
   bool bSupportsGLBufferStorage;
+  bool bSupportsMultiBind;
   bool bSupportsMSAA;
   GlslVersion eSupportedGLSLVersion;
   bool bSupportViewportFloat;
@@ -124,6 +126,7 @@ public:
                              u32 groups_z) override;
   void BindBackbuffer(const ClearColor& clear_color = {}) override;
   void PresentBackbuffer() override;
+  void WaitForFramesInFlight(u32 max_frames) override;
 
   u16 BBoxReadImpl(int index) override;
   void BBoxWriteImpl(int index, u16 value) override;
@@ -178,5 +181,8 @@ private:
   BlendingState m_current_blend_state;
   GLuint m_shared_read_framebuffer = 0;
   GLuint m_shared_draw_framebuffer = 0;
+
+  // Fences inserted after each presented frame that is still in flight.
+  std::deque<GLsync> m_presented_fences;
 };
 }  // namespace OGL
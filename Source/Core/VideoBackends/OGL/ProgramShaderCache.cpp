@@ -215,6 +215,22 @@ u32 ProgramShaderCache::GetUniformBufferAlignment()
   return s_ubo_align;
 }
 
+void ProgramShaderCache::BindUniformBufferRanges(const std::array<GLintptr, 3>& offsets,
+                                                 const std::array<GLsizeiptr, 3>& sizes)
+{
+  // The constants are bound to indices 1-3 on every draw, so save the GL calls where possible.
+  if (g_ogl_config.bSupportsMultiBind)
+  {
+    const std::array<GLuint, 3> buffers = {s_buffer->m_buffer, s_buffer->m_buffer,
+                                           s_buffer->m_buffer};
+    glBindBuffersRange(GL_UNIFORM_BUFFER, 1, 3, buffers.data(), offsets.data(), sizes.data());
+    return;
+  }
+
+  for (u32 i = 0; i < 3; i++)
+    glBindBufferRange(GL_UNIFORM_BUFFER, i + 1, s_buffer->m_buffer, offsets[i], sizes[i]);
+}
+
 void ProgramShaderCache::UploadConstants()
 {
   if (PixelShaderManager::dirty || VertexShaderManager::dirty || GeometryShaderManager::dirty)
@@ -231,15 +247,13 @@ void ProgramShaderCache::UploadConstants()
            &GeometryShaderManager::constants, sizeof(GeometryShaderConstants));
 
     s_buffer->Unmap(s_ubo_buffer_size);
-    glBindBufferRange(GL_UNIFORM_BUFFER, 1, s_buffer->m_buffer, buffer.second,
-                      sizeof(PixelShaderConstants));
-    glBindBufferRange(GL_UNIFORM_BUFFER, 2, s_buffer->m_buffer,
-                      buffer.second + Common::AlignUp(sizeof(PixelShaderConstants), s_ubo_align),
-                      sizeof(VertexShaderConstants));
-    glBindBufferRange(GL_UNIFORM_BUFFER, 3, s_buffer->m_buffer,
-                      buffer.second + Common::AlignUp(sizeof(PixelShaderConstants), s_ubo_align) +
-                          Common::AlignUp(sizeof(VertexShaderConstants), s_ubo_align),
-                      sizeof(GeometryShaderConstants));
+    const GLintptr vs_offset =
+        buffer.second + Common::AlignUp(sizeof(PixelShaderConstants), s_ubo_align);
+    const GLintptr gs_offset =
+        vs_offset + Common::AlignUp(sizeof(VertexShaderConstants), s_ubo_align);
+    BindUniformBufferRanges({static_cast<GLintptr>(buffer.second), vs_offset, gs_offset},
+                            {sizeof(PixelShaderConstants), sizeof(VertexShaderConstants),
+                             sizeof(GeometryShaderConstants)});
 
     PixelShaderManager::dirty = false;
     VertexShaderManager::dirty = false;
@@ -258,8 +272,8 @@ void ProgramShaderCache::UploadConstants(const void* data, u32 data_size)
   s_buffer->Unmap(alloc_size);
 
   // bind the same sub-buffer to all stages
-  for (u32 index = 1; index <= 3; index++)
-    glBindBufferRange(GL_UNIFORM_BUFFER, index, s_buffer->m_buffer, buffer.second, data_size);
+  BindUniformBufferRanges({buffer.second, buffer.second, buffer.second},
+                          {data_size, data_size, data_size});
 
   ADDSTAT(g_stats.this_frame.bytes_uniform_streamed, data_size);
 }
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <memory>
 #include <mutex>
@@ -109,6 +110,9 @@ private:
                          PipelineProgramKeyHash>;
 
   static void CreateAttributelessVAO();
+  // Binds ranges of the uniform stream buffer to the pixel, vertex and geometry shader blocks.
+  static void BindUniformBufferRanges(const std::array<GLintptr, 3>& offsets,
+                                      const std::array<GLsizeiptr, 3>& sizes);
 
   static PipelineProgramMap s_pipeline_programs;
   static std::mutex s_pipeline_program_lock;
@@ -45,6 +45,10 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "VideoCommon/Statistics.h"
 #include "VideoCommon/XFMemory.h"
 
+#if defined(_M_X86)
+#include <xmmintrin.h>
+#endif
+
 namespace Clipper
 {
 enum
@@ -78,6 +82,15 @@ static inline int CalcClipMask(const OutputVertexData* v)
   int cmask = 0;
   Vec4 pos = v->projectedPosition;
 
+#if defined(_M_X86)
+  // Tests the four X and Y planes at once. The lanes of the comparison are in the same order as
+  // the clip bits.
+  const __m128 xyzw = _mm_loadu_ps(&pos.x);
+  const __m128 xy = _mm_movelh_ps(xyzw, xyzw);
+  const __m128 w = _mm_shuffle_ps(xyzw, xyzw, _MM_SHUFFLE(3, 3, 3, 3));
+  const __m128 distances = _mm_unpacklo_ps(_mm_sub_ps(w, xy), _mm_add_ps(xy, w));
+  cmask = _mm_movemask_ps(_mm_cmplt_ps(distances, _mm_setzero_ps()));
+#else
   if (pos.w - pos.x < 0)
     cmask |= CLIP_POS_X_BIT;
 
@@ -89,6 +102,7 @@ static inline int CalcClipMask(const OutputVertexData* v)
 
   if (pos.y + pos.w < 0)
     cmask |= CLIP_NEG_Y_BIT;
+#endif
 
   if (pos.w * pos.z > 0)
     cmask |= CLIP_POS_Z_BIT;
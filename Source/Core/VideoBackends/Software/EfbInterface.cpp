@@ -23,6 +23,7 @@ namespace EfbInterface
 static std::array<u8, EFB_WIDTH * EFB_HEIGHT * 6> efb;
 
 static std::array<u32, PQ_NUM_MEMBERS> perf_values;
+static std::array<u32, PQ_NUM_MEMBERS> perf_quad_remainders;
 
 static inline u32 GetColorOffset(u16 x, u16 y)
 {
@@ -699,16 +700,14 @@ void ResetPerfQuery()
   perf_values = {};
 }
 
-void IncPerfCounterQuadCount(PerfQueryType type)
+void IncPerfCounterQuadCount(PerfQueryType type, u32 pixels)
 {
   // NOTE: hardware doesn't process individual pixels but quads instead.
   // Current software renderer architecture works on pixels though, so
   // we have this "quad" hack here to only increment the registers on
   // every fourth rendered pixel
-  static u32 quad[PQ_NUM_MEMBERS];
-  if (++quad[type] != 3)
-    return;
-  quad[type] = 0;
-  ++perf_values[type];
+  const u32 total = perf_quad_remainders[type] + pixels;
+  perf_quad_remainders[type] = total % 3;
+  perf_values[type] += total / 3;
 }
 }  // namespace EfbInterface
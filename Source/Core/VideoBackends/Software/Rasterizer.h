@@ -10,10 +10,18 @@ struct OutputVertexData;
 namespace Rasterizer
 {
 void Init();
+void Shutdown();
+
+// Triangles drawn between these calls may be deferred until EndBatch, which shades them on
+// several threads if SWRasterizerThreads is set. The BP state must not change in between.
+void BeginBatch();
+void EndBatch();
 
 void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertexData* v1,
                            const OutputVertexData* v2);
 
+// The TEV state is copied to the threads shading a batch in BeginBatch, so this must be called
+// before it.
 void SetTevReg(int reg, int comp, s16 color);
 
 struct Slope
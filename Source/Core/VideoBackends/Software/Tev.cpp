@@ -9,6 +9,7 @@
 
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
+#include "Common/Intrinsics.h"
 #include "VideoBackends/Software/DebugUtil.h"
 #include "VideoBackends/Software/EfbInterface.h"
 #include "VideoBackends/Software/TextureSampler.h"
@@ -21,6 +22,13 @@
 #include "VideoCommon/VideoConfig.h"
 #include "VideoCommon/XFMemory.h"
 
+#if defined(_M_X86)
+#include <smmintrin.h>
+#include "Common/CPUDetect.h"
+#elif defined(_M_ARM_64)
+#include <arm_neon.h>
+#endif
+
 #ifdef _DEBUG
 #define ALLOW_TEV_DUMPS 1
 #else
@@ -344,6 +352,146 @@ void Tev::DrawAlphaCompare(const TevStageCombiner::AlphaCombiner& ac, const Inpu
     Reg[u32(ac.dest.Value())][ALP_C] = inputs[ALP_C].d + ((a == b) ? inputs[ALP_C].c : 0);
 }
 
+// Inputs and parameters of a color and an alpha combiner in regular (non-compare) mode, laid out
+// in component order so that all four components can be combined with one set of vector ops.
+namespace
+{
+struct alignas(16) RegularCombinerLanes
+{
+  s32 a[4];
+  s32 b[4];
+  s32 c[4];
+  s32 d[4];
+  s32 bias[4];
+  s32 lshift[4];
+  s32 rshift[4];
+  s32 round[4];
+  s32 negate_before_shift[4];
+  s32 negate_after_shift[4];
+  s32 clamp_min[4];
+  s32 clamp_max[4];
+  s32 result[4];
+};
+}  // namespace
+
+#if defined(_M_X86)
+FUNCTION_TARGET_SSR41 static void CombineRegularLanesSSE41(RegularCombinerLanes& lanes)
+{
+  const auto load = [](const s32* values) {
+    return _mm_load_si128(reinterpret_cast<const __m128i*>(values));
+  };
+
+  const __m128i a = load(lanes.a);
+  const __m128i b = load(lanes.b);
+  __m128i c = load(lanes.c);
+  c = _mm_add_epi32(c, _mm_srli_epi32(c, 7));
+
+  // SSE4.1 has no per-lane variable shift, so left shifts are done as multiplications and the
+  // right shift by 0 or 1 as a blend.
+  const __m128i lshift_mul = _mm_setr_epi32(1 << lanes.lshift[0], 1 << lanes.lshift[1],
+                                            1 << lanes.lshift[2], 1 << lanes.lshift[3]);
+  const __m128i rshift_mask = _mm_cmpgt_epi32(load(lanes.rshift), _mm_setzero_si128());
+  const __m128i negate_before = load(lanes.negate_before_shift);
+  const __m128i negate_after = load(lanes.negate_after_shift);
+
+  __m128i temp = _mm_add_epi32(_mm_mullo_epi32(a, _mm_sub_epi32(_mm_set1_epi32(256), c)),
+                               _mm_mullo_epi32(b, c));
+  temp = _mm_mullo_epi32(temp, lshift_mul);
+  temp = _mm_add_epi32(temp, load(lanes.round));
+  temp = _mm_sub_epi32(_mm_xor_si128(temp, negate_before), negate_before);
+  temp = _mm_srai_epi32(temp, 8);
+  temp = _mm_sub_epi32(_mm_xor_si128(temp, negate_after), negate_after);
+
+  __m128i result = _mm_mullo_epi32(_mm_add_epi32(load(lanes.d), load(lanes.bias)), lshift_mul);
+  result = _mm_add_epi32(result, temp);
+  result = _mm_blendv_epi8(result, _mm_srai_epi32(result, 1), rshift_mask);
+  result = _mm_min_epi32(_mm_max_epi32(result, load(lanes.clamp_min)), load(lanes.clamp_max));
+
+  _mm_store_si128(reinterpret_cast<__m128i*>(lanes.result), result);
+}
+#elif defined(_M_ARM_64)
+static void CombineRegularLanesNEON(RegularCombinerLanes& lanes)
+{
+  const int32x4_t a = vld1q_s32(lanes.a);
+  const int32x4_t b = vld1q_s32(lanes.b);
+  int32x4_t c = vld1q_s32(lanes.c);
+  c = vaddq_s32(c, vshrq_n_s32(c, 7));
+
+  const int32x4_t lshift = vld1q_s32(lanes.lshift);
+  const int32x4_t rshift = vnegq_s32(vld1q_s32(lanes.rshift));
+  const int32x4_t negate_before = vld1q_s32(lanes.negate_before_shift);
+  const int32x4_t negate_after = vld1q_s32(lanes.negate_after_shift);
+
+  int32x4_t temp = vmlaq_s32(vmulq_s32(a, vsubq_s32(vdupq_n_s32(256), c)), b, c);
+  temp = vshlq_s32(temp, lshift);
+  temp = vaddq_s32(temp, vld1q_s32(lanes.round));
+  temp = vsubq_s32(veorq_s32(temp, negate_before), negate_before);
+  temp = vshrq_n_s32(temp, 8);
+  temp = vsubq_s32(veorq_s32(temp, negate_after), negate_after);
+
+  int32x4_t result = vshlq_s32(vaddq_s32(vld1q_s32(lanes.d), vld1q_s32(lanes.bias)), lshift);
+  result = vaddq_s32(result, temp);
+  // vshlq_s32 with a negative shift amount is an arithmetic right shift.
+  result = vshlq_s32(result, rshift);
+  result = vminq_s32(vmaxq_s32(result, vld1q_s32(lanes.clamp_min)), vld1q_s32(lanes.clamp_max));
+
+  vst1q_s32(lanes.result, result);
+}
+#endif
+
+bool Tev::DrawRegularSIMD(const TevStageCombiner::ColorCombiner& cc,
+                          const TevStageCombiner::AlphaCombiner& ac, const InputRegType inputs[4])
+{
+#if defined(_M_X86) || defined(_M_ARM_64)
+#if defined(_M_X86)
+  if (!cpu_info.bSSE4_1)
+    return false;
+#endif
+
+  RegularCombinerLanes lanes;
+  for (int i = ALP_C; i <= RED_C; i++)
+  {
+    const bool alpha = i == ALP_C;
+    const TevScale scale = alpha ? ac.scale : cc.scale;
+    const bool sub = (alpha ? ac.op : cc.op) == TevOp::Sub;
+    const bool divide2 = scale == TevScale::Divide2;
+    // The alpha combiner only rounds when dividing by 2 and negates before shifting, unlike the
+    // color combiner. See DrawColorRegular and DrawAlphaRegular.
+    const bool round = alpha ? divide2 : !divide2;
+    const bool clamp = alpha ? ac.clamp : cc.clamp;
+
+    lanes.a[i] = inputs[i].a;
+    lanes.b[i] = inputs[i].b;
+    lanes.c[i] = inputs[i].c;
+    lanes.d[i] = inputs[i].d;
+    lanes.bias[i] = m_BiasLUT[u32(alpha ? ac.bias.Value() : cc.bias.Value())];
+    lanes.lshift[i] = m_ScaleLShiftLUT[u32(scale)];
+    lanes.rshift[i] = m_ScaleRShiftLUT[u32(scale)];
+    lanes.round[i] = round ? (sub ? 127 : 128) : 0;
+    lanes.negate_before_shift[i] = (alpha && sub) ? -1 : 0;
+    lanes.negate_after_shift[i] = (!alpha && sub) ? -1 : 0;
+    lanes.clamp_min[i] = clamp ? 0 : -1024;
+    lanes.clamp_max[i] = clamp ? 255 : 1023;
+  }
+
+#if defined(_M_X86)
+  CombineRegularLanesSSE41(lanes);
+#else
+  CombineRegularLanesNEON(lanes);
+#endif
+
+  // The results are already clamped, so they fit into the registers.
+  s16* color_reg = Reg[u32(cc.dest.Value())];
+  color_reg[BLU_C] = lanes.result[BLU_C];
+  color_reg[GRN_C] = lanes.result[GRN_C];
+  color_reg[RED_C] = lanes.result[RED_C];
+  Reg[u32(ac.dest.Value())][ALP_C] = lanes.result[ALP_C];
+  return true;
+#else
+  return false;
+#endif
+}
+
 static bool AlphaCompare(int alpha, int ref, CompareMode comp)
 {
   switch (comp)
@@ -543,7 +691,7 @@ void Tev::Draw()
   ASSERT(Position[0] >= 0 && Position[0] < s32(EFB_WIDTH));
   ASSERT(Position[1] >= 0 && Position[1] < s32(EFB_HEIGHT));
 
-  INCSTAT(g_stats.this_frame.tev_pixels_in);
+  PixelsIn++;
 
   // initial color values
   for (int i = 0; i < 4; i++)
@@ -666,33 +814,39 @@ void Tev::Draw()
     inputs[ALP_C].c = *m_AlphaInputLUT[u32(ac.c.Value())];
     inputs[ALP_C].d = *m_AlphaInputLUT[u32(ac.d.Value())];
 
-    if (cc.bias != TevBias::Compare)
-      DrawColorRegular(cc, inputs);
-    else
-      DrawColorCompare(cc, inputs);
-
-    if (cc.clamp)
+    // The SIMD path only handles regular mode, and evaluates and clamps both combiners at once.
+    const bool combined = cc.bias != TevBias::Compare && ac.bias != TevBias::Compare &&
+                          DrawRegularSIMD(cc, ac, inputs);
+    if (!combined)
     {
-      Reg[u32(cc.dest.Value())][RED_C] = Clamp255(Reg[u32(cc.dest.Value())][RED_C]);
-      Reg[u32(cc.dest.Value())][GRN_C] = Clamp255(Reg[u32(cc.dest.Value())][GRN_C]);
-      Reg[u32(cc.dest.Value())][BLU_C] = Clamp255(Reg[u32(cc.dest.Value())][BLU_C]);
-    }
-    else
-    {
-      Reg[u32(cc.dest.Value())][RED_C] = Clamp1024(Reg[u32(cc.dest.Value())][RED_C]);
-      Reg[u32(cc.dest.Value())][GRN_C] = Clamp1024(Reg[u32(cc.dest.Value())][GRN_C]);
-      Reg[u32(cc.dest.Value())][BLU_C] = Clamp1024(Reg[u32(cc.dest.Value())][BLU_C]);
-    }
+      if (cc.bias != TevBias::Compare)
+        DrawColorRegular(cc, inputs);
+      else
+        DrawColorCompare(cc, inputs);
 
-    if (ac.bias != TevBias::Compare)
-      DrawAlphaRegular(ac, inputs);
-    else
-      DrawAlphaCompare(ac, inputs);
+      if (cc.clamp)
+      {
+        Reg[u32(cc.dest.Value())][RED_C] = Clamp255(Reg[u32(cc.dest.Value())][RED_C]);
+        Reg[u32(cc.dest.Value())][GRN_C] = Clamp255(Reg[u32(cc.dest.Value())][GRN_C]);
+        Reg[u32(cc.dest.Value())][BLU_C] = Clamp255(Reg[u32(cc.dest.Value())][BLU_C]);
+      }
+      else
+      {
+        Reg[u32(cc.dest.Value())][RED_C] = Clamp1024(Reg[u32(cc.dest.Value())][RED_C]);
+        Reg[u32(cc.dest.Value())][GRN_C] = Clamp1024(Reg[u32(cc.dest.Value())][GRN_C]);
+        Reg[u32(cc.dest.Value())][BLU_C] = Clamp1024(Reg[u32(cc.dest.Value())][BLU_C]);
+      }
 
-    if (ac.clamp)
-      Reg[u32(ac.dest.Value())][ALP_C] = Clamp255(Reg[u32(ac.dest.Value())][ALP_C]);
-    else
-      Reg[u32(ac.dest.Value())][ALP_C] = Clamp1024(Reg[u32(ac.dest.Value())][ALP_C]);
+      if (ac.bias != TevBias::Compare)
+        DrawAlphaRegular(ac, inputs);
+      else
+        DrawAlphaCompare(ac, inputs);
+
+      if (ac.clamp)
+        Reg[u32(ac.dest.Value())][ALP_C] = Clamp255(Reg[u32(ac.dest.Value())][ALP_C]);
+      else
+        Reg[u32(ac.dest.Value())][ALP_C] = Clamp1024(Reg[u32(ac.dest.Value())][ALP_C]);
+    }
 
 #if ALLOW_TEV_DUMPS
     if (g_ActiveConfig.bDumpTevStages)
@@ -829,18 +983,35 @@ void Tev::Draw()
   if (late_ztest && bpmem.zmode.testenable)
   {
     // TODO: Check against hw if these values get incremented even if depth testing is disabled
-    EfbInterface::IncPerfCounterQuadCount(PQ_ZCOMP_INPUT);
+    PerfQuadCounts[PQ_ZCOMP_INPUT]++;
 
     if (!EfbInterface::ZCompare(Position[0], Position[1], Position[2]))
       return;
 
-    EfbInterface::IncPerfCounterQuadCount(PQ_ZCOMP_OUTPUT);
+    PerfQuadCounts[PQ_ZCOMP_OUTPUT]++;
   }
 
   // The GC/Wii GPU rasterizes in 2x2 pixel groups, so bounding box values will be rounded to the
   // extents of these groups, rather than the exact pixel.
-  BoundingBox::Update(static_cast<u16>(Position[0] & ~1), static_cast<u16>(Position[0] | 1),
-                      static_cast<u16>(Position[1] & ~1), static_cast<u16>(Position[1] | 1));
+  const u16 bbox_left = static_cast<u16>(Position[0] & ~1);
+  const u16 bbox_right = static_cast<u16>(Position[0] | 1);
+  const u16 bbox_top = static_cast<u16>(Position[1] & ~1);
+  const u16 bbox_bottom = static_cast<u16>(Position[1] | 1);
+  if (!BoundingBoxUpdated)
+  {
+    BoundingBoxUpdated = true;
+    BoundingBoxLeft = bbox_left;
+    BoundingBoxRight = bbox_right;
+    BoundingBoxTop = bbox_top;
+    BoundingBoxBottom = bbox_bottom;
+  }
+  else
+  {
+    BoundingBoxLeft = std::min(BoundingBoxLeft, bbox_left);
+    BoundingBoxRight = std::max(BoundingBoxRight, bbox_right);
+    BoundingBoxTop = std::min(BoundingBoxTop, bbox_top);
+    BoundingBoxBottom = std::max(BoundingBoxBottom, bbox_bottom);
+  }
 
 #if ALLOW_TEV_DUMPS
   if (g_ActiveConfig.bDumpTevStages)
@@ -862,8 +1033,8 @@ void Tev::Draw()
   }
 #endif
 
-  INCSTAT(g_stats.this_frame.tev_pixels_out);
-  EfbInterface::IncPerfCounterQuadCount(PQ_BLEND_INPUT);
+  PixelsOut++;
+  PerfQuadCounts[PQ_BLEND_INPUT]++;
 
   EfbInterface::BlendTev(Position[0], Position[1], output);
 }
@@ -872,3 +1043,31 @@ void Tev::SetRegColor(int reg, int comp, s16 color)
 {
   KonstantColors[reg][comp] = color;
 }
+
+void Tev::CopyStateFrom(const Tev& other)
+{
+  std::memcpy(KonstantColors, other.KonstantColors, sizeof(KonstantColors));
+}
+
+void Tev::FlushCounters()
+{
+  for (u32 i = 0; i < PQ_NUM_MEMBERS; i++)
+  {
+    if (PerfQuadCounts[i] != 0)
+      EfbInterface::IncPerfCounterQuadCount(static_cast<PerfQueryType>(i), PerfQuadCounts[i]);
+  }
+  PerfQuadCounts = {};
+
+  ADDSTAT(g_stats.this_frame.rasterized_pixels, RasterizedPixels);
+  ADDSTAT(g_stats.this_frame.tev_pixels_in, PixelsIn);
+  ADDSTAT(g_stats.this_frame.tev_pixels_out, PixelsOut);
+  RasterizedPixels = 0;
+  PixelsIn = 0;
+  PixelsOut = 0;
+
+  if (BoundingBoxUpdated)
+  {
+    BoundingBox::Update(BoundingBoxLeft, BoundingBoxRight, BoundingBoxTop, BoundingBoxBottom);
+    BoundingBoxUpdated = false;
+  }
+}
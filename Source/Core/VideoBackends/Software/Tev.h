@@ -3,7 +3,11 @@
 
 #pragma once
 
+#include <array>
+
+#include "Common/CommonTypes.h"
 #include "VideoCommon/BPMemory.h"
+#include "VideoCommon/PerfQueryBase.h"
 
 class Tev
 {
@@ -62,6 +66,10 @@ class Tev
   void DrawColorCompare(const TevStageCombiner::ColorCombiner& cc, const InputRegType inputs[4]);
   void DrawAlphaRegular(const TevStageCombiner::AlphaCombiner& ac, const InputRegType inputs[4]);
   void DrawAlphaCompare(const TevStageCombiner::AlphaCombiner& ac, const InputRegType inputs[4]);
+  // Evaluates and clamps both combiners of a stage with SSE4.1 or NEON, which gives the same
+  // results as the scalar functions above. Returns false if the host doesn't support it.
+  bool DrawRegularSIMD(const TevStageCombiner::ColorCombiner& cc,
+                       const TevStageCombiner::AlphaCombiner& ac, const InputRegType inputs[4]);
 
   void Indirect(unsigned int stageNum, s32 s, s32 t);
 
@@ -74,6 +82,19 @@ public:
   s32 TextureLod[16];
   bool TextureLinear[16];
 
+  // Draw doesn't touch the global perf counters, statistics or bounding box, so that several Tev
+  // instances can shade disjoint parts of the EFB at the same time. The updates are collected
+  // here instead and applied by FlushCounters on the GPU thread.
+  std::array<u32, PQ_NUM_MEMBERS> PerfQuadCounts{};
+  u32 RasterizedPixels = 0;
+  u32 PixelsIn = 0;
+  u32 PixelsOut = 0;
+  bool BoundingBoxUpdated = false;
+  u16 BoundingBoxLeft = 0;
+  u16 BoundingBoxRight = 0;
+  u16 BoundingBoxTop = 0;
+  u16 BoundingBoxBottom = 0;
+
   enum
   {
     ALP_C,
@@ -87,4 +108,9 @@ public:
   void Draw();
 
   void SetRegColor(int reg, int comp, s16 color);
+  // Copies the state that is kept across pixels from another Tev. Everything else is set up by
+  // Draw or by the rasterizer for every pixel.
+  void CopyStateFrom(const Tev& other);
+
+  void FlushCounters();
 };
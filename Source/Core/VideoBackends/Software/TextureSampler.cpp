@@ -4,7 +4,13 @@
 #include "VideoBackends/Software/TextureSampler.h"
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <cmath>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/MsgHandler.h"
@@ -14,10 +20,204 @@
 #include "VideoCommon/SamplerCommon.h"
 #include "VideoCommon/TextureDecoder.h"
 
+#if defined(_M_X86)
+#include <emmintrin.h>
+#elif defined(_M_ARM_64)
+#include <arm_neon.h>
+#endif
+
 #define ALLOW_MIPMAP 1
 
 namespace TextureSampler
 {
+namespace
+{
+// Where the texels of one mip level come from.
+struct TexelSource
+{
+  const u8* image;
+  const u8* image_odd;
+  const u8* tlut;
+  int width;
+  TextureFormat format;
+  TLUTFormat tlut_format;
+  bool rgba8_from_tmem;
+
+  void Decode(u8* texel, int s, int t) const
+  {
+    if (rgba8_from_tmem)
+      TexDecoder_DecodeTexelRGBA8FromTmem(texel, image, image_odd, s, t, width);
+    else
+      TexDecoder_DecodeTexel(texel, image, s, t, width, format, tlut, tlut_format);
+  }
+};
+
+// Decoded RGBA8 texels of one mip level of one texmap. The level is split into small tiles which
+// are decoded on first use, so a draw only pays for the part of the texture it samples.
+class CachedLevel
+{
+public:
+  // Returns the decoded texel, decoding its tile first if needed.
+  u32 Fetch(const TexelSource& source, int s, int t)
+  {
+    const u32 tile = (t / TILE_SIZE) * m_tiles_x + s / TILE_SIZE;
+    u8 state = m_tile_states[tile].load(std::memory_order_acquire);
+    if (state == TILE_EMPTY &&
+        m_tile_states[tile].compare_exchange_strong(state, TILE_DECODING,
+                                                    std::memory_order_acquire))
+    {
+      DecodeTile(source, tile);
+      m_tile_states[tile].store(TILE_READY, std::memory_order_release);
+      state = TILE_READY;
+    }
+
+    if (state == TILE_READY)
+      return m_texels[t * m_width + s];
+
+    // Another rasterizer thread is decoding this tile, so don't wait for it.
+    u32 texel;
+    u8 decoded[4];
+    source.Decode(decoded, s, t);
+    std::memcpy(&texel, decoded, sizeof(texel));
+    return texel;
+  }
+
+  // Prepares the level for a texture of the given size in the current batch. Safe to call from
+  // any rasterizer thread, only the first call in a batch does anything.
+  void Validate(u32 batch, int width, int height)
+  {
+    if (m_batch.load(std::memory_order_acquire) == batch)
+      return;
+
+    std::lock_guard<std::mutex> guard(m_lock);
+    if (m_batch.load(std::memory_order_relaxed) == batch)
+      return;
+
+    m_width = width;
+    m_height = height;
+    m_tiles_x = (width + TILE_SIZE - 1) / TILE_SIZE;
+    const size_t num_tiles = m_tiles_x * ((height + TILE_SIZE - 1) / TILE_SIZE);
+    if (m_texels.size() < static_cast<size_t>(width * height))
+      m_texels.resize(width * height);
+    if (m_num_tiles < num_tiles)
+    {
+      m_tile_states = std::make_unique<std::atomic<u8>[]>(num_tiles);
+      m_num_tiles = num_tiles;
+    }
+    for (size_t i = 0; i < num_tiles; i++)
+      m_tile_states[i].store(TILE_EMPTY, std::memory_order_relaxed);
+
+    m_batch.store(batch, std::memory_order_release);
+  }
+
+private:
+  // A multiple of the block sizes of all texture formats.
+  static constexpr int TILE_SIZE = 8;
+
+  enum : u8
+  {
+    TILE_EMPTY,
+    TILE_DECODING,
+    TILE_READY
+  };
+
+  void DecodeTile(const TexelSource& source, u32 tile)
+  {
+    const int left = (tile % m_tiles_x) * TILE_SIZE;
+    const int top = (tile / m_tiles_x) * TILE_SIZE;
+    const int right = std::min(left + TILE_SIZE, m_width);
+    const int bottom = std::min(top + TILE_SIZE, m_height);
+    for (int t = top; t < bottom; t++)
+    {
+      for (int s = left; s < right; s++)
+      {
+        u8 decoded[4];
+        source.Decode(decoded, s, t);
+        std::memcpy(&m_texels[t * m_width + s], decoded, sizeof(u32));
+      }
+    }
+  }
+
+  std::vector<u32> m_texels;
+  std::unique_ptr<std::atomic<u8>[]> m_tile_states;
+  size_t m_num_tiles = 0;
+  int m_width = 0;
+  int m_height = 0;
+  int m_tiles_x = 0;
+
+  std::atomic<u32> m_batch{0};
+  std::mutex m_lock;
+};
+
+constexpr u32 MAX_CACHED_MIPS = 11;
+
+std::array<std::array<CachedLevel, MAX_CACHED_MIPS>, 8> s_texel_cache;
+
+// Zero while no batch is active, in which case the cache is bypassed.
+u32 s_current_batch = 0;
+u32 s_last_batch = 0;
+
+// Computes the bilinear filter of four RGBA8 texels, with weights that sum up to 128 * 128.
+void FilterTexels(const std::array<u32, 4>& texels, const std::array<u32, 4>& weights, u8* sample)
+{
+#if defined(_M_X86)
+  const __m128i zero = _mm_setzero_si128();
+  const auto load = [](u32 texel) { return _mm_cvtsi32_si128(static_cast<int>(texel)); };
+
+  // Interleaves the channels of each pair of texels, so that one multiply-add computes the
+  // weighted sum of the pair.
+  const __m128i texels01 =
+      _mm_unpacklo_epi8(_mm_unpacklo_epi8(load(texels[0]), load(texels[1])), zero);
+  const __m128i texels23 =
+      _mm_unpacklo_epi8(_mm_unpacklo_epi8(load(texels[2]), load(texels[3])), zero);
+  const __m128i weights01 = _mm_set1_epi32(static_cast<int>(weights[0] | (weights[1] << 16)));
+  const __m128i weights23 = _mm_set1_epi32(static_cast<int>(weights[2] | (weights[3] << 16)));
+  __m128i result =
+      _mm_add_epi32(_mm_madd_epi16(texels01, weights01), _mm_madd_epi16(texels23, weights23));
+  result = _mm_srli_epi32(result, 14);
+  result = _mm_packus_epi16(_mm_packs_epi32(result, zero), zero);
+  const u32 packed = static_cast<u32>(_mm_cvtsi128_si32(result));
+  std::memcpy(sample, &packed, sizeof(packed));
+#elif defined(_M_ARM_64)
+  const uint16x8_t texels01 = vmovl_u8(vcreate_u8(texels[0] | (u64{texels[1]} << 32)));
+  const uint16x8_t texels23 = vmovl_u8(vcreate_u8(texels[2] | (u64{texels[3]} << 32)));
+  uint32x4_t result = vmull_n_u16(vget_low_u16(texels01), static_cast<u16>(weights[0]));
+  result = vmlal_n_u16(result, vget_high_u16(texels01), static_cast<u16>(weights[1]));
+  result = vmlal_n_u16(result, vget_low_u16(texels23), static_cast<u16>(weights[2]));
+  result = vmlal_n_u16(result, vget_high_u16(texels23), static_cast<u16>(weights[3]));
+  const uint8x8_t narrowed = vmovn_u16(vcombine_u16(vshrn_n_u32(result, 14), vdup_n_u16(0)));
+  const u32 packed = vget_lane_u32(vreinterpret_u32_u8(narrowed), 0);
+  std::memcpy(sample, &packed, sizeof(packed));
+#else
+  u32 texel[4] = {};
+  for (size_t i = 0; i < texels.size(); i++)
+  {
+    u8 channels[4];
+    std::memcpy(channels, &texels[i], sizeof(channels));
+    for (size_t c = 0; c < 4; c++)
+      texel[c] += channels[c] * weights[i];
+  }
+
+  sample[0] = (u8)(texel[0] >> 14);
+  sample[1] = (u8)(texel[1] >> 14);
+  sample[2] = (u8)(texel[2] >> 14);
+  sample[3] = (u8)(texel[3] >> 14);
+#endif
+}
+}  // namespace
+
+void BeginBatch()
+{
+  s_current_batch = ++s_last_batch;
+  if (s_current_batch == 0)
+    s_current_batch = ++s_last_batch;
+}
+
+void EndBatch()
+{
+  s_current_batch = 0;
+}
+
 static inline void WrapCoord(int* coordp, WrapMode wrapMode, int imageSize)
 {
   int coord = *coordp;
@@ -139,6 +339,7 @@ void SampleMip(s32 s, s32 t, s32 mip, bool linear, u8 texmap, u8* sample)
 
   // reduce sample location and texture size to mip level
   // move texture pointer to mip location
+  const u32 level = static_cast<u32>(mip);
   if (mip)
   {
     int mipWidth = imageWidth + 1;
@@ -166,6 +367,29 @@ void SampleMip(s32 s, s32 t, s32 mip, bool linear, u8 texmap, u8* sample)
     }
   }
 
+  const bool rgba8_from_tmem =
+      texfmt == TextureFormat::RGBA8 && texUnit.texImage1[subTexmap].cache_manually_managed;
+  const TexelSource source = {imageSrc, imageSrcOdd, tlut,           imageWidth,
+                              texfmt,   tlutfmt,     rgba8_from_tmem};
+
+  CachedLevel* cached_level = nullptr;
+  if (s_current_batch != 0 && level < MAX_CACHED_MIPS)
+  {
+    cached_level = &s_texel_cache[texmap][level];
+    cached_level->Validate(s_current_batch, imageWidth + 1, imageHeight + 1);
+  }
+
+  const auto fetch = [&](int fetch_s, int fetch_t) {
+    if (cached_level)
+      return cached_level->Fetch(source, fetch_s, fetch_t);
+
+    u32 texel;
+    u8 decoded[4];
+    source.Decode(decoded, fetch_s, fetch_t);
+    std::memcpy(&texel, decoded, sizeof(texel));
+    return texel;
+  };
+
   if (linear)
   {
     // offset linear sampling
@@ -178,60 +402,22 @@ void SampleMip(s32 s, s32 t, s32 mip, bool linear, u8 texmap, u8* sample)
 
     // linear sampling
     int imageSPlus1 = imageS + 1;
-    const int fractS = s & 0x7f;
+    const u32 fractS = s & 0x7f;
 
     int imageTPlus1 = imageT + 1;
-    const int fractT = t & 0x7f;
-
-    u8 sampledTex[4];
-    u32 texel[4];
+    const u32 fractT = t & 0x7f;
 
     WrapCoord(&imageS, tm0.wrap_s, imageWidth);
     WrapCoord(&imageT, tm0.wrap_t, imageHeight);
     WrapCoord(&imageSPlus1, tm0.wrap_s, imageWidth);
     WrapCoord(&imageTPlus1, tm0.wrap_t, imageHeight);
 
-    if (!(texfmt == TextureFormat::RGBA8 && texUnit.texImage1[subTexmap].cache_manually_managed))
-    {
-      TexDecoder_DecodeTexel(sampledTex, imageSrc, imageS, imageT, imageWidth, texfmt, tlut,
-                             tlutfmt);
-      SetTexel(sampledTex, texel, (128 - fractS) * (128 - fractT));
-
-      TexDecoder_DecodeTexel(sampledTex, imageSrc, imageSPlus1, imageT, imageWidth, texfmt, tlut,
-                             tlutfmt);
-      AddTexel(sampledTex, texel, (fractS) * (128 - fractT));
-
-      TexDecoder_DecodeTexel(sampledTex, imageSrc, imageS, imageTPlus1, imageWidth, texfmt, tlut,
-                             tlutfmt);
-      AddTexel(sampledTex, texel, (128 - fractS) * (fractT));
-
-      TexDecoder_DecodeTexel(sampledTex, imageSrc, imageSPlus1, imageTPlus1, imageWidth, texfmt,
-                             tlut, tlutfmt);
-      AddTexel(sampledTex, texel, (fractS) * (fractT));
-    }
-    else
-    {
-      TexDecoder_DecodeTexelRGBA8FromTmem(sampledTex, imageSrc, imageSrcOdd, imageS, imageT,
-                                          imageWidth);
-      SetTexel(sampledTex, texel, (128 - fractS) * (128 - fractT));
-
-      TexDecoder_DecodeTexelRGBA8FromTmem(sampledTex, imageSrc, imageSrcOdd, imageSPlus1, imageT,
-                                          imageWidth);
-      AddTexel(sampledTex, texel, (fractS) * (128 - fractT));
-
-      TexDecoder_DecodeTexelRGBA8FromTmem(sampledTex, imageSrc, imageSrcOdd, imageS, imageTPlus1,
-                                          imageWidth);
-      AddTexel(sampledTex, texel, (128 - fractS) * (fractT));
-
-      TexDecoder_DecodeTexelRGBA8FromTmem(sampledTex, imageSrc, imageSrcOdd, imageSPlus1,
-                                          imageTPlus1, imageWidth);
-      AddTexel(sampledTex, texel, (fractS) * (fractT));
-    }
-
-    sample[0] = (u8)(texel[0] >> 14);
-    sample[1] = (u8)(texel[1] >> 14);
-    sample[2] = (u8)(texel[2] >> 14);
-    sample[3] = (u8)(texel[3] >> 14);
+    const std::array<u32, 4> texels = {fetch(imageS, imageT), fetch(imageSPlus1, imageT),
+                                       fetch(imageS, imageTPlus1),
+                                       fetch(imageSPlus1, imageTPlus1)};
+    const std::array<u32, 4> weights = {(128 - fractS) * (128 - fractT), fractS * (128 - fractT),
+                                        (128 - fractS) * fractT, fractS * fractT};
+    FilterTexels(texels, weights, sample);
   }
   else
   {
@@ -243,11 +429,8 @@ void SampleMip(s32 s, s32 t, s32 mip, bool linear, u8 texmap, u8* sample)
     WrapCoord(&imageS, tm0.wrap_s, imageWidth);
     WrapCoord(&imageT, tm0.wrap_t, imageHeight);
 
-    if (!(texfmt == TextureFormat::RGBA8 && texUnit.texImage1[subTexmap].cache_manually_managed))
-      TexDecoder_DecodeTexel(sample, imageSrc, imageS, imageT, imageWidth, texfmt, tlut, tlutfmt);
-    else
-      TexDecoder_DecodeTexelRGBA8FromTmem(sample, imageSrc, imageSrcOdd, imageS, imageT,
-                                          imageWidth);
+    const u32 texel = fetch(imageS, imageT);
+    std::memcpy(sample, &texel, sizeof(texel));
   }
 }
 }  // namespace TextureSampler
@@ -7,6 +7,11 @@
 
 namespace TextureSampler
 {
+// Texels are decoded once and cached between these calls. The texture state must not change in
+// between, which holds for a batch since BP writes flush the vertex manager first.
+void BeginBatch();
+void EndBatch();
+
 void Sample(s32 s, s32 t, s32 lod, bool linear, u8 texmap, u8* sample);
 
 void SampleMip(s32 s, s32 t, s32 mip, bool linear, u8 texmap, u8* sample);
@@ -20,8 +20,38 @@
 #include "VideoCommon/BPMemory.h"
 #include "VideoCommon/XFMemory.h"
 
+#if defined(_M_X86)
+#include <xmmintrin.h>
+#endif
+
 namespace TransformUnit
 {
+#if defined(_M_X86)
+// Computes all rows of a matrix-vector product at once by transposing the rows and summing the
+// scaled columns. Every lane does the same operations in the same order as the scalar code, so
+// the results are bit-identical to it. The fourth column is only added for 3x4 matrices, since
+// adding zero would turn a -0 result into +0.
+template <bool has_translation>
+static __m128 MultiplyRows(__m128 row0, __m128 row1, __m128 row2, const Vec3& vec)
+{
+  __m128 row3 = _mm_setzero_ps();
+  _MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+  __m128 result =
+      _mm_add_ps(_mm_mul_ps(row0, _mm_set1_ps(vec.x)), _mm_mul_ps(row1, _mm_set1_ps(vec.y)));
+  result = _mm_add_ps(result, _mm_mul_ps(row2, _mm_set1_ps(vec.z)));
+  if constexpr (has_translation)
+    result = _mm_add_ps(result, row3);
+  return result;
+}
+
+static void StoreVec3(__m128 value, Vec3& result)
+{
+  alignas(16) float values[4];
+  _mm_store_ps(values, value);
+  result = Vec3(values);
+}
+#endif
+
 static void MultiplyVec2Mat24(const Vec3& vec, const float* mat, Vec3& result)
 {
   result.x = mat[0] * vec.x + mat[1] * vec.y + mat[2] + mat[3];
@@ -38,9 +68,16 @@ static void MultiplyVec2Mat34(const Vec3& vec, const float* mat, Vec3& result)
 
 static void MultiplyVec3Mat33(const Vec3& vec, const float* mat, Vec3& result)
 {
+#if defined(_M_X86)
+  // The last row is loaded separately to avoid reading past the end of the matrix.
+  const __m128 row2_xy = _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64*>(mat + 6));
+  const __m128 row2 = _mm_movelh_ps(row2_xy, _mm_load_ss(mat + 8));
+  StoreVec3(MultiplyRows<false>(_mm_loadu_ps(mat), _mm_loadu_ps(mat + 3), row2, vec), result);
+#else
   result.x = mat[0] * vec.x + mat[1] * vec.y + mat[2] * vec.z;
   result.y = mat[3] * vec.x + mat[4] * vec.y + mat[5] * vec.z;
   result.z = mat[6] * vec.x + mat[7] * vec.y + mat[8] * vec.z;
+#endif
 }
 
 static void MultiplyVec3Mat24(const Vec3& vec, const float* mat, Vec3& result)
@@ -52,9 +89,15 @@ static void MultiplyVec3Mat24(const Vec3& vec, const float* mat, Vec3& result)
 
 static void MultiplyVec3Mat34(const Vec3& vec, const float* mat, Vec3& result)
 {
+#if defined(_M_X86)
+  StoreVec3(
+      MultiplyRows<true>(_mm_loadu_ps(mat), _mm_loadu_ps(mat + 4), _mm_loadu_ps(mat + 8), vec),
+      result);
+#else
   result.x = mat[0] * vec.x + mat[1] * vec.y + mat[2] * vec.z + mat[3];
   result.y = mat[4] * vec.x + mat[5] * vec.y + mat[6] * vec.z + mat[7];
   result.z = mat[8] * vec.x + mat[9] * vec.y + mat[10] * vec.z + mat[11];
+#endif
 }
 
 static void MultipleVec3Perspective(const Vec3& vec, const Projection::Raw& proj, Vec4& result)
@@ -11,16 +11,21 @@
 #include "Common/Thread.h"
 
 #include "VideoBackends/Vulkan/VulkanContext.h"
+#include "VideoCommon/GPUTimingBase.h"
 
 namespace Vulkan
 {
-CommandBufferManager::CommandBufferManager(bool use_threaded_submission)
-    : m_submit_semaphore(1, 1), m_use_threaded_submission(use_threaded_submission)
+CommandBufferManager::CommandBufferManager(bool use_threaded_submission,
+                                           bool use_threaded_recording)
+    : m_submit_semaphore(1, 1), m_use_threaded_submission(use_threaded_submission),
+      m_command_recorder(std::make_unique<CommandRecorder>(use_threaded_recording))
 {
 }
 
 CommandBufferManager::~CommandBufferManager()
 {
+  m_command_recorder.reset();
+
   // If the worker thread is enabled, stop and block until it exits.
   if (m_use_threaded_submission)
   {
@@ -55,25 +60,28 @@ bool CommandBufferManager::CreateCommandBuffers()
     resources.init_command_buffer_used = false;
     resources.semaphore_used = false;
 
-    VkCommandPoolCreateInfo pool_info = {VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO, nullptr, 0,
-                                         g_vulkan_context->GetGraphicsQueueFamilyIndex()};
-    res = vkCreateCommandPool(g_vulkan_context->GetDevice(), &pool_info, nullptr,
-                              &resources.command_pool);
-    if (res != VK_SUCCESS)
+    for (size_t i = 0; i < resources.command_buffers.size(); i++)
     {
-      LOG_VULKAN_ERROR(res, "vkCreateCommandPool failed: ");
-      return false;
-    }
+      VkCommandPoolCreateInfo pool_info = {VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO, nullptr, 0,
+                                           g_vulkan_context->GetGraphicsQueueFamilyIndex()};
+      res = vkCreateCommandPool(g_vulkan_context->GetDevice(), &pool_info, nullptr,
+                                &resources.command_pools[i]);
+      if (res != VK_SUCCESS)
+      {
+        LOG_VULKAN_ERROR(res, "vkCreateCommandPool failed: ");
+        return false;
+      }
 
-    VkCommandBufferAllocateInfo buffer_info = {
-        VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO, nullptr, resources.command_pool,
-        VK_COMMAND_BUFFER_LEVEL_PRIMARY, static_cast<uint32_t>(resources.command_buffers.size())};
+      VkCommandBufferAllocateInfo buffer_info = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+                                                 nullptr, resources.command_pools[i],
+                                                 VK_COMMAND_BUFFER_LEVEL_PRIMARY, 1};
 
-    res = vkAllocateCommandBuffers(device, &buffer_info, resources.command_buffers.data());
-    if (res != VK_SUCCESS)
-    {
-      LOG_VULKAN_ERROR(res, "vkAllocateCommandBuffers failed: ");
-      return false;
+      res = vkAllocateCommandBuffers(device, &buffer_info, &resources.command_buffers[i]);
+      if (res != VK_SUCCESS)
+      {
+        LOG_VULKAN_ERROR(res, "vkAllocateCommandBuffers failed: ");
+        return false;
+      }
     }
 
     VkFenceCreateInfo fence_info = {VK_STRUCTURE_TYPE_FENCE_CREATE_INFO, nullptr,
@@ -93,6 +101,9 @@ bool CommandBufferManager::CreateCommandBuffers()
       return false;
     }
 
+    if (g_vulkan_context->HasTransferQueue() && !CreateTransferCommandBuffer(resources))
+      return false;
+
     // TODO: A better way to choose the number of descriptors.
     const std::array<VkDescriptorPoolSize, 5> pool_sizes{{
         {VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, 500000},
@@ -132,6 +143,41 @@ bool CommandBufferManager::CreateCommandBuffers()
   return true;
 }
 
+bool CommandBufferManager::CreateTransferCommandBuffer(FrameResources& resources)
+{
+  static constexpr VkSemaphoreCreateInfo semaphore_create_info = {
+      VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO, nullptr, 0};
+
+  VkDevice device = g_vulkan_context->GetDevice();
+  VkCommandPoolCreateInfo pool_info = {VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO, nullptr, 0,
+                                       g_vulkan_context->GetTransferQueueFamilyIndex()};
+  VkResult res = vkCreateCommandPool(device, &pool_info, nullptr, &resources.transfer_command_pool);
+  if (res != VK_SUCCESS)
+  {
+    LOG_VULKAN_ERROR(res, "vkCreateCommandPool failed: ");
+    return false;
+  }
+
+  VkCommandBufferAllocateInfo buffer_info = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+                                             nullptr, resources.transfer_command_pool,
+                                             VK_COMMAND_BUFFER_LEVEL_PRIMARY, 1};
+  res = vkAllocateCommandBuffers(device, &buffer_info, &resources.transfer_command_buffer);
+  if (res != VK_SUCCESS)
+  {
+    LOG_VULKAN_ERROR(res, "vkAllocateCommandBuffers failed: ");
+    return false;
+  }
+
+  res = vkCreateSemaphore(device, &semaphore_create_info, nullptr, &resources.transfer_semaphore);
+  if (res != VK_SUCCESS)
+  {
+    LOG_VULKAN_ERROR(res, "vkCreateSemaphore failed: ");
+    return false;
+  }
+
+  return true;
+}
+
 void CommandBufferManager::DestroyCommandBuffers()
 {
   VkDevice device = g_vulkan_context->GetDevice();
@@ -142,8 +188,13 @@ void CommandBufferManager::DestroyCommandBuffers()
     // from the pool are freed.". So we don't need to free the command buffers, just the pools.
     // We destroy the command pool first, to avoid any warnings from the validation layers about
     // objects which are pending destruction being in-use.
-    if (resources.command_pool != VK_NULL_HANDLE)
-      vkDestroyCommandPool(device, resources.command_pool, nullptr);
+    for (VkCommandPool command_pool : resources.command_pools)
+    {
+      if (command_pool != VK_NULL_HANDLE)
+        vkDestroyCommandPool(device, command_pool, nullptr);
+    }
+    if (resources.transfer_command_pool != VK_NULL_HANDLE)
+      vkDestroyCommandPool(device, resources.transfer_command_pool, nullptr);
 
     // Destroy any pending objects.
     for (auto& it : resources.cleanup_resources)
@@ -151,6 +202,8 @@ void CommandBufferManager::DestroyCommandBuffers()
 
     if (resources.semaphore != VK_NULL_HANDLE)
       vkDestroySemaphore(device, resources.semaphore, nullptr);
+    if (resources.transfer_semaphore != VK_NULL_HANDLE)
+      vkDestroySemaphore(device, resources.transfer_semaphore, nullptr);
 
     if (resources.fence != VK_NULL_HANDLE)
       vkDestroyFence(device, resources.fence, nullptr);
@@ -274,6 +327,12 @@ void CommandBufferManager::SubmitCommandBuffer(bool submit_on_worker_thread,
                                                VkSwapchainKHR present_swap_chain,
                                                uint32_t present_image_index)
 {
+  if (g_gpu_timing)
+    g_gpu_timing->EndSubmission();
+
+  // Commands still queued on the recorder belong to this command buffer.
+  m_command_recorder->WaitForIdle();
+
   // End the current command buffer.
   FrameResources& resources = m_frame_resources[m_current_frame];
   for (VkCommandBuffer command_buffer : resources.command_buffers)
@@ -285,6 +344,15 @@ void CommandBufferManager::SubmitCommandBuffer(bool submit_on_worker_thread,
       PanicAlertFmt("Failed to end command buffer");
     }
   }
+  if (resources.transfer_command_buffer != VK_NULL_HANDLE)
+  {
+    VkResult res = vkEndCommandBuffer(resources.transfer_command_buffer);
+    if (res != VK_SUCCESS)
+    {
+      LOG_VULKAN_ERROR(res, "vkEndCommandBuffer failed: ");
+      PanicAlertFmt("Failed to end command buffer");
+    }
+  }
 
   // Grab the semaphore before submitting command buffer either on-thread or off-thread.
   // This prevents a race from occurring where a second command buffer is executed
@@ -313,6 +381,9 @@ void CommandBufferManager::SubmitCommandBuffer(bool submit_on_worker_thread,
 
   // Switch to next cmdbuffer.
   BeginCommandBuffer();
+
+  if (g_gpu_timing)
+    g_gpu_timing->BeginSubmission();
 }
 
 void CommandBufferManager::SubmitCommandBuffer(u32 command_buffer_index,
@@ -322,12 +393,45 @@ void CommandBufferManager::SubmitCommandBuffer(u32 command_buffer_index,
   FrameResources& resources = m_frame_resources[command_buffer_index];
 
   // This may be executed on the worker thread, so don't modify any state of the manager class.
-  uint32_t wait_bits = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+  std::array<VkSemaphore, 2> wait_semaphores;
+  std::array<VkPipelineStageFlags, 2> wait_bits;
+  u32 wait_semaphore_count = 0;
+
+  // Uploads on the transfer queue go first, the graphics queue waits for them.
+  if (resources.transfer_command_buffer_used)
+  {
+    VkSubmitInfo transfer_submit_info = {VK_STRUCTURE_TYPE_SUBMIT_INFO,
+                                         nullptr,
+                                         0,
+                                         nullptr,
+                                         nullptr,
+                                         1,
+                                         &resources.transfer_command_buffer,
+                                         1,
+                                         &resources.transfer_semaphore};
+    VkResult res = vkQueueSubmit(g_vulkan_context->GetTransferQueue(), 1, &transfer_submit_info,
+                                 VK_NULL_HANDLE);
+    if (res != VK_SUCCESS)
+    {
+      LOG_VULKAN_ERROR(res, "vkQueueSubmit failed: ");
+      PanicAlertFmt("Failed to submit transfer command buffer.");
+    }
+
+    wait_semaphores[wait_semaphore_count] = resources.transfer_semaphore;
+    wait_bits[wait_semaphore_count++] = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+  }
+
+  if (resources.semaphore_used)
+  {
+    wait_semaphores[wait_semaphore_count] = resources.semaphore;
+    wait_bits[wait_semaphore_count++] = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+  }
+
   VkSubmitInfo submit_info = {VK_STRUCTURE_TYPE_SUBMIT_INFO,
                               nullptr,
-                              0,
-                              nullptr,
-                              &wait_bits,
+                              wait_semaphore_count,
+                              wait_semaphores.data(),
+                              wait_bits.data(),
                               static_cast<u32>(resources.command_buffers.size()),
                               resources.command_buffers.data(),
                               0,
@@ -340,12 +444,6 @@ void CommandBufferManager::SubmitCommandBuffer(u32 command_buffer_index,
     submit_info.pCommandBuffers = &resources.command_buffers[1];
   }
 
-  if (resources.semaphore_used)
-  {
-    submit_info.pWaitSemaphores = &resources.semaphore;
-    submit_info.waitSemaphoreCount = 1;
-  }
-
   if (present_swap_chain != VK_NULL_HANDLE)
   {
     submit_info.signalSemaphoreCount = 1;
@@ -415,9 +513,12 @@ void CommandBufferManager::BeginCommandBuffer()
     LOG_VULKAN_ERROR(res, "vkResetFences failed: ");
 
   // Reset command pools to beginning since we can re-use the memory now
-  res = vkResetCommandPool(g_vulkan_context->GetDevice(), resources.command_pool, 0);
-  if (res != VK_SUCCESS)
-    LOG_VULKAN_ERROR(res, "vkResetCommandPool failed: ");
+  for (VkCommandPool command_pool : resources.command_pools)
+  {
+    res = vkResetCommandPool(g_vulkan_context->GetDevice(), command_pool, 0);
+    if (res != VK_SUCCESS)
+      LOG_VULKAN_ERROR(res, "vkResetCommandPool failed: ");
+  }
 
   // Enable commands to be recorded to the two buffers again.
   VkCommandBufferBeginInfo begin_info = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO, nullptr,
@@ -428,6 +529,16 @@ void CommandBufferManager::BeginCommandBuffer()
     if (res != VK_SUCCESS)
       LOG_VULKAN_ERROR(res, "vkBeginCommandBuffer failed: ");
   }
+  if (resources.transfer_command_buffer != VK_NULL_HANDLE)
+  {
+    res = vkResetCommandPool(g_vulkan_context->GetDevice(), resources.transfer_command_pool, 0);
+    if (res != VK_SUCCESS)
+      LOG_VULKAN_ERROR(res, "vkResetCommandPool failed: ");
+
+    res = vkBeginCommandBuffer(resources.transfer_command_buffer, &begin_info);
+    if (res != VK_SUCCESS)
+      LOG_VULKAN_ERROR(res, "vkBeginCommandBuffer failed: ");
+  }
 
   // Also can do the same for the descriptor pools
   res = vkResetDescriptorPool(g_vulkan_context->GetDevice(), resources.descriptor_pool, 0);
@@ -437,8 +548,10 @@ void CommandBufferManager::BeginCommandBuffer()
   // Reset upload command buffer state
   resources.init_command_buffer_used = false;
   resources.semaphore_used = false;
+  resources.transfer_command_buffer_used = false;
   resources.fence_counter = m_next_fence_counter++;
   m_current_frame = next_buffer_index;
+  m_command_recorder->SetCommandBuffer(resources.command_buffers[1]);
 }
 
 void CommandBufferManager::DeferBufferDestruction(VkBuffer object)
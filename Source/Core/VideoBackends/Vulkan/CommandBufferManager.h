@@ -18,6 +18,7 @@
 #include "Common/Flag.h"
 #include "Common/Semaphore.h"
 
+#include "VideoBackends/Vulkan/CommandRecorder.h"
 #include "VideoBackends/Vulkan/Constants.h"
 
 namespace Vulkan
@@ -25,7 +26,7 @@ namespace Vulkan
 class CommandBufferManager
 {
 public:
-  explicit CommandBufferManager(bool use_threaded_submission);
+  CommandBufferManager(bool use_threaded_submission, bool use_threaded_recording);
   ~CommandBufferManager();
 
   bool Initialize();
@@ -37,10 +38,22 @@ public:
     m_frame_resources[m_current_frame].init_command_buffer_used = true;
     return m_frame_resources[m_current_frame].command_buffers[0];
   }
-  VkCommandBuffer GetCurrentCommandBuffer() const
+  // Waits for the recorder, as commands recorded through the returned buffer have to come after
+  // the ones it has been given.
+  VkCommandBuffer GetCurrentCommandBuffer()
   {
+    m_command_recorder->WaitForIdle();
     return m_frame_resources[m_current_frame].command_buffers[1];
   }
+  // Records StateTracker commands into the draw command buffer, possibly on a worker thread.
+  CommandRecorder* GetCommandRecorder() const { return m_command_recorder.get(); }
+  // Command buffer for the transfer queue, only valid if the context has one. It is submitted
+  // before the other command buffers, which wait for it to complete before they execute.
+  VkCommandBuffer GetCurrentTransferCommandBuffer()
+  {
+    m_frame_resources[m_current_frame].transfer_command_buffer_used = true;
+    return m_frame_resources[m_current_frame].transfer_command_buffer;
+  }
   VkDescriptorPool GetCurrentDescriptorPool() const
   {
     return m_frame_resources[m_current_frame].descriptor_pool;
@@ -104,18 +117,27 @@ private:
   struct FrameResources
   {
     // [0] - Init (upload) command buffer, [1] - draw command buffer
-    VkCommandPool command_pool = VK_NULL_HANDLE;
+    // Each has its own pool, so the draw command buffer can be recorded on the recorder thread
+    // while uploads are recorded on the GPU thread.
+    std::array<VkCommandPool, 2> command_pools = {};
     std::array<VkCommandBuffer, 2> command_buffers = {};
     VkDescriptorPool descriptor_pool = VK_NULL_HANDLE;
     VkFence fence = VK_NULL_HANDLE;
     VkSemaphore semaphore = VK_NULL_HANDLE;
+    // Transfer queue command buffer, and the semaphore it signals for the graphics queue.
+    VkCommandPool transfer_command_pool = VK_NULL_HANDLE;
+    VkCommandBuffer transfer_command_buffer = VK_NULL_HANDLE;
+    VkSemaphore transfer_semaphore = VK_NULL_HANDLE;
     u64 fence_counter = 0;
     bool init_command_buffer_used = false;
     bool semaphore_used = false;
+    bool transfer_command_buffer_used = false;
 
     std::vector<std::function<void()>> cleanup_resources;
   };
 
+  bool CreateTransferCommandBuffer(FrameResources& resources);
+
   u64 m_next_fence_counter = 1;
   u64 m_completed_fence_counter = 0;
 
@@ -139,6 +161,8 @@ private:
   Common::Flag m_last_present_failed;
   VkResult m_last_present_result = VK_SUCCESS;
   bool m_use_threaded_submission = false;
+
+  std::unique_ptr<CommandRecorder> m_command_recorder;
 };
 
 extern std::unique_ptr<CommandBufferManager> g_command_buffer_mgr;
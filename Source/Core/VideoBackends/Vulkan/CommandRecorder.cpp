@@ -0,0 +1,249 @@
+// Copyright 2021 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoBackends/Vulkan/CommandRecorder.h"
+
+#include <algorithm>
+
+#include "Common/Assert.h"
+#include "Common/Thread.h"
+
+namespace Vulkan
+{
+CommandRecorder::CommandRecorder(bool use_thread) : m_use_thread(use_thread)
+{
+  if (!m_use_thread)
+    return;
+
+  m_pending_packets.reserve(PACKETS_PER_KICK * 2);
+  m_loop = std::make_unique<Common::BlockingLoop>();
+  m_thread = std::thread([this]() {
+    Common::SetCurrentThreadName("Vulkan CommandRecorder");
+
+    m_loop->Run([this]() {
+      {
+        std::lock_guard<std::mutex> guard(m_queued_packets_lock);
+        if (m_queued_packets.empty())
+        {
+          m_loop->AllowSleep();
+          return;
+        }
+
+        std::swap(m_queued_packets, m_recording_packets);
+      }
+
+      for (const Packet& packet : m_recording_packets)
+        Record(packet);
+      m_recording_packets.clear();
+    });
+  });
+}
+
+CommandRecorder::~CommandRecorder()
+{
+  if (!m_use_thread)
+    return;
+
+  WaitForIdle();
+  m_loop->Stop();
+  m_thread.join();
+}
+
+void CommandRecorder::BeginRenderPass(VkRenderPass render_pass, VkFramebuffer framebuffer,
+                                      const VkRect2D& render_area,
+                                      const VkClearValue* clear_values, u32 num_clear_values)
+{
+  Packet packet;
+  packet.type = Packet::Type::BeginRenderPass;
+  packet.begin_render_pass.render_pass = render_pass;
+  packet.begin_render_pass.framebuffer = framebuffer;
+  packet.begin_render_pass.render_area = render_area;
+  ASSERT(num_clear_values <= packet.begin_render_pass.clear_values.size());
+  packet.begin_render_pass.num_clear_values = num_clear_values;
+  std::copy_n(clear_values, num_clear_values, packet.begin_render_pass.clear_values.begin());
+  Append(packet);
+}
+
+void CommandRecorder::EndRenderPass()
+{
+  Packet packet;
+  packet.type = Packet::Type::EndRenderPass;
+  Append(packet);
+}
+
+void CommandRecorder::BindPipeline(VkPipeline pipeline)
+{
+  Packet packet;
+  packet.type = Packet::Type::BindPipeline;
+  packet.pipeline = pipeline;
+  Append(packet);
+}
+
+void CommandRecorder::BindVertexBuffer(VkBuffer buffer, VkDeviceSize offset)
+{
+  Packet packet;
+  packet.type = Packet::Type::BindVertexBuffer;
+  packet.bind_buffer = {buffer, offset, VK_INDEX_TYPE_UINT16};
+  Append(packet);
+}
+
+void CommandRecorder::BindIndexBuffer(VkBuffer buffer, VkDeviceSize offset, VkIndexType type)
+{
+  Packet packet;
+  packet.type = Packet::Type::BindIndexBuffer;
+  packet.bind_buffer = {buffer, offset, type};
+  Append(packet);
+}
+
+void CommandRecorder::SetViewport(const VkViewport& viewport)
+{
+  Packet packet;
+  packet.type = Packet::Type::SetViewport;
+  packet.viewport = viewport;
+  Append(packet);
+}
+
+void CommandRecorder::SetScissor(const VkRect2D& scissor)
+{
+  Packet packet;
+  packet.type = Packet::Type::SetScissor;
+  packet.scissor = scissor;
+  Append(packet);
+}
+
+void CommandRecorder::BindDescriptorSets(VkPipelineLayout layout, const VkDescriptorSet* sets,
+                                         u32 num_sets, const u32* dynamic_offsets,
+                                         u32 num_dynamic_offsets)
+{
+  ASSERT(num_sets <= MAX_DESCRIPTOR_SETS && num_dynamic_offsets <= MAX_DYNAMIC_OFFSETS);
+
+  Packet packet;
+  packet.type = Packet::Type::BindDescriptorSets;
+  packet.bind_descriptor_sets.layout = layout;
+  packet.bind_descriptor_sets.num_sets = num_sets;
+  packet.bind_descriptor_sets.num_dynamic_offsets = num_dynamic_offsets;
+  std::copy_n(sets, num_sets, packet.bind_descriptor_sets.sets.begin());
+  std::copy_n(dynamic_offsets, num_dynamic_offsets,
+              packet.bind_descriptor_sets.dynamic_offsets.begin());
+  Append(packet);
+}
+
+void CommandRecorder::Draw(u32 base_vertex, u32 num_vertices)
+{
+  Packet packet;
+  packet.type = Packet::Type::Draw;
+  packet.draw = {base_vertex, 0, num_vertices};
+  Append(packet);
+
+  if (m_pending_packets.size() >= PACKETS_PER_KICK)
+    Kick();
+}
+
+void CommandRecorder::DrawIndexed(u32 base_index, u32 num_indices, u32 base_vertex)
+{
+  Packet packet;
+  packet.type = Packet::Type::DrawIndexed;
+  packet.draw = {base_vertex, base_index, num_indices};
+  Append(packet);
+
+  if (m_pending_packets.size() >= PACKETS_PER_KICK)
+    Kick();
+}
+
+void CommandRecorder::WaitForIdle()
+{
+  if (!m_use_thread)
+    return;
+
+  if (!m_pending_packets.empty())
+    Kick();
+  m_loop->Wait();
+}
+
+void CommandRecorder::Append(const Packet& packet)
+{
+  if (m_use_thread)
+    m_pending_packets.push_back(packet);
+  else
+    Record(packet);
+}
+
+void CommandRecorder::Kick()
+{
+  {
+    std::lock_guard<std::mutex> guard(m_queued_packets_lock);
+    if (m_queued_packets.empty())
+      std::swap(m_queued_packets, m_pending_packets);
+    else
+      m_queued_packets.insert(m_queued_packets.end(), m_pending_packets.begin(),
+                              m_pending_packets.end());
+  }
+
+  m_pending_packets.clear();
+  m_loop->Wakeup();
+}
+
+void CommandRecorder::Record(const Packet& packet) const
+{
+  switch (packet.type)
+  {
+  case Packet::Type::BeginRenderPass:
+  {
+    const BeginRenderPassPacket& data = packet.begin_render_pass;
+    const VkRenderPassBeginInfo begin_info = {VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO,
+                                              nullptr,
+                                              data.render_pass,
+                                              data.framebuffer,
+                                              data.render_area,
+                                              data.num_clear_values,
+                                              data.clear_values.data()};
+    vkCmdBeginRenderPass(m_command_buffer, &begin_info, VK_SUBPASS_CONTENTS_INLINE);
+    break;
+  }
+
+  case Packet::Type::EndRenderPass:
+    vkCmdEndRenderPass(m_command_buffer);
+    break;
+
+  case Packet::Type::BindPipeline:
+    vkCmdBindPipeline(m_command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, packet.pipeline);
+    break;
+
+  case Packet::Type::BindVertexBuffer:
+    vkCmdBindVertexBuffers(m_command_buffer, 0, 1, &packet.bind_buffer.buffer,
+                           &packet.bind_buffer.offset);
+    break;
+
+  case Packet::Type::BindIndexBuffer:
+    vkCmdBindIndexBuffer(m_command_buffer, packet.bind_buffer.buffer, packet.bind_buffer.offset,
+                         packet.bind_buffer.index_type);
+    break;
+
+  case Packet::Type::SetViewport:
+    vkCmdSetViewport(m_command_buffer, 0, 1, &packet.viewport);
+    break;
+
+  case Packet::Type::SetScissor:
+    vkCmdSetScissor(m_command_buffer, 0, 1, &packet.scissor);
+    break;
+
+  case Packet::Type::BindDescriptorSets:
+  {
+    const BindDescriptorSetsPacket& data = packet.bind_descriptor_sets;
+    vkCmdBindDescriptorSets(m_command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, data.layout, 0,
+                            data.num_sets, data.sets.data(), data.num_dynamic_offsets,
+                            data.dynamic_offsets.data());
+    break;
+  }
+
+  case Packet::Type::Draw:
+    vkCmdDraw(m_command_buffer, packet.draw.count, 1, packet.draw.base_vertex, 0);
+    break;
+
+  case Packet::Type::DrawIndexed:
+    vkCmdDrawIndexed(m_command_buffer, packet.draw.count, 1, packet.draw.base_index,
+                     packet.draw.base_vertex, 0);
+    break;
+  }
+}
+}  // namespace Vulkan
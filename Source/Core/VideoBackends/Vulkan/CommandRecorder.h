@@ -0,0 +1,141 @@
+// Copyright 2021 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Common/BlockingLoop.h"
+#include "Common/CommonTypes.h"
+
+#include "VideoBackends/Vulkan/Constants.h"
+
+namespace Vulkan
+{
+// Records the render passes, state changes and draws issued by the StateTracker into the draw
+// command buffer.
+//
+// With threaded recording, the GPU thread only appends compact packets describing the commands,
+// and a worker thread translates them into Vulkan commands. This overlaps the API overhead with
+// vertex loading and the rest of the GX processing on the GPU thread.
+//
+// Anything else recording into the draw command buffer has to wait for the worker to become idle
+// first. CommandBufferManager does this whenever the current command buffer is fetched or
+// submitted, so only code going through the StateTracker may keep the worker busy.
+class CommandRecorder
+{
+public:
+  static constexpr u32 MAX_DESCRIPTOR_SETS = 3;
+  static constexpr u32 MAX_DYNAMIC_OFFSETS = NUM_UBO_DESCRIPTOR_SET_BINDINGS;
+
+  explicit CommandRecorder(bool use_thread);
+  ~CommandRecorder();
+
+  // Must only be called while the recorder is idle.
+  void SetCommandBuffer(VkCommandBuffer command_buffer) { m_command_buffer = command_buffer; }
+
+  void BeginRenderPass(VkRenderPass render_pass, VkFramebuffer framebuffer,
+                       const VkRect2D& render_area, const VkClearValue* clear_values,
+                       u32 num_clear_values);
+  void EndRenderPass();
+  void BindPipeline(VkPipeline pipeline);
+  void BindVertexBuffer(VkBuffer buffer, VkDeviceSize offset);
+  void BindIndexBuffer(VkBuffer buffer, VkDeviceSize offset, VkIndexType type);
+  void SetViewport(const VkViewport& viewport);
+  void SetScissor(const VkRect2D& scissor);
+  void BindDescriptorSets(VkPipelineLayout layout, const VkDescriptorSet* sets, u32 num_sets,
+                          const u32* dynamic_offsets, u32 num_dynamic_offsets);
+  void Draw(u32 base_vertex, u32 num_vertices);
+  void DrawIndexed(u32 base_index, u32 num_indices, u32 base_vertex);
+
+  // Blocks until every command appended so far has been recorded.
+  void WaitForIdle();
+
+private:
+  // Packets are handed to the worker in batches of roughly this many to keep locking rare.
+  static constexpr size_t PACKETS_PER_KICK = 64;
+
+  struct BeginRenderPassPacket
+  {
+    VkRenderPass render_pass;
+    VkFramebuffer framebuffer;
+    VkRect2D render_area;
+    u32 num_clear_values;
+    std::array<VkClearValue, 2> clear_values;
+  };
+
+  struct BindBufferPacket
+  {
+    VkBuffer buffer;
+    VkDeviceSize offset;
+    VkIndexType index_type;
+  };
+
+  struct BindDescriptorSetsPacket
+  {
+    VkPipelineLayout layout;
+    std::array<VkDescriptorSet, MAX_DESCRIPTOR_SETS> sets;
+    std::array<u32, MAX_DYNAMIC_OFFSETS> dynamic_offsets;
+    u32 num_sets;
+    u32 num_dynamic_offsets;
+  };
+
+  struct DrawPacket
+  {
+    u32 base_vertex;
+    u32 base_index;
+    u32 count;
+  };
+
+  struct Packet
+  {
+    enum class Type : u8
+    {
+      BeginRenderPass,
+      EndRenderPass,
+      BindPipeline,
+      BindVertexBuffer,
+      BindIndexBuffer,
+      SetViewport,
+      SetScissor,
+      BindDescriptorSets,
+      Draw,
+      DrawIndexed,
+    };
+
+    Type type;
+    union
+    {
+      BeginRenderPassPacket begin_render_pass;
+      VkPipeline pipeline;
+      BindBufferPacket bind_buffer;
+      VkViewport viewport;
+      VkRect2D scissor;
+      BindDescriptorSetsPacket bind_descriptor_sets;
+      DrawPacket draw;
+    };
+  };
+
+  void Append(const Packet& packet);
+  void Kick();
+  void Record(const Packet& packet) const;
+
+  VkCommandBuffer m_command_buffer = VK_NULL_HANDLE;
+  bool m_use_thread;
+
+  // Packets appended by the GPU thread since the last kick.
+  std::vector<Packet> m_pending_packets;
+
+  // Packets handed to the worker thread, and the ones it is currently recording.
+  std::mutex m_queued_packets_lock;
+  std::vector<Packet> m_queued_packets;
+  std::vector<Packet> m_recording_packets;
+
+  std::thread m_thread;
+  std::unique_ptr<Common::BlockingLoop> m_loop;
+};
+}  // namespace Vulkan
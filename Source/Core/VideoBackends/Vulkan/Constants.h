@@ -79,13 +79,17 @@ constexpr u32 NUM_COMPUTE_SHADER_SAMPLERS = 2;
 // Number of texel buffer binding points.
 constexpr u32 NUM_COMPUTE_TEXEL_BUFFERS = 2;
 
-// Textures that don't fit into this buffer will be uploaded with a separate buffer (see below).
+// Initial and maximum size of the texture upload buffers. Rather than waiting for the GPU or
+// executing the command buffer when the free space is still in use, they grow up to the maximum.
 constexpr u32 TEXTURE_UPLOAD_BUFFER_SIZE = 32 * 1024 * 1024;
+constexpr u32 TEXTURE_UPLOAD_BUFFER_MAX_SIZE = 256 * 1024 * 1024;
 
-// Textures greater than 1024*1024 will be put in staging textures that are released after
-// execution instead. A 2048x2048 texture is 16MB, and we'd only fit four of these in our
-// streaming buffer and be blocking frequently. Games are unlikely to have textures this
-// large anyway, so it's only really an issue for HD texture packs, and memory is not
-// a limiting factor in these scenarios anyway.
-constexpr u32 STAGING_TEXTURE_UPLOAD_THRESHOLD = 1024 * 1024 * 4;
+// Textures larger than this are put in staging buffers that are released after execution
+// instead, so that a single huge texture from an HD texture pack doesn't keep the upload buffers
+// at their maximum size.
+constexpr u32 STAGING_TEXTURE_UPLOAD_THRESHOLD = 64 * 1024 * 1024;
+
+// Uploads larger than this into new textures go on the transfer queue if there is one. A
+// 1024x1024 RGBA8 texture is 4MB, which games rarely exceed, so this is mostly HD texture packs.
+constexpr u32 TRANSFER_QUEUE_UPLOAD_THRESHOLD = 4 * 1024 * 1024;
 }  // namespace Vulkan
@@ -80,12 +80,11 @@ void ObjectCache::Shutdown()
 
 void ObjectCache::ClearSamplerCache()
 {
-  for (const auto& it : m_sampler_cache)
-  {
-    if (it.second != VK_NULL_HANDLE)
-      vkDestroySampler(g_vulkan_context->GetDevice(), it.second, nullptr);
-  }
-  m_sampler_cache.clear();
+  m_sampler_cache.ForEach([](SamplerState::StorageType, VkSampler sampler) {
+    if (sampler != VK_NULL_HANDLE)
+      vkDestroySampler(g_vulkan_context->GetDevice(), sampler, nullptr);
+  });
+  m_sampler_cache.Clear();
 }
 
 void ObjectCache::DestroySamplers()
@@ -301,11 +300,21 @@ bool ObjectCache::CreateStaticSamplers()
   return true;
 }
 
+StreamBuffer* ObjectCache::GetTransferUploadBuffer()
+{
+  if (!m_transfer_upload_buffer)
+  {
+    m_transfer_upload_buffer =
+        StreamBuffer::Create(VK_BUFFER_USAGE_TRANSFER_SRC_BIT, TEXTURE_UPLOAD_BUFFER_SIZE);
+  }
+
+  return m_transfer_upload_buffer.get();
+}
+
 VkSampler ObjectCache::GetSampler(const SamplerState& info)
 {
-  auto iter = m_sampler_cache.find(info);
-  if (iter != m_sampler_cache.end())
-    return iter->second;
+  if (const VkSampler* sampler = m_sampler_cache.Find(info.hex))
+    return *sampler;
 
   static constexpr std::array<VkFilter, 4> filters = {{VK_FILTER_NEAREST, VK_FILTER_LINEAR}};
   static constexpr std::array<VkSamplerMipmapMode, 2> mipmap_modes = {
@@ -350,17 +359,16 @@ VkSampler ObjectCache::GetSampler(const SamplerState& info)
     LOG_VULKAN_ERROR(res, "vkCreateSampler failed: ");
 
   // Store it even if it failed
-  m_sampler_cache.emplace(info, sampler);
+  m_sampler_cache.TryEmplace(info.hex, sampler);
   return sampler;
 }
 
 VkRenderPass ObjectCache::GetRenderPass(VkFormat color_format, VkFormat depth_format,
                                         u32 multisamples, VkAttachmentLoadOp load_op)
 {
-  auto key = std::tie(color_format, depth_format, multisamples, load_op);
-  auto it = m_render_pass_cache.find(key);
-  if (it != m_render_pass_cache.end())
-    return it->second;
+  const RenderPassCacheKey key = {color_format, depth_format, multisamples, load_op};
+  if (const VkRenderPass* pass = m_render_pass_cache.Find(key))
+    return *pass;
 
   VkAttachmentReference color_reference;
   VkAttachmentReference* color_reference_ptr = nullptr;
@@ -429,15 +437,16 @@ VkRenderPass ObjectCache::GetRenderPass(VkFormat color_format, VkFormat depth_fo
     return VK_NULL_HANDLE;
   }
 
-  m_render_pass_cache.emplace(key, pass);
+  m_render_pass_cache.TryEmplace(key, pass);
   return pass;
 }
 
 void ObjectCache::DestroyRenderPassCache()
 {
-  for (auto& it : m_render_pass_cache)
-    vkDestroyRenderPass(g_vulkan_context->GetDevice(), it.second, nullptr);
-  m_render_pass_cache.clear();
+  m_render_pass_cache.ForEach([](const RenderPassCacheKey&, VkRenderPass pass) {
+    vkDestroyRenderPass(g_vulkan_context->GetDevice(), pass, nullptr);
+  });
+  m_render_pass_cache.Clear();
 }
 
 class PipelineCacheReadCallback : public LinearDiskCacheReader<u32, u8>
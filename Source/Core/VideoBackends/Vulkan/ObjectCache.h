@@ -5,13 +5,12 @@
 
 #include <array>
 #include <cstddef>
-#include <map>
 #include <memory>
 #include <string>
-#include <tuple>
 #include <unordered_map>
 
 #include "Common/CommonTypes.h"
+#include "Common/FlatHashMap.h"
 #include "Common/LinearDiskCache.h"
 
 #include "VideoBackends/Vulkan/Constants.h"
@@ -53,6 +52,10 @@ public:
   // Staging buffer for textures.
   StreamBuffer* GetTextureUploadBuffer() const { return m_texture_upload_buffer.get(); }
 
+  // Staging buffer for textures uploaded on the transfer queue, which needs its own as buffers
+  // belong to the queue family using them. Created on first use, returns nullptr on failure.
+  StreamBuffer* GetTransferUploadBuffer();
+
   // Static samplers
   VkSampler GetPointSampler() const { return m_point_sampler; }
   VkSampler GetLinearSampler() const { return m_linear_sampler; }
@@ -92,18 +95,43 @@ private:
   std::array<VkPipelineLayout, NUM_PIPELINE_LAYOUTS> m_pipeline_layouts = {};
 
   std::unique_ptr<StreamBuffer> m_texture_upload_buffer;
+  std::unique_ptr<StreamBuffer> m_transfer_upload_buffer;
 
   VkSampler m_point_sampler = VK_NULL_HANDLE;
   VkSampler m_linear_sampler = VK_NULL_HANDLE;
 
-  std::map<SamplerState, VkSampler> m_sampler_cache;
+  // Looked up whenever a texture unit's sampler changes, keyed by the packed sampler state.
+  Common::FlatHashMap<SamplerState::StorageType, VkSampler> m_sampler_cache;
 
   // Dummy image for samplers that are unbound
   std::unique_ptr<VKTexture> m_dummy_texture;
 
-  // Render pass cache
-  using RenderPassCacheKey = std::tuple<VkFormat, VkFormat, u32, VkAttachmentLoadOp>;
-  std::map<RenderPassCacheKey, VkRenderPass> m_render_pass_cache;
+  // Render pass cache, looked up whenever the framebuffer changes.
+  struct RenderPassCacheKey
+  {
+    VkFormat color_format;
+    VkFormat depth_format;
+    u32 multisamples;
+    VkAttachmentLoadOp load_op;
+
+    bool operator==(const RenderPassCacheKey& rhs) const
+    {
+      return color_format == rhs.color_format && depth_format == rhs.depth_format &&
+             multisamples == rhs.multisamples && load_op == rhs.load_op;
+    }
+  };
+  struct RenderPassCacheKeyHash
+  {
+    size_t operator()(const RenderPassCacheKey& key) const
+    {
+      const u64 formats = (u64{static_cast<u32>(key.color_format)} << 32) |
+                          static_cast<u32>(key.depth_format);
+      const u64 params = (u64{key.multisamples} << 8) | static_cast<u32>(key.load_op);
+      return std::hash<u64>{}(formats ^ (params * 0x9E3779B97F4A7C15ULL));
+    }
+  };
+  Common::FlatHashMap<RenderPassCacheKey, VkRenderPass, RenderPassCacheKeyHash>
+      m_render_pass_cache;
 
   // pipeline cache
   VkPipelineCache m_pipeline_cache = VK_NULL_HANDLE;
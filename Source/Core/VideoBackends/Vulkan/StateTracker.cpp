@@ -3,6 +3,8 @@
 
 #include "VideoBackends/Vulkan/StateTracker.h"
 
+#include <algorithm>
+
 #include "Common/Assert.h"
 
 #include "VideoBackends/Vulkan/CommandBufferManager.h"
@@ -13,6 +15,7 @@
 #include "VideoBackends/Vulkan/VKTexture.h"
 #include "VideoBackends/Vulkan/VKVertexFormat.h"
 #include "VideoBackends/Vulkan/VulkanContext.h"
+#include "VideoCommon/Statistics.h"
 
 namespace Vulkan
 {
@@ -240,6 +243,7 @@ void StateTracker::InvalidateCachedState()
   m_gx_descriptor_sets.fill(VK_NULL_HANDLE);
   m_utility_descriptor_sets.fill(VK_NULL_HANDLE);
   m_compute_descriptor_set = VK_NULL_HANDLE;
+  m_gx_sampler_descriptor_sets.clear();
   m_dirty_flags |= DIRTY_FLAG_ALL_DESCRIPTORS | DIRTY_FLAG_VIEWPORT | DIRTY_FLAG_SCISSOR |
                    DIRTY_FLAG_PIPELINE | DIRTY_FLAG_COMPUTE_SHADER | DIRTY_FLAG_DESCRIPTOR_SETS |
                    DIRTY_FLAG_COMPUTE_DESCRIPTOR_SET;
@@ -252,21 +256,17 @@ void StateTracker::InvalidateCachedState()
 void StateTracker::BeginRenderPass()
 {
   if (InRenderPass())
+  {
+    // Record the discard or clear render pass we selected earlier.
+    if (!m_render_pass_started)
+      StartRenderPass();
     return;
+  }
 
   m_current_render_pass = m_framebuffer->GetLoadRenderPass();
   m_framebuffer_render_area = m_framebuffer->GetRect();
-
-  VkRenderPassBeginInfo begin_info = {VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO,
-                                      nullptr,
-                                      m_current_render_pass,
-                                      m_framebuffer->GetFB(),
-                                      m_framebuffer_render_area,
-                                      0,
-                                      nullptr};
-
-  vkCmdBeginRenderPass(g_command_buffer_mgr->GetCurrentCommandBuffer(), &begin_info,
-                       VK_SUBPASS_CONTENTS_INLINE);
+  m_num_clear_values = 0;
+  StartRenderPass();
 }
 
 void StateTracker::BeginDiscardRenderPass()
@@ -276,17 +276,7 @@ void StateTracker::BeginDiscardRenderPass()
 
   m_current_render_pass = m_framebuffer->GetDiscardRenderPass();
   m_framebuffer_render_area = m_framebuffer->GetRect();
-
-  VkRenderPassBeginInfo begin_info = {VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO,
-                                      nullptr,
-                                      m_current_render_pass,
-                                      m_framebuffer->GetFB(),
-                                      m_framebuffer_render_area,
-                                      0,
-                                      nullptr};
-
-  vkCmdBeginRenderPass(g_command_buffer_mgr->GetCurrentCommandBuffer(), &begin_info,
-                       VK_SUBPASS_CONTENTS_INLINE);
+  m_num_clear_values = 0;
 }
 
 void StateTracker::EndRenderPass()
@@ -294,28 +284,42 @@ void StateTracker::EndRenderPass()
   if (!InRenderPass())
     return;
 
-  vkCmdEndRenderPass(g_command_buffer_mgr->GetCurrentCommandBuffer());
+  // Nothing was drawn in the pass. A discard pass can be skipped entirely, but a clear pass
+  // still has to be recorded for its load op.
+  if (!m_render_pass_started && m_current_render_pass == m_framebuffer->GetClearRenderPass())
+    StartRenderPass();
+
+  if (m_render_pass_started)
+    g_command_buffer_mgr->GetCommandRecorder()->EndRenderPass();
   m_current_render_pass = VK_NULL_HANDLE;
+  m_render_pass_started = false;
+}
+
+bool StateTracker::CanReplaceRenderPass() const
+{
+  return !InRenderPass() ||
+         (!m_render_pass_started && m_current_render_pass != m_framebuffer->GetClearRenderPass());
 }
 
 void StateTracker::BeginClearRenderPass(const VkRect2D& area, const VkClearValue* clear_values,
                                         u32 num_clear_values)
 {
-  ASSERT(!InRenderPass());
+  ASSERT(CanReplaceRenderPass());
+  ASSERT(num_clear_values <= m_clear_values.size());
 
   m_current_render_pass = m_framebuffer->GetClearRenderPass();
   m_framebuffer_render_area = area;
+  std::copy_n(clear_values, num_clear_values, m_clear_values.begin());
+  m_num_clear_values = num_clear_values;
+}
 
-  VkRenderPassBeginInfo begin_info = {VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO,
-                                      nullptr,
-                                      m_current_render_pass,
-                                      m_framebuffer->GetFB(),
-                                      m_framebuffer_render_area,
-                                      num_clear_values,
-                                      clear_values};
-
-  vkCmdBeginRenderPass(g_command_buffer_mgr->GetCurrentCommandBuffer(), &begin_info,
-                       VK_SUBPASS_CONTENTS_INLINE);
+void StateTracker::StartRenderPass()
+{
+  g_command_buffer_mgr->GetCommandRecorder()->BeginRenderPass(
+      m_current_render_pass, m_framebuffer->GetFB(), m_framebuffer_render_area,
+      m_clear_values.data(), m_num_clear_values);
+  m_render_pass_started = true;
+  INCSTAT(g_stats.this_frame.num_render_passes);
 }
 
 void StateTracker::SetViewport(const VkViewport& viewport)
@@ -361,25 +365,24 @@ bool StateTracker::Bind()
   }
 
   // Start render pass if not already started
-  if (!InRenderPass())
-    BeginRenderPass();
+  BeginRenderPass();
 
   // Re-bind parts of the pipeline
-  const VkCommandBuffer command_buffer = g_command_buffer_mgr->GetCurrentCommandBuffer();
+  CommandRecorder* const recorder = g_command_buffer_mgr->GetCommandRecorder();
   if (m_dirty_flags & DIRTY_FLAG_VERTEX_BUFFER)
-    vkCmdBindVertexBuffers(command_buffer, 0, 1, &m_vertex_buffer, &m_vertex_buffer_offset);
+    recorder->BindVertexBuffer(m_vertex_buffer, m_vertex_buffer_offset);
 
   if (m_dirty_flags & DIRTY_FLAG_INDEX_BUFFER)
-    vkCmdBindIndexBuffer(command_buffer, m_index_buffer, m_index_buffer_offset, m_index_type);
+    recorder->BindIndexBuffer(m_index_buffer, m_index_buffer_offset, m_index_type);
 
   if (m_dirty_flags & DIRTY_FLAG_PIPELINE)
-    vkCmdBindPipeline(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_pipeline->GetVkPipeline());
+    recorder->BindPipeline(m_pipeline->GetVkPipeline());
 
   if (m_dirty_flags & DIRTY_FLAG_VIEWPORT)
-    vkCmdSetViewport(command_buffer, 0, 1, &m_viewport);
+    recorder->SetViewport(m_viewport);
 
   if (m_dirty_flags & DIRTY_FLAG_SCISSOR)
-    vkCmdSetScissor(command_buffer, 0, 1, &m_scissor);
+    recorder->SetScissor(m_scissor);
 
   m_dirty_flags &= ~(DIRTY_FLAG_VERTEX_BUFFER | DIRTY_FLAG_INDEX_BUFFER | DIRTY_FLAG_PIPELINE |
                      DIRTY_FLAG_VIEWPORT | DIRTY_FLAG_SCISSOR);
@@ -498,22 +501,38 @@ bool StateTracker::UpdateGXDescriptorSet()
 
   if (m_dirty_flags & DIRTY_FLAG_GX_SAMPLERS || m_gx_descriptor_sets[1] == VK_NULL_HANDLE)
   {
-    m_gx_descriptor_sets[1] = g_command_buffer_mgr->AllocateDescriptorSet(
-        g_object_cache->GetDescriptorSetLayout(DESCRIPTOR_SET_LAYOUT_STANDARD_SAMPLERS));
-    if (m_gx_descriptor_sets[1] == VK_NULL_HANDLE)
-      return false;
+    // Reuse the set from an earlier draw with the same textures and samplers if there is one.
+    SamplerBindings key;
+    for (size_t i = 0; i < NUM_PIXEL_SHADER_SAMPLERS; i++)
+      key[i] = {m_bindings.samplers[i].imageView, m_bindings.samplers[i].sampler};
+
+    auto it = m_gx_sampler_descriptor_sets.find(key);
+    if (it == m_gx_sampler_descriptor_sets.end())
+    {
+      const VkDescriptorSet set = g_command_buffer_mgr->AllocateDescriptorSet(
+          g_object_cache->GetDescriptorSetLayout(DESCRIPTOR_SET_LAYOUT_STANDARD_SAMPLERS));
+      if (set == VK_NULL_HANDLE)
+        return false;
 
-    writes[num_writes++] = {VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
-                            nullptr,
-                            m_gx_descriptor_sets[1],
-                            0,
-                            0,
-                            static_cast<u32>(NUM_PIXEL_SHADER_SAMPLERS),
-                            VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
-                            m_bindings.samplers.data(),
-                            nullptr,
-                            nullptr};
-    m_dirty_flags = (m_dirty_flags & ~DIRTY_FLAG_GX_SAMPLERS) | DIRTY_FLAG_DESCRIPTOR_SETS;
+      writes[num_writes++] = {VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+                              nullptr,
+                              set,
+                              0,
+                              0,
+                              static_cast<u32>(NUM_PIXEL_SHADER_SAMPLERS),
+                              VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+                              m_bindings.samplers.data(),
+                              nullptr,
+                              nullptr};
+      it = m_gx_sampler_descriptor_sets.emplace(key, set).first;
+    }
+
+    if (m_gx_descriptor_sets[1] != it->second)
+    {
+      m_gx_descriptor_sets[1] = it->second;
+      m_dirty_flags |= DIRTY_FLAG_DESCRIPTOR_SETS;
+    }
+    m_dirty_flags &= ~DIRTY_FLAG_GX_SAMPLERS;
   }
 
   if (g_ActiveConfig.backend_info.bSupportsBBox &&
@@ -536,27 +555,24 @@ bool StateTracker::UpdateGXDescriptorSet()
 
   if (m_dirty_flags & DIRTY_FLAG_DESCRIPTOR_SETS)
   {
-    vkCmdBindDescriptorSets(g_command_buffer_mgr->GetCurrentCommandBuffer(),
-                            VK_PIPELINE_BIND_POINT_GRAPHICS, m_pipeline->GetVkPipelineLayout(), 0,
-                            g_ActiveConfig.backend_info.bSupportsBBox ?
-                                NUM_GX_DESCRIPTOR_SETS :
-                                (NUM_GX_DESCRIPTOR_SETS - 1),
-                            m_gx_descriptor_sets.data(),
-                            g_ActiveConfig.backend_info.bSupportsGeometryShaders ?
-                                NUM_UBO_DESCRIPTOR_SET_BINDINGS :
-                                (NUM_UBO_DESCRIPTOR_SET_BINDINGS - 1),
-                            m_bindings.gx_ubo_offsets.data());
+    g_command_buffer_mgr->GetCommandRecorder()->BindDescriptorSets(
+        m_pipeline->GetVkPipelineLayout(), m_gx_descriptor_sets.data(),
+        g_ActiveConfig.backend_info.bSupportsBBox ? NUM_GX_DESCRIPTOR_SETS :
+                                                    (NUM_GX_DESCRIPTOR_SETS - 1),
+        m_bindings.gx_ubo_offsets.data(),
+        g_ActiveConfig.backend_info.bSupportsGeometryShaders ?
+            NUM_UBO_DESCRIPTOR_SET_BINDINGS :
+            (NUM_UBO_DESCRIPTOR_SET_BINDINGS - 1));
     m_dirty_flags &= ~(DIRTY_FLAG_DESCRIPTOR_SETS | DIRTY_FLAG_GX_UBO_OFFSETS);
   }
   else if (m_dirty_flags & DIRTY_FLAG_GX_UBO_OFFSETS)
   {
-    vkCmdBindDescriptorSets(g_command_buffer_mgr->GetCurrentCommandBuffer(),
-                            VK_PIPELINE_BIND_POINT_GRAPHICS, m_pipeline->GetVkPipelineLayout(), 0,
-                            1, m_gx_descriptor_sets.data(),
-                            g_ActiveConfig.backend_info.bSupportsGeometryShaders ?
-                                NUM_UBO_DESCRIPTOR_SET_BINDINGS :
-                                (NUM_UBO_DESCRIPTOR_SET_BINDINGS - 1),
-                            m_bindings.gx_ubo_offsets.data());
+    g_command_buffer_mgr->GetCommandRecorder()->BindDescriptorSets(
+        m_pipeline->GetVkPipelineLayout(), m_gx_descriptor_sets.data(), 1,
+        m_bindings.gx_ubo_offsets.data(),
+        g_ActiveConfig.backend_info.bSupportsGeometryShaders ?
+            NUM_UBO_DESCRIPTOR_SET_BINDINGS :
+            (NUM_UBO_DESCRIPTOR_SET_BINDINGS - 1));
     m_dirty_flags &= ~DIRTY_FLAG_GX_UBO_OFFSETS;
   }
 
@@ -627,17 +643,16 @@ bool StateTracker::UpdateUtilityDescriptorSet()
 
   if (m_dirty_flags & DIRTY_FLAG_DESCRIPTOR_SETS)
   {
-    vkCmdBindDescriptorSets(g_command_buffer_mgr->GetCurrentCommandBuffer(),
-                            VK_PIPELINE_BIND_POINT_GRAPHICS, m_pipeline->GetVkPipelineLayout(), 0,
-                            NUM_UTILITY_DESCRIPTOR_SETS, m_utility_descriptor_sets.data(), 1,
-                            &m_bindings.utility_ubo_offset);
+    g_command_buffer_mgr->GetCommandRecorder()->BindDescriptorSets(
+        m_pipeline->GetVkPipelineLayout(), m_utility_descriptor_sets.data(),
+        NUM_UTILITY_DESCRIPTOR_SETS, &m_bindings.utility_ubo_offset, 1);
     m_dirty_flags &= ~(DIRTY_FLAG_DESCRIPTOR_SETS | DIRTY_FLAG_UTILITY_UBO_OFFSET);
   }
   else if (m_dirty_flags & DIRTY_FLAG_UTILITY_UBO_OFFSET)
   {
-    vkCmdBindDescriptorSets(g_command_buffer_mgr->GetCurrentCommandBuffer(),
-                            VK_PIPELINE_BIND_POINT_GRAPHICS, m_pipeline->GetVkPipelineLayout(), 0,
-                            1, m_utility_descriptor_sets.data(), 1, &m_bindings.utility_ubo_offset);
+    g_command_buffer_mgr->GetCommandRecorder()->BindDescriptorSets(
+        m_pipeline->GetVkPipelineLayout(), m_utility_descriptor_sets.data(), 1,
+        &m_bindings.utility_ubo_offset, 1);
     m_dirty_flags &= ~(DIRTY_FLAG_DESCRIPTOR_SETS | DIRTY_FLAG_UTILITY_UBO_OFFSET);
   }
 
@@ -5,7 +5,9 @@
 
 #include <array>
 #include <cstddef>
+#include <map>
 #include <memory>
+#include <utility>
 
 #include "Common/CommonTypes.h"
 #include "VideoBackends/Vulkan/Constants.h"
@@ -53,11 +55,20 @@ public:
   // Ends a render pass if we're currently in one.
   // When Bind() is next called, the pass will be restarted.
   // Calling this function is allowed even if a pass has not begun.
+  //
+  // Discard and clear render passes are only recorded once something is drawn in them, so
+  // passes which end up empty are skipped, and clear passes can still be replaced by another
+  // clear. This saves the tile loads and stores on tile-based GPUs.
   bool InRenderPass() const { return m_current_render_pass != VK_NULL_HANDLE; }
+  bool HasRenderPassStarted() const { return m_render_pass_started; }
   void BeginRenderPass();
   void BeginDiscardRenderPass();
   void EndRenderPass();
 
+  // Returns true if nothing has been recorded in the current render pass, and it does not have
+  // a pending clear, so a clear render pass can be started in its place.
+  bool CanReplaceRenderPass() const;
+
   // Ends the current render pass if it was a clear render pass.
   void BeginClearRenderPass(const VkRect2D& area, const VkClearValue* clear_values,
                             u32 num_clear_values);
@@ -112,6 +123,9 @@ private:
 
   bool Initialize();
 
+  // Records the selected render pass in the command buffer.
+  void StartRenderPass();
+
   // Check that the specified viewport is within the render area.
   // If not, ends the render pass if it is a clear render pass.
   bool IsViewportWithinRenderArea() const;
@@ -151,6 +165,11 @@ private:
   std::array<VkDescriptorSet, NUM_UTILITY_DESCRIPTOR_SETS> m_utility_descriptor_sets = {};
   VkDescriptorSet m_compute_descriptor_set = VK_NULL_HANDLE;
 
+  // GX sampler descriptor sets written in the current command buffer, keyed by their bindings.
+  // Games usually switch between a small number of texture combinations within a frame.
+  using SamplerBindings = std::array<std::pair<VkImageView, VkSampler>, NUM_PIXEL_SHADER_SAMPLERS>;
+  std::map<SamplerBindings, VkDescriptorSet> m_gx_sampler_descriptor_sets;
+
   // rasterization
   VkViewport m_viewport = {0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 1.0f};
   VkRect2D m_scissor = {{0, 0}, {1, 1}};
@@ -161,5 +180,8 @@ private:
   VKFramebuffer* m_framebuffer = nullptr;
   VkRenderPass m_current_render_pass = VK_NULL_HANDLE;
   VkRect2D m_framebuffer_render_area = {};
+  std::array<VkClearValue, 2> m_clear_values = {};
+  u32 m_num_clear_values = 0;
+  bool m_render_pass_started = false;
 };
 }  // namespace Vulkan
@@ -111,6 +111,7 @@ void BoundingBox::Invalidate()
     return;
 
   m_valid = false;
+  m_prefetch_valid = false;
 }
 
 s32 BoundingBox::Get(size_t index)
@@ -142,6 +143,7 @@ void BoundingBox::Set(size_t index, s32 value)
   // Flag as dirty, and update values.
   m_readback_buffer->Write(index * sizeof(s32), &value, sizeof(value), true);
   m_values_dirty[index] = true;
+  m_prefetch_valid = false;
 }
 
 bool BoundingBox::CreateGPUBuffer()
@@ -212,10 +214,50 @@ bool BoundingBox::CreateReadbackBuffer()
   if (!m_readback_buffer || !m_readback_buffer->Map())
     return false;
 
+  m_prefetch_buffer = StagingBuffer::Create(STAGING_BUFFER_TYPE_READBACK, BUFFER_SIZE,
+                                            VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+  if (!m_prefetch_buffer || !m_prefetch_buffer->Map())
+    return false;
+
   return true;
 }
 
-void BoundingBox::Readback()
+void BoundingBox::Prefetch()
+{
+  if (m_gpu_buffer == VK_NULL_HANDLE)
+    return;
+
+  CopyToReadbackBuffer(m_prefetch_buffer.get());
+  m_prefetch_fence_counter = g_command_buffer_mgr->GetCurrentFenceCounter();
+  m_prefetch_pending = true;
+}
+
+s32 BoundingBox::GetPrefetched(size_t index)
+{
+  ASSERT(index < NUM_VALUES);
+
+  if (m_prefetch_pending)
+  {
+    if (g_command_buffer_mgr->GetCurrentFenceCounter() == m_prefetch_fence_counter)
+      Renderer::GetInstance()->ExecuteCommandBuffer(false, true);
+    else
+      g_command_buffer_mgr->WaitForFenceCounter(m_prefetch_fence_counter);
+
+    // The values stay valid for the reads of the other indices until the next write or draw.
+    m_prefetch_buffer->InvalidateCPUCache();
+    m_prefetch_pending = false;
+    m_prefetch_valid = true;
+  }
+
+  if (!m_prefetch_valid)
+    return Get(index);
+
+  s32 value;
+  m_prefetch_buffer->Read(index * sizeof(s32), &value, sizeof(value), false);
+  return value;
+}
+
+void BoundingBox::CopyToReadbackBuffer(StagingBuffer* buffer)
 {
   // Can't be done within a render pass.
   StateTracker::GetInstance()->EndRenderPass();
@@ -225,22 +267,26 @@ void BoundingBox::Readback()
       g_command_buffer_mgr->GetCurrentCommandBuffer(), m_gpu_buffer,
       VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT, VK_ACCESS_TRANSFER_READ_BIT, 0,
       BUFFER_SIZE, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
-  m_readback_buffer->PrepareForGPUWrite(g_command_buffer_mgr->GetCurrentCommandBuffer(),
-                                        VK_ACCESS_TRANSFER_WRITE_BIT,
-                                        VK_PIPELINE_STAGE_TRANSFER_BIT);
+  buffer->PrepareForGPUWrite(g_command_buffer_mgr->GetCurrentCommandBuffer(),
+                             VK_ACCESS_TRANSFER_WRITE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
 
   // Copy from GPU -> readback buffer.
   VkBufferCopy region = {0, 0, BUFFER_SIZE};
   vkCmdCopyBuffer(g_command_buffer_mgr->GetCurrentCommandBuffer(), m_gpu_buffer,
-                  m_readback_buffer->GetBuffer(), 1, &region);
+                  buffer->GetBuffer(), 1, &region);
 
   // Restore GPU buffer access.
   StagingBuffer::BufferMemoryBarrier(
       g_command_buffer_mgr->GetCurrentCommandBuffer(), m_gpu_buffer, VK_ACCESS_TRANSFER_READ_BIT,
       VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT, 0, BUFFER_SIZE,
       VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT);
-  m_readback_buffer->FlushGPUCache(g_command_buffer_mgr->GetCurrentCommandBuffer(),
-                                   VK_ACCESS_TRANSFER_WRITE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+  buffer->FlushGPUCache(g_command_buffer_mgr->GetCurrentCommandBuffer(),
+                        VK_ACCESS_TRANSFER_WRITE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+}
+
+void BoundingBox::Readback()
+{
+  CopyToReadbackBuffer(m_readback_buffer.get());
 
   // Wait until these commands complete.
   Renderer::GetInstance()->ExecuteCommandBuffer(false, true);
@@ -29,9 +29,14 @@ public:
   void Invalidate();
   void Flush();
 
+  // Copies the values to a separate buffer without waiting, which GetPrefetched() reads from.
+  void Prefetch();
+  s32 GetPrefetched(size_t index);
+
 private:
   bool CreateGPUBuffer();
   bool CreateReadbackBuffer();
+  void CopyToReadbackBuffer(StagingBuffer* buffer);
   void Readback();
 
   VkBuffer m_gpu_buffer = VK_NULL_HANDLE;
@@ -41,6 +46,10 @@ private:
   static const size_t BUFFER_SIZE = sizeof(u32) * NUM_VALUES;
 
   std::unique_ptr<StagingBuffer> m_readback_buffer;
+  std::unique_ptr<StagingBuffer> m_prefetch_buffer;
+  u64 m_prefetch_fence_counter = 0;
+  bool m_prefetch_pending = false;
+  bool m_prefetch_valid = false;
   std::array<bool, NUM_VALUES> m_values_dirty = {};
   bool m_valid = true;
 };
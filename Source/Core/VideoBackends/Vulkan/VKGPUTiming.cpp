@@ -0,0 +1,101 @@
+// Copyright 2021 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoBackends/Vulkan/VKGPUTiming.h"
+
+#include "VideoBackends/Vulkan/CommandBufferManager.h"
+#include "VideoBackends/Vulkan/StateTracker.h"
+#include "VideoBackends/Vulkan/VulkanContext.h"
+
+namespace Vulkan
+{
+GPUTiming::GPUTiming(VkQueryPool query_pool, u32 timestamp_valid_bits, float timestamp_period)
+    : m_query_pool(query_pool),
+      m_timestamp_mask(timestamp_valid_bits < 64 ? (u64{1} << timestamp_valid_bits) - 1 : ~u64{0}),
+      m_timestamp_period(timestamp_period)
+{
+}
+
+GPUTiming::~GPUTiming()
+{
+  vkDestroyQueryPool(g_vulkan_context->GetDevice(), m_query_pool, nullptr);
+}
+
+std::unique_ptr<GPUTiming> GPUTiming::Create()
+{
+  const u32 timestamp_valid_bits =
+      g_vulkan_context->GetGraphicsQueueProperties().timestampValidBits;
+  if (timestamp_valid_bits == 0)
+    return nullptr;
+
+  VkQueryPoolCreateInfo info = {
+      VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO,  // VkStructureType                  sType
+      nullptr,                                   // const void*                      pNext
+      0,                                         // VkQueryPoolCreateFlags           flags
+      VK_QUERY_TYPE_TIMESTAMP,                   // VkQueryType                      queryType
+      NUM_FRAMES * MAX_TIMESTAMPS_PER_FRAME,     // uint32_t                         queryCount
+      0  // VkQueryPipelineStatisticFlags    pipelineStatistics;
+  };
+
+  VkQueryPool query_pool;
+  VkResult res = vkCreateQueryPool(g_vulkan_context->GetDevice(), &info, nullptr, &query_pool);
+  if (res != VK_SUCCESS)
+  {
+    LOG_VULKAN_ERROR(res, "vkCreateQueryPool failed: ");
+    return nullptr;
+  }
+
+  return std::make_unique<GPUTiming>(query_pool, timestamp_valid_bits,
+                                     g_vulkan_context->GetDeviceLimits().timestampPeriod);
+}
+
+bool GPUTiming::BeginFrameQueries(u32 frame)
+{
+  // Queries can't be reset inside a render pass.
+  StateTracker::GetInstance()->EndRenderPass();
+  vkCmdResetQueryPool(g_command_buffer_mgr->GetCurrentCommandBuffer(), m_query_pool,
+                      frame * MAX_TIMESTAMPS_PER_FRAME, MAX_TIMESTAMPS_PER_FRAME);
+  return true;
+}
+
+void GPUTiming::WriteTimestamp(u32 frame, u32 index)
+{
+  vkCmdWriteTimestamp(g_command_buffer_mgr->GetCurrentCommandBuffer(),
+                      VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, m_query_pool,
+                      frame * MAX_TIMESTAMPS_PER_FRAME + index);
+}
+
+void GPUTiming::EndFrameQueries(u32 frame, u32 count)
+{
+  m_fence_counters[frame] = g_command_buffer_mgr->GetCurrentFenceCounter();
+}
+
+bool GPUTiming::ReadTimestamps(u32 frame, u32 count, u64* timestamps_ns, bool* valid)
+{
+  if (m_fence_counters[frame] > g_command_buffer_mgr->GetCompletedFenceCounter())
+    return false;
+
+  VkResult res = vkGetQueryPoolResults(g_vulkan_context->GetDevice(), m_query_pool,
+                                       frame * MAX_TIMESTAMPS_PER_FRAME, count,
+                                       count * sizeof(u64), timestamps_ns, sizeof(u64),
+                                       VK_QUERY_RESULT_64_BIT);
+  if (res == VK_NOT_READY)
+    return false;
+
+  if (res != VK_SUCCESS)
+  {
+    LOG_VULKAN_ERROR(res, "vkGetQueryPoolResults failed: ");
+    *valid = false;
+    return true;
+  }
+
+  for (u32 i = 0; i < count; i++)
+  {
+    timestamps_ns[i] =
+        static_cast<u64>(static_cast<double>(timestamps_ns[i] & m_timestamp_mask) *
+                         m_timestamp_period);
+  }
+
+  return true;
+}
+}  // namespace Vulkan
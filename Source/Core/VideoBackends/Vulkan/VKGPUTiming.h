@@ -0,0 +1,38 @@
+// Copyright 2021 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <memory>
+
+#include "Common/CommonTypes.h"
+#include "VideoBackends/Vulkan/VulkanLoader.h"
+#include "VideoCommon/GPUTimingBase.h"
+
+namespace Vulkan
+{
+class GPUTiming final : public GPUTimingBase
+{
+public:
+  GPUTiming(VkQueryPool query_pool, u32 timestamp_valid_bits, float timestamp_period);
+  ~GPUTiming() override;
+
+  // Returns null if the graphics queue doesn't support timestamps.
+  static std::unique_ptr<GPUTiming> Create();
+
+protected:
+  bool BeginFrameQueries(u32 frame) override;
+  void WriteTimestamp(u32 frame, u32 index) override;
+  void EndFrameQueries(u32 frame, u32 count) override;
+  bool ReadTimestamps(u32 frame, u32 count, u64* timestamps_ns, bool* valid) override;
+
+private:
+  VkQueryPool m_query_pool;
+  u64 m_timestamp_mask;
+  float m_timestamp_period;
+
+  // Fence counter of the command buffer containing the last timestamp of each frame.
+  std::array<u64, NUM_FRAMES> m_fence_counters = {};
+};
+}  // namespace Vulkan
@@ -9,6 +9,7 @@
 #include "VideoBackends/Vulkan/CommandBufferManager.h"
 #include "VideoBackends/Vulkan/Constants.h"
 #include "VideoBackends/Vulkan/ObjectCache.h"
+#include "VideoBackends/Vulkan/VKGPUTiming.h"
 #include "VideoBackends/Vulkan/StateTracker.h"
 #include "VideoBackends/Vulkan/VKPerfQuery.h"
 #include "VideoBackends/Vulkan/VKRenderer.h"
@@ -171,7 +172,8 @@ bool VideoBackend::Initialize(const WindowSystemInfo& wsi)
 
   // Now we can create the Vulkan device. VulkanContext takes ownership of the instance and surface.
   g_vulkan_context = VulkanContext::Create(instance, gpu_list[selected_adapter_index], surface,
-                                           enable_debug_reports, enable_validation_layer);
+                                           enable_debug_reports, enable_validation_layer,
+                                           g_Config.bBackendTransferQueue);
   if (!g_vulkan_context)
   {
     PanicAlertFmt("Failed to create Vulkan device");
@@ -193,7 +195,8 @@ bool VideoBackend::Initialize(const WindowSystemInfo& wsi)
   InitializeShared();
 
   // Create command buffers. We do this separately because the other classes depend on it.
-  g_command_buffer_mgr = std::make_unique<CommandBufferManager>(g_Config.bBackendMultithreading);
+  g_command_buffer_mgr = std::make_unique<CommandBufferManager>(
+      g_Config.bBackendMultithreading, g_Config.bBackendThreadedRecording);
   if (!g_command_buffer_mgr->Initialize())
   {
     PanicAlertFmt("Failed to create Vulkan command buffers");
@@ -237,6 +240,7 @@ bool VideoBackend::Initialize(const WindowSystemInfo& wsi)
   g_framebuffer_manager = std::make_unique<FramebufferManager>();
   g_texture_cache = std::make_unique<TextureCacheBase>();
   g_perf_query = std::make_unique<PerfQuery>();
+  g_gpu_timing = GPUTiming::Create();
 
   if (!g_vertex_manager->Initialize() || !g_shader_cache->Initialize() ||
       !g_renderer->Initialize() || !g_framebuffer_manager->Initialize() ||
@@ -265,6 +269,7 @@ void VideoBackend::Shutdown()
   if (g_renderer)
     g_renderer->Shutdown();
 
+  g_gpu_timing.reset();
   g_perf_query.reset();
   g_texture_cache.reset();
   g_framebuffer_manager.reset();
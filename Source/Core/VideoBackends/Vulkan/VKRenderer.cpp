@@ -146,6 +146,17 @@ void Renderer::BBoxFlushImpl()
   m_bounding_box->Invalidate();
 }
 
+void Renderer::BBoxPrefetchImpl()
+{
+  BBoxFlushImpl();
+  m_bounding_box->Prefetch();
+}
+
+u16 Renderer::BBoxReadPrefetchedImpl(int index)
+{
+  return static_cast<u16>(m_bounding_box->GetPrefetched(index));
+}
+
 void Renderer::ClearScreen(const MathUtil::Rectangle<int>& rc, bool color_enable, bool alpha_enable,
                            bool z_enable, u32 color, u32 z)
 {
@@ -186,11 +197,11 @@ void Renderer::ClearScreen(const MathUtil::Rectangle<int>& rc, bool color_enable
   if (!g_ActiveConfig.backend_info.bSupportsReversedDepthRange)
     clear_depth_value.depthStencil.depth = 1.0f - clear_depth_value.depthStencil.depth;
 
-  // If we're not in a render pass (start of the frame), we can use a clear render pass
-  // to discard the data, rather than loading and then clearing.
+  // If we're not in a render pass (start of the frame), or nothing has been drawn in it yet, we
+  // can use a clear render pass to discard the data, rather than loading and then clearing.
   bool use_clear_attachments = (color_enable && alpha_enable) || z_enable;
-  bool use_clear_render_pass =
-      !StateTracker::GetInstance()->InRenderPass() && color_enable && alpha_enable && z_enable;
+  bool use_clear_render_pass = StateTracker::GetInstance()->CanReplaceRenderPass() &&
+                               color_enable && alpha_enable && z_enable;
 
   // The NVIDIA Vulkan driver causes the GPU to lock up, or throw exceptions if MSAA is enabled,
   // a non-full clear rect is specified, and a clear loadop or vkCmdClearAttachments is used.
@@ -357,6 +368,8 @@ void Renderer::PresentBackbuffer()
   // Because this final command buffer is rendering to the swap chain, we need to wait for
   // the available semaphore to be signaled before executing the buffer. This final submission
   // can happen off-thread in the background while we're preparing the next frame.
+  if (g_ActiveConfig.iMaxFramesInFlight > 0)
+    m_presented_fence_counters.push_back(g_command_buffer_mgr->GetCurrentFenceCounter());
   g_command_buffer_mgr->SubmitCommandBuffer(true, false, m_swap_chain->GetSwapChain(),
                                             m_swap_chain->GetCurrentImageIndex());
 
@@ -364,6 +377,17 @@ void Renderer::PresentBackbuffer()
   StateTracker::GetInstance()->InvalidateCachedState();
 }
 
+void Renderer::WaitForFramesInFlight(u32 max_frames)
+{
+  while (!m_presented_fence_counters.empty() &&
+         (m_presented_fence_counters.size() > max_frames ||
+          m_presented_fence_counters.front() <= g_command_buffer_mgr->GetCompletedFenceCounter()))
+  {
+    g_command_buffer_mgr->WaitForFenceCounter(m_presented_fence_counters.front());
+    m_presented_fence_counters.pop_front();
+  }
+}
+
 void Renderer::SetFullscreen(bool enable_fullscreen)
 {
   if (!m_swap_chain->IsFullscreenSupported())
@@ -510,24 +534,42 @@ void Renderer::SetAndClearFramebuffer(AbstractFramebuffer* framebuffer,
                                       const ClearColor& color_value, float depth_value)
 {
   VKFramebuffer* vkfb = static_cast<VKFramebuffer*>(framebuffer);
-  BindFramebuffer(vkfb);
+  StateTracker* const state_tracker = StateTracker::GetInstance();
+  const VkRect2D rect = vkfb->GetRect();
 
   std::array<VkClearValue, 2> clear_values;
+  std::array<VkClearAttachment, 2> clear_attachments;
   u32 num_clear_values = 0;
   if (vkfb->GetColorFormat() != AbstractTextureFormat::Undefined)
   {
     std::memcpy(clear_values[num_clear_values].color.float32, color_value.data(),
                 sizeof(clear_values[num_clear_values].color.float32));
+    clear_attachments[num_clear_values] = {VK_IMAGE_ASPECT_COLOR_BIT, 0,
+                                           clear_values[num_clear_values]};
     num_clear_values++;
   }
   if (vkfb->GetDepthFormat() != AbstractTextureFormat::Undefined)
   {
     clear_values[num_clear_values].depthStencil.depth = depth_value;
     clear_values[num_clear_values].depthStencil.stencil = 0;
+    clear_attachments[num_clear_values] = {VK_IMAGE_ASPECT_DEPTH_BIT, 0,
+                                           clear_values[num_clear_values]};
     num_clear_values++;
   }
-  StateTracker::GetInstance()->BeginClearRenderPass(vkfb->GetRect(), clear_values.data(),
-                                                    num_clear_values);
+
+  // If we're already drawing to the whole framebuffer, clear it within the current render pass,
+  // rather than storing the pass just to clear it in the next one.
+  if (m_current_framebuffer == vkfb && state_tracker->HasRenderPassStarted() &&
+      state_tracker->IsWithinRenderArea(0, 0, rect.extent.width, rect.extent.height))
+  {
+    const VkClearRect clear_rect = {rect, 0, vkfb->GetLayers()};
+    vkCmdClearAttachments(g_command_buffer_mgr->GetCurrentCommandBuffer(), num_clear_values,
+                          clear_attachments.data(), 1, &clear_rect);
+    return;
+  }
+
+  BindFramebuffer(vkfb);
+  state_tracker->BeginClearRenderPass(rect, clear_values.data(), num_clear_values);
 }
 
 void Renderer::SetTexture(u32 index, const AbstractTexture* texture)
@@ -643,7 +685,7 @@ void Renderer::Draw(u32 base_vertex, u32 num_vertices)
   if (!StateTracker::GetInstance()->Bind())
     return;
 
-  vkCmdDraw(g_command_buffer_mgr->GetCurrentCommandBuffer(), num_vertices, 1, base_vertex, 0);
+  g_command_buffer_mgr->GetCommandRecorder()->Draw(base_vertex, num_vertices);
 }
 
 void Renderer::DrawIndexed(u32 base_index, u32 num_indices, u32 base_vertex)
@@ -651,8 +693,7 @@ void Renderer::DrawIndexed(u32 base_index, u32 num_indices, u32 base_vertex)
   if (!StateTracker::GetInstance()->Bind())
     return;
 
-  vkCmdDrawIndexed(g_command_buffer_mgr->GetCurrentCommandBuffer(), num_indices, 1, base_index,
-                   base_vertex, 0);
+  g_command_buffer_mgr->GetCommandRecorder()->DrawIndexed(base_index, num_indices, base_vertex);
 }
 
 void Renderer::DispatchComputeShader(const AbstractShader* shader, u32 groups_x, u32 groups_y,
@@ -5,6 +5,7 @@
 
 #include <array>
 #include <cstddef>
+#include <deque>
 #include <memory>
 
 #include "Common/CommonTypes.h"
@@ -56,6 +57,8 @@ public:
   u16 BBoxReadImpl(int index) override;
   void BBoxWriteImpl(int index, u16 value) override;
   void BBoxFlushImpl() override;
+  void BBoxPrefetchImpl() override;
+  u16 BBoxReadPrefetchedImpl(int index) override;
 
   void Flush() override;
   void WaitForGPUIdle() override;
@@ -82,6 +85,7 @@ public:
                              u32 groups_z) override;
   void BindBackbuffer(const ClearColor& clear_color = {}) override;
   void PresentBackbuffer() override;
+  void WaitForFramesInFlight(u32 max_frames) override;
   void SetFullscreen(bool enable_fullscreen) override;
   bool IsFullscreen() const override;
 
@@ -103,5 +107,8 @@ private:
 
   // Keep a copy of sampler states to avoid cache lookups every draw
   std::array<SamplerState, NUM_PIXEL_SHADER_SAMPLERS> m_sampler_states = {};
+
+  // Fence counters of the command buffers which presented the frames still in flight.
+  std::deque<u64> m_presented_fence_counters;
 };
 }  // namespace Vulkan
@@ -9,6 +9,7 @@
 
 #include "Common/Align.h"
 #include "Common/Assert.h"
+#include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 
 #include "VideoBackends/Vulkan/CommandBufferManager.h"
@@ -141,6 +142,52 @@ bool StreamBuffer::ReserveMemory(u32 num_bytes, u32 alignment)
     return false;
   }
 
+  if (ReserveFreeMemory(num_bytes, alignment))
+    return true;
+
+  // Can we find a fence to wait on that will give us enough memory?
+  if (WaitForClearSpace(required_bytes))
+  {
+    m_current_offset = Common::AlignUp(m_current_offset, alignment);
+    m_last_allocation_size = num_bytes;
+    return true;
+  }
+
+  // We tried everything we could, and still couldn't get anything. This means that too much space
+  // in the buffer is being used by the command buffer currently being recorded. Therefore, the
+  // only option is to execute it, and wait until it's done.
+  return false;
+}
+
+bool StreamBuffer::ReserveMemoryOrGrow(u32 num_bytes, u32 alignment, u32 max_size)
+{
+  const u32 required_bytes = num_bytes + alignment;
+  if (required_bytes <= m_size && ReserveFreeMemory(num_bytes, alignment))
+    return true;
+
+  const u32 new_size = std::min(max_size, std::max(m_size * 2, required_bytes));
+  if (new_size > m_size && new_size >= required_bytes)
+  {
+    const u32 old_size = m_size;
+    m_size = new_size;
+    if (AllocateBuffer())
+    {
+      // The new buffer is empty, so this goes at the start.
+      m_last_allocation_size = num_bytes;
+      return true;
+    }
+
+    WARN_LOG_FMT(VIDEO, "Failed to grow stream buffer to {} bytes", new_size);
+    m_size = old_size;
+  }
+
+  return ReserveMemory(num_bytes, alignment);
+}
+
+bool StreamBuffer::ReserveFreeMemory(u32 num_bytes, u32 alignment)
+{
+  const u32 required_bytes = num_bytes + alignment;
+
   // Is the GPU behind or up to date with our current offset?
   UpdateCurrentFencePosition();
   if (m_current_offset >= m_current_gpu_position)
@@ -181,17 +228,6 @@ bool StreamBuffer::ReserveMemory(u32 num_bytes, u32 alignment)
     }
   }
 
-  // Can we find a fence to wait on that will give us enough memory?
-  if (WaitForClearSpace(required_bytes))
-  {
-    m_current_offset = Common::AlignUp(m_current_offset, alignment);
-    m_last_allocation_size = num_bytes;
-    return true;
-  }
-
-  // We tried everything we could, and still couldn't get anything. This means that too much space
-  // in the buffer is being used by the command buffer currently being recorded. Therefore, the
-  // only option is to execute it, and wait until it's done.
   return false;
 }
 
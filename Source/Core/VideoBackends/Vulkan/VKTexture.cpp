@@ -347,8 +347,6 @@ void VKTexture::Load(u32 level, u32 width, u32 height, u32 row_length, const u8*
   // When the last mip level is uploaded, we transition to SHADER_READ_ONLY, ready for use. This is
   // because we can't transition in a render pass, and we don't necessarily know when this texture
   // is going to be used.
-  TransitionToLayout(g_command_buffer_mgr->GetCurrentInitCommandBuffer(),
-                     VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
 
   // For unaligned textures, we can save some memory in the transfer buffer by skipping the rows
   // that lie outside of the texture's dimensions.
@@ -361,13 +359,29 @@ void VKTexture::Load(u32 level, u32 width, u32 height, u32 row_length, const u8*
   VkBuffer upload_buffer;
   VkDeviceSize upload_buffer_offset;
 
-  // Does this texture data fit within the streaming buffer?
+  // Large uploads into textures which don't have any contents yet can be done on the transfer
+  // queue, so they overlap with the rendering of the previous command buffers. The remaining mip
+  // levels of such a texture have to be uploaded on the transfer queue as well, as it owns it.
+  const bool use_transfer_queue =
+      m_transfer_queue_owned ||
+      (g_vulkan_context->HasTransferQueue() && m_layout == VK_IMAGE_LAYOUT_UNDEFINED &&
+       upload_size > TRANSFER_QUEUE_UPLOAD_THRESHOLD);
+
+  // Does this texture data fit within the streaming buffer? The buffer grows rather than making us
+  // wait when its free space is still being read by the GPU.
+  StreamBuffer* stream_buffer = nullptr;
   if (upload_size <= STAGING_TEXTURE_UPLOAD_THRESHOLD)
   {
-    StreamBuffer* stream_buffer = g_object_cache->GetTextureUploadBuffer();
-    if (!stream_buffer->ReserveMemory(upload_size, upload_alignment))
+    stream_buffer = use_transfer_queue ? g_object_cache->GetTransferUploadBuffer() :
+                                         g_object_cache->GetTextureUploadBuffer();
+  }
+  if (stream_buffer)
+  {
+    if (!stream_buffer->ReserveMemoryOrGrow(upload_size, upload_alignment,
+                                            TEXTURE_UPLOAD_BUFFER_MAX_SIZE))
     {
-      // Execute the command buffer first.
+      // Execute the command buffer first. This is done before recording anything for this upload,
+      // as it moves on to the next command buffer.
       WARN_LOG_FMT(VIDEO,
                    "Executing command list while waiting for space in texture upload buffer");
       Renderer::GetInstance()->ExecuteCommandBuffer(false);
@@ -399,6 +413,14 @@ void VKTexture::Load(u32 level, u32 width, u32 height, u32 row_length, const u8*
     temp_buffer->Unmap();
   }
 
+  const VkCommandBuffer command_buffer =
+      use_transfer_queue ? g_command_buffer_mgr->GetCurrentTransferCommandBuffer() :
+                           g_command_buffer_mgr->GetCurrentInitCommandBuffer();
+  if (use_transfer_queue)
+    BeginTransferQueueUpload(command_buffer);
+  else
+    TransitionToLayout(command_buffer, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+
   // Copy from the streaming buffer to the actual image.
   VkBufferImageCopy image_copy = {
       upload_buffer_offset,                      // VkDeviceSize                bufferOffset
@@ -408,8 +430,8 @@ void VKTexture::Load(u32 level, u32 width, u32 height, u32 row_length, const u8*
       {0, 0, 0},                                 // VkOffset3D                  imageOffset
       {width, height, 1}                         // VkExtent3D                  imageExtent
   };
-  vkCmdCopyBufferToImage(g_command_buffer_mgr->GetCurrentInitCommandBuffer(), upload_buffer,
-                         m_image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &image_copy);
+  vkCmdCopyBufferToImage(command_buffer, upload_buffer, m_image,
+                         VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &image_copy);
 
   // Preemptively transition to shader read only after uploading the last mip level, as we're
   // likely finished with writes to this texture for now. We can't do this in common with a
@@ -417,11 +439,72 @@ void VKTexture::Load(u32 level, u32 width, u32 height, u32 row_length, const u8*
   // don't want to interrupt the render pass with calls which were executed ages before.
   if (level == (m_config.levels - 1))
   {
-    TransitionToLayout(g_command_buffer_mgr->GetCurrentInitCommandBuffer(),
-                       VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    if (use_transfer_queue)
+      EndTransferQueueUpload(command_buffer);
+    else
+      TransitionToLayout(command_buffer, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
   }
 }
 
+void VKTexture::BeginTransferQueueUpload(VkCommandBuffer transfer_command_buffer)
+{
+  if (m_transfer_queue_owned)
+    return;
+
+  // The image has no contents yet, so no ownership transfer is needed to start using it.
+  VkImageMemoryBarrier barrier = {
+      VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,  // VkStructureType            sType
+      nullptr,                                 // const void*                pNext
+      0,                                       // VkAccessFlags              srcAccessMask
+      VK_ACCESS_TRANSFER_WRITE_BIT,            // VkAccessFlags              dstAccessMask
+      VK_IMAGE_LAYOUT_UNDEFINED,               // VkImageLayout              oldLayout
+      VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,    // VkImageLayout              newLayout
+      VK_QUEUE_FAMILY_IGNORED,                 // uint32_t                   srcQueueFamilyIndex
+      VK_QUEUE_FAMILY_IGNORED,                 // uint32_t                   dstQueueFamilyIndex
+      m_image,                                 // VkImage                    image
+      {GetImageAspectForFormat(GetFormat()), 0, GetLevels(), 0,
+       GetLayers()}  // VkImageSubresourceRange    subresourceRange
+  };
+  vkCmdPipelineBarrier(transfer_command_buffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                       VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+
+  m_layout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+  m_transfer_queue_owned = true;
+}
+
+void VKTexture::EndTransferQueueUpload(VkCommandBuffer transfer_command_buffer)
+{
+  // Release the image on the transfer queue, and acquire it on the graphics queue. The graphics
+  // queue submission waits for the transfer queue, so the acquire can go in the init buffer.
+  const u32 transfer_family = g_vulkan_context->GetTransferQueueFamilyIndex();
+  const u32 graphics_family = g_vulkan_context->GetGraphicsQueueFamilyIndex();
+  VkImageMemoryBarrier barrier = {
+      VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,    // VkStructureType            sType
+      nullptr,                                   // const void*                pNext
+      VK_ACCESS_TRANSFER_WRITE_BIT,              // VkAccessFlags              srcAccessMask
+      0,                                         // VkAccessFlags              dstAccessMask
+      VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,      // VkImageLayout              oldLayout
+      VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,  // VkImageLayout              newLayout
+      transfer_family,                           // uint32_t                   srcQueueFamilyIndex
+      graphics_family,                           // uint32_t                   dstQueueFamilyIndex
+      m_image,                                   // VkImage                    image
+      {GetImageAspectForFormat(GetFormat()), 0, GetLevels(), 0,
+       GetLayers()}  // VkImageSubresourceRange    subresourceRange
+  };
+  vkCmdPipelineBarrier(transfer_command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                       VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0, 0, nullptr, 0, nullptr, 1,
+                       &barrier);
+
+  barrier.srcAccessMask = 0;
+  barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+  vkCmdPipelineBarrier(g_command_buffer_mgr->GetCurrentInitCommandBuffer(),
+                       VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, 0,
+                       nullptr, 0, nullptr, 1, &barrier);
+
+  m_layout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+  m_transfer_queue_owned = false;
+}
+
 void VKTexture::FinishedRendering()
 {
   if (m_layout == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL)
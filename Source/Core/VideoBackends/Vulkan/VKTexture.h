@@ -72,11 +72,17 @@ public:
 private:
   bool CreateView(VkImageViewType type);
 
+  // Uploads on the transfer queue write to an undefined image, and hand it over to the graphics
+  // queue in SHADER_READ_ONLY layout once the last mip level has been copied.
+  void BeginTransferQueueUpload(VkCommandBuffer transfer_command_buffer);
+  void EndTransferQueueUpload(VkCommandBuffer transfer_command_buffer);
+
   VkDeviceMemory m_device_memory;
   VkImage m_image;
   VkImageView m_view = VK_NULL_HANDLE;
   mutable VkImageLayout m_layout = VK_IMAGE_LAYOUT_UNDEFINED;
   mutable ComputeImageLayout m_compute_layout = ComputeImageLayout::Undefined;
+  bool m_transfer_queue_owned = false;
 };
 
 class VKStagingTexture final : public AbstractStagingTexture
@@ -398,7 +398,8 @@ void VulkanContext::PopulateBackendInfoMultisampleModes(
 std::unique_ptr<VulkanContext> VulkanContext::Create(VkInstance instance, VkPhysicalDevice gpu,
                                                      VkSurfaceKHR surface,
                                                      bool enable_debug_reports,
-                                                     bool enable_validation_layer)
+                                                     bool enable_validation_layer,
+                                                     bool enable_transfer_queue)
 {
   std::unique_ptr<VulkanContext> context = std::make_unique<VulkanContext>(instance, gpu);
 
@@ -411,7 +412,7 @@ std::unique_ptr<VulkanContext> VulkanContext::Create(VkInstance instance, VkPhys
     context->EnableDebugReports();
 
   // Attempt to create the device.
-  if (!context->CreateDevice(surface, enable_validation_layer))
+  if (!context->CreateDevice(surface, enable_validation_layer, enable_transfer_queue))
   {
     // Since we are destroying the instance, we're also responsible for destroying the surface.
     if (surface != VK_NULL_HANDLE)
@@ -514,7 +515,8 @@ bool VulkanContext::SelectDeviceFeatures()
   return true;
 }
 
-bool VulkanContext::CreateDevice(VkSurfaceKHR surface, bool enable_validation_layer)
+bool VulkanContext::CreateDevice(VkSurfaceKHR surface, bool enable_validation_layer,
+                                 bool enable_transfer_queue)
 {
   u32 queue_family_count;
   vkGetPhysicalDeviceQueueFamilyProperties(m_physical_device, &queue_family_count, nullptr);
@@ -579,6 +581,25 @@ bool VulkanContext::CreateDevice(VkSurfaceKHR surface, bool enable_validation_la
     return false;
   }
 
+  // Find a queue family which only does transfers. Texture uploads need a transfer granularity of
+  // single texels, as mip levels can be smaller than any coarser granularity.
+  m_transfer_queue_family_index = queue_family_count;
+  for (uint32_t i = 0; enable_transfer_queue && i < queue_family_count; i++)
+  {
+    const VkQueueFamilyProperties& properties = queue_family_properties[i];
+    const VkExtent3D& granularity = properties.minImageTransferGranularity;
+    if ((properties.queueFlags & VK_QUEUE_TRANSFER_BIT) &&
+        !(properties.queueFlags & (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT)) &&
+        properties.queueCount > 0 && granularity.width == 1 && granularity.height == 1 &&
+        granularity.depth == 1)
+    {
+      m_transfer_queue_family_index = i;
+      break;
+    }
+  }
+  if (enable_transfer_queue && m_transfer_queue_family_index == queue_family_count)
+    WARN_LOG_FMT(VIDEO, "Vulkan: No dedicated transfer queue, uploading on the graphics queue.");
+
   VkDeviceCreateInfo device_info = {};
   device_info.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
   device_info.pNext = nullptr;
@@ -601,7 +622,10 @@ bool VulkanContext::CreateDevice(VkSurfaceKHR surface, bool enable_validation_la
   present_queue_info.queueCount = 1;
   present_queue_info.pQueuePriorities = queue_priorities;
 
-  std::array<VkDeviceQueueCreateInfo, 2> queue_infos = {{
+  VkDeviceQueueCreateInfo transfer_queue_info = graphics_queue_info;
+  transfer_queue_info.queueFamilyIndex = m_transfer_queue_family_index;
+
+  std::array<VkDeviceQueueCreateInfo, 3> queue_infos = {{
       graphics_queue_info,
       present_queue_info,
   }};
@@ -611,6 +635,10 @@ bool VulkanContext::CreateDevice(VkSurfaceKHR surface, bool enable_validation_la
   {
     device_info.queueCreateInfoCount = 2;
   }
+  if (m_transfer_queue_family_index != queue_family_count)
+  {
+    queue_infos[device_info.queueCreateInfoCount++] = transfer_queue_info;
+  }
   device_info.pQueueCreateInfos = queue_infos.data();
 
   if (!SelectDeviceExtensions(surface != VK_NULL_HANDLE))
@@ -657,6 +685,10 @@ bool VulkanContext::CreateDevice(VkSurfaceKHR surface, bool enable_validation_la
   {
     vkGetDeviceQueue(m_device, m_present_queue_family_index, 0, &m_present_queue);
   }
+  if (m_transfer_queue_family_index != queue_family_count)
+  {
+    vkGetDeviceQueue(m_device, m_transfer_queue_family_index, 0, &m_transfer_queue);
+  }
   return true;
 }
 
@@ -47,7 +47,8 @@ public:
   // been called for the specified VideoConfig.
   static std::unique_ptr<VulkanContext> Create(VkInstance instance, VkPhysicalDevice gpu,
                                                VkSurfaceKHR surface, bool enable_debug_reports,
-                                               bool enable_validation_layer);
+                                               bool enable_validation_layer,
+                                               bool enable_transfer_queue);
 
   // Enable/disable debug message runtime.
   bool EnableDebugReports();
@@ -61,6 +62,11 @@ public:
   u32 GetGraphicsQueueFamilyIndex() const { return m_graphics_queue_family_index; }
   VkQueue GetPresentQueue() const { return m_present_queue; }
   u32 GetPresentQueueFamilyIndex() const { return m_present_queue_family_index; }
+  // The transfer queue only exists if requested and the device has a queue family dedicated to
+  // transfers, which usually maps to a DMA engine running in parallel to rendering.
+  bool HasTransferQueue() const { return m_transfer_queue != VK_NULL_HANDLE; }
+  VkQueue GetTransferQueue() const { return m_transfer_queue; }
+  u32 GetTransferQueueFamilyIndex() const { return m_transfer_queue_family_index; }
   const VkQueueFamilyProperties& GetGraphicsQueueProperties() const
   {
     return m_graphics_queue_properties;
@@ -124,7 +130,8 @@ private:
                                        WindowSystemType wstype, bool enable_debug_report);
   bool SelectDeviceExtensions(bool enable_surface);
   bool SelectDeviceFeatures();
-  bool CreateDevice(VkSurfaceKHR surface, bool enable_validation_layer);
+  bool CreateDevice(VkSurfaceKHR surface, bool enable_validation_layer,
+                    bool enable_transfer_queue);
   void InitDriverDetails();
   void PopulateShaderSubgroupSupport();
 
@@ -136,6 +143,8 @@ private:
   u32 m_graphics_queue_family_index = 0;
   VkQueue m_present_queue = VK_NULL_HANDLE;
   u32 m_present_queue_family_index = 0;
+  VkQueue m_transfer_queue = VK_NULL_HANDLE;
+  u32 m_transfer_queue_family_index = 0;
   VkQueueFamilyProperties m_graphics_queue_properties = {};
 
   VkDebugReportCallbackEXT m_debug_report_callback = VK_NULL_HANDLE;
@@ -36,6 +36,27 @@ void AsyncShaderCompiler::QueueWorkItem(WorkItemPtr item, u32 priority)
   }
 }
 
+bool AsyncShaderCompiler::PromoteWorkItem(const WorkItem* item, u32 priority)
+{
+  std::lock_guard<std::mutex> guard(m_pending_work_lock);
+  for (auto it = m_pending_work.begin(); it != m_pending_work.end(); ++it)
+  {
+    if (it->second.get() != item)
+      continue;
+
+    // Items with the same priority keep their order, so this goes after the other items which
+    // already have the new priority.
+    if (it->first > priority)
+    {
+      auto node = m_pending_work.extract(it);
+      node.key() = priority;
+      m_pending_work.insert(std::move(node));
+    }
+    return true;
+  }
+  return false;
+}
+
 void AsyncShaderCompiler::RetrieveWorkItems()
 {
   std::deque<WorkItemPtr> completed_work;
@@ -57,6 +78,12 @@ bool AsyncShaderCompiler::HasPendingWork()
   return !m_pending_work.empty() || m_busy_workers.load() != 0;
 }
 
+size_t AsyncShaderCompiler::GetPendingWorkCount()
+{
+  std::lock_guard<std::mutex> guard(m_pending_work_lock);
+  return m_pending_work.size() + m_busy_workers.load();
+}
+
 bool AsyncShaderCompiler::HasCompletedWork()
 {
   std::lock_guard<std::mutex> guard(m_completed_work_lock);
@@ -193,6 +220,7 @@ void AsyncShaderCompiler::WorkerThreadExit(void* param)
 void AsyncShaderCompiler::WorkerThreadEntryPoint(void* param)
 {
   Common::SetCurrentThreadName("AsyncShaderCompiler Worker");
+  Common::SetCurrentThreadRole(Common::ThreadRole::Background);
 
   // Initialize worker thread with backend-specific method.
   if (!WorkerThreadInitWorkerThread(param))
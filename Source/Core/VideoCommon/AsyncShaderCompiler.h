@@ -45,9 +45,14 @@ public:
   // Queues a new work item to the compiler threads. The lower the priority, the sooner
   // this work item will be compiled, relative to the other work items.
   void QueueWorkItem(WorkItemPtr item, u32 priority);
+  // Moves a queued work item to a lower priority value, so that it is compiled sooner. Returns
+  // false if the item isn't queued anymore, i.e. it is being compiled or has already finished.
+  bool PromoteWorkItem(const WorkItem* item, u32 priority);
   void RetrieveWorkItems();
   bool HasPendingWork();
   bool HasCompletedWork();
+  // The number of items which are queued or being compiled.
+  size_t GetPendingWorkCount();
 
   // Simpler version without progress updates.
   void WaitUntilCompletion();
@@ -3,8 +3,11 @@
 
 #include "VideoCommon/Fifo.h"
 
+#include <algorithm>
 #include <atomic>
 #include <cstring>
+#include <optional>
+#include <thread>
 
 #include "Common/Assert.h"
 #include "Common/BlockingLoop.h"
@@ -13,6 +16,7 @@
 #include "Common/FPURoundMode.h"
 #include "Common/MemoryUtil.h"
 #include "Common/MsgHandler.h"
+#include "Common/Profiler.h"
 
 #include "Core/ConfigManager.h"
 #include "Core/CoreTiming.h"
@@ -32,6 +36,9 @@ namespace Fifo
 {
 static constexpr u32 FIFO_SIZE = 2 * 1024 * 1024;
 static constexpr int GPU_TIME_SLOT_SIZE = 1000;
+// Maximum amount of FIFO data the GPU thread copies out of emulated RAM before updating the CP
+// registers, so that a burst isn't handed over 32 bytes at a time.
+static constexpr u32 GPU_THREAD_MAX_BURST_SIZE = 1024;
 
 static Common::BlockingLoop s_gpu_mainloop;
 
@@ -66,6 +73,11 @@ static u8* s_video_buffer_pp_read_ptr;
 // polls, it's just atomic.
 // - The pp_read_ptr is the CPU preprocessing version of the read_ptr.
 
+// The swap of the last field in deterministic GPU thread mode, and the end of the commands that
+// the GPU thread has to run before it can be presented. These are only used by the CPU thread.
+static std::optional<AsyncRequests::Event> s_pending_swap;
+static u8* s_pending_swap_end;
+
 static std::atomic<int> s_sync_ticks;
 static bool s_syncing_suspended;
 static Common::Event s_sync_wakeup_event;
@@ -82,6 +94,8 @@ void DoState(PointerWrap& p)
     // We're good and paused, right?
     s_video_buffer_seen_ptr = s_video_buffer_pp_read_ptr = s_video_buffer_read_ptr;
   }
+  if (p.mode == PointerWrap::MODE_READ)
+    s_pending_swap.reset();
 
   p.Do(s_sync_ticks);
   p.Do(s_syncing_suspended);
@@ -163,6 +177,13 @@ void SyncGPU(SyncGPUReason reason, bool may_move_read_ptr)
     if (!s_gpu_mainloop.IsRunning())
       return;
 
+    // Everything has been run now, including the commands before the pending swap.
+    if (s_pending_swap)
+    {
+      AsyncRequests::GetInstance()->PushEvent(*s_pending_swap, false);
+      s_pending_swap.reset();
+    }
+
     // Opportunistically reset FIFOs so we don't wrap around.
     if (may_move_read_ptr && s_fifo_aux_write_ptr != s_fifo_aux_read_ptr)
     {
@@ -193,6 +214,24 @@ void SyncGPU(SyncGPUReason reason, bool may_move_read_ptr)
   }
 }
 
+void PushDeterministicSwap(const AsyncRequests::Event& swap)
+{
+  if (s_pending_swap)
+  {
+    // The GPU thread only publishes its progress after running everything it has been given, so
+    // once seen_ptr is past the end of the last field, all of that field's commands have run.
+    while (s_video_buffer_seen_ptr.load() < s_pending_swap_end && !s_gpu_mainloop.IsDone())
+      std::this_thread::yield();
+    if (!s_gpu_mainloop.IsRunning())
+      return;
+
+    AsyncRequests::GetInstance()->PushEvent(*s_pending_swap, false);
+  }
+
+  s_pending_swap = swap;
+  s_pending_swap_end = s_video_buffer_pp_read_ptr;
+}
+
 void PushFifoAuxBuffer(const void* ptr, size_t size)
 {
   if (size > (size_t)(s_fifo_aux_data + FIFO_SIZE - s_fifo_aux_write_ptr))
@@ -223,9 +262,10 @@ void* PopFifoAuxBuffer(size_t size)
 }
 
 // Description: RunGpuLoop() sends data through this function.
-static void ReadDataFromFifo(u32 readPtr)
+// The data is copied to s_video_buffer_write_ptr, which the caller advances over the data that is
+// ready to be decoded.
+static void ReadDataFromFifo(u32 readPtr, size_t len)
 {
-  constexpr size_t len = 32;
   if (len > static_cast<size_t>(s_video_buffer + FIFO_SIZE - s_video_buffer_write_ptr))
   {
     const size_t existing_len = s_video_buffer_write_ptr - s_video_buffer_read_ptr;
@@ -240,7 +280,6 @@ static void ReadDataFromFifo(u32 readPtr)
   }
   // Copy new video instructions to s_video_buffer for future use in rendering the new picture
   Memory::CopyFromEmu(s_video_buffer_write_ptr, readPtr, len);
-  s_video_buffer_write_ptr += len;
 }
 
 // The deterministic_gpu_thread version.
@@ -287,6 +326,7 @@ void ResetVideoBuffer()
   s_video_buffer_pp_read_ptr = s_video_buffer;
   s_fifo_aux_write_ptr = s_fifo_aux_data;
   s_fifo_aux_read_ptr = s_fifo_aux_data;
+  s_pending_swap.reset();
 }
 
 // Description: Main FIFO update loop
@@ -335,25 +375,45 @@ void RunGpuLoop()
 
             u32 cyclesExecuted = 0;
             u32 readPtr = fifo.CPReadPointer.load(std::memory_order_relaxed);
-            ReadDataFromFifo(readPtr);
+            const u32 distance = fifo.CPReadWriteDistance.load(std::memory_order_relaxed);
 
-            if (readPtr == fifo.CPEnd.load(std::memory_order_relaxed))
-              readPtr = fifo.CPBase.load(std::memory_order_relaxed);
-            else
-              readPtr += 32;
-
-            ASSERT_MSG(COMMANDPROCESSOR,
-                       (s32)fifo.CPReadWriteDistance.load(std::memory_order_relaxed) - 32 >= 0,
+            ASSERT_MSG(COMMANDPROCESSOR, (s32)distance - 32 >= 0,
                        "Negative fifo.CPReadWriteDistance = %i in FIFO Loop !\nThat can produce "
                        "instability in the game. Please report it.",
-                       fifo.CPReadWriteDistance.load(std::memory_order_relaxed) - 32);
+                       distance - 32);
+
+            // Copy the whole burst up to the end of the FIFO or the breakpoint at once.
+            const u32 end = fifo.CPEnd.load(std::memory_order_relaxed);
+            u32 burst_size = std::min({distance, end - readPtr + 32, GPU_THREAD_MAX_BURST_SIZE});
+            if (fifo.bFF_BPEnable.load(std::memory_order_relaxed))
+            {
+              const u32 breakpoint = fifo.CPBreakpoint.load(std::memory_order_relaxed);
+              if (breakpoint > readPtr && breakpoint - readPtr < burst_size)
+                burst_size = breakpoint - readPtr;
+            }
+            ReadDataFromFifo(readPtr, burst_size);
+
+            PROFILE("Fifo: GPU thread decoding");
 
+            // Decode block by block, so a command raising an interrupt stops at the same point.
+            u32 bytes_read = 0;
             u8* write_ptr = s_video_buffer_write_ptr;
-            s_video_buffer_read_ptr = OpcodeDecoder::Run(
-                DataReader(s_video_buffer_read_ptr, write_ptr), &cyclesExecuted, false);
+            do
+            {
+              write_ptr += 32;
+              bytes_read += 32;
+              s_video_buffer_read_ptr = OpcodeDecoder::Run(
+                  DataReader(s_video_buffer_read_ptr, write_ptr), &cyclesExecuted, false);
+            } while (bytes_read < burst_size && !CommandProcessor::IsInterruptWaiting());
+            s_video_buffer_write_ptr = write_ptr;
+
+            if (readPtr + bytes_read > end)
+              readPtr = fifo.CPBase.load(std::memory_order_relaxed);
+            else
+              readPtr += bytes_read;
 
             fifo.CPReadPointer.store(readPtr, std::memory_order_relaxed);
-            fifo.CPReadWriteDistance.fetch_sub(32, std::memory_order_seq_cst);
+            fifo.CPReadWriteDistance.fetch_sub(bytes_read, std::memory_order_seq_cst);
             if ((write_ptr - s_video_buffer_read_ptr) == 0)
             {
               fifo.SafeCPReadPointer.store(fifo.CPReadPointer.load(std::memory_order_relaxed),
@@ -412,6 +472,11 @@ void GpuMaySleep()
   s_gpu_mainloop.AllowSleep();
 }
 
+bool IsGPUThreadBusy()
+{
+  return s_gpu_mainloop.IsRunning() && !s_gpu_mainloop.IsDone();
+}
+
 bool AtBreakpoint()
 {
   CommandProcessor::SCPFifoStruct& fifo = CommandProcessor::fifo;
@@ -464,7 +529,8 @@ static int RunGpuOnCpu(int ticks)
         FPURoundMode::LoadDefaultSIMDState();
         reset_simd_state = true;
       }
-      ReadDataFromFifo(fifo.CPReadPointer.load(std::memory_order_relaxed));
+      ReadDataFromFifo(fifo.CPReadPointer.load(std::memory_order_relaxed), 32);
+      s_video_buffer_write_ptr += 32;
       u32 cycles = 0;
       s_video_buffer_read_ptr = OpcodeDecoder::Run(
           DataReader(s_video_buffer_read_ptr, s_video_buffer_write_ptr), &cycles, false);
@@ -527,6 +593,7 @@ void UpdateWantDeterminism(bool want)
   if (s_use_deterministic_gpu_thread != gpu_thread)
   {
     s_use_deterministic_gpu_thread = gpu_thread;
+    s_pending_swap.reset();
     if (gpu_thread)
     {
       // These haven't been updated in non-deterministic mode.
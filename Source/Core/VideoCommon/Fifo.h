@@ -5,6 +5,7 @@
 
 #include <cstddef>
 #include "Common/CommonTypes.h"
+#include "VideoCommon/AsyncRequests.h"
 
 class PointerWrap;
 
@@ -32,6 +33,12 @@ enum class SyncGPUReason
 // In deterministic GPU thread mode this waits for the GPU to be done with pending work.
 void SyncGPU(SyncGPUReason reason, bool may_move_read_ptr = true);
 
+// In deterministic GPU thread mode, queues a swap to be presented once the GPU thread has run the
+// commands before it, and waits until the swap queued at the previous field can be presented.
+// This lets the GPU thread work on one field while the CPU thread emulates the next, rather than
+// draining the GPU thread every field.
+void PushDeterministicSwap(const AsyncRequests::Event& swap);
+
 // In single core mode, this runs the GPU for a single slice.
 // In dual core mode, this synchronizes with the GPU thread.
 void SyncGPUForRegisterAccess();
@@ -42,6 +49,8 @@ void* PopFifoAuxBuffer(size_t size);
 void FlushGpu();
 void RunGpu();
 void GpuMaySleep();
+// Whether the GPU thread is currently processing commands, as opposed to waiting for some.
+bool IsGPUThreadBusy();
 void RunGpuLoop();
 void ExitGpuLoop();
 void EmulatorState(bool running);
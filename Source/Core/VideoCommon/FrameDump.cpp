@@ -17,6 +17,7 @@ extern "C" {
 #include <libavcodec/avcodec.h>
 #include <libavformat/avformat.h>
 #include <libavutil/mathematics.h>
+#include <libavutil/pixdesc.h>
 #include <libswscale/swscale.h>
 }
 
@@ -77,6 +78,36 @@ void InitAVCodec()
   }
 }
 
+AVPixelFormat GetPixelFormat(const AVCodec* codec)
+{
+  const AVPixelFormat preferred = g_Config.bUseFFV1 ? AV_PIX_FMT_BGR0 : AV_PIX_FMT_YUV420P;
+  if (!codec->pix_fmts)
+    return preferred;
+
+  // Hardware encoders (NVENC, AMF, QSV, VideoToolbox) often only take NV12 or their own hardware
+  // frames from system memory, so fall back to the first software format the encoder lists.
+  AVPixelFormat fallback = AV_PIX_FMT_NONE;
+  for (const AVPixelFormat* format = codec->pix_fmts; *format != AV_PIX_FMT_NONE; ++format)
+  {
+    if (*format == preferred)
+      return preferred;
+
+    const AVPixFmtDescriptor* desc = av_pix_fmt_desc_get(*format);
+    if (fallback == AV_PIX_FMT_NONE && desc && !(desc->flags & AV_PIX_FMT_FLAG_HWACCEL))
+      fallback = *format;
+  }
+
+  if (fallback == AV_PIX_FMT_NONE)
+  {
+    WARN_LOG_FMT(FRAMEDUMP, "Encoder {} only accepts hardware frames", codec->name);
+    return preferred;
+  }
+
+  INFO_LOG_FMT(FRAMEDUMP, "Encoding with pixel format {} for encoder {}",
+               av_get_pix_fmt_name(fallback), codec->name);
+  return fallback;
+}
+
 std::string GetDumpPath(const std::string& extension, std::time_t time, u32 index)
 {
   if (!g_Config.sDumpPath.empty())
@@ -214,7 +245,7 @@ bool FrameDump::CreateVideoFile()
   m_context->codec->time_base = time_base;
   m_context->codec->gop_size = 1;
   m_context->codec->level = 1;
-  m_context->codec->pix_fmt = g_Config.bUseFFV1 ? AV_PIX_FMT_BGR0 : AV_PIX_FMT_YUV420P;
+  m_context->codec->pix_fmt = GetPixelFormat(codec);
 
   if (output_format->flags & AVFMT_GLOBALHEADER)
     m_context->codec->flags |= AV_CODEC_FLAG_GLOBAL_HEADER;
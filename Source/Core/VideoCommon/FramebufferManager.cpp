@@ -235,6 +235,8 @@ void FramebufferManager::BindEFBFramebuffer()
 
 AbstractTexture* FramebufferManager::ResolveEFBColorTexture(const MathUtil::Rectangle<int>& region)
 {
+  ApplyPendingReinterpret();
+
   // Return the normal EFB texture if multisampling is off.
   if (!IsEFBMultisampled())
     return m_efb_color_texture.get();
@@ -282,7 +284,72 @@ AbstractTexture* FramebufferManager::ResolveEFBDepthTexture(const MathUtil::Rect
   return m_efb_depth_resolve_texture.get();
 }
 
+namespace
+{
+enum EFBColorFormat : u32
+{
+  EFB_COLOR_RGB8,
+  EFB_COLOR_RGBA6,
+  EFB_COLOR_RGB565,
+};
+
+struct ReinterpretFormats
+{
+  u32 from;
+  u32 to;
+};
+
+// Indexed by EFBReinterpretType.
+constexpr std::array<ReinterpretFormats, NUM_EFB_REINTERPRET_TYPES> s_reinterpret_formats = {{
+    {EFB_COLOR_RGB8, EFB_COLOR_RGB565},
+    {EFB_COLOR_RGB8, EFB_COLOR_RGBA6},
+    {EFB_COLOR_RGBA6, EFB_COLOR_RGB8},
+    {EFB_COLOR_RGBA6, EFB_COLOR_RGB565},
+    {EFB_COLOR_RGB565, EFB_COLOR_RGB8},
+    {EFB_COLOR_RGB565, EFB_COLOR_RGBA6},
+}};
+}  // Anonymous namespace
+
 bool FramebufferManager::ReinterpretPixelData(EFBReinterpretType convtype)
+{
+  if (!g_ActiveConfig.bDeferEFBFormatChanges)
+  {
+    ApplyPendingReinterpret();
+    return ConvertPixelData(convtype);
+  }
+
+  const ReinterpretFormats& formats = s_reinterpret_formats[static_cast<u32>(convtype)];
+  if (!m_reinterpret_pending)
+  {
+    m_reinterpret_pending = true;
+    m_efb_stored_format = formats.from;
+  }
+  m_efb_logical_format = formats.to;
+
+  // Peeks must not return values read before the format change.
+  InvalidatePeekCache(true);
+  return true;
+}
+
+void FramebufferManager::ApplyPendingReinterpret()
+{
+  if (!m_reinterpret_pending)
+    return;
+
+  m_reinterpret_pending = false;
+  for (u32 i = 0; i < NUM_EFB_REINTERPRET_TYPES; i++)
+  {
+    // If the format was changed back, the data is already in the right format.
+    if (s_reinterpret_formats[i].from == m_efb_stored_format &&
+        s_reinterpret_formats[i].to == m_efb_logical_format)
+    {
+      ConvertPixelData(static_cast<EFBReinterpretType>(i));
+      break;
+    }
+  }
+}
+
+bool FramebufferManager::ConvertPixelData(EFBReinterpretType convtype)
 {
   if (!m_format_conversion_pipelines[static_cast<u32>(convtype)])
     return false;
@@ -384,6 +451,7 @@ u32 FramebufferManager::PeekEFBColor(u32 x, u32 y)
   u32 tile_index;
   if (!IsEFBCacheTilePresent(false, x, y, &tile_index))
     PopulateEFBCache(false, tile_index);
+  MarkEFBCacheTilePeeked(m_efb_color_cache, tile_index);
 
   u32 value;
   m_efb_color_cache.readback_texture->ReadTexel(x, y, &value);
@@ -399,12 +467,22 @@ float FramebufferManager::PeekEFBDepth(u32 x, u32 y)
   u32 tile_index;
   if (!IsEFBCacheTilePresent(true, x, y, &tile_index))
     PopulateEFBCache(true, tile_index);
+  MarkEFBCacheTilePeeked(m_efb_depth_cache, tile_index);
 
   float value;
   m_efb_depth_cache.readback_texture->ReadTexel(x, y, &value);
   return value;
 }
 
+void FramebufferManager::MarkEFBCacheTilePeeked(EFBCacheData& data, u32 tile_index)
+{
+  if (!IsUsingTiledEFBCache() || data.peeked_tiles[tile_index])
+    return;
+
+  data.peeked_tiles[tile_index] = true;
+  data.num_peeked_tiles++;
+}
+
 void FramebufferManager::SetEFBCacheTileSize(u32 size)
 {
   if (m_efb_cache_tile_size == size)
@@ -420,21 +498,28 @@ void FramebufferManager::SetEFBCacheTileSize(u32 size)
 void FramebufferManager::InvalidatePeekCache(bool forced)
 {
   if (forced || m_efb_color_cache.out_of_date)
-  {
-    if (m_efb_color_cache.valid)
-      std::fill(m_efb_color_cache.tiles.begin(), m_efb_color_cache.tiles.end(), false);
-
-    m_efb_color_cache.valid = false;
-    m_efb_color_cache.out_of_date = false;
-  }
+    InvalidateEFBCacheData(m_efb_color_cache);
   if (forced || m_efb_depth_cache.out_of_date)
-  {
-    if (m_efb_depth_cache.valid)
-      std::fill(m_efb_depth_cache.tiles.begin(), m_efb_depth_cache.tiles.end(), false);
+    InvalidateEFBCacheData(m_efb_depth_cache);
+}
+
+void FramebufferManager::InvalidateEFBCacheData(EFBCacheData& data)
+{
+  if (data.valid)
+    std::fill(data.tiles.begin(), data.tiles.end(), false);
 
-    m_efb_depth_cache.valid = false;
-    m_efb_depth_cache.out_of_date = false;
+  // Games tend to peek the same tiles between the same draws, so the tiles peeked until now
+  // predict the ones that will be peeked after this invalidation. If nothing was peeked, keep the
+  // previous prediction.
+  if (data.num_peeked_tiles > 0)
+  {
+    data.predicted_tiles.swap(data.peeked_tiles);
+    std::fill(data.peeked_tiles.begin(), data.peeked_tiles.end(), false);
+    data.num_peeked_tiles = 0;
   }
+
+  data.valid = false;
+  data.out_of_date = false;
 }
 
 void FramebufferManager::FlagPeekCacheAsOutOfDate()
@@ -561,10 +646,13 @@ bool FramebufferManager::CreateReadbackFramebuffer()
     const u32 tiles_wide = ((EFB_WIDTH + (m_efb_cache_tile_size - 1)) / m_efb_cache_tile_size);
     const u32 tiles_high = ((EFB_HEIGHT + (m_efb_cache_tile_size - 1)) / m_efb_cache_tile_size);
     const u32 total_tiles = tiles_wide * tiles_high;
-    m_efb_color_cache.tiles.resize(total_tiles);
-    std::fill(m_efb_color_cache.tiles.begin(), m_efb_color_cache.tiles.end(), false);
-    m_efb_depth_cache.tiles.resize(total_tiles);
-    std::fill(m_efb_depth_cache.tiles.begin(), m_efb_depth_cache.tiles.end(), false);
+    for (EFBCacheData* data : {&m_efb_color_cache, &m_efb_depth_cache})
+    {
+      data->tiles.assign(total_tiles, false);
+      data->peeked_tiles.assign(total_tiles, false);
+      data->predicted_tiles.assign(total_tiles, false);
+      data->num_peeked_tiles = 0;
+    }
     m_efb_cache_tiles_wide = tiles_wide;
   }
 
@@ -587,6 +675,34 @@ void FramebufferManager::PopulateEFBCache(bool depth, u32 tile_index)
 {
   g_vertex_manager->OnCPUEFBAccess();
 
+  EFBCacheData& data = depth ? m_efb_depth_cache : m_efb_color_cache;
+  CopyEFBCacheTile(depth, tile_index);
+  if (IsUsingTiledEFBCache())
+  {
+    // Copy the predicted tiles as well, so that we only wait for the GPU once for all of them.
+    if (g_ActiveConfig.bEFBAccessPrefetch && !data.valid)
+    {
+      for (u32 i = 0; i < static_cast<u32>(data.predicted_tiles.size()); i++)
+      {
+        if (i != tile_index && data.predicted_tiles[i])
+        {
+          CopyEFBCacheTile(depth, i);
+          data.tiles[i] = true;
+        }
+      }
+    }
+
+    data.tiles[tile_index] = true;
+  }
+
+  // Wait until the copy is complete.
+  data.readback_texture->Flush();
+  data.valid = true;
+  data.out_of_date = false;
+}
+
+void FramebufferManager::CopyEFBCacheTile(bool depth, u32 tile_index)
+{
   // Force the path through the intermediate texture, as we can't do an image copy from a depth
   // buffer directly to a staging texture (must be the whole resource).
   const bool force_intermediate_copy =
@@ -640,18 +756,18 @@ void FramebufferManager::PopulateEFBCache(bool depth, u32 tile_index)
   {
     data.readback_texture->CopyFromTexture(src_texture, rect, 0, 0, rect);
   }
-
-  // Wait until the copy is complete.
-  data.readback_texture->Flush();
-  data.valid = true;
-  data.out_of_date = false;
-  if (IsUsingTiledEFBCache())
-    data.tiles[tile_index] = true;
 }
 
 void FramebufferManager::ClearEFB(const MathUtil::Rectangle<int>& rc, bool clear_color,
                                   bool clear_alpha, bool clear_z, u32 color, u32 z)
 {
+  // A clear of the whole color buffer overwrites anything a pending format change would convert.
+  if (clear_color && clear_alpha && rc.left <= 0 && rc.top <= 0 &&
+      rc.right >= static_cast<int>(EFB_WIDTH) && rc.bottom >= static_cast<int>(EFB_HEIGHT))
+  {
+    m_reinterpret_pending = false;
+  }
+
   FlushEFBPokes();
   FlagPeekCacheAsOutOfDate();
   g_renderer->BeginUtilityDrawing();
@@ -801,6 +917,9 @@ void FramebufferManager::CreatePokeVertices(std::vector<EFBPokeVertex>* destinat
 
 void FramebufferManager::FlushEFBPokes()
 {
+  // This is called before every batch of primitives, so draws see the converted EFB as well.
+  ApplyPendingReinterpret();
+
   if (!m_color_poke_vertices.empty())
   {
     DrawPokeVertices(m_color_poke_vertices.data(), static_cast<u32>(m_color_poke_vertices.size()),
@@ -917,12 +1036,21 @@ void FramebufferManager::DoSaveState(PointerWrap& p)
   const TextureConfig color_texture_config(color_texture->GetWidth(), color_texture->GetHeight(),
                                            color_texture->GetLevels(), color_texture->GetLayers(),
                                            1, GetEFBColorFormat(), 0);
-  g_texture_cache->SerializeTexture(color_texture, color_texture_config, p);
-
   const TextureConfig depth_texture_config(depth_texture->GetWidth(), depth_texture->GetHeight(),
                                            depth_texture->GetLevels(), depth_texture->GetLayers(),
                                            1, GetEFBDepthCopyFormat(), 0);
-  g_texture_cache->SerializeTexture(depth_texture, depth_texture_config, p);
+
+  // Both readbacks are started before either is waited for, so the GPU only has to be waited for
+  // once.
+  TextureCacheBase::TextureReadback color_readback, depth_readback;
+  if (p.GetMode() == PointerWrap::MODE_WRITE)
+  {
+    color_readback = g_texture_cache->BeginTextureReadback(color_texture, color_texture_config);
+    depth_readback = g_texture_cache->BeginTextureReadback(depth_texture, depth_texture_config);
+  }
+
+  g_texture_cache->SerializeTexture(color_texture, color_texture_config, p, &color_readback);
+  g_texture_cache->SerializeTexture(depth_texture, depth_texture_config, p, &depth_readback);
 }
 
 void FramebufferManager::DoLoadState(PointerWrap& p)
@@ -79,8 +79,13 @@ public:
   // Reinterpret pixel format of EFB color texture.
   // Assumes no render pass is currently in progress.
   // Swaps EFB framebuffers, so re-bind afterwards.
+  // With deferred format changes, this only records the change. Changes which cancel each other
+  // out never touch the EFB, and several changes in a row are done in a single pass.
   bool ReinterpretPixelData(EFBReinterpretType convtype);
 
+  // Performs a deferred reinterpretation. Called before the EFB color is drawn to or read.
+  void ApplyPendingReinterpret();
+
   // Clears the EFB using shaders.
   void ClearEFB(const MathUtil::Rectangle<int>& rc, bool clear_color, bool clear_alpha,
                 bool clear_z, u32 color, u32 z);
@@ -117,6 +122,11 @@ protected:
     std::unique_ptr<AbstractStagingTexture> readback_texture;
     std::unique_ptr<AbstractPipeline> copy_pipeline;
     std::vector<bool> tiles;
+    // Tiles peeked since the last invalidation, and the ones peeked before it, which are read
+    // back together with the next peeked tile.
+    std::vector<bool> peeked_tiles;
+    std::vector<bool> predicted_tiles;
+    u32 num_peeked_tiles;
     bool out_of_date;
     bool valid;
   };
@@ -126,6 +136,7 @@ protected:
 
   bool CompileConversionPipelines();
   void DestroyConversionPipelines();
+  bool ConvertPixelData(EFBReinterpretType convtype);
 
   bool CompileReadbackPipelines();
   void DestroyReadbackPipelines();
@@ -143,6 +154,9 @@ protected:
   bool IsEFBCacheTilePresent(bool depth, u32 x, u32 y, u32* tile_index) const;
   MathUtil::Rectangle<int> GetEFBCacheTileRect(u32 tile_index) const;
   void PopulateEFBCache(bool depth, u32 tile_index);
+  void CopyEFBCacheTile(bool depth, u32 tile_index);
+  void InvalidateEFBCacheData(EFBCacheData& data);
+  void MarkEFBCacheTilePeeked(EFBCacheData& data, u32 tile_index);
 
   void CreatePokeVertices(std::vector<EFBPokeVertex>* destination_list, u32 x, u32 y, float z,
                           u32 color);
@@ -170,6 +184,12 @@ protected:
   // Format conversion shaders
   std::array<std::unique_ptr<AbstractPipeline>, 6> m_format_conversion_pipelines;
 
+  // Deferred format changes, as indices into the formats of EFBReinterpretType. The EFB data is
+  // stored in m_efb_stored_format, and has to be converted to m_efb_logical_format before use.
+  bool m_reinterpret_pending = false;
+  u32 m_efb_stored_format = 0;
+  u32 m_efb_logical_format = 0;
+
   // EFB cache - for CPU EFB access
   u32 m_efb_cache_tile_size = 0;
   u32 m_efb_cache_tiles_wide = 0;
@@ -0,0 +1,164 @@
+// Copyright 2021 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/GPUTimingBase.h"
+
+#include "VideoCommon/VideoConfig.h"
+
+std::unique_ptr<GPUTimingBase> g_gpu_timing;
+
+const char* GetGPUTimingCategoryName(GPUTimingCategory category)
+{
+  static constexpr std::array<const char*, NUM_GPU_TIMING_CATEGORIES> names = {
+      "Unattributed",       "EFB rendering",   "EFB copies",
+      "Texture conversion", "Post-processing", "Presentation",
+  };
+  return names[static_cast<u32>(category)];
+}
+
+GPUTimingBase::GPUTimingBase()
+{
+  for (auto& total_time : m_total_times)
+    total_time.store(0, std::memory_order_relaxed);
+}
+
+GPUTimingBase::~GPUTimingBase() = default;
+
+void GPUTimingBase::EndSubmission()
+{
+  // Keep a query for the start of the next submission and one for the end of the frame. When
+  // running out, the gap is attributed to the current category instead.
+  if (!m_frame_active || m_frames[m_current_frame].count >= MAX_TIMESTAMPS_PER_FRAME - 2)
+    return;
+
+  WriteTimestampForCategory(GPUTimingCategory::Unattributed);
+  m_in_submission_gap = true;
+}
+
+void GPUTimingBase::BeginSubmission()
+{
+  if (!m_in_submission_gap)
+    return;
+
+  m_in_submission_gap = false;
+  if (m_frame_active)
+    WriteTimestampForCategory(m_category);
+}
+
+void GPUTimingBase::EndFrame()
+{
+  if (m_frame_active)
+  {
+    // The last timestamp closes the range of whatever category was active.
+    Frame& frame = m_frames[m_current_frame];
+    m_category = GPUTimingCategory::Unattributed;
+    WriteCategoryTimestamp();
+    EndFrameQueries(m_current_frame, frame.count);
+    frame.pending = true;
+    m_frame_active = false;
+  }
+  m_category = GPUTimingCategory::Unattributed;
+  m_in_submission_gap = false;
+
+  ReadbackFrames();
+
+  if (!g_ActiveConfig.bMeasureGPUTime && !g_ActiveConfig.bOverlayStats &&
+      !g_ActiveConfig.bDynamicResolution)
+  {
+    return;
+  }
+
+  // If the results of the oldest frame still aren't available, drop them so its queries can be
+  // reused rather than waiting for the GPU.
+  m_current_frame = (m_current_frame + 1) % NUM_FRAMES;
+  Frame& frame = m_frames[m_current_frame];
+  frame.count = 0;
+  frame.pending = false;
+  m_frame_active = BeginFrameQueries(m_current_frame);
+}
+
+std::array<u64, NUM_GPU_TIMING_CATEGORIES> GPUTimingBase::TakeTotalTimes()
+{
+  std::array<u64, NUM_GPU_TIMING_CATEGORIES> total_times;
+  for (u32 i = 0; i < NUM_GPU_TIMING_CATEGORIES; i++)
+    total_times[i] = m_total_times[i].exchange(0, std::memory_order_relaxed);
+  return total_times;
+}
+
+void GPUTimingBase::WriteCategoryTimestamp()
+{
+  // When running out of queries, keep attributing time to the current category. The last query is
+  // reserved for the end of the frame.
+  Frame& frame = m_frames[m_current_frame];
+  if (frame.count >= MAX_TIMESTAMPS_PER_FRAME ||
+      (frame.count >= (MAX_TIMESTAMPS_PER_FRAME - 1) &&
+       m_category != GPUTimingCategory::Unattributed))
+  {
+    return;
+  }
+
+  WriteTimestampForCategory(m_category);
+}
+
+void GPUTimingBase::WriteTimestampForCategory(GPUTimingCategory category)
+{
+  Frame& frame = m_frames[m_current_frame];
+  WriteTimestamp(m_current_frame, frame.count);
+  frame.categories[frame.count++] = category;
+}
+
+void GPUTimingBase::ReadbackFrames()
+{
+  // Frames complete in order, so stop at the first one which isn't done yet.
+  for (u32 i = 1; i <= NUM_FRAMES; i++)
+  {
+    const u32 index = (m_current_frame + i) % NUM_FRAMES;
+    Frame& frame = m_frames[index];
+    if (!frame.pending)
+      continue;
+
+    bool valid = true;
+    if (!ReadTimestamps(index, frame.count, m_readback_buffer.data(), &valid))
+      break;
+
+    if (valid)
+      ProcessResults(frame, m_readback_buffer.data());
+    frame.pending = false;
+  }
+}
+
+void GPUTimingBase::ProcessResults(const Frame& frame, const u64* timestamps_ns)
+{
+  std::array<u64, NUM_GPU_TIMING_CATEGORIES> frame_times = {};
+  for (u32 i = 0; i + 1 < frame.count; i++)
+  {
+    if (frame.categories[i] != GPUTimingCategory::Unattributed &&
+        timestamps_ns[i + 1] > timestamps_ns[i])
+    {
+      frame_times[static_cast<u32>(frame.categories[i])] += timestamps_ns[i + 1] - timestamps_ns[i];
+    }
+  }
+
+  for (u32 i = 0; i < NUM_GPU_TIMING_CATEGORIES; i++)
+  {
+    m_last_frame_times[i] = static_cast<float>(frame_times[i] / 1000000.0);
+    m_total_times[i].fetch_add(frame_times[i], std::memory_order_relaxed);
+  }
+  m_has_results = true;
+  m_num_results++;
+}
+
+GPUTimingScope::GPUTimingScope(GPUTimingCategory category)
+{
+  if (!g_gpu_timing)
+    return;
+
+  m_previous_category = g_gpu_timing->GetCategory();
+  g_gpu_timing->SetCategory(category);
+}
+
+GPUTimingScope::~GPUTimingScope()
+{
+  if (g_gpu_timing)
+    g_gpu_timing->SetCategory(m_previous_category);
+}
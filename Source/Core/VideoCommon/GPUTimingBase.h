@@ -0,0 +1,141 @@
+// Copyright 2021 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <memory>
+
+#include "Common/CommonTypes.h"
+
+// Kinds of GPU work that GPU time is attributed to.
+enum class GPUTimingCategory : u32
+{
+  Unattributed,  // Not attributed to anything, e.g. between the end of a frame and the first draw.
+  EFBRendering,
+  EFBCopies,
+  TextureConversion,
+  PostProcessing,
+  XFBPresentation,
+  Count
+};
+
+constexpr u32 NUM_GPU_TIMING_CATEGORIES = static_cast<u32>(GPUTimingCategory::Count);
+
+const char* GetGPUTimingCategoryName(GPUTimingCategory category);
+
+// Measures how much GPU time each category of work takes, using timestamp queries.
+//
+// A timestamp is written each time the category changes, and the time until the next timestamp is
+// attributed to the category that was active. Nothing is written while the category stays the
+// same, so consecutive draws only cost a comparison. Backends which submit work explicitly also
+// write timestamps at the end and start of every submission, so that the time the GPU may spend
+// idle in between, waiting for more work, isn't attributed to any category. With other backends,
+// that time is included in the category that was active.
+//
+// Results are read back a few frames later, once the GPU has finished the frame, so measuring
+// never stalls the pipeline. Frames whose results are not available by the time their queries
+// are needed again are dropped.
+class GPUTimingBase
+{
+public:
+  GPUTimingBase();
+  virtual ~GPUTimingBase();
+
+  // Attributes GPU work submitted from now on to the specified category.
+  void SetCategory(GPUTimingCategory category)
+  {
+    if (category == m_category)
+      return;
+
+    m_category = category;
+    if (m_frame_active)
+      WriteCategoryTimestamp();
+  }
+  GPUTimingCategory GetCategory() const { return m_category; }
+
+  // Called by backends right before submitting recorded work to the GPU, and once they can record
+  // new work. The GPU may be idle in between, waiting for the next submission.
+  void EndSubmission();
+  void BeginSubmission();
+
+  // Ends the current frame and starts the next one. Must be called before the frame is presented,
+  // so that its last timestamp is submitted along with it.
+  void EndFrame();
+
+  // GPU time of the most recent frame whose results have been read back, in milliseconds.
+  const std::array<float, NUM_GPU_TIMING_CATEGORIES>& GetLastFrameTimes() const
+  {
+    return m_last_frame_times;
+  }
+  bool HasResults() const { return m_has_results; }
+  // Number of frames whose results have been read back, to tell when new results arrive.
+  u64 GetNumResults() const { return m_num_results; }
+
+  // Returns the GPU time of all frames read back since the last call, in nanoseconds.
+  // NOTE: Can be called from any thread
+  std::array<u64, NUM_GPU_TIMING_CATEGORIES> TakeTotalTimes();
+
+protected:
+  // Number of frames which can be measured at once. Results are usually available two frames
+  // after a frame was submitted.
+  static constexpr u32 NUM_FRAMES = 4;
+  static constexpr u32 MAX_TIMESTAMPS_PER_FRAME = 512;
+
+  // Prepares the queries of a frame for writing. Returns false if the frame can't be measured.
+  virtual bool BeginFrameQueries(u32 frame) = 0;
+
+  // Writes a timestamp once the GPU has finished all previously submitted work.
+  virtual void WriteTimestamp(u32 frame, u32 index) = 0;
+
+  // Called after the last timestamp of a frame has been written.
+  virtual void EndFrameQueries(u32 frame, u32 count) {}
+
+  // Reads back the timestamps of a frame in nanoseconds. Returns false without blocking if the
+  // results are not available yet, and true with valid set to false if they were discarded.
+  virtual bool ReadTimestamps(u32 frame, u32 count, u64* timestamps_ns, bool* valid) = 0;
+
+private:
+  struct Frame
+  {
+    // Category of the work after each timestamp.
+    std::array<GPUTimingCategory, MAX_TIMESTAMPS_PER_FRAME> categories;
+    u32 count = 0;
+    bool pending = false;
+  };
+
+  void WriteCategoryTimestamp();
+  void WriteTimestampForCategory(GPUTimingCategory category);
+  void ReadbackFrames();
+  void ProcessResults(const Frame& frame, const u64* timestamps_ns);
+
+  GPUTimingCategory m_category = GPUTimingCategory::Unattributed;
+  bool m_frame_active = false;
+  bool m_in_submission_gap = false;
+  u32 m_current_frame = 0;
+  std::array<Frame, NUM_FRAMES> m_frames;
+  std::array<u64, MAX_TIMESTAMPS_PER_FRAME> m_readback_buffer = {};
+
+  std::array<float, NUM_GPU_TIMING_CATEGORIES> m_last_frame_times = {};
+  bool m_has_results = false;
+  u64 m_num_results = 0;
+  std::array<std::atomic<u64>, NUM_GPU_TIMING_CATEGORIES> m_total_times;
+};
+
+// Attributes the GPU work in a scope to a category, restoring the previous one at the end.
+class GPUTimingScope
+{
+public:
+  explicit GPUTimingScope(GPUTimingCategory category);
+  ~GPUTimingScope();
+
+  GPUTimingScope(const GPUTimingScope&) = delete;
+  GPUTimingScope& operator=(const GPUTimingScope&) = delete;
+
+private:
+  GPUTimingCategory m_previous_category = GPUTimingCategory::Unattributed;
+};
+
+// Null when the backend doesn't support timestamp queries.
+extern std::unique_ptr<GPUTimingBase> g_gpu_timing;
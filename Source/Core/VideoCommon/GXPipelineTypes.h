@@ -3,6 +3,11 @@
 
 #pragma once
 
+#include <cstddef>
+#include <functional>
+#include <string_view>
+
+#include "Common/CommonTypes.h"
 #include "VideoCommon/GeometryShaderGen.h"
 #include "VideoCommon/NativeVertexFormat.h"
 #include "VideoCommon/PixelShaderGen.h"
@@ -85,6 +90,18 @@ struct GXUberPipelineUid
   bool operator!=(const GXUberPipelineUid& rhs) const { return !operator==(rhs); }
 };
 
+// Hashes all of the bytes of a pipeline UID, as they are compared with memcmp(). This doesn't use
+// Common::GetHash64, since the hash function it uses can change at runtime.
+template <typename T>
+struct GXPipelineUidHash
+{
+  size_t operator()(const T& uid) const
+  {
+    return std::hash<std::string_view>{}(
+        std::string_view(reinterpret_cast<const char*>(&uid), sizeof(uid)));
+  }
+};
+
 // Disk cache of pipeline UIDs. We can't use the whole UID as a type as it contains pointers.
 // This structure is safe to save to disk, and should be compiler/platform independent.
 #pragma pack(push, 1)
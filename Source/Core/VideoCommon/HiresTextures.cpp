@@ -4,11 +4,12 @@
 #include "VideoCommon/HiresTextures.h"
 
 #include <algorithm>
+#include <list>
 #include <memory>
 #include <mutex>
+#include <queue>
 #include <string>
 #include <string_view>
-#include <thread>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -16,6 +17,7 @@
 
 #include <fmt/format.h>
 
+#include "Common/CPUDetect.h"
 #include "Common/CommonPaths.h"
 #include "Common/FileSearch.h"
 #include "Common/FileUtil.h"
@@ -26,8 +28,8 @@
 #include "Common/MemoryUtil.h"
 #include "Common/StringUtil.h"
 #include "Common/Swap.h"
-#include "Common/Thread.h"
 #include "Common/Timer.h"
+#include "Common/WorkerPool.h"
 #include "Core/Config/GraphicsSettings.h"
 #include "Core/ConfigManager.h"
 #include "VideoCommon/OnScreenDisplay.h"
@@ -39,14 +41,137 @@ struct DiskTexture
   bool has_arbitrary_mipmaps;
 };
 
+struct CachedTexture
+{
+  std::shared_ptr<HiresTexture> texture;
+  size_t size;
+  std::list<std::string>::iterator lru_position;
+};
+
+struct PrefetchRequest
+{
+  // Requests caused by lookups are ordered by how recent the lookup was. The initial prefetch of
+  // the whole pack uses priority 0 and never evicts anything.
+  u64 priority;
+  std::string base_filename;
+
+  bool operator<(const PrefetchRequest& other) const { return priority < other.priority; }
+};
+
 constexpr std::string_view s_format_prefix{"tex1_"};
 
+// Textures that are being drawn with their native texture until they are loaded come first.
+constexpr u64 ASYNC_LOOKUP_PRIORITY = u64(1) << 63;
+// A directory is queued again if it was not looked up for this many texture lookups.
+constexpr u64 DIRECTORY_REQUEUE_INTERVAL = 1024;
+// Packs that keep everything in one big directory don't tell us anything about which textures
+// belong together, and queueing them would just churn the cache.
+constexpr size_t MAX_DIRECTORY_PREFETCH = 512;
+
 static std::unordered_map<std::string, DiskTexture> s_textureMap;
-static std::unordered_map<std::string, std::shared_ptr<HiresTexture>> s_textureCache;
+// Base names (without mip levels) of the textures in each directory of the pack.
+static std::unordered_map<std::string, std::vector<std::string>> s_textures_by_directory;
+
+// Everything below is protected by s_textureCacheMutex.
+static std::unordered_map<std::string, CachedTexture> s_textureCache;
+// Most recently used textures are at the front.
+static std::list<std::string> s_textureCacheLRU;
+static size_t s_textureCacheSize = 0;
+static size_t s_textureCacheBudget = 0;
+static std::priority_queue<PrefetchRequest> s_prefetchQueue;
+static std::unordered_map<std::string, u64> s_directoryLastQueued;
+static u64 s_lookupCounter = 0;
+static size_t s_initialPrefetchRemaining = 0;
+static bool s_initialPrefetchStopped = false;
+static u32 s_activeLoaders = 0;
+static u32 s_prefetchStartTime = 0;
 static std::mutex s_textureCacheMutex;
+
 static Common::Flag s_textureCacheAbortLoading;
+static Common::WorkerPool s_loaderPool;
 
-static std::thread s_prefetcher;
+static size_t GetTextureSize(const HiresTexture& texture)
+{
+  size_t size = 0;
+  for (const HiresTexture::Level& level : texture.m_levels)
+    size += level.data.size();
+  return size;
+}
+
+static size_t GetCacheBudget()
+{
+  if (g_ActiveConfig.iHiresTextureCacheSize > 0)
+    return static_cast<size_t>(g_ActiveConfig.iHiresTextureCacheSize) * 1024 * 1024;
+
+  const size_t sys_mem = Common::MemPhysical();
+  const size_t recommended_min_mem = 2 * size_t(1024 * 1024 * 1024);
+  // keep 2GB memory for system stability if system RAM is 4GB+ - use half of memory in other cases
+  return (sys_mem / 2 < recommended_min_mem) ? (sys_mem / 2) : (sys_mem - recommended_min_mem);
+}
+
+static void EvictLeastRecentlyUsed()
+{
+  const auto iter = s_textureCache.find(s_textureCacheLRU.back());
+  s_textureCacheSize -= iter->second.size;
+  s_textureCache.erase(iter);
+  s_textureCacheLRU.pop_back();
+}
+
+static void EvictToBudget()
+{
+  while (s_textureCacheSize > s_textureCacheBudget)
+    EvictLeastRecentlyUsed();
+}
+
+// Must be called with s_textureCacheMutex held.
+static bool InsertIntoCache(const std::string& base_filename, std::shared_ptr<HiresTexture> texture,
+                            bool allow_eviction)
+{
+  if (s_textureCache.find(base_filename) != s_textureCache.end())
+    return true;
+
+  const size_t size = GetTextureSize(*texture);
+  if (size > s_textureCacheBudget)
+    return false;
+
+  if (s_textureCacheSize + size > s_textureCacheBudget)
+  {
+    if (!allow_eviction)
+      return false;
+
+    while (s_textureCacheSize + size > s_textureCacheBudget)
+      EvictLeastRecentlyUsed();
+  }
+
+  s_textureCacheLRU.push_front(base_filename);
+  s_textureCache.emplace(base_filename,
+                         CachedTexture{std::move(texture), size, s_textureCacheLRU.begin()});
+  s_textureCacheSize += size;
+  return true;
+}
+
+// Must be called with s_textureCacheMutex held. Returns whether a new loader job has to be
+// submitted once the mutex has been released.
+static bool NeedsLoader()
+{
+  if (s_prefetchQueue.empty() || s_activeLoaders >= s_loaderPool.GetThreadCount())
+    return false;
+
+  s_activeLoaders++;
+  return true;
+}
+
+static void StopLoading()
+{
+  s_textureCacheAbortLoading.Set();
+  s_loaderPool.Stop();
+  s_textureCacheAbortLoading.Clear();
+
+  s_prefetchQueue = {};
+  s_directoryLastQueued.clear();
+  s_activeLoaders = 0;
+  s_initialPrefetchRemaining = 0;
+}
 
 void HiresTexture::Init()
 {
@@ -60,11 +185,7 @@ void HiresTexture::Shutdown()
 
 void HiresTexture::Update()
 {
-  if (s_prefetcher.joinable())
-  {
-    s_textureCacheAbortLoading.Set();
-    s_prefetcher.join();
-  }
+  StopLoading();
 
   if (!g_ActiveConfig.bHiresTextures)
   {
@@ -75,6 +196,8 @@ void HiresTexture::Update()
   if (!g_ActiveConfig.bCacheHiresTextures)
   {
     s_textureCache.clear();
+    s_textureCacheLRU.clear();
+    s_textureCacheSize = 0;
   }
 
   const std::string& game_id = SConfig::GetInstance().GetGameID();
@@ -90,8 +213,9 @@ void HiresTexture::Update()
     bool failed_insert = false;
     for (auto& path : texture_paths)
     {
+      std::string directory;
       std::string filename;
-      SplitPath(path, nullptr, &filename, nullptr);
+      SplitPath(path, &directory, &filename, nullptr);
 
       if (filename.substr(0, s_format_prefix.length()) == s_format_prefix)
       {
@@ -106,6 +230,10 @@ void HiresTexture::Update()
         {
           failed_insert = true;
         }
+        else if (filename.find("_mip") == std::string::npos)
+        {
+          s_textures_by_directory[directory].push_back(filename);
+        }
       }
     }
 
@@ -124,6 +252,8 @@ void HiresTexture::Update()
     {
       if (s_textureMap.find(iter->first) == s_textureMap.end())
       {
+        s_textureCacheSize -= iter->second.size;
+        s_textureCacheLRU.erase(iter->second.lru_position);
         iter = s_textureCache.erase(iter);
       }
       else
@@ -132,85 +262,89 @@ void HiresTexture::Update()
       }
     }
 
-    s_textureCacheAbortLoading.Clear();
-    s_prefetcher = std::thread(Prefetch);
+    s_textureCacheBudget = GetCacheBudget();
+    EvictToBudget();
+
+    // Queue the whole pack at the lowest priority. Lookups push the textures next to the ones
+    // being used ahead of this.
+    for (const auto& [directory, base_filenames] : s_textures_by_directory)
+    {
+      for (const std::string& base_filename : base_filenames)
+      {
+        if (s_textureCache.find(base_filename) == s_textureCache.end())
+          s_prefetchQueue.push(PrefetchRequest{0, base_filename});
+      }
+    }
+    s_initialPrefetchRemaining = s_prefetchQueue.size();
+    s_initialPrefetchStopped = false;
+    s_prefetchStartTime = Common::Timer::GetTimeMs();
+
+    // The CPU and GPU threads are busy, so we use clamp(cpus - 3, 1, 4) threads.
+    const u32 num_loaders = static_cast<u32>(std::min(std::max(cpu_info.num_cores - 3, 1), 4));
+    s_loaderPool.Start(num_loaders, "Custom Texture Loader", Common::ThreadRole::Background);
+    for (u32 i = 0; i < num_loaders && !s_prefetchQueue.empty(); ++i)
+    {
+      s_activeLoaders++;
+      s_loaderPool.Submit(LoadQueuedTextures);
+    }
   }
 }
 
 void HiresTexture::Clear()
 {
-  if (s_prefetcher.joinable())
-  {
-    s_textureCacheAbortLoading.Set();
-    s_prefetcher.join();
-  }
+  StopLoading();
   s_textureMap.clear();
+  s_textures_by_directory.clear();
   s_textureCache.clear();
+  s_textureCacheLRU.clear();
+  s_textureCacheSize = 0;
 }
 
-void HiresTexture::Prefetch()
+void HiresTexture::LoadQueuedTextures()
 {
-  Common::SetCurrentThreadName("Prefetcher");
-
-  size_t size_sum = 0;
-  const size_t sys_mem = Common::MemPhysical();
-  const size_t recommended_min_mem = 2 * size_t(1024 * 1024 * 1024);
-  // keep 2GB memory for system stability if system RAM is 4GB+ - use half of memory in other cases
-  const size_t max_mem =
-      (sys_mem / 2 < recommended_min_mem) ? (sys_mem / 2) : (sys_mem - recommended_min_mem);
-
-  const u32 start_time = Common::Timer::GetTimeMs();
-  for (const auto& entry : s_textureMap)
+  std::unique_lock<std::mutex> lk(s_textureCacheMutex);
+  while (!s_textureCacheAbortLoading.IsSet() && !s_prefetchQueue.empty())
   {
-    const std::string& base_filename = entry.first;
+    const PrefetchRequest request = s_prefetchQueue.top();
+    s_prefetchQueue.pop();
 
-    if (base_filename.find("_mip") == std::string::npos)
-    {
-      std::unique_lock<std::mutex> lk(s_textureCacheMutex);
+    const bool initial_prefetch = request.priority == 0;
+    if (initial_prefetch)
+      s_initialPrefetchRemaining--;
 
-      auto iter = s_textureCache.find(base_filename);
-      if (iter == s_textureCache.end())
-      {
-        // unlock while loading a texture. This may result in a race condition where
-        // we'll load a texture twice, but it reduces the stuttering a lot.
-        lk.unlock();
-        std::unique_ptr<HiresTexture> texture = Load(base_filename, 0, 0);
-        lk.lock();
-        if (texture)
-        {
-          std::shared_ptr<HiresTexture> ptr(std::move(texture));
-          iter = s_textureCache.insert(iter, std::make_pair(base_filename, ptr));
-        }
-      }
-      if (iter != s_textureCache.end())
+    if (s_textureCache.find(request.base_filename) == s_textureCache.end() &&
+        !(initial_prefetch && s_initialPrefetchStopped))
+    {
+      // unlock while loading a texture. This may result in a race condition where
+      // we'll load a texture twice, but it reduces the stuttering a lot.
+      lk.unlock();
+      std::shared_ptr<HiresTexture> texture = Load(request.base_filename, 0, 0);
+      lk.lock();
+
+      // Once the pack doesn't fit anymore, leave the rest of it to lookups instead of reading
+      // every remaining file only to throw it away.
+      if (texture && !InsertIntoCache(request.base_filename, std::move(texture),
+                                      !initial_prefetch) &&
+          initial_prefetch && !s_initialPrefetchStopped)
       {
-        for (const Level& l : iter->second->m_levels)
-          size_sum += l.data.size();
+        s_initialPrefetchStopped = true;
+        OSD::AddMessage(fmt::format("Custom Textures prefetching stopped after {:.1f} MB, the "
+                                    "remaining textures will be loaded on demand",
+                                    s_textureCacheSize / (1024.0 * 1024.0)),
+                        10000);
       }
     }
 
-    if (s_textureCacheAbortLoading.IsSet())
+    if (initial_prefetch && s_initialPrefetchRemaining == 0 && !s_initialPrefetchStopped)
     {
-      return;
-    }
-
-    if (size_sum > max_mem)
-    {
-      Config::SetCurrent(Config::GFX_HIRES_TEXTURES, false);
-
-      OSD::AddMessage(
-          fmt::format(
-              "Custom Textures prefetching after {:.1f} MB aborted, not enough RAM available",
-              size_sum / (1024.0 * 1024.0)),
-          10000);
-      return;
+      const u32 stop_time = Common::Timer::GetTimeMs();
+      OSD::AddMessage(fmt::format("Custom Textures loaded, {:.1f} MB in {:.1f}s",
+                                  s_textureCacheSize / (1024.0 * 1024.0),
+                                  (stop_time - s_prefetchStartTime) / 1000.0),
+                      10000);
     }
   }
-
-  const u32 stop_time = Common::Timer::GetTimeMs();
-  OSD::AddMessage(fmt::format("Custom Textures loaded, {:.1f} MB in {:.1f}s",
-                              size_sum / (1024.0 * 1024.0), (stop_time - start_time) / 1000.0),
-                  10000);
+  s_activeLoaders--;
 }
 
 std::string HiresTexture::GenBaseName(TextureInfo& texture_info, bool dump)
@@ -261,29 +395,78 @@ u32 HiresTexture::CalculateMipCount(u32 width, u32 height)
   return mip_count;
 }
 
-std::shared_ptr<HiresTexture> HiresTexture::Search(TextureInfo& texture_info)
+std::shared_ptr<HiresTexture> HiresTexture::Search(TextureInfo& texture_info,
+                                                   std::string* pending_name)
 {
   const std::string base_filename = GenBaseName(texture_info);
+  if (base_filename.empty())
+    return nullptr;
 
-  std::lock_guard<std::mutex> lk(s_textureCacheMutex);
+  if (!g_ActiveConfig.bCacheHiresTextures)
+    return Load(base_filename, texture_info.GetRawWidth(), texture_info.GetRawHeight());
 
-  auto iter = s_textureCache.find(base_filename);
-  if (iter != s_textureCache.end())
+  std::shared_ptr<HiresTexture> ptr;
+  bool start_loader = false;
   {
-    return iter->second;
+    std::lock_guard<std::mutex> lk(s_textureCacheMutex);
+    const u64 lookup = ++s_lookupCounter;
+
+    // Textures of a pack are usually grouped by the area of the game they are used in, so queue
+    // the rest of the directory ahead of everything else.
+    std::string directory;
+    SplitPath(s_textureMap.at(base_filename).path, &directory, nullptr, nullptr);
+    const std::vector<std::string>& neighbors = s_textures_by_directory[directory];
+    u64& last_queued = s_directoryLastQueued[directory];
+    if (neighbors.size() <= MAX_DIRECTORY_PREFETCH &&
+        (last_queued == 0 || lookup - last_queued > DIRECTORY_REQUEUE_INTERVAL))
+    {
+      for (const std::string& name : neighbors)
+      {
+        if (name != base_filename && s_textureCache.find(name) == s_textureCache.end())
+          s_prefetchQueue.push(PrefetchRequest{lookup, name});
+      }
+      start_loader = NeedsLoader();
+    }
+    last_queued = lookup;
+
+    const auto iter = s_textureCache.find(base_filename);
+    if (iter != s_textureCache.end())
+    {
+      s_textureCacheLRU.splice(s_textureCacheLRU.begin(), s_textureCacheLRU,
+                               iter->second.lru_position);
+      ptr = iter->second.texture;
+    }
+    else if (pending_name && g_ActiveConfig.bAsyncHiresTextures)
+    {
+      s_prefetchQueue.push(PrefetchRequest{ASYNC_LOOKUP_PRIORITY | lookup, base_filename});
+      start_loader = start_loader || NeedsLoader();
+      *pending_name = base_filename;
+    }
   }
 
-  std::shared_ptr<HiresTexture> ptr(
-      Load(base_filename, texture_info.GetRawWidth(), texture_info.GetRawHeight()));
+  if (start_loader)
+    s_loaderPool.Submit(LoadQueuedTextures);
+
+  if (ptr || (pending_name && !pending_name->empty()))
+    return ptr;
 
-  if (ptr && g_ActiveConfig.bCacheHiresTextures)
+  ptr = Load(base_filename, texture_info.GetRawWidth(), texture_info.GetRawHeight());
+
+  if (ptr)
   {
-    s_textureCache[base_filename] = ptr;
+    std::lock_guard<std::mutex> lk(s_textureCacheMutex);
+    InsertIntoCache(base_filename, ptr, true);
   }
 
   return ptr;
 }
 
+bool HiresTexture::IsLoaded(const std::string& base_filename)
+{
+  std::lock_guard<std::mutex> lk(s_textureCacheMutex);
+  return s_textureCache.find(base_filename) != s_textureCache.end();
+}
+
 std::unique_ptr<HiresTexture> HiresTexture::Load(const std::string& base_filename, u32 width,
                                                  u32 height)
 {
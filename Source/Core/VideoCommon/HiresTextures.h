@@ -25,7 +25,12 @@ public:
   static void Clear();
   static void Shutdown();
 
-  static std::shared_ptr<HiresTexture> Search(TextureInfo& texture_info);
+  // Returns null if there is no custom texture for the texture. When loading asynchronously, also
+  // returns null while the custom texture is being loaded, and sets pending_name to the name to
+  // pass to IsLoaded. Passing null for pending_name always loads synchronously.
+  static std::shared_ptr<HiresTexture> Search(TextureInfo& texture_info,
+                                              std::string* pending_name = nullptr);
+  static bool IsLoaded(const std::string& base_filename);
 
   static std::string GenBaseName(TextureInfo& texture_info, bool dump = false);
 
@@ -52,7 +57,7 @@ private:
   static bool LoadDDSTexture(HiresTexture* tex, const std::string& filename);
   static bool LoadDDSTexture(Level& level, const std::string& filename, u32 mip_level);
   static bool LoadTexture(Level& level, const std::vector<u8>& buffer);
-  static void Prefetch();
+  static void LoadQueuedTextures();
 
   HiresTexture() {}
   bool m_has_arbitrary_mipmaps;
@@ -7,6 +7,12 @@
 #include <cstddef>
 #include <cstring>
 
+#if defined(_M_X86)
+#include <emmintrin.h>
+#elif defined(_M_ARM_64)
+#include <arm_neon.h>
+#endif
+
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
 #include "VideoCommon/OpcodeDecoding.h"
@@ -16,6 +22,83 @@ namespace
 {
 constexpr u16 s_primitive_restart = UINT16_MAX;
 
+// Most primitives expand to a group of up to 8 indices which repeats with every few vertices, so
+// whole groups are written with one vector store. Each lane of a group is either an offset from
+// the first vertex of the group, the first vertex of the primitive or a primitive restart.
+constexpr s8 FIRST = -1;
+constexpr s8 RESTART = -2;
+
+struct IndexPattern
+{
+  u32 num_indices;
+  u32 num_vertices;
+  std::array<s8, 8> lanes;
+};
+
+u16* WritePattern(u16* index_ptr, const IndexPattern& pattern, u32 num_groups, u32 first_index,
+                  u32 index)
+{
+  if (num_groups == 0)
+    return index_ptr;
+
+  alignas(16) std::array<u16, 8> offsets{};
+  alignas(16) std::array<u16, 8> fixed_mask{};
+  alignas(16) std::array<u16, 8> fixed{};
+  for (u32 i = 0; i < 8; ++i)
+  {
+    const s8 lane = pattern.lanes[i];
+    offsets[i] = lane >= 0 ? static_cast<u16>(index + lane) : 0;
+    fixed_mask[i] = lane >= 0 ? 0 : 0xFFFF;
+    fixed[i] = lane == FIRST ? static_cast<u16>(first_index) :
+                               lane == RESTART ? s_primitive_restart : 0;
+  }
+
+  // Every store writes all 8 lanes and the next group overwrites the unused ones, so the last
+  // group goes through a temporary to not write past the end.
+  alignas(16) std::array<u16, 8> last;
+#if defined(_M_X86)
+  __m128i indices = _mm_load_si128(reinterpret_cast<const __m128i*>(offsets.data()));
+  const __m128i step = _mm_set1_epi16(static_cast<s16>(pattern.num_vertices));
+  const __m128i mask = _mm_load_si128(reinterpret_cast<const __m128i*>(fixed_mask.data()));
+  const __m128i values = _mm_load_si128(reinterpret_cast<const __m128i*>(fixed.data()));
+  for (u32 i = 1; i < num_groups; ++i)
+  {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(index_ptr),
+                     _mm_or_si128(_mm_andnot_si128(mask, indices), values));
+    index_ptr += pattern.num_indices;
+    indices = _mm_add_epi16(indices, step);
+  }
+  _mm_store_si128(reinterpret_cast<__m128i*>(last.data()),
+                  _mm_or_si128(_mm_andnot_si128(mask, indices), values));
+#elif defined(_M_ARM_64)
+  uint16x8_t indices = vld1q_u16(offsets.data());
+  const uint16x8_t step = vdupq_n_u16(static_cast<u16>(pattern.num_vertices));
+  const uint16x8_t mask = vld1q_u16(fixed_mask.data());
+  const uint16x8_t values = vld1q_u16(fixed.data());
+  for (u32 i = 1; i < num_groups; ++i)
+  {
+    vst1q_u16(index_ptr, vbslq_u16(mask, values, indices));
+    index_ptr += pattern.num_indices;
+    indices = vaddq_u16(indices, step);
+  }
+  vst1q_u16(last.data(), vbslq_u16(mask, values, indices));
+#else
+  for (u32 i = 1; i < num_groups; ++i)
+  {
+    for (u32 j = 0; j < pattern.num_indices; ++j)
+      index_ptr[j] = fixed_mask[j] ? fixed[j] : offsets[j];
+    index_ptr += pattern.num_indices;
+    for (u16& offset : offsets)
+      offset += pattern.num_vertices;
+  }
+  for (u32 j = 0; j < 8; ++j)
+    last[j] = fixed_mask[j] ? fixed[j] : offsets[j];
+#endif
+
+  std::memcpy(index_ptr, last.data(), pattern.num_indices * sizeof(u16));
+  return index_ptr + pattern.num_indices;
+}
+
 template <bool pr>
 u16* WriteTriangle(u16* index_ptr, u32 index1, u32 index2, u32 index3)
 {
@@ -30,7 +113,12 @@ u16* WriteTriangle(u16* index_ptr, u32 index1, u32 index2, u32 index3)
 template <bool pr>
 u16* AddList(u16* index_ptr, u32 num_verts, u32 index)
 {
-  for (u32 i = 2; i < num_verts; i += 3)
+  constexpr IndexPattern pattern = pr ? IndexPattern{8, 6, {0, 1, 2, RESTART, 3, 4, 5, RESTART}} :
+                                        IndexPattern{6, 6, {0, 1, 2, 3, 4, 5}};
+  const u32 num_groups = num_verts / 6;
+  index_ptr = WritePattern(index_ptr, pattern, num_groups, index, index);
+
+  for (u32 i = 2 + num_groups * 6; i < num_verts; i += 3)
   {
     index_ptr = WriteTriangle<pr>(index_ptr, index + i - 2, index + i - 1, index + i);
   }
@@ -42,7 +130,11 @@ u16* AddStrip(u16* index_ptr, u32 num_verts, u32 index)
 {
   if constexpr (pr)
   {
-    for (u32 i = 0; i < num_verts; ++i)
+    constexpr IndexPattern pattern{8, 8, {0, 1, 2, 3, 4, 5, 6, 7}};
+    const u32 num_groups = num_verts / 8;
+    index_ptr = WritePattern(index_ptr, pattern, num_groups, index, index);
+
+    for (u32 i = num_groups * 8; i < num_verts; ++i)
     {
       *index_ptr++ = index + i;
     }
@@ -50,8 +142,13 @@ u16* AddStrip(u16* index_ptr, u32 num_verts, u32 index)
   }
   else
   {
+    // Two triangles with opposite winding per group.
+    constexpr IndexPattern pattern{6, 2, {0, 1, 2, 1, 3, 2}};
+    const u32 num_groups = num_verts >= 2 ? (num_verts - 2) / 2 : 0;
+    index_ptr = WritePattern(index_ptr, pattern, num_groups, index, index);
+
     bool wind = false;
-    for (u32 i = 2; i < num_verts; ++i)
+    for (u32 i = 2 + num_groups * 2; i < num_verts; ++i)
     {
       index_ptr = WriteTriangle<pr>(index_ptr, index + i - 2, index + i - !wind, index + i - wind);
 
@@ -87,6 +184,11 @@ u16* AddFan(u16* index_ptr, u32 num_verts, u32 index)
 
   if constexpr (pr)
   {
+    constexpr IndexPattern pattern{6, 3, {0, 1, FIRST, 2, 3, RESTART}};
+    const u32 num_groups = num_verts >= 2 ? (num_verts - 2) / 3 : 0;
+    index_ptr = WritePattern(index_ptr, pattern, num_groups, index, index + 1);
+    i += num_groups * 3;
+
     for (; i + 3 <= num_verts; i += 3)
     {
       *index_ptr++ = index + i - 1;
@@ -106,6 +208,13 @@ u16* AddFan(u16* index_ptr, u32 num_verts, u32 index)
       *index_ptr++ = s_primitive_restart;
     }
   }
+  else
+  {
+    constexpr IndexPattern pattern{6, 2, {FIRST, 0, 1, FIRST, 1, 2}};
+    const u32 num_groups = num_verts >= 2 ? (num_verts - 2) / 2 : 0;
+    index_ptr = WritePattern(index_ptr, pattern, num_groups, index, index + 1);
+    i += num_groups * 2;
+  }
 
   for (; i < num_verts; ++i)
   {
@@ -134,7 +243,12 @@ u16* AddFan(u16* index_ptr, u32 num_verts, u32 index)
 template <bool pr>
 u16* AddQuads(u16* index_ptr, u32 num_verts, u32 index)
 {
-  u32 i = 3;
+  constexpr IndexPattern pattern = pr ? IndexPattern{5, 4, {1, 2, 0, 3, RESTART}} :
+                                        IndexPattern{6, 4, {0, 1, 2, 0, 2, 3}};
+  const u32 num_groups = num_verts / 4;
+  index_ptr = WritePattern(index_ptr, pattern, num_groups, index, index);
+
+  u32 i = 3 + num_groups * 4;
   for (; i < num_verts; i += 4)
   {
     if constexpr (pr)
@@ -170,7 +284,11 @@ u16* AddQuads_nonstandard(u16* index_ptr, u32 num_verts, u32 index)
 
 u16* AddLineList(u16* index_ptr, u32 num_verts, u32 index)
 {
-  for (u32 i = 1; i < num_verts; i += 2)
+  constexpr IndexPattern pattern{8, 8, {0, 1, 2, 3, 4, 5, 6, 7}};
+  const u32 num_groups = num_verts / 8;
+  index_ptr = WritePattern(index_ptr, pattern, num_groups, index, index);
+
+  for (u32 i = 1 + num_groups * 8; i < num_verts; i += 2)
   {
     *index_ptr++ = index + i - 1;
     *index_ptr++ = index + i;
@@ -182,7 +300,11 @@ u16* AddLineList(u16* index_ptr, u32 num_verts, u32 index)
 // so converting them to lists
 u16* AddLineStrip(u16* index_ptr, u32 num_verts, u32 index)
 {
-  for (u32 i = 1; i < num_verts; ++i)
+  constexpr IndexPattern pattern{8, 4, {0, 1, 1, 2, 2, 3, 3, 4}};
+  const u32 num_groups = num_verts >= 1 ? (num_verts - 1) / 4 : 0;
+  index_ptr = WritePattern(index_ptr, pattern, num_groups, index, index);
+
+  for (u32 i = 1 + num_groups * 4; i < num_verts; ++i)
   {
     *index_ptr++ = index + i - 1;
     *index_ptr++ = index + i;
@@ -192,7 +314,11 @@ u16* AddLineStrip(u16* index_ptr, u32 num_verts, u32 index)
 
 u16* AddPoints(u16* index_ptr, u32 num_verts, u32 index)
 {
-  for (u32 i = 0; i != num_verts; ++i)
+  constexpr IndexPattern pattern{8, 8, {0, 1, 2, 3, 4, 5, 6, 7}};
+  const u32 num_groups = num_verts / 8;
+  index_ptr = WritePattern(index_ptr, pattern, num_groups, index, index);
+
+  for (u32 i = num_groups * 8; i != num_verts; ++i)
   {
     *index_ptr++ = index + i;
   }
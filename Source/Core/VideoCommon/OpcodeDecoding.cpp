@@ -14,7 +14,11 @@
 
 #include "VideoCommon/OpcodeDecoding.h"
 
+#include <cstring>
+#include <vector>
+
 #include "Common/CommonTypes.h"
+#include "Common/FlatHashMap.h"
 #include "Common/Logging/Log.h"
 #include "Core/FifoPlayer/FifoRecorder.h"
 #include "Core/HW/Memmap.h"
@@ -25,6 +29,7 @@
 #include "VideoCommon/Fifo.h"
 #include "VideoCommon/Statistics.h"
 #include "VideoCommon/VertexLoaderManager.h"
+#include "VideoCommon/VideoConfig.h"
 #include "VideoCommon/XFMemory.h"
 
 namespace OpcodeDecoder
@@ -33,6 +38,223 @@ namespace
 {
 bool s_is_fifo_error_seen = false;
 
+// Display lists are usually built once and called many times, so the commands of a list are kept
+// after it was interpreted, with their arguments already extracted. As noted above, the command
+// boundaries depend on the vertex formats at the time of the call. The sizes of the vertex data
+// are therefore checked again on every call, and the rest of the list is parsed as usual if they
+// don't match anymore.
+struct CachedCommand
+{
+  u8 cmd_byte;
+  // The CP register of CP loads, or the ref array of indexed XF loads.
+  u8 sub_cmd;
+  u16 num_vertices;
+  // The register value of CP and BP loads, the address of XF loads, or the indexed XF load.
+  u32 value;
+  // Where the vertex or XF data starts in the display list.
+  u32 offset;
+  // The size of the vertex data in bytes, or the number of words of XF loads.
+  u32 size;
+};
+
+struct CachedDisplayList
+{
+  // The contents of the list when it was cached. The CPU can rewrite a display list at any time
+  // without the GPU thread noticing, so they're compared on every call.
+  std::vector<u8> data;
+  std::vector<CachedCommand> commands;
+};
+
+class DisplayListRecorder
+{
+public:
+  explicit DisplayListRecorder(u8* start) : m_start(start) {}
+
+  void Record(u8* opcode_start, u8* opcode_end);
+
+  bool IsValid() const { return m_valid; }
+  std::vector<CachedCommand>& GetCommands() { return m_commands; }
+
+private:
+  u8* m_start;
+  std::vector<CachedCommand> m_commands;
+  bool m_valid = true;
+};
+
+constexpr size_t MAX_CACHED_DISPLAY_LISTS = 4096;
+
+Common::FlatHashMap<u64, CachedDisplayList> s_display_list_cache;
+DisplayListRecorder* s_display_list_recorder = nullptr;
+
+void DisplayListRecorder::Record(u8* opcode_start, u8* opcode_end)
+{
+  DataReader src(opcode_start, opcode_end);
+  CachedCommand command{};
+  command.cmd_byte = src.Read<u8>();
+
+  switch (command.cmd_byte)
+  {
+  case GX_NOP:
+  case GX_UNKNOWN_RESET:
+  case GX_CMD_CALL_DL:
+  case GX_CMD_UNKNOWN_METRICS:
+  case GX_CMD_INVL_VC:
+    break;
+
+  case GX_LOAD_CP_REG:
+    command.sub_cmd = src.Read<u8>();
+    command.value = src.Read<u32>();
+    break;
+
+  case GX_LOAD_XF_REG:
+  {
+    const u32 cmd2 = src.Read<u32>();
+    command.value = cmd2 & 0xFFFF;
+    command.size = ((cmd2 >> 16) & 15) + 1;
+    command.offset = static_cast<u32>(src.GetPointer() - m_start);
+    break;
+  }
+
+  case GX_LOAD_INDX_A:
+  case GX_LOAD_INDX_B:
+  case GX_LOAD_INDX_C:
+  case GX_LOAD_INDX_D:
+    command.sub_cmd = (command.cmd_byte / 8) + 8;
+    command.value = src.Read<u32>();
+    break;
+
+  case GX_LOAD_BP_REG:
+    command.value = src.Read<u32>();
+    break;
+
+  default:
+    if ((command.cmd_byte & 0xC0) != 0x80)
+    {
+      m_valid = false;
+      return;
+    }
+    command.num_vertices = src.Read<u16>();
+    command.offset = static_cast<u32>(src.GetPointer() - m_start);
+    command.size = static_cast<u32>(src.size());
+    break;
+  }
+
+  m_commands.push_back(command);
+}
+
+// Returns false if the cached commands don't match the current vertex formats anymore.
+bool ReplayDisplayList(const CachedDisplayList& list, u8* start, u8* end, u32* cycles)
+{
+  u32 total_cycles = 0;
+  bool matches = true;
+
+  for (const CachedCommand& command : list.commands)
+  {
+    switch (command.cmd_byte)
+    {
+    case GX_LOAD_CP_REG:
+      total_cycles += 12;
+      LoadCPReg(command.sub_cmd, command.value, false);
+      INCSTAT(g_stats.this_frame.num_cp_loads);
+      break;
+
+    case GX_LOAD_XF_REG:
+      total_cycles += 18 + 6 * command.size;
+      LoadXFReg(command.size, command.value, DataReader(start + command.offset, end));
+      INCSTAT(g_stats.this_frame.num_xf_loads);
+      break;
+
+    case GX_LOAD_INDX_A:
+    case GX_LOAD_INDX_B:
+    case GX_LOAD_INDX_C:
+    case GX_LOAD_INDX_D:
+      total_cycles += 6;
+      LoadIndexedXF(command.value, command.sub_cmd);
+      break;
+
+    case GX_LOAD_BP_REG:
+      total_cycles += 12;
+      LoadBPReg(command.value);
+      INCSTAT(g_stats.this_frame.num_bp_loads);
+      break;
+
+    case GX_CMD_CALL_DL:
+      total_cycles += 6;
+      INFO_LOG_FMT(VIDEO, "recursive display list detected");
+      break;
+
+    default:
+      if ((command.cmd_byte & 0xC0) == 0x80)
+      {
+        const int bytes = VertexLoaderManager::RunVertices(
+            command.cmd_byte & GX_VAT_MASK,
+            (command.cmd_byte & GX_PRIMITIVE_MASK) >> GX_PRIMITIVE_SHIFT, command.num_vertices,
+            DataReader(start + command.offset, end), false);
+        if (bytes < 0)
+        {
+          matches = false;
+          break;
+        }
+
+        total_cycles += command.num_vertices * 4 * 3 + 6;
+        if (static_cast<u32>(bytes) != command.size)
+        {
+          u32 remaining_cycles = 0;
+          Run(DataReader(start + command.offset + bytes, end), &remaining_cycles, true);
+          total_cycles += remaining_cycles;
+          matches = false;
+        }
+      }
+      else
+      {
+        total_cycles += 6;
+      }
+      break;
+    }
+
+    if (!matches)
+      break;
+  }
+
+  *cycles = total_cycles;
+  return matches;
+}
+
+u32 RunCachedDisplayList(u32 address, u32 size, u8* start_address)
+{
+  u8* const end_address = start_address + size;
+  const u64 key = (u64(address) << 32) | size;
+  u32 cycles = 0;
+
+  if (const CachedDisplayList* list = s_display_list_cache.Find(key))
+  {
+    if (std::memcmp(list->data.data(), start_address, size) == 0)
+    {
+      if (!ReplayDisplayList(*list, start_address, end_address, &cycles))
+        s_display_list_cache.Erase(key);
+      return cycles;
+    }
+    s_display_list_cache.Erase(key);
+  }
+
+  DisplayListRecorder recorder(start_address);
+  s_display_list_recorder = &recorder;
+  const u8* const parse_end = Run(DataReader(start_address, end_address), &cycles, true);
+  s_display_list_recorder = nullptr;
+
+  // Lists which end with an incomplete command are rare enough to not be worth caching.
+  if (!recorder.IsValid() || parse_end != end_address || recorder.GetCommands().empty())
+    return cycles;
+
+  if (s_display_list_cache.Size() >= MAX_CACHED_DISPLAY_LISTS)
+    s_display_list_cache.Clear();
+
+  CachedDisplayList& list = s_display_list_cache[key];
+  list.data.assign(start_address, end_address);
+  list.commands = std::move(recorder.GetCommands());
+  return cycles;
+}
+
 u32 InterpretDisplayList(u32 address, u32 size)
 {
   u8* start_address;
@@ -50,7 +272,11 @@ u32 InterpretDisplayList(u32 address, u32 size)
     // temporarily swap dl and non-dl (small "hack" for the stats)
     g_stats.SwapDL();
 
-    Run(DataReader(start_address, start_address + size), &cycles, true);
+    // The FIFO recorder needs to see every command.
+    if (g_ActiveConfig.bDisplayListCache && !g_record_fifo_data)
+      cycles = RunCachedDisplayList(address, size, start_address);
+    else
+      Run(DataReader(start_address, start_address + size), &cycles, true);
     INCSTAT(g_stats.this_frame.num_dlists_called);
 
     // un-swap
@@ -78,6 +304,7 @@ bool g_record_fifo_data = false;
 void Init()
 {
   s_is_fifo_error_seen = false;
+  s_display_list_cache.Clear();
 }
 
 template <bool is_preprocess>
@@ -267,6 +494,9 @@ u8* Run(DataReader src, u32* cycles, bool in_display_list)
     // Display lists get added directly into the FIFO stream
     if constexpr (!is_preprocess)
     {
+      if (in_display_list && s_display_list_recorder != nullptr)
+        s_display_list_recorder->Record(opcode_start, src.GetPointer());
+
       if (g_record_fifo_data && cmd_byte != GX_CMD_CALL_DL)
       {
         const u8* const opcode_end = src.GetPointer();
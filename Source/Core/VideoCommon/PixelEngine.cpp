@@ -5,7 +5,7 @@
 
 #include "VideoCommon/PixelEngine.h"
 
-#include <mutex>
+#include <atomic>
 
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
@@ -96,12 +96,16 @@ static UPEAlphaModeConfReg m_AlphaModeConf;
 static UPEAlphaReadReg m_AlphaRead;
 static UPECtrlReg m_Control;
 
-static std::mutex s_token_finish_mutex;
 static u16 s_token;
-static u16 s_token_pending;
-static bool s_token_interrupt_pending;
-static bool s_finish_interrupt_pending;
-static bool s_event_raised;
+
+// The token and interrupts raised by the video thread that the CPU thread hasn't picked up yet.
+// They're packed into a single word so that both threads can update them without a lock.
+constexpr u32 PENDING_TOKEN_MASK = 0xffff;
+constexpr u32 PENDING_TOKEN_INTERRUPT = 1 << 16;
+constexpr u32 PENDING_FINISH_INTERRUPT = 1 << 17;
+// Set while a SetTokenFinish event is scheduled, so that only one is in flight at a time.
+constexpr u32 PENDING_EVENT_RAISED = 1 << 18;
+static std::atomic<u32> s_pending_state;
 
 static bool s_signal_token_interrupt;
 static bool s_signal_finish_interrupt;
@@ -123,11 +127,24 @@ void DoState(PointerWrap& p)
   p.Do(m_AlphaRead);
   p.DoPOD(m_Control);
 
+  const u32 pending_state = s_pending_state.load();
+  u16 token_pending = static_cast<u16>(pending_state & PENDING_TOKEN_MASK);
+  bool token_interrupt_pending = (pending_state & PENDING_TOKEN_INTERRUPT) != 0;
+  bool finish_interrupt_pending = (pending_state & PENDING_FINISH_INTERRUPT) != 0;
+  bool event_raised = (pending_state & PENDING_EVENT_RAISED) != 0;
+
   p.Do(s_token);
-  p.Do(s_token_pending);
-  p.Do(s_token_interrupt_pending);
-  p.Do(s_finish_interrupt_pending);
-  p.Do(s_event_raised);
+  p.Do(token_pending);
+  p.Do(token_interrupt_pending);
+  p.Do(finish_interrupt_pending);
+  p.Do(event_raised);
+
+  if (p.mode == PointerWrap::MODE_READ)
+  {
+    s_pending_state.store(token_pending | (token_interrupt_pending ? PENDING_TOKEN_INTERRUPT : 0) |
+                          (finish_interrupt_pending ? PENDING_FINISH_INTERRUPT : 0) |
+                          (event_raised ? PENDING_EVENT_RAISED : 0));
+  }
 
   p.Do(s_signal_token_interrupt);
   p.Do(s_signal_finish_interrupt);
@@ -146,10 +163,7 @@ void Init()
   m_AlphaRead.Hex = 0;
 
   s_token = 0;
-  s_token_pending = 0;
-  s_token_interrupt_pending = false;
-  s_finish_interrupt_pending = false;
-  s_event_raised = false;
+  s_pending_state.store(0);
 
   s_signal_token_interrupt = false;
   s_signal_finish_interrupt = false;
@@ -251,38 +265,33 @@ static void UpdateInterrupts()
 
 static void SetTokenFinish_OnMainThread(u64 userdata, s64 cyclesLate)
 {
-  std::unique_lock<std::mutex> lk(s_token_finish_mutex);
-  s_event_raised = false;
+  // Take the pending interrupts and allow the video thread to raise a new event, keeping the
+  // pending token as it is.
+  const u32 pending_state = s_pending_state.fetch_and(PENDING_TOKEN_MASK);
 
-  s_token = s_token_pending;
+  s_token = static_cast<u16>(pending_state & PENDING_TOKEN_MASK);
 
-  if (s_token_interrupt_pending)
+  if (pending_state & PENDING_TOKEN_INTERRUPT)
   {
-    s_token_interrupt_pending = false;
     s_signal_token_interrupt = true;
     UpdateInterrupts();
   }
 
-  if (s_finish_interrupt_pending)
+  if (pending_state & PENDING_FINISH_INTERRUPT)
   {
-    s_finish_interrupt_pending = false;
     s_signal_finish_interrupt = true;
     UpdateInterrupts();
-    lk.unlock();
     Core::FrameUpdateOnCPUThread();
   }
 }
 
-// Raise the event handler above on the CPU thread.
-// s_token_finish_mutex must be locked.
+// Raise the event handler above on the CPU thread, unless it already was.
 // THIS IS EXECUTED FROM VIDEO THREAD
-static void RaiseEvent()
+static void RaiseEvent(u32 old_pending_state)
 {
-  if (s_event_raised)
+  if (old_pending_state & PENDING_EVENT_RAISED)
     return;
 
-  s_event_raised = true;
-
   CoreTiming::FromThread from = CoreTiming::FromThread::NON_CPU;
   if (!SConfig::GetInstance().bCPUThread || Fifo::UseDeterministicGPUThread())
     from = CoreTiming::FromThread::CPU;
@@ -295,12 +304,16 @@ void SetToken(const u16 token, const bool interrupt)
 {
   DEBUG_LOG_FMT(PIXELENGINE, "VIDEO Backend raises INT_CAUSE_PE_TOKEN (btw, token: {:04x})", token);
 
-  std::lock_guard<std::mutex> lk(s_token_finish_mutex);
-
-  s_token_pending = token;
-  s_token_interrupt_pending |= interrupt;
+  u32 old_pending_state = s_pending_state.load();
+  u32 new_pending_state;
+  do
+  {
+    new_pending_state = (old_pending_state & ~PENDING_TOKEN_MASK) | token | PENDING_EVENT_RAISED;
+    if (interrupt)
+      new_pending_state |= PENDING_TOKEN_INTERRUPT;
+  } while (!s_pending_state.compare_exchange_weak(old_pending_state, new_pending_state));
 
-  RaiseEvent();
+  RaiseEvent(old_pending_state);
 }
 
 // SetFinish
@@ -309,11 +322,7 @@ void SetFinish()
 {
   DEBUG_LOG_FMT(PIXELENGINE, "VIDEO Set Finish");
 
-  std::lock_guard<std::mutex> lk(s_token_finish_mutex);
-
-  s_finish_interrupt_pending |= true;
-
-  RaiseEvent();
+  RaiseEvent(s_pending_state.fetch_or(PENDING_FINISH_INTERRUPT | PENDING_EVENT_RAISED));
 }
 
 UPEAlphaReadReg GetAlphaReadMode()
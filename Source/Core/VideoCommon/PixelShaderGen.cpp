@@ -5,6 +5,10 @@
 
 #include <cmath>
 #include <cstdio>
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
 
 #include "Common/Assert.h"
 #include "Common/CommonTypes.h"
@@ -349,8 +353,8 @@ void ClearUnusedPixelShaderUidBits(APIType api_type, const ShaderHostConfig& hos
   uid_data->bounding_box &= host_config.bounding_box & host_config.backend_bbox;
 }
 
-void WritePixelShaderCommonHeader(ShaderCode& out, APIType api_type,
-                                  const ShaderHostConfig& host_config, bool bounding_box)
+static void GeneratePixelShaderCommonHeader(ShaderCode& out, APIType api_type,
+                                            const ShaderHostConfig& host_config, bool bounding_box)
 {
   // dot product for integer vectors
   out.Write("int idot(int3 x, int3 y)\n"
@@ -542,6 +546,34 @@ void UpdateBoundingBox(float2 rawpos) {{
   }
 }
 
+void WritePixelShaderCommonHeader(ShaderCode& out, APIType api_type,
+                                  const ShaderHostConfig& host_config, bool bounding_box)
+{
+  // The header is the same for every shader with the same settings, so only generate it once for
+  // each combination. Shaders are generated on the compiler worker threads, hence the lock.
+  // Entries are never removed, so the strings can be read after releasing it.
+  using HeaderKey = std::tuple<APIType, bool, bool, bool>;
+  static std::mutex s_headers_mutex;
+  static std::map<HeaderKey, std::string> s_headers;
+
+  const HeaderKey key{api_type, host_config.per_pixel_lighting, bounding_box,
+                      DriverDetails::HasBug(DriverDetails::BUG_BROKEN_SSBO_FIELD_ATOMICS)};
+  const std::string* header;
+  {
+    std::lock_guard lock(s_headers_mutex);
+    auto it = s_headers.find(key);
+    if (it == s_headers.end())
+    {
+      ShaderCode header_code;
+      GeneratePixelShaderCommonHeader(header_code, api_type, host_config, bounding_box);
+      it = s_headers.emplace(key, header_code.GetBuffer()).first;
+    }
+    header = &it->second;
+  }
+
+  out.Write("{}", *header);
+}
+
 static void WriteStage(ShaderCode& out, const pixel_shader_uid_data* uid_data, int n,
                        APIType api_type, bool stereo);
 static void WriteTevRegular(ShaderCode& out, std::string_view components, TevBias bias, TevOp op,
@@ -382,39 +382,146 @@ std::vector<std::string> PostProcessing::GetPassiveShaderList()
   return GetShaders(PASSIVE_DIR DIR_SEP);
 }
 
+class PostProcessing::ShaderWorkItem final : public AsyncShaderCompiler::WorkItem
+{
+public:
+  ShaderWorkItem(const PostProcessing* post_processing, std::shared_ptr<PendingShader> pending,
+                 std::string name, const AbstractShader* geometry_shader,
+                 AbstractTextureFormat format)
+      : m_post_processing(post_processing), m_pending(std::move(pending)), m_name(std::move(name)),
+        m_geometry_shader(geometry_shader), m_format(format)
+  {
+  }
+
+  bool Compile() override
+  {
+    m_post_processing->CompilePixelShader(m_name, &m_shader);
+    if (m_shader.pixel_shader)
+    {
+      m_shader.pipelines[m_format] =
+          m_post_processing->CreatePipeline(m_geometry_shader, m_shader.pixel_shader.get(), m_format);
+    }
+    return true;
+  }
+
+  void Retrieve() override
+  {
+    m_pending->shader = std::move(m_shader);
+    m_pending->ready = true;
+  }
+
+private:
+  const PostProcessing* m_post_processing;
+  std::shared_ptr<PendingShader> m_pending;
+  std::string m_name;
+  const AbstractShader* m_geometry_shader;
+  AbstractTextureFormat m_format;
+  CompiledShader m_shader;
+};
+
 bool PostProcessing::Initialize(AbstractTextureFormat format)
 {
   m_framebuffer_format = format;
-  if (!CompileVertexShader() || !CompilePixelShader() || !CompilePipeline())
+  if (!CompileVertexShader())
     return false;
 
-  return true;
+  // The initial shader is compiled right away, so that the first frame is already processed.
+  const std::string& name = g_ActiveConfig.sPostProcessingShader;
+  CompiledShader& shader = m_shaders[name];
+  CompilePixelShader(name, &shader);
+  if (!shader.pixel_shader)
+    return false;
+
+  ActivateShader(&shader);
+  return m_pipeline != nullptr;
 }
 
 void PostProcessing::RecompileShader()
 {
-  m_pipeline.reset();
-  m_pixel_shader.reset();
-  if (!CompilePixelShader())
+  const std::string& name = g_ActiveConfig.sPostProcessingShader;
+  if (m_pending_shader && m_pending_shader_name == name)
     return;
 
-  CompilePipeline();
+  // Any shader which is still being compiled is no longer wanted.
+  m_pending_shader.reset();
+
+  const auto iter = m_shaders.find(name);
+  if (iter != m_shaders.end())
+  {
+    ActivateShader(&iter->second);
+    return;
+  }
+
+  m_pending_shader = std::make_shared<PendingShader>();
+  m_pending_shader_name = name;
+  const AbstractShader* geometry_shader =
+      g_renderer->UseGeometryShaderForUI() ? g_shader_cache->GetTexcoordGeometryShader() : nullptr;
+  g_shader_cache->QueueUtilityWorkItem(AsyncShaderCompiler::CreateWorkItem<ShaderWorkItem>(
+      this, m_pending_shader, name, geometry_shader, m_framebuffer_format));
 }
 
 void PostProcessing::RecompilePipeline()
 {
-  m_pipeline.reset();
-  CompilePipeline();
+  for (auto& shader : m_shaders)
+    shader.second.pipelines.clear();
+  m_pipeline = nullptr;
+
+  // A pending shader's pipeline was created with the old geometry shader, so request it again.
+  if (m_pending_shader)
+  {
+    m_pending_shader.reset();
+    RecompileShader();
+  }
+
+  UpdatePipeline();
+}
+
+void PostProcessing::ActivateShader(CompiledShader* shader)
+{
+  // Keep the option values of the previous shader for when it is selected again.
+  if (m_current_shader)
+    m_current_shader->config = m_config;
+
+  m_current_shader = shader;
+  m_config = shader->config;
+  m_uniform_staging_buffer.resize(CalculateUniformsSize());
+  UpdatePipeline();
+}
+
+void PostProcessing::UpdatePipeline()
+{
+  m_pipeline = nullptr;
+  if (!m_current_shader || !m_current_shader->pixel_shader)
+    return;
+
+  std::unique_ptr<AbstractPipeline>& pipeline = m_current_shader->pipelines[m_framebuffer_format];
+  if (!pipeline)
+  {
+    const AbstractShader* geometry_shader =
+        g_renderer->UseGeometryShaderForUI() ? g_shader_cache->GetTexcoordGeometryShader() :
+                                               nullptr;
+    pipeline = CreatePipeline(geometry_shader, m_current_shader->pixel_shader.get(),
+                              m_framebuffer_format);
+  }
+  m_pipeline = pipeline.get();
 }
 
 void PostProcessing::BlitFromTexture(const MathUtil::Rectangle<int>& dst,
                                      const MathUtil::Rectangle<int>& src,
                                      const AbstractTexture* src_tex, int src_layer)
 {
+  if (m_pending_shader && m_pending_shader->ready)
+  {
+    const auto iter =
+        m_shaders.try_emplace(m_pending_shader_name, std::move(m_pending_shader->shader)).first;
+    m_pending_shader.reset();
+    ActivateShader(&iter->second);
+  }
+
   if (g_renderer->GetCurrentFramebuffer()->GetColorFormat() != m_framebuffer_format)
   {
     m_framebuffer_format = g_renderer->GetCurrentFramebuffer()->GetColorFormat();
-    RecompilePipeline();
+    UpdatePipeline();
   }
 
   if (!m_pipeline)
@@ -426,13 +533,13 @@ void PostProcessing::BlitFromTexture(const MathUtil::Rectangle<int>& dst,
 
   g_renderer->SetViewportAndScissor(
       g_renderer->ConvertFramebufferRectangle(dst, g_renderer->GetCurrentFramebuffer()));
-  g_renderer->SetPipeline(m_pipeline.get());
+  g_renderer->SetPipeline(m_pipeline);
   g_renderer->SetTexture(0, src_tex);
   g_renderer->SetSamplerState(0, RenderState::GetLinearSamplerState());
   g_renderer->Draw(0, 3);
 }
 
-std::string PostProcessing::GetUniformBufferHeader() const
+std::string PostProcessing::GetUniformBufferHeader(const PostProcessingConfiguration& config) const
 {
   std::ostringstream ss;
   u32 unused_counter = 1;
@@ -452,7 +559,7 @@ std::string PostProcessing::GetUniformBufferHeader() const
   ss << "\n";
 
   // Custom options/uniforms
-  for (const auto& it : m_config.GetOptions())
+  for (const auto& it : config.GetOptions())
   {
     if (it.second.m_type ==
         PostProcessingConfiguration::ConfigurationOption::OptionType::OPTION_BOOL)
@@ -491,10 +598,10 @@ std::string PostProcessing::GetUniformBufferHeader() const
   return ss.str();
 }
 
-std::string PostProcessing::GetHeader() const
+std::string PostProcessing::GetHeader(const PostProcessingConfiguration& config) const
 {
   std::ostringstream ss;
-  ss << GetUniformBufferHeader();
+  ss << GetUniformBufferHeader(config);
   if (g_ActiveConfig.backend_info.api_type == APIType::D3D)
   {
     ss << "Texture2DArray samp0 : register(t0);\n";
@@ -608,7 +715,7 @@ void main(in float3 v_tex0_ : TEXCOORD0, out float4 ocol0_ : SV_Target)
 bool PostProcessing::CompileVertexShader()
 {
   std::ostringstream ss;
-  ss << GetUniformBufferHeader();
+  ss << GetUniformBufferHeader(m_config);
 
   if (g_ActiveConfig.backend_info.api_type == APIType::D3D)
   {
@@ -723,47 +830,38 @@ void PostProcessing::FillUniformBuffer(const MathUtil::Rectangle<int>& src,
   }
 }
 
-bool PostProcessing::CompilePixelShader()
+void PostProcessing::CompilePixelShader(const std::string& name, CompiledShader* shader) const
 {
-  m_pipeline.reset();
-  m_pixel_shader.reset();
-
   // Generate GLSL and compile the new shader.
-  m_config.LoadShader(g_ActiveConfig.sPostProcessingShader);
-  m_pixel_shader = g_renderer->CreateShaderFromSource(
-      ShaderStage::Pixel, GetHeader() + m_config.GetShaderCode() + GetFooter());
-  if (!m_pixel_shader)
+  PostProcessingConfiguration& config = shader->config;
+  config.LoadShader(name);
+  shader->pixel_shader = g_renderer->CreateShaderFromSource(
+      ShaderStage::Pixel, GetHeader(config) + config.GetShaderCode() + GetFooter());
+  if (!shader->pixel_shader)
   {
-    PanicAlertFmt("Failed to compile post-processing shader {}", m_config.GetShader());
+    PanicAlertFmt("Failed to compile post-processing shader {}", config.GetShader());
 
     // Use default shader.
-    m_config.LoadDefaultShader();
-    m_pixel_shader = g_renderer->CreateShaderFromSource(
-        ShaderStage::Pixel, GetHeader() + m_config.GetShaderCode() + GetFooter());
-    if (!m_pixel_shader)
-      return false;
+    config.LoadDefaultShader();
+    shader->pixel_shader = g_renderer->CreateShaderFromSource(
+        ShaderStage::Pixel, GetHeader(config) + config.GetShaderCode() + GetFooter());
   }
-
-  m_uniform_staging_buffer.resize(CalculateUniformsSize());
-  return true;
 }
 
-bool PostProcessing::CompilePipeline()
+std::unique_ptr<AbstractPipeline>
+PostProcessing::CreatePipeline(const AbstractShader* geometry_shader,
+                               const AbstractShader* pixel_shader,
+                               AbstractTextureFormat format) const
 {
   AbstractPipelineConfig config = {};
   config.vertex_shader = m_vertex_shader.get();
-  config.geometry_shader =
-      g_renderer->UseGeometryShaderForUI() ? g_shader_cache->GetTexcoordGeometryShader() : nullptr;
-  config.pixel_shader = m_pixel_shader.get();
+  config.geometry_shader = geometry_shader;
+  config.pixel_shader = pixel_shader;
   config.rasterization_state = RenderState::GetNoCullRasterizationState(PrimitiveType::Triangles);
   config.depth_state = RenderState::GetNoDepthTestingDepthState();
   config.blending_state = RenderState::GetNoBlendingBlendState();
-  config.framebuffer_state = RenderState::GetColorFramebufferState(m_framebuffer_format);
+  config.framebuffer_state = RenderState::GetColorFramebufferState(format);
   config.usage = AbstractPipelineUsage::Utility;
-  m_pipeline = g_renderer->CreatePipeline(config);
-  if (!m_pipeline)
-    return false;
-
-  return true;
+  return g_renderer->CreatePipeline(config);
 }
 }  // namespace VideoCommon
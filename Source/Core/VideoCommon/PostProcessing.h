@@ -101,20 +101,47 @@ public:
 
   bool Initialize(AbstractTextureFormat format);
 
+  // Switches to the shader selected in the configuration. Shaders which weren't used before are
+  // compiled in the background, and the current shader stays active until they are ready.
   void RecompileShader();
+  // Recreates the pipelines of all shaders, e.g. after the geometry shader has changed.
   void RecompilePipeline();
 
   void BlitFromTexture(const MathUtil::Rectangle<int>& dst, const MathUtil::Rectangle<int>& src,
                        const AbstractTexture* src_tex, int src_layer);
 
 protected:
-  std::string GetUniformBufferHeader() const;
-  std::string GetHeader() const;
+  // A shader with its options, and its pipelines for each framebuffer format.
+  struct CompiledShader
+  {
+    PostProcessingConfiguration config;
+    std::unique_ptr<AbstractShader> pixel_shader;
+    std::map<AbstractTextureFormat, std::unique_ptr<AbstractPipeline>> pipelines;
+  };
+
+  // Result of a background compile, handed over when the work item is retrieved.
+  struct PendingShader
+  {
+    CompiledShader shader;
+    bool ready = false;
+  };
+
+  class ShaderWorkItem;
+
+  std::string GetUniformBufferHeader(const PostProcessingConfiguration& config) const;
+  std::string GetHeader(const PostProcessingConfiguration& config) const;
   std::string GetFooter() const;
 
   bool CompileVertexShader();
-  bool CompilePixelShader();
-  bool CompilePipeline();
+  // Loads and compiles a shader, falling back to the default shader if it fails to compile.
+  // Can be called from the shader compiler threads.
+  void CompilePixelShader(const std::string& name, CompiledShader* shader) const;
+  std::unique_ptr<AbstractPipeline> CreatePipeline(const AbstractShader* geometry_shader,
+                                                   const AbstractShader* pixel_shader,
+                                                   AbstractTextureFormat format) const;
+  void ActivateShader(CompiledShader* shader);
+  // Looks up or compiles the pipeline of the current shader for the framebuffer format.
+  void UpdatePipeline();
 
   size_t CalculateUniformsSize() const;
   void FillUniformBuffer(const MathUtil::Rectangle<int>& src, const AbstractTexture* src_tex,
@@ -125,9 +152,14 @@ protected:
   PostProcessingConfiguration m_config;
 
   std::unique_ptr<AbstractShader> m_vertex_shader;
-  std::unique_ptr<AbstractShader> m_pixel_shader;
-  std::unique_ptr<AbstractPipeline> m_pipeline;
+  // Shaders which have been used, by name. They are kept around so that switching back to a shader
+  // or between framebuffer formats doesn't recompile anything.
+  std::map<std::string, CompiledShader> m_shaders;
+  CompiledShader* m_current_shader = nullptr;
+  const AbstractPipeline* m_pipeline = nullptr;
   AbstractTextureFormat m_framebuffer_format = AbstractTextureFormat::Undefined;
+  std::string m_pending_shader_name;
+  std::shared_ptr<PendingShader> m_pending_shader;
   std::vector<u8> m_uniform_staging_buffer;
 };
 }  // namespace VideoCommon
@@ -64,6 +64,7 @@
 #include "VideoCommon/FramebufferManager.h"
 #include "VideoCommon/FramebufferShaderGen.h"
 #include "VideoCommon/FreeLookCamera.h"
+#include "VideoCommon/GPUTimingBase.h"
 #include "VideoCommon/NetPlayChatUI.h"
 #include "VideoCommon/NetPlayGolfUI.h"
 #include "VideoCommon/OnScreenDisplay.h"
@@ -189,7 +190,26 @@ u16 Renderer::BBoxRead(int index)
   if (!g_ActiveConfig.bBBoxEnable || !g_ActiveConfig.backend_info.bSupportsBBox)
     return m_bounding_box_fallback[index];
 
-  return BBoxReadImpl(index);
+  if (!g_ActiveConfig.bBBoxDeferReadback)
+    return BBoxReadImpl(index);
+
+  // Read all values at once, as games read all of them in a row.
+  m_bounding_box_read_this_frame = true;
+  if (m_bounding_box_prefetched)
+  {
+    for (int i = 0; i < static_cast<int>(m_bounding_box_deferred.size()); i++)
+      m_bounding_box_deferred[i] = BBoxReadPrefetchedImpl(i);
+    m_bounding_box_prefetched = false;
+    m_bounding_box_deferred_valid = true;
+  }
+  else if (!m_bounding_box_deferred_valid)
+  {
+    for (int i = 0; i < static_cast<int>(m_bounding_box_deferred.size()); i++)
+      m_bounding_box_deferred[i] = BBoxReadImpl(i);
+    m_bounding_box_deferred_valid = true;
+  }
+
+  return m_bounding_box_deferred[index];
 }
 
 void Renderer::BBoxWrite(int index, u16 value)
@@ -357,6 +377,15 @@ bool Renderer::CalculateTargetSize()
     m_efb_scale = g_ActiveConfig.iEFBScale;
   }
 
+  // Dynamic resolution only ever lowers the scale.
+  if (m_dynamic_efb_scale != 0)
+  {
+    if (m_dynamic_efb_scale < m_efb_scale)
+      m_efb_scale = m_dynamic_efb_scale;
+    else
+      m_dynamic_efb_scale = 0;
+  }
+
   const u32 max_size = g_ActiveConfig.backend_info.MaxTextureSize;
   if (max_size < EFB_WIDTH * m_efb_scale)
     m_efb_scale = max_size / EFB_WIDTH;
@@ -375,6 +404,83 @@ bool Renderer::CalculateTargetSize()
   return false;
 }
 
+void Renderer::UpdateDynamicResolution()
+{
+  // Share of the frame time the GPU may spend rendering, leaving room for the CPU and presentation.
+  constexpr float GPU_BUDGET = 0.85f;
+  // Number of consecutive frames over or under budget before the scale is changed. Lowering the
+  // resolution reacts quickly, raising it waits until the headroom is sustained.
+  constexpr u32 FRAMES_BEFORE_LOWERING = 10;
+  constexpr u32 FRAMES_BEFORE_RAISING = 120;
+  // Results arrive a few frames late, so ignore the frames rendered around a change.
+  constexpr u32 COOLDOWN_FRAMES = 30;
+
+  if (!g_ActiveConfig.bDynamicResolution || !g_gpu_timing)
+  {
+    m_dynamic_efb_scale = 0;
+    return;
+  }
+
+  const u64 num_results = g_gpu_timing->GetNumResults();
+  if (num_results == m_dynamic_resolution_last_result)
+    return;
+  m_dynamic_resolution_last_result = num_results;
+
+  if (m_dynamic_resolution_cooldown > 0)
+  {
+    m_dynamic_resolution_cooldown--;
+    return;
+  }
+
+  const double refresh_rate = VideoInterface::GetTargetRefreshRate();
+  if (refresh_rate <= 0.0)
+    return;
+  const float budget_ms = static_cast<float>(1000.0 / refresh_rate) * GPU_BUDGET;
+
+  float gpu_time_ms = 0.0f;
+  const auto& frame_times = g_gpu_timing->GetLastFrameTimes();
+  for (u32 i = 0; i < NUM_GPU_TIMING_CATEGORIES; i++)
+  {
+    if (static_cast<GPUTimingCategory>(i) != GPUTimingCategory::Unattributed)
+      gpu_time_ms += frame_times[i];
+  }
+
+  // Assume the GPU time scales with the number of pixels.
+  const float next_scale_ratio = static_cast<float>(m_efb_scale + 1) / m_efb_scale;
+  const float next_scale_time_ms = gpu_time_ms * next_scale_ratio * next_scale_ratio;
+  if (gpu_time_ms > budget_ms)
+  {
+    m_dynamic_resolution_frames_over++;
+    m_dynamic_resolution_frames_under = 0;
+  }
+  else if (m_dynamic_efb_scale != 0 && next_scale_time_ms < budget_ms)
+  {
+    m_dynamic_resolution_frames_under++;
+    m_dynamic_resolution_frames_over = 0;
+  }
+  else
+  {
+    m_dynamic_resolution_frames_over = 0;
+    m_dynamic_resolution_frames_under = 0;
+  }
+
+  unsigned int new_scale = m_efb_scale;
+  if (m_dynamic_resolution_frames_over >= FRAMES_BEFORE_LOWERING && m_efb_scale > 1)
+    new_scale = m_efb_scale - 1;
+  else if (m_dynamic_resolution_frames_under >= FRAMES_BEFORE_RAISING)
+    new_scale = m_efb_scale + 1;
+
+  if (new_scale == m_efb_scale)
+    return;
+
+  INFO_LOG_FMT(VIDEO, "Dynamic resolution: GPU time {:.2f} ms, budget {:.2f} ms, scale {} -> {}",
+               gpu_time_ms, budget_ms, m_efb_scale, new_scale);
+  m_dynamic_efb_scale = new_scale;
+  m_dynamic_resolution_frames_over = 0;
+  m_dynamic_resolution_frames_under = 0;
+  m_dynamic_resolution_cooldown = COOLDOWN_FRAMES;
+}
+
 std::tuple<MathUtil::Rectangle<int>, MathUtil::Rectangle<int>>
 Renderer::ConvertStereoRectangle(const MathUtil::Rectangle<int>& rc) const
 {
@@ -447,13 +553,9 @@ void Renderer::CheckForConfigChanges()
 
   // Check for post-processing shader changes. Done up here as it doesn't affect anything outside
   // the post-processor. Note that options are applied every frame, so no need to check those.
+  // Shaders are kept around after switching, so there is no need to wait for the GPU here.
   if (m_post_processor->GetConfig()->GetShader() != g_ActiveConfig.sPostProcessingShader)
-  {
-    // The existing shader must not be in use when it's destroyed
-    WaitForGPUIdle();
-
     m_post_processor->RecompileShader();
-  }
 
   // Determine which (if any) settings have changed.
   ShaderHostConfig new_host_config = ShaderHostConfig::GetCurrent();
@@ -1234,6 +1336,27 @@ void Renderer::UpdateWidescreenHeuristic()
   m_was_orthographically_anamorphic = ortho_looks_anamorphic;
 }
 
+bool Renderer::ShouldSkipPresent()
+{
+  // The game keeps running at the same speed, only the frames which are shown are skipped. This
+  // saves the XFB scaling, post-processing, presentation and the wait for the swap chain, but the
+  // frame itself is still rendered, as later EFB copies may depend on it.
+  // The speed is relative to the console, so take the speed limit into account. Without a limit,
+  // anything at or above full speed is fine.
+  const float speed_limit = SConfig::GetInstance().m_EmulationSpeed;
+  const double target_speed = speed_limit > 0.0f ? std::min(speed_limit, 1.0f) : 1.0;
+  if (g_ActiveConfig.iMaxFrameSkip <= 0 || IsFrameDumping() ||
+      m_consecutive_skipped_presents >= static_cast<u32>(g_ActiveConfig.iMaxFrameSkip) ||
+      SystemTimers::GetEstimatedEmulationPerformance() >= target_speed * 0.97)
+  {
+    m_consecutive_skipped_presents = 0;
+    return false;
+  }
+
+  m_consecutive_skipped_presents++;
+  return true;
+}
+
 void Renderer::Swap(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_height, u64 ticks)
 {
   if (SConfig::GetInstance().bWii)
@@ -1255,8 +1378,19 @@ void Renderer::Swap(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_height, u6
       m_is_game_widescreen = true;
   }
 
-  // Ensure the last frame was written to the dump.
-  // This is required even if frame dumping has stopped, since the frame dump is one frame
+  // Start reading back the bounding box of this frame, which is returned to the reads during the
+  // next frame.
+  if (m_bounding_box_read_this_frame && g_ActiveConfig.bBBoxEnable &&
+      g_ActiveConfig.backend_info.bSupportsBBox)
+  {
+    g_vertex_manager->Flush();
+    BBoxPrefetchImpl();
+    m_bounding_box_prefetched = true;
+    m_bounding_box_read_this_frame = false;
+  }
+
+  // Ensure the frames read back in time were written to the dump.
+  // This is required even if frame dumping has stopped, since the frame dump is a few frames
   // behind the renderer.
   FlushFrameDump();
 
@@ -1270,6 +1404,7 @@ void Renderer::Swap(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_height, u6
         (!g_ActiveConfig.bSkipPresentingDuplicateXFBs || xfb_entry->id != m_last_xfb_id))
     {
       const bool is_duplicate_frame = xfb_entry->id == m_last_xfb_id;
+      const bool skip_present = ShouldSkipPresent();
       m_last_xfb_id = xfb_entry->id;
 
       // Since we use the common pipelines here and draw vertices if a batch is currently being
@@ -1288,8 +1423,11 @@ void Renderer::Swap(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_height, u6
 
       // Render the XFB to the screen.
       BeginUtilityDrawing();
-      if (!IsHeadless())
+      if (!IsHeadless() && !skip_present)
       {
+        if (g_gpu_timing)
+          g_gpu_timing->SetCategory(GPUTimingCategory::XFBPresentation);
+
         BindBackbuffer({{0.0f, 0.0f, 0.0f, 1.0f}});
 
         if (!is_duplicate_frame)
@@ -1306,20 +1444,32 @@ void Renderer::Swap(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_height, u6
 
         DrawImGui();
 
+        if (g_gpu_timing)
+          g_gpu_timing->EndFrame();
+
         // Present to the window system.
         {
           std::lock_guard<std::mutex> guard(m_swap_mutex);
+          const u64 present_start = Common::Timer::GetTimeUs();
           PresentBackbuffer();
+          if (g_ActiveConfig.iMaxFramesInFlight > 0)
+            WaitForFramesInFlight(static_cast<u32>(g_ActiveConfig.iMaxFramesInFlight));
+          SETSTAT(g_stats.present_time_us, Common::Timer::GetTimeUs() - present_start);
         }
 
         // Update the window size based on the frame that was just rendered.
         // Due to depending on guest state, we need to call this every frame.
         SetWindowSize(xfb_rect.GetWidth(), xfb_rect.GetHeight());
       }
+      else if (g_gpu_timing)
+      {
+        g_gpu_timing->EndFrame();
+      }
 
       if (!is_duplicate_frame)
       {
         m_fps_counter.Update();
+        SETSTAT(g_stats.frame_time_us, m_fps_counter.GetDeltaTime() * 1000000.0);
 
         DolphinAnalytics::PerformanceSample perf_sample;
         perf_sample.speed_ratio = SystemTimers::GetEstimatedEmulationPerformance();
@@ -1370,6 +1520,7 @@ void Renderer::Swap(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_height, u6
       }
 
       // Handle any config changes, this gets propagated to the backend.
+      UpdateDynamicResolution();
       CheckForConfigChanges();
       g_Config.iSaveTargetId = 0;
 
@@ -1397,6 +1548,7 @@ void Renderer::RenderXFBToScreen(const MathUtil::Rectangle<int>& target_rc,
                                  const AbstractTexture* source_texture,
                                  const MathUtil::Rectangle<int>& source_rc)
 {
+  GPUTimingScope gpu_timing_scope(GPUTimingCategory::PostProcessing);
   if (g_ActiveConfig.stereo_mode == StereoMode::SBS ||
       g_ActiveConfig.stereo_mode == StereoMode::TAB)
   {
@@ -1453,13 +1605,19 @@ void Renderer::DumpCurrentFrame(const AbstractTexture* src_texture,
     copy_rect = src_texture->GetRect();
   }
 
-  if (!CheckFrameDumpReadbackTexture(target_width, target_height))
+  // Make room for this frame if every readback texture is still waiting to be dumped.
+  if (m_frame_dump_readback_pending == FRAME_DUMP_READBACK_FRAMES)
+    DumpOldestReadbackFrame();
+
+  const u32 index =
+      (m_frame_dump_readback_first + m_frame_dump_readback_pending) % FRAME_DUMP_READBACK_FRAMES;
+  if (!CheckFrameDumpReadbackTexture(index, target_width, target_height))
     return;
 
-  m_frame_dump_readback_texture->CopyFromTexture(src_texture, copy_rect, 0, 0,
-                                                 m_frame_dump_readback_texture->GetRect());
-  m_last_frame_state = m_frame_dump.FetchState(ticks, frame_number);
-  m_frame_dump_needs_flush = true;
+  AbstractStagingTexture* rbtex = m_frame_dump_readback_textures[index].get();
+  rbtex->CopyFromTexture(src_texture, copy_rect, 0, 0, rbtex->GetRect());
+  m_frame_dump_readback_states[index] = m_frame_dump.FetchState(ticks, frame_number);
+  m_frame_dump_readback_pending++;
 }
 
 bool Renderer::CheckFrameDumpRenderTexture(u32 target_width, u32 target_height)
@@ -1488,9 +1646,9 @@ bool Renderer::CheckFrameDumpRenderTexture(u32 target_width, u32 target_height)
   return true;
 }
 
-bool Renderer::CheckFrameDumpReadbackTexture(u32 target_width, u32 target_height)
+bool Renderer::CheckFrameDumpReadbackTexture(u32 index, u32 target_width, u32 target_height)
 {
-  std::unique_ptr<AbstractStagingTexture>& rbtex = m_frame_dump_readback_texture;
+  std::unique_ptr<AbstractStagingTexture>& rbtex = m_frame_dump_readback_textures[index];
   if (rbtex && rbtex->GetWidth() == target_width && rbtex->GetHeight() == target_height)
     return true;
 
@@ -1504,40 +1662,54 @@ bool Renderer::CheckFrameDumpReadbackTexture(u32 target_width, u32 target_height
   return true;
 }
 
-void Renderer::FlushFrameDump()
+void Renderer::DumpOldestReadbackFrame()
 {
-  if (!m_frame_dump_needs_flush)
-    return;
-
   // Ensure dumping thread is done with output texture before swapping.
   FinishFrameData();
 
-  std::swap(m_frame_dump_output_texture, m_frame_dump_readback_texture);
+  const u32 index = m_frame_dump_readback_first;
+  std::swap(m_frame_dump_output_texture, m_frame_dump_readback_textures[index]);
+  m_frame_dump_readback_first = (index + 1) % FRAME_DUMP_READBACK_FRAMES;
+  m_frame_dump_readback_pending--;
 
-  // Queue encoding of the last frame dumped.
+  // Queue encoding of the frame.
   auto& output = m_frame_dump_output_texture;
   output->Flush();
   if (output->Map())
   {
     DumpFrameData(reinterpret_cast<u8*>(output->GetMappedPointer()), output->GetConfig().width,
-                  output->GetConfig().height, static_cast<int>(output->GetMappedStride()));
+                  output->GetConfig().height, static_cast<int>(output->GetMappedStride()),
+                  m_frame_dump_readback_states[index]);
   }
   else
   {
     ERROR_LOG_FMT(VIDEO, "Failed to map texture for dumping.");
   }
+}
+
+void Renderer::FlushFrameDump(bool flush_all)
+{
+  if (m_frame_dump_readback_pending == 0)
+    return;
 
-  m_frame_dump_needs_flush = false;
+  // Keep the most recent frames in flight while recording, so that mapping a frame doesn't wait
+  // for the GPU. Screenshots are written as soon as possible.
+  const bool frame_dumping = IsFrameDumping();
+  u32 max_pending_frames = 0;
+  if (!flush_all && frame_dumping && SConfig::GetInstance().m_DumpFrames)
+    max_pending_frames = FRAME_DUMP_READBACK_FRAMES - 1;
+  while (m_frame_dump_readback_pending > max_pending_frames)
+    DumpOldestReadbackFrame();
 
   // Shutdown frame dumping if it is no longer active.
-  if (!IsFrameDumping())
+  if (!frame_dumping)
     ShutdownFrameDumping();
 }
 
 void Renderer::ShutdownFrameDumping()
 {
-  // Ensure the last queued readback has been sent to the encoder.
-  FlushFrameDump();
+  // Ensure the queued readbacks have been sent to the encoder.
+  FlushFrameDump(true);
 
   if (!m_frame_dump_thread_running.IsSet())
     return;
@@ -1553,13 +1725,15 @@ void Renderer::ShutdownFrameDumping()
   m_frame_dump_render_framebuffer.reset();
   m_frame_dump_render_texture.reset();
 
-  m_frame_dump_readback_texture.reset();
+  for (auto& rbtex : m_frame_dump_readback_textures)
+    rbtex.reset();
   m_frame_dump_output_texture.reset();
 }
 
-void Renderer::DumpFrameData(const u8* data, int w, int h, int stride)
+void Renderer::DumpFrameData(const u8* data, int w, int h, int stride,
+                             const FrameDump::FrameState& state)
 {
-  m_frame_dump_data = FrameDump::FrameData{data, w, h, stride, m_last_frame_state};
+  m_frame_dump_data = FrameDump::FrameData{data, w, h, stride, state};
 
   if (!m_frame_dump_thread_running.IsSet())
   {
@@ -1588,6 +1762,7 @@ void Renderer::FinishFrameData()
 void Renderer::FrameDumpThreadFunc()
 {
   Common::SetCurrentThreadName("FrameDumping");
+  Common::SetCurrentThreadRole(Common::ThreadRole::Background);
 
   bool dump_to_ffmpeg = !g_ActiveConfig.bDumpFramesAsImages;
   bool frame_dump_started = false;
@@ -1765,6 +1940,9 @@ void Renderer::DoState(PointerWrap& p)
 
     m_was_orthographically_anamorphic = false;
 
+    m_bounding_box_deferred_valid = false;
+    m_bounding_box_prefetched = false;
+
     // And actually display it.
     Swap(m_last_xfb_addr, m_last_xfb_width, m_last_xfb_stride, m_last_xfb_height, m_last_xfb_ticks);
   }
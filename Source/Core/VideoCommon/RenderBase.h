@@ -123,6 +123,10 @@ public:
   // Presents the backbuffer to the window system, or "swaps buffers".
   virtual void PresentBackbuffer() {}
 
+  // Waits until the GPU has finished rendering all but the last max_frames presented frames,
+  // which bounds the latency between emulating a frame and displaying it.
+  virtual void WaitForFramesInFlight(u32 max_frames) {}
+
   // Shader modules/objects.
   virtual std::unique_ptr<AbstractShader> CreateShaderFromSource(ShaderStage stage,
                                                                  std::string_view source) = 0;
@@ -277,6 +281,12 @@ protected:
 
   std::tuple<int, int> CalculateTargetScale(int x, int y) const;
   bool CalculateTargetSize();
+  // Lowers the EFB scale while the GPU takes longer than a frame to render, and raises it again
+  // once there is enough headroom. Takes effect through CheckForConfigChanges.
+  void UpdateDynamicResolution();
+  // Returns whether presenting the current frame should be skipped to catch up, as long as
+  // emulation is below full speed.
+  bool ShouldSkipPresent();
 
   void CheckForConfigChanges();
 
@@ -303,6 +313,10 @@ protected:
   virtual u16 BBoxReadImpl(int index) = 0;
   virtual void BBoxWriteImpl(int index, u16 value) = 0;
   virtual void BBoxFlushImpl() {}
+  // Starts reading back all bounding box values without waiting for the GPU. Backends which
+  // don't implement it read the current values in BBoxReadPrefetchedImpl instead.
+  virtual void BBoxPrefetchImpl() {}
+  virtual u16 BBoxReadPrefetchedImpl(int index) { return BBoxReadImpl(index); }
 
   AbstractFramebuffer* m_current_framebuffer = nullptr;
   const AbstractPipeline* m_current_pipeline = nullptr;
@@ -349,6 +363,15 @@ private:
   PixelFormat m_prev_efb_format = PixelFormat::INVALID_FMT;
   unsigned int m_efb_scale = 1;
 
+  // Upper bound for the EFB scale set by dynamic resolution, 0 if the configured scale is used.
+  unsigned int m_dynamic_efb_scale = 0;
+  u64 m_dynamic_resolution_last_result = 0;
+  u32 m_dynamic_resolution_frames_over = 0;
+  u32 m_dynamic_resolution_frames_under = 0;
+  u32 m_dynamic_resolution_cooldown = 0;
+
+  u32 m_consecutive_skipped_presents = 0;
+
   // These will be set on the first call to SetWindowSize.
   int m_last_window_request_width = 0;
   int m_last_window_request_height = 0;
@@ -364,9 +387,6 @@ private:
   // Set by frame dump thread on frame completion.
   Common::Event m_frame_dump_done;
 
-  // Holds emulation state during the last swap when dumping.
-  FrameDump::FrameState m_last_frame_state;
-
   // Communication of frame between video and dump threads.
   FrameDump::FrameData m_frame_dump_data;
 
@@ -374,11 +394,19 @@ private:
   std::unique_ptr<AbstractTexture> m_frame_dump_render_texture;
   std::unique_ptr<AbstractFramebuffer> m_frame_dump_render_framebuffer;
 
-  // Double buffer:
-  std::unique_ptr<AbstractStagingTexture> m_frame_dump_readback_texture;
+  // Frames are read back through a ring of staging textures, so a frame is only mapped for
+  // encoding a few frames after its copy was queued, once the GPU is done with it.
+  static constexpr u32 FRAME_DUMP_READBACK_FRAMES = 3;
+  std::array<std::unique_ptr<AbstractStagingTexture>, FRAME_DUMP_READBACK_FRAMES>
+      m_frame_dump_readback_textures;
+  // Emulation state of the frames held by the readback textures.
+  std::array<FrameDump::FrameState, FRAME_DUMP_READBACK_FRAMES> m_frame_dump_readback_states;
+  // Index of the oldest readback texture holding a frame that needs to be dumped.
+  u32 m_frame_dump_readback_first = 0;
+  // Number of readback textures holding a frame that needs to be dumped.
+  u32 m_frame_dump_readback_pending = 0;
+  // Texture that is mapped while the thread encodes it.
   std::unique_ptr<AbstractStagingTexture> m_frame_dump_output_texture;
-  // Set when readback texture holds a frame that needs to be dumped.
-  bool m_frame_dump_needs_flush = false;
   // Set when thread is processing output texture.
   bool m_frame_dump_frame_running = false;
 
@@ -405,6 +433,12 @@ private:
   // Ultimate Spider-Man to crash
   std::array<u16, 4> m_bounding_box_fallback = {};
 
+  // The values returned by bounding box reads when deferring the readback to the end of frame.
+  std::array<u16, 4> m_bounding_box_deferred = {};
+  bool m_bounding_box_deferred_valid = false;
+  bool m_bounding_box_prefetched = false;
+  bool m_bounding_box_read_this_frame = false;
+
   // NOTE: The methods below are called on the framedumping thread.
   void FrameDumpThreadFunc();
   bool StartFrameDumpToFFMPEG(const FrameDump::FrameData&);
@@ -421,18 +455,22 @@ private:
   // Checks that the frame dump render texture exists and is the correct size.
   bool CheckFrameDumpRenderTexture(u32 target_width, u32 target_height);
 
-  // Checks that the frame dump readback texture exists and is the correct size.
-  bool CheckFrameDumpReadbackTexture(u32 target_width, u32 target_height);
+  // Checks that the specified frame dump readback texture exists and is the correct size.
+  bool CheckFrameDumpReadbackTexture(u32 index, u32 target_width, u32 target_height);
 
   // Fills the frame dump staging texture with the current XFB texture.
   void DumpCurrentFrame(const AbstractTexture* src_texture,
                         const MathUtil::Rectangle<int>& src_rect, u64 ticks, int frame_number);
 
   // Asynchronously encodes the specified pointer of frame data to the frame dump.
-  void DumpFrameData(const u8* data, int w, int h, int stride);
+  void DumpFrameData(const u8* data, int w, int h, int stride, const FrameDump::FrameState& state);
+
+  // Queues the oldest frame held by the readback textures for encoding.
+  void DumpOldestReadbackFrame();
 
-  // Ensures all rendered frames are queued for encoding.
-  void FlushFrameDump();
+  // Queues the frames whose readback has had time to complete for encoding. All rendered frames
+  // are queued when flush_all is set, or when frame dumping is no longer active.
+  void FlushFrameDump(bool flush_all = false);
 
   // Ensures all encoded frames have been written to the output file.
   void FinishFrameData();
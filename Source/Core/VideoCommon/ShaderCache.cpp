@@ -3,9 +3,12 @@
 
 #include "VideoCommon/ShaderCache.h"
 
+#include <algorithm>
+
 #include "Common/Assert.h"
 #include "Common/FileUtil.h"
 #include "Common/MsgHandler.h"
+#include "Common/Timer.h"
 #include "Core/ConfigManager.h"
 
 #include "VideoCommon/FramebufferManager.h"
@@ -23,6 +26,8 @@ std::unique_ptr<VideoCommon::ShaderCache> g_shader_cache;
 
 namespace VideoCommon
 {
+constexpr u32 PIPELINE_UID_CACHE_MAGIC = 0x44495550;  // PUID
+
 ShaderCache::ShaderCache() : m_api_type{APIType::Nothing}
 {
 }
@@ -95,6 +100,12 @@ void ShaderCache::Reload()
 void ShaderCache::RetrieveAsyncShaders()
 {
   m_async_shader_compiler->RetrieveWorkItems();
+  SETSTAT(g_stats.num_pending_shader_compiles, m_async_shader_compiler->GetPendingWorkCount());
+}
+
+void ShaderCache::QueueUtilityWorkItem(AsyncShaderCompiler::WorkItemPtr item)
+{
+  m_async_shader_compiler->QueueWorkItem(std::move(item), COMPILE_PRIORITY_ONDEMAND_PIPELINE);
 }
 
 void ShaderCache::Shutdown()
@@ -109,15 +120,19 @@ void ShaderCache::Shutdown()
 
 const AbstractPipeline* ShaderCache::GetPipelineForUid(const GXPipelineUid& uid)
 {
-  auto it = m_gx_pipeline_cache.find(uid);
-  if (it != m_gx_pipeline_cache.end() && !it->second.second)
-    return it->second.first.get();
+  const PipelineCacheEntry* entry = m_gx_pipeline_cache.Find(uid);
+  if (entry && !entry->second)
+    return entry->first.get();
 
-  const bool exists_in_cache = it != m_gx_pipeline_cache.end();
+  const bool exists_in_cache = entry != nullptr;
+  const u64 start_time = Common::Timer::GetTimeUs();
   std::unique_ptr<AbstractPipeline> pipeline;
   std::optional<AbstractPipelineConfig> pipeline_config = GetGXPipelineConfig(uid);
   if (pipeline_config)
     pipeline = g_renderer->CreatePipeline(*pipeline_config);
+  const u64 stall_time = Common::Timer::GetTimeUs() - start_time;
+  RecordCompileStall(stall_time);
+  m_gx_pipeline_stalls[uid] += stall_time;
   if (g_ActiveConfig.bShaderCache && !exists_in_cache)
     AppendGXPipelineUID(uid);
   return InsertGXPipeline(uid, std::move(pipeline));
@@ -125,14 +140,14 @@ const AbstractPipeline* ShaderCache::GetPipelineForUid(const GXPipelineUid& uid)
 
 std::optional<const AbstractPipeline*> ShaderCache::GetPipelineForUidAsync(const GXPipelineUid& uid)
 {
-  auto it = m_gx_pipeline_cache.find(uid);
-  if (it != m_gx_pipeline_cache.end())
+  if (const PipelineCacheEntry* entry = m_gx_pipeline_cache.Find(uid))
   {
     // .second is the pending flag, i.e. compiling in the background.
-    if (!it->second.second)
-      return it->second.first.get();
-    else
-      return {};
+    if (!entry->second)
+      return entry->first.get();
+
+    PromotePipelineCompile(uid);
+    return {};
   }
 
   AppendGXPipelineUID(uid);
@@ -142,17 +157,35 @@ std::optional<const AbstractPipeline*> ShaderCache::GetPipelineForUidAsync(const
 
 const AbstractPipeline* ShaderCache::GetUberPipelineForUid(const GXUberPipelineUid& uid)
 {
-  auto it = m_gx_uber_pipeline_cache.find(uid);
-  if (it != m_gx_uber_pipeline_cache.end() && !it->second.second)
-    return it->second.first.get();
+  const PipelineCacheEntry* entry = m_gx_uber_pipeline_cache.Find(uid);
+  if (entry && !entry->second)
+    return entry->first.get();
 
+  const u64 start_time = Common::Timer::GetTimeUs();
   std::unique_ptr<AbstractPipeline> pipeline;
   std::optional<AbstractPipelineConfig> pipeline_config = GetGXPipelineConfig(uid);
   if (pipeline_config)
     pipeline = g_renderer->CreatePipeline(*pipeline_config);
+  RecordCompileStall(Common::Timer::GetTimeUs() - start_time);
   return InsertGXUberPipeline(uid, std::move(pipeline));
 }
 
+std::optional<const AbstractPipeline*>
+ShaderCache::GetPartialUberPipelineForUidAsync(const GXUberPipelineUid& uid)
+{
+  if (const PipelineCacheEntry* entry = m_gx_uber_pipeline_cache.Find(uid))
+  {
+    // .second is the pending flag, i.e. compiling in the background.
+    if (!entry->second)
+      return entry->first.get();
+    else
+      return {};
+  }
+
+  QueueUberPipelineCompile(uid, COMPILE_PRIORITY_PARTIAL_UBERSHADER_PIPELINE);
+  return {};
+}
+
 void ShaderCache::WaitForAsyncCompiler()
 {
   while (m_async_shader_compiler->HasPendingWork() || m_async_shader_compiler->HasCompletedWork())
@@ -274,7 +307,7 @@ void ShaderCache::LoadPipelineCache(T& cache, LinearDiskCache<DiskKeyType, u8>&
       UnserializePipelineUid(key, real_uid);
 
       // Skip those which are already compiled.
-      if (failed || cache.find(real_uid) != cache.end())
+      if (failed || cache.Contains(real_uid))
         return;
 
       auto config = this_ptr->GetGXPipelineConfig(real_uid);
@@ -326,11 +359,10 @@ void ShaderCache::ClearPipelineCache(T& cache, Y& disk_cache)
   disk_cache.Close();
 
   // Set the pending flag to false, and destroy the pipeline.
-  for (auto& it : cache)
-  {
-    it.second.first.reset();
-    it.second.second = false;
-  }
+  cache.ForEach([](const auto&, auto& entry) {
+    entry.first.reset();
+    entry.second = false;
+  });
 }
 
 void ShaderCache::LoadCaches()
@@ -367,6 +399,7 @@ void ShaderCache::LoadCaches()
 
 void ShaderCache::ClearCaches()
 {
+  m_pending_pipelines.clear();
   ClearPipelineCache(m_gx_pipeline_cache, m_gx_pipeline_disk_cache);
   ClearShaderCache(m_vs_cache);
   ClearShaderCache(m_gs_cache);
@@ -401,17 +434,34 @@ void ShaderCache::ClearCaches()
 
 void ShaderCache::CompileMissingPipelines()
 {
-  // Queue all uids with a null pipeline for compilation.
-  for (auto& it : m_gx_pipeline_cache)
+  // Queue all uids with a null pipeline for compilation. Work items with the same priority are
+  // compiled in the order they were queued, so the pipelines from the UID cache are queued in the
+  // order the game first used them. When not waiting for the compiler before starting, the
+  // pipelines needed at boot then become available first.
+  for (const GXPipelineUid& uid : m_gx_pipeline_uid_order)
   {
-    if (!it.second.first)
-      QueuePipelineCompile(it.first, COMPILE_PRIORITY_SHADERCACHE_PIPELINE);
-  }
-  for (auto& it : m_gx_uber_pipeline_cache)
-  {
-    if (!it.second.first)
-      QueueUberPipelineCompile(it.first, COMPILE_PRIORITY_UBERSHADER_PIPELINE);
+    const PipelineCacheEntry* entry = m_gx_pipeline_cache.Find(uid);
+    if (entry && !entry->first && !entry->second)
+      QueuePipelineCompile(uid, COMPILE_PRIORITY_SHADERCACHE_PIPELINE);
   }
+
+  // Queueing a compile updates the pending flag in the map, which can't be done while iterating.
+  std::vector<GXPipelineUid> missing_pipelines;
+  m_gx_pipeline_cache.ForEach([&](const GXPipelineUid& uid, const PipelineCacheEntry& entry) {
+    if (!entry.first && !entry.second)
+      missing_pipelines.push_back(uid);
+  });
+  for (const GXPipelineUid& uid : missing_pipelines)
+    QueuePipelineCompile(uid, COMPILE_PRIORITY_SHADERCACHE_PIPELINE);
+
+  std::vector<GXUberPipelineUid> missing_uber_pipelines;
+  m_gx_uber_pipeline_cache.ForEach(
+      [&](const GXUberPipelineUid& uid, const PipelineCacheEntry& entry) {
+        if (!entry.first)
+          missing_uber_pipelines.push_back(uid);
+      });
+  for (const GXUberPipelineUid& uid : missing_uber_pipelines)
+    QueueUberPipelineCompile(uid, COMPILE_PRIORITY_UBERSHADER_PIPELINE);
 }
 
 std::unique_ptr<AbstractShader> ShaderCache::CompileVertexShader(const VertexShaderUid& uid) const
@@ -723,10 +773,10 @@ ShaderCache::InsertGXUberPipeline(const GXUberPipelineUid& config,
 
 void ShaderCache::LoadPipelineUIDCache()
 {
-  constexpr u32 CACHE_FILE_MAGIC = 0x44495550;  // PUID
   constexpr size_t CACHE_HEADER_SIZE = sizeof(u32) + sizeof(u32);
   std::string filename =
       File::GetUserPath(D_CACHE_IDX) + SConfig::GetInstance().GetGameID() + ".uidcache";
+  m_gx_pipeline_uid_order.clear();
   if (m_gx_pipeline_uid_cache_file.Open(filename, "rb+"))
   {
     // If an existing case exists, validate the version before reading entries.
@@ -735,7 +785,7 @@ void ShaderCache::LoadPipelineUIDCache()
     bool uid_file_valid = false;
     if (m_gx_pipeline_uid_cache_file.ReadBytes(&existing_magic, sizeof(existing_magic)) &&
         m_gx_pipeline_uid_cache_file.ReadBytes(&existing_version, sizeof(existing_version)) &&
-        existing_magic == CACHE_FILE_MAGIC && existing_version == GX_PIPELINE_UID_VERSION)
+        existing_magic == PIPELINE_UID_CACHE_MAGIC && existing_version == GX_PIPELINE_UID_VERSION)
     {
       // Ensure the expected size matches the actual size of the file. If it doesn't, it means
       // the cache file may be corrupted, and we should not proceed with loading potentially
@@ -779,25 +829,72 @@ void ShaderCache::LoadPipelineUIDCache()
     if (m_gx_pipeline_uid_cache_file.Open(filename, "wb"))
     {
       // Write the version identifier.
-      m_gx_pipeline_uid_cache_file.WriteBytes(&CACHE_FILE_MAGIC, sizeof(GX_PIPELINE_UID_VERSION));
+      m_gx_pipeline_uid_cache_file.WriteBytes(&PIPELINE_UID_CACHE_MAGIC,
+                                              sizeof(PIPELINE_UID_CACHE_MAGIC));
       m_gx_pipeline_uid_cache_file.WriteBytes(&GX_PIPELINE_UID_VERSION,
                                               sizeof(GX_PIPELINE_UID_VERSION));
 
       // Write any current UIDs out to the file.
       // This way, if we load a UID cache where the data was incomplete (e.g. Dolphin crashed),
       // we don't lose the existing UIDs which were previously at the beginning.
-      for (const auto& it : m_gx_pipeline_cache)
-        AppendGXPipelineUID(it.first);
+      m_gx_pipeline_cache.ForEach(
+          [this](const GXPipelineUid& uid, const PipelineCacheEntry&) { AppendGXPipelineUID(uid); });
     }
   }
 
-  INFO_LOG_FMT(VIDEO, "Read {} pipeline UIDs from {}", m_gx_pipeline_cache.size(), filename);
+  INFO_LOG_FMT(VIDEO, "Read {} pipeline UIDs from {}", m_gx_pipeline_cache.Size(), filename);
 }
 
 void ShaderCache::ClosePipelineUIDCache()
 {
-  // This is left as a method in case we need to append extra data to the file in the future.
   m_gx_pipeline_uid_cache_file.Close();
+
+  if (g_ActiveConfig.bExportPipelineStalls)
+    ExportPipelineStalls();
+}
+
+void ShaderCache::RecordCompileStall(u64 time_us)
+{
+  INCSTAT(g_stats.this_frame.num_pipeline_compile_stalls);
+  ADDSTAT(g_stats.this_frame.pipeline_compile_stall_us, static_cast<int>(time_us));
+}
+
+void ShaderCache::ExportPipelineStalls()
+{
+  if (m_gx_pipeline_stalls.empty())
+    return;
+
+  // Written in the same format as the UID cache, longest stall first, so that the list can be
+  // used to prioritize precompiling the pipelines which hurt the most.
+  std::vector<std::pair<u64, const GXPipelineUid*>> stalls;
+  stalls.reserve(m_gx_pipeline_stalls.size());
+  for (const auto& [uid, time_us] : m_gx_pipeline_stalls)
+    stalls.emplace_back(time_us, &uid);
+  std::stable_sort(stalls.begin(), stalls.end(),
+                   [](const auto& lhs, const auto& rhs) { return lhs.first > rhs.first; });
+
+  const std::string filename =
+      File::GetUserPath(D_CACHE_IDX) + SConfig::GetInstance().GetGameID() + ".stalls.uidcache";
+  File::IOFile file(filename, "wb");
+  if (!file.WriteBytes(&PIPELINE_UID_CACHE_MAGIC, sizeof(PIPELINE_UID_CACHE_MAGIC)) ||
+      !file.WriteBytes(&GX_PIPELINE_UID_VERSION, sizeof(GX_PIPELINE_UID_VERSION)))
+  {
+    WARN_LOG_FMT(VIDEO, "Failed to write pipeline stalls to {}", filename);
+    return;
+  }
+
+  for (const auto& stall : stalls)
+  {
+    SerializedGXPipelineUid disk_uid;
+    SerializePipelineUid(*stall.second, disk_uid);
+    if (!file.WriteBytes(&disk_uid, sizeof(disk_uid)))
+    {
+      WARN_LOG_FMT(VIDEO, "Failed to write pipeline stalls to {}", filename);
+      return;
+    }
+  }
+
+  INFO_LOG_FMT(VIDEO, "Wrote {} stalled pipeline UIDs to {}", stalls.size(), filename);
 }
 
 void ShaderCache::AddSerializedGXPipelineUID(const SerializedGXPipelineUid& uid)
@@ -805,13 +902,9 @@ void ShaderCache::AddSerializedGXPipelineUID(const SerializedGXPipelineUid& uid)
   GXPipelineUid real_uid;
   UnserializePipelineUid(uid, real_uid);
 
-  auto iter = m_gx_pipeline_cache.find(real_uid);
-  if (iter != m_gx_pipeline_cache.end())
-    return;
-
   // Flag it as empty with a null pipeline object, for later compilation.
-  auto& entry = m_gx_pipeline_cache[real_uid];
-  entry.second = false;
+  if (m_gx_pipeline_cache.TryEmplace(real_uid).second)
+    m_gx_pipeline_uid_order.push_back(real_uid);
 }
 
 void ShaderCache::AppendGXPipelineUID(const GXPipelineUid& config)
@@ -852,8 +945,10 @@ void ShaderCache::QueueVertexShaderCompile(const VertexShaderUid& uid, u32 prior
     VertexShaderUid uid;
   };
 
-  m_vs_cache.shader_map[uid].pending = true;
+  auto& entry = m_vs_cache.shader_map[uid];
   auto wi = m_async_shader_compiler->CreateWorkItem<VertexShaderWorkItem>(this, uid);
+  entry.pending = true;
+  entry.work_item = wi.get();
   m_async_shader_compiler->QueueWorkItem(std::move(wi), priority);
 }
 
@@ -910,8 +1005,10 @@ void ShaderCache::QueuePixelShaderCompile(const PixelShaderUid& uid, u32 priorit
     PixelShaderUid uid;
   };
 
-  m_ps_cache.shader_map[uid].pending = true;
+  auto& entry = m_ps_cache.shader_map[uid];
   auto wi = m_async_shader_compiler->CreateWorkItem<PixelShaderWorkItem>(this, uid);
+  entry.pending = true;
+  entry.work_item = wi.get();
   m_async_shader_compiler->QueueWorkItem(std::move(wi), priority);
 }
 
@@ -989,14 +1086,15 @@ void ShaderCache::QueuePipelineCompile(const GXPipelineUid& uid, u32 priority)
     {
       if (stages_ready)
       {
+        shader_cache->m_pending_pipelines.erase(uid);
         shader_cache->InsertGXPipeline(uid, std::move(pipeline));
       }
       else
       {
-        // Re-queue for next frame.
-        auto wi = shader_cache->m_async_shader_compiler->CreateWorkItem<PipelineWorkItem>(
-            shader_cache, uid, priority);
-        shader_cache->m_async_shader_compiler->QueueWorkItem(std::move(wi), priority);
+        // Re-queue for next frame, with the priority it may have been promoted to since.
+        auto it = shader_cache->m_pending_pipelines.find(uid);
+        shader_cache->QueuePipelineCompile(
+            uid, it != shader_cache->m_pending_pipelines.end() ? it->second.priority : priority);
       }
     }
 
@@ -1010,10 +1108,38 @@ void ShaderCache::QueuePipelineCompile(const GXPipelineUid& uid, u32 priority)
   };
 
   auto wi = m_async_shader_compiler->CreateWorkItem<PipelineWorkItem>(this, uid, priority);
+  m_pending_pipelines[uid] = {wi.get(), priority};
   m_async_shader_compiler->QueueWorkItem(std::move(wi), priority);
   m_gx_pipeline_cache[uid].second = true;
 }
 
+void ShaderCache::PromotePipelineCompile(const GXPipelineUid& uid)
+{
+  auto it = m_pending_pipelines.find(uid);
+  if (it == m_pending_pipelines.end() ||
+      it->second.priority <= COMPILE_PRIORITY_ONDEMAND_PIPELINE)
+  {
+    return;
+  }
+  it->second.priority = COMPILE_PRIORITY_ONDEMAND_PIPELINE;
+
+  const auto promote = [this](const AsyncShaderCompiler::WorkItem* work_item) {
+    if (m_async_shader_compiler->PromoteWorkItem(work_item, COMPILE_PRIORITY_ONDEMAND_PIPELINE))
+      INCSTAT(g_stats.num_promoted_shader_compiles);
+  };
+  const auto promote_shader = [&promote](auto& cache, const auto& shader_uid) {
+    auto shader_it = cache.shader_map.find(shader_uid);
+    if (shader_it != cache.shader_map.end() && shader_it->second.pending)
+      promote(shader_it->second.work_item);
+  };
+
+  promote_shader(m_vs_cache, uid.vs_uid);
+  PixelShaderUid ps_uid = uid.ps_uid;
+  ClearUnusedPixelShaderUidBits(m_api_type, m_host_config, &ps_uid);
+  promote_shader(m_ps_cache, ps_uid);
+  promote(it->second.work_item);
+}
+
 void ShaderCache::QueueUberPipelineCompile(const GXUberPipelineUid& uid, u32 priority)
 {
   class UberPipelineWorkItem final : public AsyncShaderCompiler::WorkItem
@@ -1117,12 +1243,7 @@ void ShaderCache::QueueUberShaderPipelines()
       config.blending_state.logicmode = LogicOp::And;
     }
 
-    auto iter = m_gx_uber_pipeline_cache.find(config);
-    if (iter != m_gx_uber_pipeline_cache.end())
-      return;
-
-    auto& entry = m_gx_uber_pipeline_cache[config];
-    entry.second = false;
+    m_gx_uber_pipeline_cache.TryEmplace(config);
   };
 
   // Populate the pipeline configs with empty entries, these will be compiled afterwards.
@@ -12,8 +12,10 @@
 #include <string>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Common/FlatHashMap.h"
 #include "Common/IOFile.h"
 #include "Common/LinearDiskCache.h"
 
@@ -65,6 +67,10 @@ public:
   const AbstractPipeline* GetPipelineForUid(const GXPipelineUid& uid);
   const AbstractPipeline* GetUberPipelineForUid(const GXUberPipelineUid& uid);
 
+  // Gets a partial ubershader pipeline, queueing it for compilation if it doesn't exist yet.
+  std::optional<const AbstractPipeline*>
+  GetPartialUberPipelineForUidAsync(const GXUberPipelineUid& uid);
+
   // Accesses ShaderGen shader caches asynchronously.
   // The optional will be empty if this pipeline is now background compiling.
   std::optional<const AbstractPipeline*> GetPipelineForUidAsync(const GXPipelineUid& uid);
@@ -112,6 +118,10 @@ public:
   // Texture decoding compute shaders
   const AbstractShader* GetTextureDecodingShader(TextureFormat format, TLUTFormat palette_format);
 
+  // Compiles shaders which aren't part of the cache, such as post-processing shaders, on the
+  // shader compiler threads. The item is retrieved along with the cache's own shaders.
+  void QueueUtilityWorkItem(AsyncShaderCompiler::WorkItemPtr item);
+
 private:
   static constexpr size_t NUM_PALETTE_CONVERSION_SHADERS = 3;
 
@@ -120,6 +130,8 @@ private:
   void ClearCaches();
   void LoadPipelineUIDCache();
   void ClosePipelineUIDCache();
+  void RecordCompileStall(u64 time_us);
+  void ExportPipelineStalls();
   void CompileMissingPipelines();
   void QueueUberShaderPipelines();
   bool CompileSharedPipelines();
@@ -166,6 +178,9 @@ private:
   void QueuePixelShaderCompile(const PixelShaderUid& uid, u32 priority);
   void QueuePixelUberShaderCompile(const UberShader::PixelShaderUid& uid, u32 priority);
   void QueuePipelineCompile(const GXPipelineUid& uid, u32 priority);
+  // Moves a pending pipeline and its shaders ahead of the background compiles, as it is needed to
+  // draw right now.
+  void PromotePipelineCompile(const GXPipelineUid& uid);
   void QueueUberPipelineCompile(const GXUberPipelineUid& uid, u32 priority);
 
   // Populating various caches.
@@ -186,6 +201,7 @@ private:
   enum : u32
   {
     COMPILE_PRIORITY_ONDEMAND_PIPELINE = 100,
+    COMPILE_PRIORITY_PARTIAL_UBERSHADER_PIPELINE = 150,
     COMPILE_PRIORITY_UBERSHADER_PIPELINE = 200,
     COMPILE_PRIORITY_SHADERCACHE_PIPELINE = 300
   };
@@ -212,6 +228,8 @@ private:
     {
       std::unique_ptr<AbstractShader> shader;
       bool pending;
+      // The queued work item while pending, for promoting it.
+      const AsyncShaderCompiler::WorkItem* work_item = nullptr;
     };
     std::map<Uid, Shader> shader_map;
     LinearDiskCache<Uid, u8> disk_cache;
@@ -223,10 +241,24 @@ private:
   ShaderModuleCache<UberShader::PixelShaderUid> m_uber_ps_cache;
 
   // GX Pipeline Caches - .first - pipeline, .second - pending
-  std::map<GXPipelineUid, std::pair<std::unique_ptr<AbstractPipeline>, bool>> m_gx_pipeline_cache;
-  std::map<GXUberPipelineUid, std::pair<std::unique_ptr<AbstractPipeline>, bool>>
+  // These are looked up whenever the pipeline state changes, so they are hash maps.
+  using PipelineCacheEntry = std::pair<std::unique_ptr<AbstractPipeline>, bool>;
+  Common::FlatHashMap<GXPipelineUid, PipelineCacheEntry, GXPipelineUidHash<GXPipelineUid>>
+      m_gx_pipeline_cache;
+  Common::FlatHashMap<GXUberPipelineUid, PipelineCacheEntry, GXPipelineUidHash<GXUberPipelineUid>>
       m_gx_uber_pipeline_cache;
   File::IOFile m_gx_pipeline_uid_cache_file;
+  // The UIDs read from the UID cache, in the order they were first used by the game.
+  std::vector<GXPipelineUid> m_gx_pipeline_uid_order;
+  // Total time each pipeline blocked emulation while it was compiled, in microseconds.
+  std::map<GXPipelineUid, u64> m_gx_pipeline_stalls;
+
+  struct PendingPipeline
+  {
+    const AsyncShaderCompiler::WorkItem* work_item;
+    u32 priority;
+  };
+  std::map<GXPipelineUid, PendingPipeline> m_pending_pipelines;
   LinearDiskCache<SerializedGXPipelineUid, u8> m_gx_pipeline_disk_cache;
   LinearDiskCache<SerializedGXUberPipelineUid, u8> m_gx_uber_pipeline_disk_cache;
 
@@ -3,10 +3,13 @@
 
 #include "VideoCommon/Statistics.h"
 
+#include <string>
 #include <utility>
 
+#include <fmt/format.h>
 #include <imgui.h>
 
+#include "VideoCommon/GPUTimingBase.h"
 #include "VideoCommon/VideoCommon.h"
 #include "VideoCommon/VideoConfig.h"
 
@@ -14,6 +17,9 @@ Statistics g_stats;
 
 void Statistics::ResetFrame()
 {
+  if (this_frame.num_ubershader_draws > 0)
+    num_ubershader_fallback_frames++;
+
   this_frame = {};
 }
 
@@ -60,14 +66,41 @@ void Statistics::Display() const
     draw_statistic("TEV Pix Out", "%d", this_frame.tev_pixels_out);
   }
 
+  draw_statistic("Frame time", "%.2f ms", frame_time_us / 1000.0f);
+  draw_statistic("Present time", "%.2f ms", present_time_us / 1000.0f);
+  if (g_gpu_timing && g_gpu_timing->HasResults())
+  {
+    const auto& gpu_times = g_gpu_timing->GetLastFrameTimes();
+    float total_gpu_time = 0.0f;
+    for (u32 i = 1; i < NUM_GPU_TIMING_CATEGORIES; i++)
+      total_gpu_time += gpu_times[i];
+
+    draw_statistic("GPU time", "%.2f ms", total_gpu_time);
+    for (u32 i = 1; i < NUM_GPU_TIMING_CATEGORIES; i++)
+    {
+      const std::string name =
+          fmt::format("  {}", GetGPUTimingCategoryName(static_cast<GPUTimingCategory>(i)));
+      draw_statistic(name.c_str(), "%.2f ms", gpu_times[i]);
+    }
+  }
   draw_statistic("Textures created", "%d", num_textures_created);
   draw_statistic("Textures uploaded", "%d", num_textures_uploaded);
   draw_statistic("Textures alive", "%d", num_textures_alive);
+  draw_statistic("Textures pooled", "%d", num_textures_pooled);
+  draw_statistic("Texture pool hits", "%d", this_frame.num_texture_pool_hits);
+  draw_statistic("Texture pool misses", "%d", this_frame.num_texture_pool_misses);
   draw_statistic("pshaders created", "%d", num_pixel_shaders_created);
   draw_statistic("pshaders alive", "%d", num_pixel_shaders_alive);
   draw_statistic("vshaders created", "%d", num_vertex_shaders_created);
   draw_statistic("vshaders alive", "%d", num_vertex_shaders_alive);
   draw_statistic("shaders changes", "%d", this_frame.num_shader_changes);
+  draw_statistic("pending shader compiles", "%d", num_pending_shader_compiles);
+  draw_statistic("promoted shader compiles", "%d", num_promoted_shader_compiles);
+  draw_statistic("Pipeline compile stalls", "%d (%.2f ms)", this_frame.num_pipeline_compile_stalls,
+                 this_frame.pipeline_compile_stall_us / 1000.0f);
+  draw_statistic("Ubershader draws", "%d", this_frame.num_ubershader_draws);
+  draw_statistic("Ubershader fallback frames", "%d", num_ubershader_fallback_frames);
+  draw_statistic("Skipped draws", "%d", this_frame.num_skipped_draws);
   draw_statistic("dlists called", "%d", this_frame.num_dlists_called);
   draw_statistic("Primitive joins", "%d", this_frame.num_primitive_joins);
   draw_statistic("Draw calls", "%d", this_frame.num_draw_calls);
@@ -85,6 +118,7 @@ void Statistics::Display() const
   draw_statistic("Vertex Loaders", "%d", num_vertex_loaders);
   draw_statistic("EFB peeks:", "%d", this_frame.num_efb_peeks);
   draw_statistic("EFB pokes:", "%d", this_frame.num_efb_pokes);
+  draw_statistic("Render passes", "%d", this_frame.num_render_passes);
 
   ImGui::Columns(1);
 
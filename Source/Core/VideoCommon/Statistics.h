@@ -15,9 +15,21 @@ struct Statistics
   int num_textures_created;
   int num_textures_uploaded;
   int num_textures_alive;
+  int num_textures_pooled;
 
   int num_vertex_loaders;
 
+  int num_pending_shader_compiles;
+  int num_promoted_shader_compiles;
+
+  // Frames which drew anything with ubershaders while waiting for specialized shaders.
+  int num_ubershader_fallback_frames;
+
+  // Time between the last two presented frames, and the part of the last one spent presenting
+  // and waiting for the GPU to catch up.
+  int frame_time_us;
+  int present_time_us;
+
   std::array<float, 6> proj;
   std::array<float, 16> gproj;
   std::array<float, 16> g2proj;
@@ -58,6 +70,17 @@ struct Statistics
 
     int num_efb_peeks;
     int num_efb_pokes;
+
+    int num_render_passes;
+
+    int num_texture_pool_hits;
+    int num_texture_pool_misses;
+
+    // Pipelines compiled on the GPU thread, blocking emulation until they were ready.
+    int num_pipeline_compile_stalls;
+    int pipeline_compile_stall_us;
+    int num_ubershader_draws;
+    int num_skipped_draws;
   };
   ThisFrame this_frame;
   void ResetFrame();
@@ -6,6 +6,7 @@
 #include <algorithm>
 #include <cmath>
 #include <cstring>
+#include <future>
 #include <memory>
 #include <string>
 #include <utility>
@@ -22,9 +23,11 @@
 #include "Common/CommonTypes.h"
 #include "Common/FileUtil.h"
 #include "Common/Hash.h"
+#include "Common/Image.h"
 #include "Common/Logging/Log.h"
 #include "Common/MathUtil.h"
 #include "Common/MemoryUtil.h"
+#include "Common/Profiler.h"
 
 #include "Core/Config/GraphicsSettings.h"
 #include "Core/ConfigManager.h"
@@ -36,6 +39,7 @@
 #include "VideoCommon/AbstractStagingTexture.h"
 #include "VideoCommon/BPMemory.h"
 #include "VideoCommon/FramebufferManager.h"
+#include "VideoCommon/GPUTimingBase.h"
 #include "VideoCommon/HiresTextures.h"
 #include "VideoCommon/OpcodeDecoding.h"
 #include "VideoCommon/PixelShaderManager.h"
@@ -54,9 +58,17 @@ static const u64 TEXHASH_INVALID = 0;
 // Sonic the Fighters (inside Sonic Gems Collection) loops a 64 frames animation
 static const int TEXTURE_KILL_THRESHOLD = 64;
 static const int TEXTURE_POOL_KILL_THRESHOLD = 3;
+// Upper bound for the staging memory of the texture readbacks in flight when saving a state
+static const size_t SAVE_STATE_READBACK_BATCH_SIZE = 128 * 1024 * 1024;
 
 std::unique_ptr<TextureCacheBase> g_texture_cache;
 
+static Common::Hash64Function GetHash64Function(TextureHashMode mode)
+{
+  return mode == TextureHashMode::Full ? Common::Hash64Function::XXH3 :
+                                         Common::Hash64Function::Default;
+}
+
 std::bitset<8> TextureCacheBase::valid_bind_points;
 
 TextureCacheBase::TCacheEntry::TCacheEntry(std::unique_ptr<AbstractTexture> tex,
@@ -93,7 +105,10 @@ TextureCacheBase::TextureCacheBase()
 
   HiresTexture::Init();
 
-  Common::SetHash64Function();
+  Common::SetHash64Function(GetHash64Function(backup_config.texture_hash_mode));
+
+  if (backup_config.texture_decoder_threads != 0)
+    m_texture_decoder_pool.Start(backup_config.texture_decoder_threads, "Texture Decoder");
 
   InvalidateAllBindPoints();
 }
@@ -103,6 +118,11 @@ TextureCacheBase::~TextureCacheBase()
   // Clear pending EFB copies first, so we don't try to flush them.
   m_pending_efb_copies.clear();
 
+  m_texture_decoder_pool.Stop();
+
+  ProcessTextureDumps(true);
+  m_texture_dump_pool.Stop();
+
   HiresTexture::Shutdown();
   Invalidate();
   Common::FreeAlignedMemory(temp);
@@ -134,6 +154,9 @@ void TextureCacheBase::Invalidate()
   textures_by_hash.clear();
 
   texture_pool.clear();
+  m_texture_pool_memory = 0;
+
+  m_arbitrary_mipmap_cache.clear();
 }
 
 void TextureCacheBase::ForceReload()
@@ -150,22 +173,34 @@ void TextureCacheBase::ForceReload()
 void TextureCacheBase::OnConfigChanged(const VideoConfig& config)
 {
   if (config.bHiresTextures != backup_config.hires_textures ||
-      config.bCacheHiresTextures != backup_config.cache_hires_textures)
+      config.bCacheHiresTextures != backup_config.cache_hires_textures ||
+      config.iHiresTextureCacheSize != backup_config.hires_texture_cache_size)
   {
     HiresTexture::Update();
   }
 
   // TODO: Invalidating texcache is really stupid in some of these cases
   if (config.iSafeTextureCache_ColorSamples != backup_config.color_samples ||
+      config.texture_hash_mode != backup_config.texture_hash_mode ||
       config.bTexFmtOverlayEnable != backup_config.texfmt_overlay ||
       config.bTexFmtOverlayCenter != backup_config.texfmt_overlay_center ||
       config.bHiresTextures != backup_config.hires_textures ||
       config.bEnableGPUTextureDecoding != backup_config.gpu_texture_decoding ||
       config.bDisableCopyToVRAM != backup_config.disable_vram_copies ||
-      config.bArbitraryMipmapDetection != backup_config.arbitrary_mipmap_detection)
+      config.bArbitraryMipmapDetection != backup_config.arbitrary_mipmap_detection ||
+      config.fArbitraryMipmapDetectionThreshold !=
+          backup_config.arbitrary_mipmap_detection_threshold)
   {
     Invalidate();
     TexDecoder_SetTexFmtOverlayOptions(config.bTexFmtOverlayEnable, config.bTexFmtOverlayCenter);
+    Common::SetHash64Function(GetHash64Function(config.texture_hash_mode));
+  }
+
+  if (config.GetTextureDecoderThreads() != backup_config.texture_decoder_threads)
+  {
+    m_texture_decoder_pool.Stop();
+    if (config.GetTextureDecoderThreads() != 0)
+      m_texture_decoder_pool.Start(config.GetTextureDecoderThreads(), "Texture Decoder");
   }
 
   SetBackupConfig(config);
@@ -215,23 +250,47 @@ void TextureCacheBase::Cleanup(int _frameCount)
     }
   }
 
-  TexPool::iterator iter2 = texture_pool.begin();
-  TexPool::iterator tcend2 = texture_pool.end();
-  while (iter2 != tcend2)
+  CleanupTexturePool(_frameCount);
+
+  m_texture_dump_frame++;
+  ProcessTextureDumps(false);
+}
+
+void TextureCacheBase::CleanupTexturePool(int frame_count)
+{
+  // With a pool size configured, textures are kept regardless of their age, so games cycling
+  // through many render target sizes don't keep recreating them.
+  const size_t max_pool_memory = static_cast<size_t>(std::max(g_ActiveConfig.iTexturePoolSize, 0))
+                                 << 20;
+  TexPool::iterator iter = texture_pool.begin();
+  TexPool::iterator tcend = texture_pool.end();
+  while (iter != tcend)
   {
-    if (iter2->second.frameCount == FRAMECOUNT_INVALID)
+    if (iter->second.frameCount == FRAMECOUNT_INVALID)
     {
-      iter2->second.frameCount = _frameCount;
+      iter->second.frameCount = frame_count;
     }
-    if (_frameCount > TEXTURE_POOL_KILL_THRESHOLD + iter2->second.frameCount)
+    if (max_pool_memory == 0 && frame_count > TEXTURE_POOL_KILL_THRESHOLD + iter->second.frameCount)
     {
-      iter2 = texture_pool.erase(iter2);
+      m_texture_pool_memory -= iter->second.texture->GetConfig().GetMemorySize();
+      iter = texture_pool.erase(iter);
     }
     else
     {
-      ++iter2;
+      ++iter;
     }
   }
+
+  while (max_pool_memory != 0 && m_texture_pool_memory > max_pool_memory)
+  {
+    const auto oldest = std::min_element(
+        texture_pool.begin(), texture_pool.end(),
+        [](const auto& a, const auto& b) { return a.second.frameCount < b.second.frameCount; });
+    m_texture_pool_memory -= oldest->second.texture->GetConfig().GetMemorySize();
+    texture_pool.erase(oldest);
+  }
+
+  SETSTAT(g_stats.num_textures_pooled, static_cast<int>(texture_pool.size()));
 }
 
 bool TextureCacheBase::TCacheEntry::OverlapsMemoryRange(u32 range_address, u32 range_size) const
@@ -248,20 +307,25 @@ bool TextureCacheBase::TCacheEntry::OverlapsMemoryRange(u32 range_address, u32 r
 void TextureCacheBase::SetBackupConfig(const VideoConfig& config)
 {
   backup_config.color_samples = config.iSafeTextureCache_ColorSamples;
+  backup_config.texture_hash_mode = config.texture_hash_mode;
   backup_config.texfmt_overlay = config.bTexFmtOverlayEnable;
   backup_config.texfmt_overlay_center = config.bTexFmtOverlayCenter;
   backup_config.hires_textures = config.bHiresTextures;
   backup_config.cache_hires_textures = config.bCacheHiresTextures;
+  backup_config.hires_texture_cache_size = config.iHiresTextureCacheSize;
   backup_config.stereo_3d = config.stereo_mode != StereoMode::Off;
   backup_config.efb_mono_depth = config.bStereoEFBMonoDepth;
   backup_config.gpu_texture_decoding = config.bEnableGPUTextureDecoding;
   backup_config.disable_vram_copies = config.bDisableCopyToVRAM;
   backup_config.arbitrary_mipmap_detection = config.bArbitraryMipmapDetection;
+  backup_config.arbitrary_mipmap_detection_threshold = config.fArbitraryMipmapDetectionThreshold;
+  backup_config.texture_decoder_threads = config.GetTextureDecoderThreads();
 }
 
 TextureCacheBase::TCacheEntry*
 TextureCacheBase::ApplyPaletteToEntry(TCacheEntry* entry, const u8* palette, TLUTFormat tlutfmt)
 {
+  GPUTimingScope gpu_timing_scope(GPUTimingCategory::TextureConversion);
   DEBUG_ASSERT(g_ActiveConfig.backend_info.bSupportsPaletteConversion);
 
   const AbstractPipeline* pipeline = g_shader_cache->GetPaletteConversionPipeline(tlutfmt);
@@ -332,6 +396,7 @@ TextureCacheBase::ApplyPaletteToEntry(TCacheEntry* entry, const u8* palette, TLU
 TextureCacheBase::TCacheEntry* TextureCacheBase::ReinterpretEntry(const TCacheEntry* existing_entry,
                                                                   TextureFormat new_format)
 {
+  GPUTimingScope gpu_timing_scope(GPUTimingCategory::TextureConversion);
   const AbstractPipeline* pipeline =
       g_shader_cache->GetTextureReinterpretPipeline(existing_entry->format.texfmt, new_format);
   if (!pipeline)
@@ -409,9 +474,7 @@ void TextureCacheBase::ScaleTextureCacheEntryTo(TextureCacheBase::TCacheEntry* e
 
   // At this point new_texture has the old texture in it,
   // we can potentially reuse this, so let's move it back to the pool
-  auto config = new_texture->texture->GetConfig();
-  texture_pool.emplace(
-      config, TexPoolEntry(std::move(new_texture->texture), std::move(new_texture->framebuffer)));
+  ReleaseToPool(std::move(*new_texture));
 }
 
 bool TextureCacheBase::CheckReadbackTexture(u32 width, u32 height, AbstractTextureFormat format)
@@ -430,14 +493,42 @@ bool TextureCacheBase::CheckReadbackTexture(u32 width, u32 height, AbstractTextu
   return m_readback_texture != nullptr;
 }
 
+TextureCacheBase::TextureReadback
+TextureCacheBase::BeginTextureReadback(AbstractTexture* tex, const TextureConfig& config)
+{
+  TextureReadback readback;
+  readback.reserve(config.layers * config.levels);
+  for (u32 layer = 0; layer < config.layers; layer++)
+  {
+    for (u32 level = 0; level < config.levels; level++)
+    {
+      const auto rect = tex->GetConfig().GetMipRect(level);
+      const TextureConfig staging_config(rect.GetWidth(), rect.GetHeight(), 1, 1, 1,
+                                         config.format, 0);
+      auto staging_texture =
+          g_renderer->CreateStagingTexture(StagingTextureType::Readback, staging_config);
+      if (!staging_texture)
+        return {};
+
+      staging_texture->CopyFromTexture(tex, rect, layer, level, rect);
+      readback.push_back(std::move(staging_texture));
+    }
+  }
+  return readback;
+}
+
 void TextureCacheBase::SerializeTexture(AbstractTexture* tex, const TextureConfig& config,
-                                        PointerWrap& p)
+                                        PointerWrap& p, TextureReadback* readback)
 {
   // If we're in measure mode, skip the actual readback to save some time.
   const bool skip_readback = p.GetMode() == PointerWrap::MODE_MEASURE;
   p.DoPOD(config);
 
-  if (skip_readback || CheckReadbackTexture(config.width, config.height, config.format))
+  if (readback && readback->empty())
+    readback = nullptr;
+
+  if (skip_readback || readback ||
+      CheckReadbackTexture(config.width, config.height, config.format))
   {
     // First, measure the amount of memory needed.
     u32 total_size = 0;
@@ -461,7 +552,8 @@ void TextureCacheBase::SerializeTexture(AbstractTexture* tex, const TextureConfi
     // needing to allocate/free an extra buffer.
     u8* texture_data = p.DoExternal(total_size);
 
-    if (!skip_readback)
+    // The mode changes to measuring if the textures don't fit into the buffer.
+    if (p.GetMode() != PointerWrap::MODE_MEASURE)
     {
       // Save out each layer of the texture to the pointer.
       for (u32 layer = 0; layer < config.layers; layer++)
@@ -471,11 +563,18 @@ void TextureCacheBase::SerializeTexture(AbstractTexture* tex, const TextureConfi
           u32 level_width = std::max(config.width >> level, 1u);
           u32 level_height = std::max(config.height >> level, 1u);
           auto rect = tex->GetConfig().GetMipRect(level);
-          m_readback_texture->CopyFromTexture(tex, rect, layer, level, rect);
-
           u32 stride = AbstractTexture::CalculateStrideForFormat(config.format, level_width);
           u32 size = stride * level_height;
-          m_readback_texture->ReadTexels(rect, texture_data, stride);
+
+          if (readback)
+          {
+            (*readback)[layer * config.levels + level]->ReadTexels(rect, texture_data, stride);
+          }
+          else
+          {
+            m_readback_texture->CopyFromTexture(tex, rect, layer, level, rect);
+            m_readback_texture->ReadTexels(rect, texture_data, stride);
+          }
 
           texture_data += size;
         }
@@ -537,6 +636,7 @@ void TextureCacheBase::DoState(PointerWrap& p)
   FlushEFBCopies();
 
   p.Do(last_entry_id);
+  m_has_direct_scanout_xfb = false;
 
   if (p.GetMode() == PointerWrap::MODE_WRITE || p.GetMode() == PointerWrap::MODE_MEASURE)
     DoSaveState(p);
@@ -596,11 +696,29 @@ void TextureCacheBase::DoSaveState(PointerWrap& p)
   }
 
   // Save the texture cache entries out in the order the were referenced.
+  // When writing, the readbacks are started a batch at a time, so that the GPU is only waited for
+  // once per batch while the amount of staging memory stays bounded.
   u32 size = static_cast<u32>(entries_to_save.size());
   p.Do(size);
-  for (TCacheEntry* entry : entries_to_save)
+  std::vector<TextureReadback> readbacks(entries_to_save.size());
+  size_t readback_end = 0;
+  for (size_t i = 0; i < entries_to_save.size(); i++)
   {
-    SerializeTexture(entry->texture.get(), entry->texture->GetConfig(), p);
+    TCacheEntry* entry = entries_to_save[i];
+    if (p.GetMode() == PointerWrap::MODE_WRITE && readback_end == i)
+    {
+      size_t batch_size = 0;
+      while (readback_end < entries_to_save.size() && batch_size < SAVE_STATE_READBACK_BATCH_SIZE)
+      {
+        AbstractTexture* texture = entries_to_save[readback_end]->texture.get();
+        readbacks[readback_end++] = BeginTextureReadback(texture, texture->GetConfig());
+        batch_size += texture->GetWidth() * texture->GetHeight() * texture->GetLayers() *
+                      AbstractTexture::GetTexelSizeForFormat(texture->GetFormat());
+      }
+    }
+
+    SerializeTexture(entry->texture.get(), entry->texture->GetConfig(), p, &readbacks[i]);
+    readbacks[i].clear();
     entry->DoState(p);
   }
   p.DoMarker("TextureCacheEntries");
@@ -960,11 +1078,65 @@ void TextureCacheBase::DumpTexture(TCacheEntry* entry, std::string basename, uns
       return;
   }
 
-  const std::string filename = fmt::format("{}/{}.png", szDir, basename);
-  if (File::Exists(filename))
+  std::string filename = fmt::format("{}/{}.png", szDir, basename);
+  if (!m_dumped_textures.insert(filename).second || File::Exists(filename))
+    return;
+
+  QueueTextureDump(entry->texture.get(), level, std::move(filename));
+}
+
+void TextureCacheBase::QueueTextureDump(const AbstractTexture* texture, u32 level,
+                                        std::string filename)
+{
+  // Compressed textures can't be read back as RGBA8. These are only used for custom textures,
+  // which aren't dumped.
+  const TextureConfig& config = texture->GetConfig();
+  if (AbstractTexture::IsCompressedFormat(config.format) || level >= config.levels)
+    return;
+
+  const u32 level_width = std::max(1u, config.width >> level);
+  const u32 level_height = std::max(1u, config.height >> level);
+  auto readback_texture = g_renderer->CreateStagingTexture(
+      StagingTextureType::Readback,
+      TextureConfig(level_width, level_height, 1, 1, 1, AbstractTextureFormat::RGBA8, 0));
+  if (!readback_texture)
     return;
 
-  entry->texture->Save(filename, level);
+  readback_texture->CopyFromTexture(texture, 0, level);
+  m_pending_texture_dumps.push_back(
+      {std::move(readback_texture), std::move(filename), m_texture_dump_frame});
+}
+
+void TextureCacheBase::ProcessTextureDumps(bool wait)
+{
+  auto iter = m_pending_texture_dumps.begin();
+  for (; iter != m_pending_texture_dumps.end(); ++iter)
+  {
+    // Give the GPU a frame to finish the copy. Dumps are queued in order, so everything after
+    // this one is newer.
+    if (!wait && iter->frame + 1 >= m_texture_dump_frame)
+      break;
+
+    AbstractStagingTexture* readback_texture = iter->readback_texture.get();
+    readback_texture->Flush();
+    if (!readback_texture->Map())
+      continue;
+
+    const u32 width = readback_texture->GetWidth();
+    const u32 height = readback_texture->GetHeight();
+    const size_t stride = readback_texture->GetMappedStride();
+    std::vector<u8> data(stride * height);
+    std::memcpy(data.data(), readback_texture->GetMappedPointer(), data.size());
+
+    if (!m_texture_dump_pool.IsRunning())
+      m_texture_dump_pool.Start(1, "Texture Dumper", Common::ThreadRole::Background);
+    m_texture_dump_pool.Submit(
+        [filename = std::move(iter->filename), data = std::move(data), width, height, stride] {
+          Common::SavePNG(filename, data.data(), Common::ImageByteFormat::RGBA, width, height,
+                          static_cast<int>(stride));
+        });
+  }
+  m_pending_texture_dumps.erase(m_pending_texture_dumps.begin(), iter);
 }
 
 static void SetSamplerState(u32 index, float custom_tex_scale, bool custom_tex,
@@ -1057,12 +1229,14 @@ public:
     levels.push_back({{width, height, row_length}, buffer});
   }
 
-  bool HasArbitraryMipmaps(u8* downsample_buffer) const
+  bool NeedsDetection() const
   {
-    if (levels.size() < 2)
-      return false;
+    return levels.size() >= 2 && g_ActiveConfig.bArbitraryMipmapDetection;
+  }
 
-    if (!g_ActiveConfig.bArbitraryMipmapDetection)
+  bool HasArbitraryMipmaps(u8* downsample_buffer) const
+  {
+    if (!NeedsDetection())
       return false;
 
     // This is the average per-pixel, per-channel difference in percent between what we
@@ -1128,7 +1302,41 @@ private:
     {
       for (u32 i = 0; i < dst_shape.height; ++i)
       {
-        for (u32 j = 0; j < dst_shape.width; ++j)
+        u32 j = 0;
+#if defined(_M_X86) || defined(_M_X86_64)
+        // Four destination pixels at a time, from two rows of eight source pixels.
+        const __m128i rounding = _mm_set1_epi16(2);
+        const __m128i zero = _mm_setzero_si128();
+        for (; j + 4 <= dst_shape.width; j += 4)
+        {
+          const u8* row0 = src + (j * 2 + i * 2 * src_shape.row_length) * 4;
+          const u8* row1 = row0 + src_shape.row_length * 4;
+          const __m128i a0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row0));
+          const __m128i a1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row0 + 16));
+          const __m128i b0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row1));
+          const __m128i b1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row1 + 16));
+
+          // Vertical sums of source pixels 0-1, 2-3, 4-5 and 6-7, with 16 bits per channel.
+          const __m128i s01 =
+              _mm_add_epi16(_mm_unpacklo_epi8(a0, zero), _mm_unpacklo_epi8(b0, zero));
+          const __m128i s23 =
+              _mm_add_epi16(_mm_unpackhi_epi8(a0, zero), _mm_unpackhi_epi8(b0, zero));
+          const __m128i s45 =
+              _mm_add_epi16(_mm_unpacklo_epi8(a1, zero), _mm_unpacklo_epi8(b1, zero));
+          const __m128i s67 =
+              _mm_add_epi16(_mm_unpackhi_epi8(a1, zero), _mm_unpackhi_epi8(b1, zero));
+
+          // Add horizontally neighbouring pixels, then round and divide by four.
+          __m128i d01 = _mm_add_epi16(_mm_unpacklo_epi64(s01, s23), _mm_unpackhi_epi64(s01, s23));
+          __m128i d23 = _mm_add_epi16(_mm_unpacklo_epi64(s45, s67), _mm_unpackhi_epi64(s45, s67));
+          d01 = _mm_srli_epi16(_mm_add_epi16(d01, rounding), 2);
+          d23 = _mm_srli_epi16(_mm_add_epi16(d23, rounding), 2);
+
+          auto* dst_pixels = dst + (j + i * dst_shape.row_length) * 4;
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(dst_pixels), _mm_packus_epi16(d01, d23));
+        }
+#endif
+        for (; j < dst_shape.width; ++j)
         {
           auto x = j * 2;
           auto y = i * 2;
@@ -1164,7 +1372,26 @@ private:
       {
         const auto* row1 = ptr1;
         const auto* row2 = ptr2;
-        for (u32 j = 0; j < shape.width; ++j, row1 += 4, row2 += 4)
+        u32 j = 0;
+#if defined(_M_X86) || defined(_M_X86_64)
+        // Four pixels at a time. The squared differences of a row fit in 32 bits per lane.
+        const __m128i zero = _mm_setzero_si128();
+        __m128i row_sum = _mm_setzero_si128();
+        for (; j + 4 <= shape.width; j += 4, row1 += 16, row2 += 16)
+        {
+          const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row1));
+          const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row2));
+          const __m128i abs_diff = _mm_or_si128(_mm_subs_epu8(a, b), _mm_subs_epu8(b, a));
+          const __m128i lo = _mm_unpacklo_epi8(abs_diff, zero);
+          const __m128i hi = _mm_unpackhi_epi8(abs_diff, zero);
+          row_sum = _mm_add_epi32(row_sum, _mm_madd_epi16(lo, lo));
+          row_sum = _mm_add_epi32(row_sum, _mm_madd_epi16(hi, hi));
+        }
+        alignas(16) std::array<u32, 4> lanes;
+        _mm_store_si128(reinterpret_cast<__m128i*>(lanes.data()), row_sum);
+        current_diff_sum += u64(lanes[0]) + lanes[1] + lanes[2] + lanes[3];
+#endif
+        for (; j < shape.width; ++j, row1 += 4, row2 += 4)
         {
           int pixel_diff = 0;
           for (int channel = 0; channel < 4; channel++)
@@ -1190,6 +1417,8 @@ private:
 
 TextureCacheBase::TCacheEntry* TextureCacheBase::Load(const u32 stage)
 {
+  PROFILE("TextureCache::Load");
+
   // if this stage was not invalidated by changes to texture registers, keep the current texture
   if (IsValidBindPoint(stage) && bound_textures[stage])
   {
@@ -1198,7 +1427,7 @@ TextureCacheBase::TCacheEntry* TextureCacheBase::Load(const u32 stage)
 
   TextureInfo texture_info = TextureInfo::FromStage(stage);
 
-  auto entry = GetTexture(g_ActiveConfig.iSafeTextureCache_ColorSamples, texture_info);
+  auto entry = GetTexture(g_ActiveConfig.GetTextureHashSamples(), texture_info);
 
   if (!entry)
     return nullptr;
@@ -1255,6 +1484,10 @@ TextureCacheBase::GetTexture(const int textureCacheSafetyColorSampleSize, Textur
         texture_info.GetRawAddress(), texture_info.GetFullLevelSize(), MemoryUpdate::TEXTURE_MAP);
   }
 
+  // Lazy EFB copies may not have been written to the memory we are about to hash yet.
+  if (g_ActiveConfig.bLazyEFBCopies && !m_pending_efb_copies.empty() && !texture_info.IsFromTmem())
+    FlushEFBCopiesInRange(texture_info.GetRawAddress(), texture_info.GetFullLevelSize());
+
   // TODO: This doesn't hash GB tiles for preloaded RGBA8 textures (instead, it's hashing more data
   // from the low tmem bank than it should)
   base_hash = Common::GetHash64(texture_info.GetData(), texture_info.GetTextureSize(),
@@ -1405,6 +1638,14 @@ TextureCacheBase::GetTexture(const int textureCacheSafetyColorSampleSize, Textur
           entry->native_width == texture_info.GetRawWidth() &&
           entry->native_height == texture_info.GetRawHeight())
       {
+        // Replace the native texture once its custom texture has finished loading.
+        if (!entry->pending_custom_texture.empty() &&
+            HiresTexture::IsLoaded(entry->pending_custom_texture))
+        {
+          iter = InvalidateTexture(iter);
+          continue;
+        }
+
         entry = DoPartialTextureUpdates(iter->second, texture_info.GetTlutAddress(),
                                         texture_info.GetTlutFormat());
         entry->texture->FinishedRendering();
@@ -1471,7 +1712,9 @@ TextureCacheBase::GetTexture(const int textureCacheSafetyColorSampleSize, Textur
       // All parameters, except the address, need to match here
       if (entry->format == full_format && entry->native_levels >= texture_info.GetLevelCount() &&
           entry->native_width == texture_info.GetRawWidth() &&
-          entry->native_height == texture_info.GetRawHeight())
+          entry->native_height == texture_info.GetRawHeight() &&
+          (entry->pending_custom_texture.empty() ||
+           !HiresTexture::IsLoaded(entry->pending_custom_texture)))
       {
         entry = DoPartialTextureUpdates(hash_iter->second, texture_info.GetTlutAddress(),
                                         texture_info.GetTlutFormat());
@@ -1490,9 +1733,10 @@ TextureCacheBase::GetTexture(const int textureCacheSafetyColorSampleSize, Textur
   }
 
   std::shared_ptr<HiresTexture> hires_tex;
+  std::string pending_custom_texture;
   if (g_ActiveConfig.bHiresTextures)
   {
-    hires_tex = HiresTexture::Search(texture_info);
+    hires_tex = HiresTexture::Search(texture_info, &pending_custom_texture);
 
     if (hires_tex)
     {
@@ -1511,13 +1755,7 @@ TextureCacheBase::GetTexture(const int textureCacheSafetyColorSampleSize, Textur
   const u32 texLevels = hires_tex ? (u32)hires_tex->m_levels.size() : texture_info.GetLevelCount();
 
   // We can decode on the GPU if it is a supported format and the flag is enabled.
-  // Currently we don't decode RGBA8 textures from Tmem, as that would require copying from both
-  // banks, and if we're doing an copy we may as well just do the whole thing on the CPU, since
-  // there's no conversion between formats. In the future this could be extended with a separate
-  // shader, however.
-  const bool decode_on_gpu =
-      !hires_tex && g_ActiveConfig.UseGPUTextureDecoding() &&
-      !(texture_info.IsFromTmem() && texture_info.GetTextureFormat() == TextureFormat::RGBA8);
+  const bool decode_on_gpu = !hires_tex && g_ActiveConfig.UseGPUTextureDecoding();
 
   // create the entry/texture
   const TextureConfig config(width, height, texLevels, 1, 1,
@@ -1527,6 +1765,7 @@ TextureCacheBase::GetTexture(const int textureCacheSafetyColorSampleSize, Textur
     return nullptr;
 
   ArbitraryMipmapDetector arbitrary_mip_detector;
+  u64 mip_hash = 0;
   if (hires_tex)
   {
     const auto& level = hires_tex->m_levels[0];
@@ -1537,10 +1776,30 @@ TextureCacheBase::GetTexture(const int textureCacheSafetyColorSampleSize, Textur
   // Initialized to null because only software loading uses this buffer
   u8* dst_buffer = nullptr;
 
+  // Large textures are decoded on the worker threads. The mipmaps are decoded in the background
+  // while the base level is decoded and uploaded, and each mipmap is uploaded once it is ready.
+  constexpr u32 MIN_PARALLEL_DECODE_TEXELS = 256 * 256;
+  const bool decode_in_parallel = !decode_on_gpu && m_texture_decoder_pool.IsRunning() &&
+                                  expanded_width * expanded_height >= MIN_PARALLEL_DECODE_TEXELS;
+  std::vector<std::future<void>> mip_decodes;
+
   if (!hires_tex)
   {
+    // RGBA8 textures from Tmem are split across both banks. Interleaving them again is just a
+    // copy, after which the regular RGBA8 decoding shader can be used.
+    const u8* gpu_decode_data = texture_info.GetData();
+    if (decode_on_gpu && texture_info.IsFromTmem() &&
+        texture_info.GetTextureFormat() == TextureFormat::RGBA8)
+    {
+      m_tmem_rgba8_buffer.resize(texture_info.GetTextureSize());
+      TexDecoder_ReassembleRGBA8FromTmem(m_tmem_rgba8_buffer.data(), texture_info.GetData(),
+                                         texture_info.GetTmemOddAddress(), expanded_width,
+                                         expanded_height);
+      gpu_decode_data = m_tmem_rgba8_buffer.data();
+    }
+
     if (!decode_on_gpu ||
-        !DecodeTextureOnGPU(entry, 0, texture_info.GetData(), texture_info.GetTextureSize(),
+        !DecodeTextureOnGPU(entry, 0, gpu_decode_data, texture_info.GetTextureSize(),
                             texture_info.GetTextureFormat(), width, height, expanded_width,
                             expanded_height,
                             bytes_per_block * (expanded_width / texture_info.GetBlockWidth()),
@@ -1566,11 +1825,41 @@ TextureCacheBase::GetTexture(const int textureCacheSafetyColorSampleSize, Textur
 
       CheckTempSize(total_texture_size);
       dst_buffer = temp;
+
+      if (decode_in_parallel && texLevels > 1)
+      {
+        mip_decodes.resize(texLevels);
+        u8* mip_dst = dst_buffer + decoded_texture_size;
+        for (u32 level = 1; level != texLevels; ++level)
+        {
+          auto mip_level = texture_info.GetMipMapLevel(level - 1);
+          if (!mip_level)
+            continue;
+
+          mip_decodes[level] = m_texture_decoder_pool.Submit([mip_dst, mip_level, &texture_info] {
+            TexDecoder_Decode(mip_dst, mip_level->GetData(), mip_level->GetExpandedWidth(),
+                              mip_level->GetExpandedHeight(), texture_info.GetTextureFormat(),
+                              texture_info.GetTlutAddress(), texture_info.GetTlutFormat());
+          });
+          mip_dst += mip_level->GetExpandedWidth() * sizeof(u32) * mip_level->GetExpandedHeight();
+        }
+      }
+
       if (!(texture_info.GetTextureFormat() == TextureFormat::RGBA8 && texture_info.IsFromTmem()))
       {
-        TexDecoder_Decode(dst_buffer, texture_info.GetData(), expanded_width, expanded_height,
-                          texture_info.GetTextureFormat(), texture_info.GetTlutAddress(),
-                          texture_info.GetTlutFormat());
+        if (decode_in_parallel)
+        {
+          TexDecoder_DecodeParallel(m_texture_decoder_pool, dst_buffer, texture_info.GetData(),
+                                    expanded_width, expanded_height,
+                                    texture_info.GetTextureFormat(), texture_info.GetTlutAddress(),
+                                    texture_info.GetTlutFormat());
+        }
+        else
+        {
+          TexDecoder_Decode(dst_buffer, texture_info.GetData(), expanded_width, expanded_height,
+                            texture_info.GetTextureFormat(), texture_info.GetTlutAddress(),
+                            texture_info.GetTlutFormat());
+        }
       }
       else
       {
@@ -1601,6 +1890,7 @@ TextureCacheBase::GetTexture(const int textureCacheSafetyColorSampleSize, Textur
                        texture_info.GetLevelCount());
   entry->SetHashes(base_hash, full_hash);
   entry->is_custom_tex = hires_tex != nullptr;
+  entry->pending_custom_texture = std::move(pending_custom_texture);
   entry->memory_stride = entry->BytesPerRow();
   entry->SetNotCopy();
 
@@ -1627,6 +1917,15 @@ TextureCacheBase::GetTexture(const int textureCacheSafetyColorSampleSize, Textur
       if (!mip_level)
         continue;
 
+      // The texture hash only covers the first level, so the mipmaps are hashed separately to
+      // look up the result of the arbitrary mipmap detection.
+      if (g_ActiveConfig.bArbitraryMipmapDetection)
+      {
+        mip_hash = (mip_hash * 397) ^ Common::GetHash64(mip_level->GetData(),
+                                                        mip_level->GetTextureSize(),
+                                                        textureCacheSafetyColorSampleSize);
+      }
+
       if (!decode_on_gpu ||
           !DecodeTextureOnGPU(
               entry, level, mip_level->GetData(), mip_level->GetTextureSize(),
@@ -1638,9 +1937,16 @@ TextureCacheBase::GetTexture(const int textureCacheSafetyColorSampleSize, Textur
         // No need to call CheckTempSize here, as the whole buffer is preallocated at the beginning
         const u32 decoded_mip_size =
             mip_level->GetExpandedWidth() * sizeof(u32) * mip_level->GetExpandedHeight();
-        TexDecoder_Decode(dst_buffer, mip_level->GetData(), mip_level->GetExpandedWidth(),
-                          mip_level->GetExpandedHeight(), texture_info.GetTextureFormat(),
-                          texture_info.GetTlutAddress(), texture_info.GetTlutFormat());
+        if (!mip_decodes.empty())
+        {
+          mip_decodes[level].wait();
+        }
+        else
+        {
+          TexDecoder_Decode(dst_buffer, mip_level->GetData(), mip_level->GetExpandedWidth(),
+                            mip_level->GetExpandedHeight(), texture_info.GetTextureFormat(),
+                            texture_info.GetTlutAddress(), texture_info.GetTlutFormat());
+        }
         entry->texture->Load(level, mip_level->GetRawWidth(), mip_level->GetRawHeight(),
                              mip_level->GetExpandedWidth(), dst_buffer, decoded_mip_size);
 
@@ -1652,8 +1958,25 @@ TextureCacheBase::GetTexture(const int textureCacheSafetyColorSampleSize, Textur
     }
   }
 
-  entry->has_arbitrary_mips = hires_tex ? hires_tex->HasArbitraryMipmaps() :
-                                          arbitrary_mip_detector.HasArbitraryMipmaps(dst_buffer);
+  if (hires_tex)
+  {
+    entry->has_arbitrary_mips = hires_tex->HasArbitraryMipmaps();
+  }
+  else if (arbitrary_mip_detector.NeedsDetection())
+  {
+    if (m_arbitrary_mipmap_cache.size() >= MAX_ARBITRARY_MIPMAP_CACHE_SIZE)
+      m_arbitrary_mipmap_cache.clear();
+
+    const auto [cached, inserted] =
+        m_arbitrary_mipmap_cache.try_emplace(full_hash ^ mip_hash, false);
+    if (inserted)
+      cached->second = arbitrary_mip_detector.HasArbitraryMipmaps(dst_buffer);
+    entry->has_arbitrary_mips = cached->second;
+  }
+  else
+  {
+    entry->has_arbitrary_mips = false;
+  }
 
   if (g_ActiveConfig.bDumpTextures && !hires_tex)
   {
@@ -1695,8 +2018,16 @@ TextureCacheBase::GetXFBTexture(u32 address, u32 width, u32 height, u32 stride,
     return nullptr;
   }
 
+  // If the XFB was produced by a single EFB copy since the last present, use it directly.
+  TCacheEntry* entry = GetDirectScanoutXFB(address, width, height, stride);
+  if (entry)
+  {
+    GetDisplayRectForXFBEntry(entry, width, height, display_rect);
+    return entry;
+  }
+
   // Do we currently have a version of this XFB copy in VRAM?
-  TCacheEntry* entry = GetXFBFromCache(address, width, height, stride);
+  entry = GetXFBFromCache(address, width, height, stride);
   if (entry)
   {
     if (entry->is_xfb_container)
@@ -1749,8 +2080,9 @@ TextureCacheBase::GetXFBTexture(u32 address, u32 width, u32 height, u32 stride,
   {
     // While this isn't really an xfb copy, we can treat it as such for dumping purposes
     static int xfb_count = 0;
-    entry->texture->Save(
-        fmt::format("{}xfb_loaded_{}.png", File::GetUserPath(D_DUMPTEXTURES_IDX), xfb_count++), 0);
+    QueueTextureDump(
+        entry->texture.get(), 0,
+        fmt::format("{}xfb_loaded_{}.png", File::GetUserPath(D_DUMPTEXTURES_IDX), xfb_count++));
   }
 
   GetDisplayRectForXFBEntry(entry, width, height, display_rect);
@@ -1792,6 +2124,40 @@ TextureCacheBase::TCacheEntry* TextureCacheBase::GetXFBFromCache(u32 address, u3
   return nullptr;
 }
 
+TextureCacheBase::TCacheEntry* TextureCacheBase::GetDirectScanoutXFB(u32 address, u32 width,
+                                                                     u32 height, u32 stride)
+{
+  if (!m_has_direct_scanout_xfb)
+    return nullptr;
+
+  // Only the first present after the copy can skip the hash check. Presenting the same XFB again
+  // goes through the cache, so that CPU writes to the XFB since then are still picked up.
+  m_has_direct_scanout_xfb = false;
+  if (!g_ActiveConfig.bDirectXFBScanout)
+    return nullptr;
+
+  // Entries which were partly overwritten by other copies since need stitching, and entries which
+  // were invalidated are no longer in the cache at all.
+  const auto iter_range = textures_by_address.equal_range(address);
+  for (auto iter = iter_range.first; iter != iter_range.second; ++iter)
+  {
+    TCacheEntry* entry = iter->second;
+    if (entry->id != m_direct_scanout_xfb_id)
+      continue;
+
+    if (!entry->is_xfb_copy || entry->is_xfb_container || entry->memory_stride != stride ||
+        entry->native_width < width || entry->native_height < height ||
+        entry->may_have_overlapping_textures || entry->reference_changed)
+    {
+      return nullptr;
+    }
+
+    return entry;
+  }
+
+  return nullptr;
+}
+
 void TextureCacheBase::StitchXFBCopy(TCacheEntry* stitched_entry)
 {
   // It is possible that some of the overlapping textures overlap each other. This behavior has been
@@ -2152,17 +2518,17 @@ void TextureCacheBase::CopyRenderTargetToTexture(
       if (g_ActiveConfig.bDumpEFBTarget && !is_xfb_copy)
       {
         static int efb_count = 0;
-        entry->texture->Save(
-            fmt::format("{}efb_frame_{}.png", File::GetUserPath(D_DUMPTEXTURES_IDX), efb_count++),
-            0);
+        QueueTextureDump(
+            entry->texture.get(), 0,
+            fmt::format("{}efb_frame_{}.png", File::GetUserPath(D_DUMPTEXTURES_IDX), efb_count++));
       }
 
       if (g_ActiveConfig.bDumpXFBTarget && is_xfb_copy)
       {
         static int xfb_count = 0;
-        entry->texture->Save(
-            fmt::format("{}xfb_copy_{}.png", File::GetUserPath(D_DUMPTEXTURES_IDX), xfb_count++),
-            0);
+        QueueTextureDump(
+            entry->texture.get(), 0,
+            fmt::format("{}xfb_copy_{}.png", File::GetUserPath(D_DUMPTEXTURES_IDX), xfb_count++));
       }
     }
   }
@@ -2300,12 +2666,18 @@ void TextureCacheBase::CopyRenderTargetToTexture(
     const u64 hash = entry->CalculateHash();
     entry->SetHashes(hash, hash);
     textures_by_address.emplace(dstAddr, entry);
+
+    if (is_xfb_copy)
+    {
+      m_direct_scanout_xfb_id = entry->id;
+      m_has_direct_scanout_xfb = true;
+    }
   }
 }
 
-void TextureCacheBase::FlushEFBCopies()
+void TextureCacheBase::FlushEFBCopies(bool forced)
 {
-  if (m_pending_efb_copies.empty())
+  if (m_pending_efb_copies.empty() || (!forced && g_ActiveConfig.bLazyEFBCopies))
     return;
 
   for (TCacheEntry* entry : m_pending_efb_copies)
@@ -2313,6 +2685,24 @@ void TextureCacheBase::FlushEFBCopies()
   m_pending_efb_copies.clear();
 }
 
+void TextureCacheBase::FlushEFBCopiesInRange(u32 addr, u32 size_in_bytes)
+{
+  auto it = m_pending_efb_copies.begin();
+  while (it != m_pending_efb_copies.end())
+  {
+    TCacheEntry* entry = *it;
+    if (entry->addr != addr && entry->OverlapsMemoryRange(addr, size_in_bytes))
+    {
+      FlushEFBCopy(entry);
+      it = m_pending_efb_copies.erase(it);
+    }
+    else
+    {
+      ++it;
+    }
+  }
+}
+
 void TextureCacheBase::WriteEFBCopyToRAM(u8* dst_ptr, u32 width, u32 height, u32 stride,
                                          std::unique_ptr<AbstractStagingTexture> staging_texture)
 {
@@ -2447,9 +2837,13 @@ TextureCacheBase::AllocateTexture(const TextureConfig& config)
   {
     auto entry = std::move(iter->second);
     texture_pool.erase(iter);
+    m_texture_pool_memory -= config.GetMemorySize();
+    INCSTAT(g_stats.this_frame.num_texture_pool_hits);
     return std::move(entry);
   }
 
+  INCSTAT(g_stats.this_frame.num_texture_pool_misses);
+
   std::unique_ptr<AbstractTexture> texture = g_renderer->CreateTexture(config);
   if (!texture)
   {
@@ -2489,6 +2883,13 @@ TextureCacheBase::FindMatchingTextureFromPool(const TextureConfig& config)
   return matching_iter != range.second ? matching_iter : texture_pool.end();
 }
 
+void TextureCacheBase::ReleaseToPool(TexPoolEntry entry)
+{
+  const TextureConfig config = entry.texture->GetConfig();
+  m_texture_pool_memory += config.GetMemorySize();
+  texture_pool.emplace(config, std::move(entry));
+}
+
 TextureCacheBase::TexAddrCache::iterator
 TextureCacheBase::GetTexCacheIter(TextureCacheBase::TCacheEntry* entry)
 {
@@ -2574,9 +2975,7 @@ TextureCacheBase::InvalidateTexture(TexAddrCache::iterator iter, bool discard_pe
     }
   }
 
-  auto config = entry->texture->GetConfig();
-  texture_pool.emplace(config,
-                       TexPoolEntry(std::move(entry->texture), std::move(entry->framebuffer)));
+  ReleaseToPool(TexPoolEntry(std::move(entry->texture), std::move(entry->framebuffer)));
 
   // Don't delete if there's a pending EFB copy, as we need the TCacheEntry alive.
   if (!entry->pending_efb_copy)
@@ -2616,6 +3015,7 @@ void TextureCacheBase::CopyEFBToCacheEntry(TCacheEntry* entry, bool is_depth_cop
                                            bool clamp_top, bool clamp_bottom,
                                            const EFBCopyFilterCoefficients& filter_coefficients)
 {
+  GPUTimingScope gpu_timing_scope(GPUTimingCategory::EFBCopies);
   // Flush EFB pokes first, as they're expected to be included.
   g_framebuffer_manager->FlushEFBPokes();
 
@@ -2687,6 +3087,7 @@ void TextureCacheBase::CopyEFB(AbstractStagingTexture* dst, const EFBCopyParams&
                                bool clamp_top, bool clamp_bottom,
                                const EFBCopyFilterCoefficients& filter_coefficients)
 {
+  GPUTimingScope gpu_timing_scope(GPUTimingCategory::EFBCopies);
   // Flush EFB pokes first, as they're expected to be included.
   g_framebuffer_manager->FlushEFBPokes();
 
@@ -2760,6 +3161,7 @@ bool TextureCacheBase::DecodeTextureOnGPU(TCacheEntry* entry, u32 dst_level, con
                                           u32 row_stride, const u8* palette,
                                           TLUTFormat palette_format)
 {
+  GPUTimingScope gpu_timing_scope(GPUTimingCategory::TextureConversion);
   const auto* info = TextureConversionShaderTiled::GetDecodingShaderInfo(format);
   if (!info)
     return false;
@@ -2877,7 +3279,7 @@ int TextureCacheBase::TCacheEntry::HashSampleSize() const
     return 0;
   }
 
-  return g_ActiveConfig.iSafeTextureCache_ColorSamples;
+  return g_ActiveConfig.GetTextureHashSamples();
 }
 
 u64 TextureCacheBase::TCacheEntry::CalculateHash() const
@@ -16,6 +16,7 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/MathUtil.h"
+#include "Common/WorkerPool.h"
 #include "VideoCommon/AbstractTexture.h"
 #include "VideoCommon/BPMemory.h"
 #include "VideoCommon/TextureConfig.h"
@@ -26,6 +27,7 @@ class AbstractFramebuffer;
 class AbstractStagingTexture;
 class PointerWrap;
 struct VideoConfig;
+enum class TextureHashMode : int;
 
 struct TextureAndTLUTFormat
 {
@@ -106,6 +108,9 @@ public:
     bool is_xfb_container = false;
     u64 id;
 
+    // Custom texture which is being loaded in the background while this native texture is drawn.
+    std::string pending_custom_texture;
+
     bool reference_changed = false;  // used by xfb to determine when a reference xfb changed
 
     unsigned int native_width,
@@ -230,11 +235,19 @@ public:
 
   void ScaleTextureCacheEntryTo(TCacheEntry* entry, u32 new_width, u32 new_height);
 
-  // Flushes all pending EFB copies to emulated RAM.
-  void FlushEFBCopies();
+  // Flushes all pending EFB copies to emulated RAM. Unless forced, lazy EFB copies are kept.
+  void FlushEFBCopies(bool forced = true);
 
   // Texture Serialization
-  void SerializeTexture(AbstractTexture* tex, const TextureConfig& config, PointerWrap& p);
+  // Copies of every layer and level of a texture, in the order they are serialized. Starting the
+  // readbacks of several textures before serializing any of them lets the GPU copy all of them in
+  // a single submission, rather than waiting for the GPU once per texture.
+  using TextureReadback = std::vector<std::unique_ptr<AbstractStagingTexture>>;
+  TextureReadback BeginTextureReadback(AbstractTexture* tex, const TextureConfig& config);
+  // If given, the data is taken from the readback, which must have been started for the same
+  // texture. Otherwise, the texture is read back synchronously.
+  void SerializeTexture(AbstractTexture* tex, const TextureConfig& config, PointerWrap& p,
+                        TextureReadback* readback = nullptr);
   std::optional<TexPoolEntry> DeserializeTexture(PointerWrap& p);
 
   // Save States
@@ -281,6 +294,7 @@ private:
   void SetBackupConfig(const VideoConfig& config);
 
   TCacheEntry* GetXFBFromCache(u32 address, u32 width, u32 height, u32 stride);
+  TCacheEntry* GetDirectScanoutXFB(u32 address, u32 width, u32 height, u32 stride);
 
   TCacheEntry* ApplyPaletteToEntry(TCacheEntry* entry, const u8* palette, TLUTFormat tlutfmt);
 
@@ -291,11 +305,22 @@ private:
   void StitchXFBCopy(TCacheEntry* entry_to_update);
 
   void DumpTexture(TCacheEntry* entry, std::string basename, unsigned int level, bool is_arbitrary);
+  // Reads back a texture level and writes it to a PNG file without waiting for the GPU. The
+  // readback is completed a frame later, and the PNG is encoded on a worker thread.
+  void QueueTextureDump(const AbstractTexture* texture, u32 level, std::string filename);
+  // Hands the readbacks which have had time to complete to the dump thread. If wait is set, all
+  // readbacks are completed, waiting for the GPU if necessary.
+  void ProcessTextureDumps(bool wait);
   void CheckTempSize(size_t required_size);
 
   TCacheEntry* AllocateCacheEntry(const TextureConfig& config);
   std::optional<TexPoolEntry> AllocateTexture(const TextureConfig& config);
   TexPool::iterator FindMatchingTextureFromPool(const TextureConfig& config);
+  // Returns a texture which is no longer used to the pool, so it can be reused.
+  void ReleaseToPool(TexPoolEntry entry);
+  // Frees pooled textures which weren't reused for a few frames, or the least recently pooled
+  // ones while the pool is above the configured size.
+  void CleanupTexturePool(int frame_count);
   TexAddrCache::iterator GetTexCacheIter(TCacheEntry* entry);
 
   // Return all possible overlapping textures. As addr+size of the textures is not
@@ -319,6 +344,9 @@ private:
   void WriteEFBCopyToRAM(u8* dst_ptr, u32 width, u32 height, u32 stride,
                          std::unique_ptr<AbstractStagingTexture> staging_texture);
   void FlushEFBCopy(TCacheEntry* entry);
+  // Flushes the pending EFB copies overlapping a range which is about to be read from RAM, except
+  // for the copy starting at the address itself, as the cache uses that one from VRAM.
+  void FlushEFBCopiesInRange(u32 addr, u32 size_in_bytes);
 
   // Returns a staging texture of the maximum EFB copy size.
   std::unique_ptr<AbstractStagingTexture> GetEFBCopyStagingTexture();
@@ -333,25 +361,57 @@ private:
   TexAddrCache textures_by_address;
   TexHashCache textures_by_hash;
   TexPool texture_pool;
+  size_t m_texture_pool_memory = 0;
+  // Scratch buffer for RGBA8 textures from Tmem which are decoded on the GPU.
+  std::vector<u8> m_tmem_rgba8_buffer;
   u64 last_entry_id = 0;
 
   // Backup configuration values
   struct BackupConfig
   {
     int color_samples;
+    TextureHashMode texture_hash_mode;
     bool texfmt_overlay;
     bool texfmt_overlay_center;
     bool hires_textures;
     bool cache_hires_textures;
+    int hires_texture_cache_size;
     bool copy_cache_enable;
     bool stereo_3d;
     bool efb_mono_depth;
     bool gpu_texture_decoding;
     bool disable_vram_copies;
     bool arbitrary_mipmap_detection;
+    float arbitrary_mipmap_detection_threshold;
+    u32 texture_decoder_threads;
   };
   BackupConfig backup_config = {};
 
+  // Results of the arbitrary mipmap detection, by the hash of the texture and its mipmaps.
+  static constexpr size_t MAX_ARBITRARY_MIPMAP_CACHE_SIZE = 65536;
+  std::unordered_map<u64, bool> m_arbitrary_mipmap_cache;
+
+  // Worker threads for decoding large textures and their mipmaps on the CPU.
+  Common::WorkerPool m_texture_decoder_pool;
+
+  struct PendingTextureDump
+  {
+    std::unique_ptr<AbstractStagingTexture> readback_texture;
+    std::string filename;
+    u32 frame;
+  };
+  std::vector<PendingTextureDump> m_pending_texture_dumps;
+  // Dumped texture names include the texture hash, so this also skips identical textures.
+  std::unordered_set<std::string> m_dumped_textures;
+  u32 m_texture_dump_frame = 0;
+  // Thread for encoding dumped textures. Only started once something is dumped.
+  Common::WorkerPool m_texture_dump_pool;
+
+  // The most recent XFB copy, if nothing has presented it yet. Such a copy can be presented as-is,
+  // since its hash was just computed when it was made.
+  u64 m_direct_scanout_xfb_id = 0;
+  bool m_has_direct_scanout_xfb = false;
+
   // Encoding texture used for EFB copies to RAM.
   std::unique_ptr<AbstractTexture> m_efb_encoding_texture;
   std::unique_ptr<AbstractFramebuffer> m_efb_encoding_framebuffer;
@@ -7,6 +7,11 @@
 #include "Common/CommonTypes.h"
 #include "Common/EnumFormatter.h"
 
+namespace Common
+{
+class WorkerPool;
+}
+
 enum
 {
   TMEM_SIZE = 1024 * 1024,
@@ -177,8 +182,16 @@ TextureFormat TexDecoder_GetEFBCopyBaseFormat(EFBCopyFormat format);
 
 void TexDecoder_Decode(u8* dst, const u8* src, int width, int height, TextureFormat texformat,
                        const u8* tlut, TLUTFormat tlutfmt);
+// Same as TexDecoder_Decode, but splits the texture into bands of block rows which are decoded
+// in parallel on the given pool.
+void TexDecoder_DecodeParallel(Common::WorkerPool& pool, u8* dst, const u8* src, int width,
+                               int height, TextureFormat texformat, const u8* tlut,
+                               TLUTFormat tlutfmt);
 void TexDecoder_DecodeRGBA8FromTmem(u8* dst, const u8* src_ar, const u8* src_gb, int width,
                                     int height);
+// Interleaves the two TMEM banks of an RGBA8 texture back into the layout used in memory.
+void TexDecoder_ReassembleRGBA8FromTmem(u8* dst, const u8* src_ar, const u8* src_gb, int width,
+                                        int height);
 void TexDecoder_DecodeTexel(u8* dst, const u8* src, int s, int t, int imageWidth,
                             TextureFormat texformat, const u8* tlut, TLUTFormat tlutfmt);
 void TexDecoder_DecodeTexelRGBA8FromTmem(u8* dst, const u8* src_ar, const u8* src_gb, int s, int t,
@@ -4,10 +4,12 @@
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
+#include <cstring>
 
 #include "Common/CommonTypes.h"
 #include "Common/MsgHandler.h"
 #include "Common/Swap.h"
+#include "Common/WorkerPool.h"
 
 #include "VideoCommon/LookUpTables.h"
 #include "VideoCommon/TextureDecoder.h"
@@ -382,6 +384,39 @@ void TexDecoder_Decode(u8* dst, const u8* src, int width, int height, TextureFor
     TexDecoder_DrawOverlay(dst, width, height, texformat);
 }
 
+void TexDecoder_DecodeParallel(Common::WorkerPool& pool, u8* dst, const u8* src, int width,
+                               int height, TextureFormat texformat, const u8* tlut,
+                               TLUTFormat tlutfmt)
+{
+  // Textures are stored as rows of blocks, so every band of block rows can be decoded on its own.
+  // Don't make the bands too small, or the synchronization costs more than it saves.
+  constexpr int MIN_BAND_HEIGHT = 32;
+  const int block_height = TexDecoder_GetBlockHeightInTexels(texformat);
+  const int block_rows = height / block_height;
+  const int max_bands = std::max(1, height / MIN_BAND_HEIGHT);
+  const int bands = std::min({block_rows, max_bands, static_cast<int>(pool.GetThreadCount()) + 1});
+  if (bands <= 1)
+  {
+    TexDecoder_Decode(dst, src, width, height, texformat, tlut, tlutfmt);
+    return;
+  }
+
+  const int rows_per_band = (block_rows + bands - 1) / bands * block_height;
+  pool.ParallelFor(bands, [&](size_t band) {
+    const int first_row = static_cast<int>(band) * rows_per_band;
+    const int band_height = std::min(rows_per_band, height - first_row);
+    if (band_height <= 0)
+      return;
+
+    _TexDecoder_DecodeImpl(reinterpret_cast<u32*>(dst) + first_row * width,
+                           src + TexDecoder_GetTextureSizeInBytes(width, first_row, texformat),
+                           width, band_height, texformat, tlut, tlutfmt);
+  });
+
+  if (TexFmt_Overlay_Enable)
+    TexDecoder_DrawOverlay(dst, width, height, texformat);
+}
+
 static inline u32 DecodePixel_IA8(u16 val)
 {
   int a = val & 0xFF;
@@ -754,6 +789,21 @@ void TexDecoder_DecodeRGBA8FromTmem(u8* dst, const u8* src_ar, const u8* src_gb,
   }
 }
 
+void TexDecoder_ReassembleRGBA8FromTmem(u8* dst, const u8* src_ar, const u8* src_gb, int width,
+                                        int height)
+{
+  // Each 4x4 block is stored as 32 bytes of AR pairs followed by 32 bytes of GB pairs, while TMEM
+  // stores the AR and GB halves of all blocks in separate banks.
+  constexpr size_t HALF_BLOCK_SIZE = 32;
+  const int num_blocks = ((width + 3) / 4) * ((height + 3) / 4);
+  for (int i = 0; i < num_blocks; i++)
+  {
+    std::memcpy(dst, src_ar + i * HALF_BLOCK_SIZE, HALF_BLOCK_SIZE);
+    std::memcpy(dst + HALF_BLOCK_SIZE, src_gb + i * HALF_BLOCK_SIZE, HALF_BLOCK_SIZE);
+    dst += HALF_BLOCK_SIZE * 2;
+  }
+}
+
 void TexDecoder_DecodeXFB(u8* dst, const u8* src, u32 width, u32 height, u32 stride)
 {
   const u8* src_ptr = src;
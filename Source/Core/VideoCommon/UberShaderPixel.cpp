@@ -34,6 +34,19 @@ PixelShaderUid GetPixelShaderUid()
   return out;
 }
 
+PixelShaderUid GetPartialPixelShaderUid()
+{
+  PixelShaderUid out = GetPixelShaderUid();
+
+  pixel_ubershader_uid_data* const uid_data = out.GetUidData();
+  uid_data->partial = 1;
+  uid_data->num_tev_stages = bpmem.genMode.numtevstages;
+  uid_data->fog_enable = bpmem.fog.c_proj_fsel.fsel != FogType::Off;
+  uid_data->alpha_test_enable = bpmem.alpha_test.TestResult() != AlphaTestResult::Pass;
+
+  return out;
+}
+
 void ClearUnusedPixelShaderUidBits(APIType ApiType, const ShaderHostConfig& host_config,
                                    PixelShaderUid* uid)
 {
@@ -58,6 +71,9 @@ ShaderCode GenPixelShader(APIType ApiType, const ShaderHostConfig& host_config,
   const bool early_depth = uid_data->early_depth != 0;
   const bool per_pixel_depth = uid_data->per_pixel_depth != 0;
   const bool bounding_box = host_config.bounding_box;
+  // Partial ubershaders replace the uniforms for the state they bake in by constants, so that the
+  // driver can unroll the TEV loop and drop the unused fog and alpha test code.
+  const bool partial = uid_data->partial != 0;
   const u32 numTexgen = uid_data->num_texgens;
   ShaderCode out;
 
@@ -750,8 +766,15 @@ ShaderCode GenPixelShader(APIType ApiType, const ShaderHostConfig& host_config,
     color_input_prefix = "lit_";
   }
 
-  out.Write("  uint num_stages = {};\n\n",
-            BitfieldExtract<&GenMode::numtevstages>("bpmem_genmode"));
+  if (partial)
+  {
+    out.Write("  uint num_stages = {}u;\n\n", uid_data->num_tev_stages);
+  }
+  else
+  {
+    out.Write("  uint num_stages = {};\n\n",
+              BitfieldExtract<&GenMode::numtevstages>("bpmem_genmode"));
+  }
 
   out.Write("  // Main tev loop\n");
   if (ApiType == APIType::D3D)
@@ -1131,8 +1154,9 @@ ShaderCode GenPixelShader(APIType ApiType, const ShaderHostConfig& host_config,
   }
 
   out.Write("  // Alpha Test\n"
-            "  if (bpmem_alphaTest != 0u) {{\n"
+            "  if ({}) {{\n"
             "    bool comp0 = alphaCompare(TevResult.a, " I_ALPHA ".r, {});\n",
+            partial && !uid_data->alpha_test_enable ? "false" : "bpmem_alphaTest != 0u",
             BitfieldExtract<&AlphaTest::comp0>("bpmem_alphaTest"));
   out.Write("    bool comp1 = alphaCompare(TevResult.a, " I_ALPHA ".g, {});\n",
             BitfieldExtract<&AlphaTest::comp1>("bpmem_alphaTest"));
@@ -1170,9 +1194,18 @@ ShaderCode GenPixelShader(APIType ApiType, const ShaderHostConfig& host_config,
 
   // FIXME: Fog is implemented the same as ShaderGen, but ShaderGen's fog is all hacks.
   //        Should be fixed point, and should not make guesses about Range-Based adjustments.
-  out.Write("  // Fog\n"
-            "  uint fog_function = {};\n",
-            BitfieldExtract<&FogParam3::fsel>("bpmem_fogParam3"));
+  if (partial && !uid_data->fog_enable)
+  {
+    out.Write("  // Fog\n"
+              "  uint fog_function = {:s};\n",
+              FogType::Off);
+  }
+  else
+  {
+    out.Write("  // Fog\n"
+              "  uint fog_function = {};\n",
+              BitfieldExtract<&FogParam3::fsel>("bpmem_fogParam3"));
+  }
   out.Write("  if (fog_function != {:s}) {{\n", FogType::Off);
   out.Write("    // TODO: This all needs to be converted from float to fixed point\n"
             "    float ze;\n"
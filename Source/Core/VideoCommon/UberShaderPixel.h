@@ -19,6 +19,13 @@ struct pixel_ubershader_uid_data
   u32 per_pixel_depth : 1;
   u32 uint_output : 1;
 
+  // Partially specialized ubershaders bake in the TEV stage count and whether fog and the alpha
+  // test are used. They are used while the specialized shader for a draw is compiling.
+  u32 partial : 1;
+  u32 num_tev_stages : 4;
+  u32 fog_enable : 1;
+  u32 alpha_test_enable : 1;
+
   u32 NumValues() const { return sizeof(pixel_ubershader_uid_data); }
 };
 #pragma pack()
@@ -26,6 +33,7 @@ struct pixel_ubershader_uid_data
 using PixelShaderUid = ShaderUid<pixel_ubershader_uid_data>;
 
 PixelShaderUid GetPixelShaderUid();
+PixelShaderUid GetPartialPixelShaderUid();
 
 ShaderCode GenPixelShader(APIType ApiType, const ShaderHostConfig& host_config,
                           const pixel_ubershader_uid_data* uid_data);
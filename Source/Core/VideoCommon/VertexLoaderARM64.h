@@ -17,6 +17,8 @@ class VertexLoaderARM64 : public VertexLoaderBase, public Arm64Gen::ARM64CodeBlo
 public:
   VertexLoaderARM64(const TVtxDesc& vtx_desc, const VAT& vtx_att);
 
+  bool CanRunInParallel() const override { return true; }
+
 protected:
   int RunVertices(DataReader src, DataReader dst, int count) override;
 
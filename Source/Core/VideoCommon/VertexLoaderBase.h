@@ -67,6 +67,10 @@ public:
                                                               const VAT& vtx_attr);
   virtual ~VertexLoaderBase() {}
   virtual int RunVertices(DataReader src, DataReader dst, int count) = 0;
+  // Whether RunVertices can be called for different parts of a batch at the same time. Besides
+  // the output, the generated loaders only write to the position cache, which is why it has to be
+  // filled in again afterwards.
+  virtual bool CanRunInParallel() const { return false; }
 
   // per loader public state
   PortableVertexDeclaration m_native_vtx_decl{};
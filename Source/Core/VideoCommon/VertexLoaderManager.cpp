@@ -4,7 +4,11 @@
 #include "VideoCommon/VertexLoaderManager.h"
 
 #include <algorithm>
+#include <array>
+#include <cstring>
+#include <future>
 #include <iterator>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -14,7 +18,10 @@
 
 #include "Common/Assert.h"
 #include "Common/CommonTypes.h"
+#include "Common/FlatHashMap.h"
+#include "Common/Hash.h"
 #include "Common/Logging/Log.h"
+#include "Common/WorkerPool.h"
 
 #include "Core/DolphinAnalytics.h"
 #include "Core/HW/Memmap.h"
@@ -28,8 +35,13 @@
 #include "VideoCommon/RenderBase.h"
 #include "VideoCommon/Statistics.h"
 #include "VideoCommon/VertexLoaderBase.h"
+#include "VideoCommon/VertexLoader_Color.h"
+#include "VideoCommon/VertexLoader_Normal.h"
+#include "VideoCommon/VertexLoader_Position.h"
+#include "VideoCommon/VertexLoader_TextCoord.h"
 #include "VideoCommon/VertexManagerBase.h"
 #include "VideoCommon/VertexShaderManager.h"
+#include "VideoCommon/VideoConfig.h"
 
 namespace VertexLoaderManager
 {
@@ -50,6 +62,56 @@ static VertexLoaderMap s_vertex_loader_map;
 
 u8* cached_arraybases[NUM_VERTEX_COMPONENT_ARRAYS];
 
+// Batches with fewer vertices are always converted on the GPU thread.
+constexpr int MIN_PARALLEL_VERTICES = 4096;
+constexpr int MIN_VERTICES_PER_JOB = 1024;
+
+static Common::WorkerPool s_vertex_loader_pool;
+static std::vector<u8> s_vertex_scratch;
+
+// Indexed batches are often drawn again with the same indices and the same vertex arrays, so their
+// converted vertices are kept to be copied instead of converted on the next draw. An entry is used
+// only if the raw vertex data, the array pointers and strides and the parts of the arrays the
+// indices refer to are still the same.
+namespace
+{
+struct CachedArrayRange
+{
+  u32 array;
+  u8* base;
+  u32 stride;
+  u32 offset;
+  u32 size;
+  u64 hash;
+};
+
+struct CachedVertices
+{
+  VertexLoaderBase* loader;
+  int count;
+  int num_loaded;
+  std::vector<CachedArrayRange> arrays;
+  std::vector<u8> data;
+};
+
+struct IndexedComponent
+{
+  u32 offset;
+  u32 index_size;
+  u32 array;
+  // The bytes read from the array per index, relative to the start of the indexed element.
+  u32 element_offset;
+  u32 element_size;
+};
+}  // namespace
+
+// Smaller batches are cheap enough to convert.
+constexpr int MIN_CACHED_VERTICES = 256;
+constexpr size_t MAX_CACHED_VERTEX_BYTES = 64 * 1024 * 1024;
+
+static Common::FlatHashMap<u64, CachedVertices> s_vertex_cache;
+static size_t s_vertex_cache_bytes = 0;
+
 void Init()
 {
   MarkAllDirty();
@@ -65,6 +127,9 @@ void Clear()
   std::lock_guard<std::mutex> lk(s_vertex_loader_map_lock);
   s_vertex_loader_map.clear();
   s_native_vertex_map.clear();
+  s_vertex_loader_pool.Stop();
+  s_vertex_cache.Clear();
+  s_vertex_cache_bytes = 0;
 }
 
 void UpdateVertexArrayPointers()
@@ -239,6 +304,284 @@ static VertexLoaderBase* RefreshLoader(int vtx_attr_group, bool preprocess = fal
   return loader;
 }
 
+static bool UpdateVertexLoaderPool()
+{
+  const u32 num_threads = g_ActiveConfig.GetVertexLoaderThreads();
+  if (num_threads != s_vertex_loader_pool.GetThreadCount())
+  {
+    s_vertex_loader_pool.Stop();
+    if (num_threads != 0)
+      s_vertex_loader_pool.Start(num_threads, "Vertex Loader");
+  }
+  return s_vertex_loader_pool.IsRunning();
+}
+
+// Converts a batch in ranges on the vertex loader threads and the GPU thread. Returns the number
+// of vertices written to dst, which is less than count if the loader skipped some of them.
+static int RunVerticesInParallel(VertexLoaderBase* loader, int primitive, int count,
+                                 DataReader src, DataReader dst)
+{
+  const u32 src_stride = loader->m_vertex_size;
+  const u32 dst_stride = loader->m_native_vtx_decl.stride;
+  u8* const src_end = src.GetPointer() + src.size();
+  u8* const dst_end = dst.GetPointer() + dst.size();
+
+  const int num_jobs = std::min(static_cast<int>(s_vertex_loader_pool.GetThreadCount()) + 1,
+                                count / MIN_VERTICES_PER_JOB);
+  std::vector<int> first(num_jobs + 1);
+  for (int i = 0; i <= num_jobs; ++i)
+    first[i] = static_cast<int>(s64(count) * i / num_jobs);
+
+  std::vector<int> loaded(num_jobs);
+  const auto run_job = [&](int job) {
+    loaded[job] =
+        loader->RunVertices(DataReader(src.GetPointer() + first[job] * src_stride, src_end),
+                            DataReader(dst.GetPointer() + first[job] * dst_stride, dst_end),
+                            first[job + 1] - first[job]);
+  };
+
+  std::vector<std::future<void>> jobs;
+  for (int i = 1; i < num_jobs; ++i)
+    jobs.push_back(s_vertex_loader_pool.Submit([&run_job, i] { run_job(i); }));
+
+  // Vertices are only skipped for invalid position indices. Without those, the indices don't
+  // depend on the converted vertices and can be generated in the meantime.
+  const bool can_skip = IsIndexed(g_main_cp_state.vtx_desc.low.Position);
+  if (!can_skip)
+    g_vertex_manager->AddIndices(primitive, count);
+
+  run_job(0);
+  for (std::future<void>& job : jobs)
+    job.wait();
+
+  // The loaders can write a few bytes past the last vertex, which may have landed on the first
+  // vertex of the next range after it was written. Convert those again on their own.
+  s_vertex_scratch.resize(3 * dst_stride + 4);
+  DataReader scratch(s_vertex_scratch.data(), s_vertex_scratch.data() + s_vertex_scratch.size());
+  for (int job = 1; job < num_jobs; ++job)
+  {
+    for (int i = first[job]; i < first[job + 1]; ++i)
+    {
+      if (loader->RunVertices(DataReader(src.GetPointer() + i * src_stride, src_end), scratch, 1))
+      {
+        std::memcpy(dst.GetPointer() + first[job] * dst_stride, s_vertex_scratch.data(),
+                    dst_stride);
+        break;
+      }
+    }
+  }
+
+  // Every range filled in the position cache for its own last vertices, so redo the end of the
+  // batch to leave it the same as after a single call.
+  const int num_tail = std::min(count, 3);
+  loader->RunVertices(DataReader(src.GetPointer() + (count - num_tail) * src_stride, src_end),
+                      scratch, num_tail);
+
+  // Close the gaps left by skipped vertices.
+  int num_loaded = loaded[0];
+  for (int job = 1; job < num_jobs; ++job)
+  {
+    if (num_loaded != first[job])
+    {
+      std::memmove(dst.GetPointer() + num_loaded * dst_stride,
+                   dst.GetPointer() + first[job] * dst_stride, loaded[job] * dst_stride);
+    }
+    num_loaded += loaded[job];
+  }
+
+  if (can_skip)
+    g_vertex_manager->AddIndices(primitive, num_loaded);
+  return num_loaded;
+}
+
+// Converts the vertices and adds their indices. Returns the number of vertices written to dst.
+static int ConvertVertices(VertexLoaderBase* loader, int primitive, int count, DataReader src,
+                           DataReader dst)
+{
+  if (count >= MIN_PARALLEL_VERTICES && loader->CanRunInParallel() && UpdateVertexLoaderPool())
+    return RunVerticesInParallel(loader, primitive, count, src, dst);
+
+  count = loader->RunVertices(src, dst, count);
+  g_vertex_manager->AddIndices(primitive, count);
+  return count;
+}
+
+static std::vector<IndexedComponent> GetIndexedComponents(const TVtxDesc& vtx_desc,
+                                                          const VAT& vtx_attr)
+{
+  std::vector<IndexedComponent> components;
+  u32 offset = 0;
+  const auto add = [&](VertexComponentFormat format, u32 size, u32 array, u32 element_size,
+                       u32 num_indices) {
+    if (IsIndexed(format))
+    {
+      const u32 index_size = format == VertexComponentFormat::Index8 ? 1 : 2;
+      for (u32 i = 0; i < num_indices; ++i)
+      {
+        components.push_back(
+            {offset + i * index_size, index_size, array, i * element_size, element_size});
+      }
+    }
+    offset += size;
+  };
+
+  if (vtx_desc.low.PosMatIdx)
+    offset++;
+  for (auto texmtxidx : vtx_desc.low.TexMatIdx)
+  {
+    if (texmtxidx)
+      offset++;
+  }
+
+  add(vtx_desc.low.Position,
+      VertexLoader_Position::GetSize(vtx_desc.low.Position, vtx_attr.g0.PosFormat,
+                                     vtx_attr.g0.PosElements),
+      ARRAY_POSITION,
+      VertexLoader_Position::GetSize(VertexComponentFormat::Direct, vtx_attr.g0.PosFormat,
+                                     vtx_attr.g0.PosElements),
+      1);
+
+  // With three indices, each of them refers to one of the three vectors of an element.
+  const bool index3 =
+      vtx_attr.g0.NormalIndex3 && vtx_attr.g0.NormalElements == NormalComponentCount::NBT;
+  const u32 normal_size =
+      VertexLoader_Normal::GetSize(VertexComponentFormat::Direct, vtx_attr.g0.NormalFormat,
+                                   vtx_attr.g0.NormalElements, false);
+  add(vtx_desc.low.Normal,
+      VertexLoader_Normal::GetSize(vtx_desc.low.Normal, vtx_attr.g0.NormalFormat,
+                                   vtx_attr.g0.NormalElements, vtx_attr.g0.NormalIndex3),
+      ARRAY_NORMAL, index3 ? normal_size / 3 : normal_size, index3 ? 3 : 1);
+
+  for (u32 i = 0; i < vtx_desc.low.Color.Size(); i++)
+  {
+    add(vtx_desc.low.Color[i],
+        VertexLoader_Color::GetSize(vtx_desc.low.Color[i], vtx_attr.GetColorFormat(i)),
+        ARRAY_COLOR0 + i,
+        VertexLoader_Color::GetSize(VertexComponentFormat::Direct, vtx_attr.GetColorFormat(i)), 1);
+  }
+  for (u32 i = 0; i < vtx_desc.high.TexCoord.Size(); i++)
+  {
+    add(vtx_desc.high.TexCoord[i],
+        VertexLoader_TextCoord::GetSize(vtx_desc.high.TexCoord[i], vtx_attr.GetTexFormat(i),
+                                        vtx_attr.GetTexElements(i)),
+        ARRAY_TEXCOORD0 + i,
+        VertexLoader_TextCoord::GetSize(VertexComponentFormat::Direct, vtx_attr.GetTexFormat(i),
+                                        vtx_attr.GetTexElements(i)),
+        1);
+  }
+
+  return components;
+}
+
+// Finds the parts of the vertex arrays which are referred to by the indices of a batch.
+static std::vector<CachedArrayRange> GetArrayRanges(VertexLoaderBase* loader, int vtx_attr_group,
+                                                    int count, const u8* src)
+{
+  const std::vector<IndexedComponent> components =
+      GetIndexedComponents(g_main_cp_state.vtx_desc, g_main_cp_state.vtx_attr[vtx_attr_group]);
+
+  std::array<u32, NUM_VERTEX_COMPONENT_ARRAYS> min_start;
+  std::array<u32, NUM_VERTEX_COMPONENT_ARRAYS> max_end{};
+  min_start.fill(std::numeric_limits<u32>::max());
+
+  for (int i = 0; i < count; ++i, src += loader->m_vertex_size)
+  {
+    for (const IndexedComponent& component : components)
+    {
+      const u8* index_ptr = src + component.offset;
+      const u32 index =
+          component.index_size == 1 ? index_ptr[0] : (u32(index_ptr[0]) << 8) | index_ptr[1];
+
+      // Vertices with an all ones position index are skipped.
+      const u32 skip_index = component.index_size == 1 ? 0xFF : 0xFFFF;
+      if (component.array == ARRAY_POSITION && index == skip_index)
+        break;
+
+      const u32 start =
+          index * g_main_cp_state.array_strides[component.array] + component.element_offset;
+      min_start[component.array] = std::min(min_start[component.array], start);
+      max_end[component.array] = std::max(max_end[component.array], start + component.element_size);
+    }
+  }
+
+  std::vector<CachedArrayRange> ranges;
+  for (u32 array = 0; array < NUM_VERTEX_COMPONENT_ARRAYS; ++array)
+  {
+    if (min_start[array] >= max_end[array])
+      continue;
+
+    ranges.push_back({array, cached_arraybases[array], g_main_cp_state.array_strides[array],
+                      min_start[array], max_end[array] - min_start[array], 0});
+  }
+  return ranges;
+}
+
+static u64 HashArrayRange(const CachedArrayRange& range)
+{
+  return Common::GetHash64(range.base + range.offset, range.size, 0);
+}
+
+static int RunVerticesCached(VertexLoaderBase* loader, int vtx_attr_group, int primitive,
+                             int count, DataReader src, DataReader dst)
+{
+  const u32 src_size = count * loader->m_vertex_size;
+  const u32 dst_stride = loader->m_native_vtx_decl.stride;
+  const u64 key = Common::GetHash64(src.GetPointer(), src_size, 0) ^
+                  (reinterpret_cast<uintptr_t>(loader) * 0x9E3779B97F4A7C15ULL) ^ u64(count);
+
+  if (CachedVertices* entry = s_vertex_cache.Find(key))
+  {
+    const bool valid =
+        entry->loader == loader && entry->count == count &&
+        std::all_of(entry->arrays.begin(), entry->arrays.end(), [](const CachedArrayRange& range) {
+          return range.base == cached_arraybases[range.array] &&
+                 range.stride == g_main_cp_state.array_strides[range.array] &&
+                 range.hash == HashArrayRange(range);
+        });
+    if (valid)
+    {
+      std::memcpy(dst.GetPointer(), entry->data.data(), entry->data.size());
+      g_vertex_manager->AddIndices(primitive, entry->num_loaded);
+
+      // Converting the last vertices fills in the position cache.
+      const int num_tail = std::min(count, 3);
+      s_vertex_scratch.resize(3 * dst_stride + 4);
+      loader->RunVertices(DataReader(src.GetPointer() + (count - num_tail) * loader->m_vertex_size,
+                                     src.GetPointer() + src_size),
+                          DataReader(s_vertex_scratch.data(),
+                                     s_vertex_scratch.data() + s_vertex_scratch.size()),
+                          num_tail);
+      return entry->num_loaded;
+    }
+
+    s_vertex_cache_bytes -= entry->data.size();
+    s_vertex_cache.Erase(key);
+  }
+
+  const int num_loaded = ConvertVertices(loader, primitive, count, src, dst);
+  std::vector<CachedArrayRange> arrays =
+      GetArrayRanges(loader, vtx_attr_group, count, src.GetPointer());
+
+  const size_t data_size = size_t(num_loaded) * dst_stride;
+  if (s_vertex_cache_bytes + data_size > MAX_CACHED_VERTEX_BYTES)
+  {
+    s_vertex_cache.Clear();
+    s_vertex_cache_bytes = 0;
+  }
+
+  for (CachedArrayRange& range : arrays)
+    range.hash = HashArrayRange(range);
+
+  CachedVertices& entry = s_vertex_cache[key];
+  entry.loader = loader;
+  entry.count = count;
+  entry.num_loaded = num_loaded;
+  entry.arrays = std::move(arrays);
+  entry.data.assign(dst.GetPointer(), dst.GetPointer() + data_size);
+  s_vertex_cache_bytes += data_size;
+  return num_loaded;
+}
+
 int RunVertices(int vtx_attr_group, int primitive, int count, DataReader src, bool is_preprocess)
 {
   if (!count)
@@ -271,9 +614,16 @@ int RunVertices(int vtx_attr_group, int primitive, int count, DataReader src, bo
   DataReader dst = g_vertex_manager->PrepareForAdditionalData(
       primitive, count, loader->m_native_vtx_decl.stride, cullall);
 
-  count = loader->RunVertices(src, dst, count);
-
-  g_vertex_manager->AddIndices(primitive, count);
+  loader->m_numLoadedVertices += count;
+  if (g_ActiveConfig.bVertexLoaderCache && count >= MIN_CACHED_VERTICES &&
+      IsIndexed(g_main_cp_state.vtx_desc.low.Position))
+  {
+    count = RunVerticesCached(loader, vtx_attr_group, primitive, count, src, dst);
+  }
+  else
+  {
+    count = ConvertVertices(loader, primitive, count, src, dst);
+  }
   g_vertex_manager->FlushData(count, loader->m_native_vtx_decl.stride);
 
   ADDSTAT(g_stats.this_frame.num_prims, count);
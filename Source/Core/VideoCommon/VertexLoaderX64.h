@@ -16,6 +16,8 @@ class VertexLoaderX64 : public VertexLoaderBase, public Gen::X64CodeBlock
 public:
   VertexLoaderX64(const TVtxDesc& vtx_desc, const VAT& vtx_att);
 
+  bool CanRunInParallel() const override { return true; }
+
 protected:
   int RunVertices(DataReader src, DataReader dst, int count) override;
 
@@ -21,6 +21,7 @@
 #include "VideoCommon/DataReader.h"
 #include "VideoCommon/FramebufferManager.h"
 #include "VideoCommon/GeometryShaderManager.h"
+#include "VideoCommon/GPUTimingBase.h"
 #include "VideoCommon/IndexGenerator.h"
 #include "VideoCommon/NativeVertexFormat.h"
 #include "VideoCommon/OpcodeDecoding.h"
@@ -489,12 +490,17 @@ void VertexManagerBase::Flush()
     UpdatePipelineObject();
     if (m_current_pipeline_object)
     {
+      if (g_gpu_timing)
+        g_gpu_timing->SetCategory(GPUTimingCategory::EFBRendering);
+
       g_renderer->SetPipeline(m_current_pipeline_object);
       if (PerfQueryBase::ShouldEmulate())
         g_perf_query->EnableQuery(bpmem.zcontrol.early_ztest ? PQG_ZCOMP_ZCOMPLOC : PQG_ZCOMP);
 
       DrawCurrentBatch(base_index, num_indices, base_vertex);
       INCSTAT(g_stats.this_frame.num_draw_calls);
+      if (m_current_pipeline_is_uber_fallback)
+        INCSTAT(g_stats.this_frame.num_ubershader_draws);
 
       if (PerfQueryBase::ShouldEmulate())
         g_perf_query->DisableQuery(bpmem.zcontrol.early_ztest ? PQG_ZCOMP_ZCOMPLOC : PQG_ZCOMP);
@@ -504,6 +510,10 @@ void VertexManagerBase::Flush()
       // The EFB cache is now potentially stale.
       g_framebuffer_manager->FlagPeekCacheAsOutOfDate();
     }
+    else
+    {
+      INCSTAT(g_stats.this_frame.num_skipped_draws);
+    }
   }
 
   if (xfmem.numTexGen.numTexGens != bpmem.genMode.numtexgens)
@@ -617,6 +627,7 @@ void VertexManagerBase::UpdatePipelineConfig()
   {
     m_current_pipeline_config.ps_uid = ps_uid;
     m_current_uber_pipeline_config.ps_uid = UberShader::GetPixelShaderUid();
+    m_current_partial_uber_ps_uid = UberShader::GetPartialPixelShaderUid();
     m_pipeline_config_changed = true;
   }
 
@@ -677,6 +688,7 @@ void VertexManagerBase::UpdatePipelineObject()
     return;
 
   m_current_pipeline_object = nullptr;
+  m_current_pipeline_is_uber_fallback = false;
   m_pipeline_config_changed = false;
 
   switch (g_ActiveConfig.iShaderCompilationMode)
@@ -710,9 +722,24 @@ void VertexManagerBase::UpdatePipelineObject()
 
     if (g_ActiveConfig.iShaderCompilationMode == ShaderCompilationMode::AsynchronousUberShaders)
     {
+      if (g_ActiveConfig.bPartialUberShaders)
+      {
+        // Partial ubershaders are cheaper to run than the full ones, if they are ready.
+        VideoCommon::GXUberPipelineUid partial_config = m_current_uber_pipeline_config;
+        partial_config.ps_uid = m_current_partial_uber_ps_uid;
+        auto partial_res = g_shader_cache->GetPartialUberPipelineForUidAsync(partial_config);
+        if (partial_res && *partial_res)
+        {
+          m_current_pipeline_object = *partial_res;
+          m_current_pipeline_is_uber_fallback = true;
+          return;
+        }
+      }
+
       // Specialized shaders not ready, use the ubershaders.
       m_current_pipeline_object =
           g_shader_cache->GetUberPipelineForUid(m_current_uber_pipeline_config);
+      m_current_pipeline_is_uber_fallback = true;
     }
     else
     {
@@ -180,7 +180,10 @@ protected:
 
   VideoCommon::GXPipelineUid m_current_pipeline_config;
   VideoCommon::GXUberPipelineUid m_current_uber_pipeline_config;
+  UberShader::PixelShaderUid m_current_partial_uber_ps_uid;
   const AbstractPipeline* m_current_pipeline_object = nullptr;
+  // Set when drawing with ubershaders while the specialized pipeline compiles.
+  bool m_current_pipeline_is_uber_fallback = false;
   PrimitiveType m_current_primitive_type = PrimitiveType::Points;
   bool m_pipeline_config_changed = true;
   bool m_rasterization_state_changed = true;
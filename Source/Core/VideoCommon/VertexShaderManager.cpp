@@ -45,6 +45,17 @@ static std::array<int, 2> nLightsChanged;                 // min,max
 
 static Common::Matrix44 s_viewportCorrection;
 
+// Copies size bytes from src to dst, and returns whether that changed dst. Games often load the
+// same matrices before every draw, so this avoids re-uploading constants that didn't change.
+static bool CopyIfChanged(void* dst, const void* src, size_t size)
+{
+  if (std::memcmp(dst, src, size) == 0)
+    return false;
+
+  std::memcpy(dst, src, size);
+  return true;
+}
+
 VertexShaderConstants VertexShaderManager::constants;
 bool VertexShaderManager::dirty;
 
@@ -151,9 +162,8 @@ void VertexShaderManager::SetConstants()
   {
     int startn = nTransformMatricesChanged[0] / 4;
     int endn = (nTransformMatricesChanged[1] + 3) / 4;
-    memcpy(constants.transformmatrices[startn].data(), &xfmem.posMatrices[startn * 4],
-           (endn - startn) * sizeof(float4));
-    dirty = true;
+    dirty |= CopyIfChanged(constants.transformmatrices[startn].data(),
+                           &xfmem.posMatrices[startn * 4], (endn - startn) * sizeof(float4));
     nTransformMatricesChanged[0] = nTransformMatricesChanged[1] = -1;
   }
 
@@ -162,10 +172,7 @@ void VertexShaderManager::SetConstants()
     int startn = nNormalMatricesChanged[0] / 3;
     int endn = (nNormalMatricesChanged[1] + 2) / 3;
     for (int i = startn; i < endn; i++)
-    {
-      memcpy(constants.normalmatrices[i].data(), &xfmem.normalMatrices[3 * i], 12);
-    }
-    dirty = true;
+      dirty |= CopyIfChanged(constants.normalmatrices[i].data(), &xfmem.normalMatrices[3 * i], 12);
     nNormalMatricesChanged[0] = nNormalMatricesChanged[1] = -1;
   }
 
@@ -173,9 +180,8 @@ void VertexShaderManager::SetConstants()
   {
     int startn = nPostTransformMatricesChanged[0] / 4;
     int endn = (nPostTransformMatricesChanged[1] + 3) / 4;
-    memcpy(constants.posttransformmatrices[startn].data(), &xfmem.postMatrices[startn * 4],
-           (endn - startn) * sizeof(float4));
-    dirty = true;
+    dirty |= CopyIfChanged(constants.posttransformmatrices[startn].data(),
+                           &xfmem.postMatrices[startn * 4], (endn - startn) * sizeof(float4));
     nPostTransformMatricesChanged[0] = nPostTransformMatricesChanged[1] = -1;
   }
 
@@ -189,7 +195,7 @@ void VertexShaderManager::SetConstants()
     for (int i = istart; i < iend; ++i)
     {
       const Light& light = xfmem.lights[i];
-      VertexShaderConstants::Light& dstlight = constants.lights[i];
+      VertexShaderConstants::Light dstlight = constants.lights[i];
 
       // xfmem.light.color is packed as abgr in u8[4], so we have to swap the order
       dstlight.color[0] = light.color[3];
@@ -226,8 +232,9 @@ void VertexShaderManager::SetConstants()
       dstlight.dir[0] = light.ddir[0] * norm_float;
       dstlight.dir[1] = light.ddir[1] * norm_float;
       dstlight.dir[2] = light.ddir[2] * norm_float;
+
+      dirty |= CopyIfChanged(&constants.lights[i], &dstlight, sizeof(dstlight));
     }
-    dirty = true;
 
     nLightsChanged[0] = nLightsChanged[1] = -1;
   }
@@ -235,11 +242,10 @@ void VertexShaderManager::SetConstants()
   for (int i : nMaterialsChanged)
   {
     u32 data = i >= 2 ? xfmem.matColor[i - 2] : xfmem.ambColor[i];
-    constants.materials[i][0] = (data >> 24) & 0xFF;
-    constants.materials[i][1] = (data >> 16) & 0xFF;
-    constants.materials[i][2] = (data >> 8) & 0xFF;
-    constants.materials[i][3] = data & 0xFF;
-    dirty = true;
+    const int4 material = {static_cast<s32>((data >> 24) & 0xFF),
+                           static_cast<s32>((data >> 16) & 0xFF),
+                           static_cast<s32>((data >> 8) & 0xFF), static_cast<s32>(data & 0xFF)};
+    dirty |= CopyIfChanged(constants.materials[i].data(), material.data(), sizeof(material));
   }
   nMaterialsChanged = BitSet32(0);
 
@@ -251,11 +257,10 @@ void VertexShaderManager::SetConstants()
     const float* norm =
         &xfmem.normalMatrices[3 * (g_main_cp_state.matrix_index_a.PosNormalMtxIdx & 31)];
 
-    memcpy(constants.posnormalmatrix.data(), pos, 3 * sizeof(float4));
-    memcpy(constants.posnormalmatrix[3].data(), norm, 3 * sizeof(float));
-    memcpy(constants.posnormalmatrix[4].data(), norm + 3, 3 * sizeof(float));
-    memcpy(constants.posnormalmatrix[5].data(), norm + 6, 3 * sizeof(float));
-    dirty = true;
+    dirty |= CopyIfChanged(constants.posnormalmatrix.data(), pos, 3 * sizeof(float4));
+    dirty |= CopyIfChanged(constants.posnormalmatrix[3].data(), norm, 3 * sizeof(float));
+    dirty |= CopyIfChanged(constants.posnormalmatrix[4].data(), norm + 3, 3 * sizeof(float));
+    dirty |= CopyIfChanged(constants.posnormalmatrix[5].data(), norm + 6, 3 * sizeof(float));
   }
 
   if (bTexMatricesChanged[0])
@@ -270,9 +275,9 @@ void VertexShaderManager::SetConstants()
 
     for (size_t i = 0; i < pos_matrix_ptrs.size(); ++i)
     {
-      memcpy(constants.texmatrices[3 * i].data(), pos_matrix_ptrs[i], 3 * sizeof(float4));
+      dirty |=
+          CopyIfChanged(constants.texmatrices[3 * i].data(), pos_matrix_ptrs[i], 3 * sizeof(float4));
     }
-    dirty = true;
   }
 
   if (bTexMatricesChanged[1])
@@ -287,9 +292,9 @@ void VertexShaderManager::SetConstants()
 
     for (size_t i = 0; i < pos_matrix_ptrs.size(); ++i)
     {
-      memcpy(constants.texmatrices[3 * i + 12].data(), pos_matrix_ptrs[i], 3 * sizeof(float4));
+      dirty |= CopyIfChanged(constants.texmatrices[3 * i + 12].data(), pos_matrix_ptrs[i],
+                             3 * sizeof(float4));
     }
-    dirty = true;
   }
 
   if (bViewportChanged)
@@ -433,11 +438,10 @@ void VertexShaderManager::SetConstants()
     if (g_freelook_camera.IsActive() && xfmem.projection.type == ProjectionType::Perspective)
       corrected_matrix *= g_freelook_camera.GetView();
 
-    memcpy(constants.projection.data(), corrected_matrix.data.data(), 4 * sizeof(float4));
+    dirty |= CopyIfChanged(constants.projection.data(), corrected_matrix.data.data(),
+                           4 * sizeof(float4));
 
     g_freelook_camera.SetClean();
-
-    dirty = true;
   }
 
   if (bTexMtxInfoChanged)
@@ -88,8 +88,6 @@ void VideoBackendBase::Video_BeginField(u32 xfb_addr, u32 fb_width, u32 fb_strid
 {
   if (m_initialized && g_renderer && !g_ActiveConfig.bImmediateXFB)
   {
-    Fifo::SyncGPU(Fifo::SyncGPUReason::Swap);
-
     AsyncRequests::Event e;
     e.time = ticks;
     e.type = AsyncRequests::Event::SWAP_EVENT;
@@ -98,7 +96,16 @@ void VideoBackendBase::Video_BeginField(u32 xfb_addr, u32 fb_width, u32 fb_strid
     e.swap_event.fbWidth = fb_width;
     e.swap_event.fbStride = fb_stride;
     e.swap_event.fbHeight = fb_height;
-    AsyncRequests::GetInstance()->PushEvent(e, false);
+
+    if (Fifo::UseDeterministicGPUThread())
+    {
+      Fifo::PushDeterministicSwap(e);
+    }
+    else
+    {
+      Fifo::SyncGPU(Fifo::SyncGPUReason::Swap);
+      AsyncRequests::GetInstance()->PushEvent(e, false);
+    }
   }
 }
 
@@ -42,6 +42,14 @@ enum class StereoMode : int
   Passive
 };
 
+enum class TextureHashMode : int
+{
+  // Hash SafeTextureCacheColorSamples samples of each texture, or all data if that is zero.
+  Sampled,
+  // Hash all data of each texture with XXH3.
+  Full,
+};
+
 enum class ShaderCompilationMode : int
 {
   Synchronous,
@@ -60,6 +68,9 @@ struct VideoConfig final
   // General
   bool bVSync;
   bool bVSyncActive;
+  int iMaxFramesInFlight;  // 0 leaves the limit to the backend
+  // Most consecutive frames which may go unpresented while emulation is below full speed.
+  int iMaxFrameSkip;
   bool bWidescreenHack;
   AspectMode aspect_mode;
   AspectMode suggested_aspect_mode;
@@ -77,6 +88,8 @@ struct VideoConfig final
   bool bDisableCopyFilter;
   bool bArbitraryMipmapDetection;
   float fArbitraryMipmapDetectionThreshold;
+  // Lowers the internal resolution below iEFBScale while the GPU can't keep up.
+  bool bDynamicResolution;
 
   // Information
   bool bShowFPS;
@@ -87,6 +100,7 @@ struct VideoConfig final
   bool bTexFmtOverlayEnable;
   bool bTexFmtOverlayCenter;
   bool bLogRenderTimeToFile;
+  bool bMeasureGPUTime;  // Also enabled by the statistics overlay
 
   // Render
   bool bWireFrame;
@@ -98,6 +112,10 @@ struct VideoConfig final
   bool bDumpBaseTextures;
   bool bHiresTextures;
   bool bCacheHiresTextures;
+  int iHiresTextureCacheSize;  // In MiB, 0 picks a size based on the amount of system memory
+  // Draws the native texture while a custom texture is loaded in the background. Requires
+  // bCacheHiresTextures.
+  bool bAsyncHiresTextures;
   bool bDumpEFBTarget;
   bool bDumpXFBTarget;
   bool bDumpFramesAsImages;
@@ -116,22 +134,37 @@ struct VideoConfig final
   bool bEFBAccessDeferInvalidation;
   bool bPerfQueriesEnable;
   bool bBBoxEnable;
+  // Reads the bounding box back once per frame, and returns the previous frame's values to the
+  // game instead of waiting for the GPU on every read.
+  bool bBBoxDeferReadback;
   bool bForceProgressive;
 
   bool bEFBEmulateFormatChanges;
+  // Reinterprets the EFB once it is used after a format change, instead of at every change.
+  bool bDeferEFBFormatChanges;
   bool bSkipEFBCopyToRam;
   bool bSkipXFBCopyToRam;
   bool bDisableCopyToVRAM;
   bool bDeferEFBCopies;
+  // Keeps deferred EFB copies on the GPU past draw done and tokens, until the texture cache needs
+  // their memory or the frame ends.
+  bool bLazyEFBCopies;
   bool bImmediateXFB;
   bool bSkipPresentingDuplicateXFBs;
+  // Presents an XFB copy made since the last present without re-hashing its memory.
+  bool bDirectXFBScanout;
   bool bCopyEFBScaled;
   int iSafeTextureCache_ColorSamples;
+  TextureHashMode texture_hash_mode;
+  int iTexturePoolSize;  // In MiB, 0 frees unused textures after a few frames
   float fAspectRatioHackW, fAspectRatioHackH;
   bool bEnablePixelLighting;
   bool bFastDepthCalc;
   bool bVertexRounding;
   int iEFBAccessTileSize;
+  // Reads back the tiles peeked before the last invalidation along with the first tile peeked
+  // after it, so that peeking them again doesn't wait for the GPU again.
+  bool bEFBAccessPrefetch;
   int iLog;           // CONF_ bits
   int iSaveTargetId;  // TODO: Should be dropped
   u32 iMissingColorValue;
@@ -156,6 +189,7 @@ struct VideoConfig final
   bool bDumpObjects;
   bool bDumpTevStages;
   bool bDumpTevTextureFetches;
+  int iSWRasterizerThreads;
 
   // Enable API validation layers, currently only supported with Vulkan.
   bool bEnableValidationLayer;
@@ -163,6 +197,17 @@ struct VideoConfig final
   // Multithreaded submission, currently only supported with Vulkan.
   bool bBackendMultithreading;
 
+  // Upload large textures on a dedicated transfer queue, currently only supported with Vulkan.
+  bool bBackendTransferQueue;
+
+  // Record draws into command buffers on a separate thread from GX processing, currently only
+  // supported with Vulkan.
+  bool bBackendThreadedRecording;
+
+  // Makes the Null backend copy uniforms and texture data into host buffers like the other
+  // backends do, so that the GPU thread's CPU cost can be measured without a driver.
+  bool bNullBenchmarkMode;
+
   // Early command buffer execution interval in number of draws.
   // Currently only supported with Vulkan.
   int iCommandBufferExecuteInterval;
@@ -170,6 +215,11 @@ struct VideoConfig final
   // Shader compilation settings.
   bool bWaitForShadersBeforeStarting;
   ShaderCompilationMode iShaderCompilationMode;
+  // In hybrid mode, draws with ubershaders specialized to the TEV stage count, fog and alpha test
+  // while the specialized shaders compile.
+  bool bPartialUberShaders;
+  // Writes the pipelines which stalled emulation while compiling to <GameID>.stalls.uidcache.
+  bool bExportPipelineStalls;
 
   // Number of shader compiler threads.
   // 0 disables background compilation.
@@ -177,6 +227,23 @@ struct VideoConfig final
   int iShaderCompilerThreads;
   int iShaderPrecompilerThreads;
 
+  // Number of worker threads used to decode large textures on the CPU.
+  // 0 decodes on the GPU thread only.
+  // -1 uses an automatic number based on the CPU threads.
+  int iTextureDecoderThreads;
+
+  // Number of worker threads used to convert large vertex batches.
+  // 0 converts on the GPU thread only.
+  // -1 uses an automatic number based on the CPU threads.
+  int iVertexLoaderThreads;
+
+  // Keeps the converted vertices of indexed batches to skip converting them when they are drawn
+  // again with the same data.
+  bool bVertexLoaderCache;
+
+  // Keeps the decoded commands of display lists to skip parsing them when they are called again.
+  bool bDisplayListCache;
+
   // Static config per API
   // TODO: Move this out of VideoConfig
   struct
@@ -241,6 +308,13 @@ struct VideoConfig final
   bool UsingUberShaders() const;
   u32 GetShaderCompilerThreads() const;
   u32 GetShaderPrecompilerThreads() const;
+  u32 GetTextureDecoderThreads() const;
+  u32 GetVertexLoaderThreads() const;
+  u32 GetSWRasterizerThreads() const;
+  int GetTextureHashSamples() const
+  {
+    return texture_hash_mode == TextureHashMode::Full ? 0 : iSafeTextureCache_ColorSamples;
+  }
 };
 
 extern VideoConfig g_Config;
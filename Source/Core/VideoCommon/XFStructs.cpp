@@ -240,10 +240,29 @@ void LoadXFReg(u32 transferSize, u32 baseAddress, DataReader src)
       transferSize = 0;
     }
 
-    XFMemWritten(xfMemTransferSize, xfMemBase);
+    // Games often load the same matrices and lights again before every draw. Only break the
+    // current batch if the contents actually change, like indexed loads and register writes do.
+    bool changed = false;
     for (u32 i = 0; i < xfMemTransferSize; i++)
     {
-      ((u32*)&xfmem)[xfMemBase + i] = src.Read<u32>();
+      if (((u32*)&xfmem)[xfMemBase + i] != src.Peek<u32>(i * sizeof(u32)))
+      {
+        changed = true;
+        break;
+      }
+    }
+
+    if (changed)
+    {
+      XFMemWritten(xfMemTransferSize, xfMemBase);
+      for (u32 i = 0; i < xfMemTransferSize; i++)
+      {
+        ((u32*)&xfmem)[xfMemBase + i] = src.Read<u32>();
+      }
+    }
+    else
+    {
+      src.Skip<u32>(xfMemTransferSize);
     }
   }
 
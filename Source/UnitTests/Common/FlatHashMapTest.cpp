@@ -0,0 +1,75 @@
+// Copyright 2021 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <random>
+
+#include "Common/CommonTypes.h"
+#include "Common/FlatHashMap.h"
+
+TEST(FlatHashMap, Simple)
+{
+  Common::FlatHashMap<u32, int> map;
+
+  EXPECT_TRUE(map.Empty());
+  EXPECT_EQ(nullptr, map.Find(0));
+
+  map[0] = 1;
+  map[0x80000000] = 2;
+  EXPECT_EQ(2u, map.Size());
+  EXPECT_EQ(1, *map.Find(0));
+  EXPECT_EQ(2, *map.Find(0x80000000));
+
+  auto [value, inserted] = map.TryEmplace(0, 5);
+  EXPECT_FALSE(inserted);
+  EXPECT_EQ(1, *value);
+
+  EXPECT_TRUE(map.Erase(0));
+  EXPECT_FALSE(map.Erase(0));
+  EXPECT_FALSE(map.Contains(0));
+  EXPECT_EQ(1u, map.Size());
+
+  map.Clear();
+  EXPECT_TRUE(map.Empty());
+  EXPECT_EQ(nullptr, map.Find(0x80000000));
+}
+
+TEST(FlatHashMap, MatchesStdMap)
+{
+  // Aligned keys in a small range produce long probe sequences, which exercises the
+  // backward-shift deletion.
+  Common::FlatHashMap<u32, u32> map;
+  std::map<u32, u32> reference;
+  std::mt19937 rng(1234);
+
+  for (int i = 0; i < 100000; ++i)
+  {
+    const u32 key = 0x80000000 + (rng() % 4096) * 4;
+    if (rng() % 3 == 0)
+    {
+      EXPECT_EQ(reference.erase(key) != 0, map.Erase(key));
+    }
+    else
+    {
+      reference[key] = i;
+      map.InsertOrAssign(key, static_cast<u32>(i));
+    }
+  }
+
+  EXPECT_EQ(reference.size(), map.Size());
+  for (const auto& [key, value] : reference)
+  {
+    const u32* found = map.Find(key);
+    ASSERT_NE(nullptr, found);
+    EXPECT_EQ(value, *found);
+  }
+
+  size_t count = 0;
+  map.ForEach([&](u32 key, u32 value) {
+    EXPECT_EQ(reference[key], value);
+    ++count;
+  });
+  EXPECT_EQ(reference.size(), count);
+}
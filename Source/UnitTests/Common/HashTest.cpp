@@ -0,0 +1,65 @@
+// Copyright 2021 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include <xxhash.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/Hash.h"
+
+TEST(Hash, XXH3MatchesReference)
+{
+  Common::SetHash64Function(Common::Hash64Function::XXH3);
+
+  std::vector<u8> data(256 * 1024 + 13);
+  std::mt19937 rng(1234);
+  for (u8& byte : data)
+    byte = static_cast<u8>(rng());
+
+  // Cover the short, mid-size and long (vectorized) code paths.
+  for (u32 size : {0u, 3u, 16u, 100u, 240u, 241u, 1024u, 4099u, static_cast<u32>(data.size())})
+  {
+    const u64 reference = XXH3_64bits(data.data(), size);
+    EXPECT_EQ(reference, Common::GetHash64(data.data(), size, 0));
+    EXPECT_EQ(reference, Common::GetHash64(data.data(), size, 128));
+  }
+
+  Common::SetHash64Function();
+}
+
+TEST(Hash, XXH3DetectsSingleByteChanges)
+{
+  Common::SetHash64Function(Common::Hash64Function::XXH3);
+
+  std::vector<u8> data(64 * 1024);
+  const u64 original = Common::GetHash64(data.data(), static_cast<u32>(data.size()), 128);
+  data[data.size() / 2 + 1] = 1;
+  EXPECT_NE(original, Common::GetHash64(data.data(), static_cast<u32>(data.size()), 128));
+
+  Common::SetHash64Function();
+}
+
+class HashSpeedTest : public ::testing::TestWithParam<Common::Hash64Function>
+{
+};
+INSTANTIATE_TEST_CASE_P(Functions, HashSpeedTest,
+                        ::testing::Values(Common::Hash64Function::Default,
+                                          Common::Hash64Function::XXH3));
+
+TEST_P(HashSpeedTest, FullHash)
+{
+  Common::SetHash64Function(GetParam());
+
+  std::vector<u8> data(1024 * 1024);
+  for (size_t i = 0; i < data.size(); i++)
+    data[i] = static_cast<u8>(i * 7 + 1);
+
+  for (int i = 0; i < 2000; ++i)
+    Common::GetHash64(data.data(), static_cast<u32>(data.size()), 0);
+
+  Common::SetHash64Function();
+}
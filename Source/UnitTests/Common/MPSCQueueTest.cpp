@@ -0,0 +1,77 @@
+// Copyright 2021 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/MPSCQueue.h"
+
+TEST(MPSCQueue, Simple)
+{
+  Common::MPSCQueue<u32> q;
+
+  EXPECT_TRUE(q.Empty());
+
+  q.Push(1);
+  EXPECT_FALSE(q.Empty());
+
+  u32 v;
+  EXPECT_TRUE(q.Pop(v));
+  EXPECT_EQ(1u, v);
+  EXPECT_TRUE(q.Empty());
+  EXPECT_FALSE(q.Pop(v));
+
+  // Test the FIFO order.
+  for (u32 i = 0; i < 1000; ++i)
+    q.Push(i);
+  for (u32 i = 0; i < 1000; ++i)
+  {
+    u32 v2;
+    EXPECT_TRUE(q.Pop(v2));
+    EXPECT_EQ(i, v2);
+  }
+  EXPECT_TRUE(q.Empty());
+
+  for (u32 i = 0; i < 1000; ++i)
+    q.Push(i);
+  EXPECT_FALSE(q.Empty());
+  q.Clear();
+  EXPECT_TRUE(q.Empty());
+}
+
+TEST(MPSCQueue, MultiThreaded)
+{
+  constexpr u32 NUM_PRODUCERS = 4;
+  constexpr u32 NUM_ELEMENTS = 100000;
+  Common::MPSCQueue<u32> q;
+
+  std::vector<std::thread> producers;
+  for (u32 producer = 0; producer < NUM_PRODUCERS; ++producer)
+  {
+    producers.emplace_back([&q, producer] {
+      for (u32 i = 0; i < NUM_ELEMENTS; ++i)
+        q.Push(producer * NUM_ELEMENTS + i);
+    });
+  }
+
+  // The elements of every producer have to arrive in order.
+  std::array<u32, NUM_PRODUCERS> next{};
+  for (u32 popped = 0; popped < NUM_PRODUCERS * NUM_ELEMENTS;)
+  {
+    u32 v;
+    if (!q.Pop(v))
+      continue;
+
+    const u32 producer = v / NUM_ELEMENTS;
+    EXPECT_EQ(next[producer], v % NUM_ELEMENTS);
+    next[producer] = v % NUM_ELEMENTS + 1;
+    ++popped;
+  }
+  EXPECT_TRUE(q.Empty());
+
+  for (std::thread& thread : producers)
+    thread.join();
+}
@@ -2,7 +2,9 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <gtest/gtest.h>
+#include <vector>
 
+#include "Common/CommonTypes.h"
 #include "Common/Swap.h"
 
 TEST(Swap, SwapByValue)
@@ -12,3 +14,74 @@ TEST(Swap, SwapByValue)
   EXPECT_EQ(0x12345678u, Common::swap32(0x78563412));
   EXPECT_EQ(0x123456789abcdef0ull, Common::swap64(0xf0debc9a78563412ull));
 }
+
+namespace
+{
+// Fills a buffer with distinct bytes, so that any misplaced byte shows up.
+std::vector<u8> MakeBytes(size_t size)
+{
+  std::vector<u8> bytes(size);
+  for (size_t i = 0; i < size; ++i)
+    bytes[i] = static_cast<u8>(i * 7 + 1);
+  return bytes;
+}
+
+template <size_t element_size>
+void ExpectSwapped(const u8* dest, const u8* src, size_t count)
+{
+  for (size_t i = 0; i < count; ++i)
+  {
+    for (size_t j = 0; j < element_size; ++j)
+    {
+      ASSERT_EQ(src[i * element_size + j], dest[i * element_size + element_size - 1 - j])
+          << "element " << i << ", byte " << j;
+    }
+  }
+}
+
+// Covers counts below, at and above multiples of the 16-byte vector width, with every
+// misalignment of the source and destination.
+template <size_t element_size, typename SwapCopyFunc>
+void TestSwapCopy(SwapCopyFunc swap_copy)
+{
+  constexpr size_t MAX_COUNT = 64 / element_size + 3;
+  constexpr size_t MAX_OFFSET = 15;
+  const std::vector<u8> src_buffer = MakeBytes(MAX_COUNT * element_size + MAX_OFFSET);
+
+  for (size_t count = 0; count <= MAX_COUNT; ++count)
+  {
+    for (size_t src_offset = 0; src_offset <= MAX_OFFSET; ++src_offset)
+    {
+      for (size_t dest_offset = 0; dest_offset <= MAX_OFFSET; dest_offset += 3)
+      {
+        // One sentinel byte past the end makes sure nothing is written beyond count elements.
+        std::vector<u8> dest_buffer(count * element_size + dest_offset + 1, 0xcc);
+        const u8* src = src_buffer.data() + src_offset;
+        u8* dest = dest_buffer.data() + dest_offset;
+
+        swap_copy(dest, src, count);
+
+        ExpectSwapped<element_size>(dest, src, count);
+        EXPECT_EQ(0xcc, dest_buffer.back())
+            << "count " << count << ", offsets " << src_offset << ", " << dest_offset;
+      }
+    }
+  }
+
+  // The buffers may be the same.
+  std::vector<u8> in_place = MakeBytes(MAX_COUNT * element_size + 1);
+  const std::vector<u8> original = in_place;
+  swap_copy(in_place.data() + 1, in_place.data() + 1, MAX_COUNT);
+  ExpectSwapped<element_size>(in_place.data() + 1, original.data() + 1, MAX_COUNT);
+}
+}  // namespace
+
+TEST(Swap, SwapCopy16)
+{
+  TestSwapCopy<2>(Common::SwapCopy16);
+}
+
+TEST(Swap, SwapCopy32)
+{
+  TestSwapCopy<4>(Common::SwapCopy32);
+}
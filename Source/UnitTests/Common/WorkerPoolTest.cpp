@@ -0,0 +1,58 @@
+// Copyright 2021 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <future>
+#include <vector>
+
+#include "Common/WorkerPool.h"
+
+TEST(WorkerPool, Submit)
+{
+  Common::WorkerPool pool;
+  pool.Start(4, "WorkerPoolTest");
+
+  std::atomic<int> sum = 0;
+  std::vector<std::future<void>> futures;
+  for (int i = 1; i <= 100; ++i)
+    futures.push_back(pool.Submit([&sum, i] { sum += i; }));
+  for (std::future<void>& future : futures)
+    future.wait();
+
+  EXPECT_EQ(5050, sum.load());
+}
+
+TEST(WorkerPool, ParallelFor)
+{
+  Common::WorkerPool pool;
+  pool.Start(3, "WorkerPoolTest");
+
+  std::vector<int> values(1000, 0);
+  pool.ParallelFor(values.size(), [&values](size_t i) { values[i] = static_cast<int>(i) * 2; });
+  for (size_t i = 0; i < values.size(); ++i)
+    EXPECT_EQ(static_cast<int>(i) * 2, values[i]);
+}
+
+TEST(WorkerPool, NestedParallelFor)
+{
+  Common::WorkerPool pool;
+  pool.Start(2, "WorkerPoolTest");
+
+  std::atomic<int> count = 0;
+  pool.ParallelFor(8, [&](size_t) { pool.ParallelFor(8, [&](size_t) { ++count; }); });
+  EXPECT_EQ(64, count.load());
+}
+
+TEST(WorkerPool, NotRunning)
+{
+  Common::WorkerPool pool;
+
+  int value = 0;
+  pool.Submit([&value] { value = 1; }).wait();
+  EXPECT_EQ(1, value);
+
+  pool.ParallelFor(10, [&value](size_t i) { value += static_cast<int>(i); });
+  EXPECT_EQ(46, value);
+}
@@ -0,0 +1,83 @@
+// Copyright 2021 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/MemoryUtil.h"
+#include "Core/DSP/DSPAnalyzer.h"
+#include "Core/DSP/DSPCore.h"
+#include "Core/DSP/DSPTables.h"
+
+class DSPAnalyzerTest : public testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    DSP::InitInstructionTable();
+
+    auto options = std::make_unique<DSP::DSPInitOptions>();
+    options->irom_contents.fill(0);
+    options->coef_contents.fill(0);
+    options->core_type = DSP::DSPInitOptions::CoreType::Interpreter;
+    ASSERT_TRUE(m_core.Initialize(*options));
+  }
+
+  void TearDown() override { m_core.Shutdown(); }
+
+  // Places the code at the start of IRAM, fills the rest with NOPs and analyzes it.
+  const DSP::Analyzer& Analyze(const std::vector<u16>& code)
+  {
+    DSP::SDSP& state = m_core.DSPState();
+    Common::UnWriteProtectMemory(state.iram, DSP::DSP_IRAM_BYTE_SIZE, false);
+    std::fill(state.iram, state.iram + DSP::DSP_IRAM_SIZE, 0x0000);
+    std::copy(code.begin(), code.end(), state.iram);
+    Common::WriteProtectMemory(state.iram, DSP::DSP_IRAM_BYTE_SIZE, false);
+
+    state.GetAnalyzer().Analyze(state);
+    return state.GetAnalyzer();
+  }
+
+  DSP::DSPCore m_core;
+};
+
+TEST_F(DSPAnalyzerTest, DetectsRegisterWaitLoop)
+{
+  const DSP::Analyzer& analyzer = Analyze({
+      0x0000,          // NOP
+      0x00da, 0xffc9,  // LR     $AX0.H, @DSCR
+      0x8600,          // TSTAXH $AX0.H
+      0x0294, 0x0001,  // JNZ    0x0001
+  });
+
+  EXPECT_TRUE(analyzer.IsIdleSkip(0x0001));
+  EXPECT_FALSE(analyzer.IsIdleSkip(0x0000));
+  EXPECT_FALSE(analyzer.IsIdleSkip(0x0003));
+}
+
+TEST_F(DSPAnalyzerTest, IgnoresLoopsWithSideEffects)
+{
+  const DSP::Analyzer& analyzer = Analyze({
+      0x00da, 0xffc9,  // LR     $AX0.H, @DSCR
+      0x00fa, 0x0010,  // SR     @0x0010, $AX0.H
+      0x8600,          // TSTAXH $AX0.H
+      0x0294, 0x0000,  // JNZ    0x0000
+  });
+
+  EXPECT_FALSE(analyzer.IsIdleSkip(0x0000));
+}
+
+TEST_F(DSPAnalyzerTest, IgnoresLoopsReadingOnlyMemory)
+{
+  const DSP::Analyzer& analyzer = Analyze({
+      0x00da, 0x0352,  // LR     $AX0.H, @0x0352
+      0x8600,          // TSTAXH $AX0.H
+      0x0294, 0x0000,  // JNZ    0x0000
+  });
+
+  EXPECT_FALSE(analyzer.IsIdleSkip(0x0000));
+}
@@ -469,3 +469,52 @@ TEST_F(FileSystemTest, CreateFullPath)
   EXPECT_EQ(m_fs->CreateFullPath(Uid{0x1000}, Gid{1}, "/shared2/wc24/mbox/Readme.txt", 0, modes),
             ResultCode::Success);
 }
+
+TEST_F(FileSystemTest, MetadataPersistsAcrossInstances)
+{
+  const std::string PATH = "/shared2/f";
+  constexpr u8 ArbitraryAttribute = 0x5A;
+  constexpr Modes other_modes{Mode::ReadWrite, Mode::Read, Mode::None};
+
+  ASSERT_EQ(m_fs->CreateFile(Uid{0}, Gid{0}, PATH, ArbitraryAttribute, modes),
+            ResultCode::Success);
+  ASSERT_EQ(m_fs->SetMetadata(Uid{0}, PATH, Uid{0x1000}, Gid{1}, ArbitraryAttribute, other_modes),
+            ResultCode::Success);
+
+  // The FST is written in the background, and must have been written when the FS is destroyed.
+  m_fs.reset();
+  m_fs = IOS::HLE::Kernel{}.GetFS();
+
+  const Result<Metadata> stats = m_fs->GetMetadata(Uid{0}, Gid{0}, PATH);
+  ASSERT_TRUE(stats.Succeeded());
+  EXPECT_EQ(stats->uid, 0x1000u);
+  EXPECT_EQ(stats->gid, 1);
+  EXPECT_EQ(stats->modes, other_modes);
+  EXPECT_EQ(stats->attribute, ArbitraryAttribute);
+}
+
+TEST_F(FileSystemTest, TreeGeneration)
+{
+  u64 generation = m_fs->GetTreeGeneration();
+  const auto expect_tree_changed = [&](bool changed) {
+    const u64 new_generation = m_fs->GetTreeGeneration();
+    EXPECT_EQ(new_generation != generation, changed);
+    generation = new_generation;
+  };
+
+  ASSERT_EQ(m_fs->CreateDirectory(Uid{0}, Gid{0}, "/tmp/d", 0, modes), ResultCode::Success);
+  expect_tree_changed(true);
+  ASSERT_EQ(m_fs->CreateFile(Uid{0}, Gid{0}, "/tmp/d/f", 0, modes), ResultCode::Success);
+  expect_tree_changed(true);
+
+  // Metadata changes and failed operations don't change the tree.
+  ASSERT_EQ(m_fs->SetMetadata(Uid{0}, "/tmp/d/f", Uid{0}, Gid{0}, 1, modes), ResultCode::Success);
+  expect_tree_changed(false);
+  ASSERT_NE(m_fs->CreateFile(Uid{0}, Gid{0}, "/tmp/d/f", 0, modes), ResultCode::Success);
+  expect_tree_changed(false);
+
+  ASSERT_EQ(m_fs->Rename(Uid{0}, Gid{0}, "/tmp/d", "/tmp/e"), ResultCode::Success);
+  expect_tree_changed(true);
+  ASSERT_EQ(m_fs->Delete(Uid{0}, Gid{0}, "/tmp/e"), ResultCode::Success);
+  expect_tree_changed(true);
+}
@@ -0,0 +1,143 @@
+// Copyright 2021 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "VideoBackends/Software/EfbInterface.h"
+#include "VideoBackends/Software/NativeVertexFormat.h"
+#include "VideoBackends/Software/Rasterizer.h"
+#include "VideoBackends/Software/Tev.h"
+#include "VideoCommon/BPMemory.h"
+#include "VideoCommon/VideoCommon.h"
+#include "VideoCommon/VideoConfig.h"
+
+namespace
+{
+constexpr u32 NUM_BATCHES = 8;
+constexpr u32 TRIANGLES_PER_BATCH = 32;
+
+// Sets up a single TEV stage which blends the konst colour with the rasterized colour, so that
+// the output depends on both the per-batch TEV state and the per-vertex data.
+void SetUpBPState()
+{
+  std::memset(static_cast<void*>(&bpmem), 0, sizeof(bpmem));
+  bpmem.genMode.numtevstages = 0;  // One stage
+  bpmem.genMode.numcolchans = 1;
+  bpmem.genMode.numtexgens = 0;
+
+  bpmem.scissorBR.x = EFB_WIDTH - 1;
+  bpmem.scissorBR.y = EFB_HEIGHT - 1;
+
+  bpmem.tevorders[0].colorchan0 = RasColorChan::Color0;
+  bpmem.tevksel[0].kcsel0 = KonstSel::K0;
+  bpmem.tevksel[0].kasel0 = KonstSel::K1_A;
+
+  auto& cc = bpmem.combiners[0].colorC;
+  cc.a = TevColorArg::Konst;
+  cc.b = TevColorArg::RasColor;
+  cc.c = TevColorArg::Half;
+  cc.d = TevColorArg::Zero;
+  cc.clamp = true;
+
+  auto& ac = bpmem.combiners[0].alphaC;
+  ac.a = TevAlphaArg::Konst;
+  ac.b = TevAlphaArg::RasAlpha;
+  ac.c = TevAlphaArg::Zero;
+  ac.d = TevAlphaArg::Zero;
+  ac.clamp = true;
+
+  bpmem.alpha_test.comp0 = CompareMode::Always;
+  bpmem.alpha_test.comp1 = CompareMode::Always;
+  bpmem.alpha_test.logic = AlphaTestOp::And;
+
+  bpmem.blendmode.colorupdate = true;
+  bpmem.blendmode.alphaupdate = true;
+}
+
+OutputVertexData MakeVertex(std::mt19937& rng)
+{
+  std::uniform_real_distribution<float> x_dist(-32.f, EFB_WIDTH + 32.f);
+  std::uniform_real_distribution<float> y_dist(-32.f, EFB_HEIGHT + 32.f);
+  std::uniform_int_distribution<u32> color_dist(0, 255);
+
+  OutputVertexData vertex;
+  vertex.screenPosition = {x_dist(rng), y_dist(rng), 0.5f};
+  vertex.projectedPosition.w = 1.f;
+  for (u8& component : vertex.color[0])
+    component = static_cast<u8>(color_dist(rng));
+  return vertex;
+}
+
+// Draws the same random batches with the given number of rasterizer threads and returns the EFB.
+std::vector<u32> DrawBatches(int threads)
+{
+  g_ActiveConfig.iSWRasterizerThreads = threads;
+  SetUpBPState();
+  Rasterizer::Init();
+
+  std::array<u8, 4> black{};
+  for (u16 y = 0; y < EFB_HEIGHT; y++)
+  {
+    for (u16 x = 0; x < EFB_WIDTH; x++)
+      EfbInterface::SetColor(x, y, black.data());
+  }
+
+  std::mt19937 rng(1234);
+  std::uniform_int_distribution<int> konst_dist(0, 255);
+  for (u32 batch = 0; batch < NUM_BATCHES; batch++)
+  {
+    for (int reg = 0; reg < 4; reg++)
+    {
+      Rasterizer::SetTevReg(reg, Tev::RED_C, konst_dist(rng));
+      Rasterizer::SetTevReg(reg, Tev::GRN_C, konst_dist(rng));
+      Rasterizer::SetTevReg(reg, Tev::BLU_C, konst_dist(rng));
+      Rasterizer::SetTevReg(reg, Tev::ALP_C, konst_dist(rng));
+    }
+
+    Rasterizer::BeginBatch();
+    for (u32 i = 0; i < TRIANGLES_PER_BATCH; i++)
+    {
+      const OutputVertexData v0 = MakeVertex(rng);
+      const OutputVertexData v1 = MakeVertex(rng);
+      const OutputVertexData v2 = MakeVertex(rng);
+      Rasterizer::DrawTriangleFrontFace(&v0, &v1, &v2);
+    }
+    Rasterizer::EndBatch();
+  }
+
+  Rasterizer::Shutdown();
+
+  std::vector<u32> efb;
+  efb.reserve(EFB_WIDTH * EFB_HEIGHT);
+  for (u16 y = 0; y < EFB_HEIGHT; y++)
+  {
+    for (u16 x = 0; x < EFB_WIDTH; x++)
+      efb.push_back(EfbInterface::GetColor(x, y));
+  }
+  return efb;
+}
+}  // namespace
+
+TEST(SWRasterizer, ThreadedMatchesSingleThreaded)
+{
+  const std::vector<u32> single_threaded = DrawBatches(0);
+  const std::vector<u32> threaded = DrawBatches(3);
+
+  // Make sure the batches actually drew something with the konst colours.
+  u32 drawn_pixels = 0;
+  for (const u32 color : single_threaded)
+    drawn_pixels += color != 0;
+  EXPECT_GT(drawn_pixels, 0u);
+
+  ASSERT_EQ(single_threaded.size(), threaded.size());
+  for (size_t i = 0; i < single_threaded.size(); i++)
+  {
+    ASSERT_EQ(single_threaded[i], threaded[i])
+        << "at " << i % EFB_WIDTH << ", " << i / EFB_WIDTH;
+  }
+}